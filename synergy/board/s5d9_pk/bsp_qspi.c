@@ -74,6 +74,12 @@
 /* Flash device page size */
 #define BSP_PRV_QSPI_W25Q64FV_PAGE_SIZE (256U)
 
+/* Time allowed for the controller to enter or exit XIP mode, and the interval for checking it, when the BSP timer
+ * service is open. Otherwise the status is checked BSP_PRV_QSPI_XIP_TIMEOUT_LOOPS times. */
+#define BSP_PRV_QSPI_XIP_TIMEOUT_US     (100U)
+#define BSP_PRV_QSPI_XIP_POLL_US        (1U)
+#define BSP_PRV_QSPI_XIP_TIMEOUT_LOOPS  (0xfffU)
+
 /***********************************************************************************************************************
  * Private global variables
  **********************************************************************************************************************/
@@ -125,6 +131,67 @@ static void bsp_qspi_device_reset ()
 }
 
 
+/*******************************************************************************************************************//**
+ * @brief   Check whether the controller has entered XIP mode
+ *
+ * @param[in]  p_context  Not used
+ *
+ * @retval true   The controller is in XIP mode
+ * @retval false  The controller is not in XIP mode
+ **********************************************************************************************************************/
+static bool bsp_qspi_xip_active (void * p_context)
+{
+    SSP_PARAMETER_NOT_USED(p_context);
+
+    return (0U != R_QSPI->SFMSDC_b.SFMXST);
+}
+
+/*******************************************************************************************************************//**
+ * @brief   Check whether the controller has exited XIP mode
+ *
+ * @param[in]  p_context  Not used
+ *
+ * @retval true   The controller is not in XIP mode
+ * @retval false  The controller is in XIP mode
+ **********************************************************************************************************************/
+static bool bsp_qspi_xip_inactive (void * p_context)
+{
+    return !bsp_qspi_xip_active(p_context);
+}
+
+/*******************************************************************************************************************//**
+ * @brief   Wait for the controller to enter or exit XIP mode, or for the timeout
+ *
+ * @param[in]  p_condition  bsp_qspi_xip_active or bsp_qspi_xip_inactive
+ **********************************************************************************************************************/
+static void bsp_qspi_xip_wait (bsp_timer_condition_t p_condition)
+{
+    uint64_t now         = 0U;
+    uint64_t counts      = 0U;
+    uint64_t poll_counts = 0U;
+
+    /* Measure the timeout on the timer service when it is open. */
+    if ((SSP_SUCCESS == R_BSP_TimestampGet(&now)) &&
+        (SSP_SUCCESS == R_BSP_TimerCountsGet(BSP_PRV_QSPI_XIP_TIMEOUT_US, BSP_DELAY_UNITS_MICROSECONDS, &counts)) &&
+        (SSP_SUCCESS == R_BSP_TimerCountsGet(BSP_PRV_QSPI_XIP_POLL_US, BSP_DELAY_UNITS_MICROSECONDS, &poll_counts)))
+    {
+        if (SSP_ERR_NOT_OPEN != R_BSP_TimerWaitUntil(now + counts, p_condition, NULL, poll_counts))
+        {
+            return;
+        }
+    }
+
+    volatile uint32_t timeout = BSP_PRV_QSPI_XIP_TIMEOUT_LOOPS;
+    while (!p_condition(NULL))
+    {
+        timeout--;
+        if (0U == timeout)
+        {
+            return;
+        }
+    }
+}
+
 /*******************************************************************************************************************//**
  * @brief   Enter or exit XIP mode
  *
@@ -134,7 +201,6 @@ static void bsp_qspi_device_reset ()
 static void bsp_qspi_xip_mode (bool enter_mode)
 {
     volatile uint32_t i = 0;
-    volatile uint32_t timeout;
 
     SSP_PARAMETER_NOT_USED(i);
 
@@ -152,15 +218,7 @@ static void bsp_qspi_xip_mode (bool enter_mode)
 
 
         /* Wait for the controller to enter XIP mode */
-        timeout = 0xfffU;
-        while (0U == R_QSPI->SFMSDC_b.SFMXST)
-        {
-            timeout--;
-            if (0U == timeout)
-            {
-                return;
-            }
-        }
+        bsp_qspi_xip_wait(bsp_qspi_xip_active);
     }
     else
     {
@@ -178,15 +236,7 @@ static void bsp_qspi_xip_mode (bool enter_mode)
 
 
         /* Wait for the controller to exit XIP mode */
-        timeout = 0xfffU;
-        while (R_QSPI->SFMSDC_b.SFMXST)
-        {
-            timeout--;
-            if (0U == timeout)
-            {
-                return;
-            }
-        }
+        bsp_qspi_xip_wait(bsp_qspi_xip_inactive);
     }
 }
 
@@ -68,6 +68,11 @@ Includes   <System Includes> , "Project Includes"
 
 #include "../../src/bsp/mcu/all/bsp_mcu_api.h"
 
+/* Host simulation of the MCU (s5d9_sdk_host build). */
+#if defined(BSP_HOST_SIM)
+#include "../../src/bsp/mcu/host/bsp_sim.h"
+#endif
+
 /* Build time error checking. */
 #include "../../src/bsp/mcu/all/bsp_error_checking.h"
 
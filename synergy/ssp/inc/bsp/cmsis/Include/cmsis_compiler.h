@@ -47,6 +47,13 @@
   #include "cmsis_armclang.h"
 
 
+/*
+ * Host simulation build (native GCC/Clang, see bsp_sim.h)
+ */
+#elif defined ( BSP_HOST_SIM )
+  #include "cmsis_host.h"
+
+
 /*
  * GNU Compiler
  */
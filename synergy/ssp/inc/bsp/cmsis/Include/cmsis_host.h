@@ -0,0 +1,416 @@
+/**************************************************************************//**
+ * @file     cmsis_host.h
+ * @brief    CMSIS compiler header for the s5d9_sdk host simulation build
+ * @details  Provides the CMSIS-Core compiler abstraction (attributes, core
+ *           instructions and core register access) for a native GCC/Clang
+ *           build. Core registers that do not exist on the host (PRIMASK,
+ *           BASEPRI, IPSR, ...) are backed by simulator state owned by
+ *           bsp_sim.c so that drivers, the BSP and the simulated NVIC agree
+ *           on interrupt masking and the active exception number.
+ ******************************************************************************/
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __CMSIS_HOST_H
+#define __CMSIS_HOST_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/* CMSIS compiler specific defines */
+#ifndef   __ASM
+  #define __ASM                                  __asm
+#endif
+#ifndef   __INLINE
+  #define __INLINE                               inline
+#endif
+#ifndef   __STATIC_INLINE
+  #define __STATIC_INLINE                        static inline
+#endif
+#ifndef   __STATIC_FORCEINLINE
+  #define __STATIC_FORCEINLINE                   __attribute__((always_inline)) static inline
+#endif
+#ifndef   __NO_RETURN
+  #define __NO_RETURN                            __attribute__((__noreturn__))
+#endif
+#ifndef   __USED
+  #define __USED                                 __attribute__((used))
+#endif
+#ifndef   __WEAK
+  #define __WEAK                                 __attribute__((weak))
+#endif
+#ifndef   __PACKED
+  #define __PACKED                               __attribute__((packed, aligned(1)))
+#endif
+#ifndef   __PACKED_STRUCT
+  #define __PACKED_STRUCT                        struct __attribute__((packed, aligned(1)))
+#endif
+#ifndef   __PACKED_UNION
+  #define __PACKED_UNION                         union __attribute__((packed, aligned(1)))
+#endif
+#ifndef   __UNALIGNED_UINT32        /* deprecated */
+  struct __attribute__((packed)) T_UINT32 { uint32_t v; };
+  #define __UNALIGNED_UINT32(x)                  (((struct T_UINT32 *)(x))->v)
+#endif
+#ifndef   __UNALIGNED_UINT16_WRITE
+  __PACKED_STRUCT T_UINT16_WRITE { uint16_t v; };
+  #define __UNALIGNED_UINT16_WRITE(addr, val)    (void)((((struct T_UINT16_WRITE *)(void *)(addr))->v) = (val))
+#endif
+#ifndef   __UNALIGNED_UINT16_READ
+  __PACKED_STRUCT T_UINT16_READ { uint16_t v; };
+  #define __UNALIGNED_UINT16_READ(addr)          (((const struct T_UINT16_READ *)(const void *)(addr))->v)
+#endif
+#ifndef   __UNALIGNED_UINT32_WRITE
+  __PACKED_STRUCT T_UINT32_WRITE { uint32_t v; };
+  #define __UNALIGNED_UINT32_WRITE(addr, val)    (void)((((struct T_UINT32_WRITE *)(void *)(addr))->v) = (val))
+#endif
+#ifndef   __UNALIGNED_UINT32_READ
+  __PACKED_STRUCT T_UINT32_READ { uint32_t v; };
+  #define __UNALIGNED_UINT32_READ(addr)          (((const struct T_UINT32_READ *)(const void *)(addr))->v)
+#endif
+#ifndef   __ALIGNED
+  #define __ALIGNED(x)                           __attribute__((aligned(x)))
+#endif
+#ifndef   __RESTRICT
+  #define __RESTRICT                             __restrict
+#endif
+#ifndef   __COMPILER_BARRIER
+  #define __COMPILER_BARRIER()                   __ASM volatile("":::"memory")
+#endif
+
+/* NVIC set/clear registers are routed to the simulated NVIC, see cmsis_nvic_host.h. */
+#ifndef CMSIS_NVIC_VIRTUAL
+  #define CMSIS_NVIC_VIRTUAL
+  #define CMSIS_NVIC_VIRTUAL_HEADER_FILE         "cmsis_nvic_host.h"
+#endif
+
+/* ###########################  Simulated core state  ########################### */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Simulated core registers, owned by bsp_sim.c. */
+typedef struct st_cmsis_host_core
+{
+    volatile uint32_t primask;         ///< PRIMASK, bit 0 masks all configurable interrupts
+    volatile uint32_t faultmask;       ///< FAULTMASK
+    volatile uint32_t basepri;         ///< BASEPRI, upper implemented bits only
+    volatile uint32_t ipsr;            ///< Active exception number, 0 in thread mode
+    volatile uint32_t control;         ///< CONTROL
+    volatile uint32_t psp;             ///< Process stack pointer (not used by the simulator)
+    volatile uint32_t msp;             ///< Main stack pointer (not used by the simulator)
+    volatile uint32_t fpscr;           ///< FPSCR
+    volatile uint32_t apsr_ge;         ///< APSR.GE[3:0], written by SIMD add/subtract, read by __SEL
+} cmsis_host_core_t;
+
+extern cmsis_host_core_t g_cmsis_host_core;
+
+/** Called by __WFI()/__WFE() so the simulator can advance peripheral models and deliver pending interrupts. */
+void cmsis_host_wait_for_event(void);
+
+/** Called whenever PRIMASK/BASEPRI is lowered so that interrupts pended while masked are taken immediately. */
+void cmsis_host_mask_lowered(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/* ###########################  Core Function Access  ########################### */
+
+#define __NOP()                             __ASM volatile ("" ::: "memory")
+#define __WFI()                             cmsis_host_wait_for_event()
+#define __WFE()                             cmsis_host_wait_for_event()
+#define __SEV()                             __NOP()
+
+__STATIC_FORCEINLINE void __ISB(void)
+{
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+__STATIC_FORCEINLINE void __DSB(void)
+{
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+__STATIC_FORCEINLINE void __DMB(void)
+{
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+__STATIC_FORCEINLINE uint32_t __REV(uint32_t value)
+{
+  return __builtin_bswap32(value);
+}
+
+__STATIC_FORCEINLINE uint32_t __REV16(uint32_t value)
+{
+  return ((value & 0xFF00FF00U) >> 8U) | ((value & 0x00FF00FFU) << 8U);
+}
+
+__STATIC_FORCEINLINE int16_t __REVSH(int16_t value)
+{
+  return (int16_t)__builtin_bswap16((uint16_t)value);
+}
+
+__STATIC_FORCEINLINE uint32_t __ROR(uint32_t op1, uint32_t op2)
+{
+  op2 %= 32U;
+  if (op2 == 0U)
+  {
+    return op1;
+  }
+  return (op1 >> op2) | (op1 << (32U - op2));
+}
+
+/* A breakpoint on the target halts into the debugger; on the host it terminates the run so CI sees the failure. */
+#define __BKPT(value)                       abort()
+
+__STATIC_FORCEINLINE uint32_t __RBIT(uint32_t value)
+{
+  uint32_t result = 0U;
+  for (uint32_t i = 0U; i < 32U; i++)
+  {
+    result = (result << 1U) | (value & 1U);
+    value >>= 1U;
+  }
+  return result;
+}
+
+__STATIC_FORCEINLINE uint8_t __CLZ(uint32_t value)
+{
+  if (value == 0U)
+  {
+    return 32U;
+  }
+  return (uint8_t)__builtin_clz(value);
+}
+
+/* Exclusive access. The host has no exclusive monitor; a compare-and-swap against the value observed by the last
+ * LDREX gives the same success/failure contract for the lock-free patterns used in the SSP. */
+extern __thread uint32_t g_cmsis_host_exclusive;
+
+__STATIC_FORCEINLINE uint8_t __LDREXB(volatile uint8_t *addr)
+{
+  uint8_t value = __atomic_load_n(addr, __ATOMIC_ACQUIRE);
+  g_cmsis_host_exclusive = value;
+  return value;
+}
+
+__STATIC_FORCEINLINE uint16_t __LDREXH(volatile uint16_t *addr)
+{
+  uint16_t value = __atomic_load_n(addr, __ATOMIC_ACQUIRE);
+  g_cmsis_host_exclusive = value;
+  return value;
+}
+
+__STATIC_FORCEINLINE uint32_t __LDREXW(volatile uint32_t *addr)
+{
+  uint32_t value = __atomic_load_n(addr, __ATOMIC_ACQUIRE);
+  g_cmsis_host_exclusive = value;
+  return value;
+}
+
+__STATIC_FORCEINLINE uint32_t __STREXB(uint8_t value, volatile uint8_t *addr)
+{
+  uint8_t expected = (uint8_t)g_cmsis_host_exclusive;
+  return __atomic_compare_exchange_n(addr, &expected, value, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) ? 0U : 1U;
+}
+
+__STATIC_FORCEINLINE uint32_t __STREXH(uint16_t value, volatile uint16_t *addr)
+{
+  uint16_t expected = (uint16_t)g_cmsis_host_exclusive;
+  return __atomic_compare_exchange_n(addr, &expected, value, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) ? 0U : 1U;
+}
+
+__STATIC_FORCEINLINE uint32_t __STREXW(uint32_t value, volatile uint32_t *addr)
+{
+  uint32_t expected = g_cmsis_host_exclusive;
+  return __atomic_compare_exchange_n(addr, &expected, value, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) ? 0U : 1U;
+}
+
+__STATIC_FORCEINLINE void __CLREX(void)
+{
+  g_cmsis_host_exclusive = 0xFFFFFFFFU;
+}
+
+__STATIC_FORCEINLINE int32_t __SSAT(int32_t val, uint32_t sat)
+{
+  if ((sat >= 1U) && (sat <= 32U))
+  {
+    const int32_t max = (int32_t)((1U << (sat - 1U)) - 1U);
+    const int32_t min = -1 - max ;
+    if (val > max)
+    {
+      return max;
+    }
+    else if (val < min)
+    {
+      return min;
+    }
+  }
+  return val;
+}
+
+__STATIC_FORCEINLINE uint32_t __USAT(int32_t val, uint32_t sat)
+{
+  if (sat <= 31U)
+  {
+    const uint32_t max = ((1U << sat) - 1U);
+    if (val > (int32_t)max)
+    {
+      return max;
+    }
+    else if (val < 0)
+    {
+      return 0U;
+    }
+  }
+  return (uint32_t)val;
+}
+
+/* ###########################  Core Register Access  ########################### */
+
+__STATIC_FORCEINLINE void __enable_irq(void)
+{
+  __COMPILER_BARRIER();
+  g_cmsis_host_core.primask = 0U;
+  cmsis_host_mask_lowered();
+}
+
+__STATIC_FORCEINLINE void __disable_irq(void)
+{
+  g_cmsis_host_core.primask = 1U;
+  __COMPILER_BARRIER();
+}
+
+__STATIC_FORCEINLINE uint32_t __get_CONTROL(void)
+{
+  return g_cmsis_host_core.control;
+}
+
+__STATIC_FORCEINLINE void __set_CONTROL(uint32_t control)
+{
+  g_cmsis_host_core.control = control;
+}
+
+__STATIC_FORCEINLINE uint32_t __get_IPSR(void)
+{
+  return g_cmsis_host_core.ipsr;
+}
+
+__STATIC_FORCEINLINE uint32_t __get_APSR(void)
+{
+  return (g_cmsis_host_core.apsr_ge & 0xFU) << 16U;
+}
+
+__STATIC_FORCEINLINE uint32_t __get_xPSR(void)
+{
+  return __get_APSR() | g_cmsis_host_core.ipsr;
+}
+
+__STATIC_FORCEINLINE uint32_t __get_PSP(void)
+{
+  return g_cmsis_host_core.psp;
+}
+
+__STATIC_FORCEINLINE void __set_PSP(uint32_t topOfProcStack)
+{
+  g_cmsis_host_core.psp = topOfProcStack;
+}
+
+__STATIC_FORCEINLINE uint32_t __get_MSP(void)
+{
+  return g_cmsis_host_core.msp;
+}
+
+__STATIC_FORCEINLINE void __set_MSP(uint32_t topOfMainStack)
+{
+  g_cmsis_host_core.msp = topOfMainStack;
+}
+
+__STATIC_FORCEINLINE uint32_t __get_PRIMASK(void)
+{
+  return g_cmsis_host_core.primask;
+}
+
+__STATIC_FORCEINLINE void __set_PRIMASK(uint32_t priMask)
+{
+  __COMPILER_BARRIER();
+  g_cmsis_host_core.primask = priMask & 1U;
+  if (0U == (priMask & 1U))
+  {
+    cmsis_host_mask_lowered();
+  }
+}
+
+__STATIC_FORCEINLINE void __enable_fault_irq(void)
+{
+  g_cmsis_host_core.faultmask = 0U;
+  cmsis_host_mask_lowered();
+}
+
+__STATIC_FORCEINLINE void __disable_fault_irq(void)
+{
+  g_cmsis_host_core.faultmask = 1U;
+}
+
+__STATIC_FORCEINLINE uint32_t __get_BASEPRI(void)
+{
+  return g_cmsis_host_core.basepri;
+}
+
+__STATIC_FORCEINLINE void __set_BASEPRI(uint32_t basePri)
+{
+  uint32_t previous = g_cmsis_host_core.basepri;
+  __COMPILER_BARRIER();
+  g_cmsis_host_core.basepri = basePri & 0xFFU;
+  if ((0U == g_cmsis_host_core.basepri) || ((0U != previous) && (g_cmsis_host_core.basepri > previous)))
+  {
+    cmsis_host_mask_lowered();
+  }
+}
+
+__STATIC_FORCEINLINE void __set_BASEPRI_MAX(uint32_t basePri)
+{
+  basePri &= 0xFFU;
+  if ((0U != basePri) && ((0U == g_cmsis_host_core.basepri) || (basePri < g_cmsis_host_core.basepri)))
+  {
+    g_cmsis_host_core.basepri = basePri;
+  }
+}
+
+__STATIC_FORCEINLINE uint32_t __get_FAULTMASK(void)
+{
+  return g_cmsis_host_core.faultmask;
+}
+
+__STATIC_FORCEINLINE void __set_FAULTMASK(uint32_t faultMask)
+{
+  g_cmsis_host_core.faultmask = faultMask & 1U;
+}
+
+__STATIC_FORCEINLINE uint32_t __get_FPSCR(void)
+{
+  return g_cmsis_host_core.fpscr;
+}
+
+__STATIC_FORCEINLINE void __set_FPSCR(uint32_t fpscr)
+{
+  g_cmsis_host_core.fpscr = fpscr;
+}
+
+#endif /* __CMSIS_HOST_H */
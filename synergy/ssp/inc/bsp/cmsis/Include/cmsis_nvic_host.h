@@ -0,0 +1,60 @@
+/**************************************************************************//**
+ * @file     cmsis_nvic_host.h
+ * @brief    CMSIS virtual NVIC interface for the s5d9_sdk host simulation build
+ * @details  Selected through CMSIS_NVIC_VIRTUAL by cmsis_host.h. The NVIC
+ *           set/clear register pairs (ISER/ICER, ISPR/ICPR) have write-one
+ *           semantics that plain memory cannot model, so enable, pending and
+ *           priority state is kept by the simulated NVIC in bsp_sim.c.
+ ******************************************************************************/
+/*
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __CMSIS_NVIC_HOST_H
+#define __CMSIS_NVIC_HOST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void     cmsis_host_nvic_enable_irq(IRQn_Type IRQn);
+uint32_t cmsis_host_nvic_get_enable_irq(IRQn_Type IRQn);
+void     cmsis_host_nvic_disable_irq(IRQn_Type IRQn);
+uint32_t cmsis_host_nvic_get_pending_irq(IRQn_Type IRQn);
+void     cmsis_host_nvic_set_pending_irq(IRQn_Type IRQn);
+void     cmsis_host_nvic_clear_pending_irq(IRQn_Type IRQn);
+uint32_t cmsis_host_nvic_get_active(IRQn_Type IRQn);
+void     cmsis_host_nvic_set_priority(IRQn_Type IRQn, uint32_t priority);
+uint32_t cmsis_host_nvic_get_priority(IRQn_Type IRQn);
+__NO_RETURN void cmsis_host_nvic_system_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define NVIC_SetPriorityGrouping    __NVIC_SetPriorityGrouping
+#define NVIC_GetPriorityGrouping    __NVIC_GetPriorityGrouping
+#define NVIC_EnableIRQ              cmsis_host_nvic_enable_irq
+#define NVIC_GetEnableIRQ           cmsis_host_nvic_get_enable_irq
+#define NVIC_DisableIRQ             cmsis_host_nvic_disable_irq
+#define NVIC_GetPendingIRQ          cmsis_host_nvic_get_pending_irq
+#define NVIC_SetPendingIRQ          cmsis_host_nvic_set_pending_irq
+#define NVIC_ClearPendingIRQ        cmsis_host_nvic_clear_pending_irq
+#define NVIC_GetActive              cmsis_host_nvic_get_active
+#define NVIC_SetPriority            cmsis_host_nvic_set_priority
+#define NVIC_GetPriority            cmsis_host_nvic_get_priority
+#define NVIC_SystemReset            cmsis_host_nvic_system_reset
+
+#endif /* __CMSIS_NVIC_HOST_H */
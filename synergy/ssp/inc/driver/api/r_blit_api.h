@@ -0,0 +1,214 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : r_blit_api.h
+ * Description  : 2D blitter Interface
+ **********************************************************************************************************************/
+
+#ifndef DRV_BLIT_API_H
+#define DRV_BLIT_API_H
+
+/*******************************************************************************************************************//**
+ * @ingroup Interface_Library
+ * @defgroup BLIT_API Blitter Interface
+ *
+ * @brief Interface for filling, copying, blending and converting rectangles of pixels.
+ *
+ * @section BLIT_API_SUMMARY Summary
+ * The blitter interface draws into surfaces that use the pixel formats of the display interface, so the results can
+ * be scanned out by a display layer directly. It provides:
+ * - Rectangle fill with a color.
+ * - Copy between surfaces of the same format, each with its own stride.
+ * - Per-pixel alpha blending (source over destination) with an additional global alpha.
+ * - Conversion between pixel formats, including CLUT8 sources expanded through their color look up table.
+ *
+ * Rectangles are clipped to both surfaces. Source and destination must not overlap.
+ *
+ * Related SSP architecture topics:
+ *  - @ref ssp-interfaces
+ *  - @ref ssp-predefined-layers
+ *  - @ref using-ssp-modules
+ *
+ * Blitter Interface description: @ref HALBlitInterface
+ *
+ * @{
+ **********************************************************************************************************************/
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+/* Register definitions, common services and error codes. */
+#include "bsp_api.h"
+#include "r_display_api.h"
+#include "r_transfer_api.h"
+
+/* Common macro for SSP header files. There is also a corresponding SSP_FOOTER macro at the end of this file. */
+SSP_HEADER
+
+/**********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+#define BLIT_API_VERSION_MAJOR (1U)
+#define BLIT_API_VERSION_MINOR (0U)
+
+/**********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Surface to draw into or read from. The pixel format is one of the display input formats, except CLUT4 and CLUT1.
+ *  DISPLAY_IN_FORMAT_32BITS_RGB888 pixels are read as opaque and written with an alpha of 0xFF. */
+typedef struct st_blit_surface
+{
+    void                * p_base;       ///< First pixel of the surface
+    uint16_t              width;        ///< Width in pixels
+    uint16_t              height;       ///< Height in lines
+    uint32_t              stride;       ///< Distance between the starts of two lines in bytes
+    display_in_format_t   format;       ///< Pixel format
+    uint32_t const      * p_clut;       ///< ARGB8888 color look up table of a CLUT8 source, unused for other formats
+} blit_surface_t;
+
+/** Rectangle of a surface */
+typedef struct st_blit_rect
+{
+    int16_t   x;                        ///< Left edge in pixels, may be negative
+    int16_t   y;                        ///< Top edge in lines, may be negative
+    uint16_t  width;                    ///< Width in pixels
+    uint16_t  height;                   ///< Height in lines
+} blit_rect_t;
+
+/** Blitter control block.  Allocate an instance specific control block to pass into the blitter API calls.
+ * @par Implemented as
+ * - blit_instance_ctrl_t
+ */
+typedef void blit_ctrl_t;
+
+/** User configuration structure, used in open function */
+typedef struct st_blit_cfg
+{
+    /** DMAC instance for large copies, NULL to copy with the CPU only. The driver configures and opens the
+     *  instance. */
+    transfer_instance_t const  * p_transfer;
+    uint32_t                     dma_threshold_bytes;  ///< Smallest copy given to the DMAC, 0 selects
+                                                       ///< BLIT_CFG_DMA_THRESHOLD_BYTES
+    void const                 * p_extend;             ///< Blitter implementation dependent configuration
+} blit_cfg_t;
+
+/** Blitter API structure. General blitter functions implemented at the HAL layer will follow this API. */
+typedef struct st_blit_api
+{
+    /** Open the blitter.
+     * @par Implemented as
+     * - R_BLIT_Open()
+     *
+     * @param[in] p_ctrl     Pointer to the control block.
+     * @param[in] p_cfg      Pointer to a configuration structure.
+     **/
+    ssp_err_t (* open)(blit_ctrl_t * const p_ctrl, blit_cfg_t const * const p_cfg);
+
+    /** Fill a rectangle with a color.
+     * @par Implemented as
+     * - R_BLIT_Fill()
+     *
+     * @param[in] p_ctrl     Pointer to the control block.
+     * @param[in] p_dest     Surface to fill.
+     * @param[in] p_rect     Rectangle to fill, NULL for the whole surface.
+     * @param[in] color      ARGB8888 color, converted to the surface format. The color index for CLUT8 surfaces.
+     **/
+    ssp_err_t (* fill)(blit_ctrl_t * const p_ctrl, blit_surface_t const * const p_dest,
+                       blit_rect_t const * const p_rect, uint32_t color);
+
+    /** Copy a rectangle to a surface of the same format.
+     * @par Implemented as
+     * - R_BLIT_Copy()
+     *
+     * @param[in] p_ctrl     Pointer to the control block.
+     * @param[in] p_dest     Destination surface.
+     * @param[in] x          Left edge of the destination in pixels.
+     * @param[in] y          Top edge of the destination in lines.
+     * @param[in] p_src      Source surface.
+     * @param[in] p_rect     Source rectangle, NULL for the whole source surface.
+     **/
+    ssp_err_t (* copy)(blit_ctrl_t * const p_ctrl, blit_surface_t const * const p_dest, int16_t x, int16_t y,
+                       blit_surface_t const * const p_src, blit_rect_t const * const p_rect);
+
+    /** Blend a rectangle over a surface. Each source pixel's alpha is scaled by the global alpha, and the result
+     *  alpha is source over destination.
+     * @par Implemented as
+     * - R_BLIT_Blend()
+     *
+     * @param[in] p_ctrl     Pointer to the control block.
+     * @param[in] p_dest     Destination surface, not CLUT8.
+     * @param[in] x          Left edge of the destination in pixels.
+     * @param[in] y          Top edge of the destination in lines.
+     * @param[in] p_src      Source surface.
+     * @param[in] p_rect     Source rectangle, NULL for the whole source surface.
+     * @param[in] alpha      Global alpha, 0xFF to use the source alpha only.
+     **/
+    ssp_err_t (* blend)(blit_ctrl_t * const p_ctrl, blit_surface_t const * const p_dest, int16_t x, int16_t y,
+                        blit_surface_t const * const p_src, blit_rect_t const * const p_rect, uint8_t alpha);
+
+    /** Copy a rectangle to a surface of another format.
+     * @par Implemented as
+     * - R_BLIT_Convert()
+     *
+     * @param[in] p_ctrl     Pointer to the control block.
+     * @param[in] p_dest     Destination surface, not CLUT8.
+     * @param[in] x          Left edge of the destination in pixels.
+     * @param[in] y          Top edge of the destination in lines.
+     * @param[in] p_src      Source surface.
+     * @param[in] p_rect     Source rectangle, NULL for the whole source surface.
+     **/
+    ssp_err_t (* convert)(blit_ctrl_t * const p_ctrl, blit_surface_t const * const p_dest, int16_t x, int16_t y,
+                          blit_surface_t const * const p_src, blit_rect_t const * const p_rect);
+
+    /** Close the blitter.
+     * @par Implemented as
+     * - R_BLIT_Close()
+     *
+     * @param[in] p_ctrl     Pointer to the control block.
+     **/
+    ssp_err_t (* close)(blit_ctrl_t * const p_ctrl);
+
+    /** Get the driver version based on compile time macros.
+     * @par Implemented as
+     * - R_BLIT_VersionGet()
+     *
+     * @param[out] p_version  Code and API version.
+     **/
+    ssp_err_t (* versionGet)(ssp_version_t * const p_version);
+} blit_api_t;
+
+/** This structure encompasses everything that is needed to use an instance of this interface. */
+typedef struct st_blit_instance
+{
+    blit_ctrl_t      * p_ctrl;    ///< Pointer to the control structure for this instance
+    blit_cfg_t const * p_cfg;     ///< Pointer to the configuration structure for this instance
+    blit_api_t const * p_api;     ///< Pointer to the API structure for this instance
+} blit_instance_t;
+
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup BLIT_API)
+ **********************************************************************************************************************/
+
+/* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
+SSP_FOOTER
+
+#endif /* DRV_BLIT_API_H */
@@ -34,6 +34,7 @@
  * - Interrupt driven transmit/receive processing
  * - Callback function support with returning event code
  * - Hardware resource locking during a transaction
+ * - Optional receive FIFO drained in batches with readBatch
  * @{
  **********************************************************************************************************************/
 
@@ -53,7 +54,7 @@ SSP_HEADER
  * Macro definitions
  **********************************************************************************************************************/
 #define CAN_API_VERSION_MAJOR (2U)
-#define CAN_API_VERSION_MINOR (0U)
+#define CAN_API_VERSION_MINOR (1U)
 
 /**********************************************************************************************************************
  * Typedef definitions
@@ -69,6 +70,8 @@ typedef enum e_can_event
     CAN_EVENT_ERR_WARNING,                      ///< Error Warning event.
     CAN_EVENT_MAILBOX_OVERWRITE_OVERRUN = 6,    ///< DEPRECATED, Mailbox has been overrun. This event is not used when the mailbox is overwritten.
     CAN_EVENT_MAILBOX_OVERRUN = 6,              ///< Mailbox has been overrun.
+    CAN_EVENT_RX_FIFO_READY,                    ///< One or more frames were added to the receive FIFO.
+    CAN_EVENT_RX_FIFO_OVERFLOW,                 ///< The receive FIFO was full and received frames were discarded.
 } can_event_t;
 
 /** CAN Status */
@@ -238,6 +241,14 @@ typedef struct st_can_frame
     can_frame_type_t  type;                                 ///< Frame type, data or remote frame.
 } can_frame_t;
 
+/** CAN frame returned by readBatch */
+typedef struct st_can_rx_frame
+{
+    can_frame_t       frame;                                ///< Received frame.
+    uint32_t          mailbox;                              ///< Mailbox the frame was received in.
+    uint16_t          timestamp;                            ///< Time stamp counter value captured on reception.
+} can_rx_frame_t;
+
 /** CAN  Mailbox type */
 typedef enum e_can_mailbox_send_receive
 {
@@ -278,6 +289,11 @@ typedef struct st_can_cfg
     uint8_t                 error_ipl;                                      ///< Error interrupt priority
     uint8_t                 mailbox_rx_ipl;                                 ///< Receive interrupt priority
     uint8_t                 mailbox_tx_ipl;                                 ///< Transmit interrupt priority
+
+    /** Call p_callback from the BSP deferred work scheduler in thread mode instead of from the interrupt.  If no
+     *  work slot is free, the callback is dropped and counted in bsp_work_stats_t::dropped. */
+    bool                    deferred_callback;
+    uint8_t                 deferred_callback_priority;                     ///< Work priority of deferred callbacks
 } can_cfg_t;
 
 /** CAN control block.  Allocate an instance specific control block to pass into the CAN API calls.
@@ -353,6 +369,20 @@ typedef struct st_can_api
      * @param[in]   p_version  Pointer to the memory to store the version information
      */
     ssp_err_t (* versionGet)(ssp_version_t * const p_version);
+
+    /** Read all received frames up to max_frames, non-blocking.  Frames are taken from the receive FIFO if one is
+     * configured, otherwise directly from the receive mailboxes.
+     * @par Implemented as
+     * - R_CAN_ReadBatch()
+     * @param[in]   p_ctrl          Pointer to the CAN control block for the channel.
+     * @param[out]  p_frames        Array of at least max_frames frames.
+     * @param[in]   max_frames      Maximum number of frames to read.
+     * @param[out]  p_count         Number of frames read.
+     */
+    ssp_err_t (* readBatch)(can_ctrl_t     * const p_ctrl,
+                            can_rx_frame_t * const p_frames,
+                            uint32_t         const max_frames,
+                            uint32_t       * const p_count);
 } can_api_t;
 
 /** This structure encompasses everything that is needed to use an instance of this interface. */
@@ -59,7 +59,7 @@ SSP_HEADER
  **********************************************************************************************************************/
 
 #define CRC_API_VERSION_MAJOR (2U)
-#define CRC_API_VERSION_MINOR (0U)
+#define CRC_API_VERSION_MINOR (1U)
 
 /**********************************************************************************************************************
  * Typedef definitions
@@ -170,13 +170,15 @@ typedef struct st_crc_api
      **/
     ssp_err_t (* snoopCfg)(crc_ctrl_t * const p_ctrl, crc_snoop_cfg_t * const p_snoop_cfg);
 
-    /** Perform a CRC calculation on a block of data.
+    /** Perform a CRC calculation on a block of data. The data is processed as a byte stream in memory order, except
+     * for CRC-32 and CRC-32C with CRC_BIT_ORDER_LMS_MSB, which take it as 32-bit words from the start of the buffer,
+     * each most significant bit first, followed by the bytes after the last whole word.
      * @par Implemented as
      * - R_CRC_Calculate()
      *
      * @param[in]  p_ctrl         Pointer to crc device handle.
      * @param[in]  input_buffer   A pointer to an array of data values.
-     * @param[in]  num_bytes      The number of bytes (not elements) in the array.
+     * @param[in]  num_bytes      The number of bytes (not elements) in the array. Any length is accepted.
      * @param[in]  crc_seed       The seeded value for crc calculations.
      * @param[out] crc_result     The calculated value of the CRC calculation.
      **/
@@ -191,6 +193,24 @@ typedef struct st_crc_api
      * - R_CRC_VersionGet()
      **/
     ssp_err_t (* versionGet)(ssp_version_t * version);
+
+    /** Continue a CRC calculation with the next block of data. Feeding a message block by block gives the same
+     * result as one crc_api_t::calculate call over the whole message. For CRC-32 and CRC-32C with
+     * CRC_BIT_ORDER_LMS_MSB, every block must be a multiple of four bytes; pass a last block that ends inside a word
+     * to crc_api_t::calculate with the running value as the seed.
+     * @par Implemented as
+     * - R_CRC_Update()
+     *
+     * @param[in]     p_ctrl          Pointer to crc device handle.
+     * @param[in]     p_input_buffer  A pointer to the next block of data.
+     * @param[in]     num_bytes       The number of bytes in the block.
+     * @param[in,out] p_crc_value     Running CRC value. Set it to the seed before the first block. On return it holds
+     *                                the CRC of all blocks fed so far.
+     **/
+    ssp_err_t (* update)(crc_ctrl_t * const p_ctrl,
+                         void const       * p_input_buffer,
+                         uint32_t           num_bytes,
+                         uint32_t   * const p_crc_value);
 } crc_api_t;
 
 /** This structure encompasses everything that is needed to use an instance of this interface. */
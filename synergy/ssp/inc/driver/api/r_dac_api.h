@@ -49,6 +49,7 @@
  **********************************************************************************************************************/
 /* Common error codes and definitions. */
 #include "bsp_api.h"
+#include "r_transfer_api.h"
 
 /* Common macro for SSP header files. There is also a corresponding SSP_FOOTER macro at the end of this file. */
 SSP_HEADER
@@ -57,7 +58,7 @@ SSP_HEADER
  * Macro definitions
  **********************************************************************************************************************/
 #define DAC_API_VERSION_MAJOR (2U)
-#define DAC_API_VERSION_MINOR (0U)
+#define DAC_API_VERSION_MINOR (1U)
 
 /**********************************************************************************************************************
  * Typedef definitions
@@ -78,6 +79,13 @@ typedef struct dac_info
     uint8_t bit_width;  ///< Resolution of the DAC.
 }dac_info_t;
 
+/** DAC data register information for the transfer interface */
+typedef struct st_dac_transfer_info
+{
+    void volatile   * p_address;       ///< Data register of the channel, the destination of transfers
+    transfer_size_t   transfer_size;   ///< Size of each write to the data register
+} dac_transfer_info_t;
+
 /** DAC Open API configuration parameter */
 typedef struct st_dac_cfg
 {
@@ -162,6 +170,16 @@ typedef struct st_dac_api
      */
     ssp_err_t (* infoGet)(dac_info_t    * const p_info);
 
+    /** Get the data register of the channel, so a timer paced transfer can write samples to it.
+     * @par Implemented as
+     * - R_DAC_TransferInfoGet()
+     * - R_DAC8_TransferInfoGet()
+     *
+     * @param[in]   p_ctrl     Control block set in dac_api_t::open call for this channel.
+     * @param[out]  p_info     Data register address and transfer size.
+     */
+    ssp_err_t (* transferInfoGet)(dac_ctrl_t * p_ctrl, dac_transfer_info_t * const p_info);
+
 } dac_api_t;
 
 /** This structure encompasses everything that is needed to use an instance of this interface. */
@@ -34,6 +34,7 @@
  * - Blending of multiple graphics layers  on the background screen.
  * - Color correction (brightness/configuration/gamma correction).
  * - Interrupts and callback function.
+ * - Vsync synchronized page flipping between registered frame buffers.
  *
  * Implemented by:
  * @ref GLCD
@@ -64,7 +65,7 @@ SSP_HEADER
  * Macro definitions
  **********************************************************************************************************************/
 #define DISPLAY_API_VERSION_MAJOR       (2U)
-#define DISPLAY_API_VERSION_MINOR       (0U)
+#define DISPLAY_API_VERSION_MINOR       (1U)
 
 #define DISPLAY_GAMMA_CURVE_ELEMENT_NUM (16)
 
@@ -93,6 +94,7 @@ typedef enum e_display_event
     DISPLAY_EVENT_GR1_UNDERFLOW  = 1,       ///< Graphics frame1 underflow occurs
     DISPLAY_EVENT_GR2_UNDERFLOW  = 2,       ///< Graphics frame2 underflow occurs
     DISPLAY_EVENT_LINE_DETECTION = 3,       ///< Designated line is processed
+    DISPLAY_EVENT_BUFFER_RELEASED = 4,      ///< A frame buffer is no longer scanned out and may be drawn into
 } display_event_t;
 
 /** Input format setting */
@@ -286,6 +288,8 @@ typedef struct st_display_callback_args
 {
     display_event_t  event;                           ///< Event code
     void const     * p_context;                     ///< Context provided to user during callback
+    display_frame_layer_t  frame;                   ///< Layer of ::DISPLAY_EVENT_BUFFER_RELEASED
+    void           * p_buffer;                      ///< Frame buffer released by ::DISPLAY_EVENT_BUFFER_RELEASED
 } display_callback_args_t;
 
 /** Display main configuration structure */
@@ -337,6 +341,17 @@ typedef struct st_display_status
     display_fade_status_t  fade_status[DISPLAY_FRAME_LAYER_2 + 1];  ///< Status of fade-in/fade-out status
 } display_status_t;
 
+/** Page flip statistics of a layer */
+typedef struct st_display_flip_stats
+{
+    uint32_t  vsyncs;               ///< Frames scanned out since the frame buffers were registered
+    uint32_t  flips;                ///< Presented frame buffers that were scanned out
+    uint32_t  missed_vsyncs;        ///< Frames that repeated the previous frame buffer because the next was late
+    uint32_t  queued;               ///< Presented frame buffers waiting for a vsync
+    uint64_t  frame_time;           ///< Time between the last two flips in BSP timer service counts
+    uint64_t  frame_time_max;       ///< Longest time between two flips in BSP timer service counts
+} display_flip_stats_t;
+
 /** Shared Interface definition for display peripheral */
 typedef struct st_display_api
 {
@@ -415,6 +430,38 @@ typedef struct st_display_api
      * @param[in]   p_version  Pointer to the memory to store the version information.
      */
     ssp_err_t (* versionGet)(ssp_version_t * p_version);
+
+    /** Register the frame buffers a layer flips between. The frame buffer in the layer configuration is scanned out
+     *  until the first flip, and is passed to the callback when it is released like the registered ones.
+     * @par Implemented as
+     * - R_GLCD_BuffersSet()
+     * @param[in]   p_ctrl       Pointer to display interface control block.
+     * @param[in]   frame        Layer the frame buffers belong to.
+     * @param[in]   pp_buffers   Frame buffers with the layout of the layer configuration.
+     * @param[in]   num_buffers  Number of frame buffers, 0 to unregister them.
+     */
+    ssp_err_t (* buffersSet)(display_ctrl_t * const p_ctrl, display_frame_layer_t frame,
+                             void * const * const pp_buffers, uint32_t num_buffers);
+
+    /** Queue a registered frame buffer to be scanned out from the next vsync. The frame buffer it replaces is passed
+     *  to the callback with ::DISPLAY_EVENT_BUFFER_RELEASED once the new one is scanned out.
+     * @par Implemented as
+     * - R_GLCD_Present()
+     * @param[in]   p_ctrl     Pointer to display interface control block.
+     * @param[in]   frame      Layer to flip.
+     * @param[in]   p_buffer   Registered frame buffer that is not queued or scanned out.
+     */
+    ssp_err_t (* present)(display_ctrl_t * const p_ctrl, display_frame_layer_t frame, void * const p_buffer);
+
+    /** Get the page flip statistics of a layer.
+     * @par Implemented as
+     * - R_GLCD_FlipStatsGet()
+     * @param[in]   p_ctrl     Pointer to display interface control block.
+     * @param[in]   frame      Layer to get the statistics for.
+     * @param[out]  p_stats    Pointer to the memory to store the statistics.
+     */
+    ssp_err_t (* flipStatsGet)(display_ctrl_t const * const p_ctrl, display_frame_layer_t frame,
+                               display_flip_stats_t * const p_stats);
 } display_api_t;
 
 /** This structure encompasses everything that is needed to use an instance of this interface. */
@@ -0,0 +1,321 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : r_ether_api.h
+ * Description  : Ethernet MAC Interface
+ **********************************************************************************************************************/
+
+#ifndef DRV_ETHER_API_H
+#define DRV_ETHER_API_H
+
+/*******************************************************************************************************************//**
+ * @ingroup Interface_Library
+ * @defgroup ETHER_API Ethernet MAC Interface
+ *
+ * @brief Interface for sending and receiving Ethernet frames without copying them.
+ *
+ * @section ETHER_API_SUMMARY Summary
+ * The Ethernet MAC interface moves frames between a network stack and the MAC through transmit and receive descriptor
+ * rings. Frames live in fixed-size packet buffers taken from a pool owned by the driver. A received frame is handed to
+ * the caller in the buffer the MAC wrote it to, and a frame is transmitted from the caller's buffer, so frame data is
+ * never copied by the driver. Buffers are reference counted: ether_api_t::bufferRetain lets several owners share a
+ * buffer, and the buffer returns to the pool when the last owner calls ether_api_t::bufferRelease.
+ *
+ * Received frames are reported with one callback per burst: the receive interrupt is masked when it fires and is
+ * enabled again once ether_api_t::read finds the ring empty. In polling mode the receive interrupt stays masked and the
+ * caller reads the ring on its own schedule.
+ *
+ * Related SSP architecture topics:
+ *  - @ref ssp-interfaces
+ *  - @ref ssp-predefined-layers
+ *  - @ref using-ssp-modules
+ *
+ * Ethernet MAC Interface description: @ref HALEtherInterface
+ *
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+/* Register definitions, common services and error codes. */
+#include "bsp_api.h"
+
+/* Common macro for SSP header files. There is also a corresponding SSP_FOOTER macro at the end of this file. */
+SSP_HEADER
+
+/**********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define ETHER_API_VERSION_MAJOR     (1U)
+#define ETHER_API_VERSION_MINOR     (0U)
+
+#define ETHER_MAC_ADDRESS_BYTES     (6U)     ///< Length of a MAC address
+#define ETHER_DESCRIPTOR_ALIGNMENT  (16U)    ///< Required alignment of the descriptor rings
+#define ETHER_BUFFER_ALIGNMENT      (32U)    ///< Required alignment of the packet buffer memory
+#define ETHER_BUFFER_HEADER_SIZE    (32U)    ///< Bytes reserved for ether_buffer_t in front of the frame data
+#define ETHER_BUFFER_DATA_SIZE      (1536U)  ///< Frame data bytes in each packet buffer, a maximum-size frame fits
+
+/** Size of one packet buffer including its header. */
+#define ETHER_BUFFER_BLOCK_SIZE     (ETHER_BUFFER_HEADER_SIZE + ETHER_BUFFER_DATA_SIZE)
+
+/** Bytes of packet buffer memory needed for a given number of buffers. */
+#define ETHER_BUFFER_MEMORY_SIZE(num_buffers)  ((num_buffers) * ETHER_BUFFER_BLOCK_SIZE)
+
+/**********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Ethernet MAC control block.  Allocate an instance specific control block to pass into the Ethernet MAC API calls.
+ * @par Implemented as
+ * - ether_instance_ctrl_t
+ */
+typedef void ether_ctrl_t;
+
+/** Receive notification mode. */
+typedef enum e_ether_rx_mode
+{
+    ETHER_RX_MODE_INTERRUPT,           ///< One ETHER_EVENT_RX_COMPLETE callback for each burst of received frames
+    ETHER_RX_MODE_POLLING,             ///< Receive interrupt disabled, the caller polls ether_api_t::read
+} ether_rx_mode_t;
+
+/** Link speed. */
+typedef enum e_ether_link_speed
+{
+    ETHER_LINK_SPEED_10M,              ///< 10 Mbps
+    ETHER_LINK_SPEED_100M,             ///< 100 Mbps
+} ether_link_speed_t;
+
+/** Link duplex mode. */
+typedef enum e_ether_link_duplex
+{
+    ETHER_LINK_DUPLEX_HALF,            ///< Half duplex
+    ETHER_LINK_DUPLEX_FULL,            ///< Full duplex
+} ether_link_duplex_t;
+
+/** Events reported to the callback. */
+typedef enum e_ether_event
+{
+    ETHER_EVENT_RX_COMPLETE,           ///< Frames are waiting in the receive ring, read them with ether_api_t::read
+    ETHER_EVENT_TX_COMPLETE,           ///< Frames were transmitted and their buffers released
+    ETHER_EVENT_ERROR,                 ///< A MAC or DMA error occurred, see ether_callback_args_t::status
+} ether_event_t;
+
+/** Callback function parameter data. */
+typedef struct st_ether_callback_args
+{
+    uint32_t        channel;           ///< Channel that generated the event
+    ether_event_t   event;             ///< Event that occurred
+    uint32_t        status;            ///< EESR error bits for ETHER_EVENT_ERROR, 0 otherwise
+    void const    * p_context;         ///< Context provided to user during callback
+} ether_callback_args_t;
+
+/** Packet buffer. The header sits in the first ETHER_BUFFER_HEADER_SIZE bytes of a pool block and p_data points to
+ * the frame data that follows it. */
+typedef struct st_ether_buffer
+{
+    uint8_t                * p_data;      ///< Frame data, starting with the destination MAC address
+    uint16_t                 length;      ///< Frame length in bytes, without the FCS
+    uint16_t                 capacity;    ///< Size of the data area, ETHER_BUFFER_DATA_SIZE
+    volatile uint32_t        ref_count;   ///< Number of owners, the buffer returns to the pool when this reaches 0
+    struct st_ether_buffer * p_next;      ///< Free for use by the owner, for example to queue buffers
+} ether_buffer_t;
+
+/** Transmit and receive descriptor, in the 16-byte layout the DMA controller reads. */
+typedef struct st_ether_descriptor
+{
+    volatile uint32_t status;          ///< Active, last-in-ring, frame position and error bits
+    volatile uint16_t size;            ///< Receive: length of the frame data written to the buffer
+    volatile uint16_t buffer_size;     ///< Receive: size of the buffer. Transmit: length of the frame data
+    volatile uint32_t buffer;          ///< Address of the frame data
+    uint32_t          reserved;        ///< Pads the descriptor to 16 bytes
+} ether_descriptor_t;
+
+/** Driver statistics. */
+typedef struct st_ether_stats
+{
+    uint32_t  rx_frames;               ///< Frames returned by ether_api_t::read
+    uint32_t  rx_errors;               ///< Received frames dropped because the MAC reported an error
+    uint32_t  rx_no_buffer;            ///< ether_api_t::read calls that left a frame in the ring for lack of a buffer
+    uint32_t  rx_missed;               ///< Frames the MAC dropped because the receive ring was full
+    uint32_t  rx_interrupts;           ///< Receive interrupts taken, each one starts a burst of reads
+    uint32_t  tx_frames;               ///< Frames transmitted
+    uint32_t  tx_ring_full;            ///< ether_api_t::write calls rejected because the transmit ring was full
+    uint32_t  buffers_used;            ///< Packet buffers currently allocated, including those in the receive ring
+    uint32_t  buffers_used_max;        ///< Highest number of packet buffers allocated at the same time
+} ether_stats_t;
+
+/** User configuration structure, used in open function */
+typedef struct st_ether_cfg
+{
+    uint32_t                 channel;                ///< Channel number
+    uint8_t const          * p_mac_address;          ///< Station MAC address, ETHER_MAC_ADDRESS_BYTES long
+    bool                     promiscuous;            ///< Receive frames addressed to any station
+    ether_link_speed_t       link_speed;             ///< Initial link speed, change it with ether_api_t::linkSet
+    ether_link_duplex_t      link_duplex;            ///< Initial duplex mode, change it with ether_api_t::linkSet
+
+    /** Receive descriptor ring, aligned to ETHER_DESCRIPTOR_ALIGNMENT. Each descriptor keeps one packet buffer. */
+    ether_descriptor_t     * p_rx_descriptors;
+    uint32_t                 num_rx_descriptors;     ///< Number of receive descriptors
+    /** Transmit descriptor ring, aligned to ETHER_DESCRIPTOR_ALIGNMENT. */
+    ether_descriptor_t     * p_tx_descriptors;
+    uint32_t                 num_tx_descriptors;     ///< Number of transmit descriptors
+
+    /** Packet buffer memory, aligned to ETHER_BUFFER_ALIGNMENT and ETHER_BUFFER_MEMORY_SIZE(num_buffers) bytes long.
+     * Must be larger than the receive ring so buffers remain for the caller and for transmission. */
+    void                   * p_buffer_memory;
+    uint32_t                 num_buffers;            ///< Number of packet buffers
+
+    ether_rx_mode_t          rx_mode;                ///< Initial receive notification mode
+    uint8_t                  irq_ipl;                ///< EINT interrupt priority
+
+    void                  (* p_callback)(ether_callback_args_t * p_args); ///< Callback provided when an ISR occurs
+    void const             * p_context;              ///< User defined context passed into callback function
+
+    /** Call p_callback from the BSP deferred work scheduler in thread mode instead of from the interrupt.  If no
+     * work slot is free, the callback is dropped and counted in bsp_work_stats_t::dropped. */
+    bool                     deferred_callback;
+    uint8_t                  deferred_callback_priority;   ///< Work priority of deferred callbacks
+
+    void const             * p_extend;               ///< Extension parameter for hardware specific settings
+} ether_cfg_t;
+
+/** Ethernet MAC driver structure. General Ethernet MAC functions implemented at the HAL layer will follow this API. */
+typedef struct st_ether_api
+{
+    /** Initialize the MAC and DMA controller, fill the receive ring with packet buffers and start reception.
+     * @par Implemented as
+     * - R_ETHER_Open()
+     *
+     * @param[in] p_ctrl               Pointer to control block. Must be declared by user.
+     * @param[in] p_cfg                Pointer to configuration structure.
+     **/
+    ssp_err_t (* open)(ether_ctrl_t * const p_ctrl, ether_cfg_t const * const p_cfg);
+
+    /** Stop the MAC and return the buffers held by the rings to the pool. Buffers owned by the caller stay valid until
+     * the caller stops using the packet buffer memory.
+     * @par Implemented as
+     * - R_ETHER_Close()
+     *
+     * @param[in] p_ctrl               Pointer to control block.
+     **/
+    ssp_err_t (* close)(ether_ctrl_t * const p_ctrl);
+
+    /** Take the next received frame from the receive ring. Ownership of the buffer passes to the caller, who returns
+     * it with ether_api_t::bufferRelease. The descriptor is refilled with a buffer from the pool.
+     * @par Implemented as
+     * - R_ETHER_Read()
+     *
+     * @param[in]  p_ctrl              Pointer to control block.
+     * @param[out] pp_buffer           Buffer holding the received frame.
+     **/
+    ssp_err_t (* read)(ether_ctrl_t * const p_ctrl, ether_buffer_t ** const pp_buffer);
+
+    /** Queue a frame for transmission. The driver takes its own reference to the buffer and releases it once the frame
+     * is sent, so the caller may release its reference as soon as this function returns.
+     * @par Implemented as
+     * - R_ETHER_Write()
+     *
+     * @param[in] p_ctrl               Pointer to control block.
+     * @param[in] p_buffer             Buffer holding the frame, with ether_buffer_t::length set.
+     **/
+    ssp_err_t (* write)(ether_ctrl_t * const p_ctrl, ether_buffer_t * const p_buffer);
+
+    /** Allocate a packet buffer from the pool with a reference count of 1.
+     * @par Implemented as
+     * - R_ETHER_BufferAlloc()
+     *
+     * @param[in]  p_ctrl              Pointer to control block.
+     * @param[out] pp_buffer           Allocated buffer.
+     **/
+    ssp_err_t (* bufferAlloc)(ether_ctrl_t * const p_ctrl, ether_buffer_t ** const pp_buffer);
+
+    /** Add a reference to a packet buffer.
+     * @par Implemented as
+     * - R_ETHER_BufferRetain()
+     *
+     * @param[in] p_ctrl               Pointer to control block.
+     * @param[in] p_buffer             Buffer to retain.
+     **/
+    ssp_err_t (* bufferRetain)(ether_ctrl_t * const p_ctrl, ether_buffer_t * const p_buffer);
+
+    /** Drop a reference to a packet buffer. The buffer returns to the pool when no references remain.
+     * @par Implemented as
+     * - R_ETHER_BufferRelease()
+     *
+     * @param[in] p_ctrl               Pointer to control block.
+     * @param[in] p_buffer             Buffer to release.
+     **/
+    ssp_err_t (* bufferRelease)(ether_ctrl_t * const p_ctrl, ether_buffer_t * const p_buffer);
+
+    /** Switch between interrupt driven and polled reception.
+     * @par Implemented as
+     * - R_ETHER_RxModeSet()
+     *
+     * @param[in] p_ctrl               Pointer to control block.
+     * @param[in] mode                 New receive notification mode.
+     **/
+    ssp_err_t (* rxModeSet)(ether_ctrl_t * const p_ctrl, ether_rx_mode_t mode);
+
+    /** Set the link speed and duplex mode negotiated by the PHY.
+     * @par Implemented as
+     * - R_ETHER_LinkSet()
+     *
+     * @param[in] p_ctrl               Pointer to control block.
+     * @param[in] speed                Link speed.
+     * @param[in] duplex               Duplex mode.
+     **/
+    ssp_err_t (* linkSet)(ether_ctrl_t * const p_ctrl, ether_link_speed_t speed, ether_link_duplex_t duplex);
+
+    /** Get driver and packet buffer statistics.
+     * @par Implemented as
+     * - R_ETHER_StatsGet()
+     *
+     * @param[in]  p_ctrl              Pointer to control block.
+     * @param[out] p_stats             Statistics.
+     **/
+    ssp_err_t (* statsGet)(ether_ctrl_t * const p_ctrl, ether_stats_t * const p_stats);
+
+    /** Get the driver version based on compile time macros.
+     * @par Implemented as
+     * - R_ETHER_VersionGet()
+     *
+     * @param[out] p_version           Code and API version.
+     **/
+    ssp_err_t (* versionGet)(ssp_version_t * const p_version);
+} ether_api_t;
+
+/** This structure encompasses everything that is needed to use an instance of this interface. */
+typedef struct st_ether_instance
+{
+    ether_ctrl_t      * p_ctrl;    ///< Pointer to the control structure for this instance
+    ether_cfg_t const * p_cfg;     ///< Pointer to the configuration structure for this instance
+    ether_api_t const * p_api;     ///< Pointer to the API structure for this instance
+} ether_instance_t;
+
+
+/*******************************************************************************************************************//**
+ * @} (end defgroup ETHER_API)
+ **********************************************************************************************************************/
+
+/* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
+SSP_FOOTER
+
+#endif /* DRV_ETHER_API_H */
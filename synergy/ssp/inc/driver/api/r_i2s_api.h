@@ -55,7 +55,7 @@ SSP_HEADER
 Macro definitions
 ***********************************************************************************************************************/
 #define I2S_API_VERSION_MAJOR   (2U)
-#define I2S_API_VERSION_MINOR   (0U)
+#define I2S_API_VERSION_MINOR   (1U)
 
 /**********************************************************************************************************************
 Typedef definitions
@@ -86,6 +86,8 @@ typedef enum e_i2s_event
     I2S_EVENT_IDLE,             ///< Communication is idle
     I2S_EVENT_TX_EMPTY,         ///< Transmit buffer is below FIFO trigger level
     I2S_EVENT_RX_FULL,          ///< Receive buffer is above FIFO trigger level
+    I2S_EVENT_TX_PERIOD_DONE,   ///< Streaming: a transmit period was consumed and may be refilled
+    I2S_EVENT_RX_PERIOD_DONE,   ///< Streaming: a receive period was filled and may be read
 } i2s_event_t;
 
 /** I2S communication direction */
@@ -130,6 +132,7 @@ typedef struct st_i2s_callback_args
     /** Placeholder for user data.  Set in i2s_api_t::open function in ::i2s_cfg_t. */
     void const * p_context;
     i2s_event_t  event;         ///< The event can be used to identify what caused the callback (overflow or error).
+    uint32_t     period;        ///< Ring index of the completed period for the period done events
 } i2s_callback_args_t;
 
 /** I2S control block.  Allocate an instance specific control block to pass into the I2S API calls.
@@ -143,6 +146,8 @@ typedef struct st_i2s_info
 {
     i2s_status_t       status;
     uint32_t sampling_freq_hz;      ///< Sampling frequency in Hertz
+    uint32_t tx_underrun_count;     ///< Streaming: transmit periods played before the application refilled them
+    uint32_t rx_overrun_count;      ///< Streaming: receive periods overwritten before the application read them
 } i2s_info_t;
 
 /** User configuration structure, used in open function */
@@ -178,8 +183,23 @@ typedef struct st_i2s_cfg
     uint8_t       rxi_ipl;          ///< Receive interrupt priority
     uint8_t       txi_ipl;          ///< Transmit interrupt priority
     uint8_t       idle_err_ipl;     ///< Idle/Error interrupt priority
+
+    /** Call p_callback from the BSP deferred work scheduler in thread mode instead of from the interrupt.  If no
+     *  work slot is free, the callback is dropped and counted in bsp_work_stats_t::dropped. */
+    bool          deferred_callback;
+    uint8_t       deferred_callback_priority;   ///< Work priority of deferred callbacks, 0 is the most urgent
 } i2s_cfg_t;
 
+/** Period rings used by i2s_api_t::streamStart.  Each ring holds period_count back to back periods of period_bytes
+ * bytes.  The driver cycles through the rings until i2s_api_t::stop is called. */
+typedef struct st_i2s_stream_cfg
+{
+    uint8_t const * p_tx_ring;      ///< Transmit ring, 4 byte aligned.  Set to NULL to stream receive only.
+    uint8_t       * p_rx_ring;      ///< Receive ring, 4 byte aligned.  Set to NULL to stream transmit only.
+    uint16_t        period_bytes;   ///< Bytes per period, a multiple of 8
+    uint16_t        period_count;   ///< Periods in each ring, at least 2
+} i2s_stream_cfg_t;
+
 /** I2S functions implemented at the HAL layer will follow this API. */
 typedef struct st_i2s_api
 {
@@ -285,6 +305,33 @@ typedef struct st_i2s_api
      * @param[out]  p_version  Code and API version used.
      */
     ssp_err_t (* versionGet)(ssp_version_t     * const p_version);
+
+    /** Start continuous streaming through rings of periods.  The transmit ring must be filled before the call.  Each
+     * time a period completes the callback is called with I2S_EVENT_TX_PERIOD_DONE or I2S_EVENT_RX_PERIOD_DONE and
+     * the next period starts without a gap.  Return periods to the driver in order with i2s_api_t::streamAck.
+     * Streaming ends when i2s_api_t::stop is called.
+     * @par Implemented as
+     * - R_SSI_StreamStart()
+     *
+     * @param[in]   p_ctrl         Control block set in i2s_api_t::open call for this instance.
+     * @param[in]   p_stream_cfg   Period rings.  Copied, so it may be a local variable.
+     */
+    ssp_err_t (* streamStart)(i2s_ctrl_t             * const p_ctrl,
+                              i2s_stream_cfg_t const * const p_stream_cfg);
+
+    /** Return periods to the streaming driver: transmit periods that were refilled, or receive periods that were
+     * read.  A period the application has not returned when the driver reaches it counts as an underrun or overrun
+     * in ::i2s_info_t.
+     * @par Implemented as
+     * - R_SSI_StreamAck()
+     *
+     * @param[in]   p_ctrl     Control block set in i2s_api_t::open call for this instance.
+     * @param[in]   dir        I2S_DIR_TX, I2S_DIR_RX, or I2S_DIR_TX_RX to return periods in both rings.
+     * @param[in]   periods    Number of periods returned.
+     */
+    ssp_err_t (* streamAck)(i2s_ctrl_t   * const p_ctrl,
+                            i2s_dir_t      const dir,
+                            uint32_t       const periods);
 } i2s_api_t;
 
 /** This structure encompasses everything that is needed to use an instance of this interface. */
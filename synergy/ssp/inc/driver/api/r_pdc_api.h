@@ -29,7 +29,8 @@
  *
  * @section PDC_API_SUMMARY Summary
  * @brief The PDC interface provides the functionality for capturing an image from a camera. When a capture is complete
- * a transfer complete interrupt is triggered.
+ * a transfer complete interrupt is triggered. A continuous capture fills a set of frame buffers in turn and delivers
+ * each frame to the callback with its sequence number, a timestamp and the number of frames dropped before it.
  *
  * @section PDC_API_INSTANCES Known Implementations
  * @see PDC
@@ -59,7 +60,7 @@ SSP_HEADER
  * Macro definitions
  **********************************************************************************************************************/
 #define PDC_API_VERSION_MAJOR (2U)
-#define PDC_API_VERSION_MINOR (0U)
+#define PDC_API_VERSION_MINOR (2U)
 
 /**********************************************************************************************************************
  * Typedef definitions
@@ -108,6 +109,7 @@ typedef enum e_pdc_event
     PDC_EVENT_ERR_UNDERRUN      = 0x08u,    ///< Underrun interrupt
     PDC_EVENT_ERR_V_SET         = 0x10u,    ///< Vertical line setting error interrupt
     PDC_EVENT_ERR_H_SET         = 0x20u,    ///< Horizontal byte number setting error interrupt
+    PDC_EVENT_BAND_COMPLETE     = 0x40u,    ///< Band of lines transferred by DMAC/DTC in a band capture
 } pdc_event_t;
 
 /** VSYNC signal state */
@@ -137,6 +139,11 @@ typedef struct st_pdc_callback_args
     pdc_event_t  event;             ///< Event causing the callback
     uint8_t    * p_buffer;          ///< Pointer to buffer containing the captured data
     void const * p_context;         ///< Placeholder for user data.  Set in pdc_api_t::open function in ::pdc_cfg_t.
+    uint32_t     frame;             ///< Sequence number of the frame, counting dropped frames, starting at 1
+    uint32_t     dropped;           ///< Frames dropped since the previous frame was delivered
+    uint64_t     timestamp;         ///< BSP timer service timestamp of the frame end, 0 if the service is not open
+    uint32_t     line;              ///< First captured line held in p_buffer, 0 unless the event is a band
+    uint32_t     lines;             ///< Number of captured lines held in p_buffer
 } pdc_callback_args_t;
 
 /** PDC configuration parameters. */
@@ -215,6 +222,50 @@ typedef struct st_pdc_api
      * @param[out] p_data       Memory address to return version information to.
      */
     ssp_err_t (* versionGet)(ssp_version_t * const p_data);
+
+    /** Start a continuous capture into a set of frame buffers. Each completed frame is passed to the callback with
+     *  ::PDC_EVENT_TRANSFER_COMPLETE and belongs to the application until it is returned with
+     *  pdc_api_t::bufferRelease.
+     * @par Implemented as
+     * - R_PDC_CaptureStreamStart()
+     *
+     * @param[in]  p_ctrl       Pointer to control structure.
+     * @param[in]  pp_buffers   Array of frame buffers, each large enough for one frame.
+     * @param[in]  num_buffers  Number of frame buffers, at least 2.
+     */
+    ssp_err_t (* captureStreamStart)(pdc_ctrl_t * const p_ctrl, uint8_t * const * const pp_buffers,
+                                     uint32_t num_buffers);
+
+    /** Stop a capture. Frame buffers of a continuous capture all return to the application.
+     * @par Implemented as
+     * - R_PDC_CaptureStop()
+     *
+     * @param[in]  p_ctrl       Pointer to control structure.
+     */
+    ssp_err_t (* captureStop)(pdc_ctrl_t * const p_ctrl);
+
+    /** Return a frame buffer delivered by a continuous capture, so the driver can capture into it again.
+     * @par Implemented as
+     * - R_PDC_BufferRelease()
+     *
+     * @param[in]  p_ctrl       Pointer to control structure.
+     * @param[in]  p_buffer     Frame buffer passed to the callback.
+     */
+    ssp_err_t (* bufferRelease)(pdc_ctrl_t * const p_ctrl, uint8_t * const p_buffer);
+
+    /** Start a continuous capture that splits each frame into bands of lines. Each completed band is passed to the
+     *  callback with ::PDC_EVENT_BAND_COMPLETE and belongs to the application until it is returned with
+     *  pdc_api_t::bufferRelease.
+     * @par Implemented as
+     * - R_PDC_CaptureBandStart()
+     *
+     * @param[in]  p_ctrl       Pointer to control structure.
+     * @param[in]  pp_buffers   Array of band buffers, each large enough for band_lines lines.
+     * @param[in]  num_buffers  Number of band buffers, at least 2.
+     * @param[in]  band_lines   Number of lines in a band. The last band of a frame may be shorter.
+     */
+    ssp_err_t (* captureBandStart)(pdc_ctrl_t * const p_ctrl, uint8_t * const * const pp_buffers,
+                                   uint32_t num_buffers, uint32_t band_lines);
 } pdc_api_t;
 
 /** This structure encompasses everything that is needed to use an instance of this interface. */
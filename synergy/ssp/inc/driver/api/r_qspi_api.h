@@ -56,7 +56,7 @@ SSP_HEADER
  * Macro definitions
  **********************************************************************************************************************/
 #define QSPI_API_VERSION_MAJOR (2U)
-#define QSPI_API_VERSION_MINOR (0U)
+#define QSPI_API_VERSION_MINOR (1U)
 
 /**********************************************************************************************************************
  * Typedef definitions
@@ -69,11 +69,32 @@ typedef enum e_qspi_address_mode
     QSPI_4BYTE_ADDR_MODE = 4U
 } qspi_address_mode_t;
 
+/** Events that can trigger a callback function */
+typedef enum e_qspi_event
+{
+    QSPI_EVENT_READ_COMPLETE,       ///< All data requested by qspi_api_t::readAsync is in memory
+    QSPI_EVENT_PROGRAM_COMPLETE,    ///< All pages of qspi_api_t::programAsync are written and the flash is idle
+    QSPI_EVENT_ERROR,               ///< An asynchronous operation could not be continued and was stopped
+} qspi_event_t;
+
+/** Callback function parameter data */
+typedef struct st_qspi_callback_args
+{
+    qspi_event_t   event;           ///< The event can be used to identify what caused the callback
+    void const   * p_context;       ///< Placeholder for user data.  Set in qspi_api_t::open function in ::qspi_cfg_t.
+} qspi_callback_args_t;
+
 /** User configuration structure used by the open function */
 typedef struct st_qspi_cfg
 {
-    void  * p_extend;           ///< place holder for future development
+    void  * p_extend;           ///< QSPI hardware dependent configuration, required for asynchronous operations
     qspi_address_mode_t addr_mode;
+
+    /** Callback for asynchronous operations.  Required by qspi_api_t::readAsync and qspi_api_t::programAsync. */
+    void (* p_callback)(qspi_callback_args_t * p_args);
+
+    /** Placeholder for user data.  Passed to the user callback in ::qspi_callback_args_t. */
+    void const * p_context;
 } qspi_cfg_t;
 
 /** QSPI control block.  Allocate an instance specific control block to pass into the QSPI API calls.
@@ -162,7 +183,8 @@ typedef struct st_qspi_api
      **/
     ssp_err_t (* sectorErase)(qspi_ctrl_t * p_ctrl, uint8_t * p_device_address);
 
-    /** Get the write or erase status of the flash.
+    /** Get the write or erase status of the flash.  While qspi_api_t::programAsync is in progress, this call also
+     * serves as its write in progress poll, and reports true until the last page is written.
      * @par Implemented as
      * - R_QSPI_StatusGet()
      * @param[in] p_ctrl               Pointer to a driver handle
@@ -184,6 +206,35 @@ typedef struct st_qspi_api
      * @param[out]  p_version  Code and API version used.
      **/
     ssp_err_t (* versionGet)(ssp_version_t * const p_version);
+
+    /** Start reading a block of data from the flash.  The data is moved out of the memory mapped window by the
+     * transfer instance configured for this driver, and the callback reports QSPI_EVENT_READ_COMPLETE.
+     * @par Implemented as
+     * - R_QSPI_ReadAsync()
+     *
+     * @param[in] p_ctrl               Pointer to a driver handle
+     * @param[in] p_device_address     The location in the flash device address space to read
+     * @param[in] p_memory_address     The memory address of a buffer to place the read data in.  The buffer must
+     *                                 remain valid until the callback.
+     * @param[in] byte_count           The number of bytes to read
+     **/
+    ssp_err_t (* readAsync)(qspi_ctrl_t * p_ctrl, uint8_t * p_device_address, uint8_t * p_memory_address,
+                            uint32_t byte_count);
+
+    /** Start programming erased flash with any number of bytes.  The data is split at page boundaries, and each page
+     * is sent once the flash reports that the previous one is written.  The callback reports
+     * QSPI_EVENT_PROGRAM_COMPLETE after the last page is written.
+     * @par Implemented as
+     * - R_QSPI_ProgramAsync()
+     *
+     * @param[in] p_ctrl               Pointer to a driver handle
+     * @param[in] p_device_address     The location in the flash device address space to write the data to
+     * @param[in] p_memory_address     The memory address of the data to write to the flash device.  The data must
+     *                                 remain valid until the callback.
+     * @param[in] byte_count           The number of bytes to write
+     **/
+    ssp_err_t (* programAsync)(qspi_ctrl_t * p_ctrl, uint8_t * p_device_address, uint8_t * p_memory_address,
+                               uint32_t byte_count);
 } qspi_api_t;
 
 /** This structure encompasses everything that is needed to use an instance of this interface. */
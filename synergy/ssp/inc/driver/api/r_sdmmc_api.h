@@ -60,7 +60,7 @@ SSP_HEADER
  * Macro definitions
  **********************************************************************************************************************/
 #define SDMMC_API_VERSION_MAJOR (2U)
-#define SDMMC_API_VERSION_MINOR (0U)
+#define SDMMC_API_VERSION_MINOR (1U)
 
 #define SDMMC_MAX_BLOCK_SIZE   (512U)
 
@@ -166,6 +166,14 @@ typedef enum e_sdmmc_event
     SDMMC_EVENT_NONE              = 0x00,       ///< No event.
 } sdmmc_event_t;
 
+/** One entry of a scatter-gather list passed to sdmmc_api_t::readV and sdmmc_api_t::writeV. */
+typedef struct st_sdmmc_segment
+{
+    uint32_t   sector;                  ///< First sector of the segment.
+    uint8_t  * p_buffer;                ///< Data buffer of the segment. Any alignment is accepted.
+    uint32_t   count;                   ///< Number of sectors in the segment.
+} sdmmc_segment_t;
+
 /** Callback function parameter data */
 typedef struct st_sdmmc_callback_args
 {
@@ -398,6 +406,38 @@ typedef struct st_sdmmc_api
     ssp_err_t (* erase)(sdmmc_ctrl_t * const p_ctrl,
                         uint32_t       const start_sector,
                         uint32_t       const sector_count);
+
+    /** Read a list of segments from an SD/MMC channel as one operation.  Each segment is read with a single or
+     * multiple block read command, and the commands are issued back to back from the access interrupt.  Segments that
+     * continue the previous segment on the card and in memory are merged into one command.  One callback reports the
+     * end of the whole list.
+     * This API is not supported for SDIO devices.
+     *
+     * @par Implemented as
+     * R_SDMMC_ReadV()
+     *
+     * @param[in]     p_ctrl          Pointer to an open SD/MMC instance control block.
+     * @param[in]     p_segments      Segments to read.  The list and the buffers must remain valid until the callback.
+     * @param[in]     segment_count   Number of segments in p_segments.
+     */
+    ssp_err_t (* readV)(sdmmc_ctrl_t          * const p_ctrl,
+                        sdmmc_segment_t const * const p_segments,
+                        uint32_t                const segment_count);
+
+    /** Write a list of segments to an SD/MMC channel as one operation.  Segments are chained as described for
+     * sdmmc_api_t::readV.
+     * This API is not supported for SDIO devices.
+     *
+     * @par Implemented as
+     * R_SDMMC_WriteV()
+     *
+     * @param[in]     p_ctrl          Pointer to an open SD/MMC instance control block.
+     * @param[in]     p_segments      Segments to write.  The list and the buffers must remain valid until the callback.
+     * @param[in]     segment_count   Number of segments in p_segments.
+     */
+    ssp_err_t (* writeV)(sdmmc_ctrl_t          * const p_ctrl,
+                         sdmmc_segment_t const * const p_segments,
+                         uint32_t                const segment_count);
 } sdmmc_api_t;
 
 /** This structure encompasses everything that is needed to use an instance of this interface. */
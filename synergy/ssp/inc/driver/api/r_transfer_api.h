@@ -62,7 +62,7 @@ SSP_HEADER
  * Macro definitions
  **********************************************************************************************************************/
 #define TRANSFER_API_VERSION_MAJOR (2U)
-#define TRANSFER_API_VERSION_MINOR (0U)
+#define TRANSFER_API_VERSION_MINOR (2U)
 
 /**********************************************************************************************************************
  * Typedef definitions
@@ -269,6 +269,18 @@ typedef enum e_transfer_start_mode
     TRANSFER_START_MODE_REPEAT = 1         ///< Software start transfer continues until transfer is complete.
 } transfer_start_mode_t;
 
+/** A batch of transfers submitted together with transfer_api_t::batchSubmit.  DMAC completes each descriptor before
+ *  starting the next and calls the transfer end callback once, after the last one.  DTC chains the descriptors, so
+ *  every activation runs each descriptor in array order.  An application keeps an array of batches prepared
+ *  with transfer_api_t::batchPrepare as a descriptor pool: each request takes a free batch, updates the addresses or
+ *  lengths that change, and submits it without reconfiguring the channel.
+ *  @note The descriptors are read while the batch runs, so they must stay in scope until the callback is called. */
+typedef struct st_transfer_batch
+{
+    transfer_info_t  * p_info;     ///< Array of transfer descriptors, completed in order.
+    uint16_t           count;      ///< Number of descriptors in p_info.
+} transfer_batch_t;
+
 /** Transfer functions implemented at the HAL layer will follow this API. */
 typedef struct st_transfer_api
 {
@@ -413,6 +425,56 @@ typedef struct st_transfer_api
      * @param[in]     p_ctrl   Control block set in transfer_api_t::open call for this transfer.
      */
     ssp_err_t (* Stop_ActivationRequest)(transfer_ctrl_t  * const p_ctrl);
+
+    /** Validates a batch of descriptors and sets the chain and interrupt settings the driver needs to run them back
+     *  to back.  Call once per batch when the descriptor pool is built, and again only if a descriptor's mode, size
+     *  or count changes.
+     * @par Implemented as
+     * - R_DMAC_BatchPrepare()
+     * - R_DTC_BatchPrepare()
+     *
+     * @param[in]     p_ctrl   Control block set in transfer_api_t::open call for this transfer.
+     * @param[in]     p_batch  Batch to prepare.
+     */
+    ssp_err_t (* batchPrepare)(transfer_ctrl_t  * const p_ctrl,
+                               transfer_batch_t const * const p_batch);
+
+    /** Submits a prepared batch.  The descriptors replace the ones set in transfer_api_t::open and run on the
+     *  activation source configured there.  For software activation the first transfer is started immediately.
+     * @par Implemented as
+     * - R_DMAC_BatchSubmit()
+     * - R_DTC_BatchSubmit()
+     *
+     * @param[in]     p_ctrl   Control block set in transfer_api_t::open call for this transfer.
+     * @param[in]     p_batch  Batch prepared with transfer_api_t::batchPrepare.
+     */
+    ssp_err_t (* batchSubmit)(transfer_ctrl_t  * const p_ctrl,
+                              transfer_batch_t const * const p_batch);
+
+    /** Copies a rectangle of height rows of width bytes between buffers with independent strides, for example to
+     *  crop a region out of a frame or gather a column.  The transfer settings made in transfer_api_t::open are
+     *  replaced.  For software activation the copy starts immediately.  The callback set in transfer_api_t::open is
+     *  called once the last row is copied.  The DTC writes the rows into descriptors set in the
+     *  transfer_on_dtc_cfg_t extension and copies the whole rectangle on each activation.
+     * @par Implemented as
+     * - R_DMAC_Copy2D()
+     * - R_DTC_Copy2D()
+     *
+     * @param[in]     p_ctrl       Control block set in transfer_api_t::open call for this transfer.
+     * @param[in]     p_src        First byte of the source rectangle.
+     * @param[in]     src_stride   Bytes from the start of one source row to the start of the next.
+     * @param[in]     p_dest       First byte of the destination rectangle.
+     * @param[in]     dest_stride  Bytes from the start of one destination row to the start of the next.
+     * @param[in]     width        Bytes per row.
+     * @param[in]     height       Number of rows.
+     */
+    ssp_err_t (* copy2D)(transfer_ctrl_t  * const p_ctrl,
+                         void const             * p_src,
+                         uint32_t                 src_stride,
+                         void                   * p_dest,
+                         uint32_t                 dest_stride,
+                         uint32_t                 width,
+                         uint16_t                 height);
 } transfer_api_t;
 
 /** This structure encompasses everything that is needed to use an instance of this interface. */
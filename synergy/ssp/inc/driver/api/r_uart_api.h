@@ -38,6 +38,7 @@
  * - CTS/RTS hardware flow control support (with an associated IOPORT pin)
  * - Circular buffer support
  * - Runtime Transmit/Receive circular buffer flushing
+ * - Streaming reception into a ring buffer with half-full, full and receive timeout notification
  *
  * Implemented by:
  * - @ref UARTonSCI
@@ -68,7 +69,7 @@ SSP_HEADER
  * Macro definitions
  **********************************************************************************************************************/
 #define UART_API_VERSION_MAJOR (2U)
-#define UART_API_VERSION_MINOR (0U)
+#define UART_API_VERSION_MINOR (1U)
 
 /**********************************************************************************************************************
  * Typedef definitions
@@ -85,6 +86,9 @@ typedef enum e_sf_event
     UART_EVENT_ERR_RXBUF_OVERFLOW = (1UL << 6),         ///< DEPRECATED: Receive buffer overflow error event
     UART_EVENT_RX_CHAR            = (1UL << 7),         ///< Character received
     UART_EVENT_TX_DATA_EMPTY      = (1UL << 8),         ///< Last byte is transmitting, ready for more data
+    UART_EVENT_RX_RING_HALF       = (1UL << 9),         ///< Streaming receive filled the first half of the ring
+    UART_EVENT_RX_RING_FULL       = (1UL << 10),        ///< Streaming receive filled the second half of the ring
+    UART_EVENT_RX_TIMEOUT         = (1UL << 11),        ///< Streaming receive stopped with the receive line idle
 } uart_event_t;
 
 /** UART Data bit length definition */
@@ -149,7 +153,8 @@ typedef struct st_uart_callback_arg
     uart_event_t  event;                    ///< Event code
 
     /** Contains the next character received for the events UART_EVENT_RX_CHAR, UART_EVENT_ERR_PARITY,
-     * UART_EVENT_ERR_FRAMING, or UART_EVENT_ERR_OVERFLOW.  Otherwise unused. */
+     * UART_EVENT_ERR_FRAMING, or UART_EVENT_ERR_OVERFLOW.  Contains the number of unread bytes in the ring for the
+     * events UART_EVENT_RX_RING_HALF, UART_EVENT_RX_RING_FULL and UART_EVENT_RX_TIMEOUT.  Otherwise unused. */
     uint32_t      data;
     void const    * p_context;              ///< Context provided to user during callback
 } uart_callback_args_t;
@@ -183,6 +188,11 @@ typedef struct st_uart_cfg
 
     /* Pointer to UART peripheral specific configuration */
     void const * p_extend;                  ///< UART hardware dependent configuration
+
+    /** Call p_callback from the BSP deferred work scheduler in thread mode instead of from the interrupt.  If no
+     *  work slot is free, the callback is dropped and counted in bsp_work_stats_t::dropped. */
+    bool         deferred_callback;
+    uint8_t      deferred_callback_priority; ///< Work priority of deferred callbacks, 0 is the most urgent
 } uart_cfg_t;
 
 /** UART control block.  Allocate an instance specific control block to pass into the UART API calls.
@@ -285,6 +295,35 @@ typedef struct st_uart_api
      * @param[in]   communication_to_abort   Type of abort request.
      */
     ssp_err_t (* communicationAbort)(uart_ctrl_t   * const p_ctrl, uart_dir_t communication_to_abort);
+
+    /** Start streaming reception into a ring buffer.  Received data lands in the ring without a callback per
+     * character.  The callback is called with UART_EVENT_RX_RING_HALF and UART_EVENT_RX_RING_FULL as each half of the
+     * ring fills, and with UART_EVENT_RX_TIMEOUT when the receive line goes idle.  Streaming continues until
+     * communicationAbort() is called for reception.  Use ringRead() to consume the data.
+     * @par Implemented as
+     * - R_SCI_UartReadStream()
+     *
+     * @param[in]   p_ctrl     Pointer to the UART control block.
+     * @param[in]   p_ring     Ring buffer.  Must remain valid until streaming is stopped.
+     * @param[in]   bytes      Ring buffer size in bytes, a power of two.
+     */
+    ssp_err_t (* readStream)(uart_ctrl_t * const p_ctrl,
+                             uint8_t     * const p_ring,
+                             uint32_t      const bytes);
+
+    /** Copy data received by readStream() out of the ring buffer.  Does not disable the channel or its interrupts.
+     * @par Implemented as
+     * - R_SCI_UartRingRead()
+     *
+     * @param[in]   p_ctrl        Pointer to the UART control block.
+     * @param[out]  p_dest        Destination buffer.
+     * @param[in]   bytes         Maximum number of bytes to copy.
+     * @param[out]  p_bytes_read  Number of bytes copied.
+     */
+    ssp_err_t (* ringRead)(uart_ctrl_t * const p_ctrl,
+                           uint8_t     * const p_dest,
+                           uint32_t      const bytes,
+                           uint32_t    * const p_bytes_read);
 } uart_api_t;
 
 /** This structure encompasses everything that is needed to use an instance of this interface. */
@@ -0,0 +1,82 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : r_blit.h
+ * Description  : 2D blitter using the Cortex-M4 SIMD instructions and the DMAC
+ **********************************************************************************************************************/
+
+#ifndef R_BLIT_H
+#define R_BLIT_H
+
+/*******************************************************************************************************************//**
+ * @ingroup HAL_Library
+ * @defgroup BLIT BLIT
+ * @brief Software 2D blitter.
+ *
+ * @section BLIT_SUMMARY Summary
+ * Implements @ref BLIT_API. Pixels are processed as two 8-bit channels per 16-bit lane of a word, with the Cortex-M4
+ * packed SIMD instructions when the compiler targets them and with the equivalent C expressions otherwise, so both
+ * builds produce the same pixels. Large copies can be handed to a DMAC.
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "r_blit_cfg.h"
+#include "r_blit_api.h"
+
+/* Common macro for SSP header files. There is also a corresponding SSP_FOOTER macro at the end of this file. */
+SSP_HEADER
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define BLIT_CODE_VERSION_MAJOR (1U)
+#define BLIT_CODE_VERSION_MINOR (0U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+/** Driver instance control structure. */
+typedef struct st_blit_instance_ctrl
+{
+    uint32_t                     open;             ///< Whether or not the driver is open
+    transfer_instance_t const  * p_transfer;       ///< DMAC for large copies, NULL if not used
+    uint32_t                     dma_threshold;    ///< Smallest copy given to the DMAC
+} blit_instance_ctrl_t;
+
+/**********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+/** @cond INC_HEADER_DEFS_SEC */
+/** Filled in Interface API structure for this Instance. */
+extern const blit_api_t g_blit_on_blit;
+/** @endcond */
+
+/* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
+SSP_FOOTER
+
+#endif /* R_BLIT_H */
+
+/*******************************************************************************************************************//**
+ * @} (end defgroup BLIT)
+ **********************************************************************************************************************/
@@ -50,7 +50,7 @@ SSP_HEADER
  * Macro definitions
  **********************************************************************************************************************/
 #define CAN_CODE_VERSION_MAJOR (2U)
-#define CAN_CODE_VERSION_MINOR (0U)
+#define CAN_CODE_VERSION_MINOR (1U)
 
 /**********************************************************************************************************************
  * Exported global variables
@@ -83,13 +83,41 @@ typedef struct st_can_instance_ctrl
     IRQn_Type           error_irq;                                  ///< Error IRQ number
     IRQn_Type           mailbox_rx_irq;                             ///< Receive mailbox IRQ number
     IRQn_Type           mailbox_tx_irq;                             ///< Transmit mailbox IRQ number
+    bool                deferred_callback;                          ///< Post callbacks to the BSP deferred work scheduler
+    uint8_t             deferred_callback_priority;                 ///< Work priority of deferred callbacks
+    /** Receive FIFO filled by the receive ISR and drained by R_CAN_ReadBatch */
+    can_rx_frame_t    * p_rx_fifo;                                  ///< Receive FIFO, NULL if not used
+    uint32_t            rx_fifo_size;                               ///< Receive FIFO size in frames, a power of two
+    volatile uint32_t   rx_fifo_head;                               ///< Free running count of frames queued by the ISR
+    volatile uint32_t   rx_fifo_tail;                               ///< Free running count of frames read
+    volatile uint32_t   rx_fifo_overflow_count;                     ///< Frames discarded because the FIFO was full
 } can_instance_ctrl_t;
 
+/** Range of IDs to receive, used by the acceptance filter compiler.  Set id_first equal to id_last for a single ID. */
+typedef struct st_can_filter
+{
+    can_id_t                id_first;                        ///< First ID of the range.
+    can_id_t                id_last;                         ///< Last ID of the range, inclusive.
+    can_frame_type_t        frame_type;                      ///< Frame type to receive.
+} can_filter_t;
+
 /** CAN clock configuration and mailbox mask to be pointed to by p_extend. */
 typedef struct st_can_extended_cfg
 {
     can_clock_source_t      clock_source;                    ///< Source of the CAN clock.
     uint32_t              * p_mailbox_mask;                  ///< Mailbox mask, one for every 4 mailboxes.
+
+    /** Optional receive FIFO.  When set, the receive ISR copies every received frame and its time stamp into this
+     *  ring, raises CAN_EVENT_RX_FIFO_READY, and the frames are read with R_CAN_ReadBatch. */
+    can_rx_frame_t        * p_rx_fifo;
+    uint32_t                rx_fifo_size;                    ///< Receive FIFO size in frames, a power of two.
+
+    /** Optional list of IDs and ID ranges to receive.  When filter_count is not 0, the IDs of the receive mailboxes
+     *  in p_mailbox and p_mailbox_mask are ignored.  The filters are compiled at open into mailbox IDs and group
+     *  masks that accept every listed ID and as few others as the receive mailboxes allow.  Receive mailboxes not
+     *  needed by the filters do not receive. */
+    can_filter_t const    * p_filter;
+    uint32_t                filter_count;                    ///< Number of entries in p_filter.
 } can_extended_cfg_t;
 
 
@@ -43,6 +43,7 @@
 #include "bsp_api.h"
 #include "r_crc_cfg.h"
 #include "r_crc_api.h"
+#include "r_transfer_api.h"
 
 /* Common macro for SSP header files. There is also a corresponding SSP_FOOTER macro at the end of this file. */
 SSP_HEADER
@@ -51,11 +52,35 @@ SSP_HEADER
  * Macro definitions
  **********************************************************************************************************************/
 #define CRC_CODE_VERSION_MAJOR (2U)
-#define CRC_CODE_VERSION_MINOR (0U)
+#define CRC_CODE_VERSION_MINOR (1U)
 
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
+/** Engine used by crc_api_t::calculate and crc_api_t::update. */
+typedef enum e_crc_engine
+{
+    /** Software tables for buffers below hw_threshold_bytes, the CRC calculator from there on. Uses the CRC
+     *  calculator for every buffer if no table set is available. */
+    CRC_ENGINE_AUTO = 0,
+    CRC_ENGINE_SOFTWARE,            ///< Always use the slice-by-8 software tables
+    CRC_ENGINE_HARDWARE,            ///< Always use the CRC calculator
+} crc_engine_t;
+
+/** CRC on CRC configuration extension. Optional, NULL selects CRC_ENGINE_AUTO with the thresholds from r_crc_cfg.h
+ * and no DMAC. */
+typedef struct st_crc_on_crc_cfg
+{
+    crc_engine_t                 engine;               ///< Engine selection
+    uint32_t                     hw_threshold_bytes;   ///< Smallest buffer given to the CRC calculator in
+                                                       ///< CRC_ENGINE_AUTO, 0 selects CRC_CFG_HW_THRESHOLD_BYTES
+    /** DMAC instance that feeds CRCDIR for large buffers, NULL to feed it from the CPU. The driver configures and
+     *  opens the instance. CRC-32 and CRC-32C words that are not word aligned in memory are fed from the CPU. */
+    transfer_instance_t const  * p_transfer;
+    uint32_t                     dma_threshold_bytes;  ///< Smallest buffer the DMAC feeds, 0 selects
+                                                       ///< CRC_CFG_DMA_THRESHOLD_BYTES
+} crc_on_crc_cfg_t;
+
 /** Driver instance control structure. */
 typedef struct st_crc_instance_ctrl
 {
@@ -64,6 +89,13 @@ typedef struct st_crc_instance_ctrl
     crc_polynomial_t  polynomial;   ///< CRC Generating Polynomial Switching (GPS).
     crc_bit_order_t   bit_order;    ///< CRC Calculation Switching (LMS).
     bool              fifo_mode;    ///< FIFO Mode selection for sci_uart in CRC snoop operation.
+    crc_engine_t      engine;       ///< Engine selection
+    uint32_t          hw_threshold; ///< Smallest buffer given to the CRC calculator in CRC_ENGINE_AUTO
+    uint32_t          dma_threshold;                ///< Smallest buffer fed by p_transfer
+    transfer_instance_t const * p_transfer;         ///< DMAC feeding CRCDIR, NULL if not used
+    uint32_t const  * p_table;      ///< Slice-by-8 tables, NULL if no table set was available at open
+    uint32_t          result;       ///< Result of the last calculate or update call
+    bool              result_valid; ///< result is current, cleared when snooping is enabled
 } crc_instance_ctrl_t;
 
 /**********************************************************************************************************************
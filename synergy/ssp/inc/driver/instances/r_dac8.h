@@ -53,7 +53,7 @@ SSP_HEADER
  * Macro definitions
  **********************************************************************************************************************/
 #define DAC8_CODE_VERSION_MAJOR (2U)
-#define DAC8_CODE_VERSION_MINOR (0U)
+#define DAC8_CODE_VERSION_MINOR (1U)
 
 /***********************************************************************************************************************
  * Typedef definitions
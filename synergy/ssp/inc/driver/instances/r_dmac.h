@@ -34,6 +34,9 @@
  * also supports data transfers using software start.
  *
  * @note The transfer length is limited to 1024 (10 bits) in ::TRANSFER_MODE_BLOCK and ::TRANSFER_MODE_REPEAT.
+ * @note transfer_api_t::copy2D copies contiguous rectangles and one transfer wide columns with a single hardware
+ *       transfer, using offset addition for the strided side of a column.  Other rectangles are copied one row at a
+ *       time, with each row loaded from the transfer end interrupt, which needs a callback set in transfer_api_t::open.
  * @note This driver supports only ::TRANSFER_IRQ_END from transfer_irq_t.
  * @{
  **********************************************************************************************************************/
@@ -54,7 +57,7 @@ SSP_HEADER
  * Macro definitions
  **********************************************************************************************************************/
 #define DMAC_CODE_VERSION_MAJOR (2U)
-#define DMAC_CODE_VERSION_MINOR (0U)
+#define DMAC_CODE_VERSION_MINOR (2U)
 
 /** Length limited to 1024 transfers for repeat and block mode */
 #define DMAC_REPEAT_BLOCK_MAX_LENGTH (0x400)
@@ -68,6 +71,17 @@ SSP_HEADER
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
+/** Strided copy started with transfer_api_t::copy2D and continued one row at a time from the interrupt. */
+typedef struct st_dmac_copy_2d
+{
+    uint8_t const * p_src;         ///< Source of the next row
+    uint8_t       * p_dest;        ///< Destination of the next row
+    uint32_t        src_stride;    ///< Bytes from one source row to the next
+    uint32_t        dest_stride;   ///< Bytes from one destination row to the next
+    uint16_t        length;        ///< Transfers per row
+    uint16_t        rows;          ///< Rows left to load, 0 when no row by row copy is running
+} dmac_copy_2d_t;
+
 /** Control block used by driver. DO NOT INITIALIZE - this structure will be initialized in transfer_api_t::open. */
 typedef struct st_dmac_instance_ctrl
 {
@@ -86,6 +100,13 @@ typedef struct st_dmac_instance_ctrl
 
     /** Pointer to base register. */
     void       * p_reg;
+
+    /** Batch submitted with transfer_api_t::batchSubmit, NULL when no batch is running. */
+    transfer_batch_t const * volatile p_batch;
+    uint16_t     batch_index;  ///< Index of the batch descriptor currently loaded.
+
+    /** Strided copy submitted with transfer_api_t::copy2D. */
+    dmac_copy_2d_t copy_2d;
 } dmac_instance_ctrl_t;
 
 /** DMAC transfer configuration extension. This extension is required. */
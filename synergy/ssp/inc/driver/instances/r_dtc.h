@@ -54,7 +54,7 @@ SSP_HEADER
  * Macro definitions
  **********************************************************************************************************************/
 #define DTC_CODE_VERSION_MAJOR (2U)
-#define DTC_CODE_VERSION_MINOR (0U)
+#define DTC_CODE_VERSION_MINOR (2U)
 
 /** Length limited to 256 transfers for repeat and block mode */
 #define DTC_REPEAT_BLOCK_MAX_LENGTH (0x100)
@@ -77,8 +77,21 @@ typedef struct st_dtc_instance_ctrl
 
     /** Placeholder for user data.  Passed to the user p_callback in ::transfer_callback_args_t. */
     void const * p_context;
+
+    transfer_info_t  * p_copy_2d_info;        ///< Descriptors for transfer_api_t::copy2D, NULL if not configured
+    uint16_t           copy_2d_info_count;    ///< Number of descriptors in p_copy_2d_info
 } dtc_instance_ctrl_t;
 
+/** DTC transfer configuration extension. This extension is optional. */
+typedef struct st_transfer_on_dtc_cfg
+{
+    /** Descriptors for transfer_api_t::copy2D, NULL if copy2D is not used.  Every row takes one descriptor per 256
+     *  transfers; a rectangle with contiguous rows of at most 256 transfers takes one descriptor per 256 transfers
+     *  of the whole rectangle.  The descriptors are read while the copy runs. */
+    transfer_info_t  * p_copy_2d_info;
+    uint16_t           copy_2d_info_count;    ///< Number of descriptors in p_copy_2d_info
+} transfer_on_dtc_cfg_t;
+
 /* --------------------  Begin section using anonymous unions  ------------------- */
 #if defined(__CC_ARM)
 #pragma push
@@ -0,0 +1,104 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : r_ether.h
+ * Description  : Ethernet MAC (ETHERC and EDMAC) instance header file.
+ **********************************************************************************************************************/
+
+#ifndef R_ETHER_H
+#define R_ETHER_H
+
+/*******************************************************************************************************************//**
+ * @ingroup HAL_Library
+ * @defgroup ETHER ETHER
+ * @brief Driver for the Ethernet MAC (ETHERC) and its DMA controller (EDMAC).
+ *
+ * This module supports the Ethernet MAC with descriptor rings in SRAM and a reference counted packet buffer pool. It
+ * implements the following interfaces:
+ *   - @ref ETHER_API
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "r_ether_cfg.h"
+#include "r_ether_api.h"
+
+/* Common macro for SSP header files. There is also a corresponding SSP_FOOTER macro at the end of this file. */
+SSP_HEADER
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define ETHER_CODE_VERSION_MAJOR (1U)
+#define ETHER_CODE_VERSION_MINOR (0U)
+
+/**********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+/** @cond INC_HEADER_DEFS_SEC */
+/** Filled in Interface API structure for this Instance. */
+extern const ether_api_t g_ether_on_ether;
+/** @endcond */
+
+/**********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** ETHER Instance Control Block   */
+typedef struct st_ether_instance_ctrl
+{
+    uint32_t                 channel;                   ///< Channel number
+    uint32_t                 open;                      ///< Open status of channel
+    void                   * p_edmac_reg;               ///< Pointer to EDMAC register base address
+    void                   * p_etherc_reg;              ///< Pointer to ETHERC register base address
+    IRQn_Type                irq;                       ///< EINT IRQ number
+    ether_rx_mode_t          rx_mode;                   ///< Receive notification mode
+    volatile bool            rx_armed;                  ///< Receive interrupt enabled, waiting for the next burst
+
+    ether_descriptor_t     * p_rx_descriptors;          ///< Receive descriptor ring
+    uint32_t                 num_rx_descriptors;        ///< Number of receive descriptors
+    uint32_t                 rx_head;                   ///< Next receive descriptor to read
+    ether_descriptor_t     * p_tx_descriptors;          ///< Transmit descriptor ring
+    uint32_t                 num_tx_descriptors;        ///< Number of transmit descriptors
+    uint32_t                 tx_head;                   ///< Next transmit descriptor to fill
+    uint32_t                 tx_tail;                   ///< Oldest transmit descriptor not yet reclaimed
+    volatile uint32_t        tx_count;                  ///< Transmit descriptors owned by the DMA controller
+    bsp_pool_t               pool;                      ///< Packet buffer pool
+    ether_stats_t            stats;                     ///< Driver statistics
+
+    void                  (* p_callback)(ether_callback_args_t * p_args); ///< Pointer to callback function
+    void const             * p_context;                 ///< Pointer to the higher level device context
+    bool                     deferred_callback;         ///< Post callbacks to the BSP deferred work scheduler
+    uint8_t                  deferred_callback_priority;///< Work priority of deferred callbacks
+} ether_instance_ctrl_t;
+
+
+/*******************************************************************************************************************//**
+ * @} (end defgroup ETHER)
+ **********************************************************************************************************************/
+
+/* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
+SSP_FOOTER
+
+/* R_ETHER_H */
+#endif // ifndef R_ETHER_H
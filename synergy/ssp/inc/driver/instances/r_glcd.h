@@ -49,10 +49,28 @@ SSP_HEADER
 /***********************************************************************************************************************
  * Macro definitions
  **********************************************************************************************************************/
+/** Maximum number of frame buffers a layer flips between */
+#define GLCD_FLIP_BUFFERS_MAX (3U)
 
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
+/** Page flip state of a graphics layer */
+typedef struct st_glcd_flip
+{
+    void                 * p_buffers[GLCD_FLIP_BUFFERS_MAX];        ///< Registered frame buffers
+    uint32_t               num_buffers;                             ///< Number of registered frame buffers
+    void                 * queue[GLCD_FLIP_BUFFERS_MAX];            ///< Presented frame buffers, oldest first
+    uint32_t               head;                                    ///< Index of the oldest presented frame buffer
+    uint32_t               count;                                   ///< Number of presented frame buffers
+    void                 * p_displayed;                             ///< Frame buffer being scanned out
+    void                 * p_latched;                               ///< Frame buffer scanned out from the next vsync
+    uint32_t               base_offset;                             ///< Base address offset for the layer position
+    uint32_t               vsyncs_since_flip;                       ///< Vsyncs since the last frame buffer was latched
+    uint64_t               flip_time;                               ///< Timestamp the last frame buffer was latched
+    display_flip_stats_t   stats;                                   ///< Statistics returned by R_GLCD_FlipStatsGet()
+} glcd_flip_t;
+
 /** Display control block.  DO NOT INITIALIZE. */
 typedef struct st_glcd_instance_ctrl
 {
@@ -62,6 +80,7 @@ typedef struct st_glcd_instance_ctrl
     void (* p_callback)(display_callback_args_t * p_args);          ///< Pointer to callback function
     void const   * p_context;                                       ///< Pointer to the higher level device context
     R_GLCDC_Type * p_reg;                                           ///< Base register address
+    glcd_flip_t    flip[DISPLAY_FRAME_LAYER_2 + 1];                 ///< Page flip state of the graphics layers
 } glcd_instance_ctrl_t;
 
 /** Clock source select */
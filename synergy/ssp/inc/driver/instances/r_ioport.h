@@ -54,7 +54,26 @@ SSP_HEADER
  * Macro definitions
  **********************************************************************************************************************/
 #define IOPORT_CODE_VERSION_MAJOR (2U)
-#define IOPORT_CODE_VERSION_MINOR (0U)
+#define IOPORT_CODE_VERSION_MINOR (1U)
+
+/** Port index of an ioport_port_t or ioport_port_pin_t value. Usable in constant expressions. */
+#define IOPORT_PORT_INDEX(port_pin)        (((uint32_t) (port_pin) >> 8) & 0xFFU)
+
+/** Bit mask of an ioport_port_pin_t within its port. Usable in constant expressions. */
+#define IOPORT_PIN_MASK(pin)               ((uint32_t) 1U << ((uint32_t) (pin) & 0x0FU))
+
+/** @cond INC_HEADER_DEFS_SEC */
+/** Spacing of the PCNTR register blocks of consecutive ports, and offsets of PCNTR1..3 inside a block. */
+#define IOPORT_PRV_FAST_PORT_STRIDE        (0x20U)
+#define IOPORT_PRV_FAST_PCNTR1             (0x00U)
+#define IOPORT_PRV_FAST_PCNTR2             (0x04U)
+#define IOPORT_PRV_FAST_PCNTR3             (0x08U)
+
+/** Address of a PCNTR register of the port containing port_pin. Folds to a constant when port_pin is a constant. */
+#define IOPORT_PRV_FAST_PCNTR(port_pin, offset)                                                  \
+    ((uint32_t volatile *) (R_IOPORT0_BASE + (IOPORT_PORT_INDEX(port_pin) * IOPORT_PRV_FAST_PORT_STRIDE) + \
+                            (offset)))
+/** @endcond */
 
 /***********************************************************************************************************************
  * Typedef definitions
@@ -68,6 +87,100 @@ SSP_HEADER
 extern const ioport_api_t g_ioport_on_ioport;
 /** @endcond */
 
+/***********************************************************************************************************************
+ * Inline fast path
+ *
+ * These accessors bypass the driver API: there is no parameter checking and no function call, and each write
+ * compiles to a single store to the port's PCNTR3 register (POSR in the lower half, PORR in the upper half). When the
+ * pin is a compile-time constant the register address and data fold to constants. Set, clear and write are atomic
+ * with respect to every other pin of the port, so they are safe to use from ISRs and threads concurrently. The pin
+ * must exist on the package and be configured as a general purpose output (or input for the read functions).
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Drives a pin high with a single POSR write.
+ *
+ * @param[in]  pin  Pin to drive high
+ **********************************************************************************************************************/
+__STATIC_INLINE void R_IOPORT_FastPinSet (ioport_port_pin_t pin)
+{
+    *IOPORT_PRV_FAST_PCNTR(pin, IOPORT_PRV_FAST_PCNTR3) = IOPORT_PIN_MASK(pin);
+}
+
+/*******************************************************************************************************************//**
+ * Drives a pin low with a single PORR write.
+ *
+ * @param[in]  pin  Pin to drive low
+ **********************************************************************************************************************/
+__STATIC_INLINE void R_IOPORT_FastPinClear (ioport_port_pin_t pin)
+{
+    *IOPORT_PRV_FAST_PCNTR(pin, IOPORT_PRV_FAST_PCNTR3) = IOPORT_PIN_MASK(pin) << 16;
+}
+
+/*******************************************************************************************************************//**
+ * Drives a pin to the requested level with a single POSR/PORR write.
+ *
+ * @param[in]  pin    Pin to drive
+ * @param[in]  level  IOPORT_LEVEL_LOW or IOPORT_LEVEL_HIGH
+ **********************************************************************************************************************/
+__STATIC_INLINE void R_IOPORT_FastPinWrite (ioport_port_pin_t pin, ioport_level_t level)
+{
+    /* POSR is bits 0-15 and PORR is bits 16-31, so a low level moves the pin mask up by 16. */
+    *IOPORT_PRV_FAST_PCNTR(pin, IOPORT_PRV_FAST_PCNTR3) =
+        IOPORT_PIN_MASK(pin) << ((IOPORT_LEVEL_LOW == level) ? 16U : 0U);
+}
+
+/*******************************************************************************************************************//**
+ * Inverts the output level of a pin. PODR is read once and the new level is applied with a single POSR/PORR write,
+ * so other pins on the port are never disturbed. Concurrent toggles of the same pin must be serialized by the caller.
+ *
+ * @param[in]  pin  Pin to toggle
+ **********************************************************************************************************************/
+__STATIC_INLINE void R_IOPORT_FastPinToggle (ioport_port_pin_t pin)
+{
+    uint32_t mask = IOPORT_PIN_MASK(pin);
+    uint32_t podr = *IOPORT_PRV_FAST_PCNTR(pin, IOPORT_PRV_FAST_PCNTR1) >> 16;
+
+    *IOPORT_PRV_FAST_PCNTR(pin, IOPORT_PRV_FAST_PCNTR3) = (podr & mask) ? (mask << 16) : mask;
+}
+
+/*******************************************************************************************************************//**
+ * Reads the input level of a pin from PIDR.
+ *
+ * @param[in]  pin  Pin to read
+ *
+ * @return     IOPORT_LEVEL_HIGH or IOPORT_LEVEL_LOW
+ **********************************************************************************************************************/
+__STATIC_INLINE ioport_level_t R_IOPORT_FastPinRead (ioport_port_pin_t pin)
+{
+    return (*IOPORT_PRV_FAST_PCNTR(pin, IOPORT_PRV_FAST_PCNTR2) & IOPORT_PIN_MASK(pin)) ?
+           IOPORT_LEVEL_HIGH : IOPORT_LEVEL_LOW;
+}
+
+/*******************************************************************************************************************//**
+ * Drives several pins of one port high and others low with a single PCNTR3 write. The two masks must not overlap.
+ *
+ * @param[in]  port      Port to write
+ * @param[in]  set_bits  Pins to drive high
+ * @param[in]  clr_bits  Pins to drive low
+ **********************************************************************************************************************/
+__STATIC_INLINE void R_IOPORT_FastPortSetClear (ioport_port_t port, ioport_size_t set_bits, ioport_size_t clr_bits)
+{
+    *IOPORT_PRV_FAST_PCNTR(port, IOPORT_PRV_FAST_PCNTR3) = ((uint32_t) clr_bits << 16) | (uint32_t) set_bits;
+}
+
+/*******************************************************************************************************************//**
+ * Reads the input levels of all pins of a port from PIDR.
+ *
+ * @param[in]  port  Port to read
+ *
+ * @return     Pin levels, bit n corresponding to pin n
+ **********************************************************************************************************************/
+__STATIC_INLINE ioport_size_t R_IOPORT_FastPortRead (ioport_port_t port)
+{
+    return (ioport_size_t) (*IOPORT_PRV_FAST_PCNTR(port, IOPORT_PRV_FAST_PCNTR2) & 0xFFFFU);
+}
+
 /* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
 SSP_FOOTER
 
@@ -45,7 +45,9 @@ SSP_HEADER
  * Macro definitions
  **********************************************************************************************************************/
 #define PDC_CODE_VERSION_MAJOR (2U)
-#define PDC_CODE_VERSION_MINOR (0U)
+#define PDC_CODE_VERSION_MINOR (2U)
+
+#define PDC_STREAM_BUFFERS_MAX (8U)     ///< Maximum number of frame or band buffers in a continuous capture
 
 /***********************************************************************************************************************
  * Typedef definitions
@@ -68,6 +70,20 @@ typedef struct st_pdc_instance_ctrl
     pdc_vsync_polarity_t        vsync_polarity;         ///< Polarity of VSYNC input
     uint8_t                   * p_current_buffer;       ///< Pointer to buffer currently in use
     bool                        transfer_in_progress;   ///< Indicates if a PDC transfer is already in progress
+    bool                        transfer_open;          ///< Lower level transfer opened by the first capture
+    bool                        streaming;              ///< Continuous capture is running
+    uint32_t                    frame_blocks;           ///< Number of 32 byte transfer blocks in a frame
+    uint32_t                    num_segments;           ///< Number of transfer segments in a frame
+    uint32_t                    segment_blocks;         ///< Number of 32 byte transfer blocks in a full segment
+    uint32_t                    band_lines;             ///< Lines in a band of a band capture, 0 otherwise
+    bool                        band_drop;              ///< The rest of the current frame is not delivered
+    volatile uint32_t           segment;                ///< Transfer segment armed for the current frame
+    uint8_t                   * p_buffers[PDC_STREAM_BUFFERS_MAX];  ///< Frame or band buffers of a continuous capture
+    uint32_t                    num_buffers;            ///< Number of buffers in p_buffers
+    uint32_t                    buffer_index;           ///< Index of p_current_buffer in p_buffers
+    volatile uint32_t           buffers_free;           ///< Bit n is set while p_buffers[n] is free for capture
+    uint32_t                    frame;                  ///< Sequence number of the last frame captured
+    uint32_t                    dropped;                ///< Frames dropped since the last frame was delivered
     transfer_instance_t const * p_lower_lvl_transfer;   ///< Pointer to the transfer instance the PDC should use
     transfer_info_t             info_transfer;          ///< Transfer info structure for low level Transfer interface
     void const                * p_context;              ///< Placeholder for user data.  Passed to the user callback in
@@ -47,6 +47,8 @@
 #include <string.h>
 #include "r_qspi_cfg.h"
 #include "r_qspi_api.h"
+#include "r_transfer_api.h"
+#include "r_timer_api.h"
 
 /* Common macro for SSP header files. There is also a corresponding SSP_FOOTER macro at the end of this file. */
 SSP_HEADER
@@ -55,11 +57,25 @@ SSP_HEADER
  * Macro definitions
  **********************************************************************************************************************/
 #define QSPI_CODE_VERSION_MAJOR (2U)
-#define QSPI_CODE_VERSION_MINOR (0U)
+#define QSPI_CODE_VERSION_MINOR (1U)
 
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
+/** QSPI on QSPI configuration extension.  Optional, NULL if qspi_api_t::readAsync and qspi_api_t::programAsync are
+ * not used. */
+typedef struct st_qspi_on_qspi_cfg
+{
+    /** DMAC instance that moves asynchronous read data out of the memory mapped window and page data into SFMCOM.
+     *  The driver configures it for software start and opens it for each operation. */
+    transfer_instance_t const  * p_lower_lvl_transfer;
+
+    /** Periodic timer that polls the write in progress bit while qspi_api_t::programAsync is running, NULL to poll
+     *  only from qspi_api_t::statusGet.  The driver opens the instance with its own callback, and the period set in
+     *  its configuration is the poll interval. */
+    timer_instance_t const     * p_lower_lvl_timer;
+} qspi_on_qspi_cfg_t;
+
 /** Instance control block. DO NOT INITIALIZE.  Initialization occurs when qspi_api_t::open is called */
 typedef struct st_qspi_instance_ctrl
 {
@@ -76,6 +92,18 @@ typedef struct st_qspi_instance_ctrl
     bool      xip_mode;           ///< 0 = run in read mode, 1 = run in XIP mode
     uint32_t  total_size_bytes;   ///< Total size of the flash in bytes
     uint32_t  open;               ///< Flag to determine if the device is open
+    void   (* p_callback)(qspi_callback_args_t * p_args);       ///< User callback for asynchronous operations
+    void const                * p_context;                      ///< Passed to the user callback
+    transfer_instance_t const * p_lower_lvl_transfer;           ///< DMAC for asynchronous operations, NULL if not used
+    timer_instance_t const    * p_lower_lvl_timer;              ///< Write in progress poll timer, NULL if not used
+    uint8_t                   * p_async_device;   ///< Next flash address of the asynchronous operation
+    uint8_t                   * p_async_memory;   ///< Next memory address of the asynchronous operation
+    uint32_t                    async_remaining;  ///< Bytes not yet given to the transfer
+    uint32_t                    async_tail;       ///< Read bytes copied by the CPU after the last transfer
+    uint16_t                    async_queued;     ///< Bytes of the page queued in the transfer
+    uint8_t                     async_unit;       ///< Size of one read transfer in bytes
+    bool                        async_restore_spi_mode;     ///< SPI protocol changed for the page being written
+    volatile uint8_t            async_state;      ///< Asynchronous operation in progress, 0 if none
 } qspi_instance_ctrl_t;
 
 /**********************************************************************************************************************
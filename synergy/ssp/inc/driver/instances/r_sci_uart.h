@@ -55,7 +55,7 @@ SSP_HEADER
  * Macro definitions
  **********************************************************************************************************************/
 #define SCI_UART_CODE_VERSION_MAJOR (2U)
-#define SCI_UART_CODE_VERSION_MINOR (0U)
+#define SCI_UART_CODE_VERSION_MINOR (1U)
 
 /**********************************************************************************************************************
  * Typedef definitions
@@ -101,6 +101,14 @@ typedef struct st_sci_uart_instance_ctrl
     uart_mode_t         uart_comm_mode;                       ///< UART communication mode selection
     uart_rs485_type_t   uart_rs485_mode;                      ///< UART RS485 communication channel type selection
     ioport_port_pin_t   rs485_de_pin;                         ///< UART Driver Enable pin
+    uint8_t  * p_rx_ring;                                     ///< Ring buffer set by readStream(), NULL if not streaming
+    uint32_t rx_ring_bytes;                                   ///< Ring buffer size in bytes, a power of two
+    volatile uint32_t rx_ring_head;                           ///< Free running count of bytes landed before the armed segment
+    volatile uint32_t rx_ring_end;                            ///< Free running count at the end of the armed segment
+    volatile uint32_t rx_ring_tail;                           ///< Free running count of bytes consumed by ringRead()
+    volatile uint32_t rx_ring_seq;                            ///< Odd while the ISR updates the ring indices
+    bool     deferred_callback;                               ///< Post callbacks to the BSP deferred work scheduler
+    uint8_t  deferred_callback_priority;                      ///< Work priority of deferred callbacks
 } sci_uart_instance_ctrl_t;
 
 /** Enumeration for SCI clock source */
@@ -51,7 +51,7 @@ SSP_HEADER
  * Macro definitions
  **********************************************************************************************************************/
 #define SDMMC_CODE_VERSION_MAJOR (2U)
-#define SDMMC_CODE_VERSION_MINOR (0U)
+#define SDMMC_CODE_VERSION_MINOR (1U)
 
 /***********************************************************************************************************************
  * Typedef definitions
@@ -169,7 +169,14 @@ typedef struct st_sdmmc_instance_ctrl
     uint32_t                    transfer_blocks_total;      ///< Total transfer block count
     uint32_t                    transfer_block_current;     ///< Transfer current block
     uint32_t                    transfer_block_size;        ///< Transfer block size
-    uint32_t                    aligned_buff[SDMMC_MAX_BLOCK_SIZE / sizeof(uint32_t)];///< Aligned buffer
+    uint32_t                    transfer_batch_blocks;      ///< Blocks staged in aligned_buff per transfer interrupt, 0 if the buffer is used directly
+    uint32_t                    transfer_pending;           ///< Events that must occur before the current command is complete
+    bool                        transfer_response_check;    ///< Check the R1 response of a command issued from the access interrupt
+    sdmmc_segment_t const     * p_segments;                 ///< Next segment of a scatter-gather transfer
+    uint32_t                    segment_count;              ///< Segments left in p_segments
+    uint32_t                    segment_offset;             ///< Sectors of p_segments[0] already issued
+    sdmmc_segment_t             segment;                    ///< Segment list used by read() and write()
+    uint32_t                    aligned_buff[(SDMMC_MAX_BLOCK_SIZE * SDMMC_CFG_UNALIGNED_BLOCKS) / sizeof(uint32_t)];///< Aligned buffer
 } sdmmc_instance_ctrl_t;
 
 /** Extended SDMMC configuration, to be pointed to p_extend. */
@@ -46,7 +46,7 @@ SSP_HEADER
 Macro definitions
 ***********************************************************************************************************************/
 #define SSI_CODE_VERSION_MAJOR   (2U)
-#define SSI_CODE_VERSION_MINOR   (0U)
+#define SSI_CODE_VERSION_MINOR   (1U)
 
 /***********************************************************************************************************************
 Typedef definitions
@@ -92,6 +92,25 @@ typedef struct st_ssi_instance_ctrl
     IRQn_Type  rxi_irq;                        ///< Receive IRQ number
     IRQn_Type  int_irq;                        ///< Idle/Error IRQ number
     uint32_t   open;                           ///< Whether or not this control block is initialized
+    bool       deferred_callback;              ///< Post callbacks to the BSP deferred work scheduler
+    uint8_t    deferred_callback_priority;     ///< Work priority of deferred callbacks
+
+    /** Streaming transmit ring, NULL when transmit is not streaming. */
+    uint8_t const * p_tx_ring;
+
+    /** Streaming receive ring, NULL when receive is not streaming. */
+    uint8_t  * p_rx_ring;
+    uint16_t   period_bytes;                   ///< Bytes per streaming period
+    uint16_t   period_count;                   ///< Periods in each streaming ring
+    uint16_t   tx_period;                      ///< Ring index of the transmit period in progress
+    uint16_t   rx_period;                      ///< Ring index of the receive period in progress
+    volatile uint32_t tx_period_done;          ///< Transmit periods completed, free running
+    volatile uint32_t tx_period_ready;         ///< Transmit periods filled by the application, free running
+    volatile uint32_t rx_period_done;          ///< Receive periods completed, free running
+    volatile uint32_t rx_period_free;          ///< Receive periods released by the application, free running
+    volatile uint32_t tx_underrun_count;       ///< Transmit periods played before they were refilled
+    volatile uint32_t rx_overrun_count;        ///< Receive periods overwritten before they were read
+    bool       tx_underrun_muted;              ///< True while the output is muted because of an underrun
 } ssi_instance_ctrl_t;
 
 /** SSI configuration extension. This extension is optional. */
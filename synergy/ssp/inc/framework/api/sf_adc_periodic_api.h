@@ -0,0 +1,207 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : sf_adc_periodic_api.h
+ * Description  : Hardware timed ADC acquisition framework interface
+ **********************************************************************************************************************/
+
+#ifndef SF_ADC_PERIODIC_API_H
+#define SF_ADC_PERIODIC_API_H
+
+/*******************************************************************************************************************//**
+ * @ingroup SF_Interface_Library
+ * @defgroup SF_ADC_PERIODIC_API ADC Periodic Framework Interface
+ *
+ * @brief Interface for sampling ADC channels at a fixed rate into a ring of blocks, with optional decimation.
+ *
+ * @section SF_ADC_PERIODIC_API_SUMMARY Summary
+ * A timer starts each ADC scan through the ELC, and the DTC copies the results of all scanned channels into a ring of
+ * blocks in memory as each scan ends. The CPU is interrupted once per block, not once per scan or conversion. Each
+ * completed block can be averaged or FIR filtered and decimated per channel before it is passed to the callback, so
+ * the application receives blocks at the output rate it needs.
+ *
+ * Related SSP architecture topics:
+ *  - @ref ssp-interfaces
+ *  - @ref ssp-predefined-layers
+ *  - @ref using-ssp-modules
+ *
+ * ADC Periodic Framework Interface description: @ref FrameworkADCPeriodicInterface
+ *
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+/* Register definitions, common services and error codes. */
+#include "bsp_api.h"
+#include "r_adc_api.h"
+#include "r_timer_api.h"
+#include "r_transfer_api.h"
+
+/* Common macro for SSP header files. There is also a corresponding SSP_FOOTER macro at the end of this file. */
+SSP_HEADER
+
+/**********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define SF_ADC_PERIODIC_API_VERSION_MAJOR (1U)
+#define SF_ADC_PERIODIC_API_VERSION_MINOR (0U)
+
+/**********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+/** ADC periodic framework events */
+typedef enum e_sf_adc_periodic_event
+{
+    SF_ADC_PERIODIC_EVENT_BLOCK_DONE = 0,   ///< A block of scans was acquired and filtered
+    SF_ADC_PERIODIC_EVENT_OVERRUN,          ///< Blocks were overwritten by the DTC before they were processed
+} sf_adc_periodic_event_t;
+
+/** Processing applied to each block before it is passed to the callback */
+typedef enum e_sf_adc_periodic_filter
+{
+    SF_ADC_PERIODIC_FILTER_NONE = 0,        ///< No processing, only the raw block is passed to the callback
+    SF_ADC_PERIODIC_FILTER_AVERAGE,         ///< Average each group of decimation scans per channel
+    SF_ADC_PERIODIC_FILTER_FIR,             ///< FIR filter and decimate each channel with arm_fir_decimate_q15
+} sf_adc_periodic_filter_t;
+
+/** Callback function parameter data */
+typedef struct st_sf_adc_periodic_callback_args
+{
+    sf_adc_periodic_event_t   event;        ///< Event causing the callback
+    uint32_t                  block;        ///< Free running number of the block, counted from start
+    /** Raw block as copied by the DTC: frames_per_block scans, each with one result per ADC data register from the
+     *  lowest to the highest scanned channel. */
+    uint16_t const          * p_raw;
+    uint32_t                  raw_stride;   ///< Results per scan in p_raw
+    /** Processed block in Q15: frames scans of channels results, in channel order. NULL for
+     *  ::SF_ADC_PERIODIC_FILTER_NONE. */
+    int16_t const           * p_data;
+    uint32_t                  frames;       ///< Scans in p_data
+    uint32_t                  channels;     ///< Scanned channels, the results per scan in p_data
+    uint32_t                  blocks_lost;  ///< Blocks overwritten, for ::SF_ADC_PERIODIC_EVENT_OVERRUN
+    void const              * p_context;    ///< Placeholder for user data.  Set in ::sf_adc_periodic_cfg_t.
+} sf_adc_periodic_callback_args_t;
+
+/** ADC periodic framework configuration */
+typedef struct st_sf_adc_periodic_cfg
+{
+    /** ADC unit and scan.  It must use ADC_MODE_SINGLE_SCAN and ADC_TRIGGER_SYNC_ELC.  The framework opens it with
+     *  its own callback and starts it with the timer. */
+    adc_instance_t const       * p_lower_lvl_adc;
+    /** Periodic timer whose period is the scan interval.  Its counter overflow event starts the scans. */
+    timer_instance_t const     * p_lower_lvl_timer;
+    /** DTC transfer.  The framework sets its transfer information and activation source. */
+    transfer_instance_t const  * p_lower_lvl_transfer;
+    uint16_t                   * p_ring;            ///< Ring of block_count raw blocks
+    uint32_t                     ring_samples;      ///< Size of p_ring in results
+    uint16_t                     frames_per_block;  ///< Scans per block, the CPU is interrupted once per block
+    uint8_t                      block_count;       ///< Blocks in the ring, at least 2
+    sf_adc_periodic_filter_t     filter;            ///< Processing applied to each block
+    /** Decimation factor, frames_per_block must be a multiple of it.  Ignored for ::SF_ADC_PERIODIC_FILTER_NONE. */
+    uint8_t                      decimation;
+    /** Left shift that turns raw results into Q15, for example 3 for 12-bit right aligned results. */
+    uint8_t                      q15_shift;
+    int16_t const              * p_fir_coeffs;      ///< FIR coefficients in Q15, for ::SF_ADC_PERIODIC_FILTER_FIR
+    uint16_t                     fir_taps;          ///< Number of FIR coefficients
+    /** FIR state, SF_ADC_PERIODIC_FIR_STATE_SAMPLES() entries.  Only for ::SF_ADC_PERIODIC_FILTER_FIR. */
+    int16_t                    * p_fir_state;
+    /** Work buffer, SF_ADC_PERIODIC_SCRATCH_SAMPLES() entries.  Only for ::SF_ADC_PERIODIC_FILTER_FIR. */
+    int16_t                    * p_scratch;
+    /** Processed block, SF_ADC_PERIODIC_OUTPUT_SAMPLES() entries.  Not used for ::SF_ADC_PERIODIC_FILTER_NONE. */
+    int16_t                    * p_output;
+    void (* p_callback)(sf_adc_periodic_callback_args_t * p_args);  ///< Callback for processed blocks
+    void const                 * p_context;         ///< Placeholder for user data.  Passed to the user callback.
+
+    /** Process blocks and call p_callback from the BSP deferred work scheduler in thread mode instead of from the
+     *  scan end interrupt.  If no work slot is free, the block stays pending until the end of the next block. */
+    bool                         deferred_callback;
+    uint8_t                      deferred_callback_priority;   ///< Work priority, 0 is the most urgent
+} sf_adc_periodic_cfg_t;
+
+/** ADC periodic framework control block.  Allocate an instance specific control block to pass into the API calls.
+ * @par Implemented as
+ * - sf_adc_periodic_instance_ctrl_t
+ */
+typedef void sf_adc_periodic_ctrl_t;
+
+/** ADC periodic framework API structure. */
+typedef struct st_sf_adc_periodic_api
+{
+    /** Open the ADC, timer and transfer and link the timer to the ADC.
+     * @par Implemented as
+     * - SF_ADC_PERIODIC_Open()
+     *
+     * @param[in,out] p_ctrl     Pointer to control block. Must be declared by user. Elements set here.
+     * @param[in]     p_cfg      Pointer to configuration structure.
+     */
+    ssp_err_t (* open)(sf_adc_periodic_ctrl_t * const p_ctrl, sf_adc_periodic_cfg_t const * const p_cfg);
+
+    /** Start sampling into the first block of the ring.
+     * @par Implemented as
+     * - SF_ADC_PERIODIC_Start()
+     *
+     * @param[in]     p_ctrl     Control block set in sf_adc_periodic_api_t::open call.
+     */
+    ssp_err_t (* start)(sf_adc_periodic_ctrl_t * const p_ctrl);
+
+    /** Stop sampling.  The block being filled is discarded.
+     * @par Implemented as
+     * - SF_ADC_PERIODIC_Stop()
+     *
+     * @param[in]     p_ctrl     Control block set in sf_adc_periodic_api_t::open call.
+     */
+    ssp_err_t (* stop)(sf_adc_periodic_ctrl_t * const p_ctrl);
+
+    /** Stop sampling and close the lower level drivers.
+     * @par Implemented as
+     * - SF_ADC_PERIODIC_Close()
+     *
+     * @param[in]     p_ctrl     Control block set in sf_adc_periodic_api_t::open call.
+     */
+    ssp_err_t (* close)(sf_adc_periodic_ctrl_t * const p_ctrl);
+
+    /** Get the framework version based on compile time macros.
+     * @par Implemented as
+     * - SF_ADC_PERIODIC_VersionGet()
+     *
+     * @param[out]    p_version  Code and API version.
+     */
+    ssp_err_t (* versionGet)(ssp_version_t * const p_version);
+} sf_adc_periodic_api_t;
+
+/** This structure encompasses everything that is needed to use an instance of this interface. */
+typedef struct st_sf_adc_periodic_instance
+{
+    sf_adc_periodic_ctrl_t      * p_ctrl;    ///< Pointer to the control structure for this instance
+    sf_adc_periodic_cfg_t const * p_cfg;     ///< Pointer to the configuration structure for this instance
+    sf_adc_periodic_api_t const * p_api;     ///< Pointer to the API structure for this instance
+} sf_adc_periodic_instance_t;
+
+
+/*******************************************************************************************************************//**
+ * @} (end defgroup SF_ADC_PERIODIC_API)
+ **********************************************************************************************************************/
+
+/* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
+SSP_FOOTER
+
+#endif /* SF_ADC_PERIODIC_API_H */
@@ -0,0 +1,192 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : sf_camera_jpeg_api.h
+ * Description  : Camera to JPEG streaming framework interface
+ **********************************************************************************************************************/
+
+#ifndef SF_CAMERA_JPEG_API_H
+#define SF_CAMERA_JPEG_API_H
+
+/*******************************************************************************************************************//**
+ * @ingroup SF_Interface_Library
+ * @defgroup SF_CAMERA_JPEG_API Camera JPEG Framework Interface
+ *
+ * @brief Interface for encoding frames from the parallel data capture unit to JPEG while they are being captured.
+ *
+ * @section SF_CAMERA_JPEG_API_SUMMARY Summary
+ * The camera JPEG framework connects a PDC band capture to the JPEG encoder. The PDC hands each frame over in bands of
+ * a few lines, and every band is passed to the encoder as soon as it is captured, so encoding runs alongside the
+ * capture and only a small ring of band buffers is needed instead of a full frame buffer. The encoded data is written
+ * to a caller supplied output ring and reported to the callback band by band, so a consumer can start sending a
+ * frame before its capture has finished.
+ *
+ * Each encoded frame occupies a contiguous region of the output ring. A frame stays in the ring until the caller
+ * returns it with sf_camera_jpeg_api_t::frameRelease; frames are returned in the order they were completed.
+ *
+ * Related SSP architecture topics:
+ *  - @ref ssp-interfaces
+ *  - @ref ssp-predefined-layers
+ *  - @ref using-ssp-modules
+ *
+ * Camera JPEG Framework Interface description: @ref FrameworkCameraJpegInterface
+ *
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+/* Register definitions, common services and error codes. */
+#include "bsp_api.h"
+#include "r_pdc_api.h"
+#include "r_jpeg_encode_api.h"
+
+/* Common macro for SSP header files. There is also a corresponding SSP_FOOTER macro at the end of this file. */
+SSP_HEADER
+
+/**********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define SF_CAMERA_JPEG_API_VERSION_MAJOR (1U)
+#define SF_CAMERA_JPEG_API_VERSION_MINOR (0U)
+
+/**********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+/** Camera JPEG framework events */
+typedef enum e_sf_camera_jpeg_event
+{
+    SF_CAMERA_JPEG_EVENT_DATA = 0,          ///< More encoded data of the current frame is available
+    SF_CAMERA_JPEG_EVENT_FRAME_COMPLETE,    ///< The last encoded data of a frame is available
+    SF_CAMERA_JPEG_EVENT_FRAME_DROPPED,     ///< A frame was not encoded, data passed for it before is not valid
+    SF_CAMERA_JPEG_EVENT_ERROR,             ///< The capture stopped because of a PDC or encoder error
+} sf_camera_jpeg_event_t;
+
+/** Callback function parameter data */
+typedef struct st_sf_camera_jpeg_callback_args
+{
+    sf_camera_jpeg_event_t   event;         ///< Event causing the callback
+    uint8_t const          * p_data;        ///< Encoded data following the data passed before for the same frame
+    uint32_t                 length;        ///< Number of bytes at p_data
+    uint8_t const          * p_frame;       ///< Start of the encoded frame in the output ring
+    uint32_t                 frame_size;    ///< Bytes of the frame encoded so far, the JPEG size once complete
+    uint32_t                 frame;         ///< PDC sequence number of the frame
+    uint64_t                 timestamp;     ///< Timestamp of the first band of the frame
+    pdc_event_t              pdc_event;     ///< PDC error events for ::SF_CAMERA_JPEG_EVENT_ERROR
+    void const             * p_context;     ///< Placeholder for user data.  Set in ::sf_camera_jpeg_cfg_t.
+} sf_camera_jpeg_callback_args_t;
+
+/** Camera JPEG framework configuration */
+typedef struct st_sf_camera_jpeg_cfg
+{
+    /** PDC capturing YCbCr 4:2:2 frames with 2 bytes per pixel. The framework sets its callback. */
+    pdc_instance_t const         * p_lower_lvl_pdc;
+    /** JPEG encoder configured for the PDC capture size. The framework sets its callback. */
+    jpeg_encode_instance_t const * p_lower_lvl_jpeg;
+    /** Band buffers, 8-byte aligned and each large enough for band_lines captured lines. */
+    uint8_t * const              * pp_band_buffers;
+    uint32_t                       num_band_buffers;    ///< Number of band buffers, at least 2
+    uint32_t                       band_lines;          ///< Lines in a band, a multiple of 8
+    uint8_t                      * p_output_buffer;     ///< Output ring for encoded frames, 8-byte aligned
+    uint32_t                       output_buffer_size;  ///< Size of the output ring in bytes
+    /** Largest encoded frame in bytes. This much contiguous space must be free in the output ring before a frame is
+     *  encoded. */
+    uint32_t                       output_frame_max;
+    void (* p_callback)(sf_camera_jpeg_callback_args_t * p_args);  ///< Callback for encoded data and errors
+    void const                   * p_context;           ///< Placeholder for user data.  Passed to the user callback.
+} sf_camera_jpeg_cfg_t;
+
+/** Camera JPEG framework control block.  Allocate an instance specific control block to pass into the API calls.
+ * @par Implemented as
+ * - sf_camera_jpeg_instance_ctrl_t
+ */
+typedef void sf_camera_jpeg_ctrl_t;
+
+/** Camera JPEG framework API structure. */
+typedef struct st_sf_camera_jpeg_api
+{
+    /** Open the PDC and the JPEG encoder for band-level encoding.
+     * @par Implemented as
+     * - SF_CAMERA_JPEG_Open()
+     *
+     * @param[in,out] p_ctrl     Pointer to control block. Must be declared by user. Elements set here.
+     * @param[in]     p_cfg      Pointer to configuration structure.
+     */
+    ssp_err_t (* open)(sf_camera_jpeg_ctrl_t * const p_ctrl, sf_camera_jpeg_cfg_t const * const p_cfg);
+
+    /** Start capturing and encoding frames continuously.
+     * @par Implemented as
+     * - SF_CAMERA_JPEG_Start()
+     *
+     * @param[in]     p_ctrl     Control block set in sf_camera_jpeg_api_t::open call.
+     */
+    ssp_err_t (* start)(sf_camera_jpeg_ctrl_t * const p_ctrl);
+
+    /** Stop capturing. A frame being encoded is dropped, completed frames stay in the output ring.
+     * @par Implemented as
+     * - SF_CAMERA_JPEG_Stop()
+     *
+     * @param[in]     p_ctrl     Control block set in sf_camera_jpeg_api_t::open call.
+     */
+    ssp_err_t (* stop)(sf_camera_jpeg_ctrl_t * const p_ctrl);
+
+    /** Return the oldest completed frame's space in the output ring.
+     * @par Implemented as
+     * - SF_CAMERA_JPEG_FrameRelease()
+     *
+     * @param[in]     p_ctrl     Control block set in sf_camera_jpeg_api_t::open call.
+     */
+    ssp_err_t (* frameRelease)(sf_camera_jpeg_ctrl_t * const p_ctrl);
+
+    /** Stop capturing and close the PDC and the JPEG encoder.
+     * @par Implemented as
+     * - SF_CAMERA_JPEG_Close()
+     *
+     * @param[in]     p_ctrl     Control block set in sf_camera_jpeg_api_t::open call.
+     */
+    ssp_err_t (* close)(sf_camera_jpeg_ctrl_t * const p_ctrl);
+
+    /** Get the framework version based on compile time macros.
+     * @par Implemented as
+     * - SF_CAMERA_JPEG_VersionGet()
+     *
+     * @param[out]    p_version  Code and API version.
+     */
+    ssp_err_t (* versionGet)(ssp_version_t * const p_version);
+} sf_camera_jpeg_api_t;
+
+/** This structure encompasses everything that is needed to use an instance of this interface. */
+typedef struct st_sf_camera_jpeg_instance
+{
+    sf_camera_jpeg_ctrl_t      * p_ctrl;    ///< Pointer to the control structure for this instance
+    sf_camera_jpeg_cfg_t const * p_cfg;     ///< Pointer to the configuration structure for this instance
+    sf_camera_jpeg_api_t const * p_api;     ///< Pointer to the API structure for this instance
+} sf_camera_jpeg_instance_t;
+
+
+/*******************************************************************************************************************//**
+ * @} (end defgroup SF_CAMERA_JPEG_API)
+ **********************************************************************************************************************/
+
+/* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
+SSP_FOOTER
+
+#endif /* SF_CAMERA_JPEG_API_H */
@@ -0,0 +1,188 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : sf_dac_waveform_api.h
+ * Description  : DAC waveform generator framework interface
+ **********************************************************************************************************************/
+
+#ifndef SF_DAC_WAVEFORM_API_H
+#define SF_DAC_WAVEFORM_API_H
+
+/*******************************************************************************************************************//**
+ * @ingroup SF_Interface_Library
+ * @defgroup SF_DAC_WAVEFORM_API DAC Waveform Framework Interface
+ *
+ * @brief Interface for timer paced DAC output of a sample table, with table changes at period boundaries.
+ *
+ * @section SF_DAC_WAVEFORM_API_SUMMARY Summary
+ * Each timer period, a transfer writes the next sample of a table to the DAC data register and returns to the start
+ * of the table after the last sample. The CPU is not involved while the table plays. A new table is queued with
+ * sf_dac_waveform_api_t::tableSet and starts after the last sample of the current period, so the output never
+ * contains part of a period of either table.
+ *
+ * The same mechanism streams longer signals: split a ring buffer into segments, queue the next segment while the
+ * current one plays, and refill each segment after sf_dac_waveform_api_t::statusGet reports that the one after it
+ * is playing. A segment that is not replaced in time repeats.
+ *
+ * Related SSP architecture topics:
+ *  - @ref ssp-interfaces
+ *  - @ref ssp-predefined-layers
+ *  - @ref using-ssp-modules
+ *
+ * DAC Waveform Framework Interface description: @ref FrameworkDACWaveformInterface
+ *
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+/* Register definitions, common services and error codes. */
+#include "bsp_api.h"
+#include "r_dac_api.h"
+#include "r_timer_api.h"
+#include "r_transfer_api.h"
+
+/* Common macro for SSP header files. There is also a corresponding SSP_FOOTER macro at the end of this file. */
+SSP_HEADER
+
+/**********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define SF_DAC_WAVEFORM_API_VERSION_MAJOR (1U)
+#define SF_DAC_WAVEFORM_API_VERSION_MINOR (0U)
+
+/**********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+/** Waveform status */
+typedef struct st_sf_dac_waveform_status
+{
+    void const  * p_samples;     ///< Table being played
+    uint16_t      length;        ///< Samples in the table being played
+    uint16_t      position;      ///< Index of the next sample written to the DAC
+    bool          swap_pending;  ///< A table queued with sf_dac_waveform_api_t::tableSet has not started yet
+    bool          running;       ///< The timer is pacing the output
+} sf_dac_waveform_status_t;
+
+/** DAC waveform framework configuration */
+typedef struct st_sf_dac_waveform_cfg
+{
+    /** DAC channel.  The framework opens and starts it, then writes its data register with the transfer. */
+    dac_instance_t const       * p_lower_lvl_dac;
+    /** Periodic timer whose period is the sample interval.  Its counter overflow event activates the transfer, so it
+     *  must be opened without a callback. */
+    timer_instance_t const     * p_lower_lvl_timer;
+    /** DTC transfer.  The framework supplies the transfer information and the activation source; the DTC is
+     *  required because the table swap uses chain transfers. */
+    transfer_instance_t const  * p_lower_lvl_transfer;
+    /** First table.  Samples are 16-bit for DAC and 8-bit for DAC8, in the format written to the data register. */
+    void const                 * p_samples;
+    uint16_t                     length;         ///< Samples in the table, 2 to SF_DAC_WAVEFORM_LENGTH_MAX
+} sf_dac_waveform_cfg_t;
+
+/** DAC waveform framework control block.  Allocate an instance specific control block to pass into the API calls.
+ * @par Implemented as
+ * - sf_dac_waveform_instance_ctrl_t
+ */
+typedef void sf_dac_waveform_ctrl_t;
+
+/** DAC waveform framework API structure. */
+typedef struct st_sf_dac_waveform_api
+{
+    /** Open and start the DAC, open the timer and set up the transfer.
+     * @par Implemented as
+     * - SF_DAC_WAVEFORM_Open()
+     *
+     * @param[in,out] p_ctrl     Pointer to control block. Must be declared by user. Elements set here.
+     * @param[in]     p_cfg      Pointer to configuration structure.
+     */
+    ssp_err_t (* open)(sf_dac_waveform_ctrl_t * const p_ctrl, sf_dac_waveform_cfg_t const * const p_cfg);
+
+    /** Start the output from the first sample of the newest table.
+     * @par Implemented as
+     * - SF_DAC_WAVEFORM_Start()
+     *
+     * @param[in]     p_ctrl     Control block set in sf_dac_waveform_api_t::open call.
+     */
+    ssp_err_t (* start)(sf_dac_waveform_ctrl_t * const p_ctrl);
+
+    /** Stop the output.  The DAC holds the last sample.
+     * @par Implemented as
+     * - SF_DAC_WAVEFORM_Stop()
+     *
+     * @param[in]     p_ctrl     Control block set in sf_dac_waveform_api_t::open call.
+     */
+    ssp_err_t (* stop)(sf_dac_waveform_ctrl_t * const p_ctrl);
+
+    /** Queue a table to start after the last sample of the current period.  A table queued before the previous one
+     * started replaces it.  The table must stay valid until another table has started.
+     * @par Implemented as
+     * - SF_DAC_WAVEFORM_TableSet()
+     *
+     * @param[in]     p_ctrl     Control block set in sf_dac_waveform_api_t::open call.
+     * @param[in]     p_samples  Table, which must not overlap the table being played unless it is the same buffer.
+     * @param[in]     length     Samples in the table, 2 to SF_DAC_WAVEFORM_LENGTH_MAX.
+     */
+    ssp_err_t (* tableSet)(sf_dac_waveform_ctrl_t * const p_ctrl, void const * const p_samples, uint16_t length);
+
+    /** Get the table being played and the output position in it.
+     * @par Implemented as
+     * - SF_DAC_WAVEFORM_StatusGet()
+     *
+     * @param[in]     p_ctrl     Control block set in sf_dac_waveform_api_t::open call.
+     * @param[out]    p_status   Waveform status.
+     */
+    ssp_err_t (* statusGet)(sf_dac_waveform_ctrl_t * const p_ctrl, sf_dac_waveform_status_t * const p_status);
+
+    /** Stop the output and close the lower level drivers.
+     * @par Implemented as
+     * - SF_DAC_WAVEFORM_Close()
+     *
+     * @param[in]     p_ctrl     Control block set in sf_dac_waveform_api_t::open call.
+     */
+    ssp_err_t (* close)(sf_dac_waveform_ctrl_t * const p_ctrl);
+
+    /** Get the framework version based on compile time macros.
+     * @par Implemented as
+     * - SF_DAC_WAVEFORM_VersionGet()
+     *
+     * @param[out]    p_version  Code and API version.
+     */
+    ssp_err_t (* versionGet)(ssp_version_t * const p_version);
+} sf_dac_waveform_api_t;
+
+/** This structure encompasses everything that is needed to use an instance of this interface. */
+typedef struct st_sf_dac_waveform_instance
+{
+    sf_dac_waveform_ctrl_t      * p_ctrl;    ///< Pointer to the control structure for this instance
+    sf_dac_waveform_cfg_t const * p_cfg;     ///< Pointer to the configuration structure for this instance
+    sf_dac_waveform_api_t const * p_api;     ///< Pointer to the API structure for this instance
+} sf_dac_waveform_instance_t;
+
+
+/*******************************************************************************************************************//**
+ * @} (end defgroup SF_DAC_WAVEFORM_API)
+ **********************************************************************************************************************/
+
+/* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
+SSP_FOOTER
+
+#endif /* SF_DAC_WAVEFORM_API_H */
@@ -0,0 +1,192 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : sf_elc_graph_api.h
+ * Description  : ELC event graph framework interface
+ **********************************************************************************************************************/
+
+#ifndef SF_ELC_GRAPH_API_H
+#define SF_ELC_GRAPH_API_H
+
+/*******************************************************************************************************************//**
+ * @ingroup SF_Interface_Library
+ * @defgroup SF_ELC_GRAPH_API ELC Event Graph Framework Interface
+ *
+ * @brief Interface for peripheral pipelines connected by the Event Link Controller, described by constant tables.
+ *
+ * @section SF_ELC_GRAPH_API_SUMMARY Summary
+ * A graph lists the driver instances of a pipeline as nodes and the event links between them as edges, for example
+ * a GPT whose compare match starts an ADC scan, a DTC stage activated by the scan end event and a DAC. Both tables
+ * are constant and built with the SF_ELC_GRAPH_* initializer macros, so they are placed in flash.
+ *
+ * sf_elc_graph_api_t::open checks the whole graph against the event numbers of the MCU and against itself, then
+ * opens every node. Opening a transfer node claims the DTC vector of its activation event. The ELC links are only
+ * made by sf_elc_graph_api_t::start, which then starts the nodes from the end of the pipeline back to its source
+ * with interrupts disabled, so no event reaches a stage that is not ready. sf_elc_graph_api_t::stop stops the
+ * nodes from the source and breaks the links.
+ *
+ * Related SSP architecture topics:
+ *  - @ref ssp-interfaces
+ *  - @ref ssp-predefined-layers
+ *  - @ref using-ssp-modules
+ *
+ * ELC Event Graph Framework Interface description: @ref FrameworkELCGraphInterface
+ *
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+/* Register definitions, common services and error codes. */
+#include "bsp_api.h"
+#include "r_elc_api.h"
+#include "r_timer_api.h"
+#include "r_adc_api.h"
+#include "r_transfer_api.h"
+#include "r_dac_api.h"
+
+/* Common macro for SSP header files. There is also a corresponding SSP_FOOTER macro at the end of this file. */
+SSP_HEADER
+
+/**********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define SF_ELC_GRAPH_API_VERSION_MAJOR (1U)
+#define SF_ELC_GRAPH_API_VERSION_MINOR (0U)
+
+/** Node initializers for sf_elc_graph_cfg_t::p_nodes. */
+#define SF_ELC_GRAPH_TIMER(p_timer)          { SF_ELC_GRAPH_NODE_TIMER,    (void const *) (p_timer) }
+#define SF_ELC_GRAPH_ADC(p_adc)              { SF_ELC_GRAPH_NODE_ADC,      (void const *) (p_adc) }
+#define SF_ELC_GRAPH_TRANSFER(p_transfer)    { SF_ELC_GRAPH_NODE_TRANSFER, (void const *) (p_transfer) }
+#define SF_ELC_GRAPH_DAC(p_dac)              { SF_ELC_GRAPH_NODE_DAC,      (void const *) (p_dac) }
+
+/** Edge initializer for sf_elc_graph_cfg_t::p_links: event is sent to peripheral. */
+#define SF_ELC_GRAPH_LINK(event, peripheral) { (peripheral), (event) }
+
+/** Number of entries in a node or link table. */
+#define SF_ELC_GRAPH_COUNT(table)            (sizeof(table) / sizeof((table)[0]))
+
+/**********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+/** Driver behind a node, which sets how the node is opened, started, stopped and closed. */
+typedef enum e_sf_elc_graph_node_type
+{
+    /** timer_instance_t.  Opened, then started last and stopped first.  Must not be configured to start on open. */
+    SF_ELC_GRAPH_NODE_TIMER,
+    /** adc_instance_t.  Opened and configured with its channel configuration, then armed with adc_api_t::scanStart.
+     *  Must be configured for ELC triggers. */
+    SF_ELC_GRAPH_NODE_ADC,
+    /** transfer_instance_t.  Opened, which claims the DTC vector of its activation event, then enabled.  Must not be
+     *  configured to enable on open. */
+    SF_ELC_GRAPH_NODE_TRANSFER,
+    /** dac_instance_t.  Opened, then started. */
+    SF_ELC_GRAPH_NODE_DAC,
+} sf_elc_graph_node_type_t;
+
+/** Graph node */
+typedef struct st_sf_elc_graph_node
+{
+    sf_elc_graph_node_type_t   type;         ///< Driver behind the node
+    void const               * p_instance;   ///< Instance of the driver named by type
+} sf_elc_graph_node_t;
+
+/** ELC event graph framework configuration */
+typedef struct st_sf_elc_graph_cfg
+{
+    /** Nodes in pipeline order, from the source of the first event to the last consumer.  They are started from the
+     *  last node to the first and stopped from the first node to the last. */
+    sf_elc_graph_node_t const  * p_nodes;
+    uint32_t                     node_count;      ///< Entries in p_nodes
+    elc_link_t const           * p_links;         ///< ELC links made while the graph is started
+    uint32_t                     link_count;      ///< Entries in p_links, up to one for each peripheral
+    elc_instance_t const       * p_lower_lvl_elc; ///< Event Link Controller
+} sf_elc_graph_cfg_t;
+
+/** ELC event graph framework control block.  Allocate an instance specific control block to pass into the API calls.
+ * @par Implemented as
+ * - sf_elc_graph_instance_ctrl_t
+ */
+typedef void sf_elc_graph_ctrl_t;
+
+/** ELC event graph framework API structure. */
+typedef struct st_sf_elc_graph_api
+{
+    /** Check the graph and open every node.
+     * @par Implemented as
+     * - SF_ELC_GRAPH_Open()
+     *
+     * @param[in,out] p_ctrl     Pointer to control block. Must be declared by user. Elements set here.
+     * @param[in]     p_cfg      Pointer to configuration structure.
+     */
+    ssp_err_t (* open)(sf_elc_graph_ctrl_t * const p_ctrl, sf_elc_graph_cfg_t const * const p_cfg);
+
+    /** Make the ELC links and start every node, from the last to the first, with interrupts disabled.  If a node
+     *  fails to start, the nodes already started are stopped and the links are broken.
+     * @par Implemented as
+     * - SF_ELC_GRAPH_Start()
+     *
+     * @param[in]     p_ctrl     Control block set in sf_elc_graph_api_t::open call.
+     */
+    ssp_err_t (* start)(sf_elc_graph_ctrl_t * const p_ctrl);
+
+    /** Stop every node, from the first to the last, and break the ELC links, with interrupts disabled.
+     * @par Implemented as
+     * - SF_ELC_GRAPH_Stop()
+     *
+     * @param[in]     p_ctrl     Control block set in sf_elc_graph_api_t::open call.
+     */
+    ssp_err_t (* stop)(sf_elc_graph_ctrl_t * const p_ctrl);
+
+    /** Stop the graph if it is started and close every node.
+     * @par Implemented as
+     * - SF_ELC_GRAPH_Close()
+     *
+     * @param[in]     p_ctrl     Control block set in sf_elc_graph_api_t::open call.
+     */
+    ssp_err_t (* close)(sf_elc_graph_ctrl_t * const p_ctrl);
+
+    /** Get the framework version based on compile time macros.
+     * @par Implemented as
+     * - SF_ELC_GRAPH_VersionGet()
+     *
+     * @param[out]    p_version  Code and API version.
+     */
+    ssp_err_t (* versionGet)(ssp_version_t * const p_version);
+} sf_elc_graph_api_t;
+
+/** This structure encompasses everything that is needed to use an instance of this interface. */
+typedef struct st_sf_elc_graph_instance
+{
+    sf_elc_graph_ctrl_t      * p_ctrl;    ///< Pointer to the control structure for this instance
+    sf_elc_graph_cfg_t const * p_cfg;     ///< Pointer to the configuration structure for this instance
+    sf_elc_graph_api_t const * p_api;     ///< Pointer to the API structure for this instance
+} sf_elc_graph_instance_t;
+
+
+/*******************************************************************************************************************//**
+ * @} (end defgroup SF_ELC_GRAPH_API)
+ **********************************************************************************************************************/
+
+/* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
+SSP_FOOTER
+
+#endif /* SF_ELC_GRAPH_API_H */
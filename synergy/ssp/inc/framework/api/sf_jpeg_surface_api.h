@@ -0,0 +1,186 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : sf_jpeg_surface_api.h
+ * Description  : JPEG decode to display surface framework interface
+ **********************************************************************************************************************/
+
+#ifndef SF_JPEG_SURFACE_API_H
+#define SF_JPEG_SURFACE_API_H
+
+/*******************************************************************************************************************//**
+ * @ingroup SF_Interface_Library
+ * @defgroup SF_JPEG_SURFACE_API JPEG Surface Framework Interface
+ *
+ * @brief Interface for decoding JPEG images straight into a region of a display layer's frame buffer.
+ *
+ * @section SF_JPEG_SURFACE_API_SUMMARY Summary
+ * The JPEG surface framework decodes queued JPEG images into rectangles of display frame buffers. When the layer's
+ * pixel format is one the decoder produces (RGB565, ARGB8888 or RGB888) and the rectangle is 8-byte aligned, the
+ * decoder writes the image straight into the frame buffer using the layer's stride. Otherwise the image is decoded in
+ * bands of lines into a small band buffer and each band is converted into the frame buffer as soon as it is decoded,
+ * so no full size intermediate image is needed in either case.
+ *
+ * Images are decoded in the order they were queued. The next image is started from the interrupt that completes
+ * the previous one, so the decoder does not wait for the application between queued images.
+ *
+ * Related SSP architecture topics:
+ *  - @ref ssp-interfaces
+ *  - @ref ssp-predefined-layers
+ *  - @ref using-ssp-modules
+ *
+ * JPEG Surface Framework Interface description: @ref FrameworkJpegSurfaceInterface
+ *
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+/* Register definitions, common services and error codes. */
+#include "bsp_api.h"
+#include "r_display_api.h"
+#include "r_jpeg_decode_api.h"
+
+/* Common macro for SSP header files. There is also a corresponding SSP_FOOTER macro at the end of this file. */
+SSP_HEADER
+
+/**********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define SF_JPEG_SURFACE_API_VERSION_MAJOR (1U)
+#define SF_JPEG_SURFACE_API_VERSION_MINOR (0U)
+
+/**********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+/** JPEG surface framework events */
+typedef enum e_sf_jpeg_surface_event
+{
+    SF_JPEG_SURFACE_EVENT_IMAGE_DONE = 0,   ///< An image was decoded into its rectangle
+    SF_JPEG_SURFACE_EVENT_IMAGE_ERROR,      ///< An image could not be decoded, its rectangle may be partly written
+} sf_jpeg_surface_event_t;
+
+/** Image to decode */
+typedef struct st_sf_jpeg_surface_image
+{
+    /** Complete JPEG data, 8-byte aligned. The decoder reads up to the EOI marker. */
+    uint8_t const         * p_jpeg;
+    display_frame_layer_t   layer;          ///< Layer whose format and stride the frame buffer has
+    /** Frame buffer to decode into, NULL for the frame buffer in the layer's display configuration. */
+    void                  * p_frame_buffer;
+    uint16_t                x;              ///< Left edge of the rectangle in pixels
+    uint16_t                y;              ///< Top edge of the rectangle in lines
+    uint16_t                width;          ///< Width of the rectangle, the image may not be wider
+    uint16_t                height;         ///< Height of the rectangle, the image may not be higher
+    void const            * p_context;      ///< Placeholder for user data.  Passed to the user callback.
+} sf_jpeg_surface_image_t;
+
+/** Callback function parameter data */
+typedef struct st_sf_jpeg_surface_callback_args
+{
+    sf_jpeg_surface_event_t   event;        ///< Event causing the callback
+    ssp_err_t                 error;        ///< Reason for ::SF_JPEG_SURFACE_EVENT_IMAGE_ERROR
+    uint16_t                  width;        ///< Width of the decoded image, 0 if it was not known
+    uint16_t                  height;       ///< Height of the decoded image, 0 if it was not known
+    void const              * p_image_context;  ///< sf_jpeg_surface_image_t::p_context of the image
+    void const              * p_context;    ///< Placeholder for user data.  Set in ::sf_jpeg_surface_cfg_t.
+} sf_jpeg_surface_callback_args_t;
+
+/** JPEG surface framework configuration */
+typedef struct st_sf_jpeg_surface_cfg
+{
+    /** JPEG decoder. The framework sets its callback and output pixel format. The output data format must give
+     *  pixels in CPU byte order for layers that are converted from the band buffer. */
+    jpeg_decode_instance_t const  * p_lower_lvl_jpeg;
+    /** Display whose layer configuration describes the frame buffers. */
+    display_instance_t const      * p_display;
+    /** Band buffer for layers the decoder cannot write directly, 8-byte aligned. NULL if all images are written
+     *  directly. */
+    void                          * p_band_buffer;
+    /** Size of the band buffer in bytes. It must hold 16 lines of the widest image at 4 bytes per pixel, or 2 bytes
+     *  per pixel for RGB565 layers. */
+    uint32_t                        band_buffer_size;
+    void (* p_callback)(sf_jpeg_surface_callback_args_t * p_args); ///< Callback for decoded images
+    void const                    * p_context;   ///< Placeholder for user data.  Passed to the user callback.
+} sf_jpeg_surface_cfg_t;
+
+/** JPEG surface framework control block.  Allocate an instance specific control block to pass into the API calls.
+ * @par Implemented as
+ * - sf_jpeg_surface_instance_ctrl_t
+ */
+typedef void sf_jpeg_surface_ctrl_t;
+
+/** JPEG surface framework API structure. */
+typedef struct st_sf_jpeg_surface_api
+{
+    /** Open the JPEG decoder.
+     * @par Implemented as
+     * - SF_JPEG_SURFACE_Open()
+     *
+     * @param[in,out] p_ctrl     Pointer to control block. Must be declared by user. Elements set here.
+     * @param[in]     p_cfg      Pointer to configuration structure.
+     */
+    ssp_err_t (* open)(sf_jpeg_surface_ctrl_t * const p_ctrl, sf_jpeg_surface_cfg_t const * const p_cfg);
+
+    /** Queue an image for decoding. The image description is copied, the JPEG data must stay valid until the image
+     *  is reported to the callback.
+     * @par Implemented as
+     * - SF_JPEG_SURFACE_Decode()
+     *
+     * @param[in]     p_ctrl     Control block set in sf_jpeg_surface_api_t::open call.
+     * @param[in]     p_image    Image to decode and the rectangle to decode it into.
+     */
+    ssp_err_t (* decode)(sf_jpeg_surface_ctrl_t * const p_ctrl, sf_jpeg_surface_image_t const * const p_image);
+
+    /** Close the JPEG decoder. Queued images are discarded without callbacks.
+     * @par Implemented as
+     * - SF_JPEG_SURFACE_Close()
+     *
+     * @param[in]     p_ctrl     Control block set in sf_jpeg_surface_api_t::open call.
+     */
+    ssp_err_t (* close)(sf_jpeg_surface_ctrl_t * const p_ctrl);
+
+    /** Get the framework version based on compile time macros.
+     * @par Implemented as
+     * - SF_JPEG_SURFACE_VersionGet()
+     *
+     * @param[out]    p_version  Code and API version.
+     */
+    ssp_err_t (* versionGet)(ssp_version_t * const p_version);
+} sf_jpeg_surface_api_t;
+
+/** This structure encompasses everything that is needed to use an instance of this interface. */
+typedef struct st_sf_jpeg_surface_instance
+{
+    sf_jpeg_surface_ctrl_t      * p_ctrl;    ///< Pointer to the control structure for this instance
+    sf_jpeg_surface_cfg_t const * p_cfg;     ///< Pointer to the configuration structure for this instance
+    sf_jpeg_surface_api_t const * p_api;     ///< Pointer to the API structure for this instance
+} sf_jpeg_surface_instance_t;
+
+
+/*******************************************************************************************************************//**
+ * @} (end defgroup SF_JPEG_SURFACE_API)
+ **********************************************************************************************************************/
+
+/* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
+SSP_FOOTER
+
+#endif /* SF_JPEG_SURFACE_API_H */
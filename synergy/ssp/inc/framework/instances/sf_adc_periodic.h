@@ -0,0 +1,126 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : sf_adc_periodic.h
+ * Description  : Hardware timed ADC acquisition framework instance header file.
+ **********************************************************************************************************************/
+
+#ifndef SF_ADC_PERIODIC_H
+#define SF_ADC_PERIODIC_H
+
+/*******************************************************************************************************************//**
+ * @ingroup SF_Library
+ * @defgroup SF_ADC_PERIODIC ADC Periodic Framework
+ * @brief Timer triggered ADC scans copied into a ring of blocks by the DTC, with per block decimation.
+ *
+ * FIR decimation uses arm_fir_decimate_q15 from CMSIS-DSP, so applications using ::SF_ADC_PERIODIC_FILTER_FIR link
+ * the bundled libDSP_Lib.a.
+ *
+ * This module implements the following interfaces:
+ *   - @ref SF_ADC_PERIODIC_API
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "arm_math.h"
+#include "sf_adc_periodic_cfg.h"
+#include "sf_adc_periodic_api.h"
+
+/* Common macro for SSP header files. There is also a corresponding SSP_FOOTER macro at the end of this file. */
+SSP_HEADER
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define SF_ADC_PERIODIC_CODE_VERSION_MAJOR (1U)
+#define SF_ADC_PERIODIC_CODE_VERSION_MINOR (0U)
+
+#define SF_ADC_PERIODIC_CHANNELS_MAX (28U)  ///< Channels that can be scanned, channel 0 to 27
+
+/** Entries in sf_adc_periodic_cfg_t::p_fir_state. */
+#define SF_ADC_PERIODIC_FIR_STATE_SAMPLES(channels, taps, frames_per_block) \
+    ((channels) * (((taps) + (frames_per_block)) - 1U))
+
+/** Entries in sf_adc_periodic_cfg_t::p_scratch. */
+#define SF_ADC_PERIODIC_SCRATCH_SAMPLES(frames_per_block, decimation) \
+    ((frames_per_block) + ((frames_per_block) / (decimation)))
+
+/** Entries in sf_adc_periodic_cfg_t::p_output. */
+#define SF_ADC_PERIODIC_OUTPUT_SAMPLES(channels, frames_per_block, decimation) \
+    ((channels) * ((frames_per_block) / (decimation)))
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+/** ADC periodic framework control block.  DO NOT INITIALIZE.  Initialization occurs when
+ * sf_adc_periodic_api_t::open is called. */
+typedef struct st_sf_adc_periodic_instance_ctrl
+{
+    uint32_t                       open;                ///< Indicates whether the framework is open
+    adc_instance_t const         * p_adc;               ///< ADC instance
+    timer_instance_t const       * p_timer;             ///< Timer starting the scans
+    transfer_instance_t const    * p_transfer;          ///< DTC copying each scan into the ring
+    adc_cfg_t                      adc_cfg;             ///< ADC configuration with the framework callback
+    transfer_cfg_t                 transfer_cfg;        ///< DTC configuration with the scan end activation source
+    uint16_t const               * p_result;            ///< Data register of the lowest scanned channel
+    elc_peripheral_t               elc_peripheral;      ///< ELC input of the ADC unit
+    uint16_t                     * p_ring;              ///< Ring of raw blocks
+    uint32_t                       raw_stride;          ///< Results per scan in the ring
+    uint32_t                       block_samples;       ///< Results per block in the ring
+    uint16_t                       frames_per_block;    ///< Scans per block
+    uint8_t                        block_count;         ///< Blocks in the ring
+    uint8_t                        write_block;         ///< Ring index of the block the DTC is filling
+    volatile uint32_t              block_done;          ///< Blocks filled, free running
+    uint32_t                       block_processed;     ///< Blocks processed, free running
+    volatile bool                  work_pending;        ///< Blocks are being processed or processing is posted
+    bool                           running;             ///< Sampling is started
+    sf_adc_periodic_filter_t       filter;              ///< Processing applied to each block
+    uint8_t                        decimation;          ///< Decimation factor
+    uint8_t                        q15_shift;           ///< Left shift from raw results to Q15
+    uint8_t                        channels;            ///< Scanned channels
+    uint8_t                        slot[SF_ADC_PERIODIC_CHANNELS_MAX];     ///< Offset of each channel in a raw scan
+    arm_fir_decimate_instance_q15  fir[SF_ADC_PERIODIC_CHANNELS_MAX];      ///< FIR decimator of each channel
+    q15_t                        * p_scratch;           ///< Deinterleaved input and output of one channel
+    q15_t                        * p_output;            ///< Processed block
+    void (* p_callback)(sf_adc_periodic_callback_args_t * p_args);         ///< User callback
+    void const                   * p_context;           ///< Placeholder for user data
+    bool                           deferred_callback;   ///< Process blocks from the BSP deferred work scheduler
+    uint8_t                        deferred_callback_priority;   ///< Work priority of deferred processing
+} sf_adc_periodic_instance_ctrl_t;
+
+/**********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+/** @cond INC_HEADER_DEFS_SEC */
+/** Filled in Interface API structure for this Instance. */
+extern const sf_adc_periodic_api_t g_sf_adc_periodic_on_sf_adc_periodic;
+/** @endcond */
+
+/* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
+SSP_FOOTER
+
+/*******************************************************************************************************************//**
+ * @} (end defgroup SF_ADC_PERIODIC)
+ **********************************************************************************************************************/
+
+#endif /* SF_ADC_PERIODIC_H */
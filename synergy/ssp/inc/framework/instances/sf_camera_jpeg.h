@@ -0,0 +1,131 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : sf_camera_jpeg.h
+ * Description  : Camera to JPEG streaming framework instance header file.
+ **********************************************************************************************************************/
+
+#ifndef SF_CAMERA_JPEG_H
+#define SF_CAMERA_JPEG_H
+
+/*******************************************************************************************************************//**
+ * @ingroup SF_Library
+ * @defgroup SF_CAMERA_JPEG Camera JPEG Framework
+ * @brief Streams frames from the PDC through the JPEG encoder one band of lines at a time.
+ *
+ * This module implements the following interfaces:
+ *   - @ref SF_CAMERA_JPEG_API
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "sf_camera_jpeg_cfg.h"
+#include "sf_camera_jpeg_api.h"
+
+/* Common macro for SSP header files. There is also a corresponding SSP_FOOTER macro at the end of this file. */
+SSP_HEADER
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define SF_CAMERA_JPEG_CODE_VERSION_MAJOR (1U)
+#define SF_CAMERA_JPEG_CODE_VERSION_MINOR (0U)
+
+#define SF_CAMERA_JPEG_BANDS_MAX  (8U)  ///< Maximum number of band buffers
+#define SF_CAMERA_JPEG_FRAMES_MAX (8U)  ///< Maximum number of completed frames held in the output ring
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+/** Captured band waiting for the encoder */
+typedef struct st_sf_camera_jpeg_band
+{
+    uint8_t  * p_buffer;        ///< Band buffer owned by the framework until it is returned to the PDC
+    uint32_t   frame;           ///< PDC sequence number of the frame the band belongs to
+    uint32_t   line;            ///< First line of the band
+    uint32_t   lines;           ///< Number of lines in the band
+    uint32_t   dropped;         ///< Frames the PDC abandoned before this one, only set for the first band of a frame
+    uint64_t   timestamp;       ///< Timestamp of the band
+} sf_camera_jpeg_band_t;
+
+/** Completed frame in the output ring */
+typedef struct st_sf_camera_jpeg_frame
+{
+    uint32_t   start;           ///< Offset of the frame in the output ring
+    uint32_t   end;             ///< Offset after the frame, rounded up to 8 bytes
+} sf_camera_jpeg_frame_t;
+
+/** Camera JPEG framework control block. DO NOT INITIALIZE. Initialization occurs when sf_camera_jpeg_api_t::open is
+ *  called. */
+typedef struct st_sf_camera_jpeg_instance_ctrl
+{
+    uint32_t                       open;                ///< Indicates whether the framework is open
+    pdc_instance_t const         * p_pdc;               ///< PDC instance
+    jpeg_encode_instance_t const * p_jpeg;              ///< JPEG encoder instance
+    jpeg_encode_cfg_t              jpeg_cfg;            ///< Encoder configuration, kept to restart the encoder
+    uint8_t                      * p_band_buffers[SF_CAMERA_JPEG_BANDS_MAX];  ///< Band buffers
+    uint32_t                       num_band_buffers;    ///< Number of band buffers
+    uint32_t                       band_lines;          ///< Lines in a band
+    uint32_t                       line_bytes;          ///< Bytes in a captured line
+    sf_camera_jpeg_band_t          bands[SF_CAMERA_JPEG_BANDS_MAX];  ///< Captured bands waiting for the encoder
+    uint32_t                       band_head;           ///< Index of the oldest band in bands
+    uint32_t                       band_count;          ///< Number of bands in bands
+    uint8_t                      * p_encoding;          ///< Band buffer being encoded, NULL while the encoder waits
+    volatile jpeg_encode_status_t  encoder_status;      ///< Encoder progress not handled yet, FREE if none
+    volatile uint32_t              encoded_size;        ///< Encoded bytes reported with encoder_status
+    volatile uint32_t              pdc_event;           ///< PDC error events not reported yet
+    volatile bool                  running;             ///< The capture is running
+    bool                           in_frame;            ///< A frame is being encoded
+    volatile bool                  pumping;             ///< Bands are being passed to the encoder
+    volatile bool                  pump_again;          ///< New work arrived while bands were passed to the encoder
+    uint32_t                       frame;               ///< PDC sequence number of the frame being encoded
+    uint32_t                       next_line;           ///< First line of the band the encoder needs next
+    uint64_t                       timestamp;           ///< Timestamp of the first band of the frame being encoded
+    uint8_t                      * p_output;            ///< Output ring
+    uint32_t                       output_size;         ///< Size of the output ring in bytes
+    uint32_t                       output_frame_max;    ///< Space reserved for a frame in the output ring
+    uint32_t                       frame_start;         ///< Offset of the frame being encoded in the output ring
+    uint32_t                       published;           ///< Bytes of the frame being encoded passed to the callback
+    sf_camera_jpeg_frame_t         frames[SF_CAMERA_JPEG_FRAMES_MAX];  ///< Completed frames in the output ring
+    uint32_t                       frame_head;          ///< Index of the oldest completed frame in frames
+    uint32_t                       frame_count;         ///< Number of completed frames in frames
+    void (* p_callback)(sf_camera_jpeg_callback_args_t * p_args);      ///< User callback
+    void const                   * p_context;           ///< Placeholder for user data
+} sf_camera_jpeg_instance_ctrl_t;
+
+/**********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+/** @cond INC_HEADER_DEFS_SEC */
+/** Filled in Interface API structure for this Instance. */
+extern const sf_camera_jpeg_api_t g_sf_camera_jpeg_on_sf_camera_jpeg;
+/** @endcond */
+
+/* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
+SSP_FOOTER
+
+/*******************************************************************************************************************//**
+ * @} (end defgroup SF_CAMERA_JPEG)
+ **********************************************************************************************************************/
+
+#endif /* SF_CAMERA_JPEG_H */
@@ -0,0 +1,98 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : sf_dac_waveform.h
+ * Description  : DAC waveform generator framework instance header file.
+ **********************************************************************************************************************/
+
+#ifndef SF_DAC_WAVEFORM_H
+#define SF_DAC_WAVEFORM_H
+
+/*******************************************************************************************************************//**
+ * @ingroup SF_Library
+ * @defgroup SF_DAC_WAVEFORM DAC Waveform Framework
+ * @brief Timer paced DTC output of sample tables to DAC or DAC8, with table swaps at period boundaries.
+ *
+ * The table plays from a DTC descriptor in repeat mode. It chains to two more descriptors only when it returns to
+ * the start of the table, and those copy the queued table address and length into it. A swap therefore needs no
+ * interrupt and always starts on a period boundary.
+ *
+ * This module implements the following interfaces:
+ *   - @ref SF_DAC_WAVEFORM_API
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "sf_dac_waveform_cfg.h"
+#include "sf_dac_waveform_api.h"
+
+/* Common macro for SSP header files. There is also a corresponding SSP_FOOTER macro at the end of this file. */
+SSP_HEADER
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define SF_DAC_WAVEFORM_CODE_VERSION_MAJOR (1U)
+#define SF_DAC_WAVEFORM_CODE_VERSION_MINOR (0U)
+
+#define SF_DAC_WAVEFORM_LENGTH_MAX (256U)   ///< Longest table, the DTC repeat mode limit
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+/** DAC waveform framework control block.  DO NOT INITIALIZE.  Initialization occurs when
+ * sf_dac_waveform_api_t::open is called. */
+typedef struct st_sf_dac_waveform_instance_ctrl
+{
+    uint32_t                       open;             ///< Indicates whether the framework is open
+    dac_instance_t const         * p_dac;            ///< DAC channel
+    timer_instance_t const       * p_timer;          ///< Timer pacing the output
+    transfer_instance_t const    * p_transfer;       ///< DTC writing the samples
+    transfer_cfg_t                 transfer_cfg;     ///< DTC configuration with the timer activation source
+    /** Sample descriptor, then the descriptors that copy the queued table into it at the end of each period. */
+    transfer_info_t                desc[3];
+    void const * volatile          p_next;           ///< Queued table, copied to desc[0] by desc[1]
+    volatile uint16_t              next_cra;         ///< Queued length as a reload count, copied to desc[0] by desc[2]
+    uint16_t                       next_length;      ///< Samples in the queued table
+    void const                   * p_active;         ///< Table known to be playing
+    uint16_t                       active_length;    ///< Samples in the table known to be playing
+    uint8_t                        sample_bytes;     ///< Size of each sample
+    bool                           running;          ///< The timer is pacing the output
+} sf_dac_waveform_instance_ctrl_t;
+
+/**********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+/** @cond INC_HEADER_DEFS_SEC */
+/** Filled in Interface API structure for this Instance. */
+extern const sf_dac_waveform_api_t g_sf_dac_waveform_on_sf_dac_waveform;
+/** @endcond */
+
+/* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
+SSP_FOOTER
+
+/*******************************************************************************************************************//**
+ * @} (end defgroup SF_DAC_WAVEFORM)
+ **********************************************************************************************************************/
+
+#endif /* SF_DAC_WAVEFORM_H */
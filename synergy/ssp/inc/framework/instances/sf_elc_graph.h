@@ -0,0 +1,88 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : sf_elc_graph.h
+ * Description  : ELC event graph framework instance header file.
+ **********************************************************************************************************************/
+
+#ifndef SF_ELC_GRAPH_H
+#define SF_ELC_GRAPH_H
+
+/*******************************************************************************************************************//**
+ * @ingroup SF_Library
+ * @defgroup SF_ELC_GRAPH ELC Event Graph Framework
+ * @brief Opens, starts and stops the drivers of an ELC connected pipeline as one unit.
+ *
+ * Each ELC peripheral input holds one event and each DTC vector belongs to one activation event, so the graph is
+ * rejected at open if two links feed the same peripheral or two transfer nodes share an activation event.
+ *
+ * This module implements the following interfaces:
+ *   - @ref SF_ELC_GRAPH_API
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "sf_elc_graph_cfg.h"
+#include "sf_elc_graph_api.h"
+
+/* Common macro for SSP header files. There is also a corresponding SSP_FOOTER macro at the end of this file. */
+SSP_HEADER
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define SF_ELC_GRAPH_CODE_VERSION_MAJOR (1U)
+#define SF_ELC_GRAPH_CODE_VERSION_MINOR (0U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+/** ELC event graph framework control block.  DO NOT INITIALIZE.  Initialization occurs when
+ * sf_elc_graph_api_t::open is called. */
+typedef struct st_sf_elc_graph_instance_ctrl
+{
+    uint32_t                       open;          ///< Indicates whether the framework is open
+    sf_elc_graph_node_t const    * p_nodes;       ///< Nodes in pipeline order
+    uint32_t                       node_count;    ///< Entries in p_nodes
+    elc_link_t const             * p_links;       ///< Links made while started
+    uint32_t                       link_count;    ///< Entries in p_links
+    elc_instance_t const         * p_elc;         ///< Event Link Controller
+    bool                           running;       ///< The links are made and the nodes are started
+} sf_elc_graph_instance_ctrl_t;
+
+/**********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+/** @cond INC_HEADER_DEFS_SEC */
+/** Filled in Interface API structure for this Instance. */
+extern const sf_elc_graph_api_t g_sf_elc_graph_on_sf_elc_graph;
+/** @endcond */
+
+/* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
+SSP_FOOTER
+
+/*******************************************************************************************************************//**
+ * @} (end defgroup SF_ELC_GRAPH)
+ **********************************************************************************************************************/
+
+#endif /* SF_ELC_GRAPH_H */
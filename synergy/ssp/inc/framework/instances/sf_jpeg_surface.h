@@ -0,0 +1,100 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : sf_jpeg_surface.h
+ * Description  : JPEG decode to display surface framework instance header file.
+ **********************************************************************************************************************/
+
+#ifndef SF_JPEG_SURFACE_H
+#define SF_JPEG_SURFACE_H
+
+/*******************************************************************************************************************//**
+ * @ingroup SF_Library
+ * @defgroup SF_JPEG_SURFACE JPEG Surface Framework
+ * @brief Decodes queued JPEG images into display frame buffer rectangles without an intermediate image buffer.
+ *
+ * This module implements the following interfaces:
+ *   - @ref SF_JPEG_SURFACE_API
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "sf_jpeg_surface_cfg.h"
+#include "sf_jpeg_surface_api.h"
+
+/* Common macro for SSP header files. There is also a corresponding SSP_FOOTER macro at the end of this file. */
+SSP_HEADER
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define SF_JPEG_SURFACE_CODE_VERSION_MAJOR (1U)
+#define SF_JPEG_SURFACE_CODE_VERSION_MINOR (0U)
+
+#define SF_JPEG_SURFACE_QUEUE_MAX (4U)  ///< Maximum number of images queued, including the one being decoded
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+/** JPEG surface framework control block.  DO NOT INITIALIZE.  Initialization occurs when
+ * sf_jpeg_surface_api_t::open is called. */
+typedef struct st_sf_jpeg_surface_instance_ctrl
+{
+    uint32_t                       open;                ///< Indicates whether the framework is open
+    jpeg_decode_instance_t const * p_jpeg;              ///< JPEG decoder instance
+    display_instance_t const     * p_display;           ///< Display describing the frame buffers
+    jpeg_decode_cfg_t              jpeg_cfg;            ///< Decoder configuration, reopened with it for each image
+    uint8_t                      * p_band_buffer;       ///< Band buffer for converted images
+    uint32_t                       band_buffer_size;    ///< Size of the band buffer in bytes
+    sf_jpeg_surface_image_t        images[SF_JPEG_SURFACE_QUEUE_MAX];  ///< Queued images, the first is being decoded
+    uint32_t                       image_head;          ///< Index of the image being decoded in images
+    uint32_t                       image_count;         ///< Number of images in images
+    bool                           busy;                ///< The decoder is working on the first queued image
+    bool                           direct;              ///< The decoder writes the image into the frame buffer
+    display_in_format_t            format;              ///< Pixel format of the frame buffer
+    uint8_t                      * p_dest;              ///< Top left pixel of the rectangle in the frame buffer
+    uint32_t                       hstride;             ///< Bytes in a frame buffer line
+    uint16_t                       width;               ///< Width of the image being decoded
+    uint16_t                       height;              ///< Height of the image being decoded
+    uint32_t                       line;                ///< Lines of the image written to the frame buffer
+    uint32_t                       band_lines;          ///< Lines in a band of a converted image
+    void (* p_callback)(sf_jpeg_surface_callback_args_t * p_args);     ///< User callback
+    void const                   * p_context;           ///< Placeholder for user data
+} sf_jpeg_surface_instance_ctrl_t;
+
+/**********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+/** @cond INC_HEADER_DEFS_SEC */
+/** Filled in Interface API structure for this Instance. */
+extern const sf_jpeg_surface_api_t g_sf_jpeg_surface_on_sf_jpeg_surface;
+/** @endcond */
+
+/* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
+SSP_FOOTER
+
+/*******************************************************************************************************************//**
+ * @} (end defgroup SF_JPEG_SURFACE)
+ **********************************************************************************************************************/
+
+#endif /* SF_JPEG_SURFACE_H */
@@ -45,9 +45,68 @@ Macro definitions
 ***********************************************************************************************************************/
 #define CP_MASK (0x0FU << 20)
 
+/* Defaults for configurations generated before the startup options were added. */
+#ifndef BSP_CFG_STARTUP_INIT_TABLES_ENABLE
+#define BSP_CFG_STARTUP_INIT_TABLES_ENABLE (0)
+#endif
+#ifndef BSP_CFG_STARTUP_DMAC_ENABLE
+#define BSP_CFG_STARTUP_DMAC_ENABLE (0)
+#endif
+#ifndef BSP_CFG_STARTUP_DMAC_CHANNEL
+#define BSP_CFG_STARTUP_DMAC_CHANNEL (0)
+#endif
+#ifndef BSP_CFG_STARTUP_TRACE_ENABLE
+#define BSP_CFG_STARTUP_TRACE_ENABLE (0)
+#endif
+
+/* Sections shorter than this are cleared or copied by the CPU, setting up the DMAC would take longer. */
+#define BSP_PRV_STARTUP_DMAC_MIN_WORDS      (64U)
+
+/* Largest transfer count in DMAC normal mode. */
+#define BSP_PRV_STARTUP_DMAC_MAX_WORDS      (0xFFFFU)
+
+/* Register spacing of the DMAC channels. */
+#define BSP_PRV_STARTUP_DMAC_CHANNEL_SIZE   (0x40U)
+
+/* DMTMD.SZ and DMAMD.SM/DM settings used for section initialization. */
+#define BSP_PRV_STARTUP_DMAC_SIZE_4_BYTE    (2U)
+#define BSP_PRV_STARTUP_DMAC_ADDR_FIXED     (0U)
+#define BSP_PRV_STARTUP_DMAC_ADDR_INCREMENT (2U)
+
+/* The host loader initializes RAM, so the section helpers are only built for the host when a test that includes this
+ * file defines BSP_HOST_SIM_SECTION_INIT. */
+#if !defined(BSP_HOST_SIM) || defined(BSP_HOST_SIM_SECTION_INIT)
+#define BSP_PRV_SECTION_INIT                (1)
+#else
+#define BSP_PRV_SECTION_INIT                (0)
+#endif
+
+#if (1 == BSP_CFG_STARTUP_TRACE_ENABLE)
+/*LDRA_INSPECTED 77 S This macro does not work when surrounded by parentheses. */
+#define BSP_PRV_STARTUP_TRACE(phase)    bsp_startup_trace(phase)
+#else
+#define BSP_PRV_STARTUP_TRACE(phase)
+#endif
+
 /***********************************************************************************************************************
 Typedef definitions
 ***********************************************************************************************************************/
+#if !defined(BSP_HOST_SIM) && defined(__GNUC__) && (1 == BSP_CFG_STARTUP_INIT_TABLES_ENABLE)
+/** Entry of the linker generated copy table (__copy_table_start__ to __copy_table_end__), CMSIS layout. */
+typedef struct st_bsp_init_copy
+{
+    uint32_t const * p_source;         ///< Load address of the section
+    uint32_t       * p_dest;           ///< Run address of the section
+    uint32_t         words;            ///< Section size in 32-bit words
+} bsp_init_copy_t;
+
+/** Entry of the linker generated zero table (__zero_table_start__ to __zero_table_end__), CMSIS layout. */
+typedef struct st_bsp_init_zero
+{
+    uint32_t * p_dest;                 ///< Start address of the section
+    uint32_t   words;                  ///< Section size in 32-bit words
+} bsp_init_zero_t;
+#endif
 
 /***********************************************************************************************************************
 Exported global variables (to be accessed by other files)
@@ -57,7 +116,20 @@ Exported global variables (to be accessed by other files)
 uint32_t SystemCoreClock = 0U;  /*!< System Clock Frequency (Core Clock)*/
 /*LDRA_ANALYSIS */
 
-#if defined(__GNUC__)
+#if defined(BSP_HOST_SIM)
+/* The host loader initializes .data and .bss and runs static constructors. */
+#elif defined(__GNUC__) && (1 == BSP_CFG_STARTUP_INIT_TABLES_ENABLE)
+/* Generated by linker. Each RAM region (SRAMHS, SRAM0, standby RAM, ...) adds one entry per section to be copied or
+ * cleared. Sections that are not listed, such as .noinit, are left untouched. */
+/*LDRA_INSPECTED 219 S Linker sections start with underscore. */
+extern bsp_init_copy_t const __copy_table_start__;
+/*LDRA_INSPECTED 219 S Linker sections start with underscore. */
+extern bsp_init_copy_t const __copy_table_end__;
+/*LDRA_INSPECTED 219 S Linker sections start with underscore. */
+extern bsp_init_zero_t const __zero_table_start__;
+/*LDRA_INSPECTED 219 S Linker sections start with underscore. */
+extern bsp_init_zero_t const __zero_table_end__;
+#elif defined(__GNUC__)
 /* Generated by linker. */
 /*LDRA_INSPECTED 219 S Linker sections start with underscore. */
 extern uint32_t __etext;
@@ -76,7 +148,8 @@ extern uint32_t __bss_end__;
 #endif
 
 /* Initialize Static Constructors */
-#if defined(__GNUC__)
+#if defined(BSP_HOST_SIM)
+#elif defined(__GNUC__)
 /*LDRA_INSPECTED 219 S In the GCC compiler, __init_array_start starts with underscore. */
 /*LDRA_INSPECTED 219 S */
 extern void (*__init_array_start []) (void);
@@ -95,8 +168,22 @@ extern const ioport_api_t g_ioport_on_ioport;
 /***********************************************************************************************************************
 Private global variables and functions
 ***********************************************************************************************************************/
+#if !defined(BSP_HOST_SIM)
+static void bsp_ram_init(void);
+#endif
+#if (1 == BSP_PRV_SECTION_INIT)
 static void bsp_section_zero(uint8_t * pstart, uint32_t bytes);
 static void bsp_section_copy(uint8_t * psource, uint8_t * pdest, uint32_t bytes);
+static void bsp_words_zero(uint32_t * p_dest, uint32_t words);
+static void bsp_words_copy(uint32_t const * p_source, uint32_t * p_dest, uint32_t words);
+#if (1 == BSP_CFG_STARTUP_DMAC_ENABLE)
+static void bsp_words_dmac(uint32_t const * p_source, uint32_t * p_dest, uint32_t words, uint32_t source_mode);
+#endif
+#endif
+#if (1 == BSP_CFG_STARTUP_TRACE_ENABLE)
+static void bsp_startup_trace_start(void);
+static void bsp_startup_trace(bsp_startup_phase_t phase);
+#endif
 static void bsp_init_prng(void);
 
 /* ram section to read for prng seed generation */
@@ -105,6 +192,18 @@ static void bsp_init_prng(void);
 /*LDRA_INSPECTED 57 D*/
 static volatile uint64_t bsp_seed BSP_PLACE_IN_SECTION_V2(".noinit");
 
+#if (1 == BSP_CFG_STARTUP_TRACE_ENABLE)
+/* Cycle counter value at the end of each startup phase. Written before the C runtime is initialized, so it must not be
+ * in a section that is cleared or copied. */
+/*LDRA_INSPECTED 219 S*/
+static uint32_t s_bsp_startup_cycles[BSP_STARTUP_PHASE_COUNT] BSP_PLACE_IN_SECTION_V2(".noinit");
+#endif
+
+#if (1 == BSP_PRV_SECTION_INIT) && (1 == BSP_CFG_STARTUP_DMAC_ENABLE)
+/* Source word for clearing sections with the DMAC. */
+static const uint32_t s_bsp_zero_word = 0U;
+#endif
+
 /** Currently this structure is not being used. Eventually it will be tool generated. */
 static const elc_cfg_t g_elc_cfg =
 {
@@ -155,8 +254,14 @@ void SystemInit (void)
     SCB->CPACR |= (uint32_t)CP_MASK;
 #endif
 
+#if (1 == BSP_CFG_STARTUP_TRACE_ENABLE)
+    /* Start the cycle counter used to time the startup phases. */
+    bsp_startup_trace_start();
+#endif
+
     /* Call Pre C runtime initialization hook. */
     R_BSP_WarmStart(BSP_WARM_START_PRE_C);
+    BSP_PRV_STARTUP_TRACE(BSP_STARTUP_PHASE_WARM_START_PRE_C);
 
     /* Initialize register protection. */
     bsp_register_protect_open();
@@ -169,6 +274,7 @@ void SystemInit (void)
 
     /* Configure system clocks using CGC module. */
     bsp_clock_init();
+    BSP_PRV_STARTUP_TRACE(BSP_STARTUP_PHASE_CLOCKS);
 
     /* Temporary fix to initialize ioport reference counter to 0, needed before C runtime init. This will be removed
      * in the next release in favor of a more complete solution. */
@@ -176,41 +282,18 @@ void SystemInit (void)
 
     /* Initialize pins. */
     g_ioport_on_ioport.init(&g_bsp_pin_cfg);
+    BSP_PRV_STARTUP_TRACE(BSP_STARTUP_PHASE_PINS);
 
     /* Initialize C runtime environment. */
-    /* Zero out BSS */
-#if defined(__GNUC__)
-    bsp_section_zero((uint8_t *)&__bss_start__, ((uint32_t)&__bss_end__ - (uint32_t)&__bss_start__));
-#elif defined(__ICCARM__)
-    bsp_section_zero((uint8_t *)__section_begin(".bss"), (uint32_t)__section_size(".bss"));
+#if !defined(BSP_HOST_SIM)
+    bsp_ram_init();
 #endif
-
-    /* Copy initialized RAM data from ROM to RAM. */
-#if defined(__GNUC__)
-    bsp_section_copy((uint8_t *)&__etext,
-                     (uint8_t *)&__data_start__,
-                     ((uint32_t)&__data_end__ - (uint32_t)&__data_start__));
-#elif defined(__ICCARM__)
-    bsp_section_copy((uint8_t *)__section_begin(".data_init"),
-                     (uint8_t *)__section_begin(".data"),
-                     (uint32_t)__section_size(".data"));
-    /* Copy functions to be executed from RAM. */
-    #pragma section=".code_in_ram"
-    #pragma section=".code_in_ram_init"
-    bsp_section_copy((uint8_t *)__section_begin(".code_in_ram_init"),
-                     (uint8_t *)__section_begin(".code_in_ram"),
-                     (uint32_t)__section_size(".code_in_ram"));
-    /* Copy main thread TLS to RAM. */
-    #pragma section="__DLIB_PERTHREAD_init"
-    #pragma section="__DLIB_PERTHREAD"
-    bsp_section_copy((uint8_t *)__section_begin("__DLIB_PERTHREAD_init"),
-                     (uint8_t *)__section_begin("__DLIB_PERTHREAD"),
-                     (uint32_t)__section_size("__DLIB_PERTHREAD_init"));
-#endif
-
+    BSP_PRV_STARTUP_TRACE(BSP_STARTUP_PHASE_C_RUNTIME);
 
 #if defined(__IAR_SYSTEMS_ICC__)
     #pragma section=".stack"
+#elif defined(BSP_HOST_SIM)
+    /* The host stack is not inside the simulated SRAM, monitor the whole SRAM range instead. */
 #elif defined(__GNUC__)
     /*LDRA_INSPECTED 219 S Linker sections start with underscore. */
     extern uint32_t __StackLimit;
@@ -226,6 +309,10 @@ void SystemInit (void)
     R_SPMON->MSPMPUSA = (uint32_t)__section_begin(".stack");   /* Setup start address  */
     R_SPMON->MSPMPUEA = (uint32_t)__section_end(".stack") - 1U;/* Setup end address  */
 
+#elif defined(BSP_HOST_SIM)
+    R_SPMON->MSPMPUSA = (uint32_t)BSP_SIM_SRAM_BASE;           /* Setup start address  */
+    R_SPMON->MSPMPUEA = (uint32_t)(BSP_SIM_SRAM_BASE + BSP_SIM_SRAM_SIZE) - 1U;
+
 #elif defined(__GNUC__)
     R_SPMON->MSPMPUSA = (uint32_t)&__StackLimit;               /* Setup start address  */
     R_SPMON->MSPMPUEA = (uint32_t)&__StackTop - 1U;            /* Setup end address  */
@@ -240,9 +327,11 @@ void SystemInit (void)
 
     /* Call Post C runtime initialization hook. */
     R_BSP_WarmStart(BSP_WARM_START_POST_C);
+    BSP_PRV_STARTUP_TRACE(BSP_STARTUP_PHASE_WARM_START_POST_C);
 
     /* Initialize Static Constructors */
-#if defined(__GNUC__)
+#if defined(BSP_HOST_SIM)
+#elif defined(__GNUC__)
     /*LDRA_INSPECTED 219 S In the GCC compiler, __init_array_start and __init_array_end starts with underscore. */
     /*LDRA_INSPECTED 219 S */
     int32_t count = __init_array_end - __init_array_start;
@@ -255,6 +344,7 @@ void SystemInit (void)
     void const * ilimit = __section_end("SHT$$INIT_ARRAY");
     __call_ctors(pibase, ilimit);
 #endif
+    BSP_PRV_STARTUP_TRACE(BSP_STARTUP_PHASE_CONSTRUCTORS);
 
     /* Initialize the Hardware locks to 'Unlocked' */
     bsp_init_hardware_locks();
@@ -267,10 +357,102 @@ void SystemInit (void)
 
     /* Initialize the libc pseudo random number generator */
     bsp_init_prng();
+    BSP_PRV_STARTUP_TRACE(BSP_STARTUP_PHASE_INTERRUPTS);
 
     /* Call any BSP specific code. No arguments are needed so NULL is sent. */
     bsp_init(NULL);
+    BSP_PRV_STARTUP_TRACE(BSP_STARTUP_PHASE_BSP_INIT);
+}
+
+/*******************************************************************************************************************//**
+ * @brief Get the time spent in a phase of SystemInit().
+ *
+ * The phases are timed with the DWT cycle counter, so the result is in CPU clock cycles. Phases that run before
+ * BSP_STARTUP_PHASE_CLOCKS count cycles of the reset clock.
+ *
+ * @param[in]  phase                Startup phase
+ * @param[out] p_cycles             Cycles spent in the phase
+ *
+ * @retval SSP_SUCCESS              Cycle count stored in p_cycles.
+ * @retval SSP_ERR_ASSERTION        p_cycles is NULL or phase is invalid.
+ * @retval SSP_ERR_UNSUPPORTED      BSP_CFG_STARTUP_TRACE_ENABLE is 0.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_StartupTraceGet (bsp_startup_phase_t phase, uint32_t * p_cycles)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_cycles);
+    SSP_ASSERT(BSP_STARTUP_PHASE_COUNT > phase);
+#endif
+
+#if (1 == BSP_CFG_STARTUP_TRACE_ENABLE)
+    uint32_t start = 0U;
+    if (BSP_STARTUP_PHASE_WARM_START_PRE_C != phase)
+    {
+        start = s_bsp_startup_cycles[phase - 1];
+    }
+
+    *p_cycles = s_bsp_startup_cycles[phase] - start;
+
+    return SSP_SUCCESS;
+#else
+    SSP_PARAMETER_NOT_USED(phase);
+    SSP_PARAMETER_NOT_USED(p_cycles);
+
+    return SSP_ERR_UNSUPPORTED;
+#endif
+}
+
+#if !defined(BSP_HOST_SIM)
+/***********************************************************************************************************************
+* Function Name: bsp_ram_init
+* Description  : Clear and copy the RAM sections used by the C runtime. With BSP_CFG_STARTUP_INIT_TABLES_ENABLE the
+*                sections are taken from the linker generated zero and copy tables, otherwise .bss and .data are used.
+* Arguments    : none
+* Return Value : none
+***********************************************************************************************************************/
+static void bsp_ram_init (void)
+{
+    /* Zero out BSS */
+#if defined(__GNUC__) && (1 == BSP_CFG_STARTUP_INIT_TABLES_ENABLE)
+    for (bsp_init_zero_t const * p_zero = &__zero_table_start__; p_zero < &__zero_table_end__; p_zero++)
+    {
+        bsp_section_zero((uint8_t *) p_zero->p_dest, p_zero->words * 4U);
+    }
+#elif defined(__GNUC__)
+    bsp_section_zero((uint8_t *)&__bss_start__, ((uint32_t)&__bss_end__ - (uint32_t)&__bss_start__));
+#elif defined(__ICCARM__)
+    bsp_section_zero((uint8_t *)__section_begin(".bss"), (uint32_t)__section_size(".bss"));
+#endif
+
+    /* Copy initialized RAM data from ROM to RAM. */
+#if defined(__GNUC__) && (1 == BSP_CFG_STARTUP_INIT_TABLES_ENABLE)
+    for (bsp_init_copy_t const * p_copy = &__copy_table_start__; p_copy < &__copy_table_end__; p_copy++)
+    {
+        bsp_section_copy((uint8_t *) p_copy->p_source, (uint8_t *) p_copy->p_dest, p_copy->words * 4U);
+    }
+#elif defined(__GNUC__)
+    bsp_section_copy((uint8_t *)&__etext,
+                     (uint8_t *)&__data_start__,
+                     ((uint32_t)&__data_end__ - (uint32_t)&__data_start__));
+#elif defined(__ICCARM__)
+    bsp_section_copy((uint8_t *)__section_begin(".data_init"),
+                     (uint8_t *)__section_begin(".data"),
+                     (uint32_t)__section_size(".data"));
+    /* Copy functions to be executed from RAM. */
+    #pragma section=".code_in_ram"
+    #pragma section=".code_in_ram_init"
+    bsp_section_copy((uint8_t *)__section_begin(".code_in_ram_init"),
+                     (uint8_t *)__section_begin(".code_in_ram"),
+                     (uint32_t)__section_size(".code_in_ram"));
+    /* Copy main thread TLS to RAM. */
+    #pragma section="__DLIB_PERTHREAD_init"
+    #pragma section="__DLIB_PERTHREAD"
+    bsp_section_copy((uint8_t *)__section_begin("__DLIB_PERTHREAD_init"),
+                     (uint8_t *)__section_begin("__DLIB_PERTHREAD"),
+                     (uint32_t)__section_size("__DLIB_PERTHREAD_init"));
+#endif
 }
+#endif /* !defined(BSP_HOST_SIM) */
 
 /***********************************************************************************************************************
 * Function Name: bsp_section_zero
@@ -281,18 +463,44 @@ void SystemInit (void)
 *                    Size of section in bytes
 * Return Value : none
 ***********************************************************************************************************************/
+#if (1 == BSP_PRV_SECTION_INIT)
 static void bsp_section_zero (uint8_t * pstart, uint32_t bytes)
 {
+    /* Clear up to the first word boundary. */
+    while ((bytes > 0U) && (0U != ((uint32_t) pstart & 3U)))
+    {
+        *pstart = 0U;
+        pstart++;
+        bytes--;
+    }
+
+    /* Clear whole words. */
+    uint32_t words = bytes >> 2;
+#if (1 == BSP_CFG_STARTUP_DMAC_ENABLE)
+    if (words >= BSP_PRV_STARTUP_DMAC_MIN_WORDS)
+    {
+        bsp_words_dmac(&s_bsp_zero_word, (uint32_t *) pstart, words, BSP_PRV_STARTUP_DMAC_ADDR_FIXED);
+    }
+    else
+#endif
+    {
+        bsp_words_zero((uint32_t *) pstart, words);
+    }
+    pstart += (words << 2);
+    bytes  &= 3U;
+
+    /* Clear the remaining bytes. */
     while (bytes > 0U)
     {
+        *pstart = 0U;
+        pstart++;
         bytes--;
-        pstart[bytes] = 0U;
     }
 }
 
 /***********************************************************************************************************************
 * Function Name: bsp_section_copy
-* Description  : Zero out input section
+* Description  : Copy input section
 * Arguments    : psource -
 *                    Address of where to copy data from
 *                pdest -
@@ -303,13 +511,243 @@ static void bsp_section_zero (uint8_t * pstart, uint32_t bytes)
 ***********************************************************************************************************************/
 static void bsp_section_copy (uint8_t * psource, uint8_t * pdest, uint32_t bytes)
 {
-    uint32_t index;
-    for (index = 0U; index < bytes; index++,pdest++,psource++)
+    /* Word copies are only possible if source and destination have the same alignment. */
+    if (0U == (((uint32_t) psource ^ (uint32_t) pdest) & 3U))
+    {
+        /* Copy up to the first word boundary. */
+        while ((bytes > 0U) && (0U != ((uint32_t) pdest & 3U)))
+        {
+            *pdest = *psource;
+            pdest++;
+            psource++;
+            bytes--;
+        }
+
+        /* Copy whole words. */
+        uint32_t words = bytes >> 2;
+#if (1 == BSP_CFG_STARTUP_DMAC_ENABLE)
+        if (words >= BSP_PRV_STARTUP_DMAC_MIN_WORDS)
+        {
+            bsp_words_dmac((uint32_t const *) psource, (uint32_t *) pdest, words, BSP_PRV_STARTUP_DMAC_ADDR_INCREMENT);
+        }
+        else
+#endif
+        {
+            bsp_words_copy((uint32_t const *) psource, (uint32_t *) pdest, words);
+        }
+        psource += (words << 2);
+        pdest   += (words << 2);
+        bytes   &= 3U;
+    }
+
+    /* Copy the remaining bytes. */
+    while (bytes > 0U)
     {
         *pdest = *psource;
+        pdest++;
+        psource++;
+        bytes--;
     }
 }
 
+/***********************************************************************************************************************
+* Function Name: bsp_words_zero
+* Description  : Clear word aligned memory, four words per store multiple.
+* Arguments    : p_dest -
+*                    Word aligned start address
+*                words -
+*                    Number of words to clear
+* Return Value : none
+***********************************************************************************************************************/
+static void bsp_words_zero (uint32_t * p_dest, uint32_t words)
+{
+    uint32_t bursts = words >> 2;
+#if defined(__GNUC__) && !defined(BSP_HOST_SIM)
+    if (bursts > 0U)
+    {
+        /*LDRA_INSPECTED 17 S Inline assembly makes sure STM is used before the C runtime is initialized. */
+        __asm volatile (
+            "    movs r2, #0             \n"
+            "    movs r3, #0             \n"
+            "    movs r4, #0             \n"
+            "    movs r5, #0             \n"
+            "1:  stmia %0!, {r2-r5}      \n"
+            "    subs %1, %1, #1         \n"
+            "    bne 1b                  \n"
+            : "+r" (p_dest), "+r" (bursts)
+            :
+            : "r2", "r3", "r4", "r5", "cc", "memory");
+    }
+#else
+    while (bursts > 0U)
+    {
+        p_dest[0] = 0U;
+        p_dest[1] = 0U;
+        p_dest[2] = 0U;
+        p_dest[3] = 0U;
+        p_dest += 4;
+        bursts--;
+    }
+#endif
+
+    for (uint32_t i = 0U; i < (words & 3U); i++)
+    {
+        p_dest[i] = 0U;
+    }
+}
+
+/***********************************************************************************************************************
+* Function Name: bsp_words_copy
+* Description  : Copy word aligned memory, four words per load and store multiple.
+* Arguments    : p_source -
+*                    Word aligned address of where to copy data from
+*                p_dest -
+*                    Word aligned address of where to copy data to
+*                words -
+*                    Number of words to copy
+* Return Value : none
+***********************************************************************************************************************/
+static void bsp_words_copy (uint32_t const * p_source, uint32_t * p_dest, uint32_t words)
+{
+    uint32_t bursts = words >> 2;
+#if defined(__GNUC__) && !defined(BSP_HOST_SIM)
+    if (bursts > 0U)
+    {
+        /*LDRA_INSPECTED 17 S Inline assembly makes sure LDM and STM are used before the C runtime is initialized. */
+        __asm volatile (
+            "1:  ldmia %0!, {r2-r5}      \n"
+            "    stmia %1!, {r2-r5}      \n"
+            "    subs %2, %2, #1         \n"
+            "    bne 1b                  \n"
+            : "+r" (p_source), "+r" (p_dest), "+r" (bursts)
+            :
+            : "r2", "r3", "r4", "r5", "cc", "memory");
+    }
+#else
+    while (bursts > 0U)
+    {
+        uint32_t w0 = p_source[0];
+        uint32_t w1 = p_source[1];
+        uint32_t w2 = p_source[2];
+        uint32_t w3 = p_source[3];
+        p_dest[0] = w0;
+        p_dest[1] = w1;
+        p_dest[2] = w2;
+        p_dest[3] = w3;
+        p_source += 4;
+        p_dest   += 4;
+        bursts--;
+    }
+#endif
+
+    for (uint32_t i = 0U; i < (words & 3U); i++)
+    {
+        p_dest[i] = p_source[i];
+    }
+}
+
+#if (1 == BSP_CFG_STARTUP_DMAC_ENABLE)
+/***********************************************************************************************************************
+* Function Name: bsp_words_dmac
+* Description  : Copy or clear word aligned memory with the DMAC channel selected by BSP_CFG_STARTUP_DMAC_CHANNEL.
+*                The channel is started by software and polled, then returned to its reset state so the DMAC driver
+*                can use it later.
+* Arguments    : p_source -
+*                    Word aligned address of where to copy data from
+*                p_dest -
+*                    Word aligned address of where to copy data to
+*                words -
+*                    Number of words to copy
+*                source_mode -
+*                    DMAMD.SM setting, fixed to clear memory or incremented to copy
+* Return Value : none
+***********************************************************************************************************************/
+static void bsp_words_dmac (uint32_t const * p_source, uint32_t * p_dest, uint32_t words, uint32_t source_mode)
+{
+    R_DMAC0_Type * p_dmac = (R_DMAC0_Type *) (R_DMAC0_BASE +
+                                              (BSP_PRV_STARTUP_DMAC_CHANNEL_SIZE * BSP_CFG_STARTUP_DMAC_CHANNEL));
+
+    R_DMA->DMAST_b.DMST = 1U;
+
+    /* Normal mode, 4 byte units, software start. */
+    p_dmac->DMCNT        = 0U;
+    p_dmac->DMTMD        = 0U;
+    p_dmac->DMTMD_b.SZ   = BSP_PRV_STARTUP_DMAC_SIZE_4_BYTE;
+    p_dmac->DMAMD        = 0U;
+    p_dmac->DMAMD_b.SM   = (uint16_t) source_mode;
+    p_dmac->DMAMD_b.DM   = BSP_PRV_STARTUP_DMAC_ADDR_INCREMENT;
+    p_dmac->DMINT        = 0U;
+
+    while (words > 0U)
+    {
+        uint32_t count = words;
+        if (count > BSP_PRV_STARTUP_DMAC_MAX_WORDS)
+        {
+            count = BSP_PRV_STARTUP_DMAC_MAX_WORDS;
+        }
+
+        p_dmac->DMSAR = (uint32_t) p_source;
+        p_dmac->DMDAR = (uint32_t) p_dest;
+        p_dmac->DMCRA = count;
+        p_dmac->DMCNT_b.DTE = 1U;
+
+        /* Keep the request asserted until the whole count is transferred. */
+        p_dmac->DMREQ = 0U;
+        p_dmac->DMREQ_b.CLRS  = 1U;
+        p_dmac->DMREQ_b.SWREQ = 1U;
+        while (0U != p_dmac->DMCNT_b.DTE)
+        {
+            /* Wait for the transfer to complete. */
+        }
+
+        if (BSP_PRV_STARTUP_DMAC_ADDR_FIXED != source_mode)
+        {
+            p_source += count;
+        }
+        p_dest += count;
+        words  -= count;
+    }
+
+    /* Return the channel to its reset state. */
+    p_dmac->DMREQ = 0U;
+    p_dmac->DMSTS = 0U;
+    p_dmac->DMTMD = 0U;
+    p_dmac->DMAMD = 0U;
+    p_dmac->DMSAR = 0U;
+    p_dmac->DMDAR = 0U;
+    p_dmac->DMCRA = 0U;
+    R_DMA->DMAST_b.DMST = 0U;
+}
+#endif /* (1 == BSP_CFG_STARTUP_DMAC_ENABLE) */
+#endif /* (1 == BSP_PRV_SECTION_INIT) */
+
+#if (1 == BSP_CFG_STARTUP_TRACE_ENABLE)
+/***********************************************************************************************************************
+* Function Name: bsp_startup_trace_start
+* Description  : Reset and enable the DWT cycle counter used to time the startup phases.
+* Arguments    : none
+* Return Value : none
+***********************************************************************************************************************/
+static void bsp_startup_trace_start (void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT       = 0U;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/***********************************************************************************************************************
+* Function Name: bsp_startup_trace
+* Description  : Record the end of a startup phase.
+* Arguments    : phase -
+*                    Phase that just completed
+* Return Value : none
+***********************************************************************************************************************/
+static void bsp_startup_trace (bsp_startup_phase_t phase)
+{
+    s_bsp_startup_cycles[phase] = DWT->CYCCNT;
+}
+#endif /* (1 == BSP_CFG_STARTUP_TRACE_ENABLE) */
+
 /***********************************************************************************************************************
 * Function Name: R_BSP_WarmStart
 * Description  : This function is called at various points during the startup process. This function is declared as a
@@ -0,0 +1,224 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+/***********************************************************************************************************************
+* File Name    : bsp_atomic.h
+* Description  : Lock-free counters and tagged free lists shared by the BSP modules.
+***********************************************************************************************************************/
+
+#ifndef BSP_ATOMIC_H_
+#define BSP_ATOMIC_H_
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+
+/* Common macro for SSP header files. There is also a corresponding SSP_FOOTER macro at the end of this file. */
+SSP_HEADER
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+/* Cores with exclusive load and store instructions update shared state without masking interrupts. Other cores use a
+ * critical section. */
+#if (__CORTEX_M >= 3U)
+#define BSP_ATOMIC_EXCLUSIVE
+#endif
+
+/* Return value of the store-exclusive instruction when the store was performed. */
+#define BSP_ATOMIC_STREX_SUCCESS        (0x00000000U)
+
+/* A list head holds the 1-based index of the first element in the lower 16 bits, 0 if the list is empty. The upper
+ * 16 bits count updates so a head that was popped and pushed back is not mistaken for the old one. */
+#define BSP_ATOMIC_INDEX_MASK           (0x0000FFFFU)
+#define BSP_ATOMIC_TAG_INCREMENT        (0x00010000U)
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Exported global variables
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Inline functions
+***********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Atomically add to a counter. Subtract by adding the two's complement.
+ *
+ * @param[in]  p_counter           Counter to update
+ * @param[in]  value               Value to add
+ *
+ * @return Counter value after the update.
+ **********************************************************************************************************************/
+__STATIC_INLINE uint32_t bsp_atomic_add (volatile uint32_t * p_counter, uint32_t value)
+{
+    uint32_t result;
+
+#if defined(BSP_ATOMIC_EXCLUSIVE)
+    do
+    {
+        result = __LDREXW(p_counter) + value;
+    } while (BSP_ATOMIC_STREX_SUCCESS != __STREXW(result, p_counter));
+#else
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    result     = *p_counter + value;
+    *p_counter = result;
+    SSP_CRITICAL_SECTION_EXIT;
+#endif
+
+    return result;
+}
+
+/*******************************************************************************************************************//**
+ * Atomically raise a high-water mark.
+ *
+ * @param[in]  p_max               High-water mark to update
+ * @param[in]  value               New value, stored if larger than the current mark
+ **********************************************************************************************************************/
+__STATIC_INLINE void bsp_atomic_max (volatile uint32_t * p_max, uint32_t value)
+{
+#if defined(BSP_ATOMIC_EXCLUSIVE)
+    do
+    {
+        if (__LDREXW(p_max) >= value)
+        {
+            __CLREX();
+            break;
+        }
+    } while (BSP_ATOMIC_STREX_SUCCESS != __STREXW(value, p_max));
+#else
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    if (*p_max < value)
+    {
+        *p_max = value;
+    }
+    SSP_CRITICAL_SECTION_EXIT;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Address of the link word of a list element. Element i + 1 keeps its link at p_links + i * stride.
+ *
+ * @param[in]  p_links             Link word of the first element
+ * @param[in]  stride              Distance between the link words of two elements in bytes
+ * @param[in]  index               1-based index of the element
+ *
+ * @return Link word of the element.
+ **********************************************************************************************************************/
+__STATIC_INLINE volatile uint32_t * bsp_atomic_link (void volatile * p_links, uint32_t stride, uint32_t index)
+{
+    return (volatile uint32_t *) ((uint8_t volatile *) p_links + ((index - 1U) * stride));
+}
+
+/*******************************************************************************************************************//**
+ * Remove the first element from a tagged list. Any number of contexts can pop and push at the same time.
+ *
+ * @param[in]  p_head              Update tag and first element of the list
+ * @param[in]  p_links             Link word of the first element
+ * @param[in]  stride              Distance between the link words of two elements in bytes
+ *
+ * @return 1-based index of the element, 0 if the list is empty.
+ **********************************************************************************************************************/
+__STATIC_INLINE uint32_t bsp_atomic_list_pop (volatile uint32_t * p_head, void volatile * p_links, uint32_t stride)
+{
+    uint32_t index;
+
+#if defined(BSP_ATOMIC_EXCLUSIVE)
+    uint32_t head;
+    uint32_t next;
+    do
+    {
+        head  = __LDREXW(p_head);
+        index = head & BSP_ATOMIC_INDEX_MASK;
+        if (0U == index)
+        {
+            __CLREX();
+            break;
+        }
+
+        /* The link may be overwritten if another context takes the element first. The head changes in that case, so
+         * the store-exclusive fails and the link is read again. */
+        next = *bsp_atomic_link(p_links, stride, index);
+    } while (BSP_ATOMIC_STREX_SUCCESS !=
+             __STREXW(((head + BSP_ATOMIC_TAG_INCREMENT) & ~BSP_ATOMIC_INDEX_MASK) | next, p_head));
+#else
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    index = *p_head & BSP_ATOMIC_INDEX_MASK;
+    if (0U != index)
+    {
+        *p_head = *bsp_atomic_link(p_links, stride, index);
+    }
+    SSP_CRITICAL_SECTION_EXIT;
+#endif
+
+    return index;
+}
+
+/*******************************************************************************************************************//**
+ * Add an element to the front of a tagged list.
+ *
+ * @param[in]  p_head              Update tag and first element of the list
+ * @param[in]  p_links             Link word of the first element
+ * @param[in]  stride              Distance between the link words of two elements in bytes
+ * @param[in]  index               1-based index of the element
+ **********************************************************************************************************************/
+__STATIC_INLINE void bsp_atomic_list_push (volatile uint32_t * p_head, void volatile * p_links, uint32_t stride,
+                                           uint32_t index)
+{
+    volatile uint32_t * p_link = bsp_atomic_link(p_links, stride, index);
+
+#if defined(BSP_ATOMIC_EXCLUSIVE)
+    uint32_t head;
+    bool     retry;
+    do
+    {
+        /* Link the element before the exclusive access so no other store is made between the load-exclusive and the
+         * store-exclusive. */
+        head    = *p_head;
+        *p_link = head & BSP_ATOMIC_INDEX_MASK;
+
+        retry = true;
+        if (head == __LDREXW(p_head))
+        {
+            retry = (BSP_ATOMIC_STREX_SUCCESS !=
+                     __STREXW(((head + BSP_ATOMIC_TAG_INCREMENT) & ~BSP_ATOMIC_INDEX_MASK) | index, p_head));
+        }
+        else
+        {
+            __CLREX();
+        }
+    } while (retry);
+#else
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    *p_link = *p_head & BSP_ATOMIC_INDEX_MASK;
+    *p_head = index;
+    SSP_CRITICAL_SECTION_EXIT;
+#endif
+}
+
+/* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
+SSP_FOOTER
+
+#endif /* BSP_ATOMIC_H_ */
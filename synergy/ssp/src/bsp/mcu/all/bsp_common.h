@@ -62,14 +62,28 @@ Macro definitions
 #define BSP_API_VERSION_MAJOR       (2U)
 #define BSP_API_VERSION_MINOR       (0U)
 
+#ifndef BSP_CFG_ISR_TRACE_ENABLE
+#define BSP_CFG_ISR_TRACE_ENABLE    (0)
+#endif
+
+/* ISR timing hooks, see R_BSP_IsrTraceReport(). Define BSP_ISR_TRACE_DISABLE before including bsp_api.h to leave the
+ * ISRs of one module untimed. */
+#if (1 == BSP_CFG_ISR_TRACE_ENABLE) && !defined(BSP_ISR_TRACE_DISABLE)
+#define BSP_ISR_TRACE_ENTER bsp_isr_trace_enter();
+#define BSP_ISR_TRACE_EXIT  bsp_isr_trace_exit();
+#else
+#define BSP_ISR_TRACE_ENTER
+#define BSP_ISR_TRACE_EXIT
+#endif
+
 #if 1 == BSP_CFG_RTOS
-#define SF_CONTEXT_SAVE    tx_isr_start(__get_IPSR());
-#define SF_CONTEXT_RESTORE tx_isr_end(__get_IPSR());
+#define SF_CONTEXT_SAVE    tx_isr_start(__get_IPSR()); BSP_ISR_TRACE_ENTER
+#define SF_CONTEXT_RESTORE BSP_ISR_TRACE_EXIT tx_isr_end(__get_IPSR());
 void  tx_isr_start(unsigned long isr_id);
 void  tx_isr_end(unsigned long isr_id);
 #else
-#define SF_CONTEXT_SAVE
-#define SF_CONTEXT_RESTORE
+#define SF_CONTEXT_SAVE    BSP_ISR_TRACE_ENTER
+#define SF_CONTEXT_RESTORE BSP_ISR_TRACE_EXIT
 #endif
 
 /** Function call to insert before returning assertion error. */
@@ -186,6 +200,20 @@ typedef enum e_bsp_warm_start_event
     BSP_WARM_START_POST_C       ///< Called after clocks and C runtime environment have been setup
 } bsp_warm_start_event_t;
 
+/** Phases of SystemInit() timed when BSP_CFG_STARTUP_TRACE_ENABLE is 1. See R_BSP_StartupTraceGet(). */
+typedef enum e_bsp_startup_phase
+{
+    BSP_STARTUP_PHASE_WARM_START_PRE_C = 0,  ///< Pre C runtime warm start hook
+    BSP_STARTUP_PHASE_CLOCKS,                ///< Register protection, group interrupts, FMI and clock setup
+    BSP_STARTUP_PHASE_PINS,                  ///< Pin configuration
+    BSP_STARTUP_PHASE_C_RUNTIME,             ///< Clearing and copying RAM sections
+    BSP_STARTUP_PHASE_WARM_START_POST_C,     ///< Stack monitor setup and post C runtime warm start hook
+    BSP_STARTUP_PHASE_CONSTRUCTORS,          ///< Static constructors
+    BSP_STARTUP_PHASE_INTERRUPTS,            ///< Hardware locks, interrupt and ELC setup, PRNG seed
+    BSP_STARTUP_PHASE_BSP_INIT,              ///< Board specific initialization
+    BSP_STARTUP_PHASE_COUNT                  ///< Number of startup phases
+} bsp_startup_phase_t;
+
 /***********************************************************************************************************************
 Exported global variables
 ***********************************************************************************************************************/
@@ -198,6 +226,10 @@ Exported global functions (to be accessed by other files)
 void ssp_error_log(ssp_err_t err, const char * module, int32_t line);
 #endif
 
+ssp_err_t R_BSP_StartupTraceGet(bsp_startup_phase_t phase, uint32_t * p_cycles);
+void      bsp_isr_trace_enter(void);
+void      bsp_isr_trace_exit(void);
+
 /** In the event of an unrecoverable error the BSP will by default call the __BKPT() intrinsic function which will
  *  alert the user of the error. The user can override this default behavior by defining their own
  *  BSP_CFG_HANDLE_UNRECOVERABLE_ERROR macro.
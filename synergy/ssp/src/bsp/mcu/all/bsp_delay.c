@@ -31,7 +31,9 @@ Macro definitions
 ***********************************************************************************************************************/
 #define DELAY_LOOP_CYCLES 4     ///< 4 cycles per loop.
 
-#if defined(__ICCARM__)
+#if defined(BSP_HOST_SIM)
+#define BSP_ATTRIBUTE_STACKLESS __attribute__((noinline))
+#elif defined(__ICCARM__)
 #define BSP_ATTRIBUTE_STACKLESS __stackless
 #elif defined(__GNUC__)
 /*LDRA_INSPECTED 293 S */
@@ -89,6 +91,9 @@ static void software_delay_loop (uint32_t loop_cnt);
 *       that the BSP has already initialized the CGC (which it does as part of the Sysinit).
 *       Care should be taken to ensure this remains the case if in the future this function were to be called as part
 *       of the BSP initialization.
+*
+* @note Once the timer service is open (R_BSP_TimerServiceOpen()), the delay is measured on its timestamp and the
+*       CPU sleeps during the delay when called from a thread with interrupts enabled.
 * @retval        None.
 ***********************************************************************************************************************/
 
@@ -100,6 +105,17 @@ void R_BSP_SoftwareDelay(uint32_t delay, bsp_delay_units_t units)
     uint32_t loops_required = 0;
     uint32_t total_us = (delay * units);  /** Convert the requested time to microseconds. */
     uint64_t ns_64bits;
+    uint64_t now;
+    uint64_t counts;
+
+    /** Wait on the timer service when it is open. */
+    if ((SSP_SUCCESS == R_BSP_TimestampGet(&now)) && (SSP_SUCCESS == R_BSP_TimerCountsGet(delay, units, &counts)))
+    {
+        if (SSP_SUCCESS == R_BSP_TimerWaitUntil(now + counts, NULL, NULL, 0U))
+        {
+            return;
+        }
+    }
 
     iclk_hz = bsp_cpu_clock_get();        /** Get the system clock frequency in Hz. */
 
@@ -159,6 +175,14 @@ void R_BSP_SoftwareDelay(uint32_t delay, bsp_delay_units_t units)
 ***********************************************************************************************************************/
 BSP_ATTRIBUTE_STACKLESS static void software_delay_loop (uint32_t loop_cnt)
 {
+#if defined(BSP_HOST_SIM)
+    /* Host simulation: the loop count is kept so delays scale with the configured clock, timing is not modeled. */
+    volatile uint32_t count = loop_cnt;
+    while (count > 0U)
+    {
+        count--;
+    }
+#else
         __asm volatile ("sw_delay_loop:         \n"
 
 #if defined(__ICCARM__)
@@ -178,6 +202,7 @@ BSP_ATTRIBUTE_STACKLESS static void software_delay_loop (uint32_t loop_cnt)
 
     /** loop_cnt is used but since it is used in assembly an unused parameter warning can be generated. */
     SSP_PARAMETER_NOT_USED(loop_cnt);
+#endif
 }
 
 /** @} (end addtogroup BSP_MCU_COMMON) */
@@ -0,0 +1,416 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+/***********************************************************************************************************************
+* File Name    : bsp_isr_trace.c
+* Description  : Times SSP interrupt service routines and reports per interrupt statistics.
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#if defined(BSP_HOST_SIM)
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <time.h>
+#endif
+#include <string.h>
+#include "bsp_api.h"
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+/* Deepest ISR nesting that is timed. Each NVIC priority level can add one level. */
+#define BSP_PRV_ISR_TRACE_NEST_MAX      (16U)
+
+/* Longest report line: 9 fields of up to 10 digits with their keys and 12 histogram bins. */
+#define BSP_PRV_ISR_TRACE_LINE_MAX      (256U)
+
+#if defined(BSP_HOST_SIM)
+#define BSP_PRV_ISR_TRACE_TIME_UNIT     "ns"
+#else
+#define BSP_PRV_ISR_TRACE_TIME_UNIT     "cycles"
+#endif
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+/** An ISR in progress. */
+typedef struct st_bsp_isr_trace_frame
+{
+    IRQn_Type  irq;                    ///< Interrupt being serviced
+    uint32_t   start;                  ///< Time stamp at entry
+    uint32_t   nested;                 ///< Time spent in traced ISRs that preempted this one
+} bsp_isr_trace_frame_t;
+
+/***********************************************************************************************************************
+Private function prototypes
+***********************************************************************************************************************/
+#if (1 == BSP_CFG_ISR_TRACE_ENABLE)
+static uint32_t bsp_isr_trace_now(void);
+static void     bsp_isr_trace_record(bsp_isr_trace_stats_t * p_stats, uint32_t time);
+static uint32_t bsp_isr_trace_text_append(char * p_line, uint32_t length, char const * p_text);
+static uint32_t bsp_isr_trace_number_append(char * p_line, uint32_t length, char const * p_key, uint32_t value);
+#endif
+
+/***********************************************************************************************************************
+Exported global variables (to be accessed by other files)
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Private global variables and functions
+***********************************************************************************************************************/
+#if (1 == BSP_CFG_ISR_TRACE_ENABLE)
+/** Statistics indexed by IRQ number. */
+static bsp_isr_trace_stats_t g_bsp_isr_trace_stats[BSP_VECTOR_TABLE_MAX_ENTRIES];
+
+/** ISRs in progress, innermost last. */
+static bsp_isr_trace_frame_t g_bsp_isr_trace_stack[BSP_PRV_ISR_TRACE_NEST_MAX];
+
+/** Number of ISRs in progress. */
+static uint32_t g_bsp_isr_trace_depth = 0U;
+#endif
+
+/*******************************************************************************************************************//**
+ * @addtogroup BSP_MCU_ISR_TRACE
+ *
+ * @{
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @brief Clear the statistics of all interrupts and start the time base.
+ *
+ * Call once before the interrupts of interest are enabled. On the target this enables the DWT cycle counter.
+ *
+ * @retval SSP_SUCCESS             Statistics cleared.
+ * @retval SSP_ERR_UNSUPPORTED     BSP_CFG_ISR_TRACE_ENABLE is 0.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_IsrTraceReset (void)
+{
+#if (1 == BSP_CFG_ISR_TRACE_ENABLE)
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    memset(&g_bsp_isr_trace_stats[0], 0, sizeof(g_bsp_isr_trace_stats));
+
+#if !defined(BSP_HOST_SIM)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+    __set_PRIMASK(primask);
+
+    return SSP_SUCCESS;
+#else
+    return SSP_ERR_UNSUPPORTED;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * @brief Get the statistics of one interrupt.
+ *
+ * @param[in]  irq                 IRQ number
+ * @param[out] p_stats             Statistics of the interrupt
+ *
+ * @retval SSP_SUCCESS             Statistics stored in p_stats.
+ * @retval SSP_ERR_ASSERTION       p_stats is NULL.
+ * @retval SSP_ERR_INVALID_ARGUMENT irq is not a peripheral interrupt.
+ * @retval SSP_ERR_UNSUPPORTED     BSP_CFG_ISR_TRACE_ENABLE is 0.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_IsrTraceGet (IRQn_Type irq, bsp_isr_trace_stats_t * p_stats)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_stats);
+#endif
+
+#if (1 == BSP_CFG_ISR_TRACE_ENABLE)
+    if ((irq < (IRQn_Type) 0) || ((uint32_t) irq >= BSP_VECTOR_TABLE_MAX_ENTRIES))
+    {
+        return SSP_ERR_INVALID_ARGUMENT;
+    }
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    *p_stats = g_bsp_isr_trace_stats[irq];
+    __set_PRIMASK(primask);
+
+    return SSP_SUCCESS;
+#else
+    SSP_PARAMETER_NOT_USED(irq);
+    SSP_PARAMETER_NOT_USED(p_stats);
+
+    return SSP_ERR_UNSUPPORTED;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * @brief Write the statistics of all interrupts that ran as text.
+ *
+ * The first line names the time unit and the histogram layout. It is followed by one line per interrupt:
+ *
+ *     isr_trace time=cycles shift=4 bins=12
+ *     irq=3 ip=18 unit=0 ch=1 sig=0 count=1033 min=210 max=980 mean=305 hist=0,0,0,0,512,490,31,0,0,0,0,0
+ *
+ * ip, unit, ch and sig identify the peripheral signal from the vector information. Each line ends with CR LF. The
+ * output function can send it to a UART (it must copy or finish sending the text before it returns) or to SWO with
+ * R_BSP_IsrTraceSwoWrite().
+ *
+ * @param[in]  p_write             Output function, called once per line
+ * @param[in]  p_context           Passed to p_write
+ *
+ * @retval SSP_SUCCESS             Report written.
+ * @retval SSP_ERR_ASSERTION       p_write is NULL.
+ * @retval SSP_ERR_UNSUPPORTED     BSP_CFG_ISR_TRACE_ENABLE is 0.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_IsrTraceReport (bsp_isr_trace_write_t p_write, void * p_context)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_write);
+#endif
+
+#if (1 == BSP_CFG_ISR_TRACE_ENABLE)
+    extern uint32_t g_vector_information_size;
+    char     line[BSP_PRV_ISR_TRACE_LINE_MAX];
+    uint32_t length;
+
+    length = bsp_isr_trace_text_append(line, 0U, "isr_trace time=" BSP_PRV_ISR_TRACE_TIME_UNIT);
+    length = bsp_isr_trace_number_append(line, length, " shift=", BSP_ISR_TRACE_HISTOGRAM_SHIFT);
+    length = bsp_isr_trace_number_append(line, length, " bins=", BSP_ISR_TRACE_HISTOGRAM_BINS);
+    length = bsp_isr_trace_text_append(line, length, "\r\n");
+    p_write(line, length, p_context);
+
+    for (uint32_t irq = 0U; irq < BSP_VECTOR_TABLE_MAX_ENTRIES; irq++)
+    {
+        bsp_isr_trace_stats_t stats;
+        (void) R_BSP_IsrTraceGet((IRQn_Type) irq, &stats);
+        if (0U == stats.count)
+        {
+            continue;
+        }
+
+        length = bsp_isr_trace_number_append(line, 0U, "irq=", irq);
+        if (irq < g_vector_information_size)
+        {
+            ssp_vector_info_t * p_vector_info = NULL;
+            R_SSP_VectorInfoGet((IRQn_Type) irq, &p_vector_info);
+            length = bsp_isr_trace_number_append(line, length, " ip=", p_vector_info->ip_id);
+            length = bsp_isr_trace_number_append(line, length, " unit=", p_vector_info->ip_unit);
+            length = bsp_isr_trace_number_append(line, length, " ch=", p_vector_info->ip_channel);
+            length = bsp_isr_trace_number_append(line, length, " sig=", p_vector_info->ip_signal);
+        }
+        length = bsp_isr_trace_number_append(line, length, " count=", stats.count);
+        length = bsp_isr_trace_number_append(line, length, " min=", stats.min);
+        length = bsp_isr_trace_number_append(line, length, " max=", stats.max);
+        length = bsp_isr_trace_number_append(line, length, " mean=", (uint32_t) (stats.total / stats.count));
+        for (uint32_t bin = 0U; bin < BSP_ISR_TRACE_HISTOGRAM_BINS; bin++)
+        {
+            length = bsp_isr_trace_number_append(line, length, (0U == bin) ? " hist=" : ",", stats.histogram[bin]);
+        }
+        length = bsp_isr_trace_text_append(line, length, "\r\n");
+        p_write(line, length, p_context);
+    }
+
+    return SSP_SUCCESS;
+#else
+    SSP_PARAMETER_NOT_USED(p_write);
+    SSP_PARAMETER_NOT_USED(p_context);
+
+    return SSP_ERR_UNSUPPORTED;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * @brief Output function for R_BSP_IsrTraceReport() that writes to ITM stimulus port 0 (SWO).
+ *
+ * Characters are dropped if the ITM or port 0 is not enabled, for example when no debugger is attached.
+ *
+ * @param[in]  p_text              Text to write
+ * @param[in]  length              Number of characters
+ * @param[in]  p_context           Not used
+ **********************************************************************************************************************/
+void R_BSP_IsrTraceSwoWrite (char const * p_text, uint32_t length, void * p_context)
+{
+    SSP_PARAMETER_NOT_USED(p_context);
+
+    for (uint32_t i = 0U; i < length; i++)
+    {
+        (void) ITM_SendChar((uint32_t) (uint8_t) p_text[i]);
+    }
+}
+
+/** @} (end addtogroup BSP_MCU_ISR_TRACE) */
+
+#if (1 == BSP_CFG_ISR_TRACE_ENABLE)
+/*******************************************************************************************************************//**
+ * Start timing the current ISR. Called by SF_CONTEXT_SAVE.
+ **********************************************************************************************************************/
+void bsp_isr_trace_enter (void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    uint32_t depth = g_bsp_isr_trace_depth;
+    if (depth < BSP_PRV_ISR_TRACE_NEST_MAX)
+    {
+        bsp_isr_trace_frame_t * p_frame = &g_bsp_isr_trace_stack[depth];
+        p_frame->irq    = R_SSP_CurrentIrqGet();
+        p_frame->nested = 0U;
+        p_frame->start  = bsp_isr_trace_now();
+    }
+    g_bsp_isr_trace_depth = depth + 1U;
+
+    __set_PRIMASK(primask);
+}
+
+/*******************************************************************************************************************//**
+ * Stop timing the current ISR and add its time to the statistics. Called by SF_CONTEXT_RESTORE.
+ **********************************************************************************************************************/
+void bsp_isr_trace_exit (void)
+{
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    uint32_t now   = bsp_isr_trace_now();
+    uint32_t depth = g_bsp_isr_trace_depth;
+    if (depth > 0U)
+    {
+        depth--;
+        g_bsp_isr_trace_depth = depth;
+
+        if (depth < BSP_PRV_ISR_TRACE_NEST_MAX)
+        {
+            bsp_isr_trace_frame_t * p_frame = &g_bsp_isr_trace_stack[depth];
+            uint32_t                elapsed = now - p_frame->start;
+
+            /* Charge the whole time to the preempted ISR as nested time, this ISR only gets its own time. */
+            if (depth > 0U)
+            {
+                g_bsp_isr_trace_stack[depth - 1U].nested += elapsed;
+            }
+
+            if ((p_frame->irq >= (IRQn_Type) 0) && ((uint32_t) p_frame->irq < BSP_VECTOR_TABLE_MAX_ENTRIES))
+            {
+                bsp_isr_trace_record(&g_bsp_isr_trace_stats[p_frame->irq], elapsed - p_frame->nested);
+            }
+        }
+    }
+
+    __set_PRIMASK(primask);
+}
+
+/*******************************************************************************************************************//**
+ * Read the time base.
+ *
+ * @return CPU cycles on the target, nanoseconds on host builds.
+ **********************************************************************************************************************/
+static uint32_t bsp_isr_trace_now (void)
+{
+#if defined(BSP_HOST_SIM)
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint32_t) (((uint64_t) now.tv_sec * 1000000000ULL) + (uint64_t) now.tv_nsec);
+#else
+    return DWT->CYCCNT;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Add one ISR time to the statistics of an interrupt.
+ *
+ * @param[in]  p_stats             Statistics of the interrupt
+ * @param[in]  time                ISR time
+ **********************************************************************************************************************/
+static void bsp_isr_trace_record (bsp_isr_trace_stats_t * p_stats, uint32_t time)
+{
+    if ((0U == p_stats->count) || (time < p_stats->min))
+    {
+        p_stats->min = time;
+    }
+    if (time > p_stats->max)
+    {
+        p_stats->max = time;
+    }
+    p_stats->count++;
+    p_stats->total += time;
+
+    /* The bin is the bit length of the scaled time, so each bin doubles the range of the previous one. */
+    uint32_t bin = 32U - (uint32_t) __CLZ(time >> BSP_ISR_TRACE_HISTOGRAM_SHIFT);
+    if (bin >= BSP_ISR_TRACE_HISTOGRAM_BINS)
+    {
+        bin = BSP_ISR_TRACE_HISTOGRAM_BINS - 1U;
+    }
+    p_stats->histogram[bin]++;
+}
+
+/*******************************************************************************************************************//**
+ * Append text to a report line.
+ *
+ * @param[in]  p_line              Report line
+ * @param[in]  length              Current length of the line
+ * @param[in]  p_text              Text to append
+ *
+ * @return New length of the line.
+ **********************************************************************************************************************/
+static uint32_t bsp_isr_trace_text_append (char * p_line, uint32_t length, char const * p_text)
+{
+    while (('\0' != *p_text) && (length < BSP_PRV_ISR_TRACE_LINE_MAX))
+    {
+        p_line[length] = *p_text;
+        length++;
+        p_text++;
+    }
+
+    return length;
+}
+
+/*******************************************************************************************************************//**
+ * Append a key and a decimal number to a report line.
+ *
+ * @param[in]  p_line              Report line
+ * @param[in]  length              Current length of the line
+ * @param[in]  p_key               Text before the number
+ * @param[in]  value               Number to append
+ *
+ * @return New length of the line.
+ **********************************************************************************************************************/
+static uint32_t bsp_isr_trace_number_append (char * p_line, uint32_t length, char const * p_key, uint32_t value)
+{
+    char     digits[10];
+    uint32_t count = 0U;
+
+    length = bsp_isr_trace_text_append(p_line, length, p_key);
+
+    do
+    {
+        digits[count] = (char) ('0' + (value % 10U));
+        value        /= 10U;
+        count++;
+    } while (0U != value);
+
+    while ((count > 0U) && (length < BSP_PRV_ISR_TRACE_LINE_MAX))
+    {
+        count--;
+        p_line[length] = digits[count];
+        length++;
+    }
+
+    return length;
+}
+#endif /* (1 == BSP_CFG_ISR_TRACE_ENABLE) */
@@ -0,0 +1,82 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+/***********************************************************************************************************************
+* File Name    : bsp_isr_trace.h
+* Description  : Interrupt service routine timing implemented by the BSP.
+***********************************************************************************************************************/
+
+#ifndef BSP_ISR_TRACE_H_
+#define BSP_ISR_TRACE_H_
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+
+/* Common macro for SSP header files. There is also a corresponding SSP_FOOTER macro at the end of this file. */
+SSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @ingroup BSP_MCU_COMMON
+ * @defgroup BSP_MCU_ISR_TRACE ISR Trace
+ * @brief Per interrupt timing statistics
+ *
+ * With BSP_CFG_ISR_TRACE_ENABLE set to 1, SF_CONTEXT_SAVE and SF_CONTEXT_RESTORE time every SSP interrupt service
+ * routine. A module is left out by defining BSP_ISR_TRACE_DISABLE when compiling it. The time of an ISR excludes the
+ * time spent in traced ISRs that preempted it. On the target the time is in CPU cycles from the DWT cycle counter, on
+ * host builds it is in nanoseconds from the monotonic clock.
+ *
+ * @{
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+#define BSP_ISR_TRACE_HISTOGRAM_BINS     (12U) ///< Number of histogram bins
+#define BSP_ISR_TRACE_HISTOGRAM_SHIFT    (4U)  ///< Bin 0 counts times below 1 << shift, bin n below 1 << (shift + n)
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+/** Timing statistics of one interrupt. */
+typedef struct st_bsp_isr_trace_stats
+{
+    uint32_t  count;                                   ///< Number of completed ISR calls
+    uint32_t  min;                                     ///< Shortest ISR time
+    uint32_t  max;                                     ///< Longest ISR time
+    uint64_t  total;                                   ///< Sum of all ISR times, divide by count for the mean
+    uint32_t  histogram[BSP_ISR_TRACE_HISTOGRAM_BINS]; ///< ISR calls per power of two time range
+} bsp_isr_trace_stats_t;
+
+/** Output function for R_BSP_IsrTraceReport(). Called once per line. The text is not valid after the call returns. */
+typedef void (* bsp_isr_trace_write_t)(char const * p_text, uint32_t length, void * p_context);
+
+/***********************************************************************************************************************
+Exported global variables
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Exported global functions (to be accessed by other files)
+***********************************************************************************************************************/
+
+/** @} (end defgroup BSP_MCU_ISR_TRACE) */
+
+/* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
+SSP_FOOTER
+
+#endif /* BSP_ISR_TRACE_H_ */
@@ -46,6 +46,35 @@ ssp_err_t   R_BSP_ModuleStateGet(ssp_feature_t const * const p_feature, bool * c
 ssp_err_t   R_BSP_VersionGet(ssp_version_t * p_version);
 ssp_err_t   R_BSP_CacheOff(bsp_cache_state_t * p_state);
 ssp_err_t   R_BSP_CacheSet(bsp_cache_state_t state);
+ssp_err_t   R_BSP_PoolOpen(bsp_pool_t * p_pool, bsp_pool_cfg_t const * p_cfg);
+ssp_err_t   R_BSP_PoolAlloc(bsp_pool_t * p_pool, uint32_t bytes, void ** pp_block);
+ssp_err_t   R_BSP_PoolFree(bsp_pool_t * p_pool, void * p_block);
+ssp_err_t   R_BSP_PoolBlockSizeGet(bsp_pool_t * p_pool, void const * p_block, uint32_t * p_bytes);
+ssp_err_t   R_BSP_PoolStatsGet(bsp_pool_t * p_pool, uint32_t class_index, bsp_pool_stats_t * p_stats);
+ssp_err_t   R_BSP_PoolMallocSet(bsp_pool_t * p_pool);
+ssp_err_t   R_BSP_WorkPost(bsp_work_function_t p_function, void * p_context, void const * p_args, uint32_t args_bytes,
+                           uint32_t priority);
+ssp_err_t   R_BSP_WorkPostOrCall(bool defer, bsp_work_function_t p_function, void * p_context, void * p_args,
+                                 uint32_t args_bytes, uint32_t priority);
+uint32_t    R_BSP_WorkRunPending(void);
+void        R_BSP_WorkLoop(void);
+ssp_err_t   R_BSP_WorkStatsGet(bsp_work_stats_t * p_stats);
+ssp_err_t   R_BSP_TimerServiceOpen(bsp_timer_service_cfg_t const * p_cfg);
+ssp_err_t   R_BSP_TimerServiceSwitch(bsp_timer_service_cfg_t const * p_cfg);
+ssp_err_t   R_BSP_TimerServiceClose(void);
+ssp_err_t   R_BSP_TimestampGet(uint64_t * p_counts);
+ssp_err_t   R_BSP_TimerCountsGet(uint64_t delay, bsp_delay_units_t units, uint64_t * p_counts);
+ssp_err_t   R_BSP_TimerStart(bsp_timer_t * p_timer, uint64_t expiry, uint64_t period, bsp_timer_callback_t p_callback,
+                             void * p_context);
+ssp_err_t   R_BSP_TimerStop(bsp_timer_t * p_timer);
+ssp_err_t   R_BSP_TimerWaitUntil(uint64_t deadline, bsp_timer_condition_t p_condition, void * p_context,
+                                 uint64_t poll_counts);
+void        R_BSP_TimerCounterCallback(struct st_timer_callback_args * p_args);
+void        R_BSP_TimerAlarmCallback(struct st_timer_callback_args * p_args);
+ssp_err_t   R_BSP_IsrTraceReset(void);
+ssp_err_t   R_BSP_IsrTraceGet(IRQn_Type irq, bsp_isr_trace_stats_t * p_stats);
+ssp_err_t   R_BSP_IsrTraceReport(bsp_isr_trace_write_t p_write, void * p_context);
+void        R_BSP_IsrTraceSwoWrite(char const * p_text, uint32_t length, void * p_context);
 
 /* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
 SSP_FOOTER
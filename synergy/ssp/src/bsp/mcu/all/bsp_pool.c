@@ -0,0 +1,513 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+/***********************************************************************************************************************
+* File Name    : bsp_pool.c
+* Description  : Fixed size class pool allocator with lock-free allocation and release.
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include "bsp_api.h"
+#include "bsp_atomic.h"
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+/* Default for configurations generated before the pool allocator was added. */
+#ifndef BSP_CFG_POOL_MALLOC_ENABLE
+#define BSP_CFG_POOL_MALLOC_ENABLE      (0)
+#endif
+
+/* The newlib allocator hooks are only built for GCC on the target. */
+#if defined(__GNUC__) && !defined(__ICCARM__) && !defined(BSP_HOST_SIM) && (1 == BSP_CFG_POOL_MALLOC_ENABLE)
+#define BSP_PRV_POOL_MALLOC
+#include <errno.h>
+#include <reent.h>
+#include <string.h>
+#endif
+
+/* "POOL" in ASCII, stored in bsp_pool_t::open while the pool is usable. */
+#define BSP_PRV_POOL_OPEN               (0x504F4F4CU)
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Private function prototypes
+***********************************************************************************************************************/
+static uint32_t  bsp_pool_block_find(bsp_pool_t const * p_pool, void const * p_block, bsp_pool_class_t ** pp_class);
+
+/***********************************************************************************************************************
+Exported global variables (to be accessed by other files)
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Private global variables and functions
+***********************************************************************************************************************/
+#if defined(BSP_PRV_POOL_MALLOC)
+/** Pool used by malloc() and related functions, set by R_BSP_PoolMallocSet(). */
+static bsp_pool_t * gp_bsp_pool_malloc = NULL;
+#endif
+
+/*******************************************************************************************************************//**
+ * @addtogroup BSP_MCU_POOL
+ *
+ * @{
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @brief Carve a memory region into the size classes of a pool.
+ *
+ * The arenas are placed one after the other from the start of the region, aligned to BSP_POOL_ALIGNMENT. The region
+ * can be any RAM, for example a section the linker script places in SRAMHS or SRAM0 for buffers that need the
+ * bandwidth of a specific bank.
+ *
+ * @param[out] p_pool              Pool control block
+ * @param[in]  p_cfg               Region and size classes
+ *
+ * @retval SSP_SUCCESS             Pool is ready for allocations.
+ * @retval SSP_ERR_ASSERTION       A pointer is NULL.
+ * @retval SSP_ERR_INVALID_ARGUMENT The number of classes, a block count or the block size order is invalid.
+ * @retval SSP_ERR_OUT_OF_MEMORY   The size classes do not fit in the region.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_PoolOpen (bsp_pool_t * p_pool, bsp_pool_cfg_t const * p_cfg)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_pool);
+    SSP_ASSERT(NULL != p_cfg);
+    SSP_ASSERT(NULL != p_cfg->p_region);
+    SSP_ASSERT(NULL != p_cfg->p_classes);
+#endif
+
+    if ((0U == p_cfg->num_classes) || (BSP_POOL_CLASSES_MAX < p_cfg->num_classes))
+    {
+        return SSP_ERR_INVALID_ARGUMENT;
+    }
+
+    /** Align the start of the region. */
+    uintptr_t start     = (uintptr_t) p_cfg->p_region;
+    uintptr_t end       = start + p_cfg->region_bytes;
+    uintptr_t next      = (start + (BSP_POOL_ALIGNMENT - 1U)) & ~((uintptr_t) BSP_POOL_ALIGNMENT - 1U);
+    uint32_t  last_size = 0U;
+
+    /** Lay out the arenas and check that they fit. */
+    for (uint32_t i = 0U; i < p_cfg->num_classes; i++)
+    {
+        bsp_pool_class_cfg_t const * p_class_cfg = &p_cfg->p_classes[i];
+        uint32_t block_size = (p_class_cfg->block_size + (BSP_POOL_ALIGNMENT - 1U)) & ~(BSP_POOL_ALIGNMENT - 1U);
+
+        if ((0U == block_size) || (block_size <= last_size) ||
+            (0U == p_class_cfg->block_count) || (BSP_POOL_BLOCKS_MAX < p_class_cfg->block_count))
+        {
+            return SSP_ERR_INVALID_ARGUMENT;
+        }
+
+        uint64_t arena_bytes = (uint64_t) block_size * p_class_cfg->block_count;
+        if ((next > end) || (arena_bytes > (uint64_t) (end - next)))
+        {
+            return SSP_ERR_OUT_OF_MEMORY;
+        }
+
+        bsp_pool_class_t * p_class = &p_pool->classes[i];
+        p_class->p_blocks        = (uint8_t *) next;
+        p_class->block_size      = block_size;
+        p_class->block_count     = p_class_cfg->block_count;
+        p_class->blocks_used     = 0U;
+        p_class->blocks_used_max = 0U;
+        p_class->fallbacks       = 0U;
+        p_class->failures        = 0U;
+
+        next     += (uintptr_t) arena_bytes;
+        last_size = block_size;
+    }
+
+    /** Link all blocks of each class into its free list, lowest address first. The link to the next free block is
+     * kept in the first word of each free block. */
+    for (uint32_t i = 0U; i < p_cfg->num_classes; i++)
+    {
+        bsp_pool_class_t * p_class = &p_pool->classes[i];
+        for (uint32_t index = 1U; index <= p_class->block_count; index++)
+        {
+            uint32_t link = (index < p_class->block_count) ? (index + 1U) : 0U;
+            *((uint32_t *) (p_class->p_blocks + ((index - 1U) * p_class->block_size))) = link;
+        }
+        p_class->free_head = 1U;
+    }
+
+    p_pool->num_classes = p_cfg->num_classes;
+    p_pool->open        = BSP_PRV_POOL_OPEN;
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Allocate a block from the smallest size class that fits the request and has a free block.
+ *
+ * If the best fitting class is empty, the next larger class is tried and the larger class counts a fallback. If no
+ * class can serve the request, the best fitting class counts a failure.
+ *
+ * @param[in]  p_pool              Pool control block
+ * @param[in]  bytes               Requested size in bytes
+ * @param[out] pp_block            Start of the allocated block, aligned to BSP_POOL_ALIGNMENT
+ *
+ * @retval SSP_SUCCESS             Block allocated.
+ * @retval SSP_ERR_ASSERTION       A pointer is NULL.
+ * @retval SSP_ERR_NOT_OPEN        The pool is not open.
+ * @retval SSP_ERR_INVALID_SIZE    bytes is 0 or larger than the largest block size.
+ * @retval SSP_ERR_OUT_OF_MEMORY   All fitting size classes are empty.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_PoolAlloc (bsp_pool_t * p_pool, uint32_t bytes, void ** pp_block)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_pool);
+    SSP_ASSERT(NULL != pp_block);
+#endif
+
+    if (BSP_PRV_POOL_OPEN != p_pool->open)
+    {
+        return SSP_ERR_NOT_OPEN;
+    }
+
+    /** Find the smallest class the request fits in. */
+    uint32_t first = 0U;
+    while ((first < p_pool->num_classes) && (p_pool->classes[first].block_size < bytes))
+    {
+        first++;
+    }
+    if ((0U == bytes) || (first == p_pool->num_classes))
+    {
+        return SSP_ERR_INVALID_SIZE;
+    }
+
+    /** Take the first free block from this or a larger class. */
+    for (uint32_t i = first; i < p_pool->num_classes; i++)
+    {
+        bsp_pool_class_t * p_class = &p_pool->classes[i];
+        uint32_t           index   = bsp_atomic_list_pop(&p_class->free_head, p_class->p_blocks, p_class->block_size);
+        if (0U != index)
+        {
+            bsp_atomic_max(&p_class->blocks_used_max, bsp_atomic_add(&p_class->blocks_used, 1U));
+            if (i != first)
+            {
+                (void) bsp_atomic_add(&p_class->fallbacks, 1U);
+            }
+
+            *pp_block = p_class->p_blocks + ((index - 1U) * p_class->block_size);
+
+            return SSP_SUCCESS;
+        }
+    }
+
+    (void) bsp_atomic_add(&p_pool->classes[first].failures, 1U);
+
+    return SSP_ERR_OUT_OF_MEMORY;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Return a block to its size class.
+ *
+ * @param[in]  p_pool              Pool control block
+ * @param[in]  p_block             Block returned by R_BSP_PoolAlloc()
+ *
+ * @retval SSP_SUCCESS             Block freed.
+ * @retval SSP_ERR_ASSERTION       A pointer is NULL.
+ * @retval SSP_ERR_NOT_OPEN        The pool is not open.
+ * @retval SSP_ERR_INVALID_POINTER p_block is not the start of a block in this pool.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_PoolFree (bsp_pool_t * p_pool, void * p_block)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_pool);
+    SSP_ASSERT(NULL != p_block);
+#endif
+
+    if (BSP_PRV_POOL_OPEN != p_pool->open)
+    {
+        return SSP_ERR_NOT_OPEN;
+    }
+
+    bsp_pool_class_t * p_class = NULL;
+    uint32_t           index   = bsp_pool_block_find(p_pool, p_block, &p_class);
+    if (0U == index)
+    {
+        return SSP_ERR_INVALID_POINTER;
+    }
+
+    /* Count the block as free before another context can take it, so blocks_used never exceeds the block count. */
+    (void) bsp_atomic_add(&p_class->blocks_used, UINT32_MAX);
+
+    bsp_atomic_list_push(&p_class->free_head, p_class->p_blocks, p_class->block_size, index);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Get the usable size of an allocated block.
+ *
+ * @param[in]  p_pool              Pool control block
+ * @param[in]  p_block             Block returned by R_BSP_PoolAlloc()
+ * @param[out] p_bytes             Block size in bytes
+ *
+ * @retval SSP_SUCCESS             Size stored in p_bytes.
+ * @retval SSP_ERR_ASSERTION       A pointer is NULL.
+ * @retval SSP_ERR_NOT_OPEN        The pool is not open.
+ * @retval SSP_ERR_INVALID_POINTER p_block is not the start of a block in this pool.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_PoolBlockSizeGet (bsp_pool_t * p_pool, void const * p_block, uint32_t * p_bytes)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_pool);
+    SSP_ASSERT(NULL != p_block);
+    SSP_ASSERT(NULL != p_bytes);
+#endif
+
+    if (BSP_PRV_POOL_OPEN != p_pool->open)
+    {
+        return SSP_ERR_NOT_OPEN;
+    }
+
+    bsp_pool_class_t * p_class = NULL;
+    if (0U == bsp_pool_block_find(p_pool, p_block, &p_class))
+    {
+        return SSP_ERR_INVALID_POINTER;
+    }
+
+    *p_bytes = p_class->block_size;
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Get the usage statistics of a size class.
+ *
+ * @param[in]  p_pool              Pool control block
+ * @param[in]  class_index         Index of the size class in bsp_pool_cfg_t::p_classes
+ * @param[out] p_stats             Statistics of the class
+ *
+ * @retval SSP_SUCCESS             Statistics stored in p_stats.
+ * @retval SSP_ERR_ASSERTION       A pointer is NULL.
+ * @retval SSP_ERR_NOT_OPEN        The pool is not open.
+ * @retval SSP_ERR_INVALID_ARGUMENT class_index is not a size class of the pool.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_PoolStatsGet (bsp_pool_t * p_pool, uint32_t class_index, bsp_pool_stats_t * p_stats)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_pool);
+    SSP_ASSERT(NULL != p_stats);
+#endif
+
+    if (BSP_PRV_POOL_OPEN != p_pool->open)
+    {
+        return SSP_ERR_NOT_OPEN;
+    }
+    if (class_index >= p_pool->num_classes)
+    {
+        return SSP_ERR_INVALID_ARGUMENT;
+    }
+
+    bsp_pool_class_t const * p_class = &p_pool->classes[class_index];
+    p_stats->block_size      = p_class->block_size;
+    p_stats->block_count     = p_class->block_count;
+    p_stats->blocks_used     = p_class->blocks_used;
+    p_stats->blocks_used_max = p_class->blocks_used_max;
+    p_stats->fallbacks       = p_class->fallbacks;
+    p_stats->failures        = p_class->failures;
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Route malloc(), calloc(), realloc() and free() to a pool.
+ *
+ * Requires BSP_CFG_POOL_MALLOC_ENABLE and the GCC toolchain. The newlib reentrant allocator functions are replaced,
+ * so _sbrk() and the heap section are no longer used. Call this before the first allocation, for example from
+ * R_BSP_WarmStart() with BSP_WARM_START_POST_C. Until then, and for requests larger than the largest size class,
+ * allocations fail with ENOMEM.
+ *
+ * @param[in]  p_pool              Open pool used for all following allocations
+ *
+ * @retval SSP_SUCCESS             Allocations are served from p_pool.
+ * @retval SSP_ERR_ASSERTION       p_pool is NULL.
+ * @retval SSP_ERR_NOT_OPEN        The pool is not open.
+ * @retval SSP_ERR_UNSUPPORTED     The allocator hooks are not built.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_PoolMallocSet (bsp_pool_t * p_pool)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_pool);
+#endif
+
+#if defined(BSP_PRV_POOL_MALLOC)
+    if (BSP_PRV_POOL_OPEN != p_pool->open)
+    {
+        return SSP_ERR_NOT_OPEN;
+    }
+
+    gp_bsp_pool_malloc = p_pool;
+
+    return SSP_SUCCESS;
+#else
+    SSP_PARAMETER_NOT_USED(p_pool);
+
+    return SSP_ERR_UNSUPPORTED;
+#endif
+}
+
+/** @} (end addtogroup BSP_MCU_POOL) */
+
+/*******************************************************************************************************************//**
+ * Find the size class and index of a block.
+ *
+ * @param[in]  p_pool              Pool control block
+ * @param[in]  p_block             Start of a block
+ * @param[out] pp_class            Size class of the block
+ *
+ * @return 1-based index of the block in its class, 0 if p_block is not the start of a block in the pool.
+ **********************************************************************************************************************/
+static uint32_t bsp_pool_block_find (bsp_pool_t const * p_pool, void const * p_block, bsp_pool_class_t ** pp_class)
+{
+    uintptr_t address = (uintptr_t) p_block;
+
+    for (uint32_t i = 0U; i < p_pool->num_classes; i++)
+    {
+        bsp_pool_class_t const * p_class = &p_pool->classes[i];
+        uintptr_t                start   = (uintptr_t) p_class->p_blocks;
+        if ((address >= start) && ((address - start) < ((uintptr_t) p_class->block_size * p_class->block_count)))
+        {
+            uint32_t offset = (uint32_t) (address - start);
+            if (0U != (offset % p_class->block_size))
+            {
+                return 0U;
+            }
+
+            *pp_class = (bsp_pool_class_t *) p_class;
+
+            return (offset / p_class->block_size) + 1U;
+        }
+    }
+
+    return 0U;
+}
+
+#if defined(BSP_PRV_POOL_MALLOC)
+/*LDRA_INSPECTED 219 s - This is an allowed exception to LDRA standard 219 S "User name starts with underscore."*/
+/*LDRA_INSPECTED 90 S - This is an override of a standard library function and its prototype must match exactly.*/
+void * _malloc_r (struct _reent * p_reent, size_t bytes);
+/*LDRA_INSPECTED 219 s - This is an allowed exception to LDRA standard 219 S "User name starts with underscore."*/
+/*LDRA_INSPECTED 90 S - This is an override of a standard library function and its prototype must match exactly.*/
+void _free_r (struct _reent * p_reent, void * p_block);
+/*LDRA_INSPECTED 219 s - This is an allowed exception to LDRA standard 219 S "User name starts with underscore."*/
+/*LDRA_INSPECTED 90 S - This is an override of a standard library function and its prototype must match exactly.*/
+void * _calloc_r (struct _reent * p_reent, size_t count, size_t size);
+/*LDRA_INSPECTED 219 s - This is an allowed exception to LDRA standard 219 S "User name starts with underscore."*/
+/*LDRA_INSPECTED 90 S - This is an override of a standard library function and its prototype must match exactly.*/
+void * _realloc_r (struct _reent * p_reent, void * p_block, size_t bytes);
+
+/*******************************************************************************************************************//**
+ * newlib malloc() served from the pool set by R_BSP_PoolMallocSet().
+ **********************************************************************************************************************/
+void * _malloc_r (struct _reent * p_reent, size_t bytes)
+{
+    void * p_block = NULL;
+
+    if ((NULL == gp_bsp_pool_malloc) ||
+        (SSP_SUCCESS != R_BSP_PoolAlloc(gp_bsp_pool_malloc, (uint32_t) bytes, &p_block)))
+    {
+        p_reent->_errno = ENOMEM;
+        p_block         = NULL;
+    }
+
+    return p_block;
+}
+
+/*******************************************************************************************************************//**
+ * newlib free() returning blocks to the pool set by R_BSP_PoolMallocSet().
+ **********************************************************************************************************************/
+void _free_r (struct _reent * p_reent, void * p_block)
+{
+    SSP_PARAMETER_NOT_USED(p_reent);
+
+    if ((NULL != p_block) && (NULL != gp_bsp_pool_malloc))
+    {
+        (void) R_BSP_PoolFree(gp_bsp_pool_malloc, p_block);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * newlib calloc() served from the pool set by R_BSP_PoolMallocSet().
+ **********************************************************************************************************************/
+void * _calloc_r (struct _reent * p_reent, size_t count, size_t size)
+{
+    if ((0U != size) && (count > (SIZE_MAX / size)))
+    {
+        p_reent->_errno = ENOMEM;
+
+        return NULL;
+    }
+
+    void * p_block = _malloc_r(p_reent, count * size);
+    if (NULL != p_block)
+    {
+        memset(p_block, 0, count * size);
+    }
+
+    return p_block;
+}
+
+/*******************************************************************************************************************//**
+ * newlib realloc() served from the pool set by R_BSP_PoolMallocSet(). The block is kept if it is still large enough.
+ **********************************************************************************************************************/
+void * _realloc_r (struct _reent * p_reent, void * p_block, size_t bytes)
+{
+    if (NULL == p_block)
+    {
+        return _malloc_r(p_reent, bytes);
+    }
+    if (0U == bytes)
+    {
+        _free_r(p_reent, p_block);
+
+        return NULL;
+    }
+
+    uint32_t block_size = 0U;
+    if ((NULL == gp_bsp_pool_malloc) ||
+        (SSP_SUCCESS != R_BSP_PoolBlockSizeGet(gp_bsp_pool_malloc, p_block, &block_size)))
+    {
+        p_reent->_errno = ENOMEM;
+
+        return NULL;
+    }
+    if (bytes <= block_size)
+    {
+        return p_block;
+    }
+
+    void * p_new = _malloc_r(p_reent, bytes);
+    if (NULL != p_new)
+    {
+        memcpy(p_new, p_block, block_size);
+        _free_r(p_reent, p_block);
+    }
+
+    return p_new;
+}
+#endif /* defined(BSP_PRV_POOL_MALLOC) */
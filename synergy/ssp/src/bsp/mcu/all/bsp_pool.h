@@ -0,0 +1,118 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+/***********************************************************************************************************************
+* File Name    : bsp_pool.h
+* Description  : Fixed size class pool allocator implemented by the BSP.
+***********************************************************************************************************************/
+
+#ifndef BSP_POOL_H_
+#define BSP_POOL_H_
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+
+/* Common macro for SSP header files. There is also a corresponding SSP_FOOTER macro at the end of this file. */
+SSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @ingroup BSP_MCU_COMMON
+ * @defgroup BSP_MCU_POOL Pool Allocator
+ * @brief Fixed size class memory pools
+ *
+ * A pool carves a memory region, typically a linker defined section in a chosen SRAM bank, into arenas of fixed size
+ * blocks. Each arena is one size class. An allocation takes a block from the smallest class that fits and is not
+ * empty, so allocating and freeing never split or merge memory and take constant time. The free lists are updated
+ * with exclusive load and store instructions, so the pool can be used from threads and interrupts without a lock.
+ *
+ * @{
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+#define BSP_POOL_CLASSES_MAX        (8U)       ///< Maximum number of size classes in a pool
+#define BSP_POOL_BLOCKS_MAX         (0xFFFFU)  ///< Maximum number of blocks in a size class
+#define BSP_POOL_ALIGNMENT          (8U)       ///< Alignment of the blocks and granularity of the block size
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+/** Size class configuration. */
+typedef struct st_bsp_pool_class_cfg
+{
+    uint32_t  block_size;              ///< Size of each block in bytes, rounded up to a multiple of BSP_POOL_ALIGNMENT
+    uint32_t  block_count;             ///< Number of blocks, 1 to BSP_POOL_BLOCKS_MAX
+} bsp_pool_class_cfg_t;
+
+/** Pool configuration. */
+typedef struct st_bsp_pool_cfg
+{
+    void                       * p_region;     ///< Start of the memory region carved into blocks
+    uint32_t                     region_bytes; ///< Size of the memory region in bytes
+    bsp_pool_class_cfg_t const * p_classes;    ///< Size classes, in increasing block size order
+    uint32_t                     num_classes;  ///< Number of size classes, 1 to BSP_POOL_CLASSES_MAX
+} bsp_pool_cfg_t;
+
+/** Usage statistics of a size class. */
+typedef struct st_bsp_pool_stats
+{
+    uint32_t  block_size;              ///< Block size in bytes
+    uint32_t  block_count;             ///< Number of blocks
+    uint32_t  blocks_used;             ///< Blocks currently allocated
+    uint32_t  blocks_used_max;         ///< Highest number of blocks allocated at the same time
+    uint32_t  fallbacks;               ///< Allocations served by this class because a smaller fitting class was empty
+    uint32_t  failures;                ///< Allocations that fit this class but found it and all larger classes empty
+} bsp_pool_stats_t;
+
+/** Size class control block. Only accessed by the pool functions. */
+typedef struct st_bsp_pool_class
+{
+    uint8_t         * p_blocks;        ///< First block of the arena
+    uint32_t          block_size;      ///< Block size in bytes
+    uint32_t          block_count;     ///< Number of blocks
+    volatile uint32_t free_head;       ///< Update tag (upper 16 bits) and 1-based index of the first free block
+    volatile uint32_t blocks_used;     ///< Blocks currently allocated
+    volatile uint32_t blocks_used_max; ///< High-water mark of blocks_used
+    volatile uint32_t fallbacks;       ///< See bsp_pool_stats_t::fallbacks
+    volatile uint32_t failures;        ///< See bsp_pool_stats_t::failures
+} bsp_pool_class_t;
+
+/** Pool control block. Allocated by the caller and initialized by R_BSP_PoolOpen(). */
+typedef struct st_bsp_pool
+{
+    uint32_t          open;                            ///< Used to determine if the pool is open
+    uint32_t          num_classes;                     ///< Number of size classes
+    bsp_pool_class_t  classes[BSP_POOL_CLASSES_MAX];   ///< Size classes in increasing block size order
+} bsp_pool_t;
+
+/***********************************************************************************************************************
+Exported global variables
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Exported global functions (to be accessed by other files)
+***********************************************************************************************************************/
+
+/** @} (end defgroup BSP_MCU_POOL) */
+
+/* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
+SSP_FOOTER
+
+#endif /* BSP_POOL_H_ */
@@ -0,0 +1,1105 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+/***********************************************************************************************************************
+* File Name    : bsp_timer.c
+* Description  : Timer service: 64-bit timestamp on a free-running timer, hierarchical timer wheel and timed waits.
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include "bsp_api.h"
+#include "r_timer_api.h"
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+/* Default for configurations generated before the timer service was added. */
+#ifndef BSP_CFG_TIMER_TICK_SHIFT
+#define BSP_CFG_TIMER_TICK_SHIFT        (7)
+#endif
+
+#if (BSP_CFG_TIMER_TICK_SHIFT < 0) || (BSP_CFG_TIMER_TICK_SHIFT > 16)
+#error "BSP_CFG_TIMER_TICK_SHIFT must be 0 to 16."
+#endif
+
+/** "BTMR" in ASCII, used to determine if the service is open. */
+#define BSP_PRV_TIMER_OPEN              (0x42544D52U)
+
+/* A wheel tick is 2^BSP_CFG_TIMER_TICK_SHIFT counts. Each level of the wheel has 2^6 slots and each slot of a level
+ * spans all the slots of the level below it. */
+#define BSP_PRV_TIMER_TICK_MASK         ((1ULL << BSP_CFG_TIMER_TICK_SHIFT) - 1ULL)
+#define BSP_PRV_TIMER_LEVEL_BITS        (6U)
+#define BSP_PRV_TIMER_SLOT_MASK         (BSP_TIMER_WHEEL_SLOTS - 1U)
+
+/* The list after the wheel slots holds timers that are due, in expiry order, until their callbacks run. */
+#define BSP_PRV_TIMER_SLOT_EXPIRED      (BSP_TIMER_WHEEL_LEVELS * BSP_TIMER_WHEEL_SLOTS)
+#define BSP_PRV_TIMER_LISTS             (BSP_PRV_TIMER_SLOT_EXPIRED + 1U)
+
+/* Waits shorter than this many ticks poll the timestamp instead of sleeping, since programming the alarm and waking
+ * up would take longer than the wait. */
+#define BSP_PRV_TIMER_SLEEP_MIN_TICKS   (4U)
+
+#define BSP_PRV_TIMER_US_PER_SECOND     (1000000ULL)
+
+#if (BSP_TIMER_WHEEL_SLOTS != (1U << BSP_PRV_TIMER_LEVEL_BITS))
+#error "BSP_TIMER_WHEEL_SLOTS must be 2^BSP_PRV_TIMER_LEVEL_BITS."
+#endif
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Private function prototypes
+***********************************************************************************************************************/
+static ssp_err_t bsp_timer_hardware_open(bsp_timer_service_cfg_t const * p_cfg);
+static void      bsp_timer_hardware_close(void);
+static void      bsp_timer_wheel_clear(void);
+static uint64_t  bsp_timer_scale(uint64_t counts);
+static void      bsp_timer_base_advance(void);
+static uint64_t  bsp_timer_now(void);
+static void      bsp_timer_wheel_insert(bsp_timer_t * p_timer);
+static void      bsp_timer_wheel_remove(bsp_timer_t * p_timer);
+static void      bsp_timer_wheel_advance(uint64_t now);
+static bool      bsp_timer_wheel_next(uint64_t * p_tick);
+static void      bsp_timer_alarm_arm(uint64_t now);
+static void      bsp_timer_expired_run(uint64_t now);
+static void      bsp_timer_service_process(void);
+static bool      bsp_timer_sleep_allowed(void);
+
+/***********************************************************************************************************************
+Exported global variables (to be accessed by other files)
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Private global variables and functions
+***********************************************************************************************************************/
+/** Set to BSP_PRV_TIMER_OPEN while the service is open. */
+static volatile uint32_t g_bsp_timer_open = 0U;
+
+/** Free-running counter and optional alarm currently used by the service. */
+static timer_instance_t const * gp_bsp_timer_counter = NULL;
+static timer_instance_t const * gp_bsp_timer_alarm   = NULL;
+
+/** Timestamp frequency, which is the frequency of the counter passed to R_BSP_TimerServiceOpen(). */
+static uint32_t g_bsp_timer_frequency = 0U;
+
+/** Frequency, period and direction of the counter in use. */
+static uint32_t g_bsp_timer_counter_frequency = 0U;
+static uint64_t g_bsp_timer_counter_period    = 0U;
+static bool     g_bsp_timer_counter_down      = false;
+
+/** Frequency of the alarm in use. */
+static uint32_t g_bsp_timer_alarm_frequency = 0U;
+
+/** Timestamp at the start of the current counter period. When the counter does not run at the timestamp frequency,
+ * g_bsp_timer_base_remainder keeps the fraction of a timestamp count lost when the period was converted. */
+static uint64_t g_bsp_timer_base           = 0U;
+static uint64_t g_bsp_timer_base_remainder = 0U;
+
+/** Last timestamp returned. A lower reading means the counter wrapped since then. */
+static uint64_t g_bsp_timer_last = 0U;
+
+/** Set when a reading found a counter wrap before its interrupt ran, so the interrupt does not count it again. */
+static bool g_bsp_timer_wrap_counted = false;
+
+/** Wheel tick up to which the wheel has been advanced. */
+static uint64_t g_bsp_timer_wheel_now = 0U;
+
+/** Wheel slots, followed by the list of expired timers. */
+static bsp_timer_t * gp_bsp_timer_lists[BSP_PRV_TIMER_LISTS];
+
+/** One bit per wheel slot, set while the slot is not empty. */
+static uint64_t g_bsp_timer_wheel_used[BSP_TIMER_WHEEL_LEVELS];
+
+/** Wheel tick the alarm is programmed for, valid while g_bsp_timer_alarm_armed is true. */
+static uint64_t g_bsp_timer_alarm_tick  = 0U;
+static bool     g_bsp_timer_alarm_armed = false;
+
+/*******************************************************************************************************************//**
+ * @addtogroup BSP_MCU_TIMER
+ *
+ * @{
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @brief Open the timer service and start its counter.
+ *
+ * The timestamp starts at 0 and counts at the frequency of p_cfg->p_counter.
+ *
+ * @param[in]  p_cfg               Counter and alarm to use
+ *
+ * @retval SSP_SUCCESS             Service open, timestamp counting.
+ * @retval SSP_ERR_ASSERTION       p_cfg or p_cfg->p_counter is NULL.
+ * @retval SSP_ERR_ALREADY_OPEN    The service is already open.
+ * @retval SSP_ERR_INVALID_ARGUMENT The counter or alarm callback is not the service callback, or the alarm is not
+ *                                 configured in one-shot mode.
+ * @return                         See the timer_api_t::open and timer_api_t::infoGet implementations for other
+ *                                 possible return codes.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_TimerServiceOpen (bsp_timer_service_cfg_t const * p_cfg)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_cfg);
+    SSP_ASSERT(NULL != p_cfg->p_counter);
+#endif
+
+    if (BSP_PRV_TIMER_OPEN == g_bsp_timer_open)
+    {
+        return SSP_ERR_ALREADY_OPEN;
+    }
+
+    bsp_timer_wheel_clear();
+    g_bsp_timer_base           = 0U;
+    g_bsp_timer_base_remainder = 0U;
+    g_bsp_timer_last           = 0U;
+    g_bsp_timer_wrap_counted   = false;
+    g_bsp_timer_wheel_now      = 0U;
+    g_bsp_timer_alarm_armed    = false;
+    g_bsp_timer_frequency      = 0U;
+
+    ssp_err_t err = bsp_timer_hardware_open(p_cfg);
+    if (SSP_SUCCESS != err)
+    {
+        return err;
+    }
+
+    g_bsp_timer_open = BSP_PRV_TIMER_OPEN;
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Move the service to another counter and alarm, for example from a GPT channel to an AGT channel before
+ * entering a low-power mode in which the GPT does not run.
+ *
+ * The previous counter and alarm are closed. The timestamp keeps counting at the frequency of the counter passed to
+ * R_BSP_TimerServiceOpen(), and running software timers keep their expiry time.
+ *
+ * @param[in]  p_cfg               Counter and alarm to use from now on
+ *
+ * @retval SSP_SUCCESS             Service moved to the new counter.
+ * @retval SSP_ERR_ASSERTION       p_cfg or p_cfg->p_counter is NULL.
+ * @retval SSP_ERR_NOT_OPEN        The service is not open.
+ * @retval SSP_ERR_INVALID_ARGUMENT The counter or alarm callback is not the service callback, or the alarm is not
+ *                                 configured in one-shot mode. The service is closed in this case.
+ * @return                         See the timer_api_t::open and timer_api_t::infoGet implementations for other
+ *                                 possible return codes. The service is closed in this case.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_TimerServiceSwitch (bsp_timer_service_cfg_t const * p_cfg)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_cfg);
+    SSP_ASSERT(NULL != p_cfg->p_counter);
+#endif
+
+    if (BSP_PRV_TIMER_OPEN != g_bsp_timer_open)
+    {
+        return SSP_ERR_NOT_OPEN;
+    }
+
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+
+    /** Mark the service closed while the hardware changes, so R_BSP_SoftwareDelay() called by the drivers does not
+     * use it. */
+    uint64_t now = bsp_timer_now();
+    g_bsp_timer_open = 0U;
+    bsp_timer_hardware_close();
+
+    ssp_err_t err = bsp_timer_hardware_open(p_cfg);
+    if (SSP_SUCCESS == err)
+    {
+        /** Continue the timestamp from its current value, less the counts the new counter made since it started. */
+        g_bsp_timer_base           = now;
+        g_bsp_timer_base_remainder = 0U;
+        g_bsp_timer_wrap_counted   = false;
+        uint64_t elapsed = bsp_timer_now() - now;
+        g_bsp_timer_base = (now > elapsed) ? (now - elapsed) : now;
+        g_bsp_timer_last = now;
+
+        g_bsp_timer_alarm_armed = false;
+        g_bsp_timer_open        = BSP_PRV_TIMER_OPEN;
+        bsp_timer_alarm_arm(bsp_timer_now());
+    }
+    else
+    {
+        bsp_timer_wheel_clear();
+    }
+
+    SSP_CRITICAL_SECTION_EXIT;
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Close the timer service, its counter and its alarm. Running software timers are stopped.
+ *
+ * @retval SSP_SUCCESS             Service closed.
+ * @retval SSP_ERR_NOT_OPEN        The service is not open.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_TimerServiceClose (void)
+{
+    if (BSP_PRV_TIMER_OPEN != g_bsp_timer_open)
+    {
+        return SSP_ERR_NOT_OPEN;
+    }
+
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+
+    g_bsp_timer_open = 0U;
+    bsp_timer_hardware_close();
+    bsp_timer_wheel_clear();
+
+    SSP_CRITICAL_SECTION_EXIT;
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Get the 64-bit monotonic timestamp.
+ *
+ * Can be called from threads and interrupts, also with interrupts masked. A counter wrap is detected from the counter
+ * reading before its interrupt runs, provided the timestamp is read at least once per counter period while interrupts
+ * are masked.
+ *
+ * @param[out] p_counts            Counts since the service was opened
+ *
+ * @retval SSP_SUCCESS             Timestamp stored in p_counts.
+ * @retval SSP_ERR_ASSERTION       p_counts is NULL.
+ * @retval SSP_ERR_NOT_OPEN        The service is not open.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_TimestampGet (uint64_t * p_counts)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_counts);
+#endif
+
+    if (BSP_PRV_TIMER_OPEN != g_bsp_timer_open)
+    {
+        return SSP_ERR_NOT_OPEN;
+    }
+
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    *p_counts = bsp_timer_now();
+    SSP_CRITICAL_SECTION_EXIT;
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Convert a delay to timestamp counts, rounding up.
+ *
+ * @param[in]  delay               Number of units
+ * @param[in]  units               Unit of delay
+ * @param[out] p_counts            Delay in timestamp counts
+ *
+ * @retval SSP_SUCCESS             Delay converted.
+ * @retval SSP_ERR_ASSERTION       p_counts is NULL.
+ * @retval SSP_ERR_NOT_OPEN        The service is not open.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_TimerCountsGet (uint64_t delay, bsp_delay_units_t units, uint64_t * p_counts)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_counts);
+#endif
+
+    if (BSP_PRV_TIMER_OPEN != g_bsp_timer_open)
+    {
+        return SSP_ERR_NOT_OPEN;
+    }
+
+    /** Convert whole seconds and the remaining microseconds separately so the products cannot overflow. */
+    uint64_t us        = delay * (uint64_t) units;
+    uint64_t frequency = g_bsp_timer_frequency;
+    *p_counts = ((us / BSP_PRV_TIMER_US_PER_SECOND) * frequency) +
+                ((((us % BSP_PRV_TIMER_US_PER_SECOND) * frequency) + (BSP_PRV_TIMER_US_PER_SECOND - 1ULL)) /
+                 BSP_PRV_TIMER_US_PER_SECOND);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Start a software timer, or restart it if it is running.
+ *
+ * The callback is called from the counter or alarm interrupt once the timestamp reaches expiry, with a delay of less
+ * than one wheel tick (2^BSP_CFG_TIMER_TICK_SHIFT counts) plus the interrupt latency. An expiry in the past calls the
+ * callback as soon as possible. A periodic timer is restarted before its callback runs; periods missed because of a
+ * long interrupt latency are skipped.
+ *
+ * @param[in]  p_timer             Timer control block, must stay valid until the timer expires or is stopped
+ * @param[in]  expiry              Timestamp at which the timer expires
+ * @param[in]  period              Reload period in counts, 0 for a one-shot timer
+ * @param[in]  p_callback          Function called on expiry, may be NULL
+ * @param[in]  p_context           Second argument of p_callback
+ *
+ * @retval SSP_SUCCESS             Timer started.
+ * @retval SSP_ERR_ASSERTION       p_timer is NULL.
+ * @retval SSP_ERR_NOT_OPEN        The service is not open.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_TimerStart (bsp_timer_t * p_timer, uint64_t expiry, uint64_t period, bsp_timer_callback_t p_callback,
+                            void * p_context)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_timer);
+#endif
+
+    if (BSP_PRV_TIMER_OPEN != g_bsp_timer_open)
+    {
+        return SSP_ERR_NOT_OPEN;
+    }
+
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+
+    if (p_timer->running)
+    {
+        bsp_timer_wheel_remove(p_timer);
+    }
+    p_timer->expiry     = expiry;
+    p_timer->period     = period;
+    p_timer->p_callback = p_callback;
+    p_timer->p_context  = p_context;
+    p_timer->running    = true;
+
+    /** Bring the wheel up to date first so the timer is placed relative to the current time. */
+    uint64_t now = bsp_timer_now();
+    bsp_timer_wheel_advance(now);
+    bsp_timer_wheel_insert(p_timer);
+    bsp_timer_alarm_arm(now);
+
+    SSP_CRITICAL_SECTION_EXIT;
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Stop a software timer. Stopping a timer that is not running has no effect.
+ *
+ * @param[in]  p_timer             Timer control block
+ *
+ * @retval SSP_SUCCESS             Timer stopped, its callback is not called unless it is already running.
+ * @retval SSP_ERR_ASSERTION       p_timer is NULL.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_TimerStop (bsp_timer_t * p_timer)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_timer);
+#endif
+
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    if (p_timer->running)
+    {
+        bsp_timer_wheel_remove(p_timer);
+        p_timer->running = false;
+    }
+    SSP_CRITICAL_SECTION_EXIT;
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Wait until a condition holds or a deadline passes, sleeping with WFI in between.
+ *
+ * The condition is checked before each sleep with interrupts masked, so a condition changed by an interrupt is never
+ * missed. Conditions that change without an interrupt, such as a peripheral status bit, need a poll_counts interval.
+ * In an interrupt, or with interrupts masked, the function polls the timestamp instead of sleeping.
+ *
+ * @param[in]  deadline            Timestamp at which to stop waiting
+ * @param[in]  p_condition         Condition to wait for, NULL to wait until the deadline
+ * @param[in]  p_context           Argument of p_condition
+ * @param[in]  poll_counts         Longest sleep between two checks of the condition in counts, 0 to sleep until an
+ *                                 interrupt or the deadline
+ *
+ * @retval SSP_SUCCESS             The condition holds, or the deadline passed and p_condition is NULL.
+ * @retval SSP_ERR_TIMEOUT         The deadline passed before the condition held.
+ * @retval SSP_ERR_NOT_OPEN        The service is not open.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_TimerWaitUntil (uint64_t deadline, bsp_timer_condition_t p_condition, void * p_context,
+                                uint64_t poll_counts)
+{
+    if (BSP_PRV_TIMER_OPEN != g_bsp_timer_open)
+    {
+        return SSP_ERR_NOT_OPEN;
+    }
+
+    bool        sleep = bsp_timer_sleep_allowed();
+    bsp_timer_t wakeup;
+    wakeup.running = false;
+
+    ssp_err_t err = SSP_SUCCESS;
+    uint64_t  now = 0U;
+    while (true)
+    {
+        if ((NULL != p_condition) && p_condition(p_context))
+        {
+            break;
+        }
+
+        (void) R_BSP_TimestampGet(&now);
+        if (now >= deadline)
+        {
+            err = (NULL != p_condition) ? SSP_ERR_TIMEOUT : SSP_SUCCESS;
+            break;
+        }
+
+        if ((!sleep) ||
+            ((deadline - now) < ((uint64_t) BSP_PRV_TIMER_SLEEP_MIN_TICKS << BSP_CFG_TIMER_TICK_SHIFT)))
+        {
+            continue;
+        }
+
+        /** Sleep until the deadline, the next poll or another interrupt. */
+        uint64_t wake = deadline;
+        if ((0U != poll_counts) && (poll_counts < (deadline - now)))
+        {
+            wake = now + poll_counts;
+        }
+        (void) R_BSP_TimerStart(&wakeup, wake, 0U, NULL, NULL);
+
+        SSP_CRITICAL_SECTION_DEFINE;
+        SSP_CRITICAL_SECTION_ENTER;
+        if (wakeup.running && ((NULL == p_condition) || (!p_condition(p_context))))
+        {
+            __WFI();
+        }
+        SSP_CRITICAL_SECTION_EXIT;
+    }
+
+    (void) R_BSP_TimerStop(&wakeup);
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Counter interrupt callback. Set as p_callback of the counter in bsp_timer_service_cfg_t.
+ *
+ * @param[in]  p_args              Callback arguments from the timer driver, not used
+ **********************************************************************************************************************/
+void R_BSP_TimerCounterCallback (struct st_timer_callback_args * p_args)
+{
+    SSP_PARAMETER_NOT_USED(p_args);
+
+    if (BSP_PRV_TIMER_OPEN != g_bsp_timer_open)
+    {
+        return;
+    }
+
+    /** Add the counter period to the timestamp base, unless a reading already did. */
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    if (g_bsp_timer_wrap_counted)
+    {
+        g_bsp_timer_wrap_counted = false;
+    }
+    else
+    {
+        bsp_timer_base_advance();
+    }
+    SSP_CRITICAL_SECTION_EXIT;
+
+    bsp_timer_service_process();
+}
+
+/*******************************************************************************************************************//**
+ * @brief Alarm interrupt callback. Set as p_callback of the alarm in bsp_timer_service_cfg_t.
+ *
+ * @param[in]  p_args              Callback arguments from the timer driver, not used
+ **********************************************************************************************************************/
+void R_BSP_TimerAlarmCallback (struct st_timer_callback_args * p_args)
+{
+    SSP_PARAMETER_NOT_USED(p_args);
+
+    if (BSP_PRV_TIMER_OPEN != g_bsp_timer_open)
+    {
+        return;
+    }
+
+    g_bsp_timer_alarm_armed = false;
+
+    bsp_timer_service_process();
+}
+
+/** @} (end addtogroup BSP_MCU_TIMER) */
+
+/*******************************************************************************************************************//**
+ * Open and start the counter, open the alarm and read their settings.
+ *
+ * @param[in]  p_cfg               Counter and alarm to use
+ *
+ * @retval SSP_SUCCESS             Counter counting, alarm open.
+ * @retval SSP_ERR_INVALID_ARGUMENT The configuration does not use the service callbacks or the alarm is not one-shot.
+ * @return                         Errors returned by the timer driver.
+ **********************************************************************************************************************/
+static ssp_err_t bsp_timer_hardware_open (bsp_timer_service_cfg_t const * p_cfg)
+{
+    timer_instance_t const * p_counter = p_cfg->p_counter;
+    timer_instance_t const * p_alarm   = p_cfg->p_alarm;
+
+    if (R_BSP_TimerCounterCallback != p_counter->p_cfg->p_callback)
+    {
+        return SSP_ERR_INVALID_ARGUMENT;
+    }
+    if ((NULL != p_alarm) &&
+        ((R_BSP_TimerAlarmCallback != p_alarm->p_cfg->p_callback) || (TIMER_MODE_ONE_SHOT != p_alarm->p_cfg->mode)))
+    {
+        return SSP_ERR_INVALID_ARGUMENT;
+    }
+
+    timer_info_t info;
+    ssp_err_t    err = p_counter->p_api->open(p_counter->p_ctrl, p_counter->p_cfg);
+    if (SSP_SUCCESS == err)
+    {
+        err = p_counter->p_api->infoGet(p_counter->p_ctrl, &info);
+        if ((SSP_SUCCESS == err) && (0U == info.clock_frequency))
+        {
+            err = SSP_ERR_INVALID_ARGUMENT;
+        }
+        if ((SSP_SUCCESS == err) && (TIMER_STATUS_COUNTING != info.status))
+        {
+            err = p_counter->p_api->start(p_counter->p_ctrl);
+        }
+        if (SSP_SUCCESS != err)
+        {
+            (void) p_counter->p_api->close(p_counter->p_ctrl);
+            return err;
+        }
+    }
+    else
+    {
+        return err;
+    }
+
+    /** The first counter sets the timestamp frequency. */
+    if (0U == g_bsp_timer_frequency)
+    {
+        g_bsp_timer_frequency = info.clock_frequency;
+    }
+    g_bsp_timer_counter_frequency = info.clock_frequency;
+    g_bsp_timer_counter_period    = info.period_counts;
+    if (0U == info.period_counts)
+    {
+        /* A 32-bit counter with the largest period reports 2^32 counts as 0. */
+        g_bsp_timer_counter_period = 1ULL << 32;
+    }
+    g_bsp_timer_counter_down      = (TIMER_DIRECTION_DOWN == info.count_direction);
+    gp_bsp_timer_counter          = p_counter;
+
+    gp_bsp_timer_alarm = NULL;
+    if (NULL != p_alarm)
+    {
+        err = p_alarm->p_api->open(p_alarm->p_ctrl, p_alarm->p_cfg);
+        if (SSP_SUCCESS == err)
+        {
+            err = p_alarm->p_api->infoGet(p_alarm->p_ctrl, &info);
+            if ((SSP_SUCCESS == err) && (0U == info.clock_frequency))
+            {
+                err = SSP_ERR_INVALID_ARGUMENT;
+            }
+            if (SSP_SUCCESS != err)
+            {
+                (void) p_alarm->p_api->close(p_alarm->p_ctrl);
+            }
+        }
+        if (SSP_SUCCESS != err)
+        {
+            (void) p_counter->p_api->close(p_counter->p_ctrl);
+            gp_bsp_timer_counter = NULL;
+            return err;
+        }
+
+        g_bsp_timer_alarm_frequency = info.clock_frequency;
+        gp_bsp_timer_alarm          = p_alarm;
+    }
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Close the counter and the alarm.
+ **********************************************************************************************************************/
+static void bsp_timer_hardware_close (void)
+{
+    if (NULL != gp_bsp_timer_alarm)
+    {
+        (void) gp_bsp_timer_alarm->p_api->close(gp_bsp_timer_alarm->p_ctrl);
+        gp_bsp_timer_alarm = NULL;
+    }
+    if (NULL != gp_bsp_timer_counter)
+    {
+        (void) gp_bsp_timer_counter->p_api->close(gp_bsp_timer_counter->p_ctrl);
+        gp_bsp_timer_counter = NULL;
+    }
+    g_bsp_timer_alarm_armed = false;
+}
+
+/*******************************************************************************************************************//**
+ * Empty the wheel and the expired list and mark their timers stopped. Call with interrupts masked.
+ **********************************************************************************************************************/
+static void bsp_timer_wheel_clear (void)
+{
+    for (uint32_t i = 0U; i < BSP_PRV_TIMER_LISTS; i++)
+    {
+        bsp_timer_t * p_timer = gp_bsp_timer_lists[i];
+        while (NULL != p_timer)
+        {
+            p_timer->running = false;
+            p_timer          = p_timer->p_next;
+        }
+        gp_bsp_timer_lists[i] = NULL;
+    }
+    for (uint32_t level = 0U; level < BSP_TIMER_WHEEL_LEVELS; level++)
+    {
+        g_bsp_timer_wheel_used[level] = 0U;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Convert counts of the counter in use to timestamp counts, including the fraction left from the timestamp base.
+ *
+ * @param[in]  counts              Counter counts, at most one counter period
+ *
+ * @return Timestamp counts.
+ **********************************************************************************************************************/
+static uint64_t bsp_timer_scale (uint64_t counts)
+{
+    if (g_bsp_timer_counter_frequency == g_bsp_timer_frequency)
+    {
+        return counts;
+    }
+
+    return ((counts * g_bsp_timer_frequency) + g_bsp_timer_base_remainder) / g_bsp_timer_counter_frequency;
+}
+
+/*******************************************************************************************************************//**
+ * Add one counter period to the timestamp base. Call with interrupts masked.
+ **********************************************************************************************************************/
+static void bsp_timer_base_advance (void)
+{
+    if (g_bsp_timer_counter_frequency == g_bsp_timer_frequency)
+    {
+        g_bsp_timer_base += g_bsp_timer_counter_period;
+    }
+    else
+    {
+        uint64_t scaled = (g_bsp_timer_counter_period * g_bsp_timer_frequency) + g_bsp_timer_base_remainder;
+        g_bsp_timer_base          += scaled / g_bsp_timer_counter_frequency;
+        g_bsp_timer_base_remainder = scaled % g_bsp_timer_counter_frequency;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Read the timestamp. Call with interrupts masked.
+ *
+ * @return Current timestamp.
+ **********************************************************************************************************************/
+static uint64_t bsp_timer_now (void)
+{
+    timer_size_t value = 0U;
+    if (SSP_SUCCESS != gp_bsp_timer_counter->p_api->counterGet(gp_bsp_timer_counter->p_ctrl, &value))
+    {
+        return g_bsp_timer_last;
+    }
+
+    uint64_t elapsed = value;
+    if (g_bsp_timer_counter_down)
+    {
+        elapsed = (value < g_bsp_timer_counter_period) ? ((g_bsp_timer_counter_period - 1U) - value) : 0U;
+    }
+
+    uint64_t now = g_bsp_timer_base + bsp_timer_scale(elapsed);
+    if (now < g_bsp_timer_last)
+    {
+        /** The counter wrapped and its interrupt has not run yet. Count the period it completed now. */
+        bsp_timer_base_advance();
+        g_bsp_timer_wrap_counted = true;
+        now = g_bsp_timer_base + bsp_timer_scale(elapsed);
+    }
+    g_bsp_timer_last = now;
+
+    return now;
+}
+
+/*******************************************************************************************************************//**
+ * Add a timer to the wheel slot for its expiry, relative to the tick the wheel was advanced to. A timer due at or
+ * before that tick goes to the expired list. Call with interrupts masked.
+ *
+ * @param[in]  p_timer             Timer to add
+ **********************************************************************************************************************/
+static void bsp_timer_wheel_insert (bsp_timer_t * p_timer)
+{
+    /** Round the expiry up to a tick so timers never expire early. */
+    uint64_t tick = p_timer->expiry >> BSP_CFG_TIMER_TICK_SHIFT;
+    if (0U != (p_timer->expiry & BSP_PRV_TIMER_TICK_MASK))
+    {
+        tick++;
+    }
+
+    uint64_t now = g_bsp_timer_wheel_now;
+    if (tick <= now)
+    {
+        /** Keep the expired list in expiry order. */
+        bsp_timer_t * p_prev = NULL;
+        bsp_timer_t * p_next = gp_bsp_timer_lists[BSP_PRV_TIMER_SLOT_EXPIRED];
+        while ((NULL != p_next) && (p_next->expiry <= p_timer->expiry))
+        {
+            p_prev = p_next;
+            p_next = p_next->p_next;
+        }
+        p_timer->slot   = BSP_PRV_TIMER_SLOT_EXPIRED;
+        p_timer->p_prev = p_prev;
+        p_timer->p_next = p_next;
+        if (NULL != p_next)
+        {
+            p_next->p_prev = p_timer;
+        }
+        if (NULL != p_prev)
+        {
+            p_prev->p_next = p_timer;
+        }
+        else
+        {
+            gp_bsp_timer_lists[BSP_PRV_TIMER_SLOT_EXPIRED] = p_timer;
+        }
+
+        return;
+    }
+
+    /** Use the lowest level whose slots reach the expiry. A slot is revisited when its tick range starts, so the
+     * next BSP_TIMER_WHEEL_SLOTS ranges of a level all have their own slot. Timers beyond the reach of the top level
+     * are parked in its furthest slot and placed again when it is reached. */
+    uint32_t level = 0U;
+    uint64_t index = 0U;
+    for (level = 0U; level < BSP_TIMER_WHEEL_LEVELS; level++)
+    {
+        uint32_t shift = level * BSP_PRV_TIMER_LEVEL_BITS;
+        index = tick >> shift;
+        if ((index - (now >> shift)) <= BSP_TIMER_WHEEL_SLOTS)
+        {
+            break;
+        }
+    }
+    if (level >= BSP_TIMER_WHEEL_LEVELS)
+    {
+        level = BSP_TIMER_WHEEL_LEVELS - 1U;
+        index = (now >> (level * BSP_PRV_TIMER_LEVEL_BITS)) + BSP_TIMER_WHEEL_SLOTS;
+    }
+
+    uint32_t bit  = (uint32_t) (index & BSP_PRV_TIMER_SLOT_MASK);
+    uint32_t slot = (level * BSP_TIMER_WHEEL_SLOTS) + bit;
+    p_timer->slot   = slot;
+    p_timer->p_prev = NULL;
+    p_timer->p_next = gp_bsp_timer_lists[slot];
+    if (NULL != p_timer->p_next)
+    {
+        p_timer->p_next->p_prev = p_timer;
+    }
+    gp_bsp_timer_lists[slot]       = p_timer;
+    g_bsp_timer_wheel_used[level] |= (1ULL << bit);
+}
+
+/*******************************************************************************************************************//**
+ * Remove a timer from its wheel slot or from the expired list. Call with interrupts masked.
+ *
+ * @param[in]  p_timer             Timer to remove
+ **********************************************************************************************************************/
+static void bsp_timer_wheel_remove (bsp_timer_t * p_timer)
+{
+    uint32_t slot = p_timer->slot;
+    if (NULL != p_timer->p_next)
+    {
+        p_timer->p_next->p_prev = p_timer->p_prev;
+    }
+    if (NULL != p_timer->p_prev)
+    {
+        p_timer->p_prev->p_next = p_timer->p_next;
+    }
+    else
+    {
+        gp_bsp_timer_lists[slot] = p_timer->p_next;
+        if ((NULL == p_timer->p_next) && (slot < BSP_PRV_TIMER_SLOT_EXPIRED))
+        {
+            g_bsp_timer_wheel_used[slot / BSP_TIMER_WHEEL_SLOTS] &=
+                ~(1ULL << (slot & BSP_PRV_TIMER_SLOT_MASK));
+        }
+    }
+    p_timer->p_next = NULL;
+    p_timer->p_prev = NULL;
+}
+
+/*******************************************************************************************************************//**
+ * Advance the wheel to the current time. The slots whose tick range started since the last advance are emptied and
+ * their timers placed again, which moves them to a lower level or to the expired list. At most
+ * BSP_TIMER_WHEEL_SLOTS slots are visited per level, however long ago the last advance was. Call with interrupts
+ * masked.
+ *
+ * @param[in]  now                 Current timestamp
+ **********************************************************************************************************************/
+static void bsp_timer_wheel_advance (uint64_t now)
+{
+    uint64_t old  = g_bsp_timer_wheel_now;
+    uint64_t tick = now >> BSP_CFG_TIMER_TICK_SHIFT;
+    if (tick <= old)
+    {
+        return;
+    }
+    g_bsp_timer_wheel_now = tick;
+
+    for (uint32_t level = 0U; level < BSP_TIMER_WHEEL_LEVELS; level++)
+    {
+        uint32_t shift = level * BSP_PRV_TIMER_LEVEL_BITS;
+        uint64_t first = old >> shift;
+        uint64_t last  = tick >> shift;
+        if (first == last)
+        {
+            /* Higher levels have not moved either. */
+            break;
+        }
+        if ((last - first) > BSP_TIMER_WHEEL_SLOTS)
+        {
+            first = last - BSP_TIMER_WHEEL_SLOTS;
+        }
+
+        for (uint64_t index = first + 1U; index <= last; index++)
+        {
+            uint32_t bit = (uint32_t) (index & BSP_PRV_TIMER_SLOT_MASK);
+            if (0U == (g_bsp_timer_wheel_used[level] & (1ULL << bit)))
+            {
+                continue;
+            }
+
+            uint32_t      slot    = (level * BSP_TIMER_WHEEL_SLOTS) + bit;
+            bsp_timer_t * p_timer = gp_bsp_timer_lists[slot];
+            gp_bsp_timer_lists[slot]       = NULL;
+            g_bsp_timer_wheel_used[level] &= ~(1ULL << bit);
+            while (NULL != p_timer)
+            {
+                bsp_timer_t * p_next = p_timer->p_next;
+                bsp_timer_wheel_insert(p_timer);
+                p_timer = p_next;
+            }
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Find the next tick at which the wheel has work: a timer expires or a slot has to be emptied into a lower level.
+ * Call with interrupts masked.
+ *
+ * @param[out] p_tick              Next tick with work, the current tick if timers have already expired
+ *
+ * @retval true                    A timer is running, p_tick is valid.
+ * @retval false                   No timer is running.
+ **********************************************************************************************************************/
+static bool bsp_timer_wheel_next (uint64_t * p_tick)
+{
+    if (NULL != gp_bsp_timer_lists[BSP_PRV_TIMER_SLOT_EXPIRED])
+    {
+        *p_tick = g_bsp_timer_wheel_now;
+
+        return true;
+    }
+
+    bool     found = false;
+    uint64_t next  = UINT64_MAX;
+    for (uint32_t level = 0U; level < BSP_TIMER_WHEEL_LEVELS; level++)
+    {
+        uint64_t used = g_bsp_timer_wheel_used[level];
+        if (0U == used)
+        {
+            continue;
+        }
+
+        uint32_t shift   = level * BSP_PRV_TIMER_LEVEL_BITS;
+        uint64_t current = g_bsp_timer_wheel_now >> shift;
+        for (uint64_t index = current + 1U; index <= (current + BSP_TIMER_WHEEL_SLOTS); index++)
+        {
+            if (0U != (used & (1ULL << (uint32_t) (index & BSP_PRV_TIMER_SLOT_MASK))))
+            {
+                if ((index << shift) < next)
+                {
+                    next = index << shift;
+                }
+                found = true;
+                break;
+            }
+        }
+    }
+
+    *p_tick = next;
+
+    return found;
+}
+
+/*******************************************************************************************************************//**
+ * Program the alarm for the next tick with work, unless it is already programmed for that tick or an earlier one.
+ * Does nothing without an alarm; the counter interrupt checks the wheel then. Call with interrupts masked.
+ *
+ * @param[in]  now                 Current timestamp
+ **********************************************************************************************************************/
+static void bsp_timer_alarm_arm (uint64_t now)
+{
+    timer_instance_t const * p_alarm = gp_bsp_timer_alarm;
+    if (NULL == p_alarm)
+    {
+        return;
+    }
+
+    uint64_t tick = 0U;
+    if (!bsp_timer_wheel_next(&tick))
+    {
+        if (g_bsp_timer_alarm_armed)
+        {
+            (void) p_alarm->p_api->stop(p_alarm->p_ctrl);
+            g_bsp_timer_alarm_armed = false;
+        }
+
+        return;
+    }
+    if (g_bsp_timer_alarm_armed && (g_bsp_timer_alarm_tick <= tick))
+    {
+        return;
+    }
+
+    /** Convert the time left to alarm counts. A delay longer than the alarm can count makes it fire early; the wheel
+     * is then checked and the alarm programmed again. */
+    uint64_t target = tick << BSP_CFG_TIMER_TICK_SHIFT;
+    uint64_t delay  = (target > now) ? (target - now) : 1U;
+    if (delay > UINT32_MAX)
+    {
+        delay = UINT32_MAX;
+    }
+    uint64_t counts = (delay * g_bsp_timer_alarm_frequency) / g_bsp_timer_frequency;
+    if (counts > UINT32_MAX)
+    {
+        counts = UINT32_MAX;
+    }
+    if (0U == counts)
+    {
+        counts = 1U;
+    }
+
+    /** Halve the count until the driver accepts it, for alarms narrower than 32 bits. */
+    timer_size_t period = (timer_size_t) counts;
+    while ((SSP_SUCCESS != p_alarm->p_api->periodSet(p_alarm->p_ctrl, period, TIMER_UNIT_PERIOD_RAW_COUNTS)) &&
+           (period > 1U))
+    {
+        period >>= 1;
+    }
+    (void) p_alarm->p_api->start(p_alarm->p_ctrl);
+
+    g_bsp_timer_alarm_tick  = tick;
+    g_bsp_timer_alarm_armed = true;
+}
+
+/*******************************************************************************************************************//**
+ * Call the callbacks of the expired timers in expiry order. Interrupts are enabled while a callback runs; the timer
+ * is taken off the expired list first, so a callback can start or stop any timer.
+ *
+ * @param[in]  now                 Timestamp the wheel was advanced to
+ **********************************************************************************************************************/
+static void bsp_timer_expired_run (uint64_t now)
+{
+    SSP_CRITICAL_SECTION_DEFINE;
+    while (true)
+    {
+        SSP_CRITICAL_SECTION_ENTER;
+
+        bsp_timer_t * p_timer = gp_bsp_timer_lists[BSP_PRV_TIMER_SLOT_EXPIRED];
+        if (NULL == p_timer)
+        {
+            SSP_CRITICAL_SECTION_EXIT;
+            break;
+        }
+        bsp_timer_wheel_remove(p_timer);
+
+        bsp_timer_callback_t p_callback = p_timer->p_callback;
+        void               * p_context  = p_timer->p_context;
+        if (0U != p_timer->period)
+        {
+            /** Restart a periodic timer, skipping the periods already missed. */
+            p_timer->expiry += p_timer->period;
+            if (p_timer->expiry <= now)
+            {
+                p_timer->expiry += (((now - p_timer->expiry) / p_timer->period) + 1U) * p_timer->period;
+            }
+            bsp_timer_wheel_insert(p_timer);
+        }
+        else
+        {
+            p_timer->running = false;
+        }
+
+        SSP_CRITICAL_SECTION_EXIT;
+
+        if (NULL != p_callback)
+        {
+            p_callback(p_timer, p_context);
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Advance the wheel, call the callbacks of the expired timers and program the alarm for the next one. Called from the
+ * counter and alarm interrupts.
+ **********************************************************************************************************************/
+static void bsp_timer_service_process (void)
+{
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    uint64_t now = bsp_timer_now();
+    bsp_timer_wheel_advance(now);
+    SSP_CRITICAL_SECTION_EXIT;
+
+    bsp_timer_expired_run(now);
+
+    SSP_CRITICAL_SECTION_ENTER;
+    if (BSP_PRV_TIMER_OPEN == g_bsp_timer_open)
+    {
+        bsp_timer_alarm_arm(bsp_timer_now());
+    }
+    SSP_CRITICAL_SECTION_EXIT;
+}
+
+/*******************************************************************************************************************//**
+ * Check whether the caller may sleep: it runs in thread mode with interrupts enabled, so the interrupts that end the
+ * sleep can run.
+ *
+ * @retval true                    WFI can be used.
+ * @retval false                   Called from an interrupt or with interrupts masked.
+ **********************************************************************************************************************/
+static bool bsp_timer_sleep_allowed (void)
+{
+    if ((0U != __get_IPSR()) || (0U != __get_PRIMASK()))
+    {
+        return false;
+    }
+#if (__CORTEX_M >= 3U)
+    if (0U != __get_BASEPRI())
+    {
+        return false;
+    }
+#endif
+
+    return true;
+}
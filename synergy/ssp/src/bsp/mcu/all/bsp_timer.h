@@ -0,0 +1,112 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+/***********************************************************************************************************************
+* File Name    : bsp_timer.h
+* Description  : Timer service implemented by the BSP: monotonic timestamp, software timers and timed waits.
+***********************************************************************************************************************/
+
+#ifndef BSP_TIMER_H_
+#define BSP_TIMER_H_
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+
+/* Common macro for SSP header files. There is also a corresponding SSP_FOOTER macro at the end of this file. */
+SSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @ingroup BSP_MCU_COMMON
+ * @defgroup BSP_MCU_TIMER Timer Service
+ * @brief Monotonic timestamp, software timers and timed waits on one hardware timer
+ *
+ * The service extends a free-running timer_api_t counter (a 32-bit GPT channel, or an AGT channel in low-power modes)
+ * to a 64-bit timestamp that never wraps. Time is counted in ticks of the counter opened by R_BSP_TimerServiceOpen();
+ * R_BSP_TimerCountsGet() converts a delay to counts.
+ *
+ * Software timers are kept in a hierarchical timer wheel, so starting and stopping take constant time. When the
+ * service is given an alarm timer (a second timer_api_t channel in one-shot mode), the alarm is programmed for the
+ * next timer due and no interrupt occurs while no timer is due. Without an alarm, timers are checked on each counter
+ * overflow, so the counter period sets their resolution.
+ *
+ * R_BSP_TimerWaitUntil() sleeps with WFI until a deadline or until a condition holds, so interrupts and other threads
+ * can use the CPU during the wait. R_BSP_SoftwareDelay() and the driver polling loops use it once the service is open.
+ *
+ * @{
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+#define BSP_TIMER_WHEEL_LEVELS      (4U)       ///< Number of levels in the timer wheel
+#define BSP_TIMER_WHEEL_SLOTS       (64U)      ///< Number of slots in each level of the timer wheel
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+struct st_timer_instance;
+struct st_timer_callback_args;
+struct st_bsp_timer;
+
+/** Software timer callback. Called from the interrupt of the counter or alarm timer. */
+typedef void (* bsp_timer_callback_t)(struct st_bsp_timer * p_timer, void * p_context);
+
+/** Wait condition for R_BSP_TimerWaitUntil(). Called with interrupts masked, so it must only read state. */
+typedef bool (* bsp_timer_condition_t)(void * p_context);
+
+/** Timer service configuration. */
+typedef struct st_bsp_timer_service_cfg
+{
+    /** Free-running counter, opened and started by the service. Configure it in periodic mode with its p_callback
+     *  set to R_BSP_TimerCounterCallback(). */
+    struct st_timer_instance const * p_counter;
+
+    /** Alarm used to wake up when the next software timer is due, opened by the service. Configure it in one-shot
+     *  mode, without autostart, with its p_callback set to R_BSP_TimerAlarmCallback(). Set to NULL to check the
+     *  software timers on each counter overflow instead. */
+    struct st_timer_instance const * p_alarm;
+} bsp_timer_service_cfg_t;
+
+/** Software timer. Allocated by the caller and only accessed by the timer functions while it is running. */
+typedef struct st_bsp_timer
+{
+    struct st_bsp_timer * p_next;      ///< Next timer in the same wheel slot
+    struct st_bsp_timer * p_prev;      ///< Previous timer in the same wheel slot
+    uint64_t              expiry;      ///< Timestamp at which the timer expires
+    uint64_t              period;      ///< Reload period in counts, 0 for a one-shot timer
+    bsp_timer_callback_t  p_callback;  ///< Called on expiry, may be NULL
+    void                * p_context;   ///< Second argument of p_callback
+    uint32_t              slot;        ///< Wheel slot holding the timer
+    volatile bool         running;     ///< True from R_BSP_TimerStart() until the timer expires or is stopped
+} bsp_timer_t;
+
+/***********************************************************************************************************************
+Exported global variables
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Exported global functions (to be accessed by other files)
+***********************************************************************************************************************/
+
+/** @} (end defgroup BSP_MCU_TIMER) */
+
+/* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
+SSP_FOOTER
+
+#endif /* BSP_TIMER_H_ */
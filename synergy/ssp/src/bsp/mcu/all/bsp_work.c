@@ -0,0 +1,459 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+/***********************************************************************************************************************
+* File Name    : bsp_work.c
+* Description  : Deferred work scheduler with lock-free per-priority queues.
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include <string.h>
+#include "bsp_api.h"
+#include "bsp_atomic.h"
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+/* Defaults for configurations generated before the scheduler was added. */
+#ifndef BSP_CFG_WORK_PRIORITIES
+#define BSP_CFG_WORK_PRIORITIES         (4)
+#endif
+#ifndef BSP_CFG_WORK_SLOTS
+#define BSP_CFG_WORK_SLOTS              (16)
+#endif
+
+#if (BSP_CFG_WORK_PRIORITIES < 1) || (BSP_CFG_WORK_SLOTS < 1) || (BSP_CFG_WORK_SLOTS > 0xFFFF)
+#error "BSP_CFG_WORK_PRIORITIES must be at least 1 and BSP_CFG_WORK_SLOTS must be 1 to 65535."
+#endif
+
+/* Queue heads and links hold the 1-based index of a work slot, 0 for none. The free list is a tagged list of
+ * bsp_atomic.h. */
+#define BSP_PRV_WORK_ARGS_WORDS         (BSP_WORK_ARGS_MAX_BYTES / sizeof(uint64_t))
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+/** Posted work and the copy of its arguments. */
+typedef struct st_bsp_work_slot
+{
+    volatile uint32_t    next;                             ///< Next slot in the queue or free list
+    bsp_work_function_t  p_function;                       ///< Function to run
+    void               * p_context;                        ///< First argument of p_function
+    uint64_t             args[BSP_PRV_WORK_ARGS_WORDS];    ///< Copy of the arguments, 8 byte aligned
+} bsp_work_slot_t;
+
+/***********************************************************************************************************************
+Private function prototypes
+***********************************************************************************************************************/
+static uint32_t  bsp_work_slot_alloc(void);
+static void      bsp_work_slot_free(uint32_t index);
+static void      bsp_work_queue_push(volatile uint32_t * p_head, uint32_t index);
+static uint32_t  bsp_work_queue_take(volatile uint32_t * p_head);
+static bool      bsp_work_pending(void);
+
+/***********************************************************************************************************************
+Exported global variables (to be accessed by other files)
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Private global variables and functions
+***********************************************************************************************************************/
+/** Work slots. Slot index i + 1 refers to g_bsp_work_slots[i]. */
+static bsp_work_slot_t g_bsp_work_slots[BSP_CFG_WORK_SLOTS];
+
+/** Posted work of each priority, most recently posted first. Interrupts push, R_BSP_WorkRunPending() takes all. */
+static volatile uint32_t g_bsp_work_posted[BSP_CFG_WORK_PRIORITIES];
+
+/** Work of each priority taken from g_bsp_work_posted, in posting order. Only used by R_BSP_WorkRunPending(). */
+static uint32_t g_bsp_work_ready[BSP_CFG_WORK_PRIORITIES];
+
+/** Update tag and first slot of the free list. Slots are added to it once they have run. */
+static volatile uint32_t g_bsp_work_free = 0U;
+
+/** Number of slots handed out at least once. Slots beyond this count have never been used and are not linked. */
+static volatile uint32_t g_bsp_work_fresh = 0U;
+
+/** Slots currently posted or running. */
+static volatile uint32_t g_bsp_work_used = 0U;
+
+/** Statistics returned by R_BSP_WorkStatsGet(). */
+static volatile bsp_work_stats_t g_bsp_work_stats;
+
+/** Set while R_BSP_WorkRunPending() runs, so a work function calling it does not run work out of order. */
+static volatile bool g_bsp_work_running = false;
+
+/*******************************************************************************************************************//**
+ * @addtogroup BSP_MCU_WORK
+ *
+ * @{
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @brief Post work to run later in thread mode.
+ *
+ * The arguments are copied, so p_args can point to a local variable of the caller. Can be called from any interrupt
+ * priority and from threads.
+ *
+ * @param[in]  p_function          Function to run
+ * @param[in]  p_context           First argument of p_function, not copied
+ * @param[in]  p_args              Arguments to copy, may be NULL if args_bytes is 0
+ * @param[in]  args_bytes          Size of the arguments, at most BSP_WORK_ARGS_MAX_BYTES
+ * @param[in]  priority            Queue to post to, 0 is the most urgent and BSP_CFG_WORK_PRIORITIES - 1 the least
+ *
+ * @retval SSP_SUCCESS             Work posted.
+ * @retval SSP_ERR_ASSERTION       p_function is NULL, or p_args is NULL and args_bytes is not 0.
+ * @retval SSP_ERR_INVALID_SIZE    args_bytes is larger than BSP_WORK_ARGS_MAX_BYTES.
+ * @retval SSP_ERR_INVALID_ARGUMENT priority is not a configured priority.
+ * @retval SSP_ERR_OUT_OF_MEMORY   All BSP_CFG_WORK_SLOTS work slots are in use.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_WorkPost (bsp_work_function_t p_function, void * p_context, void const * p_args, uint32_t args_bytes,
+                          uint32_t priority)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_function);
+    SSP_ASSERT((NULL != p_args) || (0U == args_bytes));
+#endif
+
+    if (args_bytes > BSP_WORK_ARGS_MAX_BYTES)
+    {
+        return SSP_ERR_INVALID_SIZE;
+    }
+    if (priority >= (uint32_t) BSP_CFG_WORK_PRIORITIES)
+    {
+        return SSP_ERR_INVALID_ARGUMENT;
+    }
+
+    uint32_t index = bsp_work_slot_alloc();
+    if (0U == index)
+    {
+        (void) bsp_atomic_add(&g_bsp_work_stats.failures, 1U);
+
+        return SSP_ERR_OUT_OF_MEMORY;
+    }
+
+    /** Fill the slot before it is queued. Only this context can access it until then. */
+    bsp_work_slot_t * p_slot = &g_bsp_work_slots[index - 1U];
+    p_slot->p_function = p_function;
+    p_slot->p_context  = p_context;
+    if (0U != args_bytes)
+    {
+        memcpy(&p_slot->args[0], p_args, args_bytes);
+    }
+
+    (void) bsp_atomic_add(&g_bsp_work_stats.posted, 1U);
+    bsp_work_queue_push(&g_bsp_work_posted[priority], index);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Run a function now, or post it to run later in thread mode.
+ *
+ * Used by drivers to call their user callback from an interrupt or, with a deferred_callback setting, from thread
+ * mode. Deferred work is never run in the calling context: if all work slots are in use, the event is dropped and
+ * counted in bsp_work_stats_t::dropped, so earlier events still queued are not overtaken. Other errors are those of
+ * R_BSP_WorkPost().
+ *
+ * @param[in]  defer               true to post the work, false to call p_function before returning
+ * @param[in]  p_function          Function to run
+ * @param[in]  p_context           First argument of p_function, not copied
+ * @param[in]  p_args              Arguments, copied if the work is posted
+ * @param[in]  args_bytes          Size of the arguments, at most BSP_WORK_ARGS_MAX_BYTES
+ * @param[in]  priority            Queue to post to, 0 is the most urgent and BSP_CFG_WORK_PRIORITIES - 1 the least
+ *
+ * @retval SSP_SUCCESS             Work run or posted.
+ * @retval SSP_ERR_ASSERTION       p_function is NULL.
+ * @retval SSP_ERR_OUT_OF_MEMORY   All work slots are in use. The event was dropped.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_WorkPostOrCall (bool defer, bsp_work_function_t p_function, void * p_context, void * p_args,
+                                uint32_t args_bytes, uint32_t priority)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_function);
+#endif
+
+    if (!defer)
+    {
+        p_function(p_context, p_args);
+
+        return SSP_SUCCESS;
+    }
+
+    ssp_err_t err = R_BSP_WorkPost(p_function, p_context, p_args, args_bytes, priority);
+    if (SSP_ERR_OUT_OF_MEMORY == err)
+    {
+        (void) bsp_atomic_add(&g_bsp_work_stats.dropped, 1U);
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Run posted work until all queues are empty.
+ *
+ * Work runs to completion in thread mode, most urgent priority first. After each item the queues are checked again
+ * from the most urgent priority, so urgent work posted meanwhile runs next. Call from one thread only, for example
+ * the main loop. A call from a work function returns 0 without running anything.
+ *
+ * @return Number of work items run.
+ **********************************************************************************************************************/
+uint32_t R_BSP_WorkRunPending (void)
+{
+    if (g_bsp_work_running)
+    {
+        return 0U;
+    }
+    g_bsp_work_running = true;
+
+    uint32_t run      = 0U;
+    uint32_t priority = 0U;
+    while (priority < (uint32_t) BSP_CFG_WORK_PRIORITIES)
+    {
+        /** Refill the ready list of a priority from its posted queue once it is empty. */
+        if ((0U == g_bsp_work_ready[priority]) && (0U != g_bsp_work_posted[priority]))
+        {
+            g_bsp_work_ready[priority] = bsp_work_queue_take(&g_bsp_work_posted[priority]);
+        }
+
+        uint32_t index = g_bsp_work_ready[priority];
+        if (0U == index)
+        {
+            priority++;
+            continue;
+        }
+
+        bsp_work_slot_t * p_slot = &g_bsp_work_slots[index - 1U];
+        g_bsp_work_ready[priority] = p_slot->next;
+
+        p_slot->p_function(p_slot->p_context, &p_slot->args[0]);
+
+        bsp_work_slot_free(index);
+        g_bsp_work_stats.run++;
+        run++;
+
+        /** Start over from the most urgent priority. */
+        priority = 0U;
+    }
+
+    g_bsp_work_running = false;
+
+    return run;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Run posted work forever and sleep with WFI while there is none.
+ *
+ * Interrupts are masked between the last check for work and WFI. A pending interrupt still ends WFI, so work posted
+ * by an interrupt in that window is not left waiting for the next one. Call from one thread only; this function does
+ * not return.
+ **********************************************************************************************************************/
+void R_BSP_WorkLoop (void)
+{
+    while (true)
+    {
+        (void) R_BSP_WorkRunPending();
+
+        SSP_CRITICAL_SECTION_DEFINE;
+        SSP_CRITICAL_SECTION_ENTER;
+        if (!bsp_work_pending())
+        {
+            __WFI();
+        }
+        SSP_CRITICAL_SECTION_EXIT;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @brief Get the scheduler statistics.
+ *
+ * @param[out] p_stats             Statistics
+ *
+ * @retval SSP_SUCCESS             Statistics stored in p_stats.
+ * @retval SSP_ERR_ASSERTION       p_stats is NULL.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_WorkStatsGet (bsp_work_stats_t * p_stats)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_stats);
+#endif
+
+    p_stats->posted         = g_bsp_work_stats.posted;
+    p_stats->run            = g_bsp_work_stats.run;
+    p_stats->failures       = g_bsp_work_stats.failures;
+    p_stats->dropped        = g_bsp_work_stats.dropped;
+    p_stats->slots_used_max = g_bsp_work_stats.slots_used_max;
+
+    return SSP_SUCCESS;
+}
+
+/** @} (end addtogroup BSP_MCU_WORK) */
+
+/*******************************************************************************************************************//**
+ * Take a free work slot. Slots that have run are reused first; slots that were never used are handed out after them.
+ *
+ * @return 1-based index of the slot, 0 if all slots are in use.
+ **********************************************************************************************************************/
+static uint32_t bsp_work_slot_alloc (void)
+{
+    uint32_t index = bsp_atomic_list_pop(&g_bsp_work_free, &g_bsp_work_slots[0].next, sizeof(bsp_work_slot_t));
+
+    if (0U == index)
+    {
+#if defined(BSP_ATOMIC_EXCLUSIVE)
+        uint32_t fresh;
+        do
+        {
+            fresh = __LDREXW(&g_bsp_work_fresh);
+            if (fresh >= (uint32_t) BSP_CFG_WORK_SLOTS)
+            {
+                __CLREX();
+                return 0U;
+            }
+        } while (BSP_ATOMIC_STREX_SUCCESS != __STREXW(fresh + 1U, &g_bsp_work_fresh));
+        index = fresh + 1U;
+#else
+        SSP_CRITICAL_SECTION_DEFINE;
+        SSP_CRITICAL_SECTION_ENTER;
+        if (g_bsp_work_fresh < (uint32_t) BSP_CFG_WORK_SLOTS)
+        {
+            g_bsp_work_fresh++;
+            index = g_bsp_work_fresh;
+        }
+        SSP_CRITICAL_SECTION_EXIT;
+
+        if (0U == index)
+        {
+            return 0U;
+        }
+#endif
+    }
+
+    bsp_atomic_max(&g_bsp_work_stats.slots_used_max, bsp_atomic_add(&g_bsp_work_used, 1U));
+
+    return index;
+}
+
+/*******************************************************************************************************************//**
+ * Return a work slot to the free list.
+ *
+ * @param[in]  index               1-based index of the slot
+ **********************************************************************************************************************/
+static void bsp_work_slot_free (uint32_t index)
+{
+    /* Count the slot as free before another context can take it, so the count never exceeds the number of slots. */
+    (void) bsp_atomic_add(&g_bsp_work_used, UINT32_MAX);
+
+    bsp_atomic_list_push(&g_bsp_work_free, &g_bsp_work_slots[0].next, sizeof(bsp_work_slot_t), index);
+}
+
+/*******************************************************************************************************************//**
+ * Add a slot to the front of a posted queue. Any number of contexts can push at the same time.
+ *
+ * @param[in]  p_head              Head of the posted queue
+ * @param[in]  index               1-based index of the slot
+ **********************************************************************************************************************/
+static void bsp_work_queue_push (volatile uint32_t * p_head, uint32_t index)
+{
+    volatile uint32_t * p_link = &g_bsp_work_slots[index - 1U].next;
+
+#if defined(BSP_ATOMIC_EXCLUSIVE)
+    uint32_t head;
+    bool     retry;
+    do
+    {
+        head    = *p_head;
+        *p_link = head;
+
+        retry = true;
+        if (head == __LDREXW(p_head))
+        {
+            retry = (BSP_ATOMIC_STREX_SUCCESS != __STREXW(index, p_head));
+        }
+        else
+        {
+            __CLREX();
+        }
+    } while (retry);
+#else
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    *p_link = *p_head;
+    *p_head = index;
+    SSP_CRITICAL_SECTION_EXIT;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Empty a posted queue and return its slots in posting order. Only R_BSP_WorkRunPending() takes from the queues, so
+ * a slot cannot be taken and pushed back between the load and the store, and the queue head needs no update tag.
+ *
+ * @param[in]  p_head              Head of the posted queue
+ *
+ * @return 1-based index of the oldest slot, linked to the following ones, or 0 if the queue was empty.
+ **********************************************************************************************************************/
+static uint32_t bsp_work_queue_take (volatile uint32_t * p_head)
+{
+    uint32_t head;
+
+#if defined(BSP_ATOMIC_EXCLUSIVE)
+    do
+    {
+        head = __LDREXW(p_head);
+    } while (BSP_ATOMIC_STREX_SUCCESS != __STREXW(0U, p_head));
+#else
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    head    = *p_head;
+    *p_head = 0U;
+    SSP_CRITICAL_SECTION_EXIT;
+#endif
+
+    /** Reverse the list, which is most recent first. */
+    uint32_t ordered = 0U;
+    while (0U != head)
+    {
+        bsp_work_slot_t * p_slot = &g_bsp_work_slots[head - 1U];
+        uint32_t          next   = p_slot->next;
+        p_slot->next = ordered;
+        ordered      = head;
+        head         = next;
+    }
+
+    return ordered;
+}
+
+/*******************************************************************************************************************//**
+ * Check whether any work is posted or ready.
+ *
+ * @retval true                    Work is waiting to run.
+ * @retval false                   All queues are empty.
+ **********************************************************************************************************************/
+static bool bsp_work_pending (void)
+{
+    for (uint32_t priority = 0U; priority < (uint32_t) BSP_CFG_WORK_PRIORITIES; priority++)
+    {
+        if ((0U != g_bsp_work_posted[priority]) || (0U != g_bsp_work_ready[priority]))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,86 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+/***********************************************************************************************************************
+* File Name    : bsp_work.h
+* Description  : Deferred work scheduler implemented by the BSP.
+***********************************************************************************************************************/
+
+#ifndef BSP_WORK_H_
+#define BSP_WORK_H_
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+
+/* Common macro for SSP header files. There is also a corresponding SSP_FOOTER macro at the end of this file. */
+SSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @ingroup BSP_MCU_COMMON
+ * @defgroup BSP_MCU_WORK Deferred Work
+ * @brief Run-to-completion scheduler for work posted from interrupts
+ *
+ * Interrupt handlers post a function and a copy of its arguments with R_BSP_WorkPost(). The work runs later in thread
+ * mode, from R_BSP_WorkRunPending() or R_BSP_WorkLoop(), most urgent priority first and in posting order within a
+ * priority. Each priority has its own queue. Posting is lock-free: it uses exclusive load and store instructions and
+ * never masks interrupts, so it can be used from any interrupt priority.
+ *
+ * Drivers with a deferred_callback setting in their configuration use this scheduler to run their user callback
+ * outside the interrupt, through R_BSP_WorkPostOrCall(). A callback that cannot be posted because all work slots are
+ * in use is dropped and counted rather than run in the interrupt, so callbacks always run in the order of the events.
+ *
+ * @{
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+#define BSP_WORK_ARGS_MAX_BYTES     (32U)      ///< Maximum size of the arguments copied by R_BSP_WorkPost()
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+/** Work function. p_args points to the copy of the arguments made when the work was posted; it is valid until the
+ *  function returns. */
+typedef void (* bsp_work_function_t)(void * p_context, void * p_args);
+
+/** Scheduler statistics. */
+typedef struct st_bsp_work_stats
+{
+    uint32_t  posted;                  ///< Work items posted
+    uint32_t  run;                     ///< Work items run
+    uint32_t  failures;                ///< Posts rejected because all work slots were in use
+    uint32_t  dropped;                 ///< Events of R_BSP_WorkPostOrCall() dropped as all slots were in use
+    uint32_t  slots_used_max;          ///< Highest number of work slots in use at the same time
+} bsp_work_stats_t;
+
+/***********************************************************************************************************************
+Exported global variables
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Exported global functions (to be accessed by other files)
+***********************************************************************************************************************/
+
+/** @} (end defgroup BSP_MCU_WORK) */
+
+/* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
+SSP_FOOTER
+
+#endif /* BSP_WORK_H_ */
@@ -0,0 +1,2277 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+/***********************************************************************************************************************
+* File Name    : bsp_sim.c
+* Description  : Host simulation of the S5D9 register space, NVIC and ICU for the s5d9_sdk_host build.
+***********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+/* REG_EFL in ucontext_t is a GNU extension. */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include "bsp_api.h"
+
+#if defined(BSP_HOST_SIM)
+#include <signal.h>
+#include <stddef.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE             (0x100000)
+#endif
+
+/** Write traps single-step the faulting store with the x86 trap flag. */
+#if defined(__x86_64__)
+#define BSP_SIM_TRAP_SUPPORTED          (1)
+#define BSP_SIM_TRAP_FLAG               (0x100)
+#define BSP_SIM_TRAP_ERR_WRITE          (0x2)           ///< Page fault error code bit set for write accesses
+#else
+#define BSP_SIM_TRAP_SUPPORTED          (0)
+#endif
+
+/** Number of external interrupts handled by the simulated NVIC. */
+#define BSP_SIM_NVIC_IRQ_COUNT          (BSP_VECTOR_TABLE_MAX_ENTRIES)
+
+/** Number of 32-bit words in the NVIC enable/pending/active bitmaps. */
+#define BSP_SIM_NVIC_WORDS              ((BSP_SIM_NVIC_IRQ_COUNT + 31U) / 32U)
+
+/** Number of IELSRn registers in the ICU. */
+#define BSP_SIM_ICU_IELSR_COUNT         (sizeof(R_ICU->IELSRn) / sizeof(R_ICU->IELSRn[0]))
+
+/** IELSRn fields. */
+#define BSP_SIM_IELSR_IELS_MASK         (0x1FFUL)
+#define BSP_SIM_IELSR_IR                (1UL << 16)
+#define BSP_SIM_IELSR_DTCE              (1UL << 24)
+
+/** Execution priority when no exception is active, lower than any configurable priority. */
+#define BSP_SIM_PRIORITY_THREAD         (0x100U)
+
+/** NVIC priority registers implement the upper __NVIC_PRIO_BITS bits of each byte. */
+#define BSP_SIM_PRIORITY_SHIFT          (8U - __NVIC_PRIO_BITS)
+
+/** Reset values of the SYSTEM registers read back by the CGC driver. */
+#define BSP_SIM_SYSTEM_SCKDIVCR_RESET   (0x44044444UL)
+#define BSP_SIM_SYSTEM_SCKSCR_RESET     (0x01U)
+#define BSP_SIM_SYSTEM_MOSCCR_RESET     (0x01U)
+#define BSP_SIM_SYSTEM_PLLCR_RESET      (0x01U)
+
+/** Reset values of the SCI registers: TDRE and TEND set, bit rate registers at maximum. */
+#define BSP_SIM_SCI_CHANNELS            (10U)
+#define BSP_SIM_SCI_STRIDE              (R_SCI1_BASE - R_SCI0_BASE)
+#define BSP_SIM_SCI_SSR_RESET           (0x84U)
+#define BSP_SIM_SCI_SSR_DR              (0x01U)
+#define BSP_SIM_SCI_SSR_ORER            (0x20U)
+#define BSP_SIM_SCI_SSR_RDF             (0x40U)
+#define BSP_SIM_SCI_SSR_RDRF            (0x40U)
+#define BSP_SIM_SCI_SSR_FLAGS           (0xF8U)
+#define BSP_SIM_SCI_FIFO_DEPTH          (16U)
+#define BSP_SIM_SCI_EVENT_STRIDE        (ELC_EVENT_SCI1_RXI - ELC_EVENT_SCI0_RXI)
+#define BSP_SIM_SCI_BRR_RESET           (0xFFU)
+#define BSP_SIM_SCI_MDDR_RESET          (0xFFU)
+#define BSP_SIM_CRC_GPS_COUNT           (6U)            ///< CRCCR0.GPS encodings, 0 selects no polynomial
+#define BSP_SIM_DMAC_CHANNELS           (8U)
+#define BSP_SIM_DMAC_STRIDE             (R_DMAC1_BASE - R_DMAC0_BASE)
+#define BSP_SIM_DMAC_MODE_NORMAL        (0U)
+#define BSP_SIM_DMAC_TRIGGER_EVENT      (1U)            ///< DMTMD.DCTG: activated by the event DELSRn selects
+#define BSP_SIM_DMAC_MODE_BLOCK         (2U)
+#define BSP_SIM_DMAC_AREA_DEST          (0U)            ///< DMTMD.DTS: destination is the repeat or block area
+#define BSP_SIM_DMAC_AREA_SRC           (1U)            ///< DMTMD.DTS: source is the repeat or block area
+#define BSP_SIM_DMAC_ADDR_OFFSET        (1U)            ///< DMAMD.SM/DM encodings
+#define BSP_SIM_DMAC_ADDR_INCREMENT     (2U)
+#define BSP_SIM_DMAC_ADDR_DECREMENT     (3U)
+#define BSP_SIM_DMAC_BLOCK_MAX          (1024U)         ///< Block size used when DMCRAL is 0 in block mode
+#define BSP_SIM_DMAC_OFFSET_SIGN        (1UL << 24)     ///< DMOFR holds a 25-bit signed offset
+#define BSP_SIM_EVENT_QUEUE_DEPTH       (16U)
+#define BSP_SIM_ETHER_CHANNELS          (1U)            ///< ETHERC channels with an EINT event
+#define BSP_SIM_ETHER_STRIDE            (R_EDMAC1_BASE - R_EDMAC0_BASE)
+#define BSP_SIM_ETHER_ETHERC_OFFSET     (R_ETHERC0_BASE - R_EDMAC0_BASE)
+#define BSP_SIM_ETHER_FRAME_MAX         (2048U)         ///< Longest frame assembled from transmit descriptors
+#define BSP_SIM_ETHER_FRAME_MIN         (60U)           ///< Shorter frames are received as too short
+#define BSP_SIM_ETHER_RFLR_DEFAULT      (1518U)         ///< Maximum frame length when RFLR is 0
+#define BSP_SIM_ETHER_IPGR_RESET        (0x14U)
+#define BSP_SIM_ETHER_EDMR_SWR          (1UL << 0)
+#define BSP_SIM_ETHER_EDTRR_TR          (1UL << 0)
+#define BSP_SIM_ETHER_EDRRR_RR          (1UL << 0)
+#define BSP_SIM_ETHER_RMCR_RNR          (1UL << 0)
+#define BSP_SIM_ETHER_EESR_RDE          (1UL << 17)
+#define BSP_SIM_ETHER_EESR_FR           (1UL << 18)
+#define BSP_SIM_ETHER_EESR_TDE          (1UL << 20)
+#define BSP_SIM_ETHER_EESR_TC           (1UL << 21)
+#define BSP_SIM_ETHER_ECMR_PRM          (1UL << 0)
+#define BSP_SIM_ETHER_ECMR_ILB          (1UL << 3)
+#define BSP_SIM_ETHER_ECMR_TE           (1UL << 5)
+#define BSP_SIM_ETHER_ECMR_RE           (1UL << 6)
+#define BSP_SIM_ETHER_DESC_ACT          (1UL << 31)     ///< Descriptor status bits
+#define BSP_SIM_ETHER_DESC_DLE          (1UL << 30)
+#define BSP_SIM_ETHER_DESC_FP1          (1UL << 29)
+#define BSP_SIM_ETHER_DESC_FP0          (1UL << 28)
+#define BSP_SIM_ETHER_DESC_FE           (1UL << 27)
+#define BSP_SIM_ETHER_RFS_RTSF          (1UL << 2)      ///< Receive frame status: too short
+#define BSP_SIM_ETHER_RFS_RTLF          (1UL << 3)      ///< Receive frame status: too long
+#define BSP_SIM_ETHER_RFS_RMAF          (1UL << 7)      ///< Receive frame status: multicast address
+#define BSP_SIM_PDC_FIFO_WORDS          (64U)           ///< PDC receive FIFO, 8 stages of 8 words
+#define BSP_SIM_PDC_STAGE_WORDS         (8U)            ///< Words per receive data ready request
+#define BSP_SIM_PDC_PCCR0_PRST          (1UL << 3)
+#define BSP_SIM_PDC_PCCR0_DFIE          (1UL << 4)
+#define BSP_SIM_PDC_PCCR0_FEIE          (1UL << 5)
+#define BSP_SIM_PDC_PCCR0_OVIE          (1UL << 6)
+#define BSP_SIM_PDC_PCCR0_UDRIE         (1UL << 7)
+#define BSP_SIM_PDC_PCCR0_VERIE         (1UL << 8)
+#define BSP_SIM_PDC_PCCR0_HERIE         (1UL << 9)
+#define BSP_SIM_PDC_PCCR0_EDS           (1UL << 14)
+#define BSP_SIM_PDC_PCCR1_PCE           (1UL << 0)
+#define BSP_SIM_PDC_PCSR_FBSY           (1UL << 0)
+#define BSP_SIM_PDC_PCSR_FEMPF          (1UL << 1)
+#define BSP_SIM_PDC_PCSR_FEF            (1UL << 2)
+#define BSP_SIM_PDC_PCSR_OVRF           (1UL << 3)
+#define BSP_SIM_PDC_PCSR_UDRF           (1UL << 4)
+#define BSP_SIM_PDC_PCSR_VERF           (1UL << 5)
+#define BSP_SIM_PDC_PCSR_HERF           (1UL << 6)
+#define BSP_SIM_PDC_PCSR_FLAGS          (0x7CUL)        ///< Flags cleared by writing 0
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+/** Memory mapped at its device address. */
+typedef struct st_bsp_sim_region
+{
+    uintptr_t base;
+    size_t    size;
+    uint8_t   erased_value;            ///< Initial contents, 0xFF for flash windows
+    bool      clear_on_reset;          ///< false for memories that survive a reset
+} bsp_sim_region_t;
+
+/** Simulated NVIC state. */
+typedef struct st_bsp_sim_nvic
+{
+    uint32_t enabled[BSP_SIM_NVIC_WORDS];
+    uint32_t pending[BSP_SIM_NVIC_WORDS];
+    uint32_t active[BSP_SIM_NVIC_WORDS];
+    uint8_t  priority[BSP_SIM_NVIC_IRQ_COUNT];
+    uint16_t preempted[BSP_SIM_NVIC_IRQ_COUNT + 1U];   ///< Execution priority saved on each exception entry
+    uint16_t execution_priority;                       ///< Priority of the running exception, or thread level
+    uint32_t nesting;
+} bsp_sim_nvic_t;
+
+/** Receive FIFO of one simulated SCI channel. Non-FIFO channels use a depth of one. */
+typedef struct st_bsp_sim_sci_rx
+{
+    uint16_t data[BSP_SIM_SCI_FIFO_DEPTH];
+    uint32_t head;
+    uint32_t count;
+    uint8_t  ssr;                          ///< SSR before the last write, status flags can only be cleared
+} bsp_sim_sci_rx_t;
+
+/** DMAC channel state that is not visible in the registers. */
+typedef struct st_bsp_sim_dmac_channel
+{
+    uint32_t src_start;                    ///< DMSAR when DTE was set, restored after each repeat or block
+    uint32_t dest_start;                   ///< DMDAR when DTE was set, restored after each repeat or block
+    bool     enabled;                      ///< DTE after the last write
+} bsp_sim_dmac_channel_t;
+
+/** EDMAC descriptor, 16 bytes (EDMR.DL = 0). */
+typedef struct st_bsp_sim_ether_descriptor
+{
+    volatile uint32_t status;              ///< TD0/RD0
+    volatile uint16_t frame_length;        ///< RD1.RFL
+    volatile uint16_t buffer_length;       ///< TD1.TBL/RD1.RBL
+    volatile uint32_t buffer;              ///< TD2/RD2
+    uint32_t          padding;
+} bsp_sim_ether_descriptor_t;
+
+/** EDMAC and ETHERC channel state that is not visible in the registers. */
+typedef struct st_bsp_sim_ether_channel
+{
+    uint32_t tx_descriptor;                ///< Next transmit descriptor, 0 until transmission first starts
+    uint32_t rx_descriptor;                ///< Next receive descriptor, 0 until reception first starts
+    uint32_t eesr;                         ///< EESR before the last write, status flags can only be cleared
+    bool     raise;                        ///< An enabled status flag was set, EINT is raised when the access ends
+    uint8_t  frame[BSP_SIM_ETHER_FRAME_MAX];   ///< Frame being assembled from transmit descriptors
+} bsp_sim_ether_channel_t;
+
+/** PDC receive FIFO and status. */
+typedef struct st_bsp_sim_pdc
+{
+    uint32_t fifo[BSP_SIM_PDC_FIFO_WORDS];
+    uint32_t head;
+    uint32_t count;
+    uint32_t flags;                        ///< PCSR flags before the last write, flags can only be cleared
+    bool     busy;                         ///< A frame is being received
+} bsp_sim_pdc_t;
+
+/***********************************************************************************************************************
+Private function prototypes
+***********************************************************************************************************************/
+static ssp_err_t bsp_sim_map(void);
+static void      bsp_sim_system_hook(bsp_sim_peripheral_t * const p_peripheral, bsp_sim_hook_event_t event);
+static void      bsp_sim_romc_hook(bsp_sim_peripheral_t * const p_peripheral, bsp_sim_hook_event_t event);
+static void      bsp_sim_sci_hook(bsp_sim_peripheral_t * const p_peripheral, bsp_sim_hook_event_t event);
+static void      bsp_sim_crc_hook(bsp_sim_peripheral_t * const p_peripheral, bsp_sim_hook_event_t event);
+static void      bsp_sim_dmac_hook(bsp_sim_peripheral_t * const p_peripheral, bsp_sim_hook_event_t event);
+static void      bsp_sim_dmac_request(R_DMAC0_Type * const p_dmac, bsp_sim_dmac_channel_t * const p_state,
+                                      uint32_t channel);
+static uint32_t  bsp_sim_dmac_address_next(uint32_t address, uint32_t mode, uint32_t size, uint32_t offset);
+static bool      bsp_sim_dmac_activate(elc_event_t event);
+static void      bsp_sim_ether_hook(bsp_sim_peripheral_t * const p_peripheral, bsp_sim_hook_event_t event);
+static void      bsp_sim_ether_reset(uint32_t channel);
+static void      bsp_sim_ether_transmit(uint32_t channel);
+static ssp_err_t bsp_sim_ether_receive(uint32_t channel, uint8_t const * const p_frame, uint32_t length);
+static void      bsp_sim_ether_status_set(uint32_t channel, uint32_t flags);
+static void      bsp_sim_ether_raise(uint32_t channel);
+static void      bsp_sim_pdc_hook(bsp_sim_peripheral_t * const p_peripheral, bsp_sim_hook_event_t event);
+static uint32_t  bsp_sim_pdc_status_set(uint32_t flags);
+static bool      bsp_sim_pdc_push(uint32_t word, uint32_t * p_stage, bool * p_overflow);
+static uint32_t  bsp_sim_bus_read(uintptr_t address, uint32_t size);
+static void      bsp_sim_bus_write(uintptr_t address, uint32_t value, uint32_t size);
+static void      bsp_sim_bus_unprotect(uintptr_t address);
+static void      bsp_sim_event_flush(void);
+static void      bsp_sim_hook_call(bsp_sim_peripheral_t * const p_peripheral, bsp_sim_hook_event_t event);
+static void      bsp_sim_trap_unprotect(bsp_sim_peripheral_t const * const p_peripheral);
+static void      bsp_sim_trap_protect_all(void);
+static bool      bsp_sim_trap_covers(bsp_sim_peripheral_t const * const p_peripheral, uintptr_t page);
+static void      bsp_sim_trap_notify(uintptr_t address, bsp_sim_hook_event_t event);
+#if BSP_SIM_TRAP_SUPPORTED
+static void      bsp_sim_trap_install(void);
+static void      bsp_sim_trap_segv(int signal, siginfo_t * p_info, void * p_ucontext);
+static void      bsp_sim_trap_step(int signal, siginfo_t * p_info, void * p_ucontext);
+#endif
+static bool      bsp_sim_irq_masked(uint16_t priority);
+static int32_t   bsp_sim_irq_highest_pending(void);
+static void      bsp_sim_irq_take(uint32_t irq);
+
+/***********************************************************************************************************************
+Exported global variables (to be accessed by other files)
+***********************************************************************************************************************/
+/** Simulated core registers used by cmsis_host.h. */
+cmsis_host_core_t g_cmsis_host_core;
+
+/** Value observed by the last __LDREXx on this thread. */
+__thread uint32_t g_cmsis_host_exclusive;
+
+/***********************************************************************************************************************
+Private global variables and functions
+***********************************************************************************************************************/
+/*LDRA_INSPECTED 219 S Linker sections start with underscore. */
+extern ssp_vector_t __Vector_Start[];
+/*LDRA_INSPECTED 219 S Linker sections start with underscore. */
+extern ssp_vector_t __Vector_End[];
+
+/* bsp_hw_locks.c is only reachable through linker sections, so nothing pulls it out of the static library. Referencing
+ * one of its lookup entries links the whole lock table, as linking the BSP sources directly does on the target. */
+extern const ssp_feature_t g_lock_lookup_ELC_0U_0U;
+static ssp_feature_t const * const gp_bsp_sim_lock_table_anchor __attribute__((used)) = &g_lock_lookup_ELC_0U_0U;
+
+/** Address ranges backed by host memory. */
+static const bsp_sim_region_t g_bsp_sim_regions[] =
+{
+    {BSP_SIM_SRAM_BASE,       BSP_SIM_SRAM_SIZE,       0x00U, false},
+    {BSP_SIM_PERIPHERAL_BASE, BSP_SIM_PERIPHERAL_SIZE, 0x00U, true },
+    {BSP_SIM_QSPI_BASE,       BSP_SIM_QSPI_SIZE,       0xFFU, false},
+    {BSP_SIM_PPB_BASE,        BSP_SIM_PPB_SIZE,        0x00U, true },
+};
+
+static bool                   g_bsp_sim_mapped = false;
+static bool                   g_bsp_sim_builtins_registered = false;
+static bsp_sim_peripheral_t * gp_bsp_sim_peripherals = NULL;
+static bsp_sim_nvic_t         g_bsp_sim_nvic;
+static bsp_sim_stats_t        g_bsp_sim_stats;
+static bsp_sim_dtc_hook_t     gp_bsp_sim_dtc_hook = NULL;
+static void                 * gp_bsp_sim_dtc_context = NULL;
+static uintptr_t              g_bsp_sim_sram_next = BSP_SIM_SRAM_BASE;
+static uintptr_t              g_bsp_sim_page_size = 0U;
+static volatile uintptr_t     g_bsp_sim_trap_address = 0U;         ///< Access being single-stepped, 0 if none
+static volatile bool          g_bsp_sim_trap_write   = false;      ///< The access being single-stepped is a write
+static bsp_sim_sci_rx_t       g_bsp_sim_sci_rx[BSP_SIM_SCI_CHANNELS];
+static bsp_sim_dmac_channel_t g_bsp_sim_dmac_channel[BSP_SIM_DMAC_CHANNELS];
+static bsp_sim_ether_channel_t g_bsp_sim_ether_channel[BSP_SIM_ETHER_CHANNELS];
+static bsp_sim_ether_wire_t   gp_bsp_sim_ether_wire[BSP_SIM_ETHER_CHANNELS];     ///< Kept across resets
+static void                 * gp_bsp_sim_ether_wire_context[BSP_SIM_ETHER_CHANNELS];
+static bsp_sim_pdc_t          g_bsp_sim_pdc_state;
+static uint32_t               g_bsp_sim_hook_depth = 0U;           ///< Hooks currently running, nested bus accesses
+static elc_event_t            g_bsp_sim_events[BSP_SIM_EVENT_QUEUE_DEPTH];  ///< Events raised while a hook runs
+static uint32_t               g_bsp_sim_event_count = 0U;
+static uint32_t               g_bsp_sim_event_next  = 0U;          ///< Next queued event to route, shared by nested flushes
+#if BSP_SIM_TRAP_SUPPORTED
+static bool                   g_bsp_sim_trap_installed = false;
+#endif
+
+/** Built-in models for the registers the BSP polls during SystemInit. */
+static bsp_sim_peripheral_t g_bsp_sim_system =
+{
+    .p_name = "SYSTEM",
+    .base   = R_SYSTEM_BASE,
+    .size   = sizeof(R_SYSTEM_Type),
+    .p_hook = bsp_sim_system_hook,
+    .trap   = BSP_SIM_TRAP_WRITE,
+};
+
+static bsp_sim_peripheral_t g_bsp_sim_romc =
+{
+    .p_name = "ROMC",
+    .base   = R_ROMC_BASE,
+    .size   = sizeof(R_ROMC_Type),
+    .p_hook = bsp_sim_romc_hook,
+    .trap   = BSP_SIM_TRAP_WRITE,
+};
+
+static bsp_sim_peripheral_t g_bsp_sim_sci =
+{
+    .p_name = "SCI",
+    .base   = R_SCI0_BASE,
+    .size   = BSP_SIM_SCI_STRIDE * BSP_SIM_SCI_CHANNELS,
+    .p_hook = bsp_sim_sci_hook,
+    .trap   = BSP_SIM_TRAP_ACCESS,
+};
+
+static bsp_sim_peripheral_t g_bsp_sim_crc =
+{
+    .p_name = "CRC",
+    .base   = R_CRC_BASE,
+    .size   = sizeof(R_CRC_Type),
+    .p_hook = bsp_sim_crc_hook,
+    .trap   = BSP_SIM_TRAP_WRITE,
+};
+
+static bsp_sim_peripheral_t g_bsp_sim_dmac =
+{
+    .p_name = "DMAC",
+    .base   = R_DMAC0_BASE,
+    .size   = BSP_SIM_DMAC_STRIDE * BSP_SIM_DMAC_CHANNELS,
+    .p_hook = bsp_sim_dmac_hook,
+    .trap   = BSP_SIM_TRAP_WRITE,
+};
+
+static bsp_sim_peripheral_t g_bsp_sim_ether =
+{
+    .p_name = "ETHER",
+    .base   = R_EDMAC0_BASE,
+    .size   = BSP_SIM_ETHER_STRIDE * BSP_SIM_ETHER_CHANNELS,
+    .p_hook = bsp_sim_ether_hook,
+    .trap   = BSP_SIM_TRAP_WRITE,
+};
+
+static bsp_sim_peripheral_t g_bsp_sim_pdc =
+{
+    .p_name = "PDC",
+    .base   = R_PDC_BASE,
+    .size   = sizeof(R_PDC_Type),
+    .p_hook = bsp_sim_pdc_hook,
+    .trap   = BSP_SIM_TRAP_ACCESS,
+};
+
+/*******************************************************************************************************************//**
+ * @addtogroup BSP_MCU_SIM
+ *
+ * @{
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @brief Maps the simulated address space, resets the register model and runs SystemInit() as the reset handler
+ *        would on the target.
+ *
+ * @retval SSP_SUCCESS            Simulator ready, BSP initialized.
+ * @retval SSP_ERR_OUT_OF_MEMORY  A device address range could not be mapped on the host.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_SimInit (void)
+{
+    ssp_err_t err = bsp_sim_map();
+    SSP_ERROR_RETURN(SSP_SUCCESS == err, err, NULL, NULL);
+
+    if (!g_bsp_sim_builtins_registered)
+    {
+        g_bsp_sim_builtins_registered = true;
+        R_BSP_SimPeripheralRegister(&g_bsp_sim_system);
+        R_BSP_SimPeripheralRegister(&g_bsp_sim_romc);
+        R_BSP_SimPeripheralRegister(&g_bsp_sim_sci);
+        R_BSP_SimPeripheralRegister(&g_bsp_sim_crc);
+        R_BSP_SimPeripheralRegister(&g_bsp_sim_dmac);
+        R_BSP_SimPeripheralRegister(&g_bsp_sim_ether);
+        R_BSP_SimPeripheralRegister(&g_bsp_sim_pdc);
+    }
+
+    R_BSP_SimReset();
+
+    SystemInit();
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Returns the register model and the simulated core to their reset state. Peripheral register space is
+ *        cleared, every registered hook receives BSP_SIM_HOOK_EVENT_RESET, and all NVIC state is cleared. SRAM and the
+ *        QSPI flash window keep their contents.
+ *
+ * @retval SSP_SUCCESS            Reset complete.
+ * @retval SSP_ERR_OUT_OF_MEMORY  A device address range could not be mapped on the host.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_SimReset (void)
+{
+    ssp_err_t err = bsp_sim_map();
+    SSP_ERROR_RETURN(SSP_SUCCESS == err, err, NULL, NULL);
+
+    for (bsp_sim_peripheral_t * p_peripheral = gp_bsp_sim_peripherals; NULL != p_peripheral;
+         p_peripheral = p_peripheral->p_next)
+    {
+        bsp_sim_trap_unprotect(p_peripheral);
+    }
+
+    for (uint32_t i = 0U; i < (sizeof(g_bsp_sim_regions) / sizeof(g_bsp_sim_regions[0])); i++)
+    {
+        if (g_bsp_sim_regions[i].clear_on_reset)
+        {
+            memset((void *) g_bsp_sim_regions[i].base, 0, g_bsp_sim_regions[i].size);
+        }
+    }
+    memset((void *) R_QSPI_BASE, 0, BSP_SIM_QSPI_BASE + BSP_SIM_QSPI_SIZE - R_QSPI_BASE);
+
+    memset(&g_bsp_sim_nvic, 0, sizeof(g_bsp_sim_nvic));
+    g_bsp_sim_nvic.execution_priority = BSP_SIM_PRIORITY_THREAD;
+    memset(&g_cmsis_host_core, 0, sizeof(g_cmsis_host_core));
+
+    for (bsp_sim_peripheral_t * p_peripheral = gp_bsp_sim_peripherals; NULL != p_peripheral;
+         p_peripheral = p_peripheral->p_next)
+    {
+        bsp_sim_hook_call(p_peripheral, BSP_SIM_HOOK_EVENT_RESET);
+    }
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Adds a peripheral model. The register block is cleared and the hook receives BSP_SIM_HOOK_EVENT_RESET
+ *        immediately so the model can be registered at any time.
+ *
+ * @param[in] p_peripheral  Peripheral model. Storage must remain valid for the life of the simulation.
+ *
+ * @retval SSP_SUCCESS            Model registered.
+ * @retval SSP_ERR_ASSERTION      p_peripheral is NULL.
+ * @retval SSP_ERR_IN_USE         The model is already registered.
+ * @retval SSP_ERR_INVALID_ADDRESS The register block is outside the simulated address space.
+ * @retval SSP_ERR_UNSUPPORTED    A trap mode is selected but the host architecture cannot single-step accesses.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_SimPeripheralRegister (bsp_sim_peripheral_t * const p_peripheral)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_peripheral);
+#endif
+
+    ssp_err_t err = bsp_sim_map();
+    SSP_ERROR_RETURN(SSP_SUCCESS == err, err, NULL, NULL);
+
+    bool in_range = false;
+    for (uint32_t i = 0U; i < (sizeof(g_bsp_sim_regions) / sizeof(g_bsp_sim_regions[0])); i++)
+    {
+        if ((p_peripheral->base >= g_bsp_sim_regions[i].base) &&
+            ((p_peripheral->base + p_peripheral->size) <= (g_bsp_sim_regions[i].base + g_bsp_sim_regions[i].size)))
+        {
+            in_range = true;
+        }
+    }
+    SSP_ERROR_RETURN(in_range, SSP_ERR_INVALID_ADDRESS, NULL, NULL);
+#if BSP_SIM_TRAP_SUPPORTED
+    if (BSP_SIM_TRAP_NONE != p_peripheral->trap)
+    {
+        bsp_sim_trap_install();
+    }
+#else
+    SSP_ERROR_RETURN(BSP_SIM_TRAP_NONE == p_peripheral->trap, SSP_ERR_UNSUPPORTED, NULL, NULL);
+#endif
+
+    for (bsp_sim_peripheral_t * p_entry = gp_bsp_sim_peripherals; NULL != p_entry; p_entry = p_entry->p_next)
+    {
+        SSP_ERROR_RETURN(p_entry != p_peripheral, SSP_ERR_IN_USE, NULL, NULL);
+    }
+
+    p_peripheral->p_next   = gp_bsp_sim_peripherals;
+    gp_bsp_sim_peripherals = p_peripheral;
+
+    bsp_sim_trap_unprotect(p_peripheral);
+    memset((void *) p_peripheral->base, 0, p_peripheral->size);
+    bsp_sim_hook_call(p_peripheral, BSP_SIM_HOOK_EVENT_RESET);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Routes events whose IELSRn has DTCE set to a DTC model instead of the CPU.
+ *
+ * @param[in] p_hook     DTC model, NULL to deliver DTC events to the CPU.
+ * @param[in] p_context  Passed to p_hook.
+ *
+ * @retval SSP_SUCCESS  Hook installed.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_SimDtcHookSet (bsp_sim_dtc_hook_t p_hook, void * p_context)
+{
+    gp_bsp_sim_dtc_hook    = p_hook;
+    gp_bsp_sim_dtc_context = p_context;
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Advances the simulation by one step: every peripheral hook receives BSP_SIM_HOOK_EVENT_STEP, then pending
+ *        interrupts are dispatched. __WFI() and __WFE() call this function on the host.
+ **********************************************************************************************************************/
+void R_BSP_SimStep (void)
+{
+    g_bsp_sim_stats.steps++;
+
+    for (bsp_sim_peripheral_t * p_peripheral = gp_bsp_sim_peripherals; NULL != p_peripheral;
+         p_peripheral = p_peripheral->p_next)
+    {
+        bsp_sim_hook_call(p_peripheral, BSP_SIM_HOOK_EVENT_STEP);
+    }
+
+    R_BSP_SimIrqDispatch();
+}
+
+/*******************************************************************************************************************//**
+ * @brief Raises an ELC event at the ICU. Every IELSRn that selects the event gets its IR flag set and the matching
+ *        NVIC interrupt pended, or the event is handed to the DTC hook if DTCE is set. Every DMAC channel whose
+ *        DELSRn selects the event serves one transfer request. Interrupts that are enabled and not masked are taken
+ *        before this function returns, as they would be on the target. Events raised by a peripheral hook are queued
+ *        and routed when the outermost hook returns.
+ *
+ * @param[in] event  ELC event signalled by a peripheral model.
+ *
+ * @retval SSP_SUCCESS               Event routed to at least one IELSRn or DELSRn, or queued by a hook.
+ * @retval SSP_ERR_IRQ_BSP_DISABLED  No IELSRn or DELSRn selects the event.
+ * @retval SSP_ERR_OVERFLOW          A hook raised more events than the queue holds.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_SimEventRaise (elc_event_t event)
+{
+    bool routed = false;
+
+    if (0U != g_bsp_sim_hook_depth)
+    {
+        SSP_ERROR_RETURN(g_bsp_sim_event_count < BSP_SIM_EVENT_QUEUE_DEPTH, SSP_ERR_OVERFLOW, NULL, NULL);
+        g_bsp_sim_events[g_bsp_sim_event_count] = event;
+        g_bsp_sim_event_count++;
+
+        return SSP_SUCCESS;
+    }
+
+    g_bsp_sim_stats.events_raised++;
+
+    for (uint32_t i = 0U; i < BSP_SIM_ICU_IELSR_COUNT; i++)
+    {
+        uint32_t ielsr = R_ICU->IELSRn[i];
+        if ((0U == (ielsr & BSP_SIM_IELSR_IELS_MASK)) || ((uint32_t) event != (ielsr & BSP_SIM_IELSR_IELS_MASK)))
+        {
+            continue;
+        }
+
+        routed = true;
+
+        if ((0U != (ielsr & BSP_SIM_IELSR_DTCE)) && (NULL != gp_bsp_sim_dtc_hook))
+        {
+            if (!gp_bsp_sim_dtc_hook(event, gp_bsp_sim_dtc_context))
+            {
+                continue;
+            }
+
+            /* The DTC clears DTCE at the end of a transfer, keep its write. */
+            ielsr = R_ICU->IELSRn[i];
+        }
+
+        R_ICU->IELSRn[i] = ielsr | BSP_SIM_IELSR_IR;
+        g_bsp_sim_nvic.pending[i / 32U] |= (1UL << (i % 32U));
+    }
+
+    if (bsp_sim_dmac_activate(event))
+    {
+        routed = true;
+    }
+
+    if (!routed)
+    {
+        g_bsp_sim_stats.events_unrouted++;
+        return SSP_ERR_IRQ_BSP_DISABLED;
+    }
+
+    R_BSP_SimIrqDispatch();
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Pends an NVIC interrupt directly, bypassing the ICU (equivalent to NVIC_SetPendingIRQ()).
+ *
+ * @param[in] irq  Interrupt to pend.
+ *
+ * @retval SSP_SUCCESS               Interrupt pended.
+ * @retval SSP_ERR_INVALID_ARGUMENT  irq is not an external interrupt.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_SimIrqPend (IRQn_Type irq)
+{
+    SSP_ERROR_RETURN(((int32_t) irq >= 0) && ((uint32_t) irq < BSP_SIM_NVIC_IRQ_COUNT), SSP_ERR_INVALID_ARGUMENT,
+                     NULL, NULL);
+
+    g_bsp_sim_nvic.pending[(uint32_t) irq / 32U] |= (1UL << ((uint32_t) irq % 32U));
+    R_BSP_SimIrqDispatch();
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Takes every pending, enabled interrupt whose priority preempts the current execution priority, highest
+ *        priority (then lowest number) first. PRIMASK, FAULTMASK and BASEPRI are honored. An ISR that returns with
+ *        the IR flag of its IELSRn still set is pended again, matching the level-sensitive ICU to NVIC connection.
+ **********************************************************************************************************************/
+void R_BSP_SimIrqDispatch (void)
+{
+    int32_t irq = bsp_sim_irq_highest_pending();
+    while (irq >= 0)
+    {
+        bsp_sim_irq_take((uint32_t) irq);
+        irq = bsp_sim_irq_highest_pending();
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @brief Returns the ISR installed for an interrupt by SSP_VECTOR_DEFINE, or NULL.
+ *
+ * @param[in] irq  Interrupt number, index into gp_vector_information.
+ **********************************************************************************************************************/
+ssp_vector_t R_BSP_SimVectorGet (IRQn_Type irq)
+{
+    uint32_t count = (uint32_t) (__Vector_End - __Vector_Start);
+
+    if (((int32_t) irq < 0) || ((uint32_t) irq >= count))
+    {
+        return NULL;
+    }
+
+    return __Vector_Start[irq];
+}
+
+/*******************************************************************************************************************//**
+ * @brief Allocates memory from the simulated SRAM. Use this for buffers whose address is written to a DMAC, DTC or
+ *        peripheral register, since those registers are 32 bits wide. Memory is never freed.
+ *
+ * @param[in] size       Number of bytes.
+ * @param[in] alignment  Required alignment, power of two, 0 for 4 bytes.
+ *
+ * @return Pointer into simulated SRAM, or NULL when SRAM is exhausted.
+ **********************************************************************************************************************/
+void * R_BSP_SimSramAlloc (uint32_t size, uint32_t alignment)
+{
+    if (SSP_SUCCESS != bsp_sim_map())
+    {
+        return NULL;
+    }
+
+    if (0U == alignment)
+    {
+        alignment = 4U;
+    }
+
+    uintptr_t address = (g_bsp_sim_sram_next + (alignment - 1U)) & ~((uintptr_t) alignment - 1U);
+    if ((address + size) > (BSP_SIM_SRAM_BASE + BSP_SIM_SRAM_SIZE))
+    {
+        return NULL;
+    }
+
+    g_bsp_sim_sram_next = address + size;
+
+    return (void *) address;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Copies the simulator statistics.
+ *
+ * @param[out] p_stats  Statistics destination.
+ **********************************************************************************************************************/
+void R_BSP_SimStatsGet (bsp_sim_stats_t * const p_stats)
+{
+    *p_stats = g_bsp_sim_stats;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Receives data on a simulated SCI channel. Each datum enters the receive FIFO (or RDR for a channel that is not
+ *        in FIFO mode) and RXI is raised once the FIFO reaches its trigger level. Data left in the FIFO after the last
+ *        datum sets DR, as the receive timeout does when the line goes idle, and raises RXI or, if FCR.DRES is set,
+ *        ERI. A datum that finds the FIFO full sets ORER and raises ERI; it and the remaining data are discarded.
+ *
+ * @param[in] channel  SCI channel.
+ * @param[in] p_data   Received data, 9 bits per entry.
+ * @param[in] count    Number of entries in p_data.
+ *
+ * @retval SSP_SUCCESS               Data received.
+ * @retval SSP_ERR_ASSERTION         p_data is NULL.
+ * @retval SSP_ERR_INVALID_CHANNEL   channel does not exist.
+ * @retval SSP_ERR_OVERFLOW          The receive FIFO overflowed, ORER is set.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_SimSciReceive (uint32_t channel, uint16_t const * const p_data, uint32_t count)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_data);
+#endif
+    SSP_ERROR_RETURN(channel < BSP_SIM_SCI_CHANNELS, SSP_ERR_INVALID_CHANNEL, NULL, NULL);
+
+    R_SCI0_Type      * p_sci = (R_SCI0_Type *) (g_bsp_sim_sci.base + (channel * BSP_SIM_SCI_STRIDE));
+    bsp_sim_sci_rx_t * p_rx  = &g_bsp_sim_sci_rx[channel];
+    elc_event_t        rxi   = (elc_event_t) (ELC_EVENT_SCI0_RXI + (channel * BSP_SIM_SCI_EVENT_STRIDE));
+    elc_event_t        eri   = (elc_event_t) (ELC_EVENT_SCI0_ERI + (channel * BSP_SIM_SCI_EVENT_STRIDE));
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        bsp_sim_trap_unprotect(&g_bsp_sim_sci);
+
+        bool     fifo    = (0U != p_sci->FCR_b.FM);
+        uint32_t depth   = fifo ? BSP_SIM_SCI_FIFO_DEPTH : 1U;
+        uint32_t trigger = fifo ? p_sci->FCR_b.RTRG : 1U;
+
+        if (p_rx->count >= depth)
+        {
+            p_sci->SSR |= BSP_SIM_SCI_SSR_ORER;
+            p_rx->ssr   = p_sci->SSR;
+            bsp_sim_trap_protect_all();
+            R_BSP_SimEventRaise(eri);
+
+            return SSP_ERR_OVERFLOW;
+        }
+
+        p_rx->data[(p_rx->head + p_rx->count) % BSP_SIM_SCI_FIFO_DEPTH] = p_data[i] & 0x1FFU;
+        p_rx->count++;
+        *((volatile uint16_t *) &p_sci->FDR) = (uint16_t) ((p_sci->FDR & ~0x1FU) | (p_rx->count & 0x1FU));
+
+        /* RXI follows the FIFO trigger level. */
+        bool raise = (p_rx->count >= ((0U == trigger) ? 1U : trigger));
+        if (raise)
+        {
+            p_sci->SSR |= (uint8_t) (fifo ? BSP_SIM_SCI_SSR_RDF : BSP_SIM_SCI_SSR_RDRF);
+            p_rx->ssr   = p_sci->SSR;
+        }
+        bsp_sim_trap_protect_all();
+
+        if (raise)
+        {
+            R_BSP_SimEventRaise(rxi);
+        }
+    }
+
+    /* The line goes idle after the last datum. In FIFO mode, data left below the trigger level sets DR, which is
+     * signalled on RXI or, if FCR.DRES is set, on ERI. */
+    bsp_sim_trap_unprotect(&g_bsp_sim_sci);
+    elc_event_t idle = (elc_event_t) 0U;
+    if ((0U != p_sci->FCR_b.FM) && (0U != p_rx->count))
+    {
+        p_sci->SSR |= BSP_SIM_SCI_SSR_DR;
+        p_rx->ssr   = p_sci->SSR;
+        idle = (0U != p_sci->FCR_b.DRES) ? eri : rxi;
+    }
+    bsp_sim_trap_protect_all();
+
+    if ((elc_event_t) 0U != idle)
+    {
+        R_BSP_SimEventRaise(idle);
+    }
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Receives a frame on a simulated Ethernet channel. The frame passes the MAC address filter unless ECMR.PRM is
+ *        set, is written to the receive descriptors starting at the one the EDMAC would use next, and sets EESR.FR.
+ *        A frame that finds no descriptor with RACT set is lost: EESR.RDE is set, EDRRR.RR is cleared and RMFCR
+ *        counts the frame. Frames outside 60 bytes to RFLR are stored with RFE set.
+ *
+ * @param[in] channel  ETHERC channel.
+ * @param[in] p_frame  Frame from the destination address up to the end of the data, without the FCS.
+ * @param[in] length   Length of the frame in bytes.
+ *
+ * @retval SSP_SUCCESS               Frame received, or discarded by the address filter.
+ * @retval SSP_ERR_ASSERTION         p_frame is NULL.
+ * @retval SSP_ERR_INVALID_CHANNEL   channel does not exist.
+ * @retval SSP_ERR_NOT_ENABLED       Reception is disabled in ECMR.
+ * @retval SSP_ERR_OVERFLOW          The EDMAC was not receiving or ran out of descriptors, the frame was missed.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_SimEtherReceive (uint32_t channel, uint8_t const * const p_frame, uint32_t length)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_frame);
+#endif
+    SSP_ERROR_RETURN(channel < BSP_SIM_ETHER_CHANNELS, SSP_ERR_INVALID_CHANNEL, NULL, NULL);
+
+    g_bsp_sim_hook_depth++;
+    bsp_sim_trap_unprotect(&g_bsp_sim_ether);
+    ssp_err_t err = bsp_sim_ether_receive(channel, p_frame, length);
+    bsp_sim_ether_raise(channel);
+    g_bsp_sim_hook_depth--;
+
+    if (0U == g_bsp_sim_hook_depth)
+    {
+        bsp_sim_trap_protect_all();
+        bsp_sim_event_flush();
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Sets the function that receives the frames a simulated Ethernet channel transmits. Frames are passed without
+ *        the FCS, once the EDMAC has read the last descriptor of the frame. The function runs inside the EDMAC model
+ *        and may call R_BSP_SimEtherReceive() to deliver the frame to a simulated link partner or back to the channel.
+ *        With ECMR.ILB set, transmitted frames are looped back to the receive side instead. The setting is kept across
+ *        R_BSP_SimReset().
+ *
+ * @param[in] channel    ETHERC channel.
+ * @param[in] p_wire     Function called for each transmitted frame, NULL to discard them.
+ * @param[in] p_context  Passed to p_wire.
+ *
+ * @retval SSP_SUCCESS               Function set.
+ * @retval SSP_ERR_INVALID_CHANNEL   channel does not exist.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_SimEtherWireSet (uint32_t channel, bsp_sim_ether_wire_t p_wire, void * p_context)
+{
+    SSP_ERROR_RETURN(channel < BSP_SIM_ETHER_CHANNELS, SSP_ERR_INVALID_CHANNEL, NULL, NULL);
+
+    gp_bsp_sim_ether_wire[channel]         = p_wire;
+    gp_bsp_sim_ether_wire_context[channel] = p_context;
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Sends one frame from a simulated camera to the PDC. The lines and bytes selected by VCR and HCR are packed
+ *        into words in the order PCCR0.EDS selects and pushed into the receive FIFO; every 8 words raise the receive
+ *        data ready event, so a DMAC or DTC transfer activated by it drains the FIFO as the frame arrives. A full FIFO
+ *        sets PCSR.OVRF and loses the word. The frame end sets PCSR.FEF, and PCSR.VERF or PCSR.HERF if the frame is
+ *        smaller than the capture area. Reception stops early if PCCR1.PCE is cleared during the frame.
+ *
+ * @param[in] p_image     Frame, line after line.
+ * @param[in] line_bytes  Bytes in each line.
+ * @param[in] lines       Number of lines.
+ *
+ * @retval SSP_SUCCESS               Frame received.
+ * @retval SSP_ERR_ASSERTION         p_image is NULL.
+ * @retval SSP_ERR_NOT_ENABLED       PCCR1.PCE is clear, the frame was not received.
+ * @retval SSP_ERR_OVERFLOW          The FIFO overflowed, part of the frame was lost.
+ **********************************************************************************************************************/
+ssp_err_t R_BSP_SimPdcFrame (uint8_t const * const p_image, uint32_t line_bytes, uint32_t lines)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_image);
+#endif
+
+    R_PDC_Type * p_pdc = (R_PDC_Type *) g_bsp_sim_pdc.base;
+
+    bsp_sim_trap_unprotect(&g_bsp_sim_pdc);
+    if (0U == (p_pdc->PCCR1 & BSP_SIM_PDC_PCCR1_PCE))
+    {
+        bsp_sim_trap_protect_all();
+
+        return SSP_ERR_NOT_ENABLED;
+    }
+
+    uint32_t vst    = p_pdc->VCR & 0xFFFU;
+    uint32_t vend   = vst + ((p_pdc->VCR >> 16) & 0xFFFU);
+    uint32_t hst    = p_pdc->HCR & 0xFFFU;
+    uint32_t hend   = hst + ((p_pdc->HCR >> 16) & 0xFFFU);
+    bool     big    = (0U != (p_pdc->PCCR0 & BSP_SIM_PDC_PCCR0_EDS));
+    uint32_t errors = 0U;
+    if (vend > lines)
+    {
+        errors |= BSP_SIM_PDC_PCSR_VERF;
+        vend    = lines;
+    }
+    if (hend > line_bytes)
+    {
+        errors |= BSP_SIM_PDC_PCSR_HERF;
+        hend    = line_bytes;
+    }
+
+    g_bsp_sim_pdc_state.busy = true;
+    (void) bsp_sim_pdc_status_set(0U);
+    bsp_sim_trap_protect_all();
+
+    bool     received = true;
+    bool     overflow = false;
+    uint32_t word     = 0U;
+    uint32_t bytes    = 0U;
+    uint32_t stage    = 0U;
+    for (uint32_t line = vst; received && (line < vend); line++)
+    {
+        for (uint32_t i = hst; received && (i < hend); i++)
+        {
+            uint32_t data = p_image[(line * line_bytes) + i];
+            word = big ? ((word << 8) | data) : (word | (data << (8U * bytes)));
+            bytes++;
+            if (4U == bytes)
+            {
+                received = bsp_sim_pdc_push(word, &stage, &overflow);
+                word     = 0U;
+                bytes    = 0U;
+            }
+        }
+    }
+
+    bsp_sim_trap_unprotect(&g_bsp_sim_pdc);
+    g_bsp_sim_pdc_state.busy = false;
+    uint32_t pccr0 = p_pdc->PCCR0;
+    (void) bsp_sim_pdc_status_set(received ? (BSP_SIM_PDC_PCSR_FEF | errors) : 0U);
+    bsp_sim_trap_protect_all();
+
+    if (received && (((0U != (errors & BSP_SIM_PDC_PCSR_VERF)) && (0U != (pccr0 & BSP_SIM_PDC_PCCR0_VERIE))) ||
+                     ((0U != (errors & BSP_SIM_PDC_PCSR_HERF)) && (0U != (pccr0 & BSP_SIM_PDC_PCCR0_HERIE)))))
+    {
+        R_BSP_SimEventRaise(ELC_EVENT_PDC_INT);
+    }
+
+    if (received && (0U != (pccr0 & BSP_SIM_PDC_PCCR0_FEIE)))
+    {
+        R_BSP_SimEventRaise(ELC_EVENT_PDC_FRAME_END);
+    }
+
+    return overflow ? SSP_ERR_OVERFLOW : SSP_SUCCESS;
+}
+
+/** @} (end addtogroup BSP_MCU_SIM) */
+
+/***********************************************************************************************************************
+ * CMSIS host hooks (see cmsis_host.h and cmsis_nvic_host.h)
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Called by __WFI() and __WFE(). Sleeping until the next event means stepping the peripheral models.
+ **********************************************************************************************************************/
+void cmsis_host_wait_for_event (void)
+{
+    R_BSP_SimStep();
+}
+
+/*******************************************************************************************************************//**
+ * Called when PRIMASK, FAULTMASK or BASEPRI is lowered. Interrupts that were pended while masked are taken now.
+ **********************************************************************************************************************/
+void cmsis_host_mask_lowered (void)
+{
+    if (g_bsp_sim_mapped)
+    {
+        R_BSP_SimIrqDispatch();
+    }
+}
+
+void cmsis_host_nvic_enable_irq (IRQn_Type IRQn)
+{
+    if (((int32_t) IRQn >= 0) && ((uint32_t) IRQn < BSP_SIM_NVIC_IRQ_COUNT))
+    {
+        g_bsp_sim_nvic.enabled[(uint32_t) IRQn / 32U] |= (1UL << ((uint32_t) IRQn % 32U));
+        R_BSP_SimIrqDispatch();
+    }
+}
+
+uint32_t cmsis_host_nvic_get_enable_irq (IRQn_Type IRQn)
+{
+    if (((int32_t) IRQn >= 0) && ((uint32_t) IRQn < BSP_SIM_NVIC_IRQ_COUNT))
+    {
+        return (g_bsp_sim_nvic.enabled[(uint32_t) IRQn / 32U] >> ((uint32_t) IRQn % 32U)) & 1UL;
+    }
+
+    return 0U;
+}
+
+void cmsis_host_nvic_disable_irq (IRQn_Type IRQn)
+{
+    if (((int32_t) IRQn >= 0) && ((uint32_t) IRQn < BSP_SIM_NVIC_IRQ_COUNT))
+    {
+        g_bsp_sim_nvic.enabled[(uint32_t) IRQn / 32U] &= ~(1UL << ((uint32_t) IRQn % 32U));
+    }
+}
+
+uint32_t cmsis_host_nvic_get_pending_irq (IRQn_Type IRQn)
+{
+    if (((int32_t) IRQn >= 0) && ((uint32_t) IRQn < BSP_SIM_NVIC_IRQ_COUNT))
+    {
+        return (g_bsp_sim_nvic.pending[(uint32_t) IRQn / 32U] >> ((uint32_t) IRQn % 32U)) & 1UL;
+    }
+
+    return 0U;
+}
+
+void cmsis_host_nvic_set_pending_irq (IRQn_Type IRQn)
+{
+    R_BSP_SimIrqPend(IRQn);
+}
+
+void cmsis_host_nvic_clear_pending_irq (IRQn_Type IRQn)
+{
+    if (((int32_t) IRQn >= 0) && ((uint32_t) IRQn < BSP_SIM_NVIC_IRQ_COUNT))
+    {
+        g_bsp_sim_nvic.pending[(uint32_t) IRQn / 32U] &= ~(1UL << ((uint32_t) IRQn % 32U));
+    }
+}
+
+uint32_t cmsis_host_nvic_get_active (IRQn_Type IRQn)
+{
+    if (((int32_t) IRQn >= 0) && ((uint32_t) IRQn < BSP_SIM_NVIC_IRQ_COUNT))
+    {
+        return (g_bsp_sim_nvic.active[(uint32_t) IRQn / 32U] >> ((uint32_t) IRQn % 32U)) & 1UL;
+    }
+
+    return 0U;
+}
+
+void cmsis_host_nvic_set_priority (IRQn_Type IRQn, uint32_t priority)
+{
+    if (((int32_t) IRQn >= 0) && ((uint32_t) IRQn < BSP_SIM_NVIC_IRQ_COUNT))
+    {
+        g_bsp_sim_nvic.priority[(uint32_t) IRQn] = (uint8_t) ((priority << BSP_SIM_PRIORITY_SHIFT) & 0xFFUL);
+        NVIC->IP[(uint32_t) IRQn] = g_bsp_sim_nvic.priority[(uint32_t) IRQn];
+    }
+    else
+    {
+        __NVIC_SetPriority(IRQn, priority);
+    }
+}
+
+uint32_t cmsis_host_nvic_get_priority (IRQn_Type IRQn)
+{
+    if (((int32_t) IRQn >= 0) && ((uint32_t) IRQn < BSP_SIM_NVIC_IRQ_COUNT))
+    {
+        return (uint32_t) g_bsp_sim_nvic.priority[(uint32_t) IRQn] >> BSP_SIM_PRIORITY_SHIFT;
+    }
+
+    return __NVIC_GetPriority(IRQn);
+}
+
+void cmsis_host_nvic_system_reset (void)
+{
+    /* There is no way to restart the host process from the reset vector, so treat it like a halted target. */
+    abort();
+}
+
+/***********************************************************************************************************************
+ * Private functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Maps the device address ranges on first use. Mapping is done with MAP_FIXED_NOREPLACE so an address range that is
+ * already used by the host process is reported instead of silently replaced.
+ *
+ * @retval SSP_SUCCESS            All ranges mapped.
+ * @retval SSP_ERR_OUT_OF_MEMORY  A range could not be mapped at its device address.
+ **********************************************************************************************************************/
+static ssp_err_t bsp_sim_map (void)
+{
+    if (g_bsp_sim_mapped)
+    {
+        return SSP_SUCCESS;
+    }
+
+    for (uint32_t i = 0U; i < (sizeof(g_bsp_sim_regions) / sizeof(g_bsp_sim_regions[0])); i++)
+    {
+        bsp_sim_region_t const * p_region = &g_bsp_sim_regions[i];
+        void * p_map = mmap((void *) p_region->base, p_region->size, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE | MAP_NORESERVE, -1, 0);
+        if (p_map != (void *) p_region->base)
+        {
+            if (MAP_FAILED != p_map)
+            {
+                munmap(p_map, p_region->size);
+            }
+
+            return SSP_ERR_OUT_OF_MEMORY;
+        }
+
+        if (0U != p_region->erased_value)
+        {
+            memset(p_map, p_region->erased_value, p_region->size);
+        }
+    }
+
+    g_bsp_sim_page_size = (uintptr_t) sysconf(_SC_PAGESIZE);
+    g_bsp_sim_mapped    = true;
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Register model for the clock generation circuit.
+ **********************************************************************************************************************/
+static void bsp_sim_system_hook (bsp_sim_peripheral_t * const p_peripheral, bsp_sim_hook_event_t event)
+{
+    R_SYSTEM_Type * p_system = (R_SYSTEM_Type *) p_peripheral->base;
+
+    if (BSP_SIM_HOOK_EVENT_RESET == event)
+    {
+        p_system->SCKDIVCR = BSP_SIM_SYSTEM_SCKDIVCR_RESET;
+        p_system->SCKSCR   = BSP_SIM_SYSTEM_SCKSCR_RESET;
+        p_system->MOSCCR   = BSP_SIM_SYSTEM_MOSCCR_RESET;
+        p_system->PLLCR    = BSP_SIM_SYSTEM_PLLCR_RESET;
+    }
+
+    /* Oscillators stabilize as soon as they are started and stop immediately. OSCSF is read-only on the target, so it is
+     * recomputed after every write to the block. */
+    uint8_t oscsf = 0U;
+    oscsf |= (uint8_t) ((0U == p_system->HOCOCR_b.HCSTP) ? (1U << 0) : 0U);
+    oscsf |= (uint8_t) ((0U == p_system->MOSCCR_b.MOSTP) ? (1U << 3) : 0U);
+    oscsf |= (uint8_t) ((0U == p_system->PLLCR_b.PLLSTP) ? (1U << 5) : 0U);
+    *((volatile uint8_t *) &p_system->OSCSF) = oscsf;
+}
+
+/*******************************************************************************************************************//**
+ * Register model for the ROM cache. Cache invalidation completes immediately.
+ **********************************************************************************************************************/
+static void bsp_sim_romc_hook (bsp_sim_peripheral_t * const p_peripheral, bsp_sim_hook_event_t event)
+{
+    R_ROMC_Type * p_romc = (R_ROMC_Type *) p_peripheral->base;
+
+    SSP_PARAMETER_NOT_USED(event);
+
+    p_romc->ROMCIV_b.ROMCIV = 0U;
+}
+
+/*******************************************************************************************************************//**
+ * Register model for the serial communication interface channels. Transmission completes immediately, so the transmit
+ * flags stay set, and FIFO resets complete on the write that requests them. Received data is queued by
+ * R_BSP_SimSciReceive() and handed out on reads of RDR or FRDRH/FRDRL.
+ **********************************************************************************************************************/
+static void bsp_sim_sci_hook (bsp_sim_peripheral_t * const p_peripheral, bsp_sim_hook_event_t event)
+{
+    if (BSP_SIM_HOOK_EVENT_RESET == event)
+    {
+        memset(&g_bsp_sim_sci_rx[0], 0, sizeof(g_bsp_sim_sci_rx));
+        for (uint32_t channel = 0U; channel < BSP_SIM_SCI_CHANNELS; channel++)
+        {
+            R_SCI0_Type * p_sci = (R_SCI0_Type *) (p_peripheral->base + (channel * BSP_SIM_SCI_STRIDE));
+            p_sci->SSR  = BSP_SIM_SCI_SSR_RESET;
+            p_sci->BRR  = BSP_SIM_SCI_BRR_RESET;
+            p_sci->MDDR = BSP_SIM_SCI_MDDR_RESET;
+            g_bsp_sim_sci_rx[channel].ssr = BSP_SIM_SCI_SSR_RESET;
+        }
+
+        return;
+    }
+
+    if (BSP_SIM_HOOK_EVENT_STEP == event)
+    {
+        return;
+    }
+
+    uint32_t           channel = (uint32_t) ((p_peripheral->address - p_peripheral->base) / BSP_SIM_SCI_STRIDE);
+    uintptr_t          offset  = (p_peripheral->address - p_peripheral->base) % BSP_SIM_SCI_STRIDE;
+    R_SCI0_Type      * p_sci   = (R_SCI0_Type *) (p_peripheral->base + (channel * BSP_SIM_SCI_STRIDE));
+    bsp_sim_sci_rx_t * p_rx    = &g_bsp_sim_sci_rx[channel];
+
+    if (BSP_SIM_HOOK_EVENT_WRITE == event)
+    {
+        if (p_sci->FCR_b.RFRST)
+        {
+            p_sci->FCR_b.RFRST = 0U;
+            p_rx->count        = 0U;
+        }
+
+        if (p_sci->FCR_b.TFRST)
+        {
+            p_sci->FCR_b.TFRST = 0U;
+        }
+
+        if (offsetof(R_SCI0_Type, SSR) == offset)
+        {
+            /* Writing 0 clears a status flag, writing 1 leaves it unchanged. In FIFO mode DR is a flag as well. */
+            uint8_t flags = (uint8_t) (BSP_SIM_SCI_SSR_FLAGS | (p_sci->FCR_b.FM ? BSP_SIM_SCI_SSR_DR : 0U));
+            p_sci->SSR = (uint8_t) ((p_sci->SSR & p_rx->ssr & flags) | (p_sci->SSR & (uint8_t) ~flags));
+        }
+
+        /* The transmitter is always idle. */
+        p_sci->SSR |= BSP_SIM_SCI_SSR_RESET;
+    }
+    else if (0U == p_rx->count)
+    {
+        /* Reading an empty receive register returns the last value. */
+    }
+    else if (offsetof(R_SCI0_Type, FRDRH) == offset)
+    {
+        /* FRDRH is read first, load both halves of the FIFO entry. */
+        uint16_t data = p_rx->data[p_rx->head];
+        *((volatile uint8_t *) &p_sci->FRDRH) = (uint8_t) ((data >> 8) & 0x01U);
+        *((volatile uint8_t *) &p_sci->FRDRL) = (uint8_t) (data & 0xFFU);
+    }
+    else if ((offsetof(R_SCI0_Type, FRDRL) == offset) || (offsetof(R_SCI0_Type, RDR) == offset))
+    {
+        /* Reading the low byte pops the entry. */
+        uint16_t data = p_rx->data[p_rx->head];
+        *((volatile uint8_t *) &p_sci->FRDRL) = (uint8_t) (data & 0xFFU);
+        p_sci->RDR = (uint8_t) (data & 0xFFU);
+        p_rx->head = (p_rx->head + 1U) % BSP_SIM_SCI_FIFO_DEPTH;
+        p_rx->count--;
+    }
+    else
+    {
+        /* Other registers are plain memory. */
+    }
+
+    *((volatile uint16_t *) &p_sci->FDR) = (uint16_t) ((p_sci->FDR & ~0x1FU) | (p_rx->count & 0x1FU));
+    if (0U == p_rx->count)
+    {
+        p_sci->SSR &= (uint8_t) ~(BSP_SIM_SCI_SSR_DR | BSP_SIM_SCI_SSR_RDF);
+    }
+
+    p_rx->ssr = p_sci->SSR;
+}
+
+/*******************************************************************************************************************//**
+ * Register model for the CRC calculator. Each write to CRCDIR (32 bits for CRC-32 and CRC-32C, CRCDIR_BY for the
+ * other polynomials) shifts the data into CRCDOR, LSB first if CRCCR0.LMS is 0 and MSB first if it is 1. Writing
+ * CRCCR0 with DORCLR set clears CRCDOR. Snooping is not modeled.
+ **********************************************************************************************************************/
+static void bsp_sim_crc_hook (bsp_sim_peripheral_t * const p_peripheral, bsp_sim_hook_event_t event)
+{
+    /* Generator polynomials and CRC widths, indexed by CRCCR0.GPS. */
+    static const uint32_t polynomial[BSP_SIM_CRC_GPS_COUNT] =
+    {
+        0x00000000UL, 0x00000007UL, 0x00008005UL, 0x00001021UL, 0x04C11DB7UL, 0x1EDC6F41UL
+    };
+    static const uint32_t width[BSP_SIM_CRC_GPS_COUNT] = {32U, 8U, 16U, 16U, 32U, 32U};
+
+    R_CRC_Type * p_crc  = (R_CRC_Type *) p_peripheral->base;
+    uintptr_t    offset = p_peripheral->address - p_peripheral->base;
+
+    if (BSP_SIM_HOOK_EVENT_WRITE != event)
+    {
+        return;
+    }
+
+    if ((offsetof(R_CRC_Type, CRCCR0) == offset) && (0U != p_crc->CRCCR0_b.DORCIR))
+    {
+        p_crc->CRCCR0_b.DORCIR = 0U;
+        p_crc->CRCDOR          = 0U;
+    }
+
+    uint32_t gps = p_crc->CRCCR0_b.GPS;
+    if ((offsetof(R_CRC_Type, CRCDIR) != offset) || (0U == gps) || (gps >= BSP_SIM_CRC_GPS_COUNT))
+    {
+        return;
+    }
+
+    uint32_t bits = (32U == width[gps]) ? 32U : 8U;
+    uint32_t mask = 0xFFFFFFFFUL >> (32U - width[gps]);
+    uint32_t data = (32U == bits) ? p_crc->CRCDIR : (uint32_t) p_crc->CRCDIR_BY;
+    uint32_t crc  = p_crc->CRCDOR & mask;
+
+    if (0U == p_crc->CRCCR0_b.LMS)
+    {
+        uint32_t reflected = __RBIT(polynomial[gps]) >> (32U - width[gps]);
+        crc ^= data;
+        for (uint32_t i = 0U; i < bits; i++)
+        {
+            crc = (0U != (crc & 1U)) ? ((crc >> 1) ^ reflected) : (crc >> 1);
+        }
+    }
+    else
+    {
+        uint32_t top = 1UL << (width[gps] - 1U);
+        crc ^= data << (width[gps] - bits);
+        for (uint32_t i = 0U; i < bits; i++)
+        {
+            crc = (0U != (crc & top)) ? ((crc << 1) ^ polynomial[gps]) : (crc << 1);
+        }
+    }
+
+    p_crc->CRCDOR = crc & mask;
+}
+
+/*******************************************************************************************************************//**
+ * Register model for the DMA controller channels. Software requests (DMTMD.DCTG = 0) are served on the write that
+ * issues them if DMAST.DMST and DMCNT.DTE are set. With DMREQ.CLRS set the request stays asserted and the complete
+ * transfer runs before the write returns; the request is dropped when the transfer ends. Data moves as a bus master
+ * would move it, so trapped register blocks see the accesses. Requests from ELC events are served by
+ * bsp_sim_dmac_activate().
+ **********************************************************************************************************************/
+static void bsp_sim_dmac_hook (bsp_sim_peripheral_t * const p_peripheral, bsp_sim_hook_event_t event)
+{
+    if (BSP_SIM_HOOK_EVENT_RESET == event)
+    {
+        memset(&g_bsp_sim_dmac_channel[0], 0, sizeof(g_bsp_sim_dmac_channel));
+
+        return;
+    }
+
+    if (BSP_SIM_HOOK_EVENT_WRITE != event)
+    {
+        return;
+    }
+
+    uint32_t                 channel = (uint32_t) ((p_peripheral->address - p_peripheral->base) / BSP_SIM_DMAC_STRIDE);
+    R_DMAC0_Type           * p_dmac  = (R_DMAC0_Type *) (p_peripheral->base + (channel * BSP_SIM_DMAC_STRIDE));
+    bsp_sim_dmac_channel_t * p_state = &g_bsp_sim_dmac_channel[channel];
+
+    /* Enabling the transfer latches the start of the repeat or block area. */
+    if ((0U != p_dmac->DMCNT_b.DTE) && (!p_state->enabled))
+    {
+        p_state->src_start  = p_dmac->DMSAR;
+        p_state->dest_start = p_dmac->DMDAR;
+    }
+    p_state->enabled = (0U != p_dmac->DMCNT_b.DTE);
+
+    while ((0U != p_dmac->DMCNT_b.DTE) && (0U != p_dmac->DMREQ_b.SWREQ) && (0U == p_dmac->DMTMD_b.DCTG) &&
+           (0U != R_DMA->DMAST_b.DMST))
+    {
+        bsp_sim_dmac_request(p_dmac, p_state, channel);
+        if (0U == p_dmac->DMREQ_b.CLRS)
+        {
+            p_dmac->DMREQ_b.SWREQ = 0U;
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Serves one transfer request: one unit in normal and repeat mode, one block in block mode. Raises the transfer end
+ * interrupt if DMINT.DTIE is set.
+ **********************************************************************************************************************/
+static void bsp_sim_dmac_request (R_DMAC0_Type * const p_dmac, bsp_sim_dmac_channel_t * const p_state,
+                                  uint32_t channel)
+{
+    uint32_t size  = 1UL << p_dmac->DMTMD_b.SZ;
+    uint32_t mode  = p_dmac->DMTMD_b.MD;
+    uint32_t units = 1U;
+
+    if (BSP_SIM_DMAC_MODE_BLOCK == mode)
+    {
+        units = (0U == p_dmac->DMCRA_b.DMCRAL) ? BSP_SIM_DMAC_BLOCK_MAX : p_dmac->DMCRA_b.DMCRAL;
+    }
+
+    for (uint32_t i = 0U; i < units; i++)
+    {
+        uint32_t value = bsp_sim_bus_read((uintptr_t) p_dmac->DMSAR, size);
+        bsp_sim_bus_write((uintptr_t) p_dmac->DMDAR, value, size);
+        p_dmac->DMSAR = bsp_sim_dmac_address_next(p_dmac->DMSAR, p_dmac->DMAMD_b.SM, size, p_dmac->DMOFR);
+        p_dmac->DMDAR = bsp_sim_dmac_address_next(p_dmac->DMDAR, p_dmac->DMAMD_b.DM, size, p_dmac->DMOFR);
+    }
+
+    bool end = false;
+    if (BSP_SIM_DMAC_MODE_NORMAL == mode)
+    {
+        p_dmac->DMCRA_b.DMCRAL = (uint16_t) (p_dmac->DMCRA_b.DMCRAL - 1U);
+        end = (0U == p_dmac->DMCRA_b.DMCRAL);
+    }
+    else
+    {
+        uint32_t remaining = (BSP_SIM_DMAC_MODE_BLOCK == mode) ? 0U : (p_dmac->DMCRA_b.DMCRAL - 1U);
+        p_dmac->DMCRA_b.DMCRAL = (uint16_t) remaining;
+        if (0U == remaining)
+        {
+            /* End of a repeat or block: reload the length and return to the start of the repeat area. */
+            p_dmac->DMCRA_b.DMCRAL = p_dmac->DMCRA_b.DMCRAH;
+            if (BSP_SIM_DMAC_AREA_DEST == p_dmac->DMTMD_b.DTS)
+            {
+                p_dmac->DMDAR = p_state->dest_start;
+            }
+            else if (BSP_SIM_DMAC_AREA_SRC == p_dmac->DMTMD_b.DTS)
+            {
+                p_dmac->DMSAR = p_state->src_start;
+            }
+            else
+            {
+                /* No repeat area. */
+            }
+
+            p_dmac->DMCRB = (uint16_t) (p_dmac->DMCRB - 1U);
+            end = (0U == p_dmac->DMCRB);
+        }
+    }
+
+    if (end)
+    {
+        p_dmac->DMCNT_b.DTE   = 0U;
+        p_dmac->DMREQ_b.SWREQ = 0U;
+        p_state->enabled      = false;
+        if (0U != p_dmac->DMINT_b.DTIE)
+        {
+            p_dmac->DMSTS_b.DTIF = 1U;
+            (void) R_BSP_SimEventRaise((elc_event_t) (ELC_EVENT_DMAC0_INT + channel));
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Serves one request on every DMAC channel whose DELSRn selects the event and which is enabled for event activation
+ * (DMTMD.DCTG = 1, DMCNT.DTE and DMAST.DMST set). The request runs like a hook, so the DMAC registers are writable and
+ * the events it raises are queued until it returns. Returns true if any DELSRn selects the event.
+ **********************************************************************************************************************/
+static bool bsp_sim_dmac_activate (elc_event_t event)
+{
+    bool routed = false;
+
+    for (uint32_t channel = 0U; channel < BSP_SIM_DMAC_CHANNELS; channel++)
+    {
+        if ((uint32_t) event != R_ICU->DELSRn[channel].DELSRn_b.DELS)
+        {
+            continue;
+        }
+
+        routed = true;
+
+        R_DMAC0_Type * p_dmac = (R_DMAC0_Type *) (R_DMAC0_BASE + (channel * BSP_SIM_DMAC_STRIDE));
+        if ((0U == p_dmac->DMCNT_b.DTE) || (BSP_SIM_DMAC_TRIGGER_EVENT != p_dmac->DMTMD_b.DCTG) ||
+            (0U == R_DMA->DMAST_b.DMST))
+        {
+            continue;
+        }
+
+        g_bsp_sim_hook_depth++;
+        bsp_sim_trap_unprotect(&g_bsp_sim_dmac);
+        bsp_sim_dmac_request(p_dmac, &g_bsp_sim_dmac_channel[channel], channel);
+        g_bsp_sim_hook_depth--;
+
+        if (0U == g_bsp_sim_hook_depth)
+        {
+            bsp_sim_trap_protect_all();
+            bsp_sim_event_flush();
+        }
+    }
+
+    return routed;
+}
+
+/*******************************************************************************************************************//**
+ * Returns the address a DMAC pointer moves to after one unit, following DMAMD.SM or DMAMD.DM.
+ **********************************************************************************************************************/
+static uint32_t bsp_sim_dmac_address_next (uint32_t address, uint32_t mode, uint32_t size, uint32_t offset)
+{
+    if (BSP_SIM_DMAC_ADDR_OFFSET == mode)
+    {
+        uint32_t magnitude = offset & (BSP_SIM_DMAC_OFFSET_SIGN - 1U);
+        return (0U != (offset & BSP_SIM_DMAC_OFFSET_SIGN)) ? (address - (BSP_SIM_DMAC_OFFSET_SIGN - magnitude)) :
+                                                             (address + magnitude);
+    }
+
+    if (BSP_SIM_DMAC_ADDR_INCREMENT == mode)
+    {
+        return address + size;
+    }
+
+    if (BSP_SIM_DMAC_ADDR_DECREMENT == mode)
+    {
+        return address - size;
+    }
+
+    return address;
+}
+
+/*******************************************************************************************************************//**
+ * EDMAC and ETHERC model. Transmission runs to the first descriptor without TACT when EDTRR.TR is written; reception
+ * happens when a frame is injected with R_BSP_SimEtherReceive(). EESR flags are cleared by writing 1 and EINT is raised
+ * when a flag enabled in EESIPR is set, or when EESIPR enables a flag that is already set.
+ **********************************************************************************************************************/
+static void bsp_sim_ether_hook (bsp_sim_peripheral_t * const p_peripheral, bsp_sim_hook_event_t event)
+{
+    if (BSP_SIM_HOOK_EVENT_RESET == event)
+    {
+        for (uint32_t channel = 0U; channel < BSP_SIM_ETHER_CHANNELS; channel++)
+        {
+            bsp_sim_ether_reset(channel);
+        }
+
+        return;
+    }
+
+    if (BSP_SIM_HOOK_EVENT_WRITE != event)
+    {
+        return;
+    }
+
+    uint32_t                  channel = (uint32_t) ((p_peripheral->address - p_peripheral->base) / BSP_SIM_ETHER_STRIDE);
+    uintptr_t                 offset  = (p_peripheral->address - p_peripheral->base) % BSP_SIM_ETHER_STRIDE;
+    R_EDMAC0_Type           * p_edmac = (R_EDMAC0_Type *) (p_peripheral->base + (channel * BSP_SIM_ETHER_STRIDE));
+    bsp_sim_ether_channel_t * p_state = &g_bsp_sim_ether_channel[channel];
+
+    if (offsetof(R_EDMAC0_Type, EDMR) == offset)
+    {
+        if (0U != (p_edmac->EDMR & BSP_SIM_ETHER_EDMR_SWR))
+        {
+            bsp_sim_ether_reset(channel);
+        }
+    }
+    else if (offsetof(R_EDMAC0_Type, EESR) == offset)
+    {
+        p_state->eesr &= ~p_edmac->EESR;
+        p_edmac->EESR  = p_state->eesr;
+    }
+    else if (offsetof(R_EDMAC0_Type, EESIPR) == offset)
+    {
+        if (0U != (p_state->eesr & p_edmac->EESIPR))
+        {
+            p_state->raise = true;
+        }
+    }
+    else if (offsetof(R_EDMAC0_Type, EDTRR) == offset)
+    {
+        if (0U != (p_edmac->EDTRR & BSP_SIM_ETHER_EDTRR_TR))
+        {
+            bsp_sim_ether_transmit(channel);
+        }
+    }
+    else if (offsetof(R_EDMAC0_Type, EDRRR) == offset)
+    {
+        if ((0U != (p_edmac->EDRRR & BSP_SIM_ETHER_EDRRR_RR)) && (0U == p_state->rx_descriptor))
+        {
+            p_state->rx_descriptor = p_edmac->RDLAR;
+        }
+    }
+    else
+    {
+        /* Other registers hold their value. */
+    }
+
+    bsp_sim_ether_raise(channel);
+}
+
+/*******************************************************************************************************************//**
+ * Returns the EDMAC and ETHERC registers of a channel to their reset values, as EDMR.SWR does.
+ **********************************************************************************************************************/
+static void bsp_sim_ether_reset (uint32_t channel)
+{
+    uintptr_t        base     = g_bsp_sim_ether.base + (channel * BSP_SIM_ETHER_STRIDE);
+    R_ETHERC0_Type * p_etherc = (R_ETHERC0_Type *) (base + BSP_SIM_ETHER_ETHERC_OFFSET);
+
+    memset((void *) base, 0, BSP_SIM_ETHER_STRIDE);
+    p_etherc->IPGR = BSP_SIM_ETHER_IPGR_RESET;
+
+    g_bsp_sim_ether_channel[channel].tx_descriptor = 0U;
+    g_bsp_sim_ether_channel[channel].rx_descriptor = 0U;
+    g_bsp_sim_ether_channel[channel].eesr          = 0U;
+    g_bsp_sim_ether_channel[channel].raise         = false;
+}
+
+/*******************************************************************************************************************//**
+ * Sends the frames of every transmit descriptor with TACT set, starting at the descriptor after the last one sent.
+ * Each completed frame sets EESR.TC and goes to the wire function, or to the receive side if ECMR.ILB is set.
+ * Transmission stops at the first descriptor without TACT, which sets EESR.TDE and clears EDTRR.TR.
+ **********************************************************************************************************************/
+static void bsp_sim_ether_transmit (uint32_t channel)
+{
+    R_EDMAC0_Type           * p_edmac  = (R_EDMAC0_Type *) (g_bsp_sim_ether.base + (channel * BSP_SIM_ETHER_STRIDE));
+    R_ETHERC0_Type          * p_etherc = (R_ETHERC0_Type *) ((uintptr_t) p_edmac + BSP_SIM_ETHER_ETHERC_OFFSET);
+    bsp_sim_ether_channel_t * p_state  = &g_bsp_sim_ether_channel[channel];
+    uint32_t                  length   = 0U;
+
+    if (0U == (p_etherc->ECMR & BSP_SIM_ETHER_ECMR_TE))
+    {
+        return;
+    }
+
+    if (0U == p_state->tx_descriptor)
+    {
+        p_state->tx_descriptor = p_edmac->TDLAR;
+    }
+
+    while (true)
+    {
+        bsp_sim_ether_descriptor_t * p_desc = (bsp_sim_ether_descriptor_t *) (uintptr_t) p_state->tx_descriptor;
+        uint32_t                     status = p_desc->status;
+        if (0U == (status & BSP_SIM_ETHER_DESC_ACT))
+        {
+            bsp_sim_ether_status_set(channel, BSP_SIM_ETHER_EESR_TDE);
+            break;
+        }
+
+        if (0U != (status & BSP_SIM_ETHER_DESC_FP1))
+        {
+            length = 0U;
+        }
+
+        uint32_t count = p_desc->buffer_length;
+        if (count > (BSP_SIM_ETHER_FRAME_MAX - length))
+        {
+            count = BSP_SIM_ETHER_FRAME_MAX - length;
+        }
+        memcpy(&p_state->frame[length], (void const *) (uintptr_t) p_desc->buffer, count);
+        length += count;
+
+        p_desc->status         = status & ~BSP_SIM_ETHER_DESC_ACT;
+        p_state->tx_descriptor = (0U != (status & BSP_SIM_ETHER_DESC_DLE)) ? p_edmac->TDLAR :
+                                 (p_state->tx_descriptor + sizeof(bsp_sim_ether_descriptor_t));
+
+        if (0U != (status & BSP_SIM_ETHER_DESC_FP0))
+        {
+            if (0U != (p_etherc->ECMR & BSP_SIM_ETHER_ECMR_ILB))
+            {
+                (void) bsp_sim_ether_receive(channel, &p_state->frame[0], length);
+            }
+            else if (NULL != gp_bsp_sim_ether_wire[channel])
+            {
+                gp_bsp_sim_ether_wire[channel](channel, &p_state->frame[0], length,
+                                               gp_bsp_sim_ether_wire_context[channel]);
+            }
+            else
+            {
+                /* No link partner, the frame is dropped. */
+            }
+
+            bsp_sim_ether_status_set(channel, BSP_SIM_ETHER_EESR_TC);
+            length = 0U;
+        }
+    }
+
+    p_edmac->EDTRR = 0U;
+}
+
+/*******************************************************************************************************************//**
+ * Stores a received frame in the receive descriptors. The register block must be accessible.
+ **********************************************************************************************************************/
+static ssp_err_t bsp_sim_ether_receive (uint32_t channel, uint8_t const * const p_frame, uint32_t length)
+{
+    R_EDMAC0_Type           * p_edmac  = (R_EDMAC0_Type *) (g_bsp_sim_ether.base + (channel * BSP_SIM_ETHER_STRIDE));
+    R_ETHERC0_Type          * p_etherc = (R_ETHERC0_Type *) ((uintptr_t) p_edmac + BSP_SIM_ETHER_ETHERC_OFFSET);
+    bsp_sim_ether_channel_t * p_state  = &g_bsp_sim_ether_channel[channel];
+
+    if (0U == (p_etherc->ECMR & BSP_SIM_ETHER_ECMR_RE))
+    {
+        return SSP_ERR_NOT_ENABLED;
+    }
+
+    /* Individual addresses other than the station address are filtered out unless the MAC is promiscuous. */
+    bool multicast = (length > 0U) && (0U != (p_frame[0] & 1U));
+    if ((0U == (p_etherc->ECMR & BSP_SIM_ETHER_ECMR_PRM)) && (!multicast) && (length >= 6U))
+    {
+        uint32_t upper = ((uint32_t) p_frame[0] << 24) | ((uint32_t) p_frame[1] << 16) |
+                         ((uint32_t) p_frame[2] << 8) | (uint32_t) p_frame[3];
+        uint32_t lower = ((uint32_t) p_frame[4] << 8) | (uint32_t) p_frame[5];
+        if ((upper != p_etherc->MAHR) || (lower != (p_etherc->MALR & 0xFFFFU)))
+        {
+            return SSP_SUCCESS;
+        }
+    }
+
+    if (0U == (p_edmac->EDRRR & BSP_SIM_ETHER_EDRRR_RR))
+    {
+        p_edmac->RMFCR++;
+        return SSP_ERR_OVERFLOW;
+    }
+
+    if (0U == p_state->rx_descriptor)
+    {
+        p_state->rx_descriptor = p_edmac->RDLAR;
+    }
+
+    uint32_t limit  = (0U != p_etherc->RFLR) ? p_etherc->RFLR : BSP_SIM_ETHER_RFLR_DEFAULT;
+    uint32_t errors = 0U;
+    if (length > limit)
+    {
+        errors = BSP_SIM_ETHER_RFS_RTLF;
+        length = limit;
+    }
+    else if (length < BSP_SIM_ETHER_FRAME_MIN)
+    {
+        errors = BSP_SIM_ETHER_RFS_RTSF;
+    }
+    else
+    {
+        /* Length is valid. */
+    }
+
+    uint32_t offset = 0U;
+    uint32_t frame_position = BSP_SIM_ETHER_DESC_FP1;
+    do
+    {
+        bsp_sim_ether_descriptor_t * p_desc = (bsp_sim_ether_descriptor_t *) (uintptr_t) p_state->rx_descriptor;
+        uint32_t                     status = p_desc->status;
+        if (0U == (status & BSP_SIM_ETHER_DESC_ACT))
+        {
+            /* Receive descriptor empty: the rest of the frame is lost and reception stops. */
+            p_edmac->RMFCR++;
+            p_edmac->EDRRR = 0U;
+            bsp_sim_ether_status_set(channel, BSP_SIM_ETHER_EESR_RDE);
+
+            return SSP_ERR_OVERFLOW;
+        }
+
+        uint32_t count = length - offset;
+        if (count > p_desc->buffer_length)
+        {
+            count = p_desc->buffer_length;
+        }
+        memcpy((void *) (uintptr_t) p_desc->buffer, &p_frame[offset], count);
+        offset += count;
+
+        status = (status & BSP_SIM_ETHER_DESC_DLE) | frame_position;
+        if (offset == length)
+        {
+            status |= BSP_SIM_ETHER_DESC_FP0 | errors | (multicast ? BSP_SIM_ETHER_RFS_RMAF : 0U);
+            status |= (0U != errors) ? BSP_SIM_ETHER_DESC_FE : 0U;
+        }
+        p_desc->frame_length = (uint16_t) count;
+        p_desc->status       = status;
+
+        p_state->rx_descriptor = (0U != (status & BSP_SIM_ETHER_DESC_DLE)) ? p_edmac->RDLAR :
+                                 (p_state->rx_descriptor + sizeof(bsp_sim_ether_descriptor_t));
+        frame_position = 0U;
+    } while (offset < length);
+
+    if (0U == (p_edmac->RMCR & BSP_SIM_ETHER_RMCR_RNR))
+    {
+        p_edmac->EDRRR = 0U;
+    }
+
+    bsp_sim_ether_status_set(channel, BSP_SIM_ETHER_EESR_FR);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Sets EESR flags and notes whether one of them is enabled in EESIPR.
+ **********************************************************************************************************************/
+static void bsp_sim_ether_status_set (uint32_t channel, uint32_t flags)
+{
+    R_EDMAC0_Type           * p_edmac = (R_EDMAC0_Type *) (g_bsp_sim_ether.base + (channel * BSP_SIM_ETHER_STRIDE));
+    bsp_sim_ether_channel_t * p_state = &g_bsp_sim_ether_channel[channel];
+
+    p_state->eesr |= flags;
+    p_edmac->EESR  = p_state->eesr;
+
+    if (0U != (flags & p_edmac->EESIPR))
+    {
+        p_state->raise = true;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Raises EINT once for all enabled flags set during the current access, so a burst of frames queues one event.
+ **********************************************************************************************************************/
+static void bsp_sim_ether_raise (uint32_t channel)
+{
+    if (g_bsp_sim_ether_channel[channel].raise)
+    {
+        g_bsp_sim_ether_channel[channel].raise = false;
+        (void) R_BSP_SimEventRaise(ELC_EVENT_EDMAC0_EINT);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * PDC model. PCCR0.PRST empties the FIFO and clears the status flags at once. Reading PCDR pops the FIFO; reading it
+ * empty sets PCSR.UDRF. PCSR flags are cleared by writing 0.
+ **********************************************************************************************************************/
+static void bsp_sim_pdc_hook (bsp_sim_peripheral_t * const p_peripheral, bsp_sim_hook_event_t event)
+{
+    R_PDC_Type * p_pdc  = (R_PDC_Type *) p_peripheral->base;
+    uintptr_t    offset = p_peripheral->address - p_peripheral->base;
+
+    if (BSP_SIM_HOOK_EVENT_RESET == event)
+    {
+        memset(&g_bsp_sim_pdc_state, 0, sizeof(g_bsp_sim_pdc_state));
+        (void) bsp_sim_pdc_status_set(0U);
+
+        return;
+    }
+
+    if (BSP_SIM_HOOK_EVENT_WRITE == event)
+    {
+        if ((offsetof(R_PDC_Type, PCCR0) == offset) && (0U != (p_pdc->PCCR0 & BSP_SIM_PDC_PCCR0_PRST)))
+        {
+            p_pdc->PCCR0 &= ~BSP_SIM_PDC_PCCR0_PRST;
+            memset(&g_bsp_sim_pdc_state, 0, sizeof(g_bsp_sim_pdc_state));
+        }
+        else if (offsetof(R_PDC_Type, PCSR) == offset)
+        {
+            g_bsp_sim_pdc_state.flags &= p_pdc->PCSR;
+        }
+        else
+        {
+            /* Other registers hold their value. */
+        }
+
+        (void) bsp_sim_pdc_status_set(0U);
+    }
+    else if ((BSP_SIM_HOOK_EVENT_READ == event) && (offsetof(R_PDC_Type, PCDR) == offset))
+    {
+        if (0U == g_bsp_sim_pdc_state.count)
+        {
+            if (0U != (bsp_sim_pdc_status_set(BSP_SIM_PDC_PCSR_UDRF) & BSP_SIM_PDC_PCCR0_UDRIE))
+            {
+                R_BSP_SimEventRaise(ELC_EVENT_PDC_INT);
+            }
+        }
+        else
+        {
+            *((volatile uint32_t *) &p_pdc->PCDR) = g_bsp_sim_pdc_state.fifo[g_bsp_sim_pdc_state.head];
+            g_bsp_sim_pdc_state.head = (g_bsp_sim_pdc_state.head + 1U) % BSP_SIM_PDC_FIFO_WORDS;
+            g_bsp_sim_pdc_state.count--;
+            (void) bsp_sim_pdc_status_set(0U);
+        }
+    }
+    else
+    {
+        /* Steps and other reads do not change the model. */
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Sets PCSR flags and updates the FIFO and frame status bits. The register block must be accessible.
+ *
+ * @return PCCR0, to check whether the flags are enabled.
+ **********************************************************************************************************************/
+static uint32_t bsp_sim_pdc_status_set (uint32_t flags)
+{
+    R_PDC_Type * p_pdc = (R_PDC_Type *) g_bsp_sim_pdc.base;
+
+    g_bsp_sim_pdc_state.flags |= flags & BSP_SIM_PDC_PCSR_FLAGS;
+    p_pdc->PCSR = g_bsp_sim_pdc_state.flags | (g_bsp_sim_pdc_state.busy ? BSP_SIM_PDC_PCSR_FBSY : 0U) |
+                  ((0U == g_bsp_sim_pdc_state.count) ? BSP_SIM_PDC_PCSR_FEMPF : 0U);
+
+    return p_pdc->PCCR0;
+}
+
+/*******************************************************************************************************************//**
+ * Pushes one received word into the FIFO and raises the receive data ready event after every 8 words.
+ *
+ * @param[in]     word        Received word.
+ * @param[in,out] p_stage     Words received since the last receive data ready event.
+ * @param[out]    p_overflow  Set if the FIFO was full and the word was lost.
+ *
+ * @return false if PCCR1.PCE was cleared and the frame is no longer received.
+ **********************************************************************************************************************/
+static bool bsp_sim_pdc_push (uint32_t word, uint32_t * p_stage, bool * p_overflow)
+{
+    R_PDC_Type * p_pdc = (R_PDC_Type *) g_bsp_sim_pdc.base;
+    bool         error = false;
+    bool         ready = false;
+
+    bsp_sim_trap_unprotect(&g_bsp_sim_pdc);
+    if (0U == (p_pdc->PCCR1 & BSP_SIM_PDC_PCCR1_PCE))
+    {
+        bsp_sim_trap_protect_all();
+
+        return false;
+    }
+
+    if (BSP_SIM_PDC_FIFO_WORDS == g_bsp_sim_pdc_state.count)
+    {
+        error       = (0U != (bsp_sim_pdc_status_set(BSP_SIM_PDC_PCSR_OVRF) & BSP_SIM_PDC_PCCR0_OVIE));
+        *p_overflow = true;
+    }
+    else
+    {
+        uint32_t tail = (g_bsp_sim_pdc_state.head + g_bsp_sim_pdc_state.count) % BSP_SIM_PDC_FIFO_WORDS;
+        g_bsp_sim_pdc_state.fifo[tail] = word;
+        g_bsp_sim_pdc_state.count++;
+        (void) bsp_sim_pdc_status_set(0U);
+    }
+
+    (*p_stage)++;
+    if (BSP_SIM_PDC_STAGE_WORDS == *p_stage)
+    {
+        *p_stage = 0U;
+        ready    = (0U != (p_pdc->PCCR0 & BSP_SIM_PDC_PCCR0_DFIE));
+    }
+    bsp_sim_trap_protect_all();
+
+    if (error)
+    {
+        R_BSP_SimEventRaise(ELC_EVENT_PDC_INT);
+    }
+
+    if (ready)
+    {
+        R_BSP_SimEventRaise(ELC_EVENT_PDC_RECEIVE_DATA_READY);
+    }
+
+    return true;
+}
+
+/*******************************************************************************************************************//**
+ * Reads memory as a bus master. A trapped register block sees the access as a CPU read. Only valid while a hook runs.
+ **********************************************************************************************************************/
+static uint32_t bsp_sim_bus_read (uintptr_t address, uint32_t size)
+{
+    bsp_sim_trap_notify(address, BSP_SIM_HOOK_EVENT_READ);
+    bsp_sim_bus_unprotect(address);
+
+    if (1U == size)
+    {
+        return *((volatile uint8_t *) address);
+    }
+
+    if (2U == size)
+    {
+        return *((volatile uint16_t *) address);
+    }
+
+    return *((volatile uint32_t *) address);
+}
+
+/*******************************************************************************************************************//**
+ * Writes memory as a bus master. A trapped register block sees the access as a CPU write. Only valid while a hook
+ * runs.
+ **********************************************************************************************************************/
+static void bsp_sim_bus_write (uintptr_t address, uint32_t value, uint32_t size)
+{
+    bsp_sim_bus_unprotect(address);
+
+    if (1U == size)
+    {
+        *((volatile uint8_t *) address) = (uint8_t) value;
+    }
+    else if (2U == size)
+    {
+        *((volatile uint16_t *) address) = (uint16_t) value;
+    }
+    else
+    {
+        *((volatile uint32_t *) address) = value;
+    }
+
+    bsp_sim_trap_notify(address, BSP_SIM_HOOK_EVENT_WRITE);
+}
+
+/*******************************************************************************************************************//**
+ * Makes the page holding an address accessible if a trapped register block shares it. The page is protected again
+ * when the outermost hook returns.
+ **********************************************************************************************************************/
+static void bsp_sim_bus_unprotect (uintptr_t address)
+{
+    uintptr_t page = address & ~(g_bsp_sim_page_size - 1U);
+
+    for (bsp_sim_peripheral_t * p_entry = gp_bsp_sim_peripherals; NULL != p_entry; p_entry = p_entry->p_next)
+    {
+        if (bsp_sim_trap_covers(p_entry, page))
+        {
+            (void) mprotect((void *) page, g_bsp_sim_page_size, PROT_READ | PROT_WRITE);
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Routes the events that hooks raised. Interrupts taken here may run further hooks, which can queue more events. A
+ * DMAC request served here flushes the queue again from inside this loop, so the read position is shared and every
+ * event is routed once.
+ **********************************************************************************************************************/
+static void bsp_sim_event_flush (void)
+{
+    while (g_bsp_sim_event_next < g_bsp_sim_event_count)
+    {
+        elc_event_t event = g_bsp_sim_events[g_bsp_sim_event_next];
+        g_bsp_sim_event_next++;
+        if (g_bsp_sim_event_next == g_bsp_sim_event_count)
+        {
+            g_bsp_sim_event_next  = 0U;
+            g_bsp_sim_event_count = 0U;
+        }
+
+        (void) R_BSP_SimEventRaise(event);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Returns true if an interrupt with the given priority may not preempt the code that is currently running.
+ **********************************************************************************************************************/
+static bool bsp_sim_irq_masked (uint16_t priority)
+{
+    if ((0U != g_cmsis_host_core.primask) || (0U != g_cmsis_host_core.faultmask))
+    {
+        return true;
+    }
+
+    uint32_t basepri = g_cmsis_host_core.basepri & 0xFFU;
+    if ((0U != basepri) && (priority >= basepri))
+    {
+        return true;
+    }
+
+    return priority >= g_bsp_sim_nvic.execution_priority;
+}
+
+/*******************************************************************************************************************//**
+ * Returns the interrupt that would be taken next, or -1 if none may be taken now.
+ **********************************************************************************************************************/
+static int32_t bsp_sim_irq_highest_pending (void)
+{
+    int32_t  best          = -1;
+    uint16_t best_priority = BSP_SIM_PRIORITY_THREAD;
+
+    for (uint32_t word = 0U; word < BSP_SIM_NVIC_WORDS; word++)
+    {
+        uint32_t ready = g_bsp_sim_nvic.pending[word] & g_bsp_sim_nvic.enabled[word] & ~g_bsp_sim_nvic.active[word];
+        while (0U != ready)
+        {
+            uint32_t bit = (uint32_t) __builtin_ctz(ready);
+            uint32_t irq = (word * 32U) + bit;
+            ready &= ~(1UL << bit);
+
+            if (g_bsp_sim_nvic.priority[irq] < best_priority)
+            {
+                best          = (int32_t) irq;
+                best_priority = g_bsp_sim_nvic.priority[irq];
+            }
+        }
+    }
+
+    if ((best >= 0) && bsp_sim_irq_masked(best_priority))
+    {
+        best = -1;
+    }
+
+    return best;
+}
+
+/*******************************************************************************************************************//**
+ * Performs exception entry, runs the ISR and performs exception return for one interrupt.
+ **********************************************************************************************************************/
+static void bsp_sim_irq_take (uint32_t irq)
+{
+    uint32_t     mask   = 1UL << (irq % 32U);
+    ssp_vector_t p_isr  = R_BSP_SimVectorGet((IRQn_Type) irq);
+    uint32_t     ipsr   = g_cmsis_host_core.ipsr;
+
+    /* Exception entry. */
+    g_bsp_sim_nvic.pending[irq / 32U] &= ~mask;
+    g_bsp_sim_nvic.active[irq / 32U]  |= mask;
+    g_bsp_sim_nvic.preempted[g_bsp_sim_nvic.nesting] = g_bsp_sim_nvic.execution_priority;
+    g_bsp_sim_nvic.nesting++;
+    g_bsp_sim_nvic.execution_priority = g_bsp_sim_nvic.priority[irq];
+    g_cmsis_host_core.ipsr = irq + SSP_PRIV_CORTEX_PROCESSOR_EXCEPTIONS;
+
+    g_bsp_sim_stats.irqs_dispatched++;
+    if (g_bsp_sim_nvic.nesting > g_bsp_sim_stats.max_nesting)
+    {
+        g_bsp_sim_stats.max_nesting = g_bsp_sim_nvic.nesting;
+    }
+
+    if (NULL != p_isr)
+    {
+        p_isr();
+    }
+    else
+    {
+        /* No vector installed: the target would run Default_Handler. */
+        BSP_CFG_HANDLE_UNRECOVERABLE_ERROR(0);
+    }
+
+    /* Exception return. */
+    g_cmsis_host_core.ipsr = ipsr;
+    g_bsp_sim_nvic.nesting--;
+    g_bsp_sim_nvic.execution_priority = g_bsp_sim_nvic.preempted[g_bsp_sim_nvic.nesting];
+    g_bsp_sim_nvic.active[irq / 32U] &= ~mask;
+
+    /* The ICU holds the request while IR is set. */
+    if ((irq < BSP_SIM_ICU_IELSR_COUNT) && (0U != (R_ICU->IELSRn[irq] & BSP_SIM_IELSR_IR)))
+    {
+        g_bsp_sim_nvic.pending[irq / 32U] |= mask;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Calls a peripheral hook. Trapped register blocks are accessible while their own hook runs. A hook may access other
+ * blocks as a bus master, which calls their hooks in turn; traps are restored and queued events are routed once the
+ * outermost hook returns.
+ **********************************************************************************************************************/
+static void bsp_sim_hook_call (bsp_sim_peripheral_t * const p_peripheral, bsp_sim_hook_event_t event)
+{
+    if (NULL == p_peripheral->p_hook)
+    {
+        return;
+    }
+
+    g_bsp_sim_hook_depth++;
+    bsp_sim_trap_unprotect(p_peripheral);
+    p_peripheral->p_hook(p_peripheral, event);
+    g_bsp_sim_hook_depth--;
+
+    if (0U == g_bsp_sim_hook_depth)
+    {
+        bsp_sim_trap_protect_all();
+        bsp_sim_event_flush();
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Makes the pages of a trapped register block accessible. Does nothing for other models.
+ **********************************************************************************************************************/
+static void bsp_sim_trap_unprotect (bsp_sim_peripheral_t const * const p_peripheral)
+{
+    if ((BSP_SIM_TRAP_NONE == p_peripheral->trap) || (0U == g_bsp_sim_page_size))
+    {
+        return;
+    }
+
+    uintptr_t start = p_peripheral->base & ~(g_bsp_sim_page_size - 1U);
+    uintptr_t end   = (p_peripheral->base + p_peripheral->size + g_bsp_sim_page_size - 1U) &
+                      ~(g_bsp_sim_page_size - 1U);
+
+    (void) mprotect((void *) start, end - start, PROT_READ | PROT_WRITE);
+}
+
+/*******************************************************************************************************************//**
+ * Protects the pages of every trapped register block. Access traps are applied last so that a page shared by a write
+ * trapped and an access trapped block traps every access.
+ **********************************************************************************************************************/
+static void bsp_sim_trap_protect_all (void)
+{
+    if (0U == g_bsp_sim_page_size)
+    {
+        return;
+    }
+
+    for (bsp_sim_trap_t trap = BSP_SIM_TRAP_WRITE; trap <= BSP_SIM_TRAP_ACCESS; trap++)
+    {
+        for (bsp_sim_peripheral_t * p_entry = gp_bsp_sim_peripherals; NULL != p_entry; p_entry = p_entry->p_next)
+        {
+            if (trap == p_entry->trap)
+            {
+                uintptr_t start = p_entry->base & ~(g_bsp_sim_page_size - 1U);
+                uintptr_t end   = (p_entry->base + p_entry->size + g_bsp_sim_page_size - 1U) &
+                                  ~(g_bsp_sim_page_size - 1U);
+
+                (void) mprotect((void *) start, end - start, (BSP_SIM_TRAP_ACCESS == trap) ? PROT_NONE : PROT_READ);
+            }
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Returns true if a trapped register block shares the given page.
+ **********************************************************************************************************************/
+static bool bsp_sim_trap_covers (bsp_sim_peripheral_t const * const p_peripheral, uintptr_t page)
+{
+    return (BSP_SIM_TRAP_NONE != p_peripheral->trap) && (page < (p_peripheral->base + p_peripheral->size)) &&
+           ((page + g_bsp_sim_page_size) > p_peripheral->base);
+}
+
+/*******************************************************************************************************************//**
+ * Reports a trapped access to every model whose register block contains the address.
+ **********************************************************************************************************************/
+static void bsp_sim_trap_notify (uintptr_t address, bsp_sim_hook_event_t event)
+{
+    for (bsp_sim_peripheral_t * p_entry = gp_bsp_sim_peripherals; NULL != p_entry; p_entry = p_entry->p_next)
+    {
+        bool reported = (BSP_SIM_HOOK_EVENT_WRITE == event) ? (BSP_SIM_TRAP_NONE != p_entry->trap) :
+                                                               (BSP_SIM_TRAP_ACCESS == p_entry->trap);
+        if (reported && (address >= p_entry->base) && (address < (p_entry->base + p_entry->size)))
+        {
+            p_entry->address = address;
+            bsp_sim_hook_call(p_entry, event);
+        }
+    }
+}
+
+#if BSP_SIM_TRAP_SUPPORTED
+/*******************************************************************************************************************//**
+ * Installs the trap handlers. Both signals are synchronous, and SA_NODEFER lets a hook touch another trapped block.
+ **********************************************************************************************************************/
+static void bsp_sim_trap_install (void)
+{
+    if (g_bsp_sim_trap_installed)
+    {
+        return;
+    }
+
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_flags = SA_SIGINFO | SA_NODEFER;
+
+    action.sa_sigaction = bsp_sim_trap_segv;
+    (void) sigaction(SIGSEGV, &action, NULL);
+    action.sa_sigaction = bsp_sim_trap_step;
+    (void) sigaction(SIGTRAP, &action, NULL);
+
+    g_bsp_sim_trap_installed = true;
+}
+
+/*******************************************************************************************************************//**
+ * Access to a protected register page: report reads before they happen, then unprotect the page and single-step the
+ * access. Faults outside trapped pages are real crashes and are re-raised with the default action.
+ **********************************************************************************************************************/
+static void bsp_sim_trap_segv (int signal, siginfo_t * p_info, void * p_ucontext)
+{
+    uintptr_t    address = (uintptr_t) p_info->si_addr;
+    uintptr_t    page    = address & ~(g_bsp_sim_page_size - 1U);
+    ucontext_t * p_uc    = (ucontext_t *) p_ucontext;
+    bool         trapped = false;
+
+    for (bsp_sim_peripheral_t * p_entry = gp_bsp_sim_peripherals; NULL != p_entry; p_entry = p_entry->p_next)
+    {
+        trapped = trapped || bsp_sim_trap_covers(p_entry, page);
+    }
+
+    if ((!trapped) || (0U != g_bsp_sim_trap_address))
+    {
+        struct sigaction action;
+        memset(&action, 0, sizeof(action));
+        action.sa_handler = SIG_DFL;
+        (void) sigaction(signal, &action, NULL);
+        return;
+    }
+
+    bool write = (0U != ((uint64_t) p_uc->uc_mcontext.gregs[REG_ERR] & BSP_SIM_TRAP_ERR_WRITE));
+    if (!write)
+    {
+        bsp_sim_trap_notify(address, BSP_SIM_HOOK_EVENT_READ);
+    }
+
+    g_bsp_sim_trap_address = address;
+    g_bsp_sim_trap_write   = write;
+    (void) mprotect((void *) page, g_bsp_sim_page_size, PROT_READ | PROT_WRITE);
+    p_uc->uc_mcontext.gregs[REG_EFL] |= BSP_SIM_TRAP_FLAG;
+}
+
+/*******************************************************************************************************************//**
+ * The trapped access has executed: report writes to the models that cover the address and protect the pages again.
+ **********************************************************************************************************************/
+static void bsp_sim_trap_step (int signal, siginfo_t * p_info, void * p_ucontext)
+{
+    ucontext_t * p_uc    = (ucontext_t *) p_ucontext;
+    uintptr_t    address = g_bsp_sim_trap_address;
+
+    SSP_PARAMETER_NOT_USED(p_info);
+
+    if (0U == address)
+    {
+        /* Not a single-step started by the simulator. */
+        struct sigaction action;
+        memset(&action, 0, sizeof(action));
+        action.sa_handler = SIG_DFL;
+        (void) sigaction(signal, &action, NULL);
+        (void) raise(signal);
+        return;
+    }
+
+    p_uc->uc_mcontext.gregs[REG_EFL] &= ~((greg_t) BSP_SIM_TRAP_FLAG);
+    g_bsp_sim_trap_address = 0U;
+    g_bsp_sim_stats.accesses_trapped++;
+
+    if (g_bsp_sim_trap_write)
+    {
+        bsp_sim_trap_notify(address, BSP_SIM_HOOK_EVENT_WRITE);
+    }
+
+    bsp_sim_trap_protect_all();
+}
+#endif /* BSP_SIM_TRAP_SUPPORTED */
+
+/*******************************************************************************************************************//**
+ * Map the device address space before any static constructor or application code touches a register.
+ **********************************************************************************************************************/
+__attribute__((constructor)) static void bsp_sim_constructor (void)
+{
+    (void) bsp_sim_map();
+}
+
+#endif /* defined(BSP_HOST_SIM) */
@@ -0,0 +1,167 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+/***********************************************************************************************************************
+* File Name    : bsp_sim.h
+* Description  : Host simulation of the S5D9 register space, NVIC and ICU for the s5d9_sdk_host build.
+***********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @ingroup BSP_MCU_COMMON
+ * @defgroup BSP_MCU_SIM Host Simulation
+ * @brief Register-level simulation of the MCU used by the s5d9_sdk_host build.
+ *
+ * The host build compiles the same BSP and driver sources for a native Linux target. The peripheral register space
+ * (0x40000000 - 0x407FFFFF), the QSPI window and registers (0x60000000 - 0x6400FFFF), the SRAM region and the Cortex-M
+ * private peripheral bus (0xE0000000 - 0xE00FFFFF) are mapped at their device addresses, so the R_xxx register
+ * definitions from S5D9.h are used unmodified. Peripheral behavior is supplied by hooks registered with
+ * R_BSP_SimPeripheralRegister(); a hook is called when the register model is reset and on every R_BSP_SimStep().
+ * Models that must react to a register access while the driver polls (self-clearing bits, FIFO data registers) select
+ * a trap mode: the pages of the block are protected and the CPU access is single-stepped. The hook receives
+ * BSP_SIM_HOOK_EVENT_READ before a trapped read, so it can load the value the CPU will see, and
+ * BSP_SIM_HOOK_EVENT_WRITE after a trapped write. Each trapped access costs two host signals, so only models that need
+ * them should trap. Hooks run in signal context for trapped accesses. Events a hook raises are queued and routed to the
+ * ICU once the outermost hook returns.
+ *
+ * Built-in models cover the clock generation circuit, the ROM cache, the SCI channels, the CRC calculator and
+ * DMAC transfers. A DMAC channel is started by software or by the ELC event its DELSRn selects, one request per raised
+ * event. The DMAC model moves data as a bus master, so a transfer into a trapped register block (CRCDIR, an SCI data
+ * register) reaches that block's model. The EDMAC/ETHERC model (channel 0) walks the transmit and receive descriptor
+ * rings: transmitted frames go to the function set with R_BSP_SimEtherWireSet(), or back to the receive side with
+ * ECMR.ILB set, and R_BSP_SimEtherReceive() injects frames from the link. The PDC model receives camera frames from
+ * R_BSP_SimPdcFrame() into its FIFO and requests a transfer for every 8 words, as the receive data ready event does.
+ *
+ * Interrupts follow the device path: a peripheral model calls R_BSP_SimEventRaise() with an ELC event, the simulated
+ * ICU sets IR in every IELSRn that selects the event and pends the corresponding NVIC interrupt, and the simulated
+ * NVIC calls the ISR registered for that slot through the .vector section (the same table that fills
+ * gp_vector_information). PRIMASK, BASEPRI and the NVIC priorities are honored, and R_SSP_CurrentIrqGet() returns the
+ * dispatched IRQ while the ISR runs.
+ *
+ * The executable must be linked without PIE (the CMake target does this) because the SSP stores buffer addresses in
+ * 32-bit registers and variables. Buffers handed to DMAC/DTC/peripheral registers must therefore be static or come
+ * from R_BSP_SimSramAlloc().
+ *
+ * @{
+***********************************************************************************************************************/
+
+#ifndef BSP_SIM_H_
+#define BSP_SIM_H_
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+
+/* Common macro for SSP header files. There is also a corresponding SSP_FOOTER macro at the end of this file. */
+SSP_HEADER
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+#define BSP_SIM_PERIPHERAL_BASE     (0x40000000UL)  ///< Start of the simulated peripheral register space
+#define BSP_SIM_PERIPHERAL_SIZE     (0x00800000UL)  ///< Size of the simulated peripheral register space
+#define BSP_SIM_QSPI_BASE           (0x60000000UL)  ///< Start of the QSPI memory window
+#define BSP_SIM_QSPI_SIZE           (0x04010000UL)  ///< QSPI memory window plus QSPI control registers
+#define BSP_SIM_SRAM_BASE           (0x1FFE0000UL)  ///< Start of on-chip SRAM (SRAMHS, SRAM0, SRAM1)
+#define BSP_SIM_SRAM_SIZE           (0x000A0000UL)  ///< Size of on-chip SRAM
+#define BSP_SIM_PPB_BASE            (0xE0000000UL)  ///< Start of the Cortex-M private peripheral bus
+#define BSP_SIM_PPB_SIZE            (0x00100000UL)  ///< Size of the Cortex-M private peripheral bus
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+/** Reasons a peripheral hook is called. */
+typedef enum e_bsp_sim_hook_event
+{
+    BSP_SIM_HOOK_EVENT_RESET,          ///< Register block was cleared, the hook loads its reset values
+    BSP_SIM_HOOK_EVENT_STEP,           ///< Simulation step, the hook reacts to register writes and raises events
+    BSP_SIM_HOOK_EVENT_READ,           ///< A register of a BSP_SIM_TRAP_ACCESS model is about to be read
+    BSP_SIM_HOOK_EVENT_WRITE,          ///< A register of a trapped model was written
+} bsp_sim_hook_event_t;
+
+/** CPU accesses that are reported to a peripheral hook. */
+typedef enum e_bsp_sim_trap
+{
+    BSP_SIM_TRAP_NONE,                 ///< Plain memory, the hook only sees RESET and STEP
+    BSP_SIM_TRAP_WRITE,                ///< Writes are reported with BSP_SIM_HOOK_EVENT_WRITE
+    BSP_SIM_TRAP_ACCESS,               ///< Reads and writes are reported
+} bsp_sim_trap_t;
+
+typedef struct st_bsp_sim_peripheral bsp_sim_peripheral_t;
+
+/** Peripheral behavior hook. */
+typedef void (* bsp_sim_hook_t)(bsp_sim_peripheral_t * const p_peripheral, bsp_sim_hook_event_t event);
+
+/** Activation hook for DTC requests (IELSRn.DTCE set). Returns true if the event must also interrupt the CPU. */
+typedef bool (* bsp_sim_dtc_hook_t)(elc_event_t event, void * p_context);
+
+/** Receives frames transmitted by a simulated Ethernet channel. May run in signal context. */
+typedef void (* bsp_sim_ether_wire_t)(uint32_t channel, uint8_t const * p_frame, uint32_t length, void * p_context);
+
+/** Simulated peripheral. Storage is owned by the caller and must remain valid while registered. */
+struct st_bsp_sim_peripheral
+{
+    char const           * p_name;       ///< Name used in diagnostics
+    uintptr_t              base;         ///< First register address covered by the model
+    uint32_t               size;         ///< Size of the register block in bytes, cleared before RESET
+    bsp_sim_hook_t         p_hook;       ///< Behavior hook, may be NULL for plain memory
+    void                 * p_context;    ///< User context for the hook
+    bsp_sim_trap_t         trap;         ///< CPU accesses reported to the hook
+    uintptr_t              address;      ///< Register accessed, valid during BSP_SIM_HOOK_EVENT_READ/WRITE
+    bsp_sim_peripheral_t * p_next;       ///< Used by the simulator, do not modify
+};
+
+/** Simulator statistics. */
+typedef struct st_bsp_sim_stats
+{
+    uint64_t steps;                    ///< Number of R_BSP_SimStep() calls
+    uint64_t events_raised;            ///< Number of ELC events raised through the ICU
+    uint64_t events_unrouted;          ///< Events raised without an IELSRn selecting them
+    uint64_t irqs_dispatched;          ///< Number of ISR invocations
+    uint64_t accesses_trapped;         ///< Number of CPU accesses to trapped register models
+    uint32_t max_nesting;              ///< Deepest interrupt nesting observed
+} bsp_sim_stats_t;
+
+/***********************************************************************************************************************
+Exported global variables
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Exported global functions (to be accessed by other files)
+***********************************************************************************************************************/
+ssp_err_t R_BSP_SimInit(void);
+ssp_err_t R_BSP_SimReset(void);
+ssp_err_t R_BSP_SimPeripheralRegister(bsp_sim_peripheral_t * const p_peripheral);
+ssp_err_t R_BSP_SimDtcHookSet(bsp_sim_dtc_hook_t p_hook, void * p_context);
+void      R_BSP_SimStep(void);
+ssp_err_t R_BSP_SimEventRaise(elc_event_t event);
+ssp_err_t R_BSP_SimIrqPend(IRQn_Type irq);
+void      R_BSP_SimIrqDispatch(void);
+ssp_vector_t R_BSP_SimVectorGet(IRQn_Type irq);
+void    * R_BSP_SimSramAlloc(uint32_t size, uint32_t alignment);
+void      R_BSP_SimStatsGet(bsp_sim_stats_t * const p_stats);
+ssp_err_t R_BSP_SimSciReceive(uint32_t channel, uint16_t const * const p_data, uint32_t count);
+ssp_err_t R_BSP_SimEtherReceive(uint32_t channel, uint8_t const * const p_frame, uint32_t length);
+ssp_err_t R_BSP_SimEtherWireSet(uint32_t channel, bsp_sim_ether_wire_t p_wire, void * p_context);
+ssp_err_t R_BSP_SimPdcFrame(uint8_t const * const p_image, uint32_t line_bytes, uint32_t lines);
+
+/* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
+SSP_FOOTER
+
+#endif /* BSP_SIM_H_ */
+
+/** @} (end defgroup BSP_MCU_SIM) */
@@ -0,0 +1,326 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+/***********************************************************************************************************************
+* File Name    : bsp_sim_fmi.c
+* Description  : Factory MCU Information for the host simulation build. Replaces the prebuilt FMI library, which only
+*                exists for Cortex-M, with a table describing the register blocks of the simulated S5D9.
+***********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include "bsp_api.h"
+#include <string.h>
+
+#if defined(BSP_HOST_SIM)
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+/** SCI variant data b2:3 = 3, 16-stage FIFO on every channel. */
+#define BSP_SIM_FMI_SCI_VARIANT     (0x0CU)
+
+/** GPT variant data b2 = 1, 32-bit counters on every channel. */
+#define BSP_SIM_FMI_GPT_VARIANT     (0x04U)
+
+/** ADC variant data b2:4 = 2, 12-bit resolution. */
+#define BSP_SIM_FMI_ADC_VARIANT     (0x08U)
+
+/** Number of I/O ports on the simulated device. */
+#define BSP_SIM_FMI_IOPORT_COUNT    (12U)
+
+/** Words of ADC extended data, the valid channel masks. */
+#define BSP_SIM_FMI_ADC_WORDS       (2U)
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+/** One row of the simulated FMI feature table. */
+typedef struct st_bsp_sim_fmi_feature
+{
+    ssp_ip_t   id;                     ///< IP block
+    uint8_t    unit;                   ///< Unit within the IP block
+    uint16_t   channel_count;          ///< Number of channels
+    uint32_t   base;                   ///< Address of channel 0
+    uint32_t   stride;                 ///< Address offset between channels
+    uint16_t   variant_data;           ///< Variant data reported for every channel
+} bsp_sim_fmi_feature_t;
+
+/***********************************************************************************************************************
+Private function prototypes
+***********************************************************************************************************************/
+static ssp_err_t R_FMI_Init(void);
+static ssp_err_t R_FMI_ProductInfoGet(fmi_product_info_t ** pp_product_info);
+static ssp_err_t R_FMI_UniqueIdGet(fmi_unique_id_t * p_unique_id);
+static ssp_err_t R_FMI_ProductFeatureGet(ssp_feature_t const * const p_feature, fmi_feature_info_t * const p_info);
+static ssp_err_t R_FMI_EventInfoGet(ssp_feature_t const * const p_feature, ssp_signal_t signal,
+                                    fmi_event_info_t * const p_info);
+static ssp_err_t R_FMI_VersionGet(ssp_version_t * const p_version);
+
+/***********************************************************************************************************************
+Exported global variables (to be accessed by other files)
+***********************************************************************************************************************/
+/** Filled in Interface API structure for this Instance. */
+const fmi_api_t g_fmi_on_fmi =
+{
+    .init              = R_FMI_Init,
+    .productInfoGet    = R_FMI_ProductInfoGet,
+    .uniqueIdGet       = R_FMI_UniqueIdGet,
+    .productFeatureGet = R_FMI_ProductFeatureGet,
+    .eventInfoGet      = R_FMI_EventInfoGet,
+    .versionGet        = R_FMI_VersionGet
+};
+
+/***********************************************************************************************************************
+Private global variables and functions
+***********************************************************************************************************************/
+/** Register blocks of the simulated device. Addresses match S5D9.h so driver register pointers are interchangeable
+ * with the R_xxx definitions. */
+static const bsp_sim_fmi_feature_t g_bsp_sim_fmi_features[] =
+{
+    {SSP_IP_SYSTEM,  0U,  1U, R_SYSTEM_BASE,    0x0000U, 0U},
+    {SSP_IP_ICU,     0U,  1U, R_ICU_BASE,       0x0000U, 0U},
+    {SSP_IP_DMAC,    0U,  8U, R_DMAC0_BASE,     0x0040U, 0U},
+    {SSP_IP_DMAC,    1U,  1U, R_DMA_BASE,       0x0000U, 0U},
+    {SSP_IP_DTC,     0U,  1U, R_DTC_BASE,       0x0000U, 0U},
+    {SSP_IP_IOPORT,  0U, BSP_SIM_FMI_IOPORT_COUNT, R_IOPORT0_BASE, 0x0020U, 0U},
+    {SSP_IP_PFS,     0U,  1U, R_PFS_BASE,       0x0000U, 0U},
+    {SSP_IP_PFS,     1U,  1U, R_PMISC_BASE,     0x0000U, 0U},
+    {SSP_IP_ELC,     0U,  1U, R_ELC_BASE,       0x0000U, 0U},
+    {SSP_IP_MSTP,    0U,  1U, R_MSTP_BASE,      0x0000U, 0U},
+    {SSP_IP_CAC,     0U,  1U, R_CAC_BASE,       0x0000U, 0U},
+    {SSP_IP_DOC,     0U,  1U, R_DOC_BASE,       0x0000U, 0U},
+    {SSP_IP_CRC,     0U,  1U, R_CRC_BASE,       0x0000U, 0U},
+    {SSP_IP_SCI,     0U, 10U, R_SCI0_BASE,      0x0020U, BSP_SIM_FMI_SCI_VARIANT},
+    {SSP_IP_IIC,     0U,  3U, R_IIC0_BASE,      0x0100U, 0U},
+    {SSP_IP_SPI,     0U,  2U, R_RSPI0_BASE,     0x0100U, 0U},
+    {SSP_IP_ADC,     0U,  2U, R_S12ADC0_BASE,   0x0200U, BSP_SIM_FMI_ADC_VARIANT},
+    {SSP_IP_DAC,     0U,  2U, R_DAC_BASE,       0x0000U, 0U},
+    {SSP_IP_RTC,     0U,  1U, R_RTC_BASE,       0x0000U, 0U},
+    {SSP_IP_WDT,     0U,  1U, R_WDT_BASE,       0x0000U, 0U},
+    {SSP_IP_IWDT,    0U,  1U, R_IWDT_BASE,      0x0000U, 0U},
+    {SSP_IP_GPT,     0U, 14U, R_GPTA0_BASE,     0x0100U, BSP_SIM_FMI_GPT_VARIANT},
+    {SSP_IP_GPT,     1U,  1U, R_GPT_OPS_BASE,   0x0000U, 0U},
+    {SSP_IP_POEG,    0U,  1U, R_POEG_BASE,      0x0000U, 0U},
+    {SSP_IP_AGT,     0U,  2U, R_AGT0_BASE,      0x0100U, 0U},
+    {SSP_IP_CAN,     0U,  2U, R_CAN0_BASE,      0x1000U, 0U},
+    {SSP_IP_QSPI,    0U,  1U, R_QSPI_BASE,      0x0000U, 0U},
+    {SSP_IP_SDHIMMC, 0U,  2U, R_SDHI0_BASE,     0x0400U, 0U},
+    {SSP_IP_SRC,     0U,  1U, R_SRC_BASE,       0x0000U, 0U},
+    {SSP_IP_SSI,     0U,  2U, R_SSI0_BASE,      0x0100U, 0U},
+    {SSP_IP_EDMAC,   0U,  2U, R_EDMAC0_BASE,    0x0200U, 0U},
+    {SSP_IP_EDMAC,   1U,  2U, R_ETHERC0_BASE,   0x0200U, 0U},
+    {SSP_IP_EPTPC,   0U,  2U, R_EPTPC0_BASE,    0x0400U, 0U},
+    {SSP_IP_PDC,     0U,  1U, R_PDC_BASE,       0x0000U, 0U},
+    {SSP_IP_GLCDC,   0U,  1U, R_GLCDC_BASE,     0x0000U, 0U},
+    {SSP_IP_DRW,     0U,  1U, R_G2D_BASE,       0x0000U, 0U},
+    {SSP_IP_JPEG,    0U,  1U, R_JPEG_BASE,      0x0000U, 0U},
+};
+
+/** Every pin of every port exists on the simulated device. Bit 16 + n is set when pin n of the port exists. */
+static const uint32_t g_bsp_sim_fmi_ioport_exists[BSP_SIM_FMI_IOPORT_COUNT] =
+{
+    0xFFFF0000U, 0xFFFF0000U, 0xFFFF0000U, 0xFFFF0000U, 0xFFFF0000U, 0xFFFF0000U,
+    0xFFFF0000U, 0xFFFF0000U, 0xFFFF0000U, 0xFFFF0000U, 0xFFFF0000U, 0xFFFF0000U
+};
+
+/** ADC channels 0 to 7 and 16 to 20 exist on both units. The upper half of the first word has the mask of channels 0
+ *  to 15, the upper half of the second word the mask of channels 16 to 31. */
+static const uint32_t g_bsp_sim_fmi_adc_channels[BSP_SIM_FMI_ADC_WORDS] =
+{
+    0x00FF0000U, 0x001F0000U
+};
+
+/** Product information of the simulated part. */
+static fmi_product_info_t g_bsp_sim_fmi_product_info =
+{
+    .product_name  = {'R','7','F','S','5','D','9','7','E','3','A','0','1','C','F','C'},
+    .pin_count     = 176U,
+    .max_freq      = 120U,
+};
+
+/** Version data returned by R_FMI_VersionGet(). */
+static const ssp_version_t g_bsp_sim_fmi_version =
+{
+    .api_version_minor  = FMI_API_VERSION_MINOR,
+    .api_version_major  = FMI_API_VERSION_MAJOR,
+    .code_version_major = FMI_CODE_VERSION_MAJOR,
+    .code_version_minor = FMI_CODE_VERSION_MINOR
+};
+
+/*******************************************************************************************************************//**
+ * @addtogroup BSP_MCU_SIM
+ *
+ * @{
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @brief Implements fmi_api_t::init. The simulated table needs no initialization.
+ *
+ * @retval SSP_SUCCESS  Always.
+ **********************************************************************************************************************/
+static ssp_err_t R_FMI_Init (void)
+{
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Implements fmi_api_t::productInfoGet.
+ *
+ * @retval SSP_SUCCESS  Pointer to the simulated product information stored in pp_product_info.
+ **********************************************************************************************************************/
+static ssp_err_t R_FMI_ProductInfoGet (fmi_product_info_t ** pp_product_info)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != pp_product_info);
+#endif
+
+    *pp_product_info = &g_bsp_sim_fmi_product_info;
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Implements fmi_api_t::uniqueIdGet. The simulated device reports a fixed ID.
+ *
+ * @retval SSP_SUCCESS  Unique ID stored in p_unique_id.
+ **********************************************************************************************************************/
+static ssp_err_t R_FMI_UniqueIdGet (fmi_unique_id_t * p_unique_id)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_unique_id);
+#endif
+
+    p_unique_id->unique_id[0] = 0x53354439U;
+    p_unique_id->unique_id[1] = 0x484F5354U;
+    p_unique_id->unique_id[2] = 0U;
+    p_unique_id->unique_id[3] = 0U;
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Implements fmi_api_t::productFeatureGet using the simulated feature table.
+ *
+ * @retval SSP_SUCCESS               Feature information stored in p_info.
+ * @retval SSP_ERR_INVALID_CHANNEL   The channel does not exist on the simulated device.
+ * @retval SSP_ERR_UNSUPPORTED       The IP block or unit does not exist on the simulated device.
+ **********************************************************************************************************************/
+static ssp_err_t R_FMI_ProductFeatureGet (ssp_feature_t const * const p_feature, fmi_feature_info_t * const p_info)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_feature);
+    SSP_ASSERT(NULL != p_info);
+#endif
+
+    for (uint32_t i = 0U; i < (sizeof(g_bsp_sim_fmi_features) / sizeof(g_bsp_sim_fmi_features[0])); i++)
+    {
+        bsp_sim_fmi_feature_t const * p_row = &g_bsp_sim_fmi_features[i];
+        if ((p_row->id == p_feature->id) && (p_row->unit == p_feature->unit))
+        {
+            if (p_feature->channel >= p_row->channel_count)
+            {
+                return SSP_ERR_INVALID_CHANNEL;
+            }
+
+            memset(p_info, 0, sizeof(*p_info));
+            p_info->ptr           = (void *) (uintptr_t) (p_row->base + (p_row->stride * p_feature->channel));
+            p_info->channel_count = p_row->channel_count;
+            p_info->variant_data  = p_row->variant_data;
+            p_info->version_major = 1U;
+            if (SSP_IP_IOPORT == p_feature->id)
+            {
+                p_info->ptr_extended_data   = (void *) &g_bsp_sim_fmi_ioport_exists[0];
+                p_info->extended_data_count = BSP_SIM_FMI_IOPORT_COUNT;
+            }
+            if (SSP_IP_ADC == p_feature->id)
+            {
+                p_info->ptr_extended_data   = (void *) &g_bsp_sim_fmi_adc_channels[0];
+                p_info->extended_data_count = BSP_SIM_FMI_ADC_WORDS;
+            }
+
+            return SSP_SUCCESS;
+        }
+    }
+
+    return SSP_ERR_UNSUPPORTED;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Implements fmi_api_t::eventInfoGet.
+ *
+ * The target FMI resolves the ELC event from the factory table and the IRQ from the vector information. On the host
+ * both are taken from gp_vector_information, which is built from SSP_VECTOR_DEFINE entries exactly as on the target,
+ * so only signals that have a vector are reported.
+ *
+ * @retval SSP_SUCCESS               Event and IRQ stored in p_info.
+ * @retval SSP_ERR_IRQ_BSP_DISABLED  No vector is defined for the signal.
+ **********************************************************************************************************************/
+static ssp_err_t R_FMI_EventInfoGet (ssp_feature_t const * const p_feature, ssp_signal_t signal,
+                                     fmi_event_info_t * const p_info)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_feature);
+    SSP_ASSERT(NULL != p_info);
+#endif
+
+    extern ssp_vector_info_t * const gp_vector_information;
+    extern uint32_t g_vector_information_size;
+
+    p_info->irq   = SSP_INVALID_VECTOR;
+    p_info->event = (elc_event_t) 0;
+
+    for (uint32_t i = 0U; i < g_vector_information_size; i++)
+    {
+        ssp_vector_info_t const * p_vector_info = &gp_vector_information[i];
+        if ((p_vector_info->ip_id == (uint32_t) p_feature->id) &&
+            (p_vector_info->ip_channel == p_feature->channel) &&
+            (p_vector_info->ip_unit == p_feature->unit) &&
+            (p_vector_info->ip_signal == (uint32_t) signal))
+        {
+            p_info->irq   = (IRQn_Type) i;
+            p_info->event = (elc_event_t) p_vector_info->event_number;
+
+            return SSP_SUCCESS;
+        }
+    }
+
+    return SSP_ERR_IRQ_BSP_DISABLED;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Implements fmi_api_t::versionGet.
+ *
+ * @retval SSP_SUCCESS  Version stored in p_version.
+ **********************************************************************************************************************/
+static ssp_err_t R_FMI_VersionGet (ssp_version_t * const p_version)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_version);
+#endif
+
+    p_version->version_id = g_bsp_sim_fmi_version.version_id;
+
+    return SSP_SUCCESS;
+}
+
+/** @} (end addtogroup BSP_MCU_SIM) */
+
+#endif /* defined(BSP_HOST_SIM) */
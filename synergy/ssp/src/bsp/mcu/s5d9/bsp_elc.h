@@ -44,6 +44,26 @@
 /***********************************************************************************************************************
 Macro definitions
 ***********************************************************************************************************************/
+/** Number of peripherals that can receive an event link. */
+#define BSP_ELC_PERIPHERAL_COUNT (19U)
+
+/** Highest event number. */
+#define BSP_ELC_EVENT_MAX        (511U)
+
+/** True if the event number in e is defined in ::elc_event_t for this MCU. The numbers that are not defined are
+ *  reserved and must not be written to an ELC link or ICU event register. This is a constant expression. */
+#define BSP_ELC_EVENT_VALID(e) \
+    ((((e) >= 1U) && ((e) <= 16U)) || (((e) >= 32U) && ((e) <= 39U)) || (((e) >= 41U) && ((e) <= 42U)) || \
+     ((e) == 45U) || (((e) >= 48U) && ((e) <= 49U)) || (((e) >= 56U) && ((e) <= 57U)) || \
+     (((e) >= 59U) && ((e) <= 60U)) || (((e) >= 64U) && ((e) <= 92U)) || (((e) >= 95U) && ((e) <= 107U)) || \
+     (((e) >= 109U) && ((e) <= 112U)) || (((e) >= 114U) && ((e) <= 115U)) || ((e) == 117U) || \
+     (((e) >= 120U) && ((e) <= 157U)) || (((e) >= 176U) && ((e) <= 263U)) || (((e) >= 266U) && ((e) <= 273U)) || \
+     (((e) >= 276U) && ((e) <= 283U)) || (((e) >= 286U) && ((e) <= 293U)) || (((e) >= 296U) && ((e) <= 303U)) || \
+     (((e) >= 306U) && ((e) <= 313U)) || ((e) == 336U) || (((e) >= 352U) && ((e) <= 355U)) || \
+     (((e) >= 357U) && ((e) <= 382U)) || (((e) >= 384U) && ((e) <= 388U)) || (((e) >= 390U) && ((e) <= 394U)) || \
+     (((e) >= 396U) && ((e) <= 400U)) || (((e) >= 402U) && ((e) <= 406U)) || (((e) >= 408U) && ((e) <= 412U)) || \
+     (((e) >= 414U) && ((e) <= 418U)) || (((e) >= 420U) && ((e) <= 424U)) || (((e) >= 426U) && ((e) <= 430U)) || \
+     (((e) >= 444U) && ((e) <= 462U)) || (((e) >= 481U) && ((e) <= 491U)) || (((e) >= 506U) && ((e) <= 511U)))
 
 /***********************************************************************************************************************
 Typedef definitions
@@ -88,6 +88,10 @@ Includes   <System Includes> , "Project Includes"
 /* BSP Common Includes (Other than bsp_common.h) */
 #include "../../src/bsp/mcu/all/bsp_common_leds.h"
 #include "../../src/bsp/mcu/all/bsp_delay.h"
+#include "../../src/bsp/mcu/all/bsp_pool.h"
+#include "../../src/bsp/mcu/all/bsp_work.h"
+#include "../../src/bsp/mcu/all/bsp_timer.h"
+#include "../../src/bsp/mcu/all/bsp_isr_trace.h"
 #include "../../src/bsp/mcu/all/bsp_feature.h"
 
 #include "../../src/bsp/mcu/all/bsp_mcu_api.h"
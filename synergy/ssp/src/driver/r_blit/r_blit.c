@@ -0,0 +1,954 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : r_blit.c
+ * Description  : HAL API code for the software 2D blitter
+ **********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "r_blit.h"
+#include "r_blit_private.h"
+#include "r_blit_private_api.h"
+#include <string.h>
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/** "BLT" in ASCII, used to determine if the driver is open. */
+#define BLIT_OPEN                 (0x00424C54ULL)
+
+/** Unit of a DMAC copy. Copies are only given to the DMAC when both surfaces and the line are aligned to it. */
+#define BLIT_TRANSFER_UNIT_BYTES  (4U)
+
+/** Macro for error logger. */
+#ifndef BLIT_ERROR_RETURN
+/*LDRA_INSPECTED 77 S This macro does not work when surrounded by parentheses. */
+#define BLIT_ERROR_RETURN(a, err) SSP_ERROR_RETURN((a), (err), &g_module_name[0], &s_blit_version)
+#endif
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+/** Source and destination of one operation after clipping. */
+typedef struct st_blit_area
+{
+    uint8_t        * p_dest;        ///< First destination pixel
+    uint8_t const  * p_src;         ///< First source pixel, NULL for a fill
+    uint32_t         width;         ///< Pixels per line
+    uint32_t         height;        ///< Lines
+} blit_area_t;
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static uint32_t blit_pixel_bytes (display_in_format_t format);
+static bool blit_clip (blit_surface_t const * const p_dest, int32_t x, int32_t y, blit_surface_t const * const p_src,
+                       blit_rect_t const * const p_rect, blit_area_t * const p_area);
+static void blit_line_read (uint32_t * p_argb, blit_surface_t const * const p_surface, uint8_t const * p_pixel,
+                            uint32_t count);
+static void blit_line_write (uint8_t * p_pixel, blit_surface_t const * const p_surface, uint32_t const * p_argb,
+                             uint32_t count);
+static void blit_line_blend (uint32_t * p_dest, uint32_t const * p_src, uint32_t count, uint32_t alpha);
+static uint32_t blit_color_encode (display_in_format_t format, uint32_t color);
+static void blit_line_fill (uint8_t * p_pixel, uint32_t bytes, uint32_t value, uint32_t count);
+static ssp_err_t blit_surface_check (blit_surface_t const * const p_surface);
+static ssp_err_t blit_transfer_open (blit_instance_ctrl_t * const p_ctrl);
+static ssp_err_t blit_transfer_copy (blit_instance_ctrl_t * const p_ctrl, void * p_dest, void const * p_src,
+                                     uint32_t count);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+#if defined(__GNUC__)
+/* This structure is affected by warnings from the GCC compiler bug https:/gcc.gnu.org/bugzilla/show_bug.cgi?id=60784
+ * This pragma suppresses the warnings in this structure only, and will be removed when the SSP compiler is updated to
+ * v5.3.*/
+/*LDRA_INSPECTED 69 S */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmissing-field-initializers"
+#endif
+/** Version data structure used by error logger macro. */
+static const ssp_version_t s_blit_version =
+{
+    .api_version_minor  = BLIT_API_VERSION_MINOR,
+    .api_version_major  = BLIT_API_VERSION_MAJOR,
+    .code_version_major = BLIT_CODE_VERSION_MAJOR,
+    .code_version_minor = BLIT_CODE_VERSION_MINOR
+};
+#if defined(__GNUC__)
+/* Restore warning settings for 'missing-field-initializers' to as specified on command line. */
+/*LDRA_INSPECTED 69 S */
+#pragma GCC diagnostic pop
+#endif
+
+/** Name of module used by error logger macro */
+#if BSP_CFG_ERROR_LOG != 0
+static const char          g_module_name[] = "blit";
+#endif
+
+/** Filled in Interface API structure for this Instance. */
+/*LDRA_INSPECTED 27 D This structure must be accessible in user code. It cannot be static. */
+const blit_api_t g_blit_on_blit =
+{
+    .open       = R_BLIT_Open,
+    .fill       = R_BLIT_Fill,
+    .copy       = R_BLIT_Copy,
+    .blend      = R_BLIT_Blend,
+    .convert    = R_BLIT_Convert,
+    .close      = R_BLIT_Close,
+    .versionGet = R_BLIT_VersionGet
+};
+
+/** @addtogroup BLIT
+ * @{
+ */
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @brief  Open the blitter.
+ *
+ *  Implements blit_api_t::open
+ *
+ * The optional DMAC instance is configured for 4-byte copies between incrementing addresses with a software start,
+ * and opened.
+ *
+ * @retval SSP_SUCCESS             The blitter is ready.
+ * @retval SSP_ERR_ASSERTION       p_ctrl or p_cfg is NULL, or the DMAC instance is incomplete.
+ * @retval SSP_ERR_IN_USE          The blitter is already open.
+ * @return                         See @ref Common_Error_Codes or functions called by this function for other possible
+ *                                 return codes. This function calls:
+ *                                   * transfer_api_t::open
+ **********************************************************************************************************************/
+ssp_err_t R_BLIT_Open (blit_ctrl_t * const p_api_ctrl, blit_cfg_t const * const p_cfg)
+{
+    blit_instance_ctrl_t * p_ctrl = (blit_instance_ctrl_t *) p_api_ctrl;
+
+#if BLIT_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(p_ctrl);
+    SSP_ASSERT(p_cfg);
+    BLIT_ERROR_RETURN(BLIT_OPEN != p_ctrl->open, SSP_ERR_IN_USE);
+#endif
+
+    p_ctrl->p_transfer    = p_cfg->p_transfer;
+    p_ctrl->dma_threshold = (0U != p_cfg->dma_threshold_bytes) ? p_cfg->dma_threshold_bytes
+                                                                 : BLIT_CFG_DMA_THRESHOLD_BYTES;
+
+    /** Open the DMAC used for large copies */
+    if (NULL != p_ctrl->p_transfer)
+    {
+        ssp_err_t err = blit_transfer_open(p_ctrl);
+        BLIT_ERROR_RETURN(SSP_SUCCESS == err, err);
+    }
+
+    /** Mark driver as initialized by setting the open value to the ASCII equivalent of "BLT" */
+    p_ctrl->open = BLIT_OPEN;
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Fill a rectangle with a color.
+ *
+ *  Implements blit_api_t::fill
+ *
+ * The color is converted to the surface format once, and 16-bit and 8-bit pixels are stored a word at a time.
+ *
+ * @retval SSP_SUCCESS             The rectangle is filled, or lies outside the surface.
+ * @retval SSP_ERR_ASSERTION       A pointer is NULL.
+ * @retval SSP_ERR_NOT_OPEN        The blitter is not open.
+ * @retval SSP_ERR_UNSUPPORTED     The surface is CLUT4 or CLUT1.
+ **********************************************************************************************************************/
+ssp_err_t R_BLIT_Fill (blit_ctrl_t * const p_api_ctrl, blit_surface_t const * const p_dest,
+                       blit_rect_t const * const p_rect, uint32_t color)
+{
+    blit_instance_ctrl_t * p_ctrl = (blit_instance_ctrl_t *) p_api_ctrl;
+
+#if BLIT_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(p_ctrl);
+    SSP_ASSERT(p_dest);
+    BLIT_ERROR_RETURN(BLIT_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+#endif
+    SSP_PARAMETER_NOT_USED(p_ctrl);
+
+    ssp_err_t err = blit_surface_check(p_dest);
+    BLIT_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    /** Clip the rectangle to the surface, the surface acts as its own source */
+    blit_rect_t rect = {0, 0, p_dest->width, p_dest->height};
+    if (NULL != p_rect)
+    {
+        rect = *p_rect;
+    }
+    blit_area_t area;
+    if (!blit_clip(p_dest, rect.x, rect.y, p_dest, &rect, &area))
+    {
+        return SSP_SUCCESS;
+    }
+
+    uint32_t bytes = blit_pixel_bytes(p_dest->format);
+    uint32_t value = blit_color_encode(p_dest->format, color);
+    for (uint32_t line = 0U; line < area.height; line++)
+    {
+        blit_line_fill(area.p_dest, bytes, value, area.width);
+        area.p_dest += p_dest->stride;
+    }
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Copy a rectangle to a surface of the same format.
+ *
+ *  Implements blit_api_t::copy
+ *
+ * Copies of at least the DMAC threshold are given to the DMAC when the surfaces and the line length are word
+ * aligned: as one transfer if neither surface has padding between lines, otherwise one transfer per line. Other
+ * copies are done line by line with memcpy.
+ *
+ * @retval SSP_SUCCESS             The rectangle is copied, or lies outside a surface.
+ * @retval SSP_ERR_ASSERTION       A pointer is NULL.
+ * @retval SSP_ERR_NOT_OPEN        The blitter is not open.
+ * @retval SSP_ERR_INVALID_ARGUMENT The surfaces have different formats.
+ * @retval SSP_ERR_UNSUPPORTED     A surface is CLUT4 or CLUT1.
+ * @return                         See @ref Common_Error_Codes or functions called by this function for other possible
+ *                                 return codes. This function calls:
+ *                                   * transfer_api_t::reset
+ *                                   * transfer_api_t::start
+ *                                   * transfer_api_t::infoGet
+ **********************************************************************************************************************/
+ssp_err_t R_BLIT_Copy (blit_ctrl_t * const p_api_ctrl, blit_surface_t const * const p_dest, int16_t x, int16_t y,
+                       blit_surface_t const * const p_src, blit_rect_t const * const p_rect)
+{
+    blit_instance_ctrl_t * p_ctrl = (blit_instance_ctrl_t *) p_api_ctrl;
+
+#if BLIT_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(p_ctrl);
+    SSP_ASSERT(p_dest);
+    SSP_ASSERT(p_src);
+    BLIT_ERROR_RETURN(BLIT_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+#endif
+
+    ssp_err_t err = blit_surface_check(p_dest);
+    if (SSP_SUCCESS == err)
+    {
+        err = blit_surface_check(p_src);
+    }
+    BLIT_ERROR_RETURN(SSP_SUCCESS == err, err);
+    BLIT_ERROR_RETURN(p_dest->format == p_src->format, SSP_ERR_INVALID_ARGUMENT);
+
+    blit_area_t area;
+    if (!blit_clip(p_dest, x, y, p_src, p_rect, &area))
+    {
+        return SSP_SUCCESS;
+    }
+
+    uint32_t line_bytes = area.width * blit_pixel_bytes(p_dest->format);
+    uint32_t total      = line_bytes * area.height;
+
+    /** Give large word aligned copies to the DMAC */
+    if ((NULL != p_ctrl->p_transfer) && (total >= p_ctrl->dma_threshold) &&
+        (0U == ((((uint32_t) (uintptr_t) area.p_dest) | ((uint32_t) (uintptr_t) area.p_src) | line_bytes |
+                 p_dest->stride | p_src->stride) % BLIT_TRANSFER_UNIT_BYTES)))
+    {
+        if ((p_dest->stride == line_bytes) && (p_src->stride == line_bytes))
+        {
+            return blit_transfer_copy(p_ctrl, area.p_dest, area.p_src, total / BLIT_TRANSFER_UNIT_BYTES);
+        }
+
+        for (uint32_t line = 0U; (SSP_SUCCESS == err) && (line < area.height); line++)
+        {
+            err = blit_transfer_copy(p_ctrl, area.p_dest, area.p_src, line_bytes / BLIT_TRANSFER_UNIT_BYTES);
+            area.p_dest += p_dest->stride;
+            area.p_src  += p_src->stride;
+        }
+
+        return err;
+    }
+
+    for (uint32_t line = 0U; line < area.height; line++)
+    {
+        memcpy(area.p_dest, area.p_src, line_bytes);
+        area.p_dest += p_dest->stride;
+        area.p_src  += p_src->stride;
+    }
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Blend a rectangle over a surface.
+ *
+ *  Implements blit_api_t::blend
+ *
+ * Lines are blended in chunks of BLIT_CFG_LINE_PIXELS pixels expanded to ARGB8888. Each pixel is blended with the
+ * source alpha a, the source alpha scaled by the global alpha, as (s * a + d * (255 - a)) / 255 for all four channels,
+ * where the source alpha channel is taken as 255. Fully transparent and fully opaque pixels skip the arithmetic.
+ *
+ * @retval SSP_SUCCESS             The rectangle is blended, or lies outside a surface.
+ * @retval SSP_ERR_ASSERTION       A pointer is NULL, or a CLUT8 source has no color look up table.
+ * @retval SSP_ERR_NOT_OPEN        The blitter is not open.
+ * @retval SSP_ERR_UNSUPPORTED     The destination is CLUT8, or a surface is CLUT4 or CLUT1.
+ **********************************************************************************************************************/
+ssp_err_t R_BLIT_Blend (blit_ctrl_t * const p_api_ctrl, blit_surface_t const * const p_dest, int16_t x, int16_t y,
+                        blit_surface_t const * const p_src, blit_rect_t const * const p_rect, uint8_t alpha)
+{
+    blit_instance_ctrl_t * p_ctrl = (blit_instance_ctrl_t *) p_api_ctrl;
+
+#if BLIT_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(p_ctrl);
+    SSP_ASSERT(p_dest);
+    SSP_ASSERT(p_src);
+    SSP_ASSERT((DISPLAY_IN_FORMAT_CLUT8 != p_src->format) || (NULL != p_src->p_clut));
+    BLIT_ERROR_RETURN(BLIT_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+#endif
+    SSP_PARAMETER_NOT_USED(p_ctrl);
+
+    ssp_err_t err = blit_surface_check(p_dest);
+    if (SSP_SUCCESS == err)
+    {
+        err = blit_surface_check(p_src);
+    }
+    BLIT_ERROR_RETURN(SSP_SUCCESS == err, err);
+    BLIT_ERROR_RETURN(DISPLAY_IN_FORMAT_CLUT8 != p_dest->format, SSP_ERR_UNSUPPORTED);
+
+    blit_area_t area;
+    if ((0U == alpha) || (!blit_clip(p_dest, x, y, p_src, p_rect, &area)))
+    {
+        return SSP_SUCCESS;
+    }
+
+    uint32_t dest_bytes = blit_pixel_bytes(p_dest->format);
+    uint32_t src_bytes  = blit_pixel_bytes(p_src->format);
+    uint32_t src_line[BLIT_CFG_LINE_PIXELS];
+    uint32_t dest_line[BLIT_CFG_LINE_PIXELS];
+
+    for (uint32_t line = 0U; line < area.height; line++)
+    {
+        for (uint32_t done = 0U; done < area.width; done += (uint32_t) BLIT_CFG_LINE_PIXELS)
+        {
+            uint32_t count = area.width - done;
+            if (count > (uint32_t) BLIT_CFG_LINE_PIXELS)
+            {
+                count = (uint32_t) BLIT_CFG_LINE_PIXELS;
+            }
+
+            blit_line_read(src_line, p_src, area.p_src + (done * src_bytes), count);
+            blit_line_read(dest_line, p_dest, area.p_dest + (done * dest_bytes), count);
+            blit_line_blend(dest_line, src_line, count, alpha);
+            blit_line_write(area.p_dest + (done * dest_bytes), p_dest, dest_line, count);
+        }
+        area.p_dest += p_dest->stride;
+        area.p_src  += p_src->stride;
+    }
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Copy a rectangle to a surface of another format.
+ *
+ *  Implements blit_api_t::convert
+ *
+ * Lines are converted in chunks of BLIT_CFG_LINE_PIXELS pixels through ARGB8888. Channels are widened by repeating
+ * their high bits and narrowed by truncation, so converting to a wider format and back is lossless. Surfaces of the
+ * same format are copied.
+ *
+ * @retval SSP_SUCCESS             The rectangle is converted, or lies outside a surface.
+ * @retval SSP_ERR_ASSERTION       A pointer is NULL, or a CLUT8 source has no color look up table.
+ * @retval SSP_ERR_NOT_OPEN        The blitter is not open.
+ * @retval SSP_ERR_UNSUPPORTED     The destination is CLUT8 and the source is not, or a surface is CLUT4 or CLUT1.
+ * @return                         See @ref Common_Error_Codes or functions called by this function for other possible
+ *                                 return codes. This function calls:
+ *                                   * blit_api_t::copy
+ **********************************************************************************************************************/
+ssp_err_t R_BLIT_Convert (blit_ctrl_t * const p_api_ctrl, blit_surface_t const * const p_dest, int16_t x, int16_t y,
+                          blit_surface_t const * const p_src, blit_rect_t const * const p_rect)
+{
+    blit_instance_ctrl_t * p_ctrl = (blit_instance_ctrl_t *) p_api_ctrl;
+
+#if BLIT_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(p_ctrl);
+    SSP_ASSERT(p_dest);
+    SSP_ASSERT(p_src);
+    SSP_ASSERT((DISPLAY_IN_FORMAT_CLUT8 != p_src->format) || (NULL != p_src->p_clut));
+    BLIT_ERROR_RETURN(BLIT_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+#endif
+
+    /** Surfaces of the same format need no conversion */
+    if (p_dest->format == p_src->format)
+    {
+        return R_BLIT_Copy(p_ctrl, p_dest, x, y, p_src, p_rect);
+    }
+
+    ssp_err_t err = blit_surface_check(p_dest);
+    if (SSP_SUCCESS == err)
+    {
+        err = blit_surface_check(p_src);
+    }
+    BLIT_ERROR_RETURN(SSP_SUCCESS == err, err);
+    BLIT_ERROR_RETURN(DISPLAY_IN_FORMAT_CLUT8 != p_dest->format, SSP_ERR_UNSUPPORTED);
+
+    blit_area_t area;
+    if (!blit_clip(p_dest, x, y, p_src, p_rect, &area))
+    {
+        return SSP_SUCCESS;
+    }
+
+    uint32_t dest_bytes = blit_pixel_bytes(p_dest->format);
+    uint32_t src_bytes  = blit_pixel_bytes(p_src->format);
+    uint32_t argb[BLIT_CFG_LINE_PIXELS];
+
+    for (uint32_t line = 0U; line < area.height; line++)
+    {
+        for (uint32_t done = 0U; done < area.width; done += (uint32_t) BLIT_CFG_LINE_PIXELS)
+        {
+            uint32_t count = area.width - done;
+            if (count > (uint32_t) BLIT_CFG_LINE_PIXELS)
+            {
+                count = (uint32_t) BLIT_CFG_LINE_PIXELS;
+            }
+
+            blit_line_read(argb, p_src, area.p_src + (done * src_bytes), count);
+            blit_line_write(area.p_dest + (done * dest_bytes), p_dest, argb, count);
+        }
+        area.p_dest += p_dest->stride;
+        area.p_src  += p_src->stride;
+    }
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Close the blitter.
+ *
+ *  Implements blit_api_t::close
+ *
+ * @retval SSP_SUCCESS             The blitter is closed.
+ * @retval SSP_ERR_ASSERTION       p_ctrl is NULL.
+ * @retval SSP_ERR_NOT_OPEN        The blitter is not open.
+ **********************************************************************************************************************/
+ssp_err_t R_BLIT_Close (blit_ctrl_t * const p_api_ctrl)
+{
+    blit_instance_ctrl_t * p_ctrl = (blit_instance_ctrl_t *) p_api_ctrl;
+
+#if BLIT_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(p_ctrl);
+    BLIT_ERROR_RETURN(BLIT_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+#endif
+
+    /** Close the DMAC */
+    if (NULL != p_ctrl->p_transfer)
+    {
+        p_ctrl->p_transfer->p_api->close(p_ctrl->p_transfer->p_ctrl);
+    }
+
+    /** Mark driver as closed */
+    p_ctrl->open = 0U;
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief      Get the driver version based on compile time macros.
+ *
+ *   Implements blit_api_t::versionGet
+ *
+ * @retval     SSP_SUCCESS          Successful close.
+ * @retval     SSP_ERR_ASSERTION    p_version is NULL.
+ *
+ **********************************************************************************************************************/
+ssp_err_t R_BLIT_VersionGet (ssp_version_t * const p_version)
+{
+#if BLIT_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(p_version);
+#endif
+
+    p_version->version_id = s_blit_version.version_id;
+
+    return SSP_SUCCESS;
+}
+/******************************************************************************************************************//**
+ * @} (end defgroup BLIT)
+**********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @brief  Size of one pixel in bytes.
+ *
+ * @param[in]  format  Pixel format, not CLUT4 or CLUT1.
+ *
+ * @return  Bytes per pixel.
+ **********************************************************************************************************************/
+static uint32_t blit_pixel_bytes (display_in_format_t format)
+{
+    if (DISPLAY_IN_FORMAT_CLUT8 == format)
+    {
+        return 1U;
+    }
+    if (DISPLAY_IN_FORMAT_16BITS_RGB565 <= format)
+    {
+        return 2U;
+    }
+    return 4U;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Check that a surface can be drawn into or read from.
+ *
+ * @param[in]  p_surface  Surface.
+ *
+ * @retval SSP_SUCCESS             The surface is usable.
+ * @retval SSP_ERR_ASSERTION       The surface has no pixels.
+ * @retval SSP_ERR_UNSUPPORTED     The surface is CLUT4 or CLUT1.
+ **********************************************************************************************************************/
+static ssp_err_t blit_surface_check (blit_surface_t const * const p_surface)
+{
+#if BLIT_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_surface->p_base);
+#endif
+
+    BLIT_ERROR_RETURN(DISPLAY_IN_FORMAT_CLUT8 >= p_surface->format, SSP_ERR_UNSUPPORTED);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Clip a source rectangle placed at x, y in the destination to both surfaces.
+ *
+ * @param[in]  p_dest  Destination surface.
+ * @param[in]  x       Left edge of the destination in pixels.
+ * @param[in]  y       Top edge of the destination in lines.
+ * @param[in]  p_src   Source surface.
+ * @param[in]  p_rect  Source rectangle, NULL for the whole source surface.
+ * @param[out] p_area  First pixels and size of the clipped rectangle.
+ *
+ * @retval true   Some pixels remain.
+ * @retval false  The rectangle lies outside a surface.
+ **********************************************************************************************************************/
+static bool blit_clip (blit_surface_t const * const p_dest, int32_t x, int32_t y, blit_surface_t const * const p_src,
+                       blit_rect_t const * const p_rect, blit_area_t * const p_area)
+{
+    int32_t sx = 0;
+    int32_t sy = 0;
+    int32_t w  = (int32_t) p_src->width;
+    int32_t h  = (int32_t) p_src->height;
+    if (NULL != p_rect)
+    {
+        sx = p_rect->x;
+        sy = p_rect->y;
+        w  = (int32_t) p_rect->width;
+        h  = (int32_t) p_rect->height;
+    }
+
+    /** Clip to the source, moving the destination with the left and top edges */
+    if (sx < 0)
+    {
+        x  -= sx;
+        w  += sx;
+        sx  = 0;
+    }
+    if (sy < 0)
+    {
+        y  -= sy;
+        h  += sy;
+        sy  = 0;
+    }
+    w = (w < ((int32_t) p_src->width - sx)) ? w : ((int32_t) p_src->width - sx);
+    h = (h < ((int32_t) p_src->height - sy)) ? h : ((int32_t) p_src->height - sy);
+
+    /** Clip to the destination, moving the source with the left and top edges */
+    if (x < 0)
+    {
+        sx -= x;
+        w  += x;
+        x   = 0;
+    }
+    if (y < 0)
+    {
+        sy -= y;
+        h  += y;
+        y   = 0;
+    }
+    w = (w < ((int32_t) p_dest->width - x)) ? w : ((int32_t) p_dest->width - x);
+    h = (h < ((int32_t) p_dest->height - y)) ? h : ((int32_t) p_dest->height - y);
+
+    if ((w <= 0) || (h <= 0))
+    {
+        return false;
+    }
+
+    p_area->p_dest = (uint8_t *) p_dest->p_base + ((uint32_t) y * p_dest->stride) +
+                     ((uint32_t) x * blit_pixel_bytes(p_dest->format));
+    p_area->p_src  = (uint8_t const *) p_src->p_base + ((uint32_t) sy * p_src->stride) +
+                     ((uint32_t) sx * blit_pixel_bytes(p_src->format));
+    p_area->width  = (uint32_t) w;
+    p_area->height = (uint32_t) h;
+
+    return true;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Expand pixels to ARGB8888. Channels are widened by repeating their high bits, opaque formats get an alpha
+ *         of 0xFF.
+ *
+ * @param[out] p_argb     ARGB8888 pixels.
+ * @param[in]  p_surface  Surface the pixels belong to.
+ * @param[in]  p_pixel    First pixel.
+ * @param[in]  count      Number of pixels.
+ **********************************************************************************************************************/
+static void blit_line_read (uint32_t * p_argb, blit_surface_t const * const p_surface, uint8_t const * p_pixel,
+                            uint32_t count)
+{
+    uint32_t const * p_word = (uint32_t const *) p_pixel;
+    uint16_t const * p_half = (uint16_t const *) p_pixel;
+
+    switch (p_surface->format)
+    {
+        case DISPLAY_IN_FORMAT_32BITS_ARGB8888:
+        {
+            memcpy(p_argb, p_word, count * sizeof(uint32_t));
+            break;
+        }
+        case DISPLAY_IN_FORMAT_32BITS_RGB888:
+        {
+            for (uint32_t i = 0U; i < count; i++)
+            {
+                p_argb[i] = p_word[i] | BLIT_ALPHA_OPAQUE;
+            }
+            break;
+        }
+        case DISPLAY_IN_FORMAT_16BITS_RGB565:
+        {
+            for (uint32_t i = 0U; i < count; i++)
+            {
+                uint32_t p = p_half[i];
+                uint32_t r = (p >> 11) & 0x1FU;
+                uint32_t g = (p >> 5) & 0x3FU;
+                uint32_t b = p & 0x1FU;
+                p_argb[i] = BLIT_ALPHA_OPAQUE | (((r << 3) | (r >> 2)) << 16) | (((g << 2) | (g >> 4)) << 8) |
+                            ((b << 3) | (b >> 2));
+            }
+            break;
+        }
+        case DISPLAY_IN_FORMAT_16BITS_ARGB1555:
+        {
+            for (uint32_t i = 0U; i < count; i++)
+            {
+                uint32_t p = p_half[i];
+                uint32_t r = (p >> 10) & 0x1FU;
+                uint32_t g = (p >> 5) & 0x1FU;
+                uint32_t b = p & 0x1FU;
+                p_argb[i] = ((p & 0x8000U) ? BLIT_ALPHA_OPAQUE : 0U) | (((r << 3) | (r >> 2)) << 16) |
+                            (((g << 3) | (g >> 2)) << 8) | ((b << 3) | (b >> 2));
+            }
+            break;
+        }
+        case DISPLAY_IN_FORMAT_16BITS_ARGB4444:
+        {
+            for (uint32_t i = 0U; i < count; i++)
+            {
+                /* Spread the four nibbles to the low nibble of each byte, then repeat each nibble. */
+                uint32_t p = p_half[i];
+                uint32_t n = ((p & 0xF000U) << 12) | ((p & 0x0F00U) << 8) | ((p & 0x00F0U) << 4) | (p & 0x000FU);
+                p_argb[i] = n * 0x11U;
+            }
+            break;
+        }
+        default:
+        {
+            /* DISPLAY_IN_FORMAT_CLUT8 */
+            for (uint32_t i = 0U; i < count; i++)
+            {
+                p_argb[i] = p_surface->p_clut[p_pixel[i]];
+            }
+            break;
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Store ARGB8888 pixels in the surface format. Channels are narrowed by truncation.
+ *
+ * @param[out] p_pixel    First pixel.
+ * @param[in]  p_surface  Surface the pixels belong to, not CLUT8.
+ * @param[in]  p_argb     ARGB8888 pixels.
+ * @param[in]  count      Number of pixels.
+ **********************************************************************************************************************/
+static void blit_line_write (uint8_t * p_pixel, blit_surface_t const * const p_surface, uint32_t const * p_argb,
+                             uint32_t count)
+{
+    uint32_t * p_word = (uint32_t *) p_pixel;
+    uint16_t * p_half = (uint16_t *) p_pixel;
+
+    switch (p_surface->format)
+    {
+        case DISPLAY_IN_FORMAT_32BITS_ARGB8888:
+        {
+            memcpy(p_word, p_argb, count * sizeof(uint32_t));
+            break;
+        }
+        case DISPLAY_IN_FORMAT_32BITS_RGB888:
+        {
+            for (uint32_t i = 0U; i < count; i++)
+            {
+                p_word[i] = p_argb[i] | BLIT_ALPHA_OPAQUE;
+            }
+            break;
+        }
+        default:
+        {
+            for (uint32_t i = 0U; i < count; i++)
+            {
+                p_half[i] = (uint16_t) blit_color_encode(p_surface->format, p_argb[i]);
+            }
+            break;
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Convert an ARGB8888 color to a pixel value.
+ *
+ * @param[in]  format  Pixel format.
+ * @param[in]  color   ARGB8888 color, or the color index for CLUT8.
+ *
+ * @return  Pixel value in the low bits.
+ **********************************************************************************************************************/
+static uint32_t blit_color_encode (display_in_format_t format, uint32_t color)
+{
+    switch (format)
+    {
+        case DISPLAY_IN_FORMAT_32BITS_RGB888:
+        {
+            return color | BLIT_ALPHA_OPAQUE;
+        }
+        case DISPLAY_IN_FORMAT_16BITS_RGB565:
+        {
+            return ((color >> 8) & 0xF800U) | ((color >> 5) & 0x07E0U) | ((color >> 3) & 0x001FU);
+        }
+        case DISPLAY_IN_FORMAT_16BITS_ARGB1555:
+        {
+            return ((color >> 16) & 0x8000U) | ((color >> 9) & 0x7C00U) | ((color >> 6) & 0x03E0U) |
+                   ((color >> 3) & 0x001FU);
+        }
+        case DISPLAY_IN_FORMAT_16BITS_ARGB4444:
+        {
+            return ((color >> 16) & 0xF000U) | ((color >> 12) & 0x0F00U) | ((color >> 8) & 0x00F0U) |
+                   ((color >> 4) & 0x000FU);
+        }
+        case DISPLAY_IN_FORMAT_CLUT8:
+        {
+            return color & 0xFFU;
+        }
+        default:
+        {
+            /* DISPLAY_IN_FORMAT_32BITS_ARGB8888 */
+            return color;
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Store one pixel value repeatedly, a word at a time once the destination is word aligned.
+ *
+ * @param[out] p_pixel  First pixel.
+ * @param[in]  bytes    Bytes per pixel: 1, 2 or 4.
+ * @param[in]  value    Pixel value.
+ * @param[in]  count    Number of pixels.
+ **********************************************************************************************************************/
+static void blit_line_fill (uint8_t * p_pixel, uint32_t bytes, uint32_t value, uint32_t count)
+{
+    if (1U == bytes)
+    {
+        memset(p_pixel, (int) value, count);
+        return;
+    }
+
+    if (2U == bytes)
+    {
+        /** Store a leading pixel to align to a word, then pixel pairs */
+        uint16_t * p_half = (uint16_t *) p_pixel;
+        if ((0U != (((uint32_t) (uintptr_t) p_half) & 2U)) && (count > 0U))
+        {
+            *p_half++ = (uint16_t) value;
+            count--;
+        }
+        value |= value << 16;
+        uint32_t * p_word = (uint32_t *) p_half;
+        for (uint32_t i = 0U; i < (count / 2U); i++)
+        {
+            p_word[i] = value;
+        }
+        if (0U != (count & 1U))
+        {
+            p_half[count - 1U] = (uint16_t) value;
+        }
+        return;
+    }
+
+    uint32_t * p_word = (uint32_t *) p_pixel;
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        p_word[i] = value;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Blend ARGB8888 source pixels over destination pixels.
+ *
+ * Both pairs of channels of a pixel are blended with one multiply-accumulate per lane pair, see BLIT_LANES_RB.
+ *
+ * @param[in,out] p_dest  Destination pixels.
+ * @param[in]     p_src   Source pixels.
+ * @param[in]     count   Number of pixels.
+ * @param[in]     alpha   Global alpha, 1 to 255.
+ **********************************************************************************************************************/
+static void blit_line_blend (uint32_t * p_dest, uint32_t const * p_src, uint32_t count, uint32_t alpha)
+{
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        uint32_t s = p_src[i];
+        uint32_t a = s >> BLIT_ALPHA_SHIFT;
+        if (255U != alpha)
+        {
+            uint32_t t = (a * alpha) + 128U;
+            a = (t + (t >> 8)) >> 8;
+        }
+
+        if (0U == a)
+        {
+            continue;
+        }
+
+        /** The source alpha channel is blended as 255, which gives a + d * (255 - a) / 255 */
+        s |= BLIT_ALPHA_OPAQUE;
+        if (255U == a)
+        {
+            p_dest[i] = s;
+            continue;
+        }
+
+        uint32_t d  = p_dest[i];
+        uint32_t na = 255U - a;
+        uint32_t rb = (BLIT_LANES_RB(s) * a) + (BLIT_LANES_RB(d) * na) + BLIT_LANES_ROUND;
+        uint32_t ag = (BLIT_LANES_AG(s) * a) + (BLIT_LANES_AG(d) * na) + BLIT_LANES_ROUND;
+        p_dest[i] = BLIT_LANES_DIV255(rb) | (BLIT_LANES_DIV255(ag) << 8);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Configure the DMAC for word copies between incrementing addresses and open it.
+ *
+ * @param[in]  p_ctrl  Pointer to the control block.
+ *
+ * @retval SSP_SUCCESS             The DMAC is open.
+ * @retval SSP_ERR_ASSERTION       The DMAC instance is incomplete.
+ * @return                         See @ref Common_Error_Codes or functions called by this function for other possible
+ *                                 return codes. This function calls:
+ *                                   * transfer_api_t::open
+ **********************************************************************************************************************/
+static ssp_err_t blit_transfer_open (blit_instance_ctrl_t * const p_ctrl)
+{
+    transfer_instance_t const * p_transfer = p_ctrl->p_transfer;
+
+#if BLIT_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_transfer->p_api);
+    SSP_ASSERT(NULL != p_transfer->p_ctrl);
+    SSP_ASSERT(NULL != p_transfer->p_cfg);
+    SSP_ASSERT(NULL != p_transfer->p_cfg->p_info);
+#endif
+
+    transfer_cfg_t    cfg    = *(p_transfer->p_cfg);
+    transfer_info_t * p_info = p_transfer->p_cfg->p_info;
+    p_info->mode           = TRANSFER_MODE_NORMAL;
+    p_info->irq            = TRANSFER_IRQ_END;
+    p_info->size           = TRANSFER_SIZE_4_BYTE;
+    p_info->dest_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED;
+    p_info->src_addr_mode  = TRANSFER_ADDR_MODE_INCREMENTED;
+    cfg.activation_source  = ELC_EVENT_ELC_SOFTWARE_EVENT_0;
+    cfg.auto_enable        = false;
+    cfg.p_callback         = NULL;
+
+    return p_transfer->p_api->open(p_transfer->p_ctrl, &cfg);
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Copy words with the DMAC and wait for the copy to complete.
+ *
+ * @param[in]  p_ctrl  Pointer to the control block.
+ * @param[out] p_dest  Word aligned destination.
+ * @param[in]  p_src   Word aligned source.
+ * @param[in]  count   Number of words.
+ *
+ * @retval SSP_SUCCESS             All words copied.
+ * @return                         See @ref Common_Error_Codes or functions called by this function for other possible
+ *                                 return codes. This function calls:
+ *                                   * transfer_api_t::reset
+ *                                   * transfer_api_t::start
+ *                                   * transfer_api_t::infoGet
+ **********************************************************************************************************************/
+static ssp_err_t blit_transfer_copy (blit_instance_ctrl_t * const p_ctrl, void * p_dest, void const * p_src,
+                                     uint32_t count)
+{
+    transfer_instance_t const * p_transfer = p_ctrl->p_transfer;
+    transfer_properties_t       properties = {0U};
+    uint8_t       * p_to   = (uint8_t *) p_dest;
+    uint8_t const * p_from = (uint8_t const *) p_src;
+
+    ssp_err_t err = p_transfer->p_api->infoGet(p_transfer->p_ctrl, &properties);
+    uint32_t max = properties.transfer_length_max;
+
+    while ((SSP_SUCCESS == err) && (count > 0U))
+    {
+        uint32_t chunk = (count < max) ? count : max;
+
+        /** Software start until the block is complete */
+        err = p_transfer->p_api->reset(p_transfer->p_ctrl, p_from, p_to, (uint16_t) chunk);
+        if (SSP_SUCCESS == err)
+        {
+            err = p_transfer->p_api->start(p_transfer->p_ctrl, TRANSFER_START_MODE_REPEAT);
+        }
+        while (SSP_SUCCESS == err)
+        {
+            err = p_transfer->p_api->infoGet(p_transfer->p_ctrl, &properties);
+            if ((0U == properties.transfer_length_remaining) && (!properties.in_progress))
+            {
+                break;
+            }
+        }
+
+        p_to   += chunk * BLIT_TRANSFER_UNIT_BYTES;
+        p_from += chunk * BLIT_TRANSFER_UNIT_BYTES;
+        count  -= chunk;
+    }
+
+    return err;
+}
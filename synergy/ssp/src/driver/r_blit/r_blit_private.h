@@ -0,0 +1,70 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : r_blit_private.h
+ * Description  : Blitter pixel lane arithmetic
+ **********************************************************************************************************************/
+
+
+/*******************************************************************************************************************//**
+ * @addtogroup BLIT
+ * @{
+ **********************************************************************************************************************/
+
+#ifndef R_BLIT_PRIVATE_H
+#define R_BLIT_PRIVATE_H
+
+/**********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+
+/**********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+/** An ARGB8888 pixel is processed as two lanes of 16 bits, each holding one 8-bit channel: blue and red in the RB
+ *  lanes, green and alpha in the AG lanes. A lane holds the product of two channels plus a rounding constant without
+ *  carrying into its neighbour. */
+#define BLIT_LANES_MASK          (0x00FF00FFUL)
+#define BLIT_LANES_ROUND         (0x00800080UL)
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+/** Split a pixel into lanes with UXTB16, one instruction per lane pair. */
+#define BLIT_LANES_RB(x)         __UXTB16(x)
+#define BLIT_LANES_AG(x)         __UXTB16(__ROR((x), 8U))
+#else
+/** Split a pixel into lanes, C equivalent of the Cortex-M4 instructions. */
+#define BLIT_LANES_RB(x)         ((x) & BLIT_LANES_MASK)
+#define BLIT_LANES_AG(x)         (((x) >> 8) & BLIT_LANES_MASK)
+#endif
+
+/** Divide both lanes of t by 255. t must include BLIT_LANES_ROUND, the result is exactly round(x / 255) for lane
+ *  values x up to 255 * 255. */
+#define BLIT_LANES_DIV255(t)     ((((t) + (((t) >> 8) & BLIT_LANES_MASK)) >> 8) & BLIT_LANES_MASK)
+
+/** Alpha channel of an ARGB8888 pixel. */
+#define BLIT_ALPHA_SHIFT         (24U)
+#define BLIT_ALPHA_OPAQUE        (0xFF000000UL)
+
+#endif /* R_BLIT_PRIVATE_H */
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup BLIT)
+ **********************************************************************************************************************/
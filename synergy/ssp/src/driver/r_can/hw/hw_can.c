@@ -358,6 +358,44 @@ void HW_CAN_MailboxIdSet (R_CAN0_Type   *       p_can_regs,
     }
 }
 
+/*******************************************************************************************************************//**
+ * @brief      This function sets the id of one receive mailbox and enables it for receive.
+ * @param[in]  p_can_regs   CAN registers
+ * @param[in]  mailbox      Mailbox number
+ * @param[in]  id           ID to receive
+ * @param[in]  frame_type   Data or remote frame type
+ * @param[in]  id_mode      Standard or extended id mode
+ **********************************************************************************************************************/
+void HW_CAN_ReceiveMailboxSet (R_CAN0_Type      * p_can_regs,
+                               uint32_t           mailbox,
+                               can_id_t           id,
+                               can_frame_type_t   frame_type,
+                               can_id_mode_t      id_mode)
+{
+    /** Clear RX control register */
+    p_can_regs->MCTLn_RX[mailbox] = 0x00U;
+
+    /** Set the receive ID depending on the configured mode type. */
+    if (CAN_ID_MODE_STANDARD == id_mode)
+    {
+        p_can_regs->MBn[mailbox].MBn_ID = 0x00U;
+        p_can_regs->MBn[mailbox].MBn_ID_b.SID = (id & CAN_SID_MASK);
+    }
+    else
+    {
+        p_can_regs->MBn[mailbox].MBn_ID = (id & CAN_XID_MASK);
+    }
+
+    /** Only write 0 to IDE outside of mixed ID mode. */
+    p_can_regs->MBn[mailbox].MBn_ID_b.IDE = 0U;
+
+    /** Set receive mailbox for either Data or Remote frame type. */
+    p_can_regs->MBn[mailbox].MBn_ID_b.RTR = frame_type;
+
+    /** Clear NEWDATA, Mailbox configured for receive */
+    p_can_regs->MCTLn_RX[mailbox] = CAN_MAILBOX_RX;
+}
+
 /*******************************************************************************************************************//**
  * @brief      This function sets the mask for all receive mailboxes.
  * @param[in]  p_can_regs     CAN registers
@@ -126,6 +126,9 @@ void HW_CAN_MailboxIdSet(R_CAN0_Type * p_can_regs, uint32_t count, can_mailbox_t
 void HW_CAN_MailboxMaskSet(R_CAN0_Type * p_can_regs, uint32_t count, uint32_t * const p_mailbox_mask,
         can_id_mode_t id_mode);
 
+void HW_CAN_ReceiveMailboxSet(R_CAN0_Type * p_can_regs, uint32_t mailbox, can_id_t id, can_frame_type_t frame_type,
+        can_id_mode_t id_mode);
+
 bool HW_CAN_TimeStampReset(R_CAN0_Type * p_can_regs);
 
 bool HW_CAN_BitRateGet(R_CAN0_Type * p_can_regs, uint32_t * const p_frequency);
@@ -427,6 +430,59 @@ __STATIC_INLINE void HW_CAN_ClockSet (R_CAN0_Type* p_can_regs, can_clock_source_
     p_can_regs->BCR_b.CCLKS = clock_source;
 }
 
+/*******************************************************************************************************************//**
+ * @brief      This function returns the time stamp of the frame in a receive mailbox.
+ * @param[in]  p_can_regs   CAN registers
+ * @param[in]  mailbox      Mailbox number
+ * @retval     Time stamp counter value captured when the frame was stored.
+ **********************************************************************************************************************/
+__STATIC_INLINE uint16_t HW_CAN_ReceiveTimeStampGet (R_CAN0_Type * p_can_regs, uint32_t mailbox)
+{
+    return p_can_regs->MBn[mailbox].MBn_TS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief      This function stops a mailbox from receiving or transmitting.
+ * @param[in]  p_can_regs   CAN registers
+ * @param[in]  mailbox      Mailbox number
+ **********************************************************************************************************************/
+__STATIC_INLINE void HW_CAN_MailboxDisable (R_CAN0_Type * p_can_regs, uint32_t mailbox)
+{
+    p_can_regs->MCTLn_TX[mailbox] = CAN_MAILBOX_IDLE;
+}
+
+/*******************************************************************************************************************//**
+ * @brief      This function sets the mask of one group of 4 mailboxes.
+ * @param[in]  p_can_regs   CAN registers
+ * @param[in]  group        Mailbox group number
+ * @param[in]  mask         ID bits compared by mailboxes using the mask, 1 compares the bit
+ * @param[in]  id_mode      Standard or extended id mode
+ **********************************************************************************************************************/
+__STATIC_INLINE void HW_CAN_GroupMaskSet (R_CAN0_Type * p_can_regs, uint32_t group, uint32_t mask,
+                                          can_id_mode_t id_mode)
+{
+    if (CAN_ID_MODE_STANDARD == id_mode)
+    {
+        /** Set standard ID mask. Set unused bits high */
+        p_can_regs->MKRn[group] = CAN_DEFAULT_MASK;
+        p_can_regs->MKRn_b[group].SID = (mask & CAN_SID_MASK);
+    }
+    else
+    {
+        p_can_regs->MKRn[group] = (mask & CAN_XID_MASK);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @brief      This function selects which mailboxes compare the ID through the mask of their group.
+ * @param[in]  p_can_regs   CAN registers
+ * @param[in]  invalid      One bit per mailbox, 1 compares all ID bits and ignores the group mask
+ **********************************************************************************************************************/
+__STATIC_INLINE void HW_CAN_MaskInvalidSet (R_CAN0_Type * p_can_regs, uint32_t invalid)
+{
+    p_can_regs->MKIVLR = invalid;
+}
+
 /* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
 SSP_FOOTER
 
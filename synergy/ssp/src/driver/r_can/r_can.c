@@ -25,6 +25,7 @@
 /***********************************************************************************************************************
  * Includes
  **********************************************************************************************************************/
+#include <string.h>
 #include "r_can.h"
 #include "r_can_cfg.h"
 #include "r_cgc_api.h"
@@ -44,9 +45,44 @@
 /** Non-zero value used to determine if the control block is open. */
 #define CAN_OPEN    (0x5243414EU)
 
+/** Number of entries the filter compiler keeps. One receive mailbox holds one entry. */
+#define CAN_FILTER_ENTRIES_MAX      (CAN_MAX_NO_MAILBOXES)
+
+/** Marks a mailbox without a filter entry, and a mailbox group without a mask. */
+#define CAN_FILTER_SLOT_NONE        (0xFFU)
+#define CAN_FILTER_GROUP_NO_MASK    (0xFFFFFFFFU)
+
+#define CAN_FILTER_GROUPS           (CAN_MAX_NO_MAILBOXES / CAN_MAILBOX_GROUP_SIZE)
+#define CAN_SID_BITS                (11U)
+#define CAN_XID_BITS                (29U)
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
+/** One acceptance filter entry: a receive mailbox ID and the ID bits it compares. */
+typedef struct st_can_filter_entry
+{
+    can_id_t          id;                   ///< ID, only the bits set in care are meaningful
+    uint32_t          care;                 ///< ID bits compared, 1 compares the bit
+    can_frame_type_t  frame_type;           ///< Frame type received
+} can_filter_entry_t;
+
+/** Entries built by the filter compiler. */
+typedef struct st_can_filter_table
+{
+    can_filter_entry_t  entry[CAN_FILTER_ENTRIES_MAX + 1U];   ///< Entries, one more than kept while adding
+    uint32_t            count;                              ///< Number of entries
+    uint32_t            id_mask;                            ///< All ID bits of the ID mode
+    uint32_t            id_bits;                            ///< Number of ID bits of the ID mode
+} can_filter_table_t;
+
+/** Placement of filter entries in the receive mailboxes. */
+typedef struct st_can_filter_layout
+{
+    uint8_t   slot_entry[CAN_MAX_NO_MAILBOXES];             ///< Entry of each mailbox, or CAN_FILTER_SLOT_NONE
+    uint32_t  group_mask[CAN_FILTER_GROUPS];                ///< Mask of each group, or CAN_FILTER_GROUP_NO_MASK
+    uint32_t  mask_invalid;                                 ///< Mailboxes not using their group mask, one bit each
+} can_filter_layout_t;
 
 /***********************************************************************************************************************
  * Private function prototypes
@@ -58,7 +94,18 @@ static ssp_err_t can_open_parameters_check_timing(can_cfg_t const * const p_cfg)
 static ssp_err_t can_open_parameters_check_clock(can_cfg_t const * const p_cfg, bsp_feature_can_t can_feature);
 static ssp_err_t can_write_parameters_check(can_ctrl_t * const p_ctrl, can_frame_t * const p_frame, uint32_t mailbox);
 static ssp_err_t can_module_start(can_instance_ctrl_t * p_internal_ctrl, can_cfg_t const * const p_cfg, bsp_feature_can_t can_feature);
-static void can_mailbox_configure(R_CAN0_Type * p_can_regs, can_cfg_t const * const p_cfg);
+static ssp_err_t can_mailbox_configure(R_CAN0_Type * p_can_regs, can_cfg_t const * const p_cfg);
+static ssp_err_t can_filter_compile(R_CAN0_Type * p_can_regs, can_cfg_t const * const p_cfg);
+static void can_filter_insert(can_filter_table_t * p_table, can_filter_entry_t const * p_new);
+static bool can_filter_merge(can_filter_table_t * p_table);
+static bool can_filter_unify(can_filter_table_t * p_table);
+static bool can_filter_place(can_filter_table_t const * p_table, can_cfg_t const * const p_cfg,
+                             can_filter_layout_t * p_layout);
+static uint32_t can_filter_slot_take(can_filter_layout_t * p_layout, can_cfg_t const * const p_cfg, uint32_t group);
+static bool can_filter_covers(can_filter_entry_t const * p_outer, can_filter_entry_t const * p_inner);
+static uint32_t can_filter_accepted(can_filter_table_t const * p_table, uint32_t care);
+static uint32_t can_fifo_read(can_instance_ctrl_t * p_ctrl, can_rx_frame_t * const p_frames, uint32_t max_frames);
+static uint32_t can_mailbox_read(can_instance_ctrl_t * p_ctrl, can_rx_frame_t * const p_frames, uint32_t max_frames);
 static ssp_err_t can_operate_mode(R_CAN0_Type * p_can_regs);
 static ssp_err_t can_wake_and_init(can_instance_ctrl_t * p_internal_ctrl, can_bit_timing_cfg_t * const p_timing);
 /***********************************************************************************************************************
@@ -68,9 +115,12 @@ static ssp_err_t can_wake_and_init(can_instance_ctrl_t * p_internal_ctrl, can_bi
 static void can_error_interrupt(can_instance_ctrl_t * p_ctrl);
 void can_error_isr(void);
 static void can_receive_interrupt(can_instance_ctrl_t * p_ctrl);
+static void can_receive_fifo_interrupt(can_instance_ctrl_t * p_ctrl);
 void can_mailbox_rx_isr(void);
 static void can_transmit_interrupt(can_instance_ctrl_t * p_ctrl);
 void can_mailbox_tx_isr(void);
+static void can_callback_call(can_instance_ctrl_t * p_ctrl, can_callback_args_t * p_args);
+static void can_callback_work(void * p_context, void * p_args);
 
 /***********************************************************************************************************************
  * Private global variables
@@ -113,7 +163,8 @@ const can_api_t g_can_on_can =
     .write      = R_CAN_Write,
     .control    = R_CAN_Control,
     .infoGet    = R_CAN_InfoGet,
-    .versionGet = R_CAN_VersionGet
+    .versionGet = R_CAN_VersionGet,
+    .readBatch  = R_CAN_ReadBatch
 };
 
 /*******************************************************************************************************************//**
@@ -304,6 +355,57 @@ ssp_err_t R_CAN_Read (can_ctrl_t * const p_ctrl, uint32_t mailbox, can_frame_t *
     return SSP_SUCCESS;
 } /* End of function R_CAN_Read() */
 
+/***************************************************************************************************************//**
+ * @brief  Read all received frames up to max_frames, with the mailbox and time stamp of each frame.
+ *         Implements can_api_t::readBatch()
+ *
+ * If a receive FIFO is configured, the frames are taken from the FIFO in the order they were received.  Otherwise
+ * every receive mailbox with new data is read, lowest mailbox first.
+ *
+ * @retval SSP_SUCCESS                      At least one frame was read.
+ * @retval SSP_ERR_NOT_OPEN                 Control block not open.
+ * @retval SSP_ERR_CAN_DATA_UNAVAILABLE     No data available.
+ * @retval SSP_ERR_ASSERTION                Null pointer presented.
+ *
+ * @note When a receive FIFO is configured, do not call this function from an interrupt with a higher priority than
+ *       the receive interrupt of the channel.
+ *****************************************************************************************************************/
+ssp_err_t R_CAN_ReadBatch (can_ctrl_t     * const p_ctrl,
+                           can_rx_frame_t * const p_frames,
+                           uint32_t         const max_frames,
+                           uint32_t       * const p_count)
+{
+    can_instance_ctrl_t * p_internal_ctrl = (can_instance_ctrl_t *) p_ctrl;
+    uint32_t count = 0U;
+
+#if    (CAN_CFG_PARAM_CHECKING_ENABLE)
+    /** Check pointers for NULL values */
+    SSP_ASSERT(p_ctrl);
+    SSP_ASSERT(p_frames);
+    SSP_ASSERT(p_count);
+
+    /** If channel is not open, return an error */
+    CAN_ERROR_RETURN(p_internal_ctrl->open == CAN_OPEN, SSP_ERR_NOT_OPEN);
+#endif /* if    (CAN_CFG_PARAM_CHECKING_ENABLE) */
+
+    /** Read from the receive FIFO if there is one, otherwise from the mailboxes. */
+    if (NULL != p_internal_ctrl->p_rx_fifo)
+    {
+        count = can_fifo_read(p_internal_ctrl, p_frames, max_frames);
+    }
+    else
+    {
+        count = can_mailbox_read(p_internal_ctrl, p_frames, max_frames);
+    }
+
+    *p_count = count;
+
+    /** Check for receive data */
+    CAN_ERROR_RETURN(0U != count, SSP_ERR_CAN_DATA_UNAVAILABLE);
+
+    return SSP_SUCCESS;
+} /* End of function R_CAN_ReadBatch() */
+
 /***************************************************************************************************************//**
  * @brief  Write data to the CAN channel. Write up to eight bytes to the channel mailbox.
  *         Implements can_api_t::write()
@@ -492,7 +594,7 @@ static void can_error_interrupt (can_instance_ctrl_t * p_ctrl)
         args.channel = p_ctrl->channel;                 ///< Populate callback arguments accordingly.
         args.p_context = p_ctrl->p_context;
         args.mailbox = mailbox;
-        p_ctrl->p_callback(&args);                      ///< Call the user callback function.
+        can_callback_call(p_ctrl, &args);               ///< Call the user callback function.
     }
 }
 
@@ -533,8 +635,13 @@ void can_error_isr (void)
  **********************************************************************************************************************/
 static void can_receive_interrupt (can_instance_ctrl_t * p_ctrl)
 {
+    /** Move the frames to the receive FIFO if there is one. */
+    if (NULL != p_ctrl->p_rx_fifo)
+    {
+        can_receive_fifo_interrupt(p_ctrl);
+    }
     /** Get user the callback, if set in the open function. */
-    if (NULL != p_ctrl->p_callback)
+    else if (NULL != p_ctrl->p_callback)
     {
         can_callback_args_t args;
         uint32_t mailbox = 0U;
@@ -547,7 +654,77 @@ static void can_receive_interrupt (can_instance_ctrl_t * p_ctrl)
 
         args.channel = p_ctrl->channel;                 ///< Populate callback arguments accordingly.
         args.p_context = p_ctrl->p_context;
-        p_ctrl->p_callback(&args);                      ///< Call the user callback function.
+        can_callback_call(p_ctrl, &args);               ///< Call the user callback function.
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @brief      CAN Receive FIFO ISR processing.
+ *
+ * Copies the frame and time stamp of every receive mailbox with new data into the receive FIFO, then calls the
+ * callback once with CAN_EVENT_RX_FIFO_READY, and once more with CAN_EVENT_RX_FIFO_OVERFLOW if the FIFO was full.
+ * Each mailbox is read at most once, a frame arriving after that raises another interrupt.
+ *
+ * @param[in]  p_ctrl    Pointer to CAN instance control block
+ *
+ **********************************************************************************************************************/
+static void can_receive_fifo_interrupt (can_instance_ctrl_t * p_ctrl)
+{
+    R_CAN0_Type * p_can_regs = (R_CAN0_Type *) p_ctrl->p_reg;
+    uint32_t head = p_ctrl->rx_fifo_head;
+    uint32_t first = head;
+    uint32_t mailbox = 0U;
+    bool overflow = false;
+    uint32_t i;
+
+    for (i = 0U; (i < p_ctrl->mailbox_count) && HW_CAN_NewDataStatusFlag(p_can_regs); i++)
+    {
+        HW_CAN_ReceiveMailboxGet(p_can_regs, &mailbox);
+
+        /** Stop at a mailbox being written. Its reception raises another interrupt. */
+        if (!HW_CAN_ReceiveDataAvailable(p_can_regs, mailbox))
+        {
+            break;
+        }
+
+        if ((head - p_ctrl->rx_fifo_tail) < p_ctrl->rx_fifo_size)
+        {
+            can_rx_frame_t * p_slot = &p_ctrl->p_rx_fifo[head & (p_ctrl->rx_fifo_size - 1U)];
+            p_slot->mailbox   = mailbox;
+            p_slot->timestamp = HW_CAN_ReceiveTimeStampGet(p_can_regs, mailbox);
+            HW_CAN_ReceiveDataGet(p_can_regs, mailbox, p_ctrl->id_mode, &p_slot->frame);
+            head++;
+        }
+        else
+        {
+            /** The FIFO is full. Discard the frame so the mailbox can receive again. */
+            HW_CAN_ClearNewData(p_can_regs, mailbox);
+            p_ctrl->rx_fifo_overflow_count++;
+            overflow = true;
+        }
+    }
+
+    /** Publish the frames to R_CAN_ReadBatch. */
+    p_ctrl->rx_fifo_head = head;
+
+    if (NULL != p_ctrl->p_callback)
+    {
+        can_callback_args_t args;
+        args.channel = p_ctrl->channel;                 ///< Populate callback arguments accordingly.
+        args.p_context = p_ctrl->p_context;
+        args.mailbox = mailbox;
+
+        if (head != first)
+        {
+            args.event = CAN_EVENT_RX_FIFO_READY;
+            can_callback_call(p_ctrl, &args);           ///< Call the user callback function.
+        }
+
+        if (overflow)
+        {
+            args.event = CAN_EVENT_RX_FIFO_OVERFLOW;
+            can_callback_call(p_ctrl, &args);           ///< Call the user callback function.
+        }
     }
 }
 
@@ -610,7 +787,7 @@ static void can_transmit_interrupt (can_instance_ctrl_t * p_ctrl)
         args.event = CAN_EVENT_TX_COMPLETE;
         args.channel = p_ctrl->channel;                 ///< Populate callback arguments accordingly.
         args.p_context = p_ctrl->p_context;
-        p_ctrl->p_callback(&args);                      ///< Call the user callback function.
+        can_callback_call(p_ctrl, &args);               ///< Call the user callback function.
     }
 }
 
@@ -718,6 +895,27 @@ static ssp_err_t can_open_parameters_check (can_instance_ctrl_t * const p_intern
         CAN_ERROR_RETURN(extended_cfg->p_mailbox_mask[i] <= CAN_DEFAULT_MASK, SSP_ERR_CAN_INIT_FAILED);
     }
 
+    /** The receive FIFO size must be a power of two. */
+    if (NULL != extended_cfg->p_rx_fifo)
+    {
+        CAN_ERROR_RETURN(0U != extended_cfg->rx_fifo_size, SSP_ERR_INVALID_ARGUMENT);
+        CAN_ERROR_RETURN(0U == (extended_cfg->rx_fifo_size & (extended_cfg->rx_fifo_size - 1U)),
+                SSP_ERR_INVALID_ARGUMENT);
+    }
+
+    /** Filter ranges must be in order and within the IDs of the ID mode. */
+    if (0U != extended_cfg->filter_count)
+    {
+        SSP_ASSERT(extended_cfg->p_filter);
+        uint32_t id_max = (CAN_ID_MODE_STANDARD == p_cfg->id_mode) ? CAN_SID_MASK : CAN_XID_MASK;
+        for (i = 0U; i < extended_cfg->filter_count; i++)
+        {
+            CAN_ERROR_RETURN(extended_cfg->p_filter[i].id_first <= extended_cfg->p_filter[i].id_last,
+                    SSP_ERR_INVALID_ARGUMENT);
+            CAN_ERROR_RETURN(extended_cfg->p_filter[i].id_last <= id_max, SSP_ERR_INVALID_ARGUMENT);
+        }
+    }
+
     return SSP_SUCCESS;
 }
 
@@ -861,10 +1059,17 @@ static ssp_err_t can_module_start(can_instance_ctrl_t * p_internal_ctrl, can_cfg
     p_internal_ctrl->channel = p_cfg->channel;
     p_internal_ctrl->p_callback = p_cfg->p_callback;
     p_internal_ctrl->p_context = p_cfg->p_context;
+    p_internal_ctrl->deferred_callback = p_cfg->deferred_callback;
+    p_internal_ctrl->deferred_callback_priority = p_cfg->deferred_callback_priority;
     p_internal_ctrl->id_mode = p_cfg->id_mode;
     p_internal_ctrl->mailbox_count = p_cfg->mailbox_count;
     p_internal_ctrl->message_mode = p_cfg->message_mode;
     p_internal_ctrl->operation_mode = CAN_MODE_NORMAL;
+    p_internal_ctrl->p_rx_fifo = extended_cfg->p_rx_fifo;
+    p_internal_ctrl->rx_fifo_size = extended_cfg->rx_fifo_size;
+    p_internal_ctrl->rx_fifo_head = 0U;
+    p_internal_ctrl->rx_fifo_tail = 0U;
+    p_internal_ctrl->rx_fifo_overflow_count = 0U;
 
     /** Check if only CANMCLK is supported */
     if (can_feature.mclock_only)
@@ -883,7 +1088,8 @@ static ssp_err_t can_module_start(can_instance_ctrl_t * p_internal_ctrl, can_cfg
     CAN_ERROR_RETURN(SSP_SUCCESS == err, err);
 
     /** Configure mailboxes. */
-    can_mailbox_configure(p_internal_ctrl->p_reg, p_cfg);
+    err = can_mailbox_configure(p_internal_ctrl->p_reg, p_cfg);
+    CAN_ERROR_RETURN(SSP_SUCCESS == err, err);
 
     /** Go to normal operation. */
     err = can_operate_mode(p_internal_ctrl->p_reg);
@@ -1046,8 +1252,10 @@ static ssp_err_t can_wake_and_init (can_instance_ctrl_t * p_internal_ctrl, can_b
  * @brief Configure CAN mailboxes
  * @param[in] p_can_regs    CAN registers
  * @param[in] p_cfg         CAN configuration
+ * @return  SSP_SUCCESS             Mailboxes configured
+ * @return  SSP_ERR_CAN_INIT_FAILED The filters need a receive mailbox of each frame type they list
  **********************************************************************************************************************/
-static void can_mailbox_configure (R_CAN0_Type * p_can_regs, can_cfg_t const * const p_cfg)
+static ssp_err_t can_mailbox_configure (R_CAN0_Type * p_can_regs, can_cfg_t const * const p_cfg)
 {
     can_extended_cfg_t const * const extended_cfg = (can_extended_cfg_t *) p_cfg->p_extend;
 
@@ -1060,6 +1268,596 @@ static void can_mailbox_configure (R_CAN0_Type * p_can_regs, can_cfg_t const * c
     /** Set the IDs for each mailbox. */
     HW_CAN_MailboxIdSet(p_can_regs, p_cfg->mailbox_count, p_cfg->p_mailbox, p_cfg->id_mode);
 
+    /** Set the receive mailboxes from the filter list if there is one. */
+    if (0U != extended_cfg->filter_count)
+    {
+        return can_filter_compile(p_can_regs, p_cfg);
+    }
+
     /** Set the masks for each mailbox group and initialize the mask invalid register. */
     HW_CAN_MailboxMaskSet(p_can_regs, p_cfg->mailbox_count, extended_cfg->p_mailbox_mask, p_cfg->id_mode);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Compile the filter list into receive mailbox IDs and group masks, and write them to the mailboxes.
+ *
+ * Each range is split into aligned power of two blocks, which a mailbox receives with a mask that ignores the low
+ * ID bits.  While the entries do not fit the receive mailboxes, the two entries whose merge accepts the fewest
+ * additional IDs are merged.  Entries that compare every ID bit fit any receive mailbox with its mask disabled.
+ * Entries that ignore some bits need a group whose mask ignores the same bits, and there is one mask per group of 4
+ * mailboxes.
+ *
+ * @param[in] p_can_regs    CAN registers
+ * @param[in] p_cfg         CAN configuration
+ * @return  SSP_SUCCESS             Receive mailboxes configured
+ * @return  SSP_ERR_CAN_INIT_FAILED The filters need a receive mailbox of each frame type they list
+ **********************************************************************************************************************/
+static ssp_err_t can_filter_compile (R_CAN0_Type * p_can_regs, can_cfg_t const * const p_cfg)
+{
+    can_extended_cfg_t const * const extended_cfg = (can_extended_cfg_t *) p_cfg->p_extend;
+    can_filter_table_t table;
+    can_filter_layout_t layout;
+    can_filter_entry_t block;
+    uint32_t i;
+
+    table.count = 0U;
+    if (CAN_ID_MODE_STANDARD == p_cfg->id_mode)
+    {
+        table.id_mask = CAN_SID_MASK;
+        table.id_bits = CAN_SID_BITS;
+    }
+    else
+    {
+        table.id_mask = CAN_XID_MASK;
+        table.id_bits = CAN_XID_BITS;
+    }
+
+    /** Split each range into the largest aligned blocks it contains. */
+    for (i = 0U; i < extended_cfg->filter_count; i++)
+    {
+        can_filter_t const * p_filter = &extended_cfg->p_filter[i];
+        uint32_t id = p_filter->id_first;
+        while (id <= p_filter->id_last)
+        {
+            uint32_t size = 1U;
+            while ((0U == (id & ((size << 1) - 1U))) && (((id + (size << 1)) - 1U) <= p_filter->id_last))
+            {
+                size <<= 1;
+            }
+
+            block.id = id;
+            block.care = table.id_mask & ~(size - 1U);
+            block.frame_type = p_filter->frame_type;
+            can_filter_insert(&table, &block);
+
+            /** Keep one entry per mailbox at most. A spare slot always holds two entries of the same frame type. */
+            if (table.count > CAN_FILTER_ENTRIES_MAX)
+            {
+                (void) can_filter_merge(&table);
+            }
+
+            id += size;
+        }
+    }
+
+    /** Count the receive mailboxes. */
+    uint32_t rx_mailboxes = 0U;
+    for (i = 0U; i < p_cfg->mailbox_count; i++)
+    {
+        if (CAN_MAILBOX_RECEIVE == p_cfg->p_mailbox[i].mailbox_type)
+        {
+            rx_mailboxes++;
+        }
+    }
+
+    /** Merge entries while there are more entries than receive mailboxes. If the entries fit but their masks do not
+     * fit the groups, have two sets of entries share a mask instead. */
+    while (!can_filter_place(&table, p_cfg, &layout))
+    {
+        bool merged = false;
+        if (table.count <= rx_mailboxes)
+        {
+            merged = can_filter_unify(&table);
+        }
+        if (!merged)
+        {
+            merged = can_filter_merge(&table);
+        }
+        CAN_ERROR_RETURN(merged, SSP_ERR_CAN_INIT_FAILED);
+    }
+
+    /** Write the entries. Receive mailboxes without an entry do not receive. */
+    for (i = 0U; i < p_cfg->mailbox_count; i++)
+    {
+        if (CAN_MAILBOX_RECEIVE == p_cfg->p_mailbox[i].mailbox_type)
+        {
+            if (CAN_FILTER_SLOT_NONE == layout.slot_entry[i])
+            {
+                HW_CAN_MailboxDisable(p_can_regs, i);
+            }
+            else
+            {
+                can_filter_entry_t const * p_entry = &table.entry[layout.slot_entry[i]];
+                HW_CAN_ReceiveMailboxSet(p_can_regs, i, p_entry->id, p_entry->frame_type, p_cfg->id_mode);
+            }
+        }
+    }
+
+    for (i = 0U; i < CAN_FILTER_GROUPS; i++)
+    {
+        if (CAN_FILTER_GROUP_NO_MASK != layout.group_mask[i])
+        {
+            HW_CAN_GroupMaskSet(p_can_regs, i, layout.group_mask[i], p_cfg->id_mode);
+        }
+    }
+
+    HW_CAN_MaskInvalidSet(p_can_regs, layout.mask_invalid);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Add an entry to the filter table unless an entry already receives all of its IDs.  Entries whose IDs are
+ *        all received by the new entry are removed.
+ * @param[in,out] p_table   Filter table
+ * @param[in]     p_new     Entry to add
+ **********************************************************************************************************************/
+static void can_filter_insert (can_filter_table_t * p_table, can_filter_entry_t const * p_new)
+{
+    uint32_t i = 0U;
+
+    while (i < p_table->count)
+    {
+        if (can_filter_covers(&p_table->entry[i], p_new))
+        {
+            return;
+        }
+
+        if (can_filter_covers(p_new, &p_table->entry[i]))
+        {
+            p_table->count--;
+            p_table->entry[i] = p_table->entry[p_table->count];
+        }
+        else
+        {
+            i++;
+        }
+    }
+
+    p_table->entry[p_table->count] = *p_new;
+    p_table->count++;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Merge the two entries of the same frame type whose merge accepts the fewest IDs not accepted before.
+ * @param[in,out] p_table   Filter table
+ * @retval  true    Two entries were merged
+ * @retval  false   No two entries have the same frame type
+ **********************************************************************************************************************/
+static bool can_filter_merge (can_filter_table_t * p_table)
+{
+    uint32_t best_i = 0U;
+    uint32_t best_j = 0U;
+    int64_t best_cost = INT64_MAX;
+    can_filter_entry_t merged;
+    uint32_t i;
+    uint32_t j;
+
+    for (i = 0U; i < p_table->count; i++)
+    {
+        for (j = i + 1U; j < p_table->count; j++)
+        {
+            can_filter_entry_t const * p_a = &p_table->entry[i];
+            can_filter_entry_t const * p_b = &p_table->entry[j];
+            if (p_a->frame_type == p_b->frame_type)
+            {
+                /** The merged entry compares only the bits both entries compare and agree on. */
+                uint32_t care = (p_a->care & p_b->care) & ~(p_a->id ^ p_b->id);
+                int64_t cost = ((int64_t) can_filter_accepted(p_table, care) -
+                                (int64_t) can_filter_accepted(p_table, p_a->care)) -
+                               (int64_t) can_filter_accepted(p_table, p_b->care);
+                if (cost < best_cost)
+                {
+                    best_cost = cost;
+                    best_i = i;
+                    best_j = j;
+                }
+            }
+        }
+    }
+
+    if (INT64_MAX == best_cost)
+    {
+        return false;
+    }
+
+    merged.care = (p_table->entry[best_i].care & p_table->entry[best_j].care) &
+                  ~(p_table->entry[best_i].id ^ p_table->entry[best_j].id);
+    merged.id = p_table->entry[best_i].id & merged.care;
+    merged.frame_type = p_table->entry[best_i].frame_type;
+
+    /** Remove both entries, the higher index first, then add the merged entry. */
+    p_table->count--;
+    p_table->entry[best_j] = p_table->entry[p_table->count];
+    p_table->count--;
+    p_table->entry[best_i] = p_table->entry[p_table->count];
+    can_filter_insert(p_table, &merged);
+
+    return true;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Give the two sets of entries sharing a mask whose union accepts the fewest IDs not accepted before the mask
+ *        the two sets have in common.
+ * @param[in,out] p_table   Filter table
+ * @retval  true    Two sets now share a mask
+ * @retval  false   There are fewer than two sets
+ **********************************************************************************************************************/
+static bool can_filter_unify (can_filter_table_t * p_table)
+{
+    uint32_t best_a = 0U;
+    uint32_t best_b = 0U;
+    int64_t best_cost = INT64_MAX;
+    uint32_t i;
+    uint32_t j;
+    uint32_t k;
+
+    for (i = 0U; i < p_table->count; i++)
+    {
+        uint32_t care_a = p_table->entry[i].care;
+        for (j = i + 1U; (j < p_table->count) && (p_table->id_mask != care_a); j++)
+        {
+            uint32_t care_b = p_table->entry[j].care;
+            if ((p_table->id_mask != care_b) && (care_a != care_b))
+            {
+                uint32_t care = care_a & care_b;
+                int64_t cost = 0;
+                for (k = 0U; k < p_table->count; k++)
+                {
+                    if ((care_a == p_table->entry[k].care) || (care_b == p_table->entry[k].care))
+                    {
+                        cost += (int64_t) can_filter_accepted(p_table, care) -
+                                (int64_t) can_filter_accepted(p_table, p_table->entry[k].care);
+                    }
+                }
+
+                if (cost < best_cost)
+                {
+                    best_cost = cost;
+                    best_a = care_a;
+                    best_b = care_b;
+                }
+            }
+        }
+    }
+
+    if (INT64_MAX == best_cost)
+    {
+        return false;
+    }
+
+    for (k = 0U; k < p_table->count; k++)
+    {
+        if ((best_a == p_table->entry[k].care) || (best_b == p_table->entry[k].care))
+        {
+            p_table->entry[k].care = best_a & best_b;
+            p_table->entry[k].id &= best_a & best_b;
+        }
+    }
+
+    /** Remove the entries that now receive only IDs of another entry. */
+    i = 0U;
+    while (i < p_table->count)
+    {
+        for (j = 0U; j < p_table->count; j++)
+        {
+            if ((j != i) && can_filter_covers(&p_table->entry[j], &p_table->entry[i]))
+            {
+                break;
+            }
+        }
+
+        if (j < p_table->count)
+        {
+            p_table->count--;
+            p_table->entry[i] = p_table->entry[p_table->count];
+        }
+        else
+        {
+            i++;
+        }
+    }
+
+    return true;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Place the filter entries in the receive mailboxes.
+ *
+ * Entries sharing a mask are placed first, largest set first, each set taking the free groups with the most receive
+ * mailboxes.  Entries comparing every ID bit then take any free receive mailbox with its mask disabled.
+ *
+ * @param[in]  p_table      Filter table
+ * @param[in]  p_cfg        CAN configuration
+ * @param[out] p_layout     Mailbox of each entry and mask of each group
+ * @retval  true    All entries were placed
+ * @retval  false   The entries do not fit the receive mailboxes
+ **********************************************************************************************************************/
+static bool can_filter_place (can_filter_table_t const * p_table, can_cfg_t const * const p_cfg,
+                              can_filter_layout_t * p_layout)
+{
+    uint32_t placed = 0U;
+    uint32_t i;
+    uint32_t j;
+
+    memset(p_layout->slot_entry, (int) CAN_FILTER_SLOT_NONE, sizeof(p_layout->slot_entry));
+    for (i = 0U; i < CAN_FILTER_GROUPS; i++)
+    {
+        p_layout->group_mask[i] = CAN_FILTER_GROUP_NO_MASK;
+    }
+    p_layout->mask_invalid = CAN_INVALID_MASK;
+
+    if (p_table->count > CAN_FILTER_ENTRIES_MAX)
+    {
+        return false;
+    }
+
+    for (;;)
+    {
+        /** Find the largest set of unplaced entries sharing a mask. */
+        uint32_t care = 0U;
+        uint32_t best = 0U;
+        for (i = 0U; i < p_table->count; i++)
+        {
+            if ((0U == (placed & (1U << i))) && (p_table->id_mask != p_table->entry[i].care))
+            {
+                uint32_t size = 0U;
+                for (j = i; j < p_table->count; j++)
+                {
+                    if ((0U == (placed & (1U << j))) && (p_table->entry[i].care == p_table->entry[j].care))
+                    {
+                        size++;
+                    }
+                }
+
+                if (size > best)
+                {
+                    best = size;
+                    care = p_table->entry[i].care;
+                }
+            }
+        }
+
+        if (0U == best)
+        {
+            break;
+        }
+
+        /** Fill the unused group with the most free mailboxes, then the next one, until the set is placed. */
+        uint32_t group = CAN_FILTER_GROUPS;
+        for (i = 0U; i < p_table->count; i++)
+        {
+            if ((0U == (placed & (1U << i))) && (care == p_table->entry[i].care))
+            {
+                uint32_t slot = (CAN_FILTER_GROUPS == group) ? CAN_MAX_NO_MAILBOXES :
+                                can_filter_slot_take(p_layout, p_cfg, group);
+                if (CAN_MAX_NO_MAILBOXES == slot)
+                {
+                    uint32_t most = 0U;
+                    group = CAN_FILTER_GROUPS;
+                    for (j = 0U; j < (p_cfg->mailbox_count / CAN_MAILBOX_GROUP_SIZE); j++)
+                    {
+                        if (CAN_FILTER_GROUP_NO_MASK == p_layout->group_mask[j])
+                        {
+                            uint32_t free_slots = 0U;
+                            uint32_t k;
+                            for (k = j * CAN_MAILBOX_GROUP_SIZE; k < ((j + 1U) * CAN_MAILBOX_GROUP_SIZE); k++)
+                            {
+                                if ((CAN_MAILBOX_RECEIVE == p_cfg->p_mailbox[k].mailbox_type) &&
+                                    (CAN_FILTER_SLOT_NONE == p_layout->slot_entry[k]))
+                                {
+                                    free_slots++;
+                                }
+                            }
+
+                            if (free_slots > most)
+                            {
+                                most = free_slots;
+                                group = j;
+                            }
+                        }
+                    }
+
+                    if (CAN_FILTER_GROUPS == group)
+                    {
+                        return false;
+                    }
+
+                    p_layout->group_mask[group] = care;
+                    slot = can_filter_slot_take(p_layout, p_cfg, group);
+                }
+
+                p_layout->slot_entry[slot] = (uint8_t) i;
+                p_layout->mask_invalid &= ~(1U << slot);
+                placed |= (1U << i);
+            }
+        }
+    }
+
+    /** Place the entries comparing every ID bit in any free mailbox. */
+    for (i = 0U; i < p_table->count; i++)
+    {
+        if (0U == (placed & (1U << i)))
+        {
+            for (j = 0U; j < p_cfg->mailbox_count; j++)
+            {
+                if ((CAN_MAILBOX_RECEIVE == p_cfg->p_mailbox[j].mailbox_type) &&
+                    (CAN_FILTER_SLOT_NONE == p_layout->slot_entry[j]))
+                {
+                    break;
+                }
+            }
+
+            if (j == p_cfg->mailbox_count)
+            {
+                return false;
+            }
+
+            p_layout->slot_entry[j] = (uint8_t) i;
+        }
+    }
+
+    return true;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Take the first free receive mailbox of a group whose mask is set.
+ * @param[in,out] p_layout  Filter layout
+ * @param[in]     p_cfg     CAN configuration
+ * @param[in]     group     Mailbox group
+ * @return  Mailbox number, or CAN_MAX_NO_MAILBOXES if the group has no free receive mailbox.
+ **********************************************************************************************************************/
+static uint32_t can_filter_slot_take (can_filter_layout_t * p_layout, can_cfg_t const * const p_cfg, uint32_t group)
+{
+    uint32_t slot;
+
+    for (slot = group * CAN_MAILBOX_GROUP_SIZE; slot < ((group + 1U) * CAN_MAILBOX_GROUP_SIZE); slot++)
+    {
+        if ((CAN_MAILBOX_RECEIVE == p_cfg->p_mailbox[slot].mailbox_type) &&
+            (CAN_FILTER_SLOT_NONE == p_layout->slot_entry[slot]))
+        {
+            return slot;
+        }
+    }
+
+    return CAN_MAX_NO_MAILBOXES;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Check whether one filter entry receives every ID another entry receives.
+ * @param[in] p_outer   Entry that may receive more IDs
+ * @param[in] p_inner   Entry that may receive fewer IDs
+ * @retval  true    p_outer receives all IDs of p_inner
+ **********************************************************************************************************************/
+static bool can_filter_covers (can_filter_entry_t const * p_outer, can_filter_entry_t const * p_inner)
+{
+    return (p_outer->frame_type == p_inner->frame_type) &&
+           (0U == (p_outer->care & ~p_inner->care)) &&
+           (0U == ((p_outer->id ^ p_inner->id) & p_outer->care));
+}
+
+/*******************************************************************************************************************//**
+ * @brief Count the IDs received by an entry that compares the ID bits in care.
+ * @param[in] p_table   Filter table, for the ID width
+ * @param[in] care      ID bits compared
+ * @return  Number of IDs received.
+ **********************************************************************************************************************/
+static uint32_t can_filter_accepted (can_filter_table_t const * p_table, uint32_t care)
+{
+    /** Count the compared bits. */
+    uint32_t bits = care & p_table->id_mask;
+    bits = bits - ((bits >> 1) & 0x55555555U);
+    bits = (bits & 0x33333333U) + ((bits >> 2) & 0x33333333U);
+    bits = (((bits + (bits >> 4)) & 0x0F0F0F0FU) * 0x01010101U) >> 24;
+
+    return 1U << (p_table->id_bits - bits);
+}
+
+/*******************************************************************************************************************//**
+ * @brief Copy frames out of the receive FIFO.
+ * @param[in]  p_ctrl       CAN instance control block
+ * @param[out] p_frames     Destination array
+ * @param[in]  max_frames   Maximum number of frames to copy
+ * @return  Number of frames copied.
+ **********************************************************************************************************************/
+static uint32_t can_fifo_read (can_instance_ctrl_t * p_ctrl, can_rx_frame_t * const p_frames, uint32_t max_frames)
+{
+    uint32_t tail = p_ctrl->rx_fifo_tail;
+    uint32_t available = p_ctrl->rx_fifo_head - tail;
+    uint32_t count = (available < max_frames) ? available : max_frames;
+
+    /** Copy in at most two pieces around the end of the ring. */
+    uint32_t offset = tail & (p_ctrl->rx_fifo_size - 1U);
+    uint32_t first = p_ctrl->rx_fifo_size - offset;
+    if (first > count)
+    {
+        first = count;
+    }
+    memcpy(p_frames, &p_ctrl->p_rx_fifo[offset], first * sizeof(can_rx_frame_t));
+    memcpy(&p_frames[first], &p_ctrl->p_rx_fifo[0], (count - first) * sizeof(can_rx_frame_t));
+
+    /** Release the slots to the receive ISR. */
+    p_ctrl->rx_fifo_tail = tail + count;
+
+    return count;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Read the receive mailboxes with new data, lowest mailbox first.
+ * @param[in]  p_ctrl       CAN instance control block
+ * @param[out] p_frames     Destination array
+ * @param[in]  max_frames   Maximum number of frames to read
+ * @return  Number of frames read.
+ **********************************************************************************************************************/
+static uint32_t can_mailbox_read (can_instance_ctrl_t * p_ctrl, can_rx_frame_t * const p_frames, uint32_t max_frames)
+{
+    R_CAN0_Type * p_can_regs = (R_CAN0_Type *) p_ctrl->p_reg;
+    uint32_t count = 0U;
+    uint32_t mailbox;
+
+    for (mailbox = 0U; (mailbox < p_ctrl->mailbox_count) && (count < max_frames); mailbox++)
+    {
+        if ((CAN_MAILBOX_RECEIVE == HW_CAN_MailboxTypeGet(p_can_regs, mailbox)) &&
+            HW_CAN_ReceiveDataAvailable(p_can_regs, mailbox))
+        {
+            p_frames[count].mailbox = mailbox;
+            p_frames[count].timestamp = HW_CAN_ReceiveTimeStampGet(p_can_regs, mailbox);
+            HW_CAN_ReceiveDataGet(p_can_regs, mailbox, p_ctrl->id_mode, &p_frames[count].frame);
+            count++;
+        }
+    }
+
+    /** Check for other mailboxes in an overrun state. */
+    if ((HW_CAN_MailboxMessageLost(p_can_regs)) && (CAN_MESSAGE_MODE_OVERRUN == p_ctrl->message_mode) &&
+        (SSP_INVALID_VECTOR != p_ctrl->error_irq))
+    {
+        NVIC_SetPendingIRQ(p_ctrl->error_irq);
+    }
+
+    /** Check for mailboxes still holding received messages. */
+    if (HW_CAN_NewDataStatusFlag(p_can_regs) && (SSP_INVALID_VECTOR != p_ctrl->mailbox_rx_irq))
+    {
+        NVIC_SetPendingIRQ(p_ctrl->mailbox_rx_irq);
+    }
+
+    return count;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Call the user callback, or post it to the BSP deferred work scheduler if deferred callbacks are configured.
+ *        If no work slot is free, the deferred callback is dropped and counted by the scheduler.
+ * @param[in] p_ctrl        CAN instance control block
+ * @param[in] p_args        Callback arguments, copied if the callback is deferred
+ **********************************************************************************************************************/
+static void can_callback_call (can_instance_ctrl_t * p_ctrl, can_callback_args_t * p_args)
+{
+    (void) R_BSP_WorkPostOrCall(p_ctrl->deferred_callback, can_callback_work, p_ctrl, p_args,
+                                sizeof(can_callback_args_t), p_ctrl->deferred_callback_priority);
+}
+
+/*******************************************************************************************************************//**
+ * @brief Run the user callback, unless the channel was closed after the callback was posted.
+ * @param[in] p_context     CAN instance control block
+ * @param[in] p_args        Copy of the callback arguments
+ **********************************************************************************************************************/
+static void can_callback_work (void * p_context, void * p_args)
+{
+    can_instance_ctrl_t * p_ctrl = (can_instance_ctrl_t *) p_context;
+
+    if ((CAN_OPEN == p_ctrl->open) && (NULL != p_ctrl->p_callback))
+    {
+        p_ctrl->p_callback((can_callback_args_t *) p_args);
+    }
 }
@@ -64,6 +64,9 @@ ssp_err_t R_CAN_InfoGet(can_ctrl_t * const p_ctrl, can_info_t * const p_info);
 
 ssp_err_t R_CAN_VersionGet(ssp_version_t * const version);
 
+ssp_err_t R_CAN_ReadBatch(can_ctrl_t * const p_ctrl, can_rx_frame_t * const p_frames, uint32_t const max_frames,
+                          uint32_t * const p_count);
+
 /* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
 SSP_FOOTER
 
@@ -172,6 +172,19 @@ __STATIC_INLINE void HW_CRC_32bitInputWrite (R_CRC_Type * p_crc_reg, uint32_t va
     p_crc_reg->CRCDIR = value;
 }
 
+/*******************************************************************************************************************//**
+ * Returns the address of the input register of the CRC Calculator, for use as a transfer destination.
+ * @param  word   true for the 32-bit register used by CRC-32 and CRC-32C, false for the 8-bit register.
+ **********************************************************************************************************************/
+__STATIC_INLINE void * HW_CRC_InputAddrGet (R_CRC_Type * p_crc_reg, bool word)
+{
+    if (word)
+    {
+        return (void *) &p_crc_reg->CRCDIR;
+    }
+    return (void *) &p_crc_reg->CRCDIR_BY;
+}
+
 /*******************************************************************************************************************//**
  * Enable snooping
  **********************************************************************************************************************/
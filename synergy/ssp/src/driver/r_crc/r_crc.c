@@ -41,6 +41,13 @@
 /** "CRC" in ASCII, used to determine if channel is open. */
 #define CRC_OPEN              (0x00435243ULL)
 
+/** Size of a CRCDIR write for CRC-32 and CRC-32C. */
+#define CRC_WORD_BYTES        (4U)
+
+/** Entry of slice-by-8 table slice for the low byte of index. */
+#define CRC_SW_LOOKUP(p_table, slice, index) \
+    ((p_table)[((slice) * CRC_SW_TABLE_ENTRIES) + ((index) & 0xFFU)])
+
 /** Macro for error logger. */
 #ifndef CRC_ERROR_RETURN
 /*LDRA_INSPECTED 77 S This macro does not work when surrounded by parentheses. */
@@ -54,8 +61,24 @@
 /***********************************************************************************************************************
  * Private function prototypes
  **********************************************************************************************************************/
-ssp_err_t calculate_polynomial (crc_ctrl_t * const p_api_ctrl, void * inputBuffer, uint32_t length,
+ssp_err_t calculate_polynomial (crc_ctrl_t * const p_api_ctrl, void const * inputBuffer, uint32_t length,
                                 uint32_t crc_seed, uint32_t * calculatedValue);
+static ssp_err_t crc_calculate (crc_instance_ctrl_t * const p_ctrl, void const * p_input, uint32_t length,
+                                uint32_t crc_seed, uint32_t * const p_result);
+static ssp_err_t crc_transfer_open (crc_instance_ctrl_t * const p_ctrl);
+static ssp_err_t crc_transfer_feed (crc_instance_ctrl_t * const p_ctrl, uint8_t const * p_data, uint32_t count);
+static uint32_t const * crc_sw_table_acquire (crc_polynomial_t polynomial, crc_bit_order_t bit_order);
+static void crc_sw_table_release (uint32_t const * p_table);
+#if CRC_CFG_SW_TABLE_SETS > 0
+static void crc_sw_table_build (crc_sw_table_t * const p_set);
+#endif
+static uint32_t crc_sw_calculate (crc_instance_ctrl_t * const p_ctrl, uint8_t const * p_data, uint32_t length,
+                                  uint32_t crc);
+static uint32_t crc_sw_bitwise (crc_sw_polynomial_t const * p_poly, crc_bit_order_t bit_order, uint32_t crc,
+                                uint8_t data);
+static uint32_t crc_sw_load_le (uint8_t const * p_data);
+static uint32_t crc_sw_load_be (uint8_t const * p_data);
+static uint32_t crc_sw_msb_byte (crc_sw_polynomial_t const * p_poly, uint32_t const * p_t, uint32_t crc, uint8_t data);
 
 /***********************************************************************************************************************
  * Private global variables
@@ -86,6 +109,21 @@ static const ssp_version_t s_crc_version =
 static const char          g_module_name[] = "crc";
 #endif
 
+/** Software engine parameters, indexed by crc_polynomial_t. */
+static const crc_sw_polynomial_t g_crc_sw_polynomials[] =
+{
+    [CRC_POLYNOMIAL_CRC_8]     = { 8U,  0x07UL,       0xE0UL       },
+    [CRC_POLYNOMIAL_CRC_16]    = { 16U, 0x8005UL,     0xA001UL     },
+    [CRC_POLYNOMIAL_CRC_CCITT] = { 16U, 0x1021UL,     0x8408UL     },
+    [CRC_POLYNOMIAL_CRC_32]    = { 32U, 0x04C11DB7UL, 0xEDB88320UL },
+    [CRC_POLYNOMIAL_CRC_32C]   = { 32U, 0x1EDC6F41UL, 0x82F63B78UL },
+};
+
+#if CRC_CFG_SW_TABLE_SETS > 0
+/** Slice-by-8 table sets shared by the open instances. */
+static crc_sw_table_t g_crc_sw_tables[CRC_CFG_SW_TABLE_SETS];
+#endif
+
 /** Filled in Interface API structure for this Instance. */
 /*LDRA_INSPECTED 27 D This structure must be accessible in user code. It cannot be static. */
 const crc_api_t g_crc_on_crc = 
@@ -97,7 +135,8 @@ const crc_api_t g_crc_on_crc =
     .snoopDisable   = R_CRC_SnoopDisable,
     .snoopCfg       = R_CRC_SnoopCfg,
     .calculate      = R_CRC_Calculate,
-    .versionGet     = R_CRC_VersionGet
+    .versionGet     = R_CRC_VersionGet,
+    .update         = R_CRC_Update
 };
 
 /** @addtogroup CRC
@@ -114,13 +153,18 @@ const crc_api_t g_crc_on_crc =
  *  Implements crc_api_t::open
  *
  * Open the CRC driver module and initialize the driver control block according to the passed-in
- * configuration structure.
+ * configuration structure. The optional crc_on_crc_cfg_t extension selects the engine and the DMAC used to feed the
+ * CRC calculator. The slice-by-8 tables for the software engine are built at open, or shared with another open
+ * instance that uses the same polynomial and bit order.
  *
  * @retval SSP_SUCCESS             Configuration was successful.
- * @retval SSP_ERR_ASSERTION       p_ctrl or p_cfg is NULL.
+ * @retval SSP_ERR_ASSERTION       p_ctrl or p_cfg is NULL, or the polynomial is invalid.
+ * @retval SSP_ERR_OUT_OF_MEMORY   CRC_ENGINE_SOFTWARE is selected and all CRC_CFG_SW_TABLE_SETS table sets are in
+ *                                 use by other polynomials or bit orders.
  * @return                         See @ref Common_Error_Codes or functions called by this function for other possible
  *                                 return codes. This function calls:
  *                                   * fmi_api_t::productFeatureGet
+ *                                   * transfer_api_t::open
  **********************************************************************************************************************/
 ssp_err_t R_CRC_Open (crc_ctrl_t * const p_api_ctrl, crc_cfg_t const * const p_cfg)
 {
@@ -129,6 +173,7 @@ ssp_err_t R_CRC_Open (crc_ctrl_t * const p_api_ctrl, crc_cfg_t const * const p_c
 #if CRC_CFG_PARAM_CHECKING_ENABLE
     SSP_ASSERT(p_ctrl);
     SSP_ASSERT(p_cfg);
+    SSP_ASSERT((CRC_POLYNOMIAL_CRC_8 <= p_cfg->polynomial) && (CRC_POLYNOMIAL_CRC_32C >= p_cfg->polynomial));
 #endif
 
     ssp_feature_t ssp_feature = {{(ssp_ip_t) 0U}};
@@ -146,6 +191,43 @@ ssp_err_t R_CRC_Open (crc_ctrl_t * const p_api_ctrl, crc_cfg_t const * const p_c
     p_ctrl->polynomial = p_cfg->polynomial;
     p_ctrl->fifo_mode  = p_cfg->fifo_mode;
 
+    /** Apply the engine selection from the extension, or the defaults if there is none */
+    crc_on_crc_cfg_t const * p_extend = (crc_on_crc_cfg_t const *) p_cfg->p_extend;
+    p_ctrl->engine        = CRC_ENGINE_AUTO;
+    p_ctrl->hw_threshold  = CRC_CFG_HW_THRESHOLD_BYTES;
+    p_ctrl->dma_threshold = CRC_CFG_DMA_THRESHOLD_BYTES;
+    p_ctrl->p_transfer    = NULL;
+    if (NULL != p_extend)
+    {
+        p_ctrl->engine     = p_extend->engine;
+        p_ctrl->p_transfer = p_extend->p_transfer;
+        if (0U != p_extend->hw_threshold_bytes)
+        {
+            p_ctrl->hw_threshold = p_extend->hw_threshold_bytes;
+        }
+        if (0U != p_extend->dma_threshold_bytes)
+        {
+            p_ctrl->dma_threshold = p_extend->dma_threshold_bytes;
+        }
+    }
+    p_ctrl->result       = 0U;
+    p_ctrl->result_valid = false;
+
+    /** Build or share the software engine tables */
+    p_ctrl->p_table = crc_sw_table_acquire(p_ctrl->polynomial, p_ctrl->bit_order);
+    CRC_ERROR_RETURN((NULL != p_ctrl->p_table) || (CRC_ENGINE_SOFTWARE != p_ctrl->engine), SSP_ERR_OUT_OF_MEMORY);
+
+    /** Open the DMAC that feeds the CRC calculator, if one is used */
+    if (NULL != p_ctrl->p_transfer)
+    {
+        err = crc_transfer_open(p_ctrl);
+        if (SSP_SUCCESS != err)
+        {
+            crc_sw_table_release(p_ctrl->p_table);
+        }
+        CRC_ERROR_RETURN(SSP_SUCCESS == err, err);
+    }
+
     /** Mark driver as initialized by setting the open value to the ASCII equivalent of "CRC" */
     p_ctrl->open = CRC_OPEN;
 
@@ -182,6 +264,14 @@ ssp_err_t R_CRC_Close (crc_ctrl_t * const p_api_ctrl)
 
     SSP_PARAMETER_NOT_USED(ssp_feature);
 
+    /** Close the DMAC and release the software engine tables */
+    if (NULL != p_ctrl->p_transfer)
+    {
+        p_ctrl->p_transfer->p_api->close(p_ctrl->p_transfer->p_ctrl);
+    }
+    crc_sw_table_release(p_ctrl->p_table);
+    p_ctrl->p_table = NULL;
+
     /** Mark driver as closed */
     p_ctrl->open  =  0U;
 
@@ -193,7 +283,8 @@ ssp_err_t R_CRC_Close (crc_ctrl_t * const p_api_ctrl)
  *
  *  Implements crc_api_t::crcResultGet
  *
- * CRC calculation operates on a running value. This function returns the current calculated value.
+ * CRC calculation operates on a running value. This function returns the current calculated value: the result of
+ * the last calculate or update call, or the CRC Data Output Register once snooping has been enabled.
  *
  * @retval SSP_SUCCESS             Return of calculated value successful.
  * @retval SSP_ERR_ASSERTION       Either p_ctrl or calculatedValue is NULL.
@@ -210,6 +301,13 @@ ssp_err_t R_CRC_CalculatedValueGet (crc_ctrl_t * const p_api_ctrl, uint32_t * ca
     CRC_ERROR_RETURN(CRC_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
 #endif
 
+    /** The software engine and partial words are not visible in the CRC calculator, return the stored result */
+    if (p_ctrl->result_valid)
+    {
+        *calculatedValue = p_ctrl->result;
+        return SSP_SUCCESS;
+    }
+
     /** Based on the selected polynomial, return the calculated CRC value */
     switch (p_ctrl->polynomial)
     {
@@ -268,7 +366,8 @@ ssp_err_t R_CRC_SnoopEnable (crc_ctrl_t * const p_api_ctrl, uint32_t crc_seed)
 
     }
 
-    /** Enable the snoop operation */
+    /** Enable the snoop operation, the running value is in the CRC calculator from now on */
+    p_ctrl->result_valid = false;
     HW_CRC_SnoopEnable(p_ctrl->p_reg);
     return SSP_SUCCESS;
 }
@@ -337,12 +436,14 @@ ssp_err_t R_CRC_SnoopCfg (crc_ctrl_t * const p_api_ctrl, crc_snoop_cfg_t * const
 }
 
 /*******************************************************************************************************************//**
- * @brief  Perform a CRC calculation on a block of 8-bit/32-bit(for 32-bit polynomial) data.
+ * @brief  Perform a CRC calculation on a block of data.
  *
  *  Implements crc_api_t::calculate
  *
- * This function performs a CRC calculation on an array of 8-bit/32-bit(for 32-bit polynomial) values and
- * returns an 8-bit/32-bit(for 32-bit polynomial) calculated value
+ * This function performs a CRC calculation on length bytes, in memory order, and returns an 8-bit, 16-bit or 32-bit
+ * calculated value. CRC-32 and CRC-32C with CRC_BIT_ORDER_LMS_MSB take the data as 32-bit words, see
+ * crc_api_t::calculate. Any length and alignment is accepted for every polynomial. Buffers shorter than the hardware
+ * threshold are calculated with the software tables in CRC_ENGINE_AUTO, without locking the CRC calculator.
  *
  * @retval SSP_SUCCESS              Calculation successful.
  * @retval SSP_ERR_ASSERTION        Either p_ctrl, inputBuffer, or calculatedValue is NULL.
@@ -352,6 +453,8 @@ ssp_err_t R_CRC_SnoopCfg (crc_ctrl_t * const p_api_ctrl, crc_snoop_cfg_t * const
  * @return                         See @ref Common_Error_Codes or functions called by this function for other possible
  *                                 return codes. This function calls:
  *                                   * fmi_api_t::productFeatureGet
+ *                                   * transfer_api_t::reset
+ *                                   * transfer_api_t::start
  **********************************************************************************************************************/
 ssp_err_t R_CRC_Calculate (crc_ctrl_t * const p_api_ctrl,
                            void               * inputBuffer,
@@ -370,30 +473,51 @@ ssp_err_t R_CRC_Calculate (crc_ctrl_t * const p_api_ctrl,
 
     CRC_ERROR_RETURN((0UL != length), SSP_ERR_INVALID_ARGUMENT);
 
-    /** Lock the peripheral during calculation */
-    ssp_feature_t ssp_feature = {{(ssp_ip_t) 0U}};
-    ssp_feature.channel = 0U;
-    ssp_feature.unit = 0U;
-    ssp_feature.id = SSP_IP_CRC;
-    fmi_feature_info_t info = {0U};
-    ssp_err_t err = g_fmi_on_fmi.productFeatureGet(&ssp_feature, &info);
-    CRC_ERROR_RETURN(SSP_SUCCESS == err, err);
-    err = R_BSP_HardwareLock(&ssp_feature);
-    CRC_ERROR_RETURN((SSP_SUCCESS == err), SSP_ERR_IN_USE);
-
-    /** Set the bit order */
-    HW_CRC_BitorderSet(p_ctrl->p_reg, p_ctrl->bit_order);
+    return crc_calculate(p_ctrl, inputBuffer, length, crc_seed, calculatedValue);
+}
 
-    /** Set CRC polynomial */
-    HW_CRC_PolynomialSet(p_ctrl->p_reg, p_ctrl->polynomial);
+/*******************************************************************************************************************//**
+ * @brief  Continue a CRC calculation with the next block of data.
+ *
+ *  Implements crc_api_t::update
+ *
+ * The running value is passed in p_crc_value and replaced with the value after num_bytes more bytes. Updating with
+ * consecutive blocks gives the same value as one calculate call over the concatenated data, regardless of which
+ * engine processed each block. CRC-32 and CRC-32C MSB first feed whole words from the start of each block, so their
+ * blocks must be a multiple of four bytes; a last block that ends inside a word is passed to R_CRC_Calculate with the
+ * running value as the seed. A num_bytes of 0 leaves the running value unchanged.
+ *
+ * @retval SSP_SUCCESS             Calculation successful.
+ * @retval SSP_ERR_ASSERTION       Either p_ctrl, p_input_buffer, or p_crc_value is NULL.
+ * @retval SSP_ERR_NOT_OPEN        The driver is not opened.
+ * @retval SSP_ERR_INVALID_SIZE    CRC-32 or CRC-32C MSB first and num_bytes is not a multiple of four.
+ * @retval SSP_ERR_IN_USE          CRC peripheral is currently in use by another instance of the driver.
+ * @return                         See @ref Common_Error_Codes or functions called by this function for other possible
+ *                                 return codes. This function calls:
+ *                                   * fmi_api_t::productFeatureGet
+ *                                   * transfer_api_t::reset
+ *                                   * transfer_api_t::start
+ **********************************************************************************************************************/
+ssp_err_t R_CRC_Update (crc_ctrl_t * const p_api_ctrl,
+                        void const         * p_input_buffer,
+                        uint32_t           num_bytes,
+                        uint32_t   * const p_crc_value)
+{
+    crc_instance_ctrl_t * p_ctrl = (crc_instance_ctrl_t *) p_api_ctrl;
 
-    /** Calculate CRC value for the input buffer */
-    err = calculate_polynomial(p_ctrl, inputBuffer, length, crc_seed, calculatedValue);
+#if CRC_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(p_ctrl);
+    CRC_ERROR_RETURN(CRC_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+    SSP_ASSERT(p_input_buffer);
+    SSP_ASSERT(p_crc_value);
+#endif
 
-    /** Release the hardware lock */
-    R_BSP_HardwareUnlock(&ssp_feature);
+    /** A block that ends inside a word would split a word of the message across two CRCDIR feeds. */
+    bool word_feed = (32U == g_crc_sw_polynomials[p_ctrl->polynomial].width) &&
+                     (CRC_BIT_ORDER_LMS_MSB == p_ctrl->bit_order);
+    CRC_ERROR_RETURN((!word_feed) || (0U == (num_bytes % CRC_WORD_BYTES)), SSP_ERR_INVALID_SIZE);
 
-    return err;
+    return crc_calculate(p_ctrl, p_input_buffer, num_bytes, *p_crc_value, p_crc_value);
 }
 
 
@@ -426,26 +550,99 @@ ssp_err_t R_CRC_VersionGet (ssp_version_t * const p_version)
  **********************************************************************************************************************/
 
 /*******************************************************************************************************************//**
- * @brief  Perform a CRC calculation on a block of 8-bit data.
+ * @brief  Select the engine for a block of data and calculate its CRC.
  *
- *  Implements crc_api_t::calculate
+ * CRC_ENGINE_AUTO uses the software tables below the hardware threshold, where locking and configuring the CRC
+ * calculator costs more than the calculation, and the CRC calculator from there on.
  *
- * This function performs a CRC calculation on an array of 8-bit/32-bit(for 32-bit polynomial) values and
- * returns an 8-bit32-bit(for 32-bit polynomial) calculated value.
+ * @param[in]   p_ctrl     Pointer to the control block.
+ * @param[in]   p_input    Data to process, in memory order.
+ * @param[in]   length     Number of bytes to process.
+ * @param[in]   crc_seed   Running value to continue from.
+ * @param[out]  p_result   Running value after the data.
  *
- * @retval SSP_SUCCESS             Calculation successful.
+ * @retval SSP_SUCCESS     Calculation successful.
+ * @retval SSP_ERR_IN_USE  CRC peripheral is currently in use by another instance of the driver.
+ **********************************************************************************************************************/
+static ssp_err_t crc_calculate (crc_instance_ctrl_t * const p_ctrl,
+                                void const                * p_input,
+                                uint32_t                    length,
+                                uint32_t                    crc_seed,
+                                uint32_t            * const p_result)
+{
+    uint32_t width = g_crc_sw_polynomials[p_ctrl->polynomial].width;
+    uint32_t crc   = crc_seed & (0xFFFFFFFFUL >> (32U - width));
+
+    bool hardware = (CRC_ENGINE_HARDWARE == p_ctrl->engine);
+    if (CRC_ENGINE_AUTO == p_ctrl->engine)
+    {
+        hardware = (NULL == p_ctrl->p_table) || (length >= p_ctrl->hw_threshold);
+    }
+
+    /** Small buffers: calculate in software, the CRC calculator is not used */
+    if (!hardware)
+    {
+        p_ctrl->result       = crc_sw_calculate(p_ctrl, (uint8_t const *) p_input, length, crc);
+        p_ctrl->result_valid = true;
+        *p_result            = p_ctrl->result;
+        return SSP_SUCCESS;
+    }
+
+    /** Lock the peripheral during calculation */
+    ssp_feature_t ssp_feature = {{(ssp_ip_t) 0U}};
+    ssp_feature.channel = 0U;
+    ssp_feature.unit = 0U;
+    ssp_feature.id = SSP_IP_CRC;
+    fmi_feature_info_t info = {0U};
+    ssp_err_t err = g_fmi_on_fmi.productFeatureGet(&ssp_feature, &info);
+    CRC_ERROR_RETURN(SSP_SUCCESS == err, err);
+    err = R_BSP_HardwareLock(&ssp_feature);
+    CRC_ERROR_RETURN((SSP_SUCCESS == err), SSP_ERR_IN_USE);
+
+    /** Set the bit order */
+    HW_CRC_BitorderSet(p_ctrl->p_reg, p_ctrl->bit_order);
+
+    /** Set CRC polynomial */
+    HW_CRC_PolynomialSet(p_ctrl->p_reg, p_ctrl->polynomial);
+
+    /** Calculate CRC value for the input buffer */
+    err = calculate_polynomial(p_ctrl, p_input, length, crc, &p_ctrl->result);
+    p_ctrl->result_valid = (SSP_SUCCESS == err);
+    *p_result            = p_ctrl->result;
+
+    /** Release the hardware lock */
+    R_BSP_HardwareUnlock(&ssp_feature);
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Perform a CRC calculation on a block of data with the CRC calculator.
+ *
+ * The data is written to the CRC Data Input Register from the CPU, or by the DMAC for buffers of at least the DMA
+ * threshold. CRC-32 and CRC-32C take whole words, written to CRCDIR as they are in memory. The bytes after the last
+ * whole word are processed in software, continuing from the CRC calculator's value. With CRC_BIT_ORDER_LMS_LSB the
+ * bytes before the first word boundary are also processed in software so that the words are aligned; with
+ * CRC_BIT_ORDER_LMS_MSB the words start at the start of the buffer, as the data has always been fed.
  *
+ * @retval SSP_SUCCESS             Calculation successful.
+ * @return                         See @ref Common_Error_Codes or functions called by this function for other possible
+ *                                 return codes. This function calls:
+ *                                   * transfer_api_t::reset
+ *                                   * transfer_api_t::start
  **********************************************************************************************************************/
 ssp_err_t calculate_polynomial (crc_ctrl_t * const p_api_ctrl,
-                                void               * inputBuffer,
+                                void const         * inputBuffer,
                                 uint32_t           length,
                                 uint32_t           crc_seed,
                                 uint32_t           * calculatedValue)
 {
-
     uint32_t i;
+    ssp_err_t err = SSP_SUCCESS;
 
     crc_instance_ctrl_t * p_ctrl = (crc_instance_ctrl_t *) p_api_ctrl;
+    uint8_t const * p_data = (uint8_t const *) inputBuffer;
+    bool dma = (NULL != p_ctrl->p_transfer) && (length >= p_ctrl->dma_threshold);
 
     /* Write each element of the inputBuffer to the CRC Data Input Register. Each write to the
      * Data Input Register generates a new calculated value in the Data Output Register.
@@ -454,15 +651,19 @@ ssp_err_t calculate_polynomial (crc_ctrl_t * const p_api_ctrl,
     {
         case CRC_POLYNOMIAL_CRC_8:
         {
-            uint8_t * p_data = (uint8_t *) inputBuffer;
-
             /* CRC seed is masked to use only the lower 8 bits*/
             HW_CRC_8bitCalculatedValueSet(p_ctrl->p_reg, (uint8_t) (0xFFUL & crc_seed));
 
-            for (i = (uint32_t) 0; i < length; i++)
+            if (dma)
             {
-                HW_CRC_8bitInputWrite(p_ctrl->p_reg, (uint8_t) *p_data);
-                p_data = (p_data + 1UL);
+                err = crc_transfer_feed(p_ctrl, p_data, length);
+            }
+            else
+            {
+                for (i = (uint32_t) 0; i < length; i++)
+                {
+                    HW_CRC_8bitInputWrite(p_ctrl->p_reg, p_data[i]);
+                }
             }
 
             /* Return the calculated value */
@@ -473,15 +674,19 @@ ssp_err_t calculate_polynomial (crc_ctrl_t * const p_api_ctrl,
         case CRC_POLYNOMIAL_CRC_16:
         case CRC_POLYNOMIAL_CRC_CCITT:
         {
-            uint8_t * p_data = (uint8_t *) inputBuffer;
-
             /* CRC seed is masked to use only the lower 16 bits*/
-            HW_CRC_16bitCalculatedValueSet(p_ctrl->p_reg, 0xFFFF & crc_seed);
+            HW_CRC_16bitCalculatedValueSet(p_ctrl->p_reg, (uint16_t) (0xFFFFUL & crc_seed));
 
-            for (i = (uint32_t) 0; i < length; i++)
+            if (dma)
+            {
+                err = crc_transfer_feed(p_ctrl, p_data, length);
+            }
+            else
             {
-                HW_CRC_8bitInputWrite(p_ctrl->p_reg, (uint8_t) *p_data);
-                p_data = (p_data + 1UL);
+                for (i = (uint32_t) 0; i < length; i++)
+                {
+                    HW_CRC_8bitInputWrite(p_ctrl->p_reg, p_data[i]);
+                }
             }
 
             /* Return the calculated value */
@@ -491,22 +696,425 @@ ssp_err_t calculate_polynomial (crc_ctrl_t * const p_api_ctrl,
 
         default:
         {
-            uint32_t * p_data = (uint32_t *) inputBuffer;
+            /* LSB first: bytes up to the first word boundary. The result does not depend on where the words start. */
+            uint32_t head = 0U;
+            if (CRC_BIT_ORDER_LMS_LSB == p_ctrl->bit_order)
+            {
+                head = (CRC_WORD_BYTES - ((uint32_t) (uintptr_t) p_data & (CRC_WORD_BYTES - 1U))) &
+                       (CRC_WORD_BYTES - 1U);
+                if (head > length)
+                {
+                    head = length;
+                }
+            }
+            uint32_t crc = crc_sw_calculate(p_ctrl, p_data, head, crc_seed);
+            p_data += head;
+            length -= head;
 
             /* CRC seed uses the 32 bits*/
-            HW_CRC_32bitCalculatedValueSet(p_ctrl->p_reg, crc_seed);
+            HW_CRC_32bitCalculatedValueSet(p_ctrl->p_reg, crc);
 
-            for (i = (uint32_t) 0; i < (length / 4); i++)
+            uint32_t words = length / CRC_WORD_BYTES;
+            uint32_t const * p_word = (uint32_t const *) p_data;
+            bool aligned = (0U == ((uint32_t) (uintptr_t) p_data & (CRC_WORD_BYTES - 1U)));
+            if (dma && aligned)
+            {
+                err = crc_transfer_feed(p_ctrl, p_data, words);
+            }
+            else if (aligned)
+            {
+                for (i = (uint32_t) 0; i < words; i++)
+                {
+                    HW_CRC_32bitInputWrite(p_ctrl->p_reg, p_word[i]);
+                }
+            }
+            else
             {
-                HW_CRC_32bitInputWrite(p_ctrl->p_reg, (uint32_t) *p_data);
-                p_data = p_data + 1;
+                for (i = (uint32_t) 0; i < words; i++)
+                {
+                    HW_CRC_32bitInputWrite(p_ctrl->p_reg, crc_sw_load_le(&p_data[i * CRC_WORD_BYTES]));
+                }
             }
 
+            /* Bytes after the last word boundary */
+            crc = HW_CRC_32bitCalculatedValueGet(p_ctrl->p_reg);
+            p_data += words * CRC_WORD_BYTES;
+
             /* Return the calculated value */
-            *calculatedValue = (uint32_t) HW_CRC_32bitCalculatedValueGet(p_ctrl->p_reg);
+            *calculatedValue = crc_sw_calculate(p_ctrl, p_data, length - (words * CRC_WORD_BYTES), crc);
             break;
         }
 
     }
-    return SSP_SUCCESS;
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Configure and open the DMAC that writes to the CRC Data Input Register.
+ *
+ * The transfer is started by software, one CRCDIR sized unit per request, from an incrementing source.
+ *
+ * @param[in]  p_ctrl  Pointer to the control block, with p_reg and p_transfer set.
+ *
+ * @retval SSP_SUCCESS             Transfer opened.
+ * @retval SSP_ERR_ASSERTION       The transfer instance is incomplete.
+ * @return                         See @ref Common_Error_Codes or functions called by this function for other possible
+ *                                 return codes. This function calls:
+ *                                   * transfer_api_t::open
+ **********************************************************************************************************************/
+static ssp_err_t crc_transfer_open (crc_instance_ctrl_t * const p_ctrl)
+{
+    transfer_instance_t const * p_transfer = p_ctrl->p_transfer;
+
+#if CRC_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_transfer->p_api);
+    SSP_ASSERT(NULL != p_transfer->p_ctrl);
+    SSP_ASSERT(NULL != p_transfer->p_cfg);
+    SSP_ASSERT(NULL != p_transfer->p_cfg->p_info);
+#endif
+
+    bool word = (CRC_POLYNOMIAL_CRC_32 == p_ctrl->polynomial) || (CRC_POLYNOMIAL_CRC_32C == p_ctrl->polynomial);
+
+    transfer_cfg_t    cfg    = *(p_transfer->p_cfg);
+    transfer_info_t * p_info = p_transfer->p_cfg->p_info;
+    p_info->mode           = TRANSFER_MODE_NORMAL;
+    p_info->irq            = TRANSFER_IRQ_END;
+    p_info->size           = word ? TRANSFER_SIZE_4_BYTE : TRANSFER_SIZE_1_BYTE;
+    p_info->p_dest         = HW_CRC_InputAddrGet(p_ctrl->p_reg, word);
+    p_info->dest_addr_mode = TRANSFER_ADDR_MODE_FIXED;
+    p_info->src_addr_mode  = TRANSFER_ADDR_MODE_INCREMENTED;
+    cfg.activation_source  = ELC_EVENT_ELC_SOFTWARE_EVENT_0;
+    cfg.auto_enable        = false;
+    cfg.p_callback         = NULL;
+
+    return p_transfer->p_api->open(p_transfer->p_ctrl, &cfg);
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Write a block to the CRC Data Input Register with the DMAC and wait for it to complete.
+ *
+ * @param[in]  p_ctrl  Pointer to the control block.
+ * @param[in]  p_data  Source data, word aligned for CRC-32 and CRC-32C.
+ * @param[in]  count   Number of CRCDIR writes.
+ *
+ * @retval SSP_SUCCESS             All data written.
+ * @return                         See @ref Common_Error_Codes or functions called by this function for other possible
+ *                                 return codes. This function calls:
+ *                                   * transfer_api_t::reset
+ *                                   * transfer_api_t::start
+ *                                   * transfer_api_t::infoGet
+ **********************************************************************************************************************/
+static ssp_err_t crc_transfer_feed (crc_instance_ctrl_t * const p_ctrl, uint8_t const * p_data, uint32_t count)
+{
+    transfer_instance_t const * p_transfer = p_ctrl->p_transfer;
+    transfer_properties_t       properties = {0U};
+    uint32_t unit = ((CRC_POLYNOMIAL_CRC_32 == p_ctrl->polynomial) || (CRC_POLYNOMIAL_CRC_32C == p_ctrl->polynomial))
+                    ? CRC_WORD_BYTES : 1U;
+
+    ssp_err_t err = p_transfer->p_api->infoGet(p_transfer->p_ctrl, &properties);
+    uint32_t max = properties.transfer_length_max;
+
+    while ((SSP_SUCCESS == err) && (count > 0U))
+    {
+        uint32_t chunk = (count < max) ? count : max;
+
+        /** Software start until the block is complete */
+        err = p_transfer->p_api->reset(p_transfer->p_ctrl, p_data, NULL, (uint16_t) chunk);
+        if (SSP_SUCCESS == err)
+        {
+            err = p_transfer->p_api->start(p_transfer->p_ctrl, TRANSFER_START_MODE_REPEAT);
+        }
+        while (SSP_SUCCESS == err)
+        {
+            err = p_transfer->p_api->infoGet(p_transfer->p_ctrl, &properties);
+            if ((0U == properties.transfer_length_remaining) && (!properties.in_progress))
+            {
+                break;
+            }
+        }
+
+        p_data += chunk * unit;
+        count  -= chunk;
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Find or build the slice-by-8 tables for a polynomial and bit order.
+ *
+ * Sets are found and claimed with interrupts masked, so instances opened or closed from different threads never claim
+ * the same free set or rebuild a set in use. The tables are built after the claim, outside the critical section. A set
+ * that another instance is still building is not shared; another free set is built for the same polynomial instead.
+ *
+ * @param[in]  polynomial  Generator polynomial.
+ * @param[in]  bit_order   Bit order.
+ *
+ * @return  Pointer to the tables, or NULL if all table sets are in use for other polynomials or bit orders.
+ **********************************************************************************************************************/
+static uint32_t const * crc_sw_table_acquire (crc_polynomial_t polynomial, crc_bit_order_t bit_order)
+{
+#if CRC_CFG_SW_TABLE_SETS > 0
+    crc_sw_table_t * p_free = NULL;
+    bool             build  = false;
+
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+
+    for (uint32_t i = 0U; i < (uint32_t) CRC_CFG_SW_TABLE_SETS; i++)
+    {
+        crc_sw_table_t * p_set = &g_crc_sw_tables[i];
+        bool match = (polynomial == p_set->polynomial) && (bit_order == p_set->bit_order) && p_set->built;
+
+        if (0U != p_set->users)
+        {
+            if (match)
+            {
+                p_set->users++;
+                SSP_CRITICAL_SECTION_EXIT;
+                return p_set->table;
+            }
+        }
+        else if ((NULL == p_free) || match)
+        {
+            /* Prefer a free set that still holds the tables for this polynomial */
+            p_free = p_set;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+
+    if (NULL != p_free)
+    {
+        build = (polynomial != p_free->polynomial) || (bit_order != p_free->bit_order) || (!p_free->built);
+        if (build)
+        {
+            p_free->polynomial = polynomial;
+            p_free->bit_order  = bit_order;
+            p_free->built      = false;
+        }
+        p_free->users = 1U;
+    }
+
+    SSP_CRITICAL_SECTION_EXIT;
+
+    if (NULL == p_free)
+    {
+        return NULL;
+    }
+
+    if (build)
+    {
+        crc_sw_table_build(p_free);
+
+        /* The tables are complete before other instances can share them. */
+        __DMB();
+        p_free->built = true;
+    }
+
+    return p_free->table;
+#else
+    SSP_PARAMETER_NOT_USED(polynomial);
+    SSP_PARAMETER_NOT_USED(bit_order);
+    return NULL;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Release tables returned by crc_sw_table_acquire. The tables are kept until the set is needed for another
+ *         polynomial or bit order.
+ *
+ * @param[in]  p_table  Tables to release, NULL is ignored.
+ **********************************************************************************************************************/
+static void crc_sw_table_release (uint32_t const * p_table)
+{
+#if CRC_CFG_SW_TABLE_SETS > 0
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    for (uint32_t i = 0U; i < (uint32_t) CRC_CFG_SW_TABLE_SETS; i++)
+    {
+        if ((p_table == g_crc_sw_tables[i].table) && (0U != g_crc_sw_tables[i].users))
+        {
+            g_crc_sw_tables[i].users--;
+        }
+    }
+    SSP_CRITICAL_SECTION_EXIT;
+#else
+    SSP_PARAMETER_NOT_USED(p_table);
+#endif
+}
+
+#if CRC_CFG_SW_TABLE_SETS > 0
+/*******************************************************************************************************************//**
+ * @brief  Build the slice-by-8 tables. Table 0 is the byte-at-a-time table, table k advances its entry over k more
+ *         zero bytes.
+ *
+ * @param[in]  p_set  Table set with polynomial and bit_order filled in.
+ **********************************************************************************************************************/
+static void crc_sw_table_build (crc_sw_table_t * const p_set)
+{
+    crc_sw_polynomial_t const * p_poly  = &g_crc_sw_polynomials[p_set->polynomial];
+    uint32_t                  * p_table = p_set->table;
+
+    for (uint32_t b = 0U; b < CRC_SW_TABLE_ENTRIES; b++)
+    {
+        p_table[b] = crc_sw_bitwise(p_poly, p_set->bit_order, 0U, (uint8_t) b);
+    }
+
+    for (uint32_t k = 1U; k < CRC_SW_SLICES; k++)
+    {
+        for (uint32_t b = 0U; b < CRC_SW_TABLE_ENTRIES; b++)
+        {
+            uint32_t prev = p_table[((k - 1U) * CRC_SW_TABLE_ENTRIES) + b];
+            if (CRC_BIT_ORDER_LMS_LSB == p_set->bit_order)
+            {
+                p_table[(k * CRC_SW_TABLE_ENTRIES) + b] = (prev >> 8) ^ CRC_SW_LOOKUP(p_table, 0U, prev);
+            }
+            else
+            {
+                p_table[(k * CRC_SW_TABLE_ENTRIES) + b] = (prev << 8) ^ CRC_SW_LOOKUP(p_table, 0U, prev >> 24);
+            }
+        }
+    }
+}
+#endif
+
+/*******************************************************************************************************************//**
+ * @brief  Calculate a CRC in software, eight bytes per step with the slice-by-8 tables when the instance has them and
+ *         bit by bit otherwise.
+ *
+ * The result matches the CRC calculator. For CRC-32 and CRC-32C with CRC_BIT_ORDER_LMS_MSB that means the data is
+ * taken as little endian words from p_data, each processed from its most significant byte as a CRCDIR write is, and
+ * the bytes after the last whole word in memory order.
+ *
+ * @param[in]  p_ctrl  Pointer to the control block.
+ * @param[in]  p_data  Data to process, in memory order.
+ * @param[in]  length  Number of bytes to process.
+ * @param[in]  crc     Running value, right aligned.
+ *
+ * @return  Running value after the data, right aligned.
+ **********************************************************************************************************************/
+static uint32_t crc_sw_calculate (crc_instance_ctrl_t * const p_ctrl, uint8_t const * p_data, uint32_t length,
+                                  uint32_t crc)
+{
+    crc_sw_polynomial_t const * p_poly = &g_crc_sw_polynomials[p_ctrl->polynomial];
+    uint32_t const            * p_t    = p_ctrl->p_table;
+
+    if (CRC_BIT_ORDER_LMS_LSB == p_ctrl->bit_order)
+    {
+        if (NULL != p_t)
+        {
+            while (length >= CRC_SW_SLICES)
+            {
+                uint32_t one = crc ^ crc_sw_load_le(p_data);
+                uint32_t two = crc_sw_load_le(p_data + 4);
+                crc = CRC_SW_LOOKUP(p_t, 7U, one)       ^ CRC_SW_LOOKUP(p_t, 6U, one >> 8)  ^
+                      CRC_SW_LOOKUP(p_t, 5U, one >> 16) ^ CRC_SW_LOOKUP(p_t, 4U, one >> 24) ^
+                      CRC_SW_LOOKUP(p_t, 3U, two)       ^ CRC_SW_LOOKUP(p_t, 2U, two >> 8)  ^
+                      CRC_SW_LOOKUP(p_t, 1U, two >> 16) ^ CRC_SW_LOOKUP(p_t, 0U, two >> 24);
+                p_data += CRC_SW_SLICES;
+                length -= CRC_SW_SLICES;
+            }
+            for (; length > 0U; length--)
+            {
+                crc = (crc >> 8) ^ CRC_SW_LOOKUP(p_t, 0U, crc ^ *p_data++);
+            }
+        }
+        for (; length > 0U; length--)
+        {
+            crc = crc_sw_bitwise(p_poly, p_ctrl->bit_order, crc, *p_data++);
+        }
+        return crc;
+    }
+
+    /* MSB first tables and bitwise steps work on the CRC aligned to bit 31 */
+    uint32_t shift = 32U - p_poly->width;
+    bool     words = (0U == shift);
+    crc <<= shift;
+    if (NULL != p_t)
+    {
+        while (length >= CRC_SW_SLICES)
+        {
+            uint32_t one = crc ^ (words ? crc_sw_load_le(p_data) : crc_sw_load_be(p_data));
+            uint32_t two = words ? crc_sw_load_le(p_data + 4) : crc_sw_load_be(p_data + 4);
+            crc = CRC_SW_LOOKUP(p_t, 7U, one >> 24) ^ CRC_SW_LOOKUP(p_t, 6U, one >> 16) ^
+                  CRC_SW_LOOKUP(p_t, 5U, one >> 8)  ^ CRC_SW_LOOKUP(p_t, 4U, one)       ^
+                  CRC_SW_LOOKUP(p_t, 3U, two >> 24) ^ CRC_SW_LOOKUP(p_t, 2U, two >> 16) ^
+                  CRC_SW_LOOKUP(p_t, 1U, two >> 8)  ^ CRC_SW_LOOKUP(p_t, 0U, two);
+            p_data += CRC_SW_SLICES;
+            length -= CRC_SW_SLICES;
+        }
+    }
+    for (; words && (length >= CRC_WORD_BYTES); length -= CRC_WORD_BYTES)
+    {
+        for (uint32_t b = CRC_WORD_BYTES; b > 0U; b--)
+        {
+            crc = crc_sw_msb_byte(p_poly, p_t, crc, p_data[b - 1U]);
+        }
+        p_data += CRC_WORD_BYTES;
+    }
+    for (; length > 0U; length--)
+    {
+        crc = crc_sw_msb_byte(p_poly, p_t, crc, *p_data++);
+    }
+    return crc >> shift;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Process one byte MSB first on the CRC aligned to bit 31, with table 0 if there are tables.
+ **********************************************************************************************************************/
+static uint32_t crc_sw_msb_byte (crc_sw_polynomial_t const * p_poly, uint32_t const * p_t, uint32_t crc, uint8_t data)
+{
+    if (NULL != p_t)
+    {
+        return (crc << 8) ^ CRC_SW_LOOKUP(p_t, 0U, (crc >> 24) ^ data);
+    }
+    return crc_sw_bitwise(p_poly, CRC_BIT_ORDER_LMS_MSB, crc, data);
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Process one byte bit by bit. LSB first works on the CRC aligned to bit 0, MSB first on the CRC aligned to
+ *         bit 31.
+ **********************************************************************************************************************/
+static uint32_t crc_sw_bitwise (crc_sw_polynomial_t const * p_poly, crc_bit_order_t bit_order, uint32_t crc,
+                                uint8_t data)
+{
+    if (CRC_BIT_ORDER_LMS_LSB == bit_order)
+    {
+        crc ^= data;
+        for (uint32_t bit = 0U; bit < 8U; bit++)
+        {
+            crc = (0U != (crc & 1U)) ? ((crc >> 1) ^ p_poly->reflected) : (crc >> 1);
+        }
+    }
+    else
+    {
+        uint32_t normal = p_poly->normal << (32U - p_poly->width);
+        crc ^= (uint32_t) data << 24;
+        for (uint32_t bit = 0U; bit < 8U; bit++)
+        {
+            crc = (0U != (crc & 0x80000000UL)) ? ((crc << 1) ^ normal) : (crc << 1);
+        }
+    }
+    return crc;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Load four bytes of any alignment as a little endian word.
+ **********************************************************************************************************************/
+static uint32_t crc_sw_load_le (uint8_t const * p_data)
+{
+    return (uint32_t) p_data[0] | ((uint32_t) p_data[1] << 8) | ((uint32_t) p_data[2] << 16) |
+           ((uint32_t) p_data[3] << 24);
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Load four bytes of any alignment as a big endian word.
+ **********************************************************************************************************************/
+static uint32_t crc_sw_load_be (uint8_t const * p_data)
+{
+    return ((uint32_t) p_data[0] << 24) | ((uint32_t) p_data[1] << 16) | ((uint32_t) p_data[2] << 8) |
+           (uint32_t) p_data[3];
 }
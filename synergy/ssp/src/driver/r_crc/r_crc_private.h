@@ -39,10 +39,32 @@
 /**********************************************************************************************************************
  * Macro definitions
  **********************************************************************************************************************/
+/** Number of slice-by-8 lookup tables and entries per table. */
+#define CRC_SW_SLICES           (8U)
+#define CRC_SW_TABLE_ENTRIES    (256U)
 
 /**********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
+/** Generator polynomial parameters used by the software engine. */
+typedef struct st_crc_sw_polynomial
+{
+    uint32_t width;                 ///< CRC width in bits
+    uint32_t normal;                ///< Polynomial for MSB first calculation, without the X^width term
+    uint32_t reflected;             ///< Bit-reversed polynomial for LSB first calculation
+} crc_sw_polynomial_t;
+
+/** Slice-by-8 tables for one polynomial and bit order, shared by all open instances that use them. MSB first
+ *  tables are built for the CRC aligned to bit 31, LSB first tables for the CRC aligned to bit 0. */
+typedef struct st_crc_sw_table
+{
+    uint32_t          users;        ///< Number of open instances using the set, 0 if it is free
+    crc_polynomial_t  polynomial;   ///< Polynomial the tables were built for
+    crc_bit_order_t   bit_order;    ///< Bit order the tables were built for
+    volatile bool     built;        ///< Tables are complete, false while the instance that claimed the set builds them
+    uint32_t          table[CRC_SW_SLICES * CRC_SW_TABLE_ENTRIES];  ///< Table k holds byte b at [k * 256 + b]
+} crc_sw_table_t;
+
 #endif /* R_CRC_PRIVATE_H */
 
 /*******************************************************************************************************************//**
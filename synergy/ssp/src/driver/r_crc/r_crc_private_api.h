@@ -38,6 +38,10 @@ ssp_err_t R_CRC_Calculate (crc_ctrl_t * const p_ctrl,
                            uint32_t           crc_seed,
                            uint32_t           * calculated_value);
 ssp_err_t R_CRC_VersionGet (ssp_version_t * const p_version);
+ssp_err_t R_CRC_Update (crc_ctrl_t * const p_ctrl,
+                        void const         * p_input_buffer,
+                        uint32_t           num_bytes,
+                        uint32_t   * const p_crc_value);
 
 /* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
 SSP_FOOTER
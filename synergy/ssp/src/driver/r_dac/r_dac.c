@@ -60,7 +60,8 @@ const dac_api_t g_dac_on_dac =
     .start           = R_DAC_Start,
     .stop            = R_DAC_Stop,
     .versionGet      = R_DAC_VersionGet,
-    .infoGet         = R_DAC_InfoGet
+    .infoGet         = R_DAC_InfoGet,
+    .transferInfoGet = R_DAC_TransferInfoGet
 };
 
 /***********************************************************************************************************************
@@ -385,6 +386,36 @@ ssp_err_t R_DAC_InfoGet (dac_info_t    * const p_info)
     return SSP_SUCCESS;
 } /* End of function R_DAC_InfoGet */
 
+/*******************************************************************************************************************//**
+ * @brief  Get the data register of the channel and the size of its writes.  Implements dac_api_t::transferInfoGet.
+ *
+ * The channel must be started before transfers write to the data register, since a write does not enable the
+ * output the way R_DAC_Write does.
+ *
+ * @retval SSP_SUCCESS           Data register information stored in p_info.
+ * @retval SSP_ERR_ASSERTION     p_api_ctrl or p_info is NULL.
+ * @retval SSP_ERR_NOT_OPEN      Channel associated with p_ctrl has not been opened.
+ **********************************************************************************************************************/
+ssp_err_t R_DAC_TransferInfoGet (dac_ctrl_t * p_api_ctrl, dac_transfer_info_t * const p_info)
+{
+    dac_instance_ctrl_t * p_ctrl = (dac_instance_ctrl_t *) p_api_ctrl;
+
+#if DAC_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+    SSP_ASSERT(NULL != p_info);
+#endif
+
+    /** Validate that the channel is opened. */
+    DAC_ERROR_RETURN(p_ctrl->channel_opened, SSP_ERR_NOT_OPEN);
+
+    volatile uint16_t * p_dadr = NULL;
+    HW_DAC_DADRAddressGet((R_DAC_Type *) p_ctrl->p_reg, p_ctrl->channel, &p_dadr);
+    p_info->p_address     = p_dadr;
+    p_info->transfer_size = TRANSFER_SIZE_2_BYTE;
+
+    return SSP_SUCCESS;
+} /* End of function R_DAC_TransferInfoGet */
+
 
 /*******************************************************************************************************************//**
  * @} (end addtogroup DAC)
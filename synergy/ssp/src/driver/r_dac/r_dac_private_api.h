@@ -33,6 +33,7 @@ ssp_err_t R_DAC_Start (dac_ctrl_t * p_ctrl);
 ssp_err_t R_DAC_Stop  (dac_ctrl_t * p_ctrl);
 ssp_err_t R_DAC_VersionGet (ssp_version_t * p_version);
 ssp_err_t R_DAC_InfoGet (dac_info_t * const p_info);
+ssp_err_t R_DAC_TransferInfoGet (dac_ctrl_t * p_ctrl, dac_transfer_info_t * const p_info);
 
 /* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
 SSP_FOOTER
@@ -62,7 +62,8 @@ const dac_api_t g_dac_on_dac8 =
     .start           = R_DAC8_Start,
     .stop            = R_DAC8_Stop,
     .versionGet      = R_DAC8_VersionGet,
-    .infoGet         = R_DAC8_InfoGet
+    .infoGet         = R_DAC8_InfoGet,
+    .transferInfoGet = R_DAC8_TransferInfoGet
 };
 
 /***********************************************************************************************************************
@@ -401,6 +402,36 @@ ssp_err_t R_DAC8_InfoGet (dac_info_t    * const p_info)
     return SSP_SUCCESS;
 } /* End of function R_DAC8_InfoGet */
 
+/*******************************************************************************************************************//**
+ * @brief  Get the data register of the channel and the size of its writes.  Implements dac_api_t::transferInfoGet.
+ *
+ * Transfers write 8-bit samples to the data register directly, so the data format selected in dac_cfg_t does not
+ * apply to them.
+ *
+ * @retval SSP_SUCCESS           Data register information stored in p_info.
+ * @retval SSP_ERR_ASSERTION     p_api_ctrl or p_info is NULL.
+ * @retval SSP_ERR_NOT_OPEN      Channel associated with p_ctrl has not been opened.
+ **********************************************************************************************************************/
+ssp_err_t R_DAC8_TransferInfoGet (dac_ctrl_t * p_api_ctrl, dac_transfer_info_t * const p_info)
+{
+    dac8_instance_ctrl_t * p_ctrl = (dac8_instance_ctrl_t *) p_api_ctrl;
+
+#if DAC8_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+    SSP_ASSERT(NULL != p_info);
+
+    /** Validate that the channel is opened. */
+    DAC8_ERROR_RETURN(DAC8_OPEN == p_ctrl->channel_opened, SSP_ERR_NOT_OPEN);
+#endif
+
+    volatile uint8_t * p_dadr = NULL;
+    HW_DAC8_DataAddressGet((R_DAC8_Type *) p_ctrl->p_reg, p_ctrl->channel, &p_dadr);
+    p_info->p_address     = p_dadr;
+    p_info->transfer_size = TRANSFER_SIZE_1_BYTE;
+
+    return SSP_SUCCESS;
+} /* End of function R_DAC8_TransferInfoGet */
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup DAC8)
  **********************************************************************************************************************/
@@ -116,6 +116,12 @@ __STATIC_INLINE void HW_DMAC_RepeatAreaSet (R_DMAC0_Type * p_dmac_regs, transfer
     p_dmac_regs->DMTMD_b.DTS = repeat_area;
 }
 
+__STATIC_INLINE void HW_DMAC_RepeatAreaNoneSet (R_DMAC0_Type * p_dmac_regs)
+{
+    /* DMTMD.DTS = 10b: neither the source nor the destination is a repeat or block area. */
+    p_dmac_regs->DMTMD_b.DTS = 2U;
+}
+
 __STATIC_INLINE void HW_DMAC_ModeSet (R_DMAC0_Type * p_dmac_regs, transfer_mode_t mode)
 {
     p_dmac_regs->DMTMD_b.MD = mode;
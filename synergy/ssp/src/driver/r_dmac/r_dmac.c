@@ -48,6 +48,9 @@
 #define DMAC_PRV_MASK_ALIGN_2_BYTES     (0x1U)
 #define DMAC_PRV_MASK_ALIGN_4_BYTES     (0x3U)
 
+/** Largest positive offset in DMOFR, which holds a 25-bit signed value. */
+#define DMAC_PRV_OFFSET_MAX             (0x00FFFFFFU)
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -87,6 +90,18 @@ static ssp_err_t dma_vector_info_get        (dmac_instance_ctrl_t * const p_ctrl
                                               transfer_cfg_t const * const p_cfg,
                                               ssp_feature_t * feature);
 
+static void dma_batch_load                   (dmac_instance_ctrl_t * const  p_ctrl,
+                                              transfer_info_t const * const p_info);
+
+static void dma_info_write                   (dmac_instance_ctrl_t * const  p_ctrl,
+                                              transfer_info_t const * const p_info);
+
+static void dma_transfer_start               (dmac_instance_ctrl_t * const  p_ctrl);
+
+static void dma_copy_2d_next                 (dmac_instance_ctrl_t * const  p_ctrl);
+
+static transfer_addr_mode_t dma_copy_2d_addr_mode (uint32_t stride, uint32_t unit);
+
 #if DMAC_CFG_PARAM_CHECKING_ENABLE
 static ssp_err_t r_dmac_enable_alignment_check(void const * p_src, void const * p_dest, transfer_size_t size);
 #endif
@@ -136,7 +151,10 @@ const transfer_api_t g_transfer_on_dmac =
     .close                   = R_DMAC_Close,
     .versionGet              = R_DMAC_VersionGet,
     .blockReset              = R_DMAC_BlockReset,
-    .Stop_ActivationRequest  = R_DMAC_Stop_ActivationRequest
+    .Stop_ActivationRequest  = R_DMAC_Stop_ActivationRequest,
+    .batchPrepare            = R_DMAC_BatchPrepare,
+    .batchSubmit             = R_DMAC_BatchSubmit,
+    .copy2D                  = R_DMAC_Copy2D
 };
 
 /** Stores pointer to DMA base address. */
@@ -251,6 +269,9 @@ ssp_err_t R_DMAC_Open      (transfer_ctrl_t         * const p_api_ctrl,
     /** Update internal variables. */
     p_ctrl->channel = ch;
     p_ctrl->trigger = p_cfg->activation_source;
+    p_ctrl->p_batch = NULL;
+    p_ctrl->batch_index = 0U;
+    p_ctrl->copy_2d.rows = 0U;
 
     /** Mark driver as open by initializing "DMAC" in its ASCII equivalent.*/
     p_ctrl->id      = DMAC_ID;
@@ -433,6 +454,10 @@ ssp_err_t R_DMAC_Disable (transfer_ctrl_t         * const p_api_ctrl)
     dma_ir_flag_clear(p_ctrl);
     HW_DMAC_TransferEnableDisable(p_dmac_regs, DMAC_TRANSFER_DISABLE);
 
+    /** Abandon the rest of a submitted batch or strided copy. */
+    p_ctrl->p_batch = NULL;
+    p_ctrl->copy_2d.rows = 0U;
+
     return SSP_SUCCESS;
 } /* End of function R_DMAC_Disable */
 
@@ -524,6 +549,8 @@ ssp_err_t R_DMAC_Close     (transfer_ctrl_t         * const p_api_ctrl)
 
     /** Clear ID so control block can be reused. */
     p_ctrl->id = 0U;
+    p_ctrl->p_batch = NULL;
+    p_ctrl->copy_2d.rows = 0U;
 
     /** Release BSP hardware lock on this channel */
     ssp_feature_t feature = {{(ssp_ip_t) 0U}};
@@ -650,6 +677,248 @@ ssp_err_t R_DMAC_Stop_ActivationRequest(transfer_ctrl_t * const p_api_ctrl)
 
     return SSP_SUCCESS;
 }/* End of function R_DMAC_Stop_ActivationRequest */
+
+/*******************************************************************************************************************//**
+ * @brief  Validate a batch of descriptors. Implements transfer_api_t::batchPrepare.
+ *
+ * The DMAC has no descriptor chaining, so the transfer end interrupt loads the next descriptor.  Chain mode is
+ * cleared and every descriptor interrupts only at its end.  Batches of more than one descriptor need the interrupt,
+ * so a callback must have been provided in transfer_api_t::open.
+ *
+ * @retval SSP_SUCCESS              Batch is ready to be submitted.
+ * @retval SSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval SSP_ERR_NOT_OPEN         Handle is not initialized.  Call R_DMAC_Open to initialize the control block.
+ * @retval SSP_ERR_IRQ_BSP_DISABLED The batch has more than one descriptor and the channel has no interrupt.
+ **********************************************************************************************************************/
+ssp_err_t R_DMAC_BatchPrepare (transfer_ctrl_t        * const p_api_ctrl,
+                               transfer_batch_t const * const p_batch)
+{
+    dmac_instance_ctrl_t * p_ctrl = (dmac_instance_ctrl_t *) p_api_ctrl;
+#if DMAC_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+    SSP_ASSERT(NULL != p_batch);
+    SSP_ASSERT(NULL != p_batch->p_info);
+    SSP_ASSERT(0U != p_batch->count);
+    DMAC_ERROR_RETURN(p_ctrl->id == DMAC_ID, SSP_ERR_NOT_OPEN);
+#endif
+    DMAC_ERROR_RETURN((1U == p_batch->count) || (SSP_INVALID_VECTOR != p_ctrl->irq), SSP_ERR_IRQ_BSP_DISABLED);
+
+    for (uint16_t i = 0U; i < p_batch->count; i++)
+    {
+        transfer_info_t * p_info = &p_batch->p_info[i];
+#if DMAC_CFG_PARAM_CHECKING_ENABLE
+        SSP_ASSERT(NULL != p_info->p_src);
+        SSP_ASSERT(NULL != p_info->p_dest);
+        if (TRANSFER_MODE_NORMAL != p_info->mode)
+        {
+            SSP_ASSERT(p_info->length <= DMAC_REPEAT_BLOCK_MAX_LENGTH);
+        }
+        ssp_err_t err = r_dmac_enable_alignment_check(p_info->p_src, p_info->p_dest, p_info->size);
+        DMAC_ERROR_RETURN(SSP_SUCCESS == err, err);
+#endif
+        p_info->chain_mode = TRANSFER_CHAIN_MODE_DISABLED;
+        p_info->irq        = TRANSFER_IRQ_END;
+    }
+
+    return SSP_SUCCESS;
+} /* End of function R_DMAC_BatchPrepare */
+
+/*******************************************************************************************************************//**
+ * @brief  Load the first descriptor of a prepared batch and enable the transfer. Implements
+ *         transfer_api_t::batchSubmit.
+ *
+ * The remaining descriptors are loaded from the transfer end interrupt, and the callback is called once the last
+ * one completes.  The callback may submit the next batch.  If the activation source is an ELC software event, each
+ * descriptor is started as soon as it is loaded.
+ *
+ * @retval SSP_SUCCESS              Batch submitted successfully.
+ * @retval SSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval SSP_ERR_NOT_OPEN         Handle is not initialized.  Call R_DMAC_Open to initialize the control block.
+ * @retval SSP_ERR_IN_USE           A transfer or batch is in progress. Wait for it to complete.
+ * @retval SSP_ERR_NOT_ENABLED      Enable failed due to an invalid descriptor.
+ **********************************************************************************************************************/
+ssp_err_t R_DMAC_BatchSubmit (transfer_ctrl_t        * const p_api_ctrl,
+                              transfer_batch_t const * const p_batch)
+{
+    dmac_instance_ctrl_t * p_ctrl = (dmac_instance_ctrl_t *) p_api_ctrl;
+#if DMAC_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+    SSP_ASSERT(NULL != p_batch);
+    SSP_ASSERT(NULL != p_batch->p_info);
+    SSP_ASSERT(0U != p_batch->count);
+    DMAC_ERROR_RETURN(p_ctrl->id == DMAC_ID, SSP_ERR_NOT_OPEN);
+    SSP_ASSERT(NULL != p_ctrl->p_reg);
+#endif
+
+    R_DMAC0_Type * p_dmac_regs = (R_DMAC0_Type *) p_ctrl->p_reg;
+    if (HW_DMAC_StatusGet(p_dmac_regs) || (NULL != p_ctrl->p_batch) || (0U != p_ctrl->copy_2d.rows))
+    {
+        return SSP_ERR_IN_USE;
+    }
+
+    HW_DMAC_TransferEnableDisable(p_dmac_regs, DMAC_TRANSFER_DISABLE);
+
+    /** The batch is only tracked if the interrupt can load the following descriptors. */
+    if (1U < p_batch->count)
+    {
+        p_ctrl->p_batch     = p_batch;
+        p_ctrl->batch_index = 0U;
+    }
+
+    dma_batch_load(p_ctrl, &p_batch->p_info[0]);
+
+    return SSP_SUCCESS;
+} /* End of function R_DMAC_BatchSubmit */
+
+/*******************************************************************************************************************//**
+ * @brief  Copy a rectangle between buffers with independent strides. Implements transfer_api_t::copy2D.
+ *
+ * The widest transfer size that the addresses, the width and the strides are aligned to is used.  The rectangle is
+ * copied by a single hardware transfer when:
+ * - The rows are contiguous in both buffers.  Rectangles of more than 65535 transfers are copied in block mode, one
+ *   block per row, if a row is at most 1024 transfers.
+ * - A row is a single transfer, for example a column gather.  A strided pointer steps by its stride with offset
+ *   addition; if both are strided the strides must be equal, because the channel has one offset register.  A stride
+ *   of 0 repeats the same address.
+ *
+ * Otherwise every row is a normal mode transfer and the following rows are loaded from the transfer end interrupt.
+ * The callback set in open is called once, after the last row.  The transfer settings made in open, including the
+ * offset, are replaced.  For software activation the copy starts immediately; otherwise rows are copied on the
+ * activation source set in open.
+ *
+ * @retval SSP_SUCCESS              Copy started.
+ * @retval SSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval SSP_ERR_NOT_OPEN         Handle is not initialized.  Call R_DMAC_Open to initialize the control block.
+ * @retval SSP_ERR_IN_USE           A transfer, batch or copy is in progress. Wait for it to complete.
+ * @retval SSP_ERR_INVALID_SIZE     A row is more than 65535 transfers.
+ * @retval SSP_ERR_IRQ_BSP_DISABLED The copy needs one transfer per row and the channel has no interrupt.
+ **********************************************************************************************************************/
+ssp_err_t R_DMAC_Copy2D (transfer_ctrl_t * const p_api_ctrl,
+                         void const            * p_src,
+                         uint32_t                src_stride,
+                         void                  * p_dest,
+                         uint32_t                dest_stride,
+                         uint32_t                width,
+                         uint16_t                height)
+{
+    dmac_instance_ctrl_t * p_ctrl = (dmac_instance_ctrl_t *) p_api_ctrl;
+#if DMAC_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+    SSP_ASSERT(NULL != p_src);
+    SSP_ASSERT(NULL != p_dest);
+    SSP_ASSERT(0U != width);
+    SSP_ASSERT(0U != height);
+    DMAC_ERROR_RETURN(p_ctrl->id == DMAC_ID, SSP_ERR_NOT_OPEN);
+    SSP_ASSERT(NULL != p_ctrl->p_reg);
+#endif
+
+    R_DMAC0_Type * p_dmac_regs = (R_DMAC0_Type *) p_ctrl->p_reg;
+    if (HW_DMAC_StatusGet(p_dmac_regs) || (NULL != p_ctrl->p_batch) || (0U != p_ctrl->copy_2d.rows))
+    {
+        return SSP_ERR_IN_USE;
+    }
+
+    /** Select the widest transfer size every row is aligned to. */
+    uint32_t align = (uint32_t) p_src | (uint32_t) p_dest | width;
+    if (1U < height)
+    {
+        align |= src_stride | dest_stride;
+    }
+    transfer_size_t size = TRANSFER_SIZE_1_BYTE;
+    if (0U == (align & DMAC_PRV_MASK_ALIGN_4_BYTES))
+    {
+        size = TRANSFER_SIZE_4_BYTE;
+    }
+    else if (0U == (align & DMAC_PRV_MASK_ALIGN_2_BYTES))
+    {
+        size = TRANSFER_SIZE_2_BYTE;
+    }
+    uint32_t unit   = 1UL << size;
+    uint32_t length = width / unit;
+    DMAC_ERROR_RETURN(DMAC_NORMAL_MAX_LENGTH >= length, SSP_ERR_INVALID_SIZE);
+
+    transfer_info_t info = {0U};
+    info.mode           = TRANSFER_MODE_NORMAL;
+    info.size           = size;
+    info.src_addr_mode  = TRANSFER_ADDR_MODE_INCREMENTED;
+    info.dest_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED;
+    info.repeat_area    = TRANSFER_REPEAT_AREA_DESTINATION;
+    info.irq            = TRANSFER_IRQ_END;
+    info.chain_mode     = TRANSFER_CHAIN_MODE_DISABLED;
+    info.p_src          = p_src;
+    info.p_dest         = p_dest;
+    info.length         = (uint16_t) length;
+
+    bool     block_area_none = false;
+    uint32_t offset          = 0U;
+    uint16_t rows            = 0U;
+
+    if ((1U == height) || ((src_stride == width) && (dest_stride == width)))
+    {
+        /** Contiguous rows are one transfer, or one block per row if they are too long for normal mode. */
+        uint32_t total = length * height;
+        if (DMAC_NORMAL_MAX_LENGTH >= total)
+        {
+            info.length = (uint16_t) total;
+        }
+        else if (DMAC_REPEAT_BLOCK_MAX_LENGTH >= length)
+        {
+            info.mode       = TRANSFER_MODE_BLOCK;
+            info.num_blocks = height;
+            block_area_none = true;
+        }
+        else
+        {
+            rows = (uint16_t) (height - 1U);
+        }
+    }
+    else if (unit == width)
+    {
+        /** Rows of one transfer step by the strides with offset addition, if both strides fit the offset. */
+        transfer_addr_mode_t src_mode  = dma_copy_2d_addr_mode(src_stride, unit);
+        transfer_addr_mode_t dest_mode = dma_copy_2d_addr_mode(dest_stride, unit);
+        offset = (TRANSFER_ADDR_MODE_OFFSET == src_mode) ? src_stride : dest_stride;
+        if (((TRANSFER_ADDR_MODE_OFFSET == src_mode) && (TRANSFER_ADDR_MODE_OFFSET == dest_mode) &&
+             (src_stride != dest_stride)) || (DMAC_PRV_OFFSET_MAX < offset))
+        {
+            rows = (uint16_t) (height - 1U);
+        }
+        else
+        {
+            info.src_addr_mode  = src_mode;
+            info.dest_addr_mode = dest_mode;
+            info.length         = height;
+        }
+    }
+    else
+    {
+        rows = (uint16_t) (height - 1U);
+    }
+
+    /** Rows after the first are loaded from the interrupt. */
+    DMAC_ERROR_RETURN((0U == rows) || (SSP_INVALID_VECTOR != p_ctrl->irq), SSP_ERR_IRQ_BSP_DISABLED);
+
+    p_ctrl->copy_2d.p_src       = (uint8_t const *) p_src + src_stride;
+    p_ctrl->copy_2d.p_dest      = (uint8_t *) p_dest + dest_stride;
+    p_ctrl->copy_2d.src_stride  = src_stride;
+    p_ctrl->copy_2d.dest_stride = dest_stride;
+    p_ctrl->copy_2d.length      = (uint16_t) length;
+    p_ctrl->copy_2d.rows        = rows;
+
+    HW_DMAC_TransferEnableDisable(p_dmac_regs, DMAC_TRANSFER_DISABLE);
+    dma_info_write(p_ctrl, &info);
+    if (block_area_none)
+    {
+        HW_DMAC_RepeatAreaNoneSet(p_dmac_regs);
+    }
+    if ((TRANSFER_ADDR_MODE_OFFSET == info.src_addr_mode) || (TRANSFER_ADDR_MODE_OFFSET == info.dest_addr_mode))
+    {
+        HW_DMAC_OffsetSet(p_dmac_regs, (int32_t) offset);
+    }
+    dma_transfer_start(p_ctrl);
+
+    return SSP_SUCCESS;
+} /* End of function R_DMAC_Copy2D */
 /*******************************************************************************************************************//**
  * @} (end addtogroup DMAC)
  **********************************************************************************************************************/
@@ -679,6 +948,36 @@ void dmac_int_isr (void)
     /** Clear pending IRQ to make sure it doesn't fire again after exiting */
     R_BSP_IrqStatusClear(R_SSP_CurrentIrqGet());
 
+    /** If a batch is running, load its next descriptor.  The callback is only called after the last one. */
+    if ((NULL != p_ctrl) && (NULL != p_ctrl->p_batch))
+    {
+        transfer_batch_t const * p_batch = p_ctrl->p_batch;
+        p_ctrl->batch_index++;
+        if (p_ctrl->batch_index < p_batch->count)
+        {
+            dma_batch_load(p_ctrl, &p_batch->p_info[p_ctrl->batch_index]);
+
+            /* Restore context if RTOS is used */
+            SF_CONTEXT_RESTORE
+
+            return;
+        }
+
+        /* Cleared before the callback so the callback can submit the next batch. */
+        p_ctrl->p_batch = NULL;
+    }
+
+    /** If a strided copy is running row by row, load its next row.  The callback is only called after the last one. */
+    if ((NULL != p_ctrl) && (0U != p_ctrl->copy_2d.rows))
+    {
+        dma_copy_2d_next(p_ctrl);
+
+        /* Restore context if RTOS is used */
+        SF_CONTEXT_RESTORE
+
+        return;
+    }
+
     if((NULL != p_ctrl) && (NULL != p_ctrl->p_callback))
     {
         /** Call user callback */
@@ -953,3 +1252,110 @@ static ssp_err_t dma_vector_info_get (dmac_instance_ctrl_t * const p_ctrl,
     }
     return err;
 }/* End of function dmac_vector_info_get */
+
+/*******************************************************************************************************************//**
+ * Load one batch descriptor into the channel registers and enable the transfer.  The channel must be disabled.
+ * Request source, offset and interrupt enables already set in the channel are kept.
+ *
+ * @param[in]   p_ctrl                  Pointer to control structure
+ * @param[in]   p_info                  Descriptor prepared with R_DMAC_BatchPrepare
+ **********************************************************************************************************************/
+static void dma_batch_load (dmac_instance_ctrl_t * const p_ctrl, transfer_info_t const * const p_info)
+{
+    dma_info_write(p_ctrl, p_info);
+    dma_transfer_start(p_ctrl);
+}/* End of function dma_batch_load */
+
+/*******************************************************************************************************************//**
+ * Write one descriptor to the channel registers.  The channel must be disabled.  The block count is cleared for
+ * normal mode descriptors so the interrupt does not reenable the channel after the transfer ends.
+ *
+ * @param[in]   p_ctrl                  Pointer to control structure
+ * @param[in]   p_info                  Descriptor to write
+ **********************************************************************************************************************/
+static void dma_info_write (dmac_instance_ctrl_t * const p_ctrl, transfer_info_t const * const p_info)
+{
+    R_DMAC0_Type * p_dmac_regs = (R_DMAC0_Type *) p_ctrl->p_reg;
+
+    HW_DMAC_DestAddrUpdateModeSet(p_dmac_regs, p_info->dest_addr_mode);
+    HW_DMAC_SrcAddrUpdateModeSet(p_dmac_regs, p_info->src_addr_mode);
+    HW_DMAC_TransferSizeSet(p_dmac_regs, p_info->size);
+    HW_DMAC_RepeatAreaSet(p_dmac_regs, p_info->repeat_area);
+    HW_DMAC_ModeSet(p_dmac_regs, p_info->mode);
+    HW_DMAC_SrcStartAddrSet(p_dmac_regs, p_info->p_src);
+    HW_DMAC_DestStartAddrSet(p_dmac_regs, p_info->p_dest);
+    HW_DMAC_TransferNumberSet(p_dmac_regs, p_info->length);
+    if (TRANSFER_MODE_NORMAL == p_info->mode)
+    {
+        HW_DMAC_TransferReloadSet(p_dmac_regs, 0);
+        HW_DMAC_BlockNumberSet(p_dmac_regs, 0U);
+    }
+    else
+    {
+        HW_DMAC_TransferReloadSet(p_dmac_regs, p_info->length);
+        HW_DMAC_BlockNumberSet(p_dmac_regs, p_info->num_blocks);
+    }
+    HW_DMAC_EachInterruptEnable(p_dmac_regs, TRANSFER_IRQ_END);
+}/* End of function dma_info_write */
+
+/*******************************************************************************************************************//**
+ * Enable the channel on the activation source set in open, and start it if the source is software.
+ *
+ * @param[in]   p_ctrl                  Pointer to control structure
+ **********************************************************************************************************************/
+static void dma_transfer_start (dmac_instance_ctrl_t * const p_ctrl)
+{
+    R_DMAC0_Type * p_dmac_regs = (R_DMAC0_Type *) p_ctrl->p_reg;
+
+    HW_ICU_DmacEnable(gp_icu_regs, p_ctrl->channel, p_ctrl->trigger);
+    HW_DMAC_TransferEnableDisable(p_dmac_regs, DMAC_TRANSFER_ENABLE);
+
+    /** Software activation starts each descriptor as soon as it is loaded. */
+    if ((ELC_EVENT_ELC_SOFTWARE_EVENT_0 == p_ctrl->trigger) || (ELC_EVENT_ELC_SOFTWARE_EVENT_1 == p_ctrl->trigger))
+    {
+        HW_DMAC_SoftwareStartAutoClear(p_dmac_regs, TRANSFER_START_MODE_REPEAT);
+        HW_DMAC_SoftwareStart(p_dmac_regs);
+    }
+}/* End of function dma_transfer_start */
+
+/*******************************************************************************************************************//**
+ * Load the next row of a strided copy and start it.  Only the addresses and the length change between rows.
+ *
+ * @param[in]   p_ctrl                  Pointer to control structure
+ **********************************************************************************************************************/
+static void dma_copy_2d_next (dmac_instance_ctrl_t * const p_ctrl)
+{
+    R_DMAC0_Type   * p_dmac_regs = (R_DMAC0_Type *) p_ctrl->p_reg;
+    dmac_copy_2d_t * p_copy      = &p_ctrl->copy_2d;
+
+    HW_DMAC_SrcStartAddrSet(p_dmac_regs, p_copy->p_src);
+    HW_DMAC_DestStartAddrSet(p_dmac_regs, p_copy->p_dest);
+    HW_DMAC_TransferNumberSet(p_dmac_regs, p_copy->length);
+
+    p_copy->p_src  += p_copy->src_stride;
+    p_copy->p_dest += p_copy->dest_stride;
+    p_copy->rows--;
+
+    dma_transfer_start(p_ctrl);
+}/* End of function dma_copy_2d_next */
+
+/*******************************************************************************************************************//**
+ * Select how a pointer moves from one single transfer row to the next.
+ *
+ * @param[in]   stride                  Bytes from one row to the next
+ * @param[in]   unit                    Bytes per transfer
+ *
+ * @return      Fixed for a stride of 0, incremented for a stride of one transfer, offset addition otherwise.
+ **********************************************************************************************************************/
+static transfer_addr_mode_t dma_copy_2d_addr_mode (uint32_t stride, uint32_t unit)
+{
+    if (0U == stride)
+    {
+        return TRANSFER_ADDR_MODE_FIXED;
+    }
+    if (unit == stride)
+    {
+        return TRANSFER_ADDR_MODE_INCREMENTED;
+    }
+    return TRANSFER_ADDR_MODE_OFFSET;
+}/* End of function dma_copy_2d_addr_mode */
@@ -150,7 +150,10 @@ const transfer_api_t g_transfer_on_dtc =
     .close                  = R_DTC_Close,
     .versionGet             = R_DTC_VersionGet,
     .blockReset             = R_DTC_BlockReset,
-    .Stop_ActivationRequest = R_DTC_Stop_ActivationRequest
+    .Stop_ActivationRequest = R_DTC_Stop_ActivationRequest,
+    .batchPrepare           = R_DTC_BatchPrepare,
+    .batchSubmit            = R_DTC_BatchSubmit,
+    .copy2D                 = R_DTC_Copy2D
 };
 
 /*******************************************************************************************************************//**
@@ -222,6 +225,12 @@ ssp_err_t R_DTC_Open (transfer_ctrl_t         * const p_api_ctrl,
 
     /** Update internal variables. */
     p_ctrl->irq     = irq;
+
+    /** Store the descriptors used by copy2D, if any. */
+    transfer_on_dtc_cfg_t const * p_extend = (transfer_on_dtc_cfg_t const *) p_cfg->p_extend;
+    p_ctrl->p_copy_2d_info     = (NULL != p_extend) ? p_extend->p_copy_2d_info : NULL;
+    p_ctrl->copy_2d_info_count = (NULL != p_extend) ? p_extend->copy_2d_info_count : 0U;
+
     /** Mark driver as open by initializing it to "DTC" in its ASCII equivalent. */
     p_ctrl->id      = DTC_ID;
 
@@ -629,6 +638,234 @@ ssp_err_t  R_DTC_Stop_ActivationRequest(transfer_ctrl_t * const p_api_ctrl)
 
     return SSP_ERR_UNSUPPORTED;
 } /* End of function R_DTC_Stop_ActivationRequest */
+
+/*******************************************************************************************************************//**
+ * @brief  Validate a batch of descriptors and link them into one chain. Implements transfer_api_t::batchPrepare.
+ *
+ * Every descriptor except the last chains to the next one (TRANSFER_CHAIN_MODE_EACH unless TRANSFER_CHAIN_MODE_END
+ * was selected), and the last one ends the chain.  The reload length is set for repeat and block mode descriptors.
+ *
+ * @retval SSP_SUCCESS              Batch is ready to be submitted.
+ * @retval SSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval SSP_ERR_NOT_OPEN         Handle is not initialized.  Call R_DTC_Open to initialize the control block.
+ **********************************************************************************************************************/
+ssp_err_t R_DTC_BatchPrepare (transfer_ctrl_t        * const p_api_ctrl,
+                              transfer_batch_t const * const p_batch)
+{
+    dtc_instance_ctrl_t * p_ctrl = (dtc_instance_ctrl_t *) p_api_ctrl;
+#if DTC_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+    SSP_ASSERT(NULL != p_batch);
+    SSP_ASSERT(NULL != p_batch->p_info);
+    SSP_ASSERT(0U != p_batch->count);
+    DTC_ERROR_RETURN(p_ctrl->id == DTC_ID, SSP_ERR_NOT_OPEN);
+#else
+    SSP_PARAMETER_NOT_USED(p_ctrl);
+#endif
+
+    for (uint16_t i = 0U; i < p_batch->count; i++)
+    {
+        transfer_info_t * p_info = &p_batch->p_info[i];
+#if DTC_CFG_PARAM_CHECKING_ENABLE
+        SSP_ASSERT(NULL != p_info->p_src);
+        SSP_ASSERT(NULL != p_info->p_dest);
+        if (TRANSFER_MODE_NORMAL != p_info->mode)
+        {
+            SSP_ASSERT(p_info->length <= DTC_REPEAT_BLOCK_MAX_LENGTH);
+        }
+        ssp_err_t err = r_dtc_enable_alignment_check(p_info);
+        DTC_ERROR_RETURN(SSP_SUCCESS == err, err);
+#endif
+
+        /** Chain to the next descriptor, or end the chain on the last one. */
+        if ((uint16_t) (i + 1U) == p_batch->count)
+        {
+            p_info->chain_mode = TRANSFER_CHAIN_MODE_DISABLED;
+        }
+        else if (TRANSFER_CHAIN_MODE_DISABLED == p_info->chain_mode)
+        {
+            p_info->chain_mode = TRANSFER_CHAIN_MODE_EACH;
+        }
+        else
+        {
+            /* Keep the chain mode selected by the application. */
+        }
+
+        /** For repeat and block modes, copy the initial length into the reload length. */
+        if (TRANSFER_MODE_NORMAL != p_info->mode)
+        {
+            dtc_reg_t * p_reg = (dtc_reg_t *) p_info;
+            p_reg->CRA_b.CRAH = p_reg->CRA_b.CRAL;
+        }
+    }
+
+    return SSP_SUCCESS;
+} /* End of function R_DTC_BatchPrepare */
+
+/*******************************************************************************************************************//**
+ * @brief  Point the vector table entry of the activation source at a prepared batch. Implements
+ *         transfer_api_t::batchSubmit.
+ *
+ * Only the vector table entry is written, so switching between prepared batches costs the same as a single
+ * descriptor reset.  If the activation source is an ELC software event, one activation is generated.
+ *
+ * @retval SSP_SUCCESS              Batch submitted successfully.
+ * @retval SSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval SSP_ERR_NOT_OPEN         Handle is not initialized.  Call R_DTC_Open to initialize the control block.
+ * @retval SSP_ERR_IRQ_BSP_DISABLED The IRQ associated with the p_ctrl is not enabled in the BSP.
+ * @retval SSP_ERR_NOT_ENABLED      Enable failed due to an invalid descriptor.
+ **********************************************************************************************************************/
+ssp_err_t R_DTC_BatchSubmit (transfer_ctrl_t        * const p_api_ctrl,
+                             transfer_batch_t const * const p_batch)
+{
+    dtc_instance_ctrl_t * p_ctrl = (dtc_instance_ctrl_t *) p_api_ctrl;
+#if DTC_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+    SSP_ASSERT(NULL != p_batch);
+    SSP_ASSERT(NULL != p_batch->p_info);
+    DTC_ERROR_RETURN(p_ctrl->id == DTC_ID, SSP_ERR_NOT_OPEN);
+#endif
+    DTC_ERROR_RETURN(SSP_INVALID_VECTOR != (IRQn_Type)p_ctrl->irq, SSP_ERR_IRQ_BSP_DISABLED);
+
+    /** Disable transfers on this activation source. */
+    HW_ICU_DTCDisable(gp_icu_regs, p_ctrl->irq);
+
+    /** Disable read skip so the DTC fetches the new chain on the next activation. */
+    HW_DTC_ReadSkipEnableSet(gp_dtc_regs, DTC_READ_SKIP_DISABLED);
+
+    gp_dtc_vector_table[p_ctrl->irq] = p_batch->p_info;
+
+    /** Enables transfers on this activation source. */
+    ssp_err_t err = R_DTC_Enable(p_ctrl);
+
+    /** Enable read skip after all settings are complete. */
+    HW_DTC_ReadSkipEnableSet(gp_dtc_regs, DTC_READ_SKIP_ENABLED);
+
+    DTC_ERROR_RETURN(SSP_SUCCESS == err, SSP_ERR_NOT_ENABLED);
+
+#if DTC_CFG_SOFTWARE_START_ENABLE
+    /** Generate one activation if the batch is started by software. */
+    if ((ELC_EVENT_ELC_SOFTWARE_EVENT_0 == p_ctrl->trigger) || (ELC_EVENT_ELC_SOFTWARE_EVENT_1 == p_ctrl->trigger))
+    {
+        err = R_DTC_Start(p_ctrl, TRANSFER_START_MODE_SINGLE);
+    }
+#endif
+
+    return err;
+} /* End of function R_DTC_BatchSubmit */
+
+/*******************************************************************************************************************//**
+ * @brief  Copy a rectangle between buffers with independent strides. Implements transfer_api_t::copy2D.
+ *
+ * The DTC has no offset addressing, so the rectangle is written as a batch into the descriptors set in
+ * transfer_on_dtc_cfg_t::p_copy_2d_info: block mode descriptors of one block of at most 256 transfers, a row at a
+ * time, chained so one activation copies the whole rectangle.  A rectangle with contiguous rows of at most 256
+ * transfers is split in blocks of 256 transfers regardless of the rows.  The widest transfer size that the
+ * addresses, the width and the strides are aligned to is used.  The descriptors set in open are replaced.
+ *
+ * @retval SSP_SUCCESS              Copy submitted.
+ * @retval SSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval SSP_ERR_NOT_OPEN         Handle is not initialized.  Call R_DTC_Open to initialize the control block.
+ * @retval SSP_ERR_UNSUPPORTED      No descriptors were set in transfer_on_dtc_cfg_t::p_copy_2d_info.
+ * @retval SSP_ERR_INVALID_SIZE     The copy needs more descriptors than transfer_on_dtc_cfg_t::copy_2d_info_count.
+ * @return                          See @ref Common_Error_Codes or functions called by this function for other possible
+ *                                  return codes. This function calls:
+ *                                    * R_DTC_BatchPrepare
+ *                                    * R_DTC_BatchSubmit
+ **********************************************************************************************************************/
+ssp_err_t R_DTC_Copy2D (transfer_ctrl_t * const p_api_ctrl,
+                        void const            * p_src,
+                        uint32_t                src_stride,
+                        void                  * p_dest,
+                        uint32_t                dest_stride,
+                        uint32_t                width,
+                        uint16_t                height)
+{
+    dtc_instance_ctrl_t * p_ctrl = (dtc_instance_ctrl_t *) p_api_ctrl;
+#if DTC_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+    SSP_ASSERT(NULL != p_src);
+    SSP_ASSERT(NULL != p_dest);
+    SSP_ASSERT(0U != width);
+    SSP_ASSERT(0U != height);
+    DTC_ERROR_RETURN(p_ctrl->id == DTC_ID, SSP_ERR_NOT_OPEN);
+#endif
+    DTC_ERROR_RETURN(NULL != p_ctrl->p_copy_2d_info, SSP_ERR_UNSUPPORTED);
+
+    /** Select the widest transfer size every row is aligned to. */
+    uint32_t align = (uint32_t) p_src | (uint32_t) p_dest | width;
+    if (1U < height)
+    {
+        align |= src_stride | dest_stride;
+    }
+    transfer_size_t size = TRANSFER_SIZE_1_BYTE;
+    if (0U == (align & DTC_PRV_MASK_ALIGN_4_BYTES))
+    {
+        size = TRANSFER_SIZE_4_BYTE;
+    }
+    else if (0U == (align & DTC_PRV_MASK_ALIGN_2_BYTES))
+    {
+        size = TRANSFER_SIZE_2_BYTE;
+    }
+    uint32_t unit   = 1UL << size;
+    uint32_t length = width / unit;
+    uint32_t rows   = height;
+
+    /** Short contiguous rows are copied as one row. */
+    if (((1U == height) || ((src_stride == width) && (dest_stride == width))) &&
+        (DTC_REPEAT_BLOCK_MAX_LENGTH >= length))
+    {
+        length *= height;
+        rows    = 1U;
+    }
+
+    /** Every row takes one descriptor per block of 256 transfers. */
+    uint32_t row_blocks = ((length - 1U) / DTC_REPEAT_BLOCK_MAX_LENGTH) + 1U;
+    DTC_ERROR_RETURN(row_blocks <= (p_ctrl->copy_2d_info_count / rows), SSP_ERR_INVALID_SIZE);
+
+    transfer_info_t info = {0U};
+    info.mode           = TRANSFER_MODE_BLOCK;
+    info.size           = size;
+    info.src_addr_mode  = TRANSFER_ADDR_MODE_INCREMENTED;
+    info.dest_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED;
+    info.repeat_area    = TRANSFER_REPEAT_AREA_SOURCE;
+    info.irq            = TRANSFER_IRQ_END;
+    info.chain_mode     = TRANSFER_CHAIN_MODE_DISABLED;
+    info.num_blocks     = 1U;
+
+    transfer_info_t * p_info     = p_ctrl->p_copy_2d_info;
+    uint8_t const   * p_row_src  = (uint8_t const *) p_src;
+    uint8_t         * p_row_dest = (uint8_t *) p_dest;
+    for (uint32_t row = 0U; row < rows; row++)
+    {
+        uint32_t remaining = length;
+        info.p_src  = p_row_src;
+        info.p_dest = p_row_dest;
+        while (0U < remaining)
+        {
+            uint32_t block = (DTC_REPEAT_BLOCK_MAX_LENGTH < remaining) ? DTC_REPEAT_BLOCK_MAX_LENGTH : remaining;
+            info.length = (uint16_t) block;
+            *p_info     = info;
+            p_info++;
+            info.p_src  = (uint8_t const *) info.p_src + (block * unit);
+            info.p_dest = (uint8_t *) info.p_dest + (block * unit);
+            remaining  -= block;
+        }
+        p_row_src  += src_stride;
+        p_row_dest += dest_stride;
+    }
+
+    /** Chain the descriptors and point the activation source at them. */
+    transfer_batch_t batch =
+    {
+        .p_info = p_ctrl->p_copy_2d_info,
+        .count  = (uint16_t) (row_blocks * rows),
+    };
+    ssp_err_t err = R_DTC_BatchPrepare(p_ctrl, &batch);
+    DTC_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    return R_DTC_BatchSubmit(p_ctrl, &batch);
+} /* End of function R_DTC_Copy2D */
 /*******************************************************************************************************************//**
  * @} (end addtogroup DTC)
  **********************************************************************************************************************/
@@ -48,6 +48,17 @@ ssp_err_t R_DTC_BlockReset (transfer_ctrl_t   * const p_ctrl,
                             transfer_size_t           size,
                             uint16_t            const num_transfers);
 ssp_err_t R_DTC_Stop_ActivationRequest(transfer_ctrl_t        * const p_ctrl);
+ssp_err_t R_DTC_BatchPrepare (transfer_ctrl_t        * const p_ctrl,
+                              transfer_batch_t const * const p_batch);
+ssp_err_t R_DTC_BatchSubmit  (transfer_ctrl_t        * const p_ctrl,
+                              transfer_batch_t const * const p_batch);
+ssp_err_t R_DTC_Copy2D       (transfer_ctrl_t        * const p_ctrl,
+                              void const                   * p_src,
+                              uint32_t                       src_stride,
+                              void                         * p_dest,
+                              uint32_t                       dest_stride,
+                              uint32_t                       width,
+                              uint16_t                       height);
 
 /* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
 SSP_FOOTER
@@ -0,0 +1,249 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : hw_ether_common.h
+ * Description  : ETHERC and EDMAC LLD layer
+ **********************************************************************************************************************/
+
+
+#ifndef HW_ETHER_COMMON_H
+#define HW_ETHER_COMMON_H
+
+/**********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+
+
+/* Common macro for SSP header files. There is also a corresponding SSP_FOOTER macro at the end of this file. */
+SSP_HEADER
+
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+/** EDMR bits. DL is left at 0 for 16-byte descriptors. */
+#define ETHER_PRV_EDMR_SWR              (1UL << 0)      ///< Software reset of the EDMAC and ETHERC
+#define ETHER_PRV_EDMR_DE               (1UL << 6)      ///< Little endian descriptors
+
+#define ETHER_PRV_EDTRR_TR              (1UL << 0)      ///< Start transmission
+#define ETHER_PRV_EDRRR_RR              (1UL << 0)      ///< Receive request, cleared when the receive ring runs out
+#define ETHER_PRV_RMCR_RNR              (1UL << 0)      ///< Keep EDRRR.RR set after each received frame
+
+/** EESR bits, EESIPR uses the same positions to enable the interrupt of each status. */
+#define ETHER_PRV_EESR_RFOF             (1UL << 16)     ///< Receive FIFO overflow
+#define ETHER_PRV_EESR_RDE              (1UL << 17)     ///< Receive descriptor empty, reception stopped
+#define ETHER_PRV_EESR_FR               (1UL << 18)     ///< Frame received
+#define ETHER_PRV_EESR_TFUF             (1UL << 19)     ///< Transmit FIFO underflow
+#define ETHER_PRV_EESR_TC               (1UL << 21)     ///< Frame transmit complete
+#define ETHER_PRV_EESR_ADE              (1UL << 23)     ///< Address error
+#define ETHER_PRV_EESR_RFCOF            (1UL << 24)     ///< Receive frame counter overflow
+#define ETHER_PRV_EESR_RABT             (1UL << 25)     ///< Receive abort
+#define ETHER_PRV_EESR_TABT             (1UL << 26)     ///< Transmit abort
+#define ETHER_PRV_EESR_ALL              (0x47FF0F9FUL)  ///< Every status bit, written to clear them all
+
+/** Status bits reported as ETHER_EVENT_ERROR. */
+#define ETHER_PRV_EESR_ERRORS           (ETHER_PRV_EESR_RFOF | ETHER_PRV_EESR_RDE | ETHER_PRV_EESR_TFUF | \
+                                         ETHER_PRV_EESR_ADE | ETHER_PRV_EESR_RFCOF | ETHER_PRV_EESR_RABT | \
+                                         ETHER_PRV_EESR_TABT)
+
+/** FDR setting for the 4 KB transmit and receive FIFOs. */
+#define ETHER_PRV_FDR_VALUE             (0x0000070FUL)
+
+/** ECMR bits. */
+#define ETHER_PRV_ECMR_PRM              (1UL << 0)      ///< Promiscuous mode
+#define ETHER_PRV_ECMR_DM               (1UL << 1)      ///< Full duplex
+#define ETHER_PRV_ECMR_RTM              (1UL << 2)      ///< 100 Mbps
+#define ETHER_PRV_ECMR_TE               (1UL << 5)      ///< Transmit enable
+#define ETHER_PRV_ECMR_RE               (1UL << 6)      ///< Receive enable
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Starts a software reset of the EDMAC and ETHERC. The reset takes 64 PCLKA cycles to complete.
+ * @param  p_edmac_reg   Pointer to EDMAC registers.
+ **********************************************************************************************************************/
+__STATIC_INLINE void HW_ETHER_SoftwareReset (R_EDMAC0_Type * p_edmac_reg)
+{
+    p_edmac_reg->EDMR = ETHER_PRV_EDMR_SWR;
+}
+
+/*******************************************************************************************************************//**
+ * Configures the EDMAC for little endian 16-byte descriptors and sets the start of both descriptor rings. All status
+ * flags are cleared and all interrupts disabled.
+ * @param  p_edmac_reg   Pointer to EDMAC registers.
+ * @param  tx_ring       Address of the first transmit descriptor.
+ * @param  rx_ring       Address of the first receive descriptor.
+ **********************************************************************************************************************/
+__STATIC_INLINE void HW_ETHER_DmacInit (R_EDMAC0_Type * p_edmac_reg, uint32_t tx_ring, uint32_t rx_ring)
+{
+    p_edmac_reg->EDMR   = ETHER_PRV_EDMR_DE;
+    p_edmac_reg->TDLAR  = tx_ring;
+    p_edmac_reg->RDLAR  = rx_ring;
+    p_edmac_reg->EESIPR = 0U;
+    p_edmac_reg->EESR   = ETHER_PRV_EESR_ALL;
+    p_edmac_reg->TRSCER = 0U;
+    p_edmac_reg->TFTR   = 0U;
+    p_edmac_reg->FDR    = ETHER_PRV_FDR_VALUE;
+    p_edmac_reg->RMCR   = ETHER_PRV_RMCR_RNR;
+}
+
+/*******************************************************************************************************************//**
+ * Sets the station MAC address used by the receive address filter.
+ * @param  p_etherc_reg  Pointer to ETHERC registers.
+ * @param  p_address     MAC address, ETHER_MAC_ADDRESS_BYTES long.
+ **********************************************************************************************************************/
+__STATIC_INLINE void HW_ETHER_MacAddressSet (R_ETHERC0_Type * p_etherc_reg, uint8_t const * p_address)
+{
+    p_etherc_reg->MAHR = ((uint32_t) p_address[0] << 24) | ((uint32_t) p_address[1] << 16) |
+                         ((uint32_t) p_address[2] << 8) | (uint32_t) p_address[3];
+    p_etherc_reg->MALR = ((uint32_t) p_address[4] << 8) | (uint32_t) p_address[5];
+}
+
+/*******************************************************************************************************************//**
+ * Sets the maximum receive frame length.
+ * @param  p_etherc_reg  Pointer to ETHERC registers.
+ * @param  length        Longest frame accepted, in bytes.
+ **********************************************************************************************************************/
+__STATIC_INLINE void HW_ETHER_FrameLengthSet (R_ETHERC0_Type * p_etherc_reg, uint32_t length)
+{
+    p_etherc_reg->RFLR = length;
+}
+
+/*******************************************************************************************************************//**
+ * Reads the ETHERC mode register.
+ * @param  p_etherc_reg  Pointer to ETHERC registers.
+ * @return ECMR value.
+ **********************************************************************************************************************/
+__STATIC_INLINE uint32_t HW_ETHER_ModeGet (R_ETHERC0_Type * p_etherc_reg)
+{
+    return p_etherc_reg->ECMR;
+}
+
+/*******************************************************************************************************************//**
+ * Writes the ETHERC mode register.
+ * @param  p_etherc_reg  Pointer to ETHERC registers.
+ * @param  mode          ECMR value.
+ **********************************************************************************************************************/
+__STATIC_INLINE void HW_ETHER_ModeSet (R_ETHERC0_Type * p_etherc_reg, uint32_t mode)
+{
+    p_etherc_reg->ECMR = mode;
+}
+
+/*******************************************************************************************************************//**
+ * Reads the EDMAC status flags.
+ * @param  p_edmac_reg   Pointer to EDMAC registers.
+ * @return EESR value.
+ **********************************************************************************************************************/
+__STATIC_INLINE uint32_t HW_ETHER_StatusGet (R_EDMAC0_Type * p_edmac_reg)
+{
+    return p_edmac_reg->EESR;
+}
+
+/*******************************************************************************************************************//**
+ * Clears EDMAC status flags. Flags not set in the mask are not affected.
+ * @param  p_edmac_reg   Pointer to EDMAC registers.
+ * @param  mask          Flags to clear.
+ **********************************************************************************************************************/
+__STATIC_INLINE void HW_ETHER_StatusClear (R_EDMAC0_Type * p_edmac_reg, uint32_t mask)
+{
+    p_edmac_reg->EESR = mask;
+}
+
+/*******************************************************************************************************************//**
+ * Reads the EDMAC interrupt enable register.
+ * @param  p_edmac_reg   Pointer to EDMAC registers.
+ * @return EESIPR value.
+ **********************************************************************************************************************/
+__STATIC_INLINE uint32_t HW_ETHER_InterruptEnableGet (R_EDMAC0_Type * p_edmac_reg)
+{
+    return p_edmac_reg->EESIPR;
+}
+
+/*******************************************************************************************************************//**
+ * Writes the EDMAC interrupt enable register.
+ * @param  p_edmac_reg   Pointer to EDMAC registers.
+ * @param  mask          Status flags that request the EINT interrupt.
+ **********************************************************************************************************************/
+__STATIC_INLINE void HW_ETHER_InterruptEnableSet (R_EDMAC0_Type * p_edmac_reg, uint32_t mask)
+{
+    p_edmac_reg->EESIPR = mask;
+}
+
+/*******************************************************************************************************************//**
+ * Tells the EDMAC that transmit descriptors are ready. Has no effect if transmission is already running.
+ * @param  p_edmac_reg   Pointer to EDMAC registers.
+ **********************************************************************************************************************/
+__STATIC_INLINE void HW_ETHER_TransmitStart (R_EDMAC0_Type * p_edmac_reg)
+{
+    p_edmac_reg->EDTRR = ETHER_PRV_EDTRR_TR;
+}
+
+/*******************************************************************************************************************//**
+ * Enables or disables reception by the EDMAC.
+ * @param  p_edmac_reg   Pointer to EDMAC registers.
+ * @param  enable        true to receive into the descriptor ring.
+ **********************************************************************************************************************/
+__STATIC_INLINE void HW_ETHER_ReceiveSet (R_EDMAC0_Type * p_edmac_reg, bool enable)
+{
+    p_edmac_reg->EDRRR = enable ? ETHER_PRV_EDRRR_RR : 0U;
+}
+
+/*******************************************************************************************************************//**
+ * Checks whether the EDMAC is receiving. Reception stops when the EDMAC finds a receive descriptor it does not own.
+ * @param  p_edmac_reg   Pointer to EDMAC registers.
+ * @retval true          Reception is running.
+ **********************************************************************************************************************/
+__STATIC_INLINE bool HW_ETHER_ReceiveIsRunning (R_EDMAC0_Type * p_edmac_reg)
+{
+    return (0U != (p_edmac_reg->EDRRR & ETHER_PRV_EDRRR_RR));
+}
+
+/*******************************************************************************************************************//**
+ * Reads and clears the count of frames dropped because no receive descriptor was available.
+ * @param  p_edmac_reg   Pointer to EDMAC registers.
+ * @return Frames dropped since the last call.
+ **********************************************************************************************************************/
+__STATIC_INLINE uint32_t HW_ETHER_MissedFramesGet (R_EDMAC0_Type * p_edmac_reg)
+{
+    uint32_t missed = p_edmac_reg->RMFCR & 0xFFFFU;
+    p_edmac_reg->RMFCR = 0U;
+
+    return missed;
+}
+
+/* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
+SSP_FOOTER
+
+#endif /* HW_ETHER_COMMON_H */
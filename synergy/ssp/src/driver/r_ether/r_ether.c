@@ -0,0 +1,983 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : r_ether.c
+ * Description  : HAL API code for the Ethernet MAC (ETHERC and EDMAC)
+ **********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "r_ether.h"
+#include "r_ether_private.h"
+#include "r_ether_private_api.h"
+#include "../../bsp/mcu/all/bsp_atomic.h"
+#include <string.h>
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/** "ETHR" in ASCII, used to determine if channel is open. */
+#define ETHER_OPEN                      (0x45544852ULL)
+
+/** Wait after a software reset, longer than 64 cycles of the slowest PCLKA. */
+#define ETHER_PRV_RESET_DELAY_US        (10U)
+
+/** Packet buffer header in front of the frame data at an address taken from a descriptor. */
+#define ETHER_PRV_BUFFER_FROM_DATA(address) \
+    ((ether_buffer_t *) (uintptr_t) ((uint32_t) (address) - ETHER_BUFFER_HEADER_SIZE))
+
+/** Macro for error logger. */
+#ifndef ETHER_ERROR_RETURN
+/*LDRA_INSPECTED 77 S This macro does not work when surrounded by parentheses. */
+#define ETHER_ERROR_RETURN(a, err) SSP_ERROR_RETURN((a), (err), &g_module_name[0], &g_ether_version)
+#endif
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+#if ETHER_CFG_PARAM_CHECKING_ENABLE
+static ssp_err_t r_ether_open_param_check (ether_instance_ctrl_t * const p_ctrl, ether_cfg_t const * const p_cfg);
+#endif
+static void             r_ether_rings_init (ether_instance_ctrl_t * const p_ctrl);
+static void             r_ether_rings_release (ether_instance_ctrl_t * const p_ctrl);
+static void             r_ether_rx_advance (ether_instance_ctrl_t * const p_ctrl);
+static uint32_t         r_ether_tx_reclaim (ether_instance_ctrl_t * const p_ctrl);
+static ether_buffer_t * r_ether_buffer_get (ether_instance_ctrl_t * const p_ctrl);
+static void             r_ether_buffer_put (ether_instance_ctrl_t * const p_ctrl, ether_buffer_t * const p_buffer);
+static uint32_t         r_ether_interrupt_mask (ether_instance_ctrl_t * const p_ctrl);
+static void             r_ether_rx_arm (ether_instance_ctrl_t * const p_ctrl, bool armed);
+static void             r_ether_irq_process (ether_instance_ctrl_t * const p_ctrl);
+static void             r_ether_callback_call (ether_instance_ctrl_t * p_ctrl, ether_callback_args_t * p_args);
+static void             r_ether_callback_work (void * p_context, void * p_args);
+
+void edmac_eint_isr (void);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+#if defined(__GNUC__)
+/* This structure is affected by warnings from the GCC compiler bug https:/gcc.gnu.org/bugzilla/show_bug.cgi?id=60784
+ * This pragma suppresses the warnings in this structure only, and will be removed when the SSP compiler is updated to
+ * v5.3.*/
+/*LDRA_INSPECTED 69 S */
+#pragma GCC diagnostic ignored "-Wmissing-field-initializers"
+#endif
+/** Version data structure used by error logger macro. */
+static const ssp_version_t g_ether_version =
+{
+    .api_version_minor  = ETHER_API_VERSION_MINOR,
+    .api_version_major  = ETHER_API_VERSION_MAJOR,
+    .code_version_major = ETHER_CODE_VERSION_MAJOR,
+    .code_version_minor = ETHER_CODE_VERSION_MINOR
+};
+#if defined(__GNUC__)
+/* Restore warning settings for 'missing-field-initializers' to as specified on command line. */
+/*LDRA_INSPECTED 69 S */
+#pragma GCC diagnostic pop
+#endif
+
+/** Name of module used by error logger macro */
+#if BSP_CFG_ERROR_LOG != 0
+static const char g_module_name[] = "ether";
+#endif
+
+/** Filled in Interface API structure for this Instance. */
+/*LDRA_INSPECTED 27 D This structure must be accessible in user code. It cannot be static. */
+const ether_api_t g_ether_on_ether =
+{
+    .open          = R_ETHER_Open,
+    .close         = R_ETHER_Close,
+    .read          = R_ETHER_Read,
+    .write         = R_ETHER_Write,
+    .bufferAlloc   = R_ETHER_BufferAlloc,
+    .bufferRetain  = R_ETHER_BufferRetain,
+    .bufferRelease = R_ETHER_BufferRelease,
+    .rxModeSet     = R_ETHER_RxModeSet,
+    .linkSet       = R_ETHER_LinkSet,
+    .statsGet      = R_ETHER_StatsGet,
+    .versionGet    = R_ETHER_VersionGet
+};
+
+/** @addtogroup ETHER
+ * @{
+ */
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @brief  Open the Ethernet MAC.
+ *
+ *  Implements ether_api_t::open
+ *
+ * The packet buffer memory is carved into a pool of ETHER_BUFFER_BLOCK_SIZE blocks, every receive descriptor gets a
+ * buffer from the pool, and the MAC is reset and configured with the station address, link settings and descriptor
+ * rings. Reception starts before this function returns. The EINT interrupt is required when p_callback is set.
+ *
+ * @retval SSP_SUCCESS                 Ethernet MAC opened, reception running.
+ * @retval SSP_ERR_ASSERTION           A pointer is NULL, a ring is empty, or there are not more buffers than receive
+ *                                     descriptors.
+ * @retval SSP_ERR_IN_USE              The control block is already open.
+ * @retval SSP_ERR_INVALID_ALIGNMENT   A descriptor ring or the packet buffer memory is not aligned.
+ * @retval SSP_ERR_IRQ_BSP_DISABLED    p_callback is set but the EINT interrupt is not enabled in the BSP.
+ * @retval SSP_ERR_HW_LOCKED           The channel is in use by another driver.
+ * @return                             See @ref Common_Error_Codes or functions called by this function for other
+ *                                     possible return codes. This function calls:
+ *                                     * fmi_api_t::productFeatureGet
+ *                                     * R_BSP_PoolOpen
+ **********************************************************************************************************************/
+ssp_err_t R_ETHER_Open (ether_ctrl_t * const p_api_ctrl, ether_cfg_t const * const p_cfg)
+{
+    ether_instance_ctrl_t * p_ctrl = (ether_instance_ctrl_t *) p_api_ctrl;
+    ssp_err_t               err;
+
+#if ETHER_CFG_PARAM_CHECKING_ENABLE
+    err = r_ether_open_param_check(p_ctrl, p_cfg);
+    ETHER_ERROR_RETURN(SSP_SUCCESS == err, err);
+#endif
+
+    /** Verify the requested channel exists and look up the EDMAC (unit 0) and ETHERC (unit 1) registers. */
+    ssp_feature_t ssp_feature = {{(ssp_ip_t) 0U}};
+    ssp_feature.channel = p_cfg->channel;
+    ssp_feature.unit    = 1U;
+    ssp_feature.id      = SSP_IP_EDMAC;
+    fmi_feature_info_t info = {0U};
+    err = g_fmi_on_fmi.productFeatureGet(&ssp_feature, &info);
+    ETHER_ERROR_RETURN(SSP_SUCCESS == err, err);
+    void * p_etherc_base = info.ptr;
+
+    ssp_feature.unit = 0U;
+    err = g_fmi_on_fmi.productFeatureGet(&ssp_feature, &info);
+    ETHER_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    fmi_event_info_t event_info = {(IRQn_Type) 0U};
+    g_fmi_on_fmi.eventInfoGet(&ssp_feature, SSP_SIGNAL_EDMAC_EINT, &event_info);
+    ETHER_ERROR_RETURN((NULL == p_cfg->p_callback) || (SSP_INVALID_VECTOR != event_info.irq),
+                       SSP_ERR_IRQ_BSP_DISABLED);
+
+    /** Acquire lock before changing vector table or p_ctrl. */
+    ETHER_ERROR_RETURN(SSP_SUCCESS == R_BSP_HardwareLock(&ssp_feature), SSP_ERR_HW_LOCKED);
+
+    /** Initialize control block. */
+    *p_ctrl = (const ether_instance_ctrl_t) {0U};
+    p_ctrl->channel                    = p_cfg->channel;
+    p_ctrl->p_edmac_reg                = info.ptr;
+    p_ctrl->p_etherc_reg               = p_etherc_base;
+    p_ctrl->irq                        = event_info.irq;
+    p_ctrl->rx_mode                    = p_cfg->rx_mode;
+    p_ctrl->rx_armed                   = (ETHER_RX_MODE_INTERRUPT == p_cfg->rx_mode);
+    p_ctrl->p_rx_descriptors           = p_cfg->p_rx_descriptors;
+    p_ctrl->num_rx_descriptors         = p_cfg->num_rx_descriptors;
+    p_ctrl->p_tx_descriptors           = p_cfg->p_tx_descriptors;
+    p_ctrl->num_tx_descriptors         = p_cfg->num_tx_descriptors;
+    p_ctrl->p_callback                 = p_cfg->p_callback;
+    p_ctrl->p_context                  = p_cfg->p_context;
+    p_ctrl->deferred_callback          = p_cfg->deferred_callback;
+    p_ctrl->deferred_callback_priority = p_cfg->deferred_callback_priority;
+
+    /** Carve the packet buffer memory into one pool size class. */
+    bsp_pool_class_cfg_t buffer_class =
+    {
+        .block_size  = ETHER_BUFFER_BLOCK_SIZE,
+        .block_count = p_cfg->num_buffers
+    };
+    bsp_pool_cfg_t pool_cfg =
+    {
+        .p_region     = p_cfg->p_buffer_memory,
+        .region_bytes = ETHER_BUFFER_MEMORY_SIZE(p_cfg->num_buffers),
+        .p_classes    = &buffer_class,
+        .num_classes  = 1U
+    };
+    err = R_BSP_PoolOpen(&p_ctrl->pool, &pool_cfg);
+    if (SSP_SUCCESS != err)
+    {
+        R_BSP_HardwareUnlock(&ssp_feature);
+    }
+    ETHER_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    /** Turn off module stop bit (turn module on) and reset the EDMAC and ETHERC. */
+    R_BSP_ModuleStart(&ssp_feature);
+
+    R_EDMAC0_Type  * p_edmac_reg  = (R_EDMAC0_Type *) p_ctrl->p_edmac_reg;
+    R_ETHERC0_Type * p_etherc_reg = (R_ETHERC0_Type *) p_ctrl->p_etherc_reg;
+    HW_ETHER_SoftwareReset(p_edmac_reg);
+    R_BSP_SoftwareDelay(ETHER_PRV_RESET_DELAY_US, BSP_DELAY_UNITS_MICROSECONDS);
+
+    /** Give every receive descriptor a buffer and hand both rings to the EDMAC. */
+    r_ether_rings_init(p_ctrl);
+    HW_ETHER_DmacInit(p_edmac_reg, (uint32_t) p_ctrl->p_tx_descriptors, (uint32_t) p_ctrl->p_rx_descriptors);
+
+    /** Configure the MAC address filter, frame length and link settings, then enable the MAC. */
+    HW_ETHER_MacAddressSet(p_etherc_reg, p_cfg->p_mac_address);
+    HW_ETHER_FrameLengthSet(p_etherc_reg, ETHER_PRV_FRAME_MAX);
+    uint32_t mode = ETHER_PRV_ECMR_TE | ETHER_PRV_ECMR_RE;
+    mode |= p_cfg->promiscuous ? ETHER_PRV_ECMR_PRM : 0U;
+    mode |= (ETHER_LINK_DUPLEX_FULL == p_cfg->link_duplex) ? ETHER_PRV_ECMR_DM : 0U;
+    mode |= (ETHER_LINK_SPEED_100M == p_cfg->link_speed) ? ETHER_PRV_ECMR_RTM : 0U;
+    HW_ETHER_ModeSet(p_etherc_reg, mode);
+
+    /** Enable the EINT interrupt in the NVIC. The control block is stored so the ISR can find it. */
+    if (SSP_INVALID_VECTOR != p_ctrl->irq)
+    {
+        ssp_vector_info_t * p_vector_info;
+        R_SSP_VectorInfoGet(p_ctrl->irq, &p_vector_info);
+        NVIC_SetPriority(p_ctrl->irq, p_cfg->irq_ipl);
+        *(p_vector_info->pp_ctrl) = p_ctrl;
+        R_BSP_IrqStatusClear(p_ctrl->irq);
+        NVIC_ClearPendingIRQ(p_ctrl->irq);
+        NVIC_EnableIRQ(p_ctrl->irq);
+    }
+
+    p_ctrl->open = ETHER_OPEN;
+
+    HW_ETHER_InterruptEnableSet(p_edmac_reg, r_ether_interrupt_mask(p_ctrl));
+    HW_ETHER_ReceiveSet(p_edmac_reg, true);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Stop the Ethernet MAC and return the buffers held by the descriptor rings to the pool.
+ *
+ *  Implements ether_api_t::close
+ *
+ * @retval SSP_SUCCESS             Ethernet MAC closed.
+ * @retval SSP_ERR_ASSERTION       p_ctrl is NULL.
+ * @retval SSP_ERR_NOT_OPEN        The driver is not opened.
+ **********************************************************************************************************************/
+ssp_err_t R_ETHER_Close (ether_ctrl_t * const p_api_ctrl)
+{
+    ether_instance_ctrl_t * p_ctrl = (ether_instance_ctrl_t *) p_api_ctrl;
+
+#if ETHER_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+#endif
+    ETHER_ERROR_RETURN(ETHER_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+
+    R_EDMAC0_Type * p_edmac_reg = (R_EDMAC0_Type *) p_ctrl->p_edmac_reg;
+
+    /** Disable the interrupt and clear the control block from the vector information array. */
+    if (SSP_INVALID_VECTOR != p_ctrl->irq)
+    {
+        ssp_vector_info_t * p_vector_info;
+        NVIC_DisableIRQ(p_ctrl->irq);
+        R_SSP_VectorInfoGet(p_ctrl->irq, &p_vector_info);
+        *(p_vector_info->pp_ctrl) = NULL;
+    }
+
+    /** Stop the MAC and the EDMAC before the rings are taken back. */
+    HW_ETHER_InterruptEnableSet(p_edmac_reg, 0U);
+    HW_ETHER_ModeSet((R_ETHERC0_Type *) p_ctrl->p_etherc_reg, 0U);
+    HW_ETHER_ReceiveSet(p_edmac_reg, false);
+    HW_ETHER_SoftwareReset(p_edmac_reg);
+    R_BSP_SoftwareDelay(ETHER_PRV_RESET_DELAY_US, BSP_DELAY_UNITS_MICROSECONDS);
+
+    r_ether_rings_release(p_ctrl);
+
+    p_ctrl->open = 0U;
+
+    ssp_feature_t ssp_feature = {{(ssp_ip_t) 0U}};
+    ssp_feature.channel = p_ctrl->channel;
+    ssp_feature.unit    = 0U;
+    ssp_feature.id      = SSP_IP_EDMAC;
+    R_BSP_ModuleStop(&ssp_feature);
+    R_BSP_HardwareUnlock(&ssp_feature);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Take the next received frame without copying it.
+ *
+ *  Implements ether_api_t::read
+ *
+ * The buffer the EDMAC wrote the frame to is returned to the caller with a reference count of 1 and the descriptor is
+ * refilled from the pool. Frames the MAC flagged as erroneous are dropped and their buffers reused in place. When the
+ * ring is empty in interrupt mode, the receive interrupt is enabled again so the next burst is reported with one
+ * callback. Transmit descriptors that completed are reclaimed first.
+ *
+ * SSP_ERR_INSUFFICIENT_DATA and SSP_ERR_OUT_OF_MEMORY are flow control results and are not reported to the error log.
+ *
+ * @retval SSP_SUCCESS                 A frame was returned in *pp_buffer.
+ * @retval SSP_ERR_ASSERTION           p_ctrl or pp_buffer is NULL.
+ * @retval SSP_ERR_NOT_OPEN            The driver is not opened.
+ * @retval SSP_ERR_INSUFFICIENT_DATA   The receive ring is empty.
+ * @retval SSP_ERR_OUT_OF_MEMORY       No buffer is free to refill the descriptor. The frame stays in the ring; release
+ *                                     buffers and read again.
+ **********************************************************************************************************************/
+ssp_err_t R_ETHER_Read (ether_ctrl_t * const p_api_ctrl, ether_buffer_t ** const pp_buffer)
+{
+    ether_instance_ctrl_t * p_ctrl = (ether_instance_ctrl_t *) p_api_ctrl;
+
+#if ETHER_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+    SSP_ASSERT(NULL != pp_buffer);
+#endif
+    ETHER_ERROR_RETURN(ETHER_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+
+    (void) r_ether_tx_reclaim(p_ctrl);
+
+    while (true)
+    {
+        ether_descriptor_t * p_desc = &p_ctrl->p_rx_descriptors[p_ctrl->rx_head];
+        uint32_t             status = p_desc->status;
+
+        if (0U != (status & ETHER_PRV_DESC_ACT))
+        {
+            /** The ring is drained. Clear the frame received flag and enable the interrupt for the next burst, then
+             * check again for a frame that arrived in between. */
+            if ((ETHER_RX_MODE_INTERRUPT == p_ctrl->rx_mode) && (!p_ctrl->rx_armed))
+            {
+                HW_ETHER_StatusClear((R_EDMAC0_Type *) p_ctrl->p_edmac_reg, ETHER_PRV_EESR_FR);
+                r_ether_rx_arm(p_ctrl, true);
+                if (0U == (p_desc->status & ETHER_PRV_DESC_ACT))
+                {
+                    continue;
+                }
+            }
+
+            return SSP_ERR_INSUFFICIENT_DATA;
+        }
+
+        uint32_t last = (p_ctrl->rx_head == (p_ctrl->num_rx_descriptors - 1U)) ? ETHER_PRV_DESC_DLE : 0U;
+
+        /** Drop frames with errors and frames that do not fit one buffer. The buffer stays in the descriptor. */
+        if ((0U != (status & ETHER_PRV_DESC_FE)) || (ETHER_PRV_DESC_FP_WHOLE != (status & ETHER_PRV_DESC_FP_WHOLE)))
+        {
+            p_ctrl->stats.rx_errors++;
+            p_desc->size   = 0U;
+            p_desc->status = ETHER_PRV_DESC_ACT | last;
+            r_ether_rx_advance(p_ctrl);
+            continue;
+        }
+
+        ether_buffer_t * p_refill = r_ether_buffer_get(p_ctrl);
+        if (NULL == p_refill)
+        {
+            p_ctrl->stats.rx_no_buffer++;
+
+            return SSP_ERR_OUT_OF_MEMORY;
+        }
+
+        /** Hand the filled buffer to the caller and give the descriptor back to the EDMAC with the new one. */
+        ether_buffer_t * p_buffer = ETHER_PRV_BUFFER_FROM_DATA(p_desc->buffer);
+        p_buffer->length = p_desc->size;
+
+        p_desc->buffer = (uint32_t) p_refill->p_data;
+        p_desc->size   = 0U;
+        p_desc->status = ETHER_PRV_DESC_ACT | last;
+        r_ether_rx_advance(p_ctrl);
+
+        p_ctrl->stats.rx_frames++;
+        *pp_buffer = p_buffer;
+
+        return SSP_SUCCESS;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Queue a frame for transmission without copying it.
+ *
+ *  Implements ether_api_t::write
+ *
+ * The driver adds a reference to the buffer and releases it when the EDMAC has sent the frame, so the caller may
+ * release its own reference immediately. Frames shorter than the Ethernet minimum are padded with zeros in the buffer.
+ * Transmit descriptors that completed are reclaimed before a free descriptor is looked for.
+ *
+ * SSP_ERR_INSUFFICIENT_SPACE is a flow control result and is not reported to the error log.
+ *
+ * @retval SSP_SUCCESS                 Frame queued.
+ * @retval SSP_ERR_ASSERTION           p_ctrl or p_buffer is NULL, or the buffer has no references.
+ * @retval SSP_ERR_INVALID_SIZE        The frame is empty or longer than a maximum-size frame.
+ * @retval SSP_ERR_NOT_OPEN            The driver is not opened.
+ * @retval SSP_ERR_INSUFFICIENT_SPACE  The transmit ring is full.
+ **********************************************************************************************************************/
+ssp_err_t R_ETHER_Write (ether_ctrl_t * const p_api_ctrl, ether_buffer_t * const p_buffer)
+{
+    ether_instance_ctrl_t * p_ctrl = (ether_instance_ctrl_t *) p_api_ctrl;
+
+#if ETHER_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+    SSP_ASSERT(NULL != p_buffer);
+    SSP_ASSERT(0U != p_buffer->ref_count);
+    ETHER_ERROR_RETURN((0U != p_buffer->length) && (p_buffer->length <= ETHER_PRV_FRAME_MAX), SSP_ERR_INVALID_SIZE);
+#endif
+    ETHER_ERROR_RETURN(ETHER_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+
+    (void) r_ether_tx_reclaim(p_ctrl);
+
+    if (p_ctrl->tx_count >= p_ctrl->num_tx_descriptors)
+    {
+        p_ctrl->stats.tx_ring_full++;
+
+        return SSP_ERR_INSUFFICIENT_SPACE;
+    }
+
+    uint32_t length = p_buffer->length;
+    if (length < ETHER_PRV_FRAME_MIN)
+    {
+        memset(&p_buffer->p_data[length], 0, ETHER_PRV_FRAME_MIN - length);
+        length = ETHER_PRV_FRAME_MIN;
+    }
+
+    (void) bsp_atomic_add(&p_buffer->ref_count, 1U);
+
+    /** Fill the descriptor and give it to the EDMAC. The whole frame is in one buffer. */
+    ether_descriptor_t * p_desc = &p_ctrl->p_tx_descriptors[p_ctrl->tx_head];
+    uint32_t             last   = (p_ctrl->tx_head == (p_ctrl->num_tx_descriptors - 1U)) ? ETHER_PRV_DESC_DLE : 0U;
+    p_desc->buffer      = (uint32_t) p_buffer->p_data;
+    p_desc->buffer_size = (uint16_t) length;
+    p_desc->size        = 0U;
+    p_desc->status      = ETHER_PRV_DESC_ACT | ETHER_PRV_DESC_FP_WHOLE | last;
+
+    p_ctrl->tx_head = (0U != last) ? 0U : (p_ctrl->tx_head + 1U);
+
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    p_ctrl->tx_count++;
+    SSP_CRITICAL_SECTION_EXIT;
+
+    HW_ETHER_TransmitStart((R_EDMAC0_Type *) p_ctrl->p_edmac_reg);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Allocate a packet buffer from the pool.
+ *
+ *  Implements ether_api_t::bufferAlloc
+ *
+ * The buffer is returned with a reference count of 1, a length of 0 and ETHER_BUFFER_DATA_SIZE bytes of data space.
+ * This function may be called from an interrupt.
+ *
+ * @retval SSP_SUCCESS             Buffer allocated.
+ * @retval SSP_ERR_ASSERTION       p_ctrl or pp_buffer is NULL.
+ * @retval SSP_ERR_NOT_OPEN        The driver is not opened.
+ * @retval SSP_ERR_OUT_OF_MEMORY   All packet buffers are in use.
+ **********************************************************************************************************************/
+ssp_err_t R_ETHER_BufferAlloc (ether_ctrl_t * const p_api_ctrl, ether_buffer_t ** const pp_buffer)
+{
+    ether_instance_ctrl_t * p_ctrl = (ether_instance_ctrl_t *) p_api_ctrl;
+
+#if ETHER_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+    SSP_ASSERT(NULL != pp_buffer);
+#endif
+    ETHER_ERROR_RETURN(ETHER_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+
+    ether_buffer_t * p_buffer = r_ether_buffer_get(p_ctrl);
+    ETHER_ERROR_RETURN(NULL != p_buffer, SSP_ERR_OUT_OF_MEMORY);
+
+    *pp_buffer = p_buffer;
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Add a reference to a packet buffer, for example before passing a received frame to a second consumer.
+ *
+ *  Implements ether_api_t::bufferRetain
+ *
+ * @retval SSP_SUCCESS             Reference added.
+ * @retval SSP_ERR_ASSERTION       p_ctrl or p_buffer is NULL, or the buffer has no references.
+ * @retval SSP_ERR_NOT_OPEN        The driver is not opened.
+ **********************************************************************************************************************/
+ssp_err_t R_ETHER_BufferRetain (ether_ctrl_t * const p_api_ctrl, ether_buffer_t * const p_buffer)
+{
+    ether_instance_ctrl_t * p_ctrl = (ether_instance_ctrl_t *) p_api_ctrl;
+
+#if ETHER_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+    SSP_ASSERT(NULL != p_buffer);
+    SSP_ASSERT(0U != p_buffer->ref_count);
+#endif
+    ETHER_ERROR_RETURN(ETHER_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+
+    (void) bsp_atomic_add(&p_buffer->ref_count, 1U);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Drop a reference to a packet buffer. The last reference returns the buffer to the pool.
+ *
+ *  Implements ether_api_t::bufferRelease
+ *
+ * This function may be called from an interrupt.
+ *
+ * @retval SSP_SUCCESS             Reference dropped.
+ * @retval SSP_ERR_ASSERTION       p_ctrl or p_buffer is NULL, or the buffer has no references.
+ * @retval SSP_ERR_NOT_OPEN        The driver is not opened.
+ **********************************************************************************************************************/
+ssp_err_t R_ETHER_BufferRelease (ether_ctrl_t * const p_api_ctrl, ether_buffer_t * const p_buffer)
+{
+    ether_instance_ctrl_t * p_ctrl = (ether_instance_ctrl_t *) p_api_ctrl;
+
+#if ETHER_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+    SSP_ASSERT(NULL != p_buffer);
+    SSP_ASSERT(0U != p_buffer->ref_count);
+#endif
+    ETHER_ERROR_RETURN(ETHER_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+
+    r_ether_buffer_put(p_ctrl, p_buffer);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Switch between interrupt driven and polled reception.
+ *
+ *  Implements ether_api_t::rxModeSet
+ *
+ * In polling mode the EINT interrupt is not used: the caller reads the ring on its own schedule and transmit buffers
+ * are reclaimed by ether_api_t::read and ether_api_t::write. Switching back to interrupt mode with frames already in
+ * the ring reports them with one ETHER_EVENT_RX_COMPLETE callback.
+ *
+ * @retval SSP_SUCCESS             Mode changed.
+ * @retval SSP_ERR_ASSERTION       p_ctrl is NULL or mode is invalid.
+ * @retval SSP_ERR_NOT_OPEN        The driver is not opened.
+ **********************************************************************************************************************/
+ssp_err_t R_ETHER_RxModeSet (ether_ctrl_t * const p_api_ctrl, ether_rx_mode_t mode)
+{
+    ether_instance_ctrl_t * p_ctrl = (ether_instance_ctrl_t *) p_api_ctrl;
+
+#if ETHER_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+    SSP_ASSERT((ETHER_RX_MODE_INTERRUPT == mode) || (ETHER_RX_MODE_POLLING == mode));
+#endif
+    ETHER_ERROR_RETURN(ETHER_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+
+    p_ctrl->rx_mode = mode;
+    r_ether_rx_arm(p_ctrl, (ETHER_RX_MODE_INTERRUPT == mode));
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Set the link speed and duplex mode, normally after the PHY completes auto-negotiation.
+ *
+ *  Implements ether_api_t::linkSet
+ *
+ * @retval SSP_SUCCESS             Link settings changed.
+ * @retval SSP_ERR_ASSERTION       p_ctrl is NULL, or speed or duplex is invalid.
+ * @retval SSP_ERR_NOT_OPEN        The driver is not opened.
+ **********************************************************************************************************************/
+ssp_err_t R_ETHER_LinkSet (ether_ctrl_t * const p_api_ctrl, ether_link_speed_t speed, ether_link_duplex_t duplex)
+{
+    ether_instance_ctrl_t * p_ctrl = (ether_instance_ctrl_t *) p_api_ctrl;
+
+#if ETHER_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+    SSP_ASSERT((ETHER_LINK_SPEED_10M == speed) || (ETHER_LINK_SPEED_100M == speed));
+    SSP_ASSERT((ETHER_LINK_DUPLEX_HALF == duplex) || (ETHER_LINK_DUPLEX_FULL == duplex));
+#endif
+    ETHER_ERROR_RETURN(ETHER_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+
+    R_ETHERC0_Type * p_etherc_reg = (R_ETHERC0_Type *) p_ctrl->p_etherc_reg;
+    uint32_t mode = HW_ETHER_ModeGet(p_etherc_reg) & ~(ETHER_PRV_ECMR_DM | ETHER_PRV_ECMR_RTM);
+    mode |= (ETHER_LINK_DUPLEX_FULL == duplex) ? ETHER_PRV_ECMR_DM : 0U;
+    mode |= (ETHER_LINK_SPEED_100M == speed) ? ETHER_PRV_ECMR_RTM : 0U;
+    HW_ETHER_ModeSet(p_etherc_reg, mode);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Get driver and packet buffer statistics.
+ *
+ *  Implements ether_api_t::statsGet
+ *
+ * The EDMAC missed-frame counter is added to ether_stats_t::rx_missed and cleared.
+ *
+ * @retval SSP_SUCCESS             Statistics returned.
+ * @retval SSP_ERR_ASSERTION       p_ctrl or p_stats is NULL.
+ * @retval SSP_ERR_NOT_OPEN        The driver is not opened.
+ **********************************************************************************************************************/
+ssp_err_t R_ETHER_StatsGet (ether_ctrl_t * const p_api_ctrl, ether_stats_t * const p_stats)
+{
+    ether_instance_ctrl_t * p_ctrl = (ether_instance_ctrl_t *) p_api_ctrl;
+
+#if ETHER_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+    SSP_ASSERT(NULL != p_stats);
+#endif
+    ETHER_ERROR_RETURN(ETHER_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+
+    p_ctrl->stats.rx_missed += HW_ETHER_MissedFramesGet((R_EDMAC0_Type *) p_ctrl->p_edmac_reg);
+
+    bsp_pool_stats_t pool_stats;
+    (void) R_BSP_PoolStatsGet(&p_ctrl->pool, 0U, &pool_stats);
+    p_ctrl->stats.buffers_used     = pool_stats.blocks_used;
+    p_ctrl->stats.buffers_used_max = pool_stats.blocks_used_max;
+
+    *p_stats = p_ctrl->stats;
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief      Get the driver version based on compile time macros.
+ *
+ *   Implements ether_api_t::versionGet
+ *
+ * @retval     SSP_SUCCESS          Version returned.
+ * @retval     SSP_ERR_ASSERTION    p_version is NULL.
+ **********************************************************************************************************************/
+ssp_err_t R_ETHER_VersionGet (ssp_version_t * const p_version)
+{
+#if ETHER_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_version);
+#endif
+
+    p_version->version_id = g_ether_version.version_id;
+
+    return SSP_SUCCESS;
+}
+/******************************************************************************************************************//**
+ * @} (end defgroup ETHER)
+**********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+#if ETHER_CFG_PARAM_CHECKING_ENABLE
+/*******************************************************************************************************************//**
+ * @brief  Check the open parameters.
+ * @param[in] p_ctrl        Control block
+ * @param[in] p_cfg         Configuration
+ * @retval SSP_SUCCESS                 Parameters are valid.
+ * @retval SSP_ERR_ASSERTION           A pointer is NULL or a ring size is invalid.
+ * @retval SSP_ERR_IN_USE              The control block is already open.
+ * @retval SSP_ERR_INVALID_ALIGNMENT   A descriptor ring or the packet buffer memory is not aligned.
+ **********************************************************************************************************************/
+static ssp_err_t r_ether_open_param_check (ether_instance_ctrl_t * const p_ctrl, ether_cfg_t const * const p_cfg)
+{
+    SSP_ASSERT(NULL != p_ctrl);
+    SSP_ASSERT(NULL != p_cfg);
+    SSP_ASSERT(NULL != p_cfg->p_mac_address);
+    SSP_ASSERT(NULL != p_cfg->p_rx_descriptors);
+    SSP_ASSERT(NULL != p_cfg->p_tx_descriptors);
+    SSP_ASSERT(NULL != p_cfg->p_buffer_memory);
+    SSP_ASSERT(0U != p_cfg->num_rx_descriptors);
+    SSP_ASSERT(0U != p_cfg->num_tx_descriptors);
+    SSP_ASSERT(p_cfg->num_buffers > p_cfg->num_rx_descriptors);
+    SSP_ASSERT((ETHER_RX_MODE_INTERRUPT == p_cfg->rx_mode) || (ETHER_RX_MODE_POLLING == p_cfg->rx_mode));
+    ETHER_ERROR_RETURN(ETHER_OPEN != p_ctrl->open, SSP_ERR_IN_USE);
+    ETHER_ERROR_RETURN(0U == ((uintptr_t) p_cfg->p_rx_descriptors % ETHER_DESCRIPTOR_ALIGNMENT),
+                       SSP_ERR_INVALID_ALIGNMENT);
+    ETHER_ERROR_RETURN(0U == ((uintptr_t) p_cfg->p_tx_descriptors % ETHER_DESCRIPTOR_ALIGNMENT),
+                       SSP_ERR_INVALID_ALIGNMENT);
+    ETHER_ERROR_RETURN(0U == ((uintptr_t) p_cfg->p_buffer_memory % ETHER_BUFFER_ALIGNMENT),
+                       SSP_ERR_INVALID_ALIGNMENT);
+
+    return SSP_SUCCESS;
+}
+#endif
+
+/*******************************************************************************************************************//**
+ * @brief  Give every receive descriptor a packet buffer owned by the EDMAC and clear the transmit ring. The pool has
+ *         more buffers than receive descriptors, so allocation cannot fail.
+ * @param[in] p_ctrl        Control block
+ **********************************************************************************************************************/
+static void r_ether_rings_init (ether_instance_ctrl_t * const p_ctrl)
+{
+    for (uint32_t i = 0U; i < p_ctrl->num_rx_descriptors; i++)
+    {
+        ether_buffer_t     * p_buffer = r_ether_buffer_get(p_ctrl);
+        ether_descriptor_t * p_desc   = &p_ctrl->p_rx_descriptors[i];
+        p_desc->buffer      = (uint32_t) p_buffer->p_data;
+        p_desc->buffer_size = (uint16_t) ETHER_BUFFER_DATA_SIZE;
+        p_desc->size        = 0U;
+        p_desc->reserved    = 0U;
+        p_desc->status      = ETHER_PRV_DESC_ACT;
+    }
+    p_ctrl->p_rx_descriptors[p_ctrl->num_rx_descriptors - 1U].status |= ETHER_PRV_DESC_DLE;
+
+    for (uint32_t i = 0U; i < p_ctrl->num_tx_descriptors; i++)
+    {
+        ether_descriptor_t * p_desc = &p_ctrl->p_tx_descriptors[i];
+        p_desc->buffer      = 0U;
+        p_desc->buffer_size = 0U;
+        p_desc->size        = 0U;
+        p_desc->reserved    = 0U;
+        p_desc->status      = 0U;
+    }
+    p_ctrl->p_tx_descriptors[p_ctrl->num_tx_descriptors - 1U].status = ETHER_PRV_DESC_DLE;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Return the buffers held by both rings to the pool. The EDMAC must be stopped.
+ * @param[in] p_ctrl        Control block
+ **********************************************************************************************************************/
+static void r_ether_rings_release (ether_instance_ctrl_t * const p_ctrl)
+{
+    for (uint32_t i = 0U; i < p_ctrl->num_rx_descriptors; i++)
+    {
+        ether_descriptor_t * p_desc = &p_ctrl->p_rx_descriptors[i];
+        r_ether_buffer_put(p_ctrl, ETHER_PRV_BUFFER_FROM_DATA(p_desc->buffer));
+        p_desc->buffer = 0U;
+        p_desc->status = 0U;
+    }
+
+    while (0U != p_ctrl->tx_count)
+    {
+        ether_descriptor_t * p_desc = &p_ctrl->p_tx_descriptors[p_ctrl->tx_tail];
+        r_ether_buffer_put(p_ctrl, ETHER_PRV_BUFFER_FROM_DATA(p_desc->buffer));
+        p_desc->buffer  = 0U;
+        p_desc->status &= ETHER_PRV_DESC_DLE;
+        p_ctrl->tx_tail = (p_ctrl->tx_tail + 1U < p_ctrl->num_tx_descriptors) ? (p_ctrl->tx_tail + 1U) : 0U;
+        p_ctrl->tx_count--;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Move to the next receive descriptor. The EDMAC stops receiving when it reaches a descriptor it does not own;
+ *         a descriptor was just given back, so reception is restarted if it had stopped.
+ * @param[in] p_ctrl        Control block
+ **********************************************************************************************************************/
+static void r_ether_rx_advance (ether_instance_ctrl_t * const p_ctrl)
+{
+    R_EDMAC0_Type * p_edmac_reg = (R_EDMAC0_Type *) p_ctrl->p_edmac_reg;
+
+    p_ctrl->rx_head = (p_ctrl->rx_head + 1U < p_ctrl->num_rx_descriptors) ? (p_ctrl->rx_head + 1U) : 0U;
+
+    if (!HW_ETHER_ReceiveIsRunning(p_edmac_reg))
+    {
+        HW_ETHER_ReceiveSet(p_edmac_reg, true);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Release the buffers of transmit descriptors the EDMAC has finished with. Called from thread context and
+ *         from the interrupt, so the ring is updated with interrupts masked.
+ * @param[in] p_ctrl        Control block
+ * @return Number of descriptors reclaimed.
+ **********************************************************************************************************************/
+static uint32_t r_ether_tx_reclaim (ether_instance_ctrl_t * const p_ctrl)
+{
+    uint32_t reclaimed = 0U;
+
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    while (0U != p_ctrl->tx_count)
+    {
+        ether_descriptor_t * p_desc = &p_ctrl->p_tx_descriptors[p_ctrl->tx_tail];
+        if (0U != (p_desc->status & ETHER_PRV_DESC_ACT))
+        {
+            break;
+        }
+
+        r_ether_buffer_put(p_ctrl, ETHER_PRV_BUFFER_FROM_DATA(p_desc->buffer));
+        p_desc->buffer  = 0U;
+        p_ctrl->tx_tail = (p_ctrl->tx_tail + 1U < p_ctrl->num_tx_descriptors) ? (p_ctrl->tx_tail + 1U) : 0U;
+        p_ctrl->tx_count--;
+        p_ctrl->stats.tx_frames++;
+        reclaimed++;
+    }
+    SSP_CRITICAL_SECTION_EXIT;
+
+    return reclaimed;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Allocate a packet buffer and initialize its header.
+ * @param[in] p_ctrl        Control block
+ * @return Buffer with a reference count of 1, or NULL if the pool is empty.
+ **********************************************************************************************************************/
+static ether_buffer_t * r_ether_buffer_get (ether_instance_ctrl_t * const p_ctrl)
+{
+    void * p_block = NULL;
+
+    if (SSP_SUCCESS != R_BSP_PoolAlloc(&p_ctrl->pool, ETHER_BUFFER_BLOCK_SIZE, &p_block))
+    {
+        return NULL;
+    }
+
+    ether_buffer_t * p_buffer = (ether_buffer_t *) p_block;
+    p_buffer->p_data    = (uint8_t *) p_block + ETHER_BUFFER_HEADER_SIZE;
+    p_buffer->length    = 0U;
+    p_buffer->capacity  = (uint16_t) ETHER_BUFFER_DATA_SIZE;
+    p_buffer->ref_count = 1U;
+    p_buffer->p_next    = NULL;
+
+    return p_buffer;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Drop a reference to a packet buffer and return it to the pool when none remain.
+ * @param[in] p_ctrl        Control block
+ * @param[in] p_buffer      Buffer to release
+ **********************************************************************************************************************/
+static void r_ether_buffer_put (ether_instance_ctrl_t * const p_ctrl, ether_buffer_t * const p_buffer)
+{
+    if (0U == bsp_atomic_add(&p_buffer->ref_count, 0xFFFFFFFFU))
+    {
+        (void) R_BSP_PoolFree(&p_ctrl->pool, p_buffer);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Status flags that should request the EINT interrupt. Interrupts are only used in interrupt mode with a
+ *         callback; the frame received interrupt is enabled while the driver waits for the next burst.
+ * @param[in] p_ctrl        Control block
+ * @return EESIPR value.
+ **********************************************************************************************************************/
+static uint32_t r_ether_interrupt_mask (ether_instance_ctrl_t * const p_ctrl)
+{
+    if ((ETHER_RX_MODE_INTERRUPT != p_ctrl->rx_mode) || (NULL == p_ctrl->p_callback))
+    {
+        return 0U;
+    }
+
+    uint32_t mask = ETHER_PRV_EESR_ERRORS | ETHER_PRV_EESR_TC;
+    if (p_ctrl->rx_armed)
+    {
+        mask |= ETHER_PRV_EESR_FR;
+    }
+
+    return mask;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Enable or disable the frame received interrupt. The interrupt also changes EESIPR, so it is masked while the
+ *         register is updated.
+ * @param[in] p_ctrl        Control block
+ * @param[in] armed         true to report the next received frame
+ **********************************************************************************************************************/
+static void r_ether_rx_arm (ether_instance_ctrl_t * const p_ctrl, bool armed)
+{
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    p_ctrl->rx_armed = armed;
+    HW_ETHER_InterruptEnableSet((R_EDMAC0_Type *) p_ctrl->p_edmac_reg, r_ether_interrupt_mask(p_ctrl));
+    SSP_CRITICAL_SECTION_EXIT;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Service the enabled EDMAC status flags.
+ *
+ * A received frame disables the frame received interrupt until ether_api_t::read drains the ring, so a burst of frames
+ * costs one interrupt and one callback. Completed transmit descriptors are reclaimed before the callback.
+ *
+ * @param[in] p_ctrl        Control block
+ **********************************************************************************************************************/
+static void r_ether_irq_process (ether_instance_ctrl_t * const p_ctrl)
+{
+    R_EDMAC0_Type * p_edmac_reg = (R_EDMAC0_Type *) p_ctrl->p_edmac_reg;
+    uint32_t        status      = HW_ETHER_StatusGet(p_edmac_reg) & HW_ETHER_InterruptEnableGet(p_edmac_reg);
+
+    HW_ETHER_StatusClear(p_edmac_reg, status);
+
+    ether_callback_args_t args;
+    args.channel   = p_ctrl->channel;
+    args.status    = 0U;
+    args.p_context = p_ctrl->p_context;
+
+    if (0U != (status & ETHER_PRV_EESR_FR))
+    {
+        p_ctrl->rx_armed = false;
+        HW_ETHER_InterruptEnableSet(p_edmac_reg, r_ether_interrupt_mask(p_ctrl));
+        p_ctrl->stats.rx_interrupts++;
+
+        args.event = ETHER_EVENT_RX_COMPLETE;
+        r_ether_callback_call(p_ctrl, &args);
+    }
+
+    if (0U != (status & ETHER_PRV_EESR_TC))
+    {
+        (void) r_ether_tx_reclaim(p_ctrl);
+
+        args.event = ETHER_EVENT_TX_COMPLETE;
+        r_ether_callback_call(p_ctrl, &args);
+    }
+
+    if (0U != (status & ETHER_PRV_EESR_ERRORS))
+    {
+        args.event  = ETHER_EVENT_ERROR;
+        args.status = status & ETHER_PRV_EESR_ERRORS;
+        r_ether_callback_call(p_ctrl, &args);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @brief Call the user callback, or post it to the BSP deferred work scheduler if deferred callbacks are configured.
+ *        If no work slot is free, the deferred callback is dropped and counted by the scheduler.
+ * @param[in] p_ctrl        ETHER instance control block
+ * @param[in] p_args        Callback arguments, copied if the callback is deferred
+ **********************************************************************************************************************/
+static void r_ether_callback_call (ether_instance_ctrl_t * p_ctrl, ether_callback_args_t * p_args)
+{
+    (void) R_BSP_WorkPostOrCall(p_ctrl->deferred_callback, r_ether_callback_work, p_ctrl, p_args,
+                                sizeof(ether_callback_args_t), p_ctrl->deferred_callback_priority);
+}
+
+/*******************************************************************************************************************//**
+ * @brief Run the user callback, unless the channel was closed after the callback was posted.
+ * @param[in] p_context     ETHER instance control block
+ * @param[in] p_args        Copy of the callback arguments
+ **********************************************************************************************************************/
+static void r_ether_callback_work (void * p_context, void * p_args)
+{
+    ether_instance_ctrl_t * p_ctrl = (ether_instance_ctrl_t *) p_context;
+
+    if ((ETHER_OPEN == p_ctrl->open) && (NULL != p_ctrl->p_callback))
+    {
+        p_ctrl->p_callback((ether_callback_args_t *) p_args);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * EDMAC EINT ISR.
+ *
+ * Saves context if RTOS is used, services the EDMAC status flags, clears the interrupt and restores context if RTOS is
+ * used.
+ **********************************************************************************************************************/
+void edmac_eint_isr (void)
+{
+    /* Save context if RTOS is used */
+    SF_CONTEXT_SAVE
+
+    ssp_vector_info_t * p_vector_info = NULL;
+    R_SSP_VectorInfoGet(R_SSP_CurrentIrqGet(), &p_vector_info);
+    ether_instance_ctrl_t * p_ctrl = (ether_instance_ctrl_t *) *(p_vector_info->pp_ctrl);
+
+    if (NULL != p_ctrl)
+    {
+        r_ether_irq_process(p_ctrl);
+    }
+
+    /* Clear the IR flag in the ICU */
+    /* Clearing the IR bit must be done after clearing the interrupt source in the the peripheral */
+    R_BSP_IrqStatusClear(R_SSP_CurrentIrqGet());
+
+    /* Restore context if RTOS is used */
+    SF_CONTEXT_RESTORE
+}
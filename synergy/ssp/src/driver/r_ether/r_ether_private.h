@@ -0,0 +1,43 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : r_ether_private.h
+ * Description  : ETHER
+ **********************************************************************************************************************/
+
+
+#ifndef R_ETHER_PRIVATE_H
+#define R_ETHER_PRIVATE_H
+
+#include "hw/hw_ether_private.h"
+
+/** Descriptor status bits shared by transmit and receive descriptors. */
+#define ETHER_PRV_DESC_ACT              (1UL << 31)     ///< Descriptor owned by the EDMAC
+#define ETHER_PRV_DESC_DLE              (1UL << 30)     ///< Last descriptor of the ring
+#define ETHER_PRV_DESC_FP1              (1UL << 29)     ///< Descriptor holds the start of a frame
+#define ETHER_PRV_DESC_FP0              (1UL << 28)     ///< Descriptor holds the end of a frame
+#define ETHER_PRV_DESC_FE               (1UL << 27)     ///< Frame error, details in the low status bits
+#define ETHER_PRV_DESC_FP_WHOLE         (ETHER_PRV_DESC_FP1 | ETHER_PRV_DESC_FP0)
+
+/** Longest frame accepted without the FCS, and shortest frame sent without padding. */
+#define ETHER_PRV_FRAME_MAX             (1518U)
+#define ETHER_PRV_FRAME_MIN             (60U)
+
+#endif /* R_ETHER_PRIVATE_H */
@@ -0,0 +1,44 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+#ifndef R_ETHER_R_ETHER_PRIVATE_API_H_
+#define R_ETHER_R_ETHER_PRIVATE_API_H_
+
+/* Common macro for SSP header files. There is also a corresponding SSP_FOOTER macro at the end of this file. */
+SSP_HEADER
+
+/***********************************************************************************************************************
+ * Private Instance API Functions. DO NOT USE! Use functions through Interface API structure instead.
+ **********************************************************************************************************************/
+ssp_err_t R_ETHER_Open (ether_ctrl_t * const p_api_ctrl, ether_cfg_t const * const p_cfg);
+ssp_err_t R_ETHER_Close (ether_ctrl_t * const p_api_ctrl);
+ssp_err_t R_ETHER_Read (ether_ctrl_t * const p_api_ctrl, ether_buffer_t ** const pp_buffer);
+ssp_err_t R_ETHER_Write (ether_ctrl_t * const p_api_ctrl, ether_buffer_t * const p_buffer);
+ssp_err_t R_ETHER_BufferAlloc (ether_ctrl_t * const p_api_ctrl, ether_buffer_t ** const pp_buffer);
+ssp_err_t R_ETHER_BufferRetain (ether_ctrl_t * const p_api_ctrl, ether_buffer_t * const p_buffer);
+ssp_err_t R_ETHER_BufferRelease (ether_ctrl_t * const p_api_ctrl, ether_buffer_t * const p_buffer);
+ssp_err_t R_ETHER_RxModeSet (ether_ctrl_t * const p_api_ctrl, ether_rx_mode_t mode);
+ssp_err_t R_ETHER_LinkSet (ether_ctrl_t * const p_api_ctrl, ether_link_speed_t speed, ether_link_duplex_t duplex);
+ssp_err_t R_ETHER_StatsGet (ether_ctrl_t * const p_api_ctrl, ether_stats_t * const p_stats);
+ssp_err_t R_ETHER_VersionGet (ssp_version_t * const p_version);
+
+/* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
+SSP_FOOTER
+
+#endif /* R_ETHER_R_ETHER_PRIVATE_API_H_ */
@@ -94,10 +94,10 @@ static void r_glcd_sync_signal_set (R_GLCDC_Type * p_glcd_reg, display_cfg_t con
 
 static void r_glcd_background_screen_set (R_GLCDC_Type * p_glcd_reg, display_cfg_t const * const p_cfg);
 
-static void r_glcd_graphics_layer_set (R_GLCDC_Type * p_glcd_reg,
-                                      display_input_cfg_t const * const p_input,
-                                      display_layer_t const * const     p_layer,
-                                      display_frame_layer_t const       frame);
+static uint32_t r_glcd_graphics_layer_set (R_GLCDC_Type * p_glcd_reg,
+                                          display_input_cfg_t const * const p_input,
+                                          display_layer_t const * const     p_layer,
+                                          display_frame_layer_t const       frame);
 
 static void r_glcd_output_block_set (R_GLCDC_Type * p_glcd_reg, display_cfg_t const * const p_cfg);
 
@@ -140,6 +140,12 @@ static void r_glcd_pixel_size_recalculate(display_input_cfg_t const * const p_in
                                                     recalculated_param_t              * p_recalculated,
                                                     uint16_t                          * bit_size);
 
+static void r_glcd_flip_vsync (glcd_instance_ctrl_t * const p_ctrl, display_frame_layer_t const frame);
+
+static bool r_glcd_flip_is_registered (glcd_flip_t const * const p_flip, void const * const p_buffer);
+
+static bool r_glcd_flip_is_busy (glcd_flip_t const * const p_flip, void const * const p_buffer);
+
 /***********************************************************************************************************************
  * Private global variables
  **********************************************************************************************************************/
@@ -172,15 +178,18 @@ static const ssp_version_t module_version =
 /*LDRA_INSPECTED 27 D This structure must be accessible in user code. It cannot be static. */
 const display_api_t g_display_on_glcd =
 {
-    .open        = R_GLCD_Open,
-    .close       = R_GLCD_Close,
-    .start       = R_GLCD_Start,
-    .stop        = R_GLCD_Stop,
-    .layerChange = R_GLCD_LayerChange,
-    .clut        = R_GLCD_ClutUpdate,
-    .correction  = R_GLCD_ColorCorrection,
-    .statusGet   = R_GLCD_StatusGet,
-    .versionGet  = R_GLCD_VersionGet
+    .open         = R_GLCD_Open,
+    .close        = R_GLCD_Close,
+    .start        = R_GLCD_Start,
+    .stop         = R_GLCD_Stop,
+    .layerChange  = R_GLCD_LayerChange,
+    .clut         = R_GLCD_ClutUpdate,
+    .correction   = R_GLCD_ColorCorrection,
+    .statusGet    = R_GLCD_StatusGet,
+    .versionGet   = R_GLCD_VersionGet,
+    .buffersSet   = R_GLCD_BuffersSet,
+    .present      = R_GLCD_Present,
+    .flipStatsGet = R_GLCD_FlipStatsGet
 };
 
 /** Default setting of GLCD specific configuration */
@@ -343,10 +352,19 @@ ssp_err_t R_GLCD_Open (display_ctrl_t * const p_api_ctrl, display_cfg_t const *
     ctrl_blk.hsize        = p_cfg->output.htiming.display_cyc;
     ctrl_blk.vsize        = p_cfg->output.vtiming.display_cyc;
 
-    /** Configure the graphics plane layers */
+    /** Configure the graphics plane layers. No frame buffers are registered for page flipping yet. */
     for (uint32_t frame = 0U; frame <= DISPLAY_FRAME_LAYER_2; frame++)
     {
-        r_glcd_graphics_layer_set(p_glcd_reg, &(p_cfg->input[frame]), &(p_cfg->layer[frame]), (display_frame_layer_t) frame);
+        glcd_flip_t * p_flip = &p_ctrl->flip[frame];
+        p_flip->base_offset = r_glcd_graphics_layer_set(p_glcd_reg, &(p_cfg->input[frame]), &(p_cfg->layer[frame]),
+                                                        (display_frame_layer_t) frame);
+        p_flip->num_buffers       = 0U;
+        p_flip->head              = 0U;
+        p_flip->count             = 0U;
+        p_flip->p_displayed       = p_cfg->input[frame].p_base;
+        p_flip->p_latched         = NULL;
+        p_flip->vsyncs_since_flip = 0U;
+        p_flip->flip_time         = 0U;
     }
 
     /** Configure the output control block */
@@ -542,9 +560,11 @@ ssp_err_t R_GLCD_Stop (display_ctrl_t * const p_api_ctrl)
  * @retval  SSP_ERR_INVALID_ARGUMENT         An invalid parameter is found in the argument.
  * @retval  SSP_ERR_INVALID_UPDATE_TIMING    A function call is performed while the GLCD is updating register values
  *                                            internally.
+ * @retval  SSP_ERR_IN_USE                   A presented frame buffer is waiting to be flipped to on the layer.
  * @note    This API can be called when the driver is in DISPLAY_STATE_DISPLAYING state. It returns an error if
  *           the register update operation for the background screen generation blocks or the graphics data I/F block
- *           is being held.
+ *           is being held. When frame buffers are registered for the layer, the frame buffer scanned out before the
+ *           change is released to the callback after the next vsync, like a flip.
  **********************************************************************************************************************/
 ssp_err_t R_GLCD_LayerChange (display_ctrl_t const * const        p_api_ctrl,
                               display_runtime_cfg_t const * const p_cfg,
@@ -565,12 +585,39 @@ ssp_err_t R_GLCD_LayerChange (display_ctrl_t const * const        p_api_ctrl,
     GLCD_ERROR_RETURN(false == HW_GLCD_IsGRplaneUpdating(p_glcd_reg, frame), SSP_ERR_INVALID_UPDATE_TIMING);
     GLCD_ERROR_RETURN(false == HW_GLCD_IsInternalRegisterReflecting(p_glcd_reg), SSP_ERR_INVALID_UPDATE_TIMING);
 
-    /** Configure the graphics plane layers */
-    r_glcd_graphics_layer_set(p_glcd_reg, &p_cfg->input, &p_cfg->layer, frame);
+    /* The line detect interrupt must not latch a presented frame buffer while the layer is being changed. */
+    glcd_flip_t * p_flip = &p_ctrl->flip[frame];
+    ssp_err_t     err    = SSP_SUCCESS;
 
-    /** Reflect the graphics module register value to the GLCD internal operations (at the timing of the next Vsync
-     * assertion) */
-    HW_GLCD_GRplaneUpdateEnable(p_glcd_reg, frame);
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    if ((0U != p_flip->count) || (NULL != p_flip->p_latched))
+    {
+        err = SSP_ERR_IN_USE;
+    }
+    else
+    {
+        /** Configure the graphics plane layers */
+        p_flip->base_offset = r_glcd_graphics_layer_set(p_glcd_reg, &p_cfg->input, &p_cfg->layer, frame);
+
+        /** The new frame buffer replaces the scanned out one at the next vsync. Without registered frame buffers no
+         *  flips are tracked, and the new frame buffer is simply the scanned out one. */
+        if (0U == p_flip->num_buffers)
+        {
+            p_flip->p_displayed = p_cfg->input.p_base;
+        }
+        else
+        {
+            p_flip->p_latched = p_cfg->input.p_base;
+        }
+
+        /** Reflect the graphics module register value to the GLCD internal operations (at the timing of the next Vsync
+         * assertion) */
+        HW_GLCD_GRplaneUpdateEnable(p_glcd_reg, frame);
+    }
+    SSP_CRITICAL_SECTION_EXIT;
+
+    GLCD_ERROR_RETURN(SSP_SUCCESS == err, err);
 
     return SSP_SUCCESS;
 }  /* End of function R_GLCD_LayerChange() */
@@ -751,6 +798,155 @@ ssp_err_t R_GLCD_VersionGet (ssp_version_t * p_version)
     return SSP_SUCCESS;
 }  /* End of function R_GLCD_VersionGet() */
 
+/*******************************************************************************************************************//**
+ * @brief  Register the frame buffers a graphics layer flips between.
+ * @par    Implements
+ * - display_api_t::buffersSet.
+ *
+ * The frame buffers must have the format, size and stride of the layer configuration. The frame buffer currently
+ * scanned out does not have to be one of them, it is released to the callback after the first flip.
+ *
+ * @retval  SSP_SUCCESS                  Frame buffers registered.
+ * @retval  SSP_ERR_ASSERTION            Pointer to the control block is NULL, or pp_buffers or a frame buffer is NULL.
+ * @retval  SSP_ERR_NOT_OPEN             The driver is not open.
+ * @retval  SSP_ERR_INVALID_ARGUMENT     Invalid layer, or more than GLCD_FLIP_BUFFERS_MAX frame buffers.
+ * @retval  SSP_ERR_INVALID_ALIGNMENT    A frame buffer is not aligned to a 64-byte boundary.
+ * @retval  SSP_ERR_IN_USE               A presented frame buffer is waiting to be flipped to on the layer.
+ * @note    Registering resets the flip statistics of the layer.
+ **********************************************************************************************************************/
+ssp_err_t R_GLCD_BuffersSet (display_ctrl_t * const p_api_ctrl, display_frame_layer_t frame,
+                             void * const * const pp_buffers, uint32_t num_buffers)
+{
+    glcd_instance_ctrl_t * p_ctrl = (glcd_instance_ctrl_t *) p_api_ctrl;
+
+#if (GLCD_CFG_PARAM_CHECKING_ENABLE)
+    SSP_ASSERT(p_ctrl);
+    SSP_ASSERT((0U == num_buffers) || (NULL != pp_buffers));
+    GLCD_ERROR_RETURN(DISPLAY_STATE_CLOSED != p_ctrl->state, SSP_ERR_NOT_OPEN);
+    GLCD_ERROR_RETURN(DISPLAY_FRAME_LAYER_2 >= frame, SSP_ERR_INVALID_ARGUMENT);
+    GLCD_ERROR_RETURN(GLCD_FLIP_BUFFERS_MAX >= num_buffers, SSP_ERR_INVALID_ARGUMENT);
+    for (uint32_t i = 0U; i < num_buffers; i++)
+    {
+        SSP_ASSERT(pp_buffers[i]);
+        GLCD_ERROR_RETURN(0U == ((uint32_t) pp_buffers[i] % GLCD_ADDRESS_ALIGNMENT_64B), SSP_ERR_INVALID_ALIGNMENT);
+    }
+#endif
+
+    glcd_flip_t * p_flip = &p_ctrl->flip[frame];
+    ssp_err_t     err    = SSP_SUCCESS;
+
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    if ((0U != p_flip->count) || (NULL != p_flip->p_latched))
+    {
+        err = SSP_ERR_IN_USE;
+    }
+    else
+    {
+        for (uint32_t i = 0U; i < num_buffers; i++)
+        {
+            p_flip->p_buffers[i] = pp_buffers[i];
+        }
+        p_flip->num_buffers          = num_buffers;
+        p_flip->vsyncs_since_flip    = 0U;
+        p_flip->stats.vsyncs         = 0U;
+        p_flip->stats.flips          = 0U;
+        p_flip->stats.missed_vsyncs  = 0U;
+        p_flip->stats.frame_time     = 0U;
+        p_flip->stats.frame_time_max = 0U;
+    }
+    SSP_CRITICAL_SECTION_EXIT;
+
+    GLCD_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    return SSP_SUCCESS;
+}  /* End of function R_GLCD_BuffersSet() */
+
+/*******************************************************************************************************************//**
+ * @brief  Queue a frame buffer to be scanned out from the next vsync.
+ * @par    Implements
+ * - display_api_t::present.
+ *
+ * The line detect interrupt at the end of the active area latches the oldest presented frame buffer into the layer,
+ * so it is scanned out from the next vsync. The frame buffer it replaces is passed to the callback with
+ * ::DISPLAY_EVENT_BUFFER_RELEASED at the following line detect interrupt, once the hardware has switched to the new
+ * one. The caller never waits for the register update, and with three frame buffers the renderer can draw the next
+ * frame while one is scanned out and another waits for the vsync.
+ *
+ * @retval  SSP_SUCCESS                  Frame buffer queued.
+ * @retval  SSP_ERR_ASSERTION            Pointer to the control block or the frame buffer is NULL.
+ * @retval  SSP_ERR_NOT_OPEN             The driver is not open.
+ * @retval  SSP_ERR_INVALID_ARGUMENT     Invalid layer, or the frame buffer is not registered for the layer.
+ * @retval  SSP_ERR_IN_USE               The frame buffer is queued, latched or scanned out.
+ * @note    Frame buffers presented before R_GLCD_Start() are flipped to from the first frame.
+ **********************************************************************************************************************/
+ssp_err_t R_GLCD_Present (display_ctrl_t * const p_api_ctrl, display_frame_layer_t frame, void * const p_buffer)
+{
+    glcd_instance_ctrl_t * p_ctrl = (glcd_instance_ctrl_t *) p_api_ctrl;
+
+#if (GLCD_CFG_PARAM_CHECKING_ENABLE)
+    SSP_ASSERT(p_ctrl);
+    SSP_ASSERT(p_buffer);
+    GLCD_ERROR_RETURN(DISPLAY_STATE_CLOSED != p_ctrl->state, SSP_ERR_NOT_OPEN);
+    GLCD_ERROR_RETURN(DISPLAY_FRAME_LAYER_2 >= frame, SSP_ERR_INVALID_ARGUMENT);
+#endif
+
+    glcd_flip_t * p_flip = &p_ctrl->flip[frame];
+    ssp_err_t     err    = SSP_SUCCESS;
+
+    GLCD_ERROR_RETURN(r_glcd_flip_is_registered(p_flip, p_buffer), SSP_ERR_INVALID_ARGUMENT);
+
+    /** Each registered frame buffer is in the queue at most once, so the queue cannot overflow. */
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    if (r_glcd_flip_is_busy(p_flip, p_buffer))
+    {
+        err = SSP_ERR_IN_USE;
+    }
+    else
+    {
+        p_flip->queue[(p_flip->head + p_flip->count) % GLCD_FLIP_BUFFERS_MAX] = p_buffer;
+        p_flip->count++;
+    }
+    SSP_CRITICAL_SECTION_EXIT;
+
+    GLCD_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    return SSP_SUCCESS;
+}  /* End of function R_GLCD_Present() */
+
+/*******************************************************************************************************************//**
+ * @brief  Get the page flip statistics of a graphics layer.
+ * @par    Implements
+ * - display_api_t::flipStatsGet.
+ *
+ * @retval  SSP_SUCCESS                  Statistics stored in p_stats.
+ * @retval  SSP_ERR_ASSERTION            Pointer to the control block or p_stats is NULL.
+ * @retval  SSP_ERR_INVALID_ARGUMENT     Invalid layer.
+ * @note    Frame times are 0 if the BSP timer service is not open.
+ **********************************************************************************************************************/
+ssp_err_t R_GLCD_FlipStatsGet (display_ctrl_t const * const p_api_ctrl, display_frame_layer_t frame,
+                               display_flip_stats_t * const p_stats)
+{
+    glcd_instance_ctrl_t const * p_ctrl = (glcd_instance_ctrl_t const *) p_api_ctrl;
+
+#if (GLCD_CFG_PARAM_CHECKING_ENABLE)
+    SSP_ASSERT(p_ctrl);
+    SSP_ASSERT(p_stats);
+    GLCD_ERROR_RETURN(DISPLAY_FRAME_LAYER_2 >= frame, SSP_ERR_INVALID_ARGUMENT);
+#endif
+
+    glcd_flip_t const * p_flip = &p_ctrl->flip[frame];
+
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    *p_stats        = p_flip->stats;
+    p_stats->queued = p_flip->count;
+    SSP_CRITICAL_SECTION_EXIT;
+
+    return SSP_SUCCESS;
+}  /* End of function R_GLCD_FlipStatsGet() */
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup GLCD)
  **********************************************************************************************************************/
@@ -1462,11 +1658,12 @@ static void r_glcd_graphics_layer_param_recalculation (display_input_cfg_t const
  * @param[in]     p_layer         The layer configuration
  * @param[in]     frame           The number of input frame buffer
  * @param[in]     p_glcd_reg      Pointer to GLCD registers
- * @retval        void
+ * @return        Offset of the layer base address from the frame buffer address, which page flips add to each frame
+ *                buffer address.
  * @note    This function does not perform parameter check and it would be expected to be done in the caller function.
  **********************************************************************************************************************/
-static void r_glcd_graphics_layer_set (R_GLCDC_Type * p_glcd_reg, display_input_cfg_t const * const p_input, display_layer_t const * const p_layer,
-                                      display_frame_layer_t const frame)
+static uint32_t r_glcd_graphics_layer_set (R_GLCDC_Type * p_glcd_reg, display_input_cfg_t const * const p_input, display_layer_t const * const p_layer,
+                                          display_frame_layer_t const frame)
 {
     uint32_t             bit_size    = r_glcd_get_bit_size((display_in_format_t) p_input->format);
     int32_t              line_offset = (int32_t)((p_input->hstride * bit_size) / 8);
@@ -1477,7 +1674,7 @@ static void r_glcd_graphics_layer_set (R_GLCDC_Type * p_glcd_reg, display_input_
     {
         HW_GLCD_GRplaneAlphaBlendingPlaneSet(p_glcd_reg, frame, DISPLAY_PLANE_BLEND_TRANSPARENT);    /* Set layer transparent */
         HW_GLCD_GRplaneFrameDisable(p_glcd_reg, frame);
-        return;
+        return 0U;
     }
 
     r_glcd_graphics_plane_format_set(p_glcd_reg, (display_in_format_t) p_input->format, frame);
@@ -1552,6 +1749,8 @@ static void r_glcd_graphics_layer_set (R_GLCDC_Type * p_glcd_reg, display_input_
 
     /** Set the alpha blending condition */
     r_glcd_graphics_layer_blend_condition_set(p_glcd_reg, p_layer, frame);
+
+    return recalculated.base_address - (uint32_t) p_input->p_base;
 }  /* End of function r_glcd_graphics_layer_set() */
 
 /*******************************************************************************************************************//**
@@ -1910,6 +2109,8 @@ static void r_glcd_graphics_plane_format_set (R_GLCDC_Type * p_glcd_reg, display
  *           This ISR is called when the number of the display line reaches the designated number of lines. If a
  *           callback function is registered in R_GLCD_Open(), it is called from this ISR and the
  *           DISPLAY_EVENT_LINE_DETECTION event code is set as its argument.
+ *           The line is at the end of the active area, so this ISR also releases frame buffers replaced at the last
+ *           vsync and latches presented frame buffers for the next one.
  * @retval        none
  **********************************************************************************************************************/
 void glcdc_line_detect_isr (void)
@@ -1919,6 +2120,10 @@ void glcdc_line_detect_isr (void)
     display_callback_args_t args;
     glcd_instance_ctrl_t * p_ctrl = (glcd_instance_ctrl_t *) ctrl_blk.p_context;
 
+    /** Flip the graphics layers */
+    r_glcd_flip_vsync(p_ctrl, DISPLAY_FRAME_LAYER_1);
+    r_glcd_flip_vsync(p_ctrl, DISPLAY_FRAME_LAYER_2);
+
     /** Call back callback function if it is registered */
     if (NULL != p_ctrl->p_callback)
     {
@@ -2129,3 +2334,137 @@ static void r_glcd_pixel_size_recalculate(display_input_cfg_t const * const p_in
     }
 }
 
+
+/*******************************************************************************************************************//**
+ * @brief         Page flip processing of a graphics layer at the line detect interrupt. The interrupt is at the end
+ *                of the active area, once per frame.
+ *                - The frame buffer latched at the previous interrupt has been scanned out since the vsync in
+ *                  between, so the frame buffer it replaced is released to the callback.
+ *                - The oldest presented frame buffer is latched, so the hardware switches to it at the next vsync.
+ * @param[in]     p_ctrl   Pointer to the control block
+ * @param[in]     frame    Graphics layer
+ * @retval        void
+ **********************************************************************************************************************/
+static void r_glcd_flip_vsync (glcd_instance_ctrl_t * const p_ctrl, display_frame_layer_t const frame)
+{
+    glcd_flip_t  * p_flip     = &p_ctrl->flip[frame];
+    R_GLCDC_Type * p_glcd_reg = p_ctrl->p_reg;
+    void         * p_released = NULL;
+    void         * p_next     = NULL;
+
+    if (0U == p_flip->num_buffers)
+    {
+        return;
+    }
+
+    p_flip->stats.vsyncs++;
+    p_flip->vsyncs_since_flip++;
+
+    /** The hardware clears the update request at the vsync that reflects it. If it is still set, the latched frame
+     *  buffer is not scanned out yet and the previous frame buffer is shown for one more frame. */
+    if (HW_GLCD_IsGRplaneUpdating(p_glcd_reg, frame))
+    {
+        return;
+    }
+
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    if (NULL != p_flip->p_latched)
+    {
+        if (p_flip->p_latched != p_flip->p_displayed)
+        {
+            p_released = p_flip->p_displayed;
+        }
+        p_flip->p_displayed = p_flip->p_latched;
+        p_flip->p_latched   = NULL;
+    }
+
+    if (0U != p_flip->count)
+    {
+        p_next            = p_flip->queue[p_flip->head];
+        p_flip->head      = (p_flip->head + 1U) % GLCD_FLIP_BUFFERS_MAX;
+        p_flip->count--;
+        p_flip->p_latched = p_next;
+    }
+    SSP_CRITICAL_SECTION_EXIT;
+
+    if (NULL != p_next)
+    {
+        /** Latch the frame buffer. The layer position offset is the same for every frame buffer of the layer. */
+        HW_GLCD_GRplaneBaseAddress(p_glcd_reg, frame, (uint32_t) p_next + p_flip->base_offset);
+        HW_GLCD_GRplaneUpdateEnable(p_glcd_reg, frame);
+
+        /** Every vsync between two flips beyond the first repeated the previous frame buffer. */
+        uint64_t now = 0U;
+        (void) R_BSP_TimestampGet(&now);
+        if (0U != p_flip->stats.flips)
+        {
+            p_flip->stats.missed_vsyncs += p_flip->vsyncs_since_flip - 1U;
+            if ((0U != now) && (0U != p_flip->flip_time))
+            {
+                p_flip->stats.frame_time = now - p_flip->flip_time;
+                if (p_flip->stats.frame_time > p_flip->stats.frame_time_max)
+                {
+                    p_flip->stats.frame_time_max = p_flip->stats.frame_time;
+                }
+            }
+        }
+        p_flip->stats.flips++;
+        p_flip->flip_time         = now;
+        p_flip->vsyncs_since_flip = 0U;
+    }
+
+    /** Return the replaced frame buffer to the renderer */
+    if ((NULL != p_released) && (NULL != p_ctrl->p_callback))
+    {
+        display_callback_args_t args;
+        args.event     = DISPLAY_EVENT_BUFFER_RELEASED;
+        args.p_context = p_ctrl->p_context;
+        args.frame     = frame;
+        args.p_buffer  = p_released;
+        p_ctrl->p_callback(&args);
+    }
+}  /* End of function r_glcd_flip_vsync() */
+
+/*******************************************************************************************************************//**
+ * @brief         Checks whether a frame buffer is registered for a graphics layer.
+ * @param[in]     p_flip     Pointer to the page flip state of the layer
+ * @param[in]     p_buffer   Frame buffer
+ * @retval        true : The frame buffer is registered / false : The frame buffer is not registered
+ **********************************************************************************************************************/
+static bool r_glcd_flip_is_registered (glcd_flip_t const * const p_flip, void const * const p_buffer)
+{
+    for (uint32_t i = 0U; i < p_flip->num_buffers; i++)
+    {
+        if (p_flip->p_buffers[i] == p_buffer)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}  /* End of function r_glcd_flip_is_registered() */
+
+/*******************************************************************************************************************//**
+ * @brief         Checks whether a frame buffer is queued, latched or scanned out on a graphics layer.
+ * @param[in]     p_flip     Pointer to the page flip state of the layer
+ * @param[in]     p_buffer   Frame buffer
+ * @retval        true : The frame buffer is in use / false : The frame buffer belongs to the renderer
+ **********************************************************************************************************************/
+static bool r_glcd_flip_is_busy (glcd_flip_t const * const p_flip, void const * const p_buffer)
+{
+    if ((p_flip->p_displayed == p_buffer) || (p_flip->p_latched == p_buffer))
+    {
+        return true;
+    }
+
+    for (uint32_t i = 0U; i < p_flip->count; i++)
+    {
+        if (p_flip->queue[(p_flip->head + i) % GLCD_FLIP_BUFFERS_MAX] == p_buffer)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}  /* End of function r_glcd_flip_is_busy() */
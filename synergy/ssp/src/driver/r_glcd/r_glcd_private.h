@@ -29,7 +29,7 @@
  * Macro definitions
  **********************************************************************************************************************/
 #define GLCD_CODE_VERSION_MAJOR (2U)
-#define GLCD_CODE_VERSION_MINOR (0U)
+#define GLCD_CODE_VERSION_MINOR (1U)
 
 /* Color look up table entry size */
 #define GLCD_CLUT_ENTRY_SIZE (256U)
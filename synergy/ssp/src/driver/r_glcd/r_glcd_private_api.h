@@ -40,6 +40,11 @@ ssp_err_t R_GLCD_ClutUpdate (display_ctrl_t const * const     p_ctrl,
                              display_frame_layer_t            frame);
 ssp_err_t R_GLCD_StatusGet  (display_ctrl_t const * const p_ctrl, display_status_t * const status);
 ssp_err_t R_GLCD_VersionGet (ssp_version_t * p_version);
+ssp_err_t R_GLCD_BuffersSet (display_ctrl_t * const p_ctrl, display_frame_layer_t frame,
+                             void * const * const pp_buffers, uint32_t num_buffers);
+ssp_err_t R_GLCD_Present    (display_ctrl_t * const p_ctrl, display_frame_layer_t frame, void * const p_buffer);
+ssp_err_t R_GLCD_FlipStatsGet (display_ctrl_t const * const p_ctrl, display_frame_layer_t frame,
+                               display_flip_stats_t * const p_stats);
 
 /* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
 SSP_FOOTER
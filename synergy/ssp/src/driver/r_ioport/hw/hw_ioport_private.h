@@ -109,6 +109,8 @@ __STATIC_INLINE void             HW_IOPORT_EthernetModeCfg (R_PMISC_Type * p_pmi
 
 __STATIC_INLINE void         HW_IOPORT_PFSWrite (R_PFS_Type * p_pfs_reg, R_PMISC_Type * p_pmisc_reg, ioport_port_pin_t pin, uint32_t value);
 
+__STATIC_INLINE void         HW_IOPORT_PFSWriteUnprotected (uint32_t volatile * p_dest, uint32_t value);
+
 __STATIC_INLINE void         HW_IOPORT_PFSSetDirection (R_PFS_Type * p_pfs_reg, R_PMISC_Type * p_pmisc_reg, ioport_port_pin_t pin, ioport_direction_t direction);
 
 __STATIC_INLINE uint32_t     HW_IOPORT_PFSRead (R_PFS_Type * p_pfs_reg, ioport_port_pin_t pin);
@@ -590,13 +592,29 @@ __STATIC_INLINE uint32_t HW_IOPORT_PFSRead (R_PFS_Type * p_pfs_reg, ioport_port_
 __STATIC_INLINE void HW_IOPORT_PFSWrite (R_PFS_Type * p_pfs_reg, R_PMISC_Type * p_pmisc_reg, ioport_port_pin_t pin, uint32_t value)
 {
     volatile uint32_t * p_dest;
-    uint32_t          pfs_original;
-    uint32_t          pfs_new;
 
     p_dest = ioport_pfs_address_get((uint32_t volatile *) p_pfs_reg, pin);
 
     HW_IOPORT_PFSAccessEnable(p_pmisc_reg);     // Protect PWPR from re-entrancy
 
+    HW_IOPORT_PFSWriteUnprotected(p_dest, value);
+
+    HW_IOPORT_PFSAccessDisable(p_pmisc_reg);
+}
+
+/*******************************************************************************************************************//**
+ * Writes a PFS register without touching PWPR. The caller must hold PFS write access (HW_IOPORT_PFSAccessEnable)
+ * for the duration of the write, which allows a whole pin table to be written inside a single access window.
+ *
+ * @param[in]    p_dest     Address of the PFS register to write
+ * @param[in]    value      Value to be written to the PFS register
+ *
+ **********************************************************************************************************************/
+__STATIC_INLINE void HW_IOPORT_PFSWriteUnprotected (uint32_t volatile * p_dest, uint32_t value)
+{
+    uint32_t          pfs_original;
+    uint32_t          pfs_new;
+
     /* Read the current PFS value */
     pfs_original = *p_dest;
 
@@ -615,8 +633,6 @@ __STATIC_INLINE void HW_IOPORT_PFSWrite (R_PFS_Type * p_pfs_reg, R_PMISC_Type *
 
     /* New value can be safely written to PFS. */
     *p_dest = value;
-
-    HW_IOPORT_PFSAccessDisable(p_pmisc_reg);
 }
 
 /*******************************************************************************************************************//**
@@ -56,6 +56,10 @@
 /** Shift to get port in ioport_port_t and ioport_port_pin_t enums. */
 #define IOPORT_PRV_PORT_OFFSET        (8U)
 
+/** Masks to get the port and pin fields of an ioport_port_pin_t. */
+#define IOPORT_PRV_PORT_MASK          (0xFF00U)
+#define IOPORT_PRV_PIN_MASK           (0x00FFU)
+
 #ifndef BSP_MCU_VBATT_SUPPORT
 #define BSP_MCU_VBATT_SUPPORT         (0U)
 #endif
@@ -223,6 +227,10 @@ ssp_err_t R_IOPORT_Init (const ioport_cfg_t * p_cfg)
  * This data can be generated by the ISDE pin configurator or manually by the developer. Different pin configurations
  * can be loaded for different situations such as low power modes and test.*
  *
+ * The whole table is applied in one pass: PFS write access is opened once before the first pin and closed after the
+ * last one, and the PFS base of each port is computed once per run of consecutive pins on that port. Tables
+ * generated by the pin configurator are sorted by port, so each port is visited exactly once.
+ *
  * @retval SSP_SUCCESS                  Pin configuration data written to PFS register(s)
  * @retval SSP_ERR_ASSERTION            NULL pointer
  *
@@ -239,16 +247,28 @@ ssp_err_t R_IOPORT_PinsCfg (const ioport_cfg_t * p_cfg)
     bsp_vbatt_init(p_cfg);
 #endif
 
-    uint16_t     pin_count;
-    ioport_cfg_t * p_pin_data;
+    ioport_pin_cfg_t const * p_pin_data = p_cfg->p_pin_cfg_data;
+    ioport_pin_cfg_t const * p_pin_end  = p_pin_data + p_cfg->number_of_pins;
 
-    p_pin_data = (ioport_cfg_t *) p_cfg;
+    /** Open PFS write access once for the whole table. */
+    HW_IOPORT_PFSAccessEnable(gp_pmisc_reg);
 
-    for (pin_count = 0u; pin_count < p_pin_data->number_of_pins; pin_count++)
+    while (p_pin_data < p_pin_end)
     {
-        HW_IOPORT_PFSWrite(gp_pfs_reg, gp_pmisc_reg, p_pin_data->p_pin_cfg_data[pin_count].pin, p_pin_data->p_pin_cfg_data[pin_count].pin_cfg);
+        /** Resolve the PFS base of this port once, then write every consecutive pin on the same port. */
+        uint32_t            port_bits = (uint32_t) p_pin_data->pin & IOPORT_PRV_PORT_MASK;
+        volatile uint32_t * p_port_pfs = ioport_pfs_address_get((uint32_t volatile *) gp_pfs_reg,
+                                                                (ioport_port_pin_t) port_bits);
+        do
+        {
+            HW_IOPORT_PFSWriteUnprotected(&p_port_pfs[(uint32_t) p_pin_data->pin & IOPORT_PRV_PIN_MASK],
+                                          p_pin_data->pin_cfg);
+            p_pin_data++;
+        } while ((p_pin_data < p_pin_end) && (port_bits == ((uint32_t) p_pin_data->pin & IOPORT_PRV_PORT_MASK)));
     }
 
+    HW_IOPORT_PFSAccessDisable(gp_pmisc_reg);
+
     return SSP_SUCCESS;
 }
 
@@ -1238,8 +1238,10 @@ static void jpeg_decode_jedi_isr(void * const p_common_ctrl)
         }
 
         /** If both Input buffer and  output buffer are set, and horizontal stride is set, the driver is available
-         *  to determine the number of lines to decode, and start the decoding operation. */
-        if ((HW_JPEG_DecodeSourceAddressGet(p_ctrl->p_reg)) && (p_ctrl->outbuffer_size) && (p_ctrl->horizontal_stride))
+         *  to determine the number of lines to decode, and start the decoding operation. Output that the callback
+         *  already started through R_JPEG_Decode_OutputBufferSet() is not started again. */
+        if ((0U == ((uint32_t) JPEG_DECODE_STATUS_RUNNING & (uint32_t) p_ctrl->status)) &&
+            (HW_JPEG_DecodeSourceAddressGet(p_ctrl->p_reg)) && (p_ctrl->outbuffer_size) && (p_ctrl->horizontal_stride))
         {
             uint16_t lines_to_decode = 0;
 
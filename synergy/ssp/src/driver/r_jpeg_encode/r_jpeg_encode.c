@@ -891,9 +891,9 @@ static void jpeg_encoder_jdti_isr(void * const p_common_ctrl)
         /** Set the ctrl status.  */
         p_ctrl->status = (jpeg_encode_status_t)((uint32_t)p_ctrl->status | (uint32_t)(JPEG_ENCODE_STATUS_INPUT_PAUSE));
 
-        /* Invoke the callback with INPUT_PAUSE status */
-        if ((NULL != p_ctrl->p_callback) &&
-                ((p_ctrl->encoded_lines) <= (p_ctrl->vertical_resolution - p_ctrl->lines_to_encoded)))
+        /* Invoke the callback with INPUT_PAUSE status while lines remain, the last band may be shorter than the
+         * others. */
+        if ((NULL != p_ctrl->p_callback) && (p_ctrl->encoded_lines < p_ctrl->vertical_resolution))
         {
             jpeg_encode_callback_args_t args;
             args.image_size = p_ctrl->output_buffer_size;
@@ -49,6 +49,9 @@
                                     **/
 #define PDC_TIMEOUT             0xFFFFul
 #define MAX_PIXEL_RESOLUTION    0x1000U
+#define PDC_BLOCK_BYTES         (PDC_TRANSFER_SIZE * PDC_TRANSFERS_PER_BLOCK)
+#define PDC_SEGMENT_BLOCKS_MAX  0xFFFFu /* transfer_info_t::num_blocks is 16 bits, larger frames use several
+                                         * segments */
 
 void pdc_frame_end_isr (void);
 void pdc_int_isr (void);
@@ -67,6 +70,18 @@ static ssp_err_t pdc_open_assert_check         (pdc_ctrl_t * const p_ctrl,
 static ssp_err_t pdc_capturestart_assert_check (pdc_instance_ctrl_t * const p_ctrl,
                                                 uint8_t * const p_buffer);
 static void      nvic_pdc_interrupts_enable    (pdc_instance_ctrl_t * const p_ctrl);
+static ssp_err_t r_pdc_capture_start           (pdc_instance_ctrl_t * const p_ctrl);
+static ssp_err_t r_pdc_transfer_open           (pdc_instance_ctrl_t * const p_ctrl);
+static ssp_err_t r_pdc_segment_arm             (pdc_instance_ctrl_t * const p_ctrl, uint32_t segment);
+static void      r_pdc_frame_next              (pdc_instance_ctrl_t * const p_ctrl, uint64_t timestamp);
+static void      r_pdc_band_next               (pdc_instance_ctrl_t * const p_ctrl);
+static uint32_t  r_pdc_buffer_take             (pdc_instance_ctrl_t * const p_ctrl);
+static void      r_pdc_callback_call           (pdc_instance_ctrl_t * const p_ctrl,
+                                                pdc_event_t                 event,
+                                                uint8_t                   * p_buffer,
+                                                uint32_t                    dropped,
+                                                uint64_t                    timestamp,
+                                                uint32_t                    line);
 
 /***********************************************************************************************************************
  * Private global variables
@@ -105,11 +120,15 @@ static const ssp_version_t g_pdc_version =
 /*LDRA_INSPECTED 27 D */
 const pdc_api_t g_pdc_on_pdc =
 {
-    .open         = R_PDC_Open,
-    .close        = R_PDC_Close,
-    .captureStart = R_PDC_CaptureStart,
-    .stateGet     = R_PDC_StateGet,
-    .versionGet   = R_PDC_VersionGet,
+    .open               = R_PDC_Open,
+    .close              = R_PDC_Close,
+    .captureStart       = R_PDC_CaptureStart,
+    .stateGet           = R_PDC_StateGet,
+    .versionGet         = R_PDC_VersionGet,
+    .captureStreamStart = R_PDC_CaptureStreamStart,
+    .captureStop        = R_PDC_CaptureStop,
+    .bufferRelease      = R_PDC_BufferRelease,
+    .captureBandStart   = R_PDC_CaptureBandStart,
 };
 
 /*******************************************************************************************************************//**
@@ -209,7 +228,15 @@ ssp_err_t R_PDC_Open (pdc_ctrl_t * const p_api_ctrl, pdc_cfg_t const * const p_c
     p_ctrl->endian                = p_cfg->endian;
     p_ctrl->p_lower_lvl_transfer  = p_cfg->p_lower_lvl_transfer;
     p_ctrl->transfer_in_progress  = false;
+    p_ctrl->transfer_open         = false;
+    p_ctrl->streaming             = false;
+    p_ctrl->band_lines            = 0U;
+    p_ctrl->band_drop             = false;
+    p_ctrl->num_buffers           = 0U;
+    p_ctrl->buffers_free          = 0U;
+    p_ctrl->frame                 = 0U;
     p_ctrl->p_callback            = p_cfg->p_callback;
+    p_ctrl->p_context             = p_cfg->p_context;
 
     /** Disable module stop mode for PDC */
     R_BSP_ModuleStart(&ssp_feature);
@@ -312,6 +339,8 @@ ssp_err_t R_PDC_Close (pdc_ctrl_t * const p_api_ctrl)
 
     /* Mark transfer as not in progress */
     p_ctrl->transfer_in_progress = false;
+    p_ctrl->transfer_open        = false;
+    p_ctrl->streaming            = false;
 
     /** Unlock the PDC Hardware Resource */
     R_BSP_HardwareUnlock(&ssp_feature);
@@ -331,6 +360,9 @@ ssp_err_t R_PDC_Close (pdc_ctrl_t * const p_api_ctrl)
  * for the PDC reset operation.
  * When a capture is complete the callback registered during pdc_api_t::open API call will be called.
  *
+ * The transfer interface is opened by the first capture and kept open until pdc_api_t::close, later captures only
+ * reset its destination and block count.
+ *
  * @retval SSP_SUCCESS           Capture start successful.
  * @retval SSP_ERR_ASSERTION     One of the following parameters is incorrect.  Either
  *                                 - p_api_ctrl is NULL, OR
@@ -343,7 +375,7 @@ ssp_err_t R_PDC_Close (pdc_ctrl_t * const p_api_ctrl)
  * @return                       See @ref Common_Error_Codes or functions called by this function for other possible
  *                               return codes. This function calls:
  *                                  * transfer_api_t::open
- *                                  * transfer_api_t::enable
+ *                                  * transfer_api_t::reset
  *
  * @note If the PIXCLK is being generated by a camera module the camera must be configured after the call to
  * pdc_api_t::open and before the call to pdc_api_t::captureStart.
@@ -357,121 +389,26 @@ ssp_err_t R_PDC_Close (pdc_ctrl_t * const p_api_ctrl)
 ssp_err_t R_PDC_CaptureStart (pdc_ctrl_t * const p_api_ctrl, uint8_t * const p_buffer)
 {
     pdc_instance_ctrl_t * p_ctrl = (pdc_instance_ctrl_t *) p_api_ctrl;
-    ssp_err_t err = SSP_SUCCESS;
 #if (1 == PDC_CFG_PARAM_CHECKING_ENABLE)
-    err = pdc_capturestart_assert_check (p_ctrl, p_buffer);
+    ssp_err_t err = pdc_capturestart_assert_check (p_ctrl, p_buffer);
     PDC_ERROR_RETURN(SSP_SUCCESS == err, err);
 #endif
 
-    transfer_cfg_t    pdc_transfer_cfg;
-    uint32_t timeout     = PDC_TIMEOUT;
-    uint32_t reset_state = 0U;
-    uint32_t num_blocks  = 0U;
-    uint32_t interrupt_setting = 0U;
-
     /* Check driver is open */
     PDC_ERROR_RETURN((PDC_OPEN == p_ctrl->open), SSP_ERR_NOT_OPEN);
 
     /* Check if a transfer is already in progress */
     PDC_ERROR_RETURN((p_ctrl->transfer_in_progress == false), SSP_ERR_IN_USE);
 
-    /** Set up transfer interface */
-    p_ctrl->p_lower_lvl_transfer->p_cfg->p_info->chain_mode     = TRANSFER_CHAIN_MODE_DISABLED;
-    p_ctrl->p_lower_lvl_transfer->p_cfg->p_info->dest_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED;
-    p_ctrl->p_lower_lvl_transfer->p_cfg->p_info->irq            = TRANSFER_IRQ_END;
-    p_ctrl->p_lower_lvl_transfer->p_cfg->p_info->length         = 8U;
-    p_ctrl->p_lower_lvl_transfer->p_cfg->p_info->mode           = TRANSFER_MODE_BLOCK;
-
     if (NULL != p_buffer)
     {
         p_ctrl->p_current_buffer = p_buffer;
     }
 
-    /** Configure the transfer interface  */
-    p_ctrl->p_lower_lvl_transfer->p_cfg->p_info->p_dest           = p_ctrl->p_current_buffer;
-    p_ctrl->p_lower_lvl_transfer->p_cfg->p_info->p_src            = (void const *) &R_PDC->PCDR;
-    p_ctrl->p_lower_lvl_transfer->p_cfg->p_info->repeat_area      = TRANSFER_REPEAT_AREA_SOURCE;
-    p_ctrl->p_lower_lvl_transfer->p_cfg->p_info->size             = TRANSFER_SIZE_4_BYTE;
-    p_ctrl->p_lower_lvl_transfer->p_cfg->p_info->src_addr_mode    = TRANSFER_ADDR_MODE_FIXED;
-
-    num_blocks                                                    = (uint32_t) p_ctrl->x_capture_pixels;
-    num_blocks                                                   *= p_ctrl->bytes_per_pixel;
-    num_blocks                                                   *= p_ctrl->y_capture_pixels;
-    num_blocks                                                   /= PDC_TRANSFER_SIZE;
-    num_blocks                                                   /= PDC_TRANSFERS_PER_BLOCK;
-    p_ctrl->p_lower_lvl_transfer->p_cfg->p_info->num_blocks       = (uint16_t) num_blocks;
-
-    pdc_transfer_cfg.p_info            = p_ctrl->p_lower_lvl_transfer->p_cfg->p_info;
-    pdc_transfer_cfg.activation_source = ELC_EVENT_PDC_RECEIVE_DATA_READY;
-    pdc_transfer_cfg.auto_enable       = true;
-    pdc_transfer_cfg.p_context         = p_ctrl;
-    pdc_transfer_cfg.p_callback        = r_pdc_transfer_callback;
-    pdc_transfer_cfg.p_extend          = p_ctrl->p_lower_lvl_transfer->p_cfg->p_extend;
-    pdc_transfer_cfg.irq_ipl           = p_ctrl->p_lower_lvl_transfer->p_cfg->irq_ipl;
-
-    /** Open transfer interface */
-    err = p_ctrl->p_lower_lvl_transfer->p_api->open(p_ctrl->p_lower_lvl_transfer->p_ctrl, &pdc_transfer_cfg);
-    PDC_ERROR_RETURN((err == SSP_SUCCESS), err);
-
-    /* Mark transfer as in progress */
-    p_ctrl->transfer_in_progress = true;
-
-    /* Reset the PDC */
-    HW_PDC_Reset(p_ctrl->p_reg);
-
-    /** Wait for reset to complete */
-    timeout     = PDC_TIMEOUT;
-    reset_state = HW_PDC_GetResetState(p_ctrl->p_reg);
-    while ((timeout > 0u) && (1u == reset_state))
-    {
-        reset_state = HW_PDC_GetResetState(p_ctrl->p_reg);
-        timeout--;
-    }
-    if (0u == timeout)
-    {
-        return SSP_ERR_TIMEOUT;
-    }
-    /** Set horizontal capture range */
-    HW_PDC_HSTSet(p_ctrl->p_reg, (uint32_t) (p_ctrl->x_capture_start_pixel * p_ctrl->bytes_per_pixel));
-
-    /** Set horizontal capture size */
-    HW_PDC_HSZSet(p_ctrl->p_reg, (uint32_t) (p_ctrl->x_capture_pixels * p_ctrl->bytes_per_pixel));
-
-    /** Set vertical capture range */
-    HW_PDC_VSTSet(p_ctrl->p_reg, p_ctrl->y_capture_start_pixel);
-
-    /** Set vertical capture size */
-    HW_PDC_VSZSet(p_ctrl->p_reg, p_ctrl->y_capture_pixels);
-
-    /** Set VSYNC polarity */
-    HW_PDC_VPSSet(p_ctrl->p_reg, p_ctrl->vsync_polarity);
-
-    /** Set HSYNC polarity */
-    HW_PDC_HPSSet(p_ctrl->p_reg, p_ctrl->hsync_polarity);
-
-    /** Set endianess of capture data */
-    HW_PDC_EndianSet(p_ctrl->p_reg, p_ctrl->endian);
-
-    /** Enable interrupts:
-     *  Receive data ready interrupt,
-     *  Underrun interrupt,
-     *  Overrun interrupt,
-     *  Frame end interrupt,
-     *  Vertical line number setting error interrupt,
-     *  Horizontal byte number setting error interrupt */
-    interrupt_setting = (uint32_t)( PDC_INTERRUPT_DFIE | PDC_INTERRUPT_UDRIE | PDC_INTERRUPT_OVIE |
-            PDC_INTERRUPT_FEIE | PDC_INTERRUPT_VERIE | PDC_INTERRUPT_HERIE);
-    HW_PDC_InterruptSet(p_ctrl->p_reg, interrupt_setting);
-
-    nvic_pdc_interrupts_enable(p_ctrl);
-
-    err = p_ctrl->p_lower_lvl_transfer->p_api->enable(p_ctrl->p_lower_lvl_transfer->p_ctrl);
-    PDC_ERROR_RETURN((err == SSP_SUCCESS), err);
+    p_ctrl->streaming  = false;
+    p_ctrl->band_lines = 0U;
 
-    /* Set PCCR1.PCE as 1 */
-    HW_PDC_Enable(p_ctrl->p_reg);
-
-    return SSP_SUCCESS;
+    return r_pdc_capture_start(p_ctrl);
 }
 
 /******************************************************************************
@@ -555,6 +492,283 @@ ssp_err_t R_PDC_VersionGet (ssp_version_t * const p_data)
  * End of function R_PDC_VersionGet
  ******************************************************************************/
 
+/*******************************************************************************************************************//**
+ * @brief  Starts a continuous capture into a set of frame buffers. Implements pdc_api_t::captureStreamStart.
+ *
+ * Capture starts into the first buffer. The PDC stays enabled between frames: the frame end interrupt re-arms the
+ * transfer interface for the next free buffer during vertical blanking, so no frame is lost between captures. Each
+ * completed frame is passed to the callback with ::PDC_EVENT_TRANSFER_COMPLETE, its sequence number and timestamp,
+ * and the number of frames dropped before it. The buffer then belongs to the application until it is returned with
+ * pdc_api_t::bufferRelease. When no other buffer is free at frame end, the frame is dropped and the next frame is
+ * captured into the same buffer, so the driver always has a buffer to capture into.
+ *
+ * Errors stop the capture and are reported to the callback as in pdc_api_t::captureStart.
+ *
+ * @retval SSP_SUCCESS              Capture started.
+ * @retval SSP_ERR_ASSERTION        p_api_ctrl, pp_buffers, one of the buffers or the transfer interface is NULL.
+ * @retval SSP_ERR_INVALID_ARGUMENT num_buffers is less than 2 or greater than ::PDC_STREAM_BUFFERS_MAX.
+ * @retval SSP_ERR_NOT_OPEN         Open has not been successfully called.
+ * @retval SSP_ERR_IN_USE           A capture is already in progress.
+ * @retval SSP_ERR_TIMEOUT          Reset operation timed out.
+ * @return                          See @ref Common_Error_Codes or functions called by this function for other possible
+ *                                  return codes. This function calls:
+ *                                  * transfer_api_t::open
+ *                                  * transfer_api_t::reset
+ *
+ * @note Frames larger than 65535 blocks of 32 bytes are transferred in segments, which are chained from the transfer
+ * end interrupt. This requires a DMAC transfer instance.
+ **********************************************************************************************************************/
+ssp_err_t R_PDC_CaptureStreamStart (pdc_ctrl_t * const p_api_ctrl, uint8_t * const * const pp_buffers,
+                                    uint32_t num_buffers)
+{
+    pdc_instance_ctrl_t * p_ctrl = (pdc_instance_ctrl_t *) p_api_ctrl;
+
+#if (1 == PDC_CFG_PARAM_CHECKING_ENABLE)
+    SSP_ASSERT(NULL != p_ctrl);
+    SSP_ASSERT(NULL != p_ctrl->p_lower_lvl_transfer);
+    SSP_ASSERT(NULL != p_ctrl->p_lower_lvl_transfer->p_api);
+    SSP_ASSERT(NULL != pp_buffers);
+    PDC_ERROR_RETURN((num_buffers >= 2U) && (num_buffers <= PDC_STREAM_BUFFERS_MAX), SSP_ERR_INVALID_ARGUMENT);
+    for (uint32_t i = 0U; i < num_buffers; i++)
+    {
+        SSP_ASSERT(NULL != pp_buffers[i]);
+    }
+#endif
+
+    /* Check driver is open */
+    PDC_ERROR_RETURN((PDC_OPEN == p_ctrl->open), SSP_ERR_NOT_OPEN);
+
+    /* Check if a transfer is already in progress */
+    PDC_ERROR_RETURN((p_ctrl->transfer_in_progress == false), SSP_ERR_IN_USE);
+
+    /** Capture into the first buffer, the others are free. */
+    for (uint32_t i = 0U; i < num_buffers; i++)
+    {
+        p_ctrl->p_buffers[i] = pp_buffers[i];
+    }
+    p_ctrl->num_buffers      = num_buffers;
+    p_ctrl->buffer_index     = 0U;
+    p_ctrl->buffers_free     = ((1UL << num_buffers) - 1UL) & ~1UL;
+    p_ctrl->p_current_buffer = pp_buffers[0];
+    p_ctrl->frame            = 0U;
+    p_ctrl->dropped          = 0U;
+    p_ctrl->band_lines       = 0U;
+    p_ctrl->streaming        = true;
+
+    ssp_err_t err = r_pdc_capture_start(p_ctrl);
+    if (SSP_SUCCESS != err)
+    {
+        p_ctrl->streaming = false;
+    }
+
+    return err;
+}
+
+/******************************************************************************
+ * End of function R_PDC_CaptureStreamStart
+ ******************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @brief  Stops a capture. Implements pdc_api_t::captureStop.
+ *
+ * The PDC and the transfer interface are disabled at once, a frame being captured is discarded. All frame buffers of
+ * a continuous capture return to the application. The transfer interface stays open for the next capture.
+ *
+ * @retval SSP_SUCCESS           Capture stopped.
+ * @retval SSP_ERR_ASSERTION     p_api_ctrl or the transfer interface is NULL.
+ * @retval SSP_ERR_NOT_OPEN      Open has not been successfully called.
+ **********************************************************************************************************************/
+ssp_err_t R_PDC_CaptureStop (pdc_ctrl_t * const p_api_ctrl)
+{
+    pdc_instance_ctrl_t * p_ctrl = (pdc_instance_ctrl_t *) p_api_ctrl;
+
+#if (1 == PDC_CFG_PARAM_CHECKING_ENABLE)
+    SSP_ASSERT(NULL != p_ctrl);
+    SSP_ASSERT(NULL != p_ctrl->p_lower_lvl_transfer);
+    SSP_ASSERT(NULL != p_ctrl->p_lower_lvl_transfer->p_api);
+#endif
+
+    /* Check driver is open */
+    PDC_ERROR_RETURN((PDC_OPEN == p_ctrl->open), SSP_ERR_NOT_OPEN);
+
+    /** Stop the PDC and disable its interrupts. */
+    HW_PDC_Disable(p_ctrl->p_reg);
+    HW_PDC_InterruptSet(p_ctrl->p_reg, PDC_INTERRUPT_NONE);
+    if (SSP_INVALID_VECTOR != p_ctrl->frame_end_irq)
+    {
+        NVIC_DisableIRQ(p_ctrl->frame_end_irq);
+    }
+    if (SSP_INVALID_VECTOR != p_ctrl->irq)
+    {
+        NVIC_DisableIRQ(p_ctrl->irq);
+    }
+
+    /** Stop the transfer. */
+    if (p_ctrl->transfer_open)
+    {
+        p_ctrl->p_lower_lvl_transfer->p_api->disable(p_ctrl->p_lower_lvl_transfer->p_ctrl);
+    }
+
+    p_ctrl->streaming            = false;
+    p_ctrl->band_drop            = false;
+    p_ctrl->buffers_free         = 0U;
+    p_ctrl->transfer_in_progress = false;
+
+    return SSP_SUCCESS;
+}
+
+/******************************************************************************
+ * End of function R_PDC_CaptureStop
+ ******************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @brief  Returns a frame buffer delivered by a continuous capture to the driver. Implements
+ * pdc_api_t::bufferRelease.
+ *
+ * @retval SSP_SUCCESS              Buffer returned, the driver may capture into it.
+ * @retval SSP_ERR_ASSERTION        p_api_ctrl or p_buffer is NULL.
+ * @retval SSP_ERR_NOT_OPEN         Open has not been successfully called.
+ * @retval SSP_ERR_INVALID_ARGUMENT p_buffer is not one of the capture's frame buffers, or the driver already owns it.
+ *
+ * @note This function may be called from the callback.
+ **********************************************************************************************************************/
+ssp_err_t R_PDC_BufferRelease (pdc_ctrl_t * const p_api_ctrl, uint8_t * const p_buffer)
+{
+    pdc_instance_ctrl_t * p_ctrl = (pdc_instance_ctrl_t *) p_api_ctrl;
+
+#if (1 == PDC_CFG_PARAM_CHECKING_ENABLE)
+    SSP_ASSERT(NULL != p_ctrl);
+    SSP_ASSERT(NULL != p_buffer);
+#endif
+
+    /* Check driver is open */
+    PDC_ERROR_RETURN((PDC_OPEN == p_ctrl->open), SSP_ERR_NOT_OPEN);
+
+    uint32_t index = 0U;
+    while ((index < p_ctrl->num_buffers) && (p_buffer != p_ctrl->p_buffers[index]))
+    {
+        index++;
+    }
+    PDC_ERROR_RETURN(index < p_ctrl->num_buffers, SSP_ERR_INVALID_ARGUMENT);
+
+    ssp_err_t err  = SSP_SUCCESS;
+    uint32_t  mask = 1UL << index;
+
+    /** The frame end interrupt takes buffers from the free set, so update it with interrupts masked. */
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    if ((0U != (p_ctrl->buffers_free & mask)) || (p_ctrl->streaming && (index == p_ctrl->buffer_index)))
+    {
+        err = SSP_ERR_INVALID_ARGUMENT;
+    }
+    else
+    {
+        p_ctrl->buffers_free |= mask;
+    }
+    SSP_CRITICAL_SECTION_EXIT;
+
+    PDC_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    return SSP_SUCCESS;
+}
+
+/******************************************************************************
+ * End of function R_PDC_BufferRelease
+ ******************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @brief  Starts a continuous capture that hands each frame over in bands of lines. Implements
+ * pdc_api_t::captureBandStart.
+ *
+ * Each frame is transferred as a sequence of bands of band_lines lines, every band into a buffer of its own. When a
+ * band is complete the transfer end interrupt re-arms the transfer for the next free buffer and passes the band to the
+ * callback with ::PDC_EVENT_BAND_COMPLETE, the frame sequence number and the first line and number of lines it holds.
+ * The band buffer then belongs to the application until it is returned with pdc_api_t::bufferRelease, so a consumer
+ * can process the top of a frame while the rest is still being captured and needs only a few bands of memory.
+ *
+ * When no other buffer is free at the end of a band, the rest of the frame is captured into the same buffer and not
+ * delivered. A frame whose last band was not delivered is abandoned; the first band of the next frame reports it in
+ * pdc_callback_args_t::dropped.
+ *
+ * Errors stop the capture and are reported to the callback as in pdc_api_t::captureStart.
+ *
+ * @retval SSP_SUCCESS              Capture started.
+ * @retval SSP_ERR_ASSERTION        p_api_ctrl, pp_buffers, one of the buffers or the transfer interface is NULL.
+ * @retval SSP_ERR_INVALID_ARGUMENT One of the following parameters is incorrect.  Either
+ *                                  - num_buffers is less than 2 or greater than ::PDC_STREAM_BUFFERS_MAX, OR
+ *                                  - band_lines is zero or greater than the number of captured lines, OR
+ *                                  - a band or the frame is not a multiple of 32 bytes, OR
+ *                                  - a band is larger than 65535 blocks of 32 bytes.
+ * @retval SSP_ERR_NOT_OPEN         Open has not been successfully called.
+ * @retval SSP_ERR_IN_USE           A capture is already in progress.
+ * @retval SSP_ERR_TIMEOUT          Reset operation timed out.
+ * @return                          See @ref Common_Error_Codes or functions called by this function for other possible
+ *                                  return codes. This function calls:
+ *                                  * transfer_api_t::open
+ *                                  * transfer_api_t::reset
+ *
+ * @note Bands are chained from the transfer end interrupt, which requires a DMAC transfer instance. Band buffers must
+ * be at least band_lines * x_capture_pixels * bytes_per_pixel bytes.
+ **********************************************************************************************************************/
+ssp_err_t R_PDC_CaptureBandStart (pdc_ctrl_t * const p_api_ctrl, uint8_t * const * const pp_buffers,
+                                  uint32_t num_buffers, uint32_t band_lines)
+{
+    pdc_instance_ctrl_t * p_ctrl = (pdc_instance_ctrl_t *) p_api_ctrl;
+
+#if (1 == PDC_CFG_PARAM_CHECKING_ENABLE)
+    SSP_ASSERT(NULL != p_ctrl);
+    SSP_ASSERT(NULL != p_ctrl->p_lower_lvl_transfer);
+    SSP_ASSERT(NULL != p_ctrl->p_lower_lvl_transfer->p_api);
+    SSP_ASSERT(NULL != pp_buffers);
+    PDC_ERROR_RETURN((num_buffers >= 2U) && (num_buffers <= PDC_STREAM_BUFFERS_MAX), SSP_ERR_INVALID_ARGUMENT);
+    for (uint32_t i = 0U; i < num_buffers; i++)
+    {
+        SSP_ASSERT(NULL != pp_buffers[i]);
+    }
+#endif
+
+    /* Check driver is open */
+    PDC_ERROR_RETURN((PDC_OPEN == p_ctrl->open), SSP_ERR_NOT_OPEN);
+
+    /** Each band and the frame must end on a receive data ready request, and a band must fit in one transfer. */
+    uint32_t line_bytes = (uint32_t) p_ctrl->x_capture_pixels * p_ctrl->bytes_per_pixel;
+    PDC_ERROR_RETURN((band_lines > 0U) && (band_lines <= p_ctrl->y_capture_pixels), SSP_ERR_INVALID_ARGUMENT);
+    PDC_ERROR_RETURN(0U == ((line_bytes * band_lines) % PDC_BLOCK_BYTES), SSP_ERR_INVALID_ARGUMENT);
+    PDC_ERROR_RETURN(0U == ((line_bytes * p_ctrl->y_capture_pixels) % PDC_BLOCK_BYTES), SSP_ERR_INVALID_ARGUMENT);
+    PDC_ERROR_RETURN(((line_bytes * band_lines) / PDC_BLOCK_BYTES) <= PDC_SEGMENT_BLOCKS_MAX, SSP_ERR_INVALID_ARGUMENT);
+
+    /* Check if a transfer is already in progress */
+    PDC_ERROR_RETURN((p_ctrl->transfer_in_progress == false), SSP_ERR_IN_USE);
+
+    /** Capture the first band into the first buffer, the others are free. */
+    for (uint32_t i = 0U; i < num_buffers; i++)
+    {
+        p_ctrl->p_buffers[i] = pp_buffers[i];
+    }
+    p_ctrl->num_buffers      = num_buffers;
+    p_ctrl->buffer_index     = 0U;
+    p_ctrl->buffers_free     = ((1UL << num_buffers) - 1UL) & ~1UL;
+    p_ctrl->p_current_buffer = pp_buffers[0];
+    p_ctrl->frame            = 1U;
+    p_ctrl->dropped          = 0U;
+    p_ctrl->band_lines       = band_lines;
+    p_ctrl->band_drop        = false;
+    p_ctrl->streaming        = true;
+
+    ssp_err_t err = r_pdc_capture_start(p_ctrl);
+    if (SSP_SUCCESS != err)
+    {
+        p_ctrl->streaming  = false;
+        p_ctrl->band_lines = 0U;
+    }
+
+    return err;
+}
+
+/******************************************************************************
+ * End of function R_PDC_CaptureBandStart
+ ******************************************************************************/
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup PDC)
  **********************************************************************************************************************/
@@ -572,18 +786,39 @@ ssp_err_t R_PDC_VersionGet (ssp_version_t * const p_data)
 static void r_pdc_transfer_callback (transfer_callback_args_t * p_args)
 {
     pdc_instance_ctrl_t * p_ctrl = (pdc_instance_ctrl_t *) p_args->p_context;
-    pdc_callback_args_t pdc_args;
+    transfer_properties_t transfer_info = {0U};
 
     if (NULL != p_ctrl)
     {
-        p_ctrl->transfer_in_progress = false;
-        p_ctrl->p_lower_lvl_transfer->p_api->close(p_ctrl->p_lower_lvl_transfer->p_ctrl);
-        if (NULL != p_ctrl->p_callback)
+        /* If the frame end interrupt ran first, the next frame is already armed and this callback is late. */
+        p_ctrl->p_lower_lvl_transfer->p_api->infoGet(p_ctrl->p_lower_lvl_transfer->p_ctrl, &transfer_info);
+        if (transfer_info.in_progress || (0U != transfer_info.transfer_length_remaining))
+        {
+            return;
+        }
+
+        /* Bands are chained and delivered here, from the first band of a frame to the last. */
+        if (0U != p_ctrl->band_lines)
+        {
+            r_pdc_band_next(p_ctrl);
+            return;
+        }
+
+        /* Chain the next segment of a large frame. */
+        if ((p_ctrl->segment + 1U) < p_ctrl->num_segments)
         {
-            pdc_args.p_context = p_ctrl;
-            pdc_args.event     = PDC_EVENT_TRANSFER_COMPLETE;
-            pdc_args.p_buffer  = p_ctrl->p_current_buffer;
-            p_ctrl->p_callback(&pdc_args);
+            r_pdc_segment_arm(p_ctrl, p_ctrl->segment + 1U);
+            return;
+        }
+
+        /* A continuous capture delivers frames from the frame end interrupt. */
+        if (!p_ctrl->streaming)
+        {
+            uint64_t timestamp = 0U;
+            (void) R_BSP_TimestampGet(&timestamp);
+            p_ctrl->transfer_in_progress = false;
+            p_ctrl->frame++;
+            r_pdc_callback_call(p_ctrl, PDC_EVENT_TRANSFER_COMPLETE, p_ctrl->p_current_buffer, 0U, timestamp, 0U);
         }
     }
 }
@@ -598,10 +833,14 @@ static void r_pdc_transfer_callback (transfer_callback_args_t * p_args)
 void pdc_frame_end_isr (void)
 {
     uint16_t timeout = 0xFFFFu;
+    uint64_t timestamp = 0U;
 
     /* Save context if RTOS is used */
     SF_CONTEXT_SAVE
 
+    /* Timestamp the frame before waiting for the FIFO to drain. */
+    (void) R_BSP_TimestampGet(&timestamp);
+
     ssp_vector_info_t * p_vector_info = NULL;
     R_SSP_VectorInfoGet(R_SSP_CurrentIrqGet(), &p_vector_info);
     pdc_instance_ctrl_t * p_ctrl = (pdc_instance_ctrl_t *) *(p_vector_info->pp_ctrl);
@@ -614,7 +853,20 @@ void pdc_frame_end_isr (void)
         timeout--;
     }
 
-    if (0UL == (PDC_STATUS_FLAGS_UDRF & HW_PDC_StatusGet(p_ctrl->p_reg)))
+    if ((0UL == (PDC_STATUS_FLAGS_UDRF & HW_PDC_StatusGet(p_ctrl->p_reg))) && p_ctrl->streaming)
+    {
+        /* No underrun error. Keep the PDC running and re-arm the transfer before the next frame starts. */
+        HW_PDC_StatusClear(p_ctrl->p_reg,PDC_STATUS_FLAGS_FEF);
+
+        R_BSP_IrqStatusClear(R_SSP_CurrentIrqGet());
+
+        /* Band captures move on to the next frame from the transfer end interrupt of the last band. */
+        if (0U == p_ctrl->band_lines)
+        {
+            r_pdc_frame_next(p_ctrl, timestamp);
+        }
+    }
+    else if (0UL == (PDC_STATUS_FLAGS_UDRF & HW_PDC_StatusGet(p_ctrl->p_reg)))
     {
         /* No underrun error */
 
@@ -691,7 +943,6 @@ void pdc_int_isr (void)
  **********************************************************************************************************************/
 static void r_pdc_error_handler (pdc_instance_ctrl_t * p_ctrl)
 {
-    pdc_callback_args_t pdc_args;
     uint32_t            pdc_status;
     uint32_t            event = 0;
 
@@ -701,6 +952,11 @@ static void r_pdc_error_handler (pdc_instance_ctrl_t * p_ctrl)
     /* Disable the transfer */
     p_ctrl->p_lower_lvl_transfer->p_api->disable(p_ctrl->p_lower_lvl_transfer->p_ctrl);
 
+    /* The capture is stopped, a new one may be started. */
+    p_ctrl->streaming            = false;
+    p_ctrl->band_drop            = false;
+    p_ctrl->transfer_in_progress = false;
+
     if (NULL != p_ctrl->p_callback)
     {
         /* Get PDC status flags */
@@ -729,9 +985,9 @@ static void r_pdc_error_handler (pdc_instance_ctrl_t * p_ctrl)
             HW_PDC_StatusClear(p_ctrl->p_reg, PDC_STATUS_FLAGS_HERF);
         }
 
-        pdc_args.event     = (pdc_event_t)event;
-        pdc_args.p_context = p_ctrl->p_context;
-        p_ctrl->p_callback(&pdc_args);
+        uint64_t timestamp = 0U;
+        (void) R_BSP_TimestampGet(&timestamp);
+        r_pdc_callback_call(p_ctrl, (pdc_event_t)event, p_ctrl->p_current_buffer, 0U, timestamp, 0U);
     }
 }
 /******************************************************************************
@@ -825,3 +1081,353 @@ static void nvic_pdc_interrupts_enable(pdc_instance_ctrl_t * const p_ctrl)
 /******************************************************************************
  * End of function nvic_pdc_interrupts_enable
  ******************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @brief  Configures the PDC, arms the transfer for the first segment of p_current_buffer and starts the capture.
+ * @param[in]   p_ctrl   Pointer to PDC Specific Control Structure
+ **********************************************************************************************************************/
+static ssp_err_t r_pdc_capture_start (pdc_instance_ctrl_t * const p_ctrl)
+{
+    ssp_err_t err = SSP_SUCCESS;
+    uint32_t timeout     = PDC_TIMEOUT;
+    uint32_t reset_state = 0U;
+    uint32_t interrupt_setting = 0U;
+
+    /** Split the frame into segments the transfer interface can count, or into bands for a band capture. */
+    p_ctrl->frame_blocks  = (uint32_t) p_ctrl->x_capture_pixels;
+    p_ctrl->frame_blocks *= p_ctrl->bytes_per_pixel;
+    p_ctrl->frame_blocks *= p_ctrl->y_capture_pixels;
+    p_ctrl->frame_blocks /= PDC_BLOCK_BYTES;
+    p_ctrl->segment_blocks = PDC_SEGMENT_BLOCKS_MAX;
+    if (0U != p_ctrl->band_lines)
+    {
+        p_ctrl->segment_blocks  = (uint32_t) p_ctrl->x_capture_pixels;
+        p_ctrl->segment_blocks *= p_ctrl->bytes_per_pixel;
+        p_ctrl->segment_blocks *= p_ctrl->band_lines;
+        p_ctrl->segment_blocks /= PDC_BLOCK_BYTES;
+    }
+    p_ctrl->num_segments  = (p_ctrl->frame_blocks + (p_ctrl->segment_blocks - 1U)) / p_ctrl->segment_blocks;
+
+    /** Open the transfer interface on the first capture. */
+    if (!p_ctrl->transfer_open)
+    {
+        err = r_pdc_transfer_open(p_ctrl);
+        PDC_ERROR_RETURN((err == SSP_SUCCESS), err);
+    }
+
+    /* Mark transfer as in progress */
+    p_ctrl->transfer_in_progress = true;
+
+    /* Reset the PDC */
+    HW_PDC_Reset(p_ctrl->p_reg);
+
+    /** Wait for reset to complete */
+    reset_state = HW_PDC_GetResetState(p_ctrl->p_reg);
+    while ((timeout > 0u) && (1u == reset_state))
+    {
+        reset_state = HW_PDC_GetResetState(p_ctrl->p_reg);
+        timeout--;
+    }
+    if (0u == timeout)
+    {
+        p_ctrl->transfer_in_progress = false;
+        return SSP_ERR_TIMEOUT;
+    }
+    /** Set horizontal capture range */
+    HW_PDC_HSTSet(p_ctrl->p_reg, (uint32_t) (p_ctrl->x_capture_start_pixel * p_ctrl->bytes_per_pixel));
+
+    /** Set horizontal capture size */
+    HW_PDC_HSZSet(p_ctrl->p_reg, (uint32_t) (p_ctrl->x_capture_pixels * p_ctrl->bytes_per_pixel));
+
+    /** Set vertical capture range */
+    HW_PDC_VSTSet(p_ctrl->p_reg, p_ctrl->y_capture_start_pixel);
+
+    /** Set vertical capture size */
+    HW_PDC_VSZSet(p_ctrl->p_reg, p_ctrl->y_capture_pixels);
+
+    /** Set VSYNC polarity */
+    HW_PDC_VPSSet(p_ctrl->p_reg, p_ctrl->vsync_polarity);
+
+    /** Set HSYNC polarity */
+    HW_PDC_HPSSet(p_ctrl->p_reg, p_ctrl->hsync_polarity);
+
+    /** Set endianess of capture data */
+    HW_PDC_EndianSet(p_ctrl->p_reg, p_ctrl->endian);
+
+    /** Enable interrupts:
+     *  Receive data ready interrupt,
+     *  Underrun interrupt,
+     *  Overrun interrupt,
+     *  Frame end interrupt,
+     *  Vertical line number setting error interrupt,
+     *  Horizontal byte number setting error interrupt */
+    interrupt_setting = (uint32_t)( PDC_INTERRUPT_DFIE | PDC_INTERRUPT_UDRIE | PDC_INTERRUPT_OVIE |
+            PDC_INTERRUPT_FEIE | PDC_INTERRUPT_VERIE | PDC_INTERRUPT_HERIE);
+    HW_PDC_InterruptSet(p_ctrl->p_reg, interrupt_setting);
+
+    nvic_pdc_interrupts_enable(p_ctrl);
+
+    /** Arm the transfer for the first segment of the frame */
+    err = r_pdc_segment_arm(p_ctrl, 0U);
+    if (SSP_SUCCESS != err)
+    {
+        p_ctrl->transfer_in_progress = false;
+    }
+    PDC_ERROR_RETURN((err == SSP_SUCCESS), err);
+
+    /* Set PCCR1.PCE as 1 */
+    HW_PDC_Enable(p_ctrl->p_reg);
+
+    return SSP_SUCCESS;
+}
+/******************************************************************************
+ * End of function r_pdc_capture_start
+ ******************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @brief  Opens the transfer interface to move blocks of 8 words from PCDR on each receive data ready request. The
+ * transfer is not enabled until a segment is armed.
+ * @param[in]   p_ctrl   Pointer to PDC Specific Control Structure
+ **********************************************************************************************************************/
+static ssp_err_t r_pdc_transfer_open (pdc_instance_ctrl_t * const p_ctrl)
+{
+    transfer_cfg_t    pdc_transfer_cfg;
+    transfer_info_t * p_info = p_ctrl->p_lower_lvl_transfer->p_cfg->p_info;
+
+    /** Set up transfer interface */
+    p_info->chain_mode     = TRANSFER_CHAIN_MODE_DISABLED;
+    p_info->dest_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED;
+    p_info->irq            = TRANSFER_IRQ_END;
+    p_info->length         = (uint16_t) PDC_TRANSFERS_PER_BLOCK;
+    p_info->mode           = TRANSFER_MODE_BLOCK;
+    p_info->p_dest         = p_ctrl->p_current_buffer;
+    p_info->p_src          = (void const *) &R_PDC->PCDR;
+    p_info->repeat_area    = TRANSFER_REPEAT_AREA_SOURCE;
+    p_info->size           = TRANSFER_SIZE_4_BYTE;
+    p_info->src_addr_mode  = TRANSFER_ADDR_MODE_FIXED;
+    p_info->num_blocks     = (uint16_t) ((p_ctrl->frame_blocks < PDC_SEGMENT_BLOCKS_MAX) ? p_ctrl->frame_blocks :
+                                         PDC_SEGMENT_BLOCKS_MAX);
+
+    pdc_transfer_cfg.p_info            = p_info;
+    pdc_transfer_cfg.activation_source = ELC_EVENT_PDC_RECEIVE_DATA_READY;
+    pdc_transfer_cfg.auto_enable       = false;
+    pdc_transfer_cfg.p_context         = p_ctrl;
+    pdc_transfer_cfg.p_callback        = r_pdc_transfer_callback;
+    pdc_transfer_cfg.p_extend          = p_ctrl->p_lower_lvl_transfer->p_cfg->p_extend;
+    pdc_transfer_cfg.irq_ipl           = p_ctrl->p_lower_lvl_transfer->p_cfg->irq_ipl;
+
+    /** Open transfer interface */
+    ssp_err_t err = p_ctrl->p_lower_lvl_transfer->p_api->open(p_ctrl->p_lower_lvl_transfer->p_ctrl, &pdc_transfer_cfg);
+    PDC_ERROR_RETURN((err == SSP_SUCCESS), err);
+
+    p_ctrl->transfer_open = true;
+
+    return SSP_SUCCESS;
+}
+/******************************************************************************
+ * End of function r_pdc_transfer_open
+ ******************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @brief  Points the transfer at one segment of p_current_buffer and enables it. Segments of a frame follow each other
+ * in the buffer, while each band of a band capture starts at the beginning of its own buffer.
+ * @param[in]   p_ctrl    Pointer to PDC Specific Control Structure
+ * @param[in]   segment   Segment of the frame, 0 for the start of the frame
+ **********************************************************************************************************************/
+static ssp_err_t r_pdc_segment_arm (pdc_instance_ctrl_t * const p_ctrl, uint32_t segment)
+{
+    uint8_t * p_dest = p_ctrl->p_current_buffer;
+    uint32_t  blocks = p_ctrl->frame_blocks - (segment * p_ctrl->segment_blocks);
+    if (blocks > p_ctrl->segment_blocks)
+    {
+        blocks = p_ctrl->segment_blocks;
+    }
+
+    if (0U == p_ctrl->band_lines)
+    {
+        p_dest += segment * p_ctrl->segment_blocks * PDC_BLOCK_BYTES;
+    }
+
+    p_ctrl->segment = segment;
+
+    return p_ctrl->p_lower_lvl_transfer->p_api->reset(p_ctrl->p_lower_lvl_transfer->p_ctrl, NULL, p_dest,
+                                                      (uint16_t) blocks);
+}
+/******************************************************************************
+ * End of function r_pdc_segment_arm
+ ******************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @brief  Completes a frame of a continuous capture. The transfer is re-armed for a free buffer before the frame is
+ * delivered. Without a free buffer, or if the transfer did not reach the last segment, the frame is dropped and the
+ * next one is captured into the same buffer.
+ * @param[in]   p_ctrl      Pointer to PDC Specific Control Structure
+ * @param[in]   timestamp   Timestamp of the frame end
+ **********************************************************************************************************************/
+static void r_pdc_frame_next (pdc_instance_ctrl_t * const p_ctrl, uint64_t timestamp)
+{
+    uint8_t * p_frame = p_ctrl->p_current_buffer;
+    uint32_t  next    = p_ctrl->num_buffers;
+
+    p_ctrl->frame++;
+
+    if ((p_ctrl->segment + 1U) >= p_ctrl->num_segments)
+    {
+        next = r_pdc_buffer_take(p_ctrl);
+    }
+
+    if (next < p_ctrl->num_buffers)
+    {
+        uint32_t dropped = p_ctrl->dropped;
+
+        p_ctrl->dropped          = 0U;
+        p_ctrl->buffer_index     = next;
+        p_ctrl->p_current_buffer = p_ctrl->p_buffers[next];
+        r_pdc_segment_arm(p_ctrl, 0U);
+
+        r_pdc_callback_call(p_ctrl, PDC_EVENT_TRANSFER_COMPLETE, p_frame, dropped, timestamp, 0U);
+    }
+    else
+    {
+        p_ctrl->dropped++;
+        r_pdc_segment_arm(p_ctrl, 0U);
+    }
+}
+/******************************************************************************
+ * End of function r_pdc_frame_next
+ ******************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @brief  Completes a band of a band capture. The transfer is re-armed for the next band, in a free buffer, before the
+ * band is delivered. Without a free buffer the rest of the frame is captured into the same buffer and not delivered.
+ * @param[in]   p_ctrl   Pointer to PDC Specific Control Structure
+ **********************************************************************************************************************/
+static void r_pdc_band_next (pdc_instance_ctrl_t * const p_ctrl)
+{
+    uint8_t * p_band    = p_ctrl->p_current_buffer;
+    uint32_t  segment   = p_ctrl->segment;
+    bool      last      = ((segment + 1U) >= p_ctrl->num_segments);
+    uint32_t  next      = p_ctrl->num_buffers;
+    uint64_t  timestamp = 0U;
+
+    (void) R_BSP_TimestampGet(&timestamp);
+
+    if (!p_ctrl->band_drop)
+    {
+        next = r_pdc_buffer_take(p_ctrl);
+    }
+
+    if (next < p_ctrl->num_buffers)
+    {
+        p_ctrl->buffer_index     = next;
+        p_ctrl->p_current_buffer = p_ctrl->p_buffers[next];
+    }
+    else
+    {
+        p_ctrl->band_drop = true;
+    }
+
+    /** The last band is followed by the first band of the next frame. */
+    r_pdc_segment_arm(p_ctrl, last ? 0U : (segment + 1U));
+
+    if (next < p_ctrl->num_buffers)
+    {
+        uint32_t dropped = 0U;
+
+        if (0U == segment)
+        {
+            dropped         = p_ctrl->dropped;
+            p_ctrl->dropped = 0U;
+        }
+
+        r_pdc_callback_call(p_ctrl, PDC_EVENT_BAND_COMPLETE, p_band, dropped, timestamp, segment * p_ctrl->band_lines);
+    }
+    else if (last)
+    {
+        /* The frame was abandoned. The next frame starts in the buffer the driver kept. */
+        p_ctrl->dropped++;
+        p_ctrl->band_drop = false;
+    }
+    else
+    {
+        /* Do nothing, the rest of the frame is captured into the same buffer. */
+    }
+
+    /** Bands delivered from now on belong to the next frame. */
+    if (last)
+    {
+        p_ctrl->frame++;
+    }
+}
+/******************************************************************************
+ * End of function r_pdc_band_next
+ ******************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @brief  Takes the next free frame buffer after the current one.
+ * @param[in]   p_ctrl   Pointer to PDC Specific Control Structure
+ * @return  Index of the buffer in p_buffers, or num_buffers if no buffer is free.
+ **********************************************************************************************************************/
+static uint32_t r_pdc_buffer_take (pdc_instance_ctrl_t * const p_ctrl)
+{
+    uint32_t next = p_ctrl->num_buffers;
+
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    for (uint32_t i = 1U; i < p_ctrl->num_buffers; i++)
+    {
+        uint32_t index = (p_ctrl->buffer_index + i) % p_ctrl->num_buffers;
+        if (0U != (p_ctrl->buffers_free & (1UL << index)))
+        {
+            p_ctrl->buffers_free &= ~(1UL << index);
+            next = index;
+            break;
+        }
+    }
+    SSP_CRITICAL_SECTION_EXIT;
+
+    return next;
+}
+/******************************************************************************
+ * End of function r_pdc_buffer_take
+ ******************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @brief  Calls the user callback, if one is registered.
+ * @param[in]   p_ctrl      Pointer to PDC Specific Control Structure
+ * @param[in]   event       Event to report
+ * @param[in]   p_buffer    Buffer the event refers to
+ * @param[in]   dropped     Frames dropped since the previous frame was delivered
+ * @param[in]   timestamp   Timestamp of the event
+ * @param[in]   line        First line held in p_buffer, 0 unless the event is a band
+ **********************************************************************************************************************/
+static void r_pdc_callback_call (pdc_instance_ctrl_t * const p_ctrl,
+                                 pdc_event_t                 event,
+                                 uint8_t                   * p_buffer,
+                                 uint32_t                    dropped,
+                                 uint64_t                    timestamp,
+                                 uint32_t                    line)
+{
+    pdc_callback_args_t pdc_args;
+
+    if (NULL != p_ctrl->p_callback)
+    {
+        pdc_args.line      = line;
+        pdc_args.lines     = (uint32_t) p_ctrl->y_capture_pixels - line;
+        if ((PDC_EVENT_BAND_COMPLETE == event) && (pdc_args.lines > p_ctrl->band_lines))
+        {
+            pdc_args.lines = p_ctrl->band_lines;
+        }
+
+        pdc_args.event     = event;
+        pdc_args.p_buffer  = p_buffer;
+        pdc_args.p_context = p_ctrl->p_context;
+        pdc_args.frame     = p_ctrl->frame;
+        pdc_args.dropped   = dropped;
+        pdc_args.timestamp = timestamp;
+        p_ctrl->p_callback(&pdc_args);
+    }
+}
+/******************************************************************************
+ * End of function r_pdc_callback_call
+ ******************************************************************************/
@@ -36,6 +36,16 @@ ssp_err_t   R_PDC_StateGet (pdc_ctrl_t * const p_ctrl, pdc_state_t * p_state);
 
 ssp_err_t   R_PDC_VersionGet (ssp_version_t * const p_data);
 
+ssp_err_t   R_PDC_CaptureStreamStart (pdc_ctrl_t * const p_ctrl, uint8_t * const * const pp_buffers,
+                                      uint32_t num_buffers);
+
+ssp_err_t   R_PDC_CaptureStop (pdc_ctrl_t * const p_ctrl);
+
+ssp_err_t   R_PDC_BufferRelease (pdc_ctrl_t * const p_ctrl, uint8_t * const p_buffer);
+
+ssp_err_t   R_PDC_CaptureBandStart (pdc_ctrl_t * const p_ctrl, uint8_t * const * const pp_buffers,
+                                    uint32_t num_buffers, uint32_t band_lines);
+
 /* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
 SSP_FOOTER
 
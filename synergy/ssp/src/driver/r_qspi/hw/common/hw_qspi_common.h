@@ -108,6 +108,14 @@ __STATIC_INLINE void HW_QSPI_BYTE_WRITE (R_QSPI_Type * p_qspi_reg, uint8_t byte)
     p_qspi_reg->SFMCOM = byte;
 }
 
+/*******************************************************************************************************************//**
+ * Get the address of the direct communication data register, used as a transfer destination
+ **********************************************************************************************************************/
+__STATIC_INLINE void * HW_QSPI_BYTE_WRITE_ADDRESS_GET (R_QSPI_Type * p_qspi_reg)
+{
+    return (void *) &p_qspi_reg->SFMCOM;
+}
+
 /*******************************************************************************************************************//**
  * Read the QSPI communication status
  **********************************************************************************************************************/
@@ -89,6 +89,36 @@ static ssp_err_t qspi_validate_address_range (qspi_instance_ctrl_t * p_ctrl,
                                               uint8_t              * p_device_address,
                                               uint32_t               byte_count);
 
+static bool qspi_page_program_start (qspi_instance_ctrl_t * p_ctrl, uint32_t chip_address);
+
+static void qspi_page_program_end (qspi_instance_ctrl_t * p_ctrl, bool restore_spi_mode);
+
+static ssp_err_t qspi_async_param_check (qspi_instance_ctrl_t * p_ctrl,
+                                         uint8_t              * p_device_address,
+                                         uint8_t              * p_memory_address,
+                                         uint32_t               byte_count);
+
+static ssp_err_t qspi_transfer_open (qspi_instance_ctrl_t * p_ctrl,
+                                    transfer_size_t        size,
+                                    transfer_addr_mode_t   dest_addr_mode,
+                                    void                 * p_dest);
+
+static ssp_err_t qspi_timer_open (qspi_instance_ctrl_t * p_ctrl);
+
+static ssp_err_t qspi_read_next (qspi_instance_ctrl_t * p_ctrl);
+
+static ssp_err_t qspi_program_queue (qspi_instance_ctrl_t * p_ctrl);
+
+static ssp_err_t qspi_program_next (qspi_instance_ctrl_t * p_ctrl);
+
+static void qspi_program_poll (qspi_instance_ctrl_t * p_ctrl);
+
+static void qspi_async_end (qspi_instance_ctrl_t * p_ctrl, qspi_event_t event);
+
+static void qspi_transfer_callback (transfer_callback_args_t * p_args);
+
+static void qspi_timer_callback (timer_callback_args_t * p_args);
+
 /***********************************************************************************************************************
  * Private global variables
  **********************************************************************************************************************/
@@ -159,7 +189,9 @@ const qspi_api_t g_qspi_on_qspi =
     .sectorErase    = R_QSPI_SectorErase,
     .statusGet      = R_QSPI_StatusGet,
     .bankSelect     = R_QSPI_BankSelect,
-    .versionGet     = R_QSPI_VersionGet
+    .versionGet     = R_QSPI_VersionGet,
+    .readAsync      = R_QSPI_ReadAsync,
+    .programAsync   = R_QSPI_ProgramAsync
 };
 
 /***********************************************************************************************************************
@@ -180,6 +212,7 @@ const qspi_api_t g_qspi_on_qspi =
  * @return                         See @ref Common_Error_Codes or functions called by this function for other possible
  *                                 return codes. This function calls:
  *                                 * fmi_api_t::productFeatureGet
+ *                                 * timer_api_t::open
  **********************************************************************************************************************/
 ssp_err_t R_QSPI_Open (qspi_ctrl_t * p_api_ctrl, qspi_cfg_t const * const p_cfg)
 {
@@ -257,6 +290,31 @@ ssp_err_t R_QSPI_Open (qspi_ctrl_t * p_api_ctrl, qspi_cfg_t const * const p_cfg)
         return SSP_ERR_UNSUPPORTED;
     }
 
+    /** Remember the resources used by asynchronous operations. */
+    qspi_on_qspi_cfg_t const * p_extend = (qspi_on_qspi_cfg_t const *) p_cfg->p_extend;
+    p_ctrl->p_callback           = p_cfg->p_callback;
+    p_ctrl->p_context            = p_cfg->p_context;
+    p_ctrl->p_lower_lvl_transfer = NULL;
+    p_ctrl->p_lower_lvl_timer    = NULL;
+    p_ctrl->async_state          = (uint8_t) QSPI_PRV_ASYNC_IDLE;
+    if (NULL != p_extend)
+    {
+        p_ctrl->p_lower_lvl_transfer = p_extend->p_lower_lvl_transfer;
+        p_ctrl->p_lower_lvl_timer    = p_extend->p_lower_lvl_timer;
+    }
+
+    /** Open the write in progress poll timer. It runs only while an asynchronous program is in progress. */
+    if (NULL != p_ctrl->p_lower_lvl_timer)
+    {
+        err = qspi_timer_open(p_ctrl);
+        if (SSP_SUCCESS != err)
+        {
+            /* Release hardware lock. */
+            R_BSP_HardwareUnlock(&ssp_feature);
+            return err;
+        }
+    }
+
     /** Mark driver as opened by initializing it to "RQSP" in its ASCII equivalent for this unit. */
     p_ctrl->open = RQSPI_OPEN;
 
@@ -296,6 +354,21 @@ ssp_err_t R_QSPI_Close (qspi_ctrl_t * p_api_ctrl)
     /** Check if the device is open */
     QSPI_ERROR_RETURN(p_ctrl->manufacturer_id != 0U, SSP_ERR_NOT_OPEN);
 
+    /** Stop an asynchronous operation in progress without a callback, and release the lower level drivers. */
+    if (NULL != p_ctrl->p_lower_lvl_timer)
+    {
+        p_ctrl->p_lower_lvl_timer->p_api->close(p_ctrl->p_lower_lvl_timer->p_ctrl);
+    }
+    if ((uint8_t) QSPI_PRV_ASYNC_IDLE != p_ctrl->async_state)
+    {
+        p_ctrl->p_lower_lvl_transfer->p_api->close(p_ctrl->p_lower_lvl_transfer->p_ctrl);
+        if ((uint8_t) QSPI_PRV_ASYNC_PROGRAM_DATA == p_ctrl->async_state)
+        {
+            qspi_page_program_end(p_ctrl, p_ctrl->async_restore_spi_mode);
+        }
+        p_ctrl->async_state = (uint8_t) QSPI_PRV_ASYNC_IDLE;
+    }
+
     /** Re-enter XIP mode if it was running in this mode before entering opening the driver */
     if (p_ctrl->xip_mode)
     {
@@ -324,6 +397,7 @@ ssp_err_t R_QSPI_Close (qspi_ctrl_t * p_api_ctrl)
  * @retval SSP_ERR_UNSUPPORTED     The device address is invalid.
  * @retval SSP_ERR_ASSERTION       p_ctrl,p_device_address or p_memory_address is NULL.
  * @retval SSP_ERR_NOT_OPEN        Driver is not opened.
+ * @retval SSP_ERR_IN_USE          An asynchronous operation is in progress.
  * @retval SSP_ERR_TRANSFER_BUSY   Another serial communications transfer is in progress.
  **********************************************************************************************************************/
 ssp_err_t R_QSPI_Read (qspi_ctrl_t * p_api_ctrl,
@@ -347,6 +421,7 @@ ssp_err_t R_QSPI_Read (qspi_ctrl_t * p_api_ctrl,
     QSPI_ERROR_RETURN(SSP_SUCCESS == err, err);
 
     /** Make sure no other communication is in progress. */
+    QSPI_ERROR_RETURN((uint8_t) QSPI_PRV_ASYNC_IDLE == p_ctrl->async_state, SSP_ERR_IN_USE);
     QSPI_ERROR_RETURN(!HW_QSPI_COM_STATUS_READ(p_ctrl->p_reg), SSP_ERR_TRANSFER_BUSY);
 
     memcpy(p_memory_address, p_device_address, byte_count);
@@ -362,6 +437,7 @@ ssp_err_t R_QSPI_Read (qspi_ctrl_t * p_api_ctrl,
  * @retval SSP_ERR_ASSERTION            p_ctrl, p_device_address or p_memory_address is NULL.
  * @retval SSP_ERR_INVALID_ARGUMENT     Invalid parameter is passed.
  * @retval SSP_ERR_NOT_OPEN             Driver is not opened.
+ * @retval SSP_ERR_IN_USE               An asynchronous operation is in progress.
  **********************************************************************************************************************/
 ssp_err_t R_QSPI_PageProgram (qspi_ctrl_t * p_api_ctrl,
                               uint8_t     * p_device_address,
@@ -379,61 +455,8 @@ ssp_err_t R_QSPI_PageProgram (qspi_ctrl_t * p_api_ctrl,
 
     uint32_t chip_address      = (uint32_t) p_device_address - BSP_PRV_QSPI_DEVICE_PHYSICAL_ADDRESS;
 
-    /* Place the QSPI block into Direct Communication mode */
-    HW_QSPI_DIRECT_COMMUNICATION_ENTER(p_ctrl->p_reg);
-
-    /** Send command to enable writing */
-    HW_QSPI_BYTE_WRITE(p_ctrl->p_reg, QSPI_COMMAND_WRITE_ENABLE);
-
-    /* Close the SPI bus cycle */
-    HW_QSPI_DIRECT_COMMUNICATION_ENTER(p_ctrl->p_reg);
-
-    bool restore_spi_mode = false;
-    void (*write_command) (R_QSPI_Type * p_qspi_reg, uint8_t byte) = qspi_d0_byte_write_standard;
-    void (*write_address) (R_QSPI_Type * p_qspi_reg, uint8_t byte) = qspi_d0_byte_write_standard;
-
-    /** If the peripheral is in extended SPI mode, and the configuration provided in the BSP allows for programming on
-     * multiple data lines, and a unique command is provided for the required mode, update the SPI protocol to send
-     * data on multiple lines. */
-    uint8_t command = g_qspi_prv_program_command[p_ctrl->data_lines][p_ctrl->num_address_bytes >> 2U];
-    uint8_t one_line_command = g_qspi_prv_program_command[QSPI_EXTENDED_SPI_PROTOCOL][p_ctrl->num_address_bytes >> 2U];
-    if ((QSPI_EXTENDED_SPI_PROTOCOL == HW_QSPI_SPI_MODE_GET(p_ctrl->p_reg)) && (command != one_line_command))
-    {
-        /* Exit direct communication mode to update the SPI protocol. */
-        HW_QSPI_DIRECT_COMMUNICATION_EXIT(p_ctrl->p_reg);
-
-        HW_QSPI_SPI_MODE_SET(p_ctrl->p_reg, p_ctrl->data_lines);
-
-        /* Place the QSPI block back into direct communication mode. */
-        HW_QSPI_DIRECT_COMMUNICATION_ENTER(p_ctrl->p_reg);
-
-        restore_spi_mode = true;
-
-        /* Write command in extended SPI mode on one line. */
-        write_command = gp_qspi_prv_byte_write[p_ctrl->data_lines];
-
-#ifdef QSPI_PAGE_PROGRAM_ADDRESS_ONE_LINE
-#if QSPI_PAGE_PROGRAM_ADDRESS_ONE_LINE == 1U
-        /* Write address in extended SPI mode on one line. */
-        write_address = gp_qspi_prv_byte_write[p_ctrl->data_lines];
-#endif
-#endif
-    }
-
-    /** Send command to write data */
-    write_command(p_ctrl->p_reg, command);
-
-    /** Write the address. */
-    if (p_ctrl->num_address_bytes == QSPI_4_BYTE_ADDRESS)
-    {
-        /* Send the MSByte of the address */
-        write_address(p_ctrl->p_reg, (uint8_t) (chip_address >> 24));
-    }
-
-    /* Send the remaining bytes of the address */
-    write_address(p_ctrl->p_reg, (uint8_t) (chip_address >> 16));
-    write_address(p_ctrl->p_reg, (uint8_t) (chip_address >> 8));
-    write_address(p_ctrl->p_reg, (uint8_t) (chip_address));
+    /** Send the command and address */
+    bool restore_spi_mode = qspi_page_program_start(p_ctrl, chip_address);
 
     /** Write the data. */
     while (byte_count)
@@ -444,30 +467,8 @@ ssp_err_t R_QSPI_PageProgram (qspi_ctrl_t * p_api_ctrl,
         byte_count = byte_count - 1;
     }
 
-    /* Close the SPI bus cycle */
-    HW_QSPI_DIRECT_COMMUNICATION_ENTER(p_ctrl->p_reg);
-
-    /** If the SPI protocol was modified in this function, restore it. */
-    if (restore_spi_mode)
-    {
-        /* Exit direct communication mode to restore the SPI protocol setting. */
-        HW_QSPI_DIRECT_COMMUNICATION_EXIT(p_ctrl->p_reg);
-
-        /* Restore SPI mode to extended SPI mode. */
-        HW_QSPI_SPI_MODE_SET(p_ctrl->p_reg, 0U);
-
-        /* Place the QSPI block back into direct communication mode,. */
-        HW_QSPI_DIRECT_COMMUNICATION_ENTER(p_ctrl->p_reg);
-    }
-
-    /** Send command to disable writing */
-    HW_QSPI_BYTE_WRITE(p_ctrl->p_reg, QSPI_COMMAND_WRITE_DISABLE);
-
-    /* Close the SPI bus cycle */
-    HW_QSPI_DIRECT_COMMUNICATION_ENTER(p_ctrl->p_reg);
-
-    /* Return to ROM access mode */
-    HW_QSPI_DIRECT_COMMUNICATION_EXIT(p_ctrl->p_reg);
+    /** Close the bus cycle and return to ROM access mode */
+    qspi_page_program_end(p_ctrl, restore_spi_mode);
 
     return SSP_SUCCESS;
 }
@@ -480,6 +481,7 @@ ssp_err_t R_QSPI_PageProgram (qspi_ctrl_t * p_api_ctrl,
  * @retval SSP_ERR_ASSERTION        p_ctrl or p_device_address is NULL.
  * @retval SSP_ERR_INVALID_ARGUMENT Invalid byte_count entered.
  * @retval SSP_ERR_NOT_OPEN         Driver is not opened.
+ * @retval SSP_ERR_IN_USE           An asynchronous operation is in progress.
  **********************************************************************************************************************/
 ssp_err_t R_QSPI_Erase(qspi_ctrl_t * p_api_ctrl, uint8_t * p_device_address, uint32_t byte_count)
 {
@@ -493,6 +495,9 @@ ssp_err_t R_QSPI_Erase(qspi_ctrl_t * p_api_ctrl, uint8_t * p_device_address, uin
     /** Check if the device is open */
     QSPI_ERROR_RETURN(p_ctrl->manufacturer_id != 0U, SSP_ERR_NOT_OPEN);
 
+    /** Make sure no asynchronous operation is in progress */
+    QSPI_ERROR_RETURN((uint8_t) QSPI_PRV_ASYNC_IDLE == p_ctrl->async_state, SSP_ERR_IN_USE);
+
     ssp_err_t      ret_val    = SSP_ERR_INVALID_ARGUMENT;
     qspi_info_t    qspi_info = {0};
     uint8_t        size_index = 0;
@@ -601,6 +606,7 @@ ssp_err_t R_QSPI_InfoGet(qspi_ctrl_t  * p_api_ctrl, qspi_info_t  * const p_info)
  * @retval SSP_ERR_UNSUPPORTED     The device address is invalid.
  * @retval SSP_ERR_ASSERTION       p_ctrl or p_device_address is NULL.
  * @retval SSP_ERR_NOT_OPEN        Driver is not opened.
+ * @retval SSP_ERR_IN_USE          An asynchronous operation is in progress.
  **********************************************************************************************************************/
 ssp_err_t R_QSPI_SectorErase (qspi_ctrl_t * p_api_ctrl, uint8_t * p_device_address)
 {
@@ -620,6 +626,9 @@ ssp_err_t R_QSPI_SectorErase (qspi_ctrl_t * p_api_ctrl, uint8_t * p_device_addre
     /** Check if the device is open */
     QSPI_ERROR_RETURN(p_ctrl->manufacturer_id != 0U, SSP_ERR_NOT_OPEN);
 
+    /** Make sure no asynchronous operation is in progress */
+    QSPI_ERROR_RETURN((uint8_t) QSPI_PRV_ASYNC_IDLE == p_ctrl->async_state, SSP_ERR_IN_USE);
+
     /** Place the QSPI block into Direct Communication mode */
     HW_QSPI_DIRECT_COMMUNICATION_ENTER(p_ctrl->p_reg);
 
@@ -667,6 +676,11 @@ ssp_err_t R_QSPI_SectorErase (qspi_ctrl_t * p_api_ctrl, uint8_t * p_device_addre
  *
  * Return the write status of the flash. This is most useful for determining if erases are complete.
  *
+ * While R_QSPI_ProgramAsync() is in progress the flash is busy until the last page is written, and the status of the
+ * flash is read only between pages.  If no poll timer is configured, this function is the write in progress poll and
+ * sends the next page once the flash is idle.  While R_QSPI_ReadAsync() is in progress no write is in progress, and
+ * the flash is not accessed.
+ *
  * @retval SSP_SUCCESS             The write status is correct.
  * @retval SSP_ERR_ASSERTION        p_ctrl or p_write_in_progress is NULL.
  * @retval SSP_ERR_NOT_OPEN        Driver is not opened.
@@ -683,6 +697,18 @@ ssp_err_t R_QSPI_StatusGet (qspi_ctrl_t * p_api_ctrl, bool * p_write_in_progress
     /** Check if the device is open */
     QSPI_ERROR_RETURN(p_ctrl->manufacturer_id != 0U, SSP_ERR_NOT_OPEN);
 
+    /** Report the asynchronous operation in progress instead of accessing the flash during it */
+    if ((uint8_t) QSPI_PRV_ASYNC_IDLE != p_ctrl->async_state)
+    {
+        if (NULL == p_ctrl->p_lower_lvl_timer)
+        {
+            qspi_program_poll(p_ctrl);
+        }
+        *p_write_in_progress = ((uint8_t) QSPI_PRV_ASYNC_PROGRAM_DATA == p_ctrl->async_state) ||
+                               ((uint8_t) QSPI_PRV_ASYNC_PROGRAM_WAIT == p_ctrl->async_state);
+        return SSP_SUCCESS;
+    }
+
     /** Place the QSPI block into Direct Communication mode */
     HW_QSPI_DIRECT_COMMUNICATION_ENTER(p_ctrl->p_reg);
 
@@ -729,6 +755,158 @@ ssp_err_t R_QSPI_VersionGet (ssp_version_t * const p_version)
     return SSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * @brief  Start reading data from the flash with the transfer instance.
+ *
+ * The transfer copies the data out of the memory mapped window in chunks of up to its maximum length.  Each chunk is
+ * started by software, the first one here and the next ones from the transfer end interrupt.  The widest transfer size
+ * that both addresses are aligned to is used.  The CPU copies the last bytes that do not fill a transfer, and then the
+ * callback reports QSPI_EVENT_READ_COMPLETE.  The callback is called from this function if no transfer is needed.
+ *
+ * @retval SSP_SUCCESS             The read was started.
+ * @retval SSP_ERR_UNSUPPORTED     The device address is invalid, or no transfer instance or callback is configured.
+ * @retval SSP_ERR_ASSERTION       p_ctrl, p_device_address or p_memory_address is NULL.
+ * @retval SSP_ERR_NOT_OPEN        Driver is not opened.
+ * @retval SSP_ERR_IN_USE          An asynchronous operation is in progress.
+ * @retval SSP_ERR_TRANSFER_BUSY   Another serial communications transfer is in progress.
+ * @return                         See @ref Common_Error_Codes or functions called by this function for other possible
+ *                                 return codes. This function calls:
+ *                                 * transfer_api_t::open
+ *                                 * transfer_api_t::infoGet
+ *                                 * transfer_api_t::reset
+ *                                 * transfer_api_t::start
+ **********************************************************************************************************************/
+ssp_err_t R_QSPI_ReadAsync (qspi_ctrl_t * p_api_ctrl,
+                            uint8_t     * p_device_address,
+                            uint8_t     * p_memory_address,
+                            uint32_t    byte_count)
+{
+    qspi_instance_ctrl_t * p_ctrl = (qspi_instance_ctrl_t *) p_api_ctrl;
+
+    ssp_err_t err = qspi_async_param_check(p_ctrl, p_device_address, p_memory_address, byte_count);
+    QSPI_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    /** Use the widest transfer size that both addresses are aligned to */
+    uint32_t        alignment = (uint32_t) p_device_address | (uint32_t) p_memory_address;
+    transfer_size_t size      = TRANSFER_SIZE_1_BYTE;
+    if (0U == (alignment & 3U))
+    {
+        size = TRANSFER_SIZE_4_BYTE;
+    }
+    else if (0U == (alignment & 1U))
+    {
+        size = TRANSFER_SIZE_2_BYTE;
+    }
+
+    p_ctrl->async_unit      = (uint8_t) (1U << (uint32_t) size);
+    p_ctrl->p_async_device  = p_device_address;
+    p_ctrl->p_async_memory  = p_memory_address;
+    p_ctrl->async_tail      = byte_count % p_ctrl->async_unit;
+    p_ctrl->async_remaining = byte_count - p_ctrl->async_tail;
+
+    err = qspi_transfer_open(p_ctrl, size, TRANSFER_ADDR_MODE_INCREMENTED, p_memory_address);
+    QSPI_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    /** Start the first chunk */
+    p_ctrl->async_state = (uint8_t) QSPI_PRV_ASYNC_READ;
+    err = qspi_read_next(p_ctrl);
+    if (SSP_SUCCESS != err)
+    {
+        p_ctrl->p_lower_lvl_transfer->p_api->close(p_ctrl->p_lower_lvl_transfer->p_ctrl);
+        p_ctrl->async_state = (uint8_t) QSPI_PRV_ASYNC_IDLE;
+    }
+    QSPI_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Start programming data to erased flash, one page at a time.
+ *
+ * The data is split at page boundaries.  For each page the CPU sends the command and address, and the transfer writes
+ * the data to the direct communication register.  While the flash writes a page, the next page is already queued in
+ * the transfer.  It is sent once the write in progress poll finds the flash idle.  The poll runs from the timer
+ * configured in ::qspi_on_qspi_cfg_t, or from R_QSPI_StatusGet() if there is no timer.  The callback reports
+ * QSPI_EVENT_PROGRAM_COMPLETE when the flash is idle after the last page.  If the flash is still busy with an earlier
+ * write, the first page is also sent from the poll.
+ *
+ * @retval SSP_SUCCESS             The first page was sent or queued.
+ * @retval SSP_ERR_UNSUPPORTED     The device address is invalid, or no transfer instance or callback is configured.
+ * @retval SSP_ERR_ASSERTION       p_ctrl, p_device_address or p_memory_address is NULL.
+ * @retval SSP_ERR_NOT_OPEN        Driver is not opened.
+ * @retval SSP_ERR_IN_USE          An asynchronous operation is in progress.
+ * @retval SSP_ERR_TRANSFER_BUSY   Another serial communications transfer is in progress.
+ * @return                         See @ref Common_Error_Codes or functions called by this function for other possible
+ *                                 return codes. This function calls:
+ *                                 * transfer_api_t::open
+ *                                 * transfer_api_t::reset
+ *                                 * transfer_api_t::start
+ *                                 * timer_api_t::start
+ **********************************************************************************************************************/
+ssp_err_t R_QSPI_ProgramAsync (qspi_ctrl_t * p_api_ctrl,
+                               uint8_t     * p_device_address,
+                               uint8_t     * p_memory_address,
+                               uint32_t    byte_count)
+{
+    qspi_instance_ctrl_t * p_ctrl = (qspi_instance_ctrl_t *) p_api_ctrl;
+
+    ssp_err_t err = qspi_async_param_check(p_ctrl, p_device_address, p_memory_address, byte_count);
+    QSPI_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    p_ctrl->async_unit      = 1U;
+    p_ctrl->p_async_device  = p_device_address;
+    p_ctrl->p_async_memory  = p_memory_address;
+    p_ctrl->async_tail      = 0U;
+    p_ctrl->async_remaining = byte_count;
+
+    err = qspi_transfer_open(p_ctrl, TRANSFER_SIZE_1_BYTE, TRANSFER_ADDR_MODE_FIXED,
+                             HW_QSPI_BYTE_WRITE_ADDRESS_GET(p_ctrl->p_reg));
+    QSPI_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    /** Queue the first page and send it now if the flash is idle.  The following pages are sent from the write in
+     * progress poll. */
+    p_ctrl->async_state = (uint8_t) QSPI_PRV_ASYNC_PROGRAM_WAIT;
+    err = qspi_program_queue(p_ctrl);
+    if (SSP_SUCCESS == err)
+    {
+        bool write_in_progress = true;
+
+        HW_QSPI_DIRECT_COMMUNICATION_ENTER(p_ctrl->p_reg);
+        bsp_qspi_status_get(&write_in_progress);
+        HW_QSPI_DIRECT_COMMUNICATION_EXIT(p_ctrl->p_reg);
+
+        if (!write_in_progress)
+        {
+            err = qspi_program_next(p_ctrl);
+        }
+    }
+    if (SSP_SUCCESS != err)
+    {
+        p_ctrl->p_lower_lvl_transfer->p_api->close(p_ctrl->p_lower_lvl_transfer->p_ctrl);
+        p_ctrl->async_state = (uint8_t) QSPI_PRV_ASYNC_IDLE;
+    }
+    QSPI_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    /** Start polling unless the program already completed.  If the poll cannot run, stop the program as
+     * R_QSPI_Close does, ending the bus cycle of a page whose data is being sent. */
+    if ((NULL != p_ctrl->p_lower_lvl_timer) && ((uint8_t) QSPI_PRV_ASYNC_IDLE != p_ctrl->async_state))
+    {
+        err = p_ctrl->p_lower_lvl_timer->p_api->start(p_ctrl->p_lower_lvl_timer->p_ctrl);
+        if (SSP_SUCCESS != err)
+        {
+            p_ctrl->p_lower_lvl_transfer->p_api->close(p_ctrl->p_lower_lvl_transfer->p_ctrl);
+            if ((uint8_t) QSPI_PRV_ASYNC_PROGRAM_DATA == p_ctrl->async_state)
+            {
+                qspi_page_program_end(p_ctrl, p_ctrl->async_restore_spi_mode);
+            }
+            p_ctrl->async_state = (uint8_t) QSPI_PRV_ASYNC_IDLE;
+        }
+        QSPI_ERROR_RETURN(SSP_SUCCESS == err, err);
+    }
+
+    return SSP_SUCCESS;
+}
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup QSPI)
  **********************************************************************************************************************/
@@ -806,6 +984,7 @@ static void qspi_d0_byte_write_standard (R_QSPI_Type * p_qspi_reg, uint8_t byte)
  * @retval SSP_ERR_ASSERTION            p_ctrl,p_device_address or p_memory_address is NULL.
  * @retval SSP_ERR_INVALID_ARGUMENT     Invalid parameter is passed.
  * @retval SSP_ERR_NOT_OPEN             Driver is not opened.
+ * @retval SSP_ERR_IN_USE               An asynchronous operation is in progress.
  **********************************************************************************************************************/
 static ssp_err_t qspi_program_param_check (qspi_instance_ctrl_t * p_ctrl,
                                            uint8_t              * p_device_address,
@@ -829,6 +1008,9 @@ static ssp_err_t qspi_program_param_check (qspi_instance_ctrl_t * p_ctrl,
     /* Check if byte_count is valid */
     QSPI_ERROR_RETURN(byte_count <= p_ctrl->page_size, SSP_ERR_INVALID_ARGUMENT);
 
+    /* Make sure no asynchronous operation is in progress */
+    QSPI_ERROR_RETURN((uint8_t) QSPI_PRV_ASYNC_IDLE == p_ctrl->async_state, SSP_ERR_IN_USE);
+
     return SSP_SUCCESS;
 }
 
@@ -869,3 +1051,434 @@ static ssp_err_t qspi_validate_address_range (qspi_instance_ctrl_t * p_ctrl,
 
     return SSP_SUCCESS;
 }
+
+/*******************************************************************************************************************//**
+ * Enter direct communication mode and send the write enable, page program command and address of a page.  The data
+ * is written to SFMCOM next, followed by qspi_page_program_end().
+ *
+ * @param[in] p_ctrl               Pointer to a driver handle
+ * @param[in] chip_address         Address of the first byte to write in the flash device
+ *
+ * @return  true if the SPI protocol was changed for the data and must be restored by qspi_page_program_end().
+ **********************************************************************************************************************/
+static bool qspi_page_program_start (qspi_instance_ctrl_t * p_ctrl, uint32_t chip_address)
+{
+    /* Place the QSPI block into Direct Communication mode */
+    HW_QSPI_DIRECT_COMMUNICATION_ENTER(p_ctrl->p_reg);
+
+    /** Send command to enable writing */
+    HW_QSPI_BYTE_WRITE(p_ctrl->p_reg, QSPI_COMMAND_WRITE_ENABLE);
+
+    /* Close the SPI bus cycle */
+    HW_QSPI_DIRECT_COMMUNICATION_ENTER(p_ctrl->p_reg);
+
+    bool restore_spi_mode = false;
+
+    void (*write_command) (R_QSPI_Type * p_qspi_reg, uint8_t byte) = qspi_d0_byte_write_standard;
+    void (*write_address) (R_QSPI_Type * p_qspi_reg, uint8_t byte) = qspi_d0_byte_write_standard;
+
+    /** If the peripheral is in extended SPI mode, and the configuration provided in the BSP allows for programming on
+     * multiple data lines, and a unique command is provided for the required mode, update the SPI protocol to send
+     * data on multiple lines. */
+    uint8_t command = g_qspi_prv_program_command[p_ctrl->data_lines][p_ctrl->num_address_bytes >> 2U];
+    uint8_t one_line_command = g_qspi_prv_program_command[QSPI_EXTENDED_SPI_PROTOCOL][p_ctrl->num_address_bytes >> 2U];
+    if ((QSPI_EXTENDED_SPI_PROTOCOL == HW_QSPI_SPI_MODE_GET(p_ctrl->p_reg)) && (command != one_line_command))
+    {
+        /* Exit direct communication mode to update the SPI protocol. */
+        HW_QSPI_DIRECT_COMMUNICATION_EXIT(p_ctrl->p_reg);
+
+        HW_QSPI_SPI_MODE_SET(p_ctrl->p_reg, p_ctrl->data_lines);
+
+        /* Place the QSPI block back into direct communication mode. */
+        HW_QSPI_DIRECT_COMMUNICATION_ENTER(p_ctrl->p_reg);
+
+        restore_spi_mode = true;
+
+        /* Write command in extended SPI mode on one line. */
+        write_command = gp_qspi_prv_byte_write[p_ctrl->data_lines];
+
+#ifdef QSPI_PAGE_PROGRAM_ADDRESS_ONE_LINE
+#if QSPI_PAGE_PROGRAM_ADDRESS_ONE_LINE == 1U
+        /* Write address in extended SPI mode on one line. */
+        write_address = gp_qspi_prv_byte_write[p_ctrl->data_lines];
+#endif
+#endif
+    }
+
+    /** Send command to write data */
+    write_command(p_ctrl->p_reg, command);
+
+    /** Write the address. */
+    if (p_ctrl->num_address_bytes == QSPI_4_BYTE_ADDRESS)
+    {
+        /* Send the MSByte of the address */
+        write_address(p_ctrl->p_reg, (uint8_t) (chip_address >> 24));
+    }
+
+    /* Send the remaining bytes of the address */
+    write_address(p_ctrl->p_reg, (uint8_t) (chip_address >> 16));
+    write_address(p_ctrl->p_reg, (uint8_t) (chip_address >> 8));
+    write_address(p_ctrl->p_reg, (uint8_t) (chip_address));
+
+    return restore_spi_mode;
+}
+
+/*******************************************************************************************************************//**
+ * Close the bus cycle of a page program so the flash starts writing the page, disable writing and return to ROM access
+ * mode.
+ *
+ * @param[in] p_ctrl               Pointer to a driver handle
+ * @param[in] restore_spi_mode     Value returned by qspi_page_program_start()
+ **********************************************************************************************************************/
+static void qspi_page_program_end (qspi_instance_ctrl_t * p_ctrl, bool restore_spi_mode)
+{
+    /* Close the SPI bus cycle */
+    HW_QSPI_DIRECT_COMMUNICATION_ENTER(p_ctrl->p_reg);
+
+    /** If the SPI protocol was modified for the data, restore it. */
+    if (restore_spi_mode)
+    {
+        /* Exit direct communication mode to restore the SPI protocol setting. */
+        HW_QSPI_DIRECT_COMMUNICATION_EXIT(p_ctrl->p_reg);
+
+        /* Restore SPI mode to extended SPI mode. */
+        HW_QSPI_SPI_MODE_SET(p_ctrl->p_reg, 0U);
+
+        /* Place the QSPI block back into direct communication mode,. */
+        HW_QSPI_DIRECT_COMMUNICATION_ENTER(p_ctrl->p_reg);
+    }
+
+    /** Send command to disable writing */
+    HW_QSPI_BYTE_WRITE(p_ctrl->p_reg, QSPI_COMMAND_WRITE_DISABLE);
+
+    /* Close the SPI bus cycle */
+    HW_QSPI_DIRECT_COMMUNICATION_ENTER(p_ctrl->p_reg);
+
+    /* Return to ROM access mode */
+    HW_QSPI_DIRECT_COMMUNICATION_EXIT(p_ctrl->p_reg);
+}
+
+/*******************************************************************************************************************//**
+ * Parameter checking for R_QSPI_ReadAsync and R_QSPI_ProgramAsync.
+ *
+ * @param[in] p_ctrl               Pointer to a driver handle
+ * @param[in] p_device_address     The location in the flash device address space
+ * @param[in] p_memory_address     The memory address of the data
+ * @param[in] byte_count           The number of bytes
+ *
+ * @retval SSP_SUCCESS             Parameters are valid.
+ * @retval SSP_ERR_UNSUPPORTED     The device address is invalid, or no transfer instance or callback is configured.
+ * @retval SSP_ERR_ASSERTION       p_ctrl, p_device_address or p_memory_address is NULL.
+ * @retval SSP_ERR_NOT_OPEN        Driver is not opened.
+ * @retval SSP_ERR_IN_USE          An asynchronous operation is in progress.
+ * @retval SSP_ERR_TRANSFER_BUSY   Another serial communications transfer is in progress.
+ **********************************************************************************************************************/
+static ssp_err_t qspi_async_param_check (qspi_instance_ctrl_t * p_ctrl,
+                                         uint8_t              * p_device_address,
+                                         uint8_t              * p_memory_address,
+                                         uint32_t               byte_count)
+{
+#if QSPI_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(p_ctrl);
+    SSP_ASSERT(p_device_address);
+    SSP_ASSERT(p_memory_address);
+#else
+    /* Memory address not used in this function. */
+    SSP_PARAMETER_NOT_USED (p_memory_address);
+#endif
+
+    /* Check if the device is open */
+    QSPI_ERROR_RETURN(p_ctrl->manufacturer_id != 0U, SSP_ERR_NOT_OPEN);
+
+    /* Asynchronous operations need a transfer instance and a callback */
+    QSPI_ERROR_RETURN(NULL != p_ctrl->p_lower_lvl_transfer, SSP_ERR_UNSUPPORTED);
+    QSPI_ERROR_RETURN(NULL != p_ctrl->p_callback, SSP_ERR_UNSUPPORTED);
+
+    /* Check whether the device address is valid */
+    ssp_err_t err = qspi_validate_address_range(p_ctrl, p_device_address, byte_count);
+    QSPI_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    /* Make sure no other communication is in progress. */
+    QSPI_ERROR_RETURN((uint8_t) QSPI_PRV_ASYNC_IDLE == p_ctrl->async_state, SSP_ERR_IN_USE);
+    QSPI_ERROR_RETURN(!HW_QSPI_COM_STATUS_READ(p_ctrl->p_reg), SSP_ERR_TRANSFER_BUSY);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Open the transfer instance for an asynchronous operation.  Transfers are started by software, from an incrementing
+ * source, and interrupt at the end.
+ *
+ * @param[in] p_ctrl               Pointer to a driver handle
+ * @param[in] size                 Size of each transfer
+ * @param[in] dest_addr_mode       Fixed for SFMCOM, incremented for memory
+ * @param[in] p_dest               Destination address
+ *
+ * @retval SSP_SUCCESS             Transfer opened.
+ * @return                         See @ref Common_Error_Codes or functions called by this function for other possible
+ *                                 return codes. This function calls:
+ *                                 * transfer_api_t::open
+ **********************************************************************************************************************/
+static ssp_err_t qspi_transfer_open (qspi_instance_ctrl_t * p_ctrl,
+                                    transfer_size_t        size,
+                                    transfer_addr_mode_t   dest_addr_mode,
+                                    void                 * p_dest)
+{
+    transfer_instance_t const * p_transfer = p_ctrl->p_lower_lvl_transfer;
+
+    transfer_cfg_t    cfg    = *(p_transfer->p_cfg);
+    transfer_info_t * p_info = p_transfer->p_cfg->p_info;
+    p_info->mode           = TRANSFER_MODE_NORMAL;
+    p_info->irq            = TRANSFER_IRQ_END;
+    p_info->size           = size;
+    p_info->src_addr_mode  = TRANSFER_ADDR_MODE_INCREMENTED;
+    p_info->dest_addr_mode = dest_addr_mode;
+    p_info->repeat_area    = TRANSFER_REPEAT_AREA_SOURCE;
+    p_info->chain_mode     = TRANSFER_CHAIN_MODE_DISABLED;
+    p_info->p_src          = NULL;
+    p_info->p_dest         = p_dest;
+    p_info->length         = 0U;
+    p_info->num_blocks     = 0U;
+    cfg.activation_source  = ELC_EVENT_ELC_SOFTWARE_EVENT_0;
+    cfg.auto_enable        = false;
+    cfg.p_callback         = qspi_transfer_callback;
+    cfg.p_context          = p_ctrl;
+
+    return p_transfer->p_api->open(p_transfer->p_ctrl, &cfg);
+}
+
+/*******************************************************************************************************************//**
+ * Open the write in progress poll timer with the driver callback.  The timer is started by R_QSPI_ProgramAsync().
+ *
+ * @param[in] p_ctrl               Pointer to a driver handle
+ *
+ * @retval SSP_SUCCESS             Timer opened.
+ * @return                         See @ref Common_Error_Codes or functions called by this function for other possible
+ *                                 return codes. This function calls:
+ *                                 * timer_api_t::open
+ **********************************************************************************************************************/
+static ssp_err_t qspi_timer_open (qspi_instance_ctrl_t * p_ctrl)
+{
+    timer_instance_t const * p_timer = p_ctrl->p_lower_lvl_timer;
+
+    timer_cfg_t cfg = *(p_timer->p_cfg);
+    cfg.autostart   = false;
+    cfg.p_callback  = qspi_timer_callback;
+    cfg.p_context   = p_ctrl;
+
+    return p_timer->p_api->open(p_timer->p_ctrl, &cfg);
+}
+
+/*******************************************************************************************************************//**
+ * Start the next chunk of an asynchronous read.  When all chunks are done, copy the remaining bytes and complete the
+ * read.
+ *
+ * @param[in] p_ctrl               Pointer to a driver handle
+ *
+ * @retval SSP_SUCCESS             The next chunk was started or the read is complete.
+ * @return                         See @ref Common_Error_Codes or functions called by this function for other possible
+ *                                 return codes. This function calls:
+ *                                 * transfer_api_t::infoGet
+ *                                 * transfer_api_t::reset
+ *                                 * transfer_api_t::start
+ **********************************************************************************************************************/
+static ssp_err_t qspi_read_next (qspi_instance_ctrl_t * p_ctrl)
+{
+    if (0U == p_ctrl->async_remaining)
+    {
+        memcpy(p_ctrl->p_async_memory, p_ctrl->p_async_device, p_ctrl->async_tail);
+        qspi_async_end(p_ctrl, QSPI_EVENT_READ_COMPLETE);
+
+        return SSP_SUCCESS;
+    }
+
+    transfer_instance_t const * p_transfer = p_ctrl->p_lower_lvl_transfer;
+    transfer_properties_t       properties = {0U};
+    ssp_err_t err = p_transfer->p_api->infoGet(p_transfer->p_ctrl, &properties);
+
+    uint32_t count = p_ctrl->async_remaining / p_ctrl->async_unit;
+    if (count > properties.transfer_length_max)
+    {
+        count = properties.transfer_length_max;
+    }
+
+    /* Advance before the start, the end interrupt of a short chunk may be taken before start returns. */
+    uint8_t * p_src  = p_ctrl->p_async_device;
+    uint8_t * p_dest = p_ctrl->p_async_memory;
+    uint32_t  bytes  = count * p_ctrl->async_unit;
+    p_ctrl->p_async_device  += bytes;
+    p_ctrl->p_async_memory  += bytes;
+    p_ctrl->async_remaining -= bytes;
+
+    if (SSP_SUCCESS == err)
+    {
+        err = p_transfer->p_api->reset(p_transfer->p_ctrl, p_src, p_dest, (uint16_t) count);
+    }
+    if (SSP_SUCCESS == err)
+    {
+        err = p_transfer->p_api->start(p_transfer->p_ctrl, TRANSFER_START_MODE_REPEAT);
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Queue the data of the next page in the transfer.  The page ends at the next page boundary or at the end of the
+ * data.  Nothing is queued after the last page.
+ *
+ * @param[in] p_ctrl               Pointer to a driver handle
+ *
+ * @retval SSP_SUCCESS             The next page is queued, or there is none.
+ * @return                         See @ref Common_Error_Codes or functions called by this function for other possible
+ *                                 return codes. This function calls:
+ *                                 * transfer_api_t::reset
+ **********************************************************************************************************************/
+static ssp_err_t qspi_program_queue (qspi_instance_ctrl_t * p_ctrl)
+{
+    uint32_t chip_address = (uint32_t) p_ctrl->p_async_device - BSP_PRV_QSPI_DEVICE_PHYSICAL_ADDRESS;
+    uint32_t bytes        = p_ctrl->page_size - (chip_address % p_ctrl->page_size);
+    if (bytes > p_ctrl->async_remaining)
+    {
+        bytes = p_ctrl->async_remaining;
+    }
+
+    p_ctrl->async_queued = (uint16_t) bytes;
+    if (0U == bytes)
+    {
+        return SSP_SUCCESS;
+    }
+
+    transfer_instance_t const * p_transfer = p_ctrl->p_lower_lvl_transfer;
+
+    return p_transfer->p_api->reset(p_transfer->p_ctrl, p_ctrl->p_async_memory, NULL, (uint16_t) bytes);
+}
+
+/*******************************************************************************************************************//**
+ * Send the command and address of the queued page and start its data, or complete the program if no page is queued.
+ * Called when the flash is idle.
+ *
+ * @param[in] p_ctrl               Pointer to a driver handle
+ *
+ * @retval SSP_SUCCESS             The page was started or the program is complete.
+ * @return                         See @ref Common_Error_Codes or functions called by this function for other possible
+ *                                 return codes. This function calls:
+ *                                 * transfer_api_t::start
+ **********************************************************************************************************************/
+static ssp_err_t qspi_program_next (qspi_instance_ctrl_t * p_ctrl)
+{
+    if (0U == p_ctrl->async_queued)
+    {
+        qspi_async_end(p_ctrl, QSPI_EVENT_PROGRAM_COMPLETE);
+
+        return SSP_SUCCESS;
+    }
+
+    uint32_t chip_address = (uint32_t) p_ctrl->p_async_device - BSP_PRV_QSPI_DEVICE_PHYSICAL_ADDRESS;
+    p_ctrl->async_restore_spi_mode = qspi_page_program_start(p_ctrl, chip_address);
+    p_ctrl->async_state            = (uint8_t) QSPI_PRV_ASYNC_PROGRAM_DATA;
+
+    transfer_instance_t const * p_transfer = p_ctrl->p_lower_lvl_transfer;
+    ssp_err_t err = p_transfer->p_api->start(p_transfer->p_ctrl, TRANSFER_START_MODE_REPEAT);
+    if (SSP_SUCCESS != err)
+    {
+        qspi_page_program_end(p_ctrl, p_ctrl->async_restore_spi_mode);
+        p_ctrl->async_state = (uint8_t) QSPI_PRV_ASYNC_PROGRAM_WAIT;
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Write in progress poll of an asynchronous program.  Reads the flash status between pages, and sends the queued page
+ * once the flash is idle.
+ *
+ * @param[in] p_ctrl               Pointer to a driver handle
+ **********************************************************************************************************************/
+static void qspi_program_poll (qspi_instance_ctrl_t * p_ctrl)
+{
+    /* The flash is not accessed while page data is sent. */
+    if ((uint8_t) QSPI_PRV_ASYNC_PROGRAM_WAIT == p_ctrl->async_state)
+    {
+        bool write_in_progress = true;
+
+        HW_QSPI_DIRECT_COMMUNICATION_ENTER(p_ctrl->p_reg);
+        bsp_qspi_status_get(&write_in_progress);
+        HW_QSPI_DIRECT_COMMUNICATION_EXIT(p_ctrl->p_reg);
+
+        if (!write_in_progress)
+        {
+            if (SSP_SUCCESS != qspi_program_next(p_ctrl))
+            {
+                qspi_async_end(p_ctrl, QSPI_EVENT_ERROR);
+            }
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * End an asynchronous operation: stop the poll timer, close the transfer and call the user callback.
+ *
+ * @param[in] p_ctrl               Pointer to a driver handle
+ * @param[in] event                Event reported to the callback
+ **********************************************************************************************************************/
+static void qspi_async_end (qspi_instance_ctrl_t * p_ctrl, qspi_event_t event)
+{
+    if (NULL != p_ctrl->p_lower_lvl_timer)
+    {
+        p_ctrl->p_lower_lvl_timer->p_api->stop(p_ctrl->p_lower_lvl_timer->p_ctrl);
+    }
+    p_ctrl->p_lower_lvl_transfer->p_api->close(p_ctrl->p_lower_lvl_transfer->p_ctrl);
+    p_ctrl->async_state = (uint8_t) QSPI_PRV_ASYNC_IDLE;
+
+    qspi_callback_args_t args;
+    args.event     = event;
+    args.p_context = p_ctrl->p_context;
+    p_ctrl->p_callback(&args);
+}
+
+/*******************************************************************************************************************//**
+ * Transfer end interrupt of an asynchronous operation.  Continues a read with the next chunk.  After the data of a
+ * page, closes the bus cycle so the flash writes the page, and queues the next page while the flash is busy.
+ *
+ * @param[in] p_args               Transfer callback arguments, p_context is the driver handle
+ **********************************************************************************************************************/
+static void qspi_transfer_callback (transfer_callback_args_t * p_args)
+{
+    qspi_instance_ctrl_t * p_ctrl = (qspi_instance_ctrl_t *) p_args->p_context;
+    ssp_err_t              err    = SSP_SUCCESS;
+
+    if ((uint8_t) QSPI_PRV_ASYNC_READ == p_ctrl->async_state)
+    {
+        err = qspi_read_next(p_ctrl);
+    }
+    else if ((uint8_t) QSPI_PRV_ASYNC_PROGRAM_DATA == p_ctrl->async_state)
+    {
+        qspi_page_program_end(p_ctrl, p_ctrl->async_restore_spi_mode);
+
+        p_ctrl->p_async_device  += p_ctrl->async_queued;
+        p_ctrl->p_async_memory  += p_ctrl->async_queued;
+        p_ctrl->async_remaining -= p_ctrl->async_queued;
+
+        err = qspi_program_queue(p_ctrl);
+        p_ctrl->async_state = (uint8_t) QSPI_PRV_ASYNC_PROGRAM_WAIT;
+    }
+    else
+    {
+        /* No asynchronous operation in progress. */
+    }
+
+    if (SSP_SUCCESS != err)
+    {
+        qspi_async_end(p_ctrl, QSPI_EVENT_ERROR);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Poll timer interrupt, runs the write in progress poll of an asynchronous program.
+ *
+ * @param[in] p_args               Timer callback arguments, p_context is the driver handle
+ **********************************************************************************************************************/
+static void qspi_timer_callback (timer_callback_args_t * p_args)
+{
+    qspi_program_poll((qspi_instance_ctrl_t *) p_args->p_context);
+}
@@ -41,6 +41,14 @@ Macro definitions
 /**********************************************************************************************************************
 Typedef definitions
 ***********************************************************************************************************************/
+/** Asynchronous operation in progress, stored in qspi_instance_ctrl_t::async_state. */
+typedef enum e_qspi_prv_async_state
+{
+    QSPI_PRV_ASYNC_IDLE = 0U,       ///< No asynchronous operation
+    QSPI_PRV_ASYNC_READ,            ///< The transfer is copying from the memory mapped window
+    QSPI_PRV_ASYNC_PROGRAM_DATA,    ///< The transfer is writing page data to SFMCOM
+    QSPI_PRV_ASYNC_PROGRAM_WAIT,    ///< A page is being written, waiting for the flash to clear write in progress
+} qspi_prv_async_state_t;
 
 #endif /* R_QSPI_PRIVATE_H */
 
@@ -42,6 +42,14 @@ ssp_err_t R_QSPI_SectorErase (qspi_ctrl_t * p_ctrl, uint8_t * device_address);
 ssp_err_t R_QSPI_StatusGet (qspi_ctrl_t * p_ctrl, bool * write_in_progress);
 ssp_err_t R_QSPI_BankSelect (uint32_t bank);
 ssp_err_t R_QSPI_VersionGet (ssp_version_t * const p_version);
+ssp_err_t R_QSPI_ReadAsync (qspi_ctrl_t * p_ctrl,
+                            uint8_t     * p_device_address,
+                            uint8_t     * p_memory_address,
+                            uint32_t    byte_count);
+ssp_err_t R_QSPI_ProgramAsync (qspi_ctrl_t * p_ctrl,
+                               uint8_t     * p_device_address,
+                               uint8_t     * p_memory_address,
+                               uint32_t    byte_count);
 
 /* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
 SSP_FOOTER
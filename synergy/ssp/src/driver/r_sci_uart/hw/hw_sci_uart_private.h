@@ -103,6 +103,17 @@ __STATIC_INLINE void HW_SCI_RXIeventSelect (R_SCI0_Type * p_reg)
     p_reg->FCR_b.DRES  = 0U;    /* FCRL.DRES  (select RXI happen when detecting a reception data ready) */
 }  /* End of function HW_SCI_RXIeventSelect() */
 
+/*******************************************************************************************************************//**
+* @brief     Select ERI event which happens when detecting a reception data ready
+* @param[in] p_reg   SCI base register
+* @retval    void
+* @note      Channel number is not checked in this function, caller function must check it.
+***********************************************************************************************************************/
+__STATIC_INLINE void HW_SCI_ERIeventSelect (R_SCI0_Type * p_reg)
+{
+    p_reg->FCR_b.DRES  = 1U;    /* FCRL.DRES  (select ERI happen when detecting a reception data ready) */
+}  /* End of function HW_SCI_ERIeventSelect() */
+
 /*******************************************************************************************************************//**
 * @brief     RXI happens when number of received data in FIFO becomes equal or greater than this value
 * @param[in] p_reg   SCI base register
@@ -25,6 +25,7 @@
 /***********************************************************************************************************************
  * Includes
  **********************************************************************************************************************/
+#include <string.h>
 #include "bsp_api.h"
 #include "r_sci_uart.h"
 #include "hw/hw_sci_uart_private.h"
@@ -70,6 +71,20 @@
 /** Absolute maximum baud rate error. */
 #define SCI_UART_MAX_BAUD_RATE_ERROR_X_1000  (15000U)
 
+/** Receive FIFO trigger number while streaming.  The transfer leaves one datum in the FIFO, so the receive data ready
+ * flag (DR) is set when the line goes idle. */
+#define SCI_UART_RING_RX_TRIGGER         (2U)
+
+/** Number of baud rate solutions kept by r_sci_uart_brr_mddr_get().  0 disables the cache. */
+#ifndef SCI_UART_CFG_BAUD_CACHE_ENTRIES
+#define SCI_UART_CFG_BAUD_CACHE_ENTRIES  (4U)
+#endif
+
+/** Flags in sci_uart_baud_cache_t::flags. */
+#define SCI_UART_BAUD_CACHE_VALID        (0x01U)
+#define SCI_UART_BAUD_CACHE_MODULATION   (0x02U)
+#define SCI_UART_BAUD_CACHE_16_BASE_CLK  (0x04U)
+
 /***********************************************************************************************************************
  * Private constants
  **********************************************************************************************************************/
@@ -82,6 +97,19 @@ static const uint32_t   SCI_UART_DEFAULT_BAUD_RATE_ERROR_X_1000 = 10000;
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
+#if (SCI_UART_CFG_BAUD_CACHE_ENTRIES > 0U)
+/** Result of one r_sci_uart_brr_mddr_calculate() call. */
+typedef struct st_sci_uart_baud_cache
+{
+    uint32_t  freq_hz;                 ///< Source clock frequency the result was calculated for
+    uint32_t  baudrate;                ///< Requested baud rate
+    int32_t   bit_err;                 ///< Bit rate error x 1000
+    uint16_t  mddr;                    ///< MDDR value, only valid with SCI_UART_BAUD_CACHE_MODULATION
+    uint8_t   brr;                     ///< BRR value
+    uint8_t   setting;                 ///< Index into async_baud
+    uint8_t   flags;                   ///< SCI_UART_BAUD_CACHE_* flags
+} sci_uart_baud_cache_t;
+#endif
 
 /***********************************************************************************************************************
  * Private function prototypes
@@ -113,6 +141,15 @@ static int32_t r_sci_uart_brr_mddr_calculate(uint32_t                freq_hz,
                                              uint32_t              * p_mddr,
                                              bool                    select_16_base_clk_cycles);
 
+static int32_t r_sci_uart_brr_mddr_get(uint32_t                freq_hz,
+                                       uint32_t                baudrate,
+                                       uint8_t               * p_brr_value,
+                                       baud_setting_t const ** pp_baud_setting,
+                                       uint32_t              * p_mddr,
+                                       bool                    select_16_base_clk_cycles);
+
+static int32_t r_sci_uart_bit_err_calculate(uint32_t freq_hz, uint32_t err_divisor, uint32_t mddr);
+
 static ssp_err_t r_sci_uart_baud_calculate(sci_clk_src_t           clk_src,
                                            uint32_t                baudrate,
                                            uint8_t               * p_brr_value,
@@ -172,6 +209,18 @@ void r_sci_uart_read_data(sci_uart_instance_ctrl_t * const p_ctrl,
 void sci_uart_eri_isr (void);
 
 static ssp_err_t r_sci_uart_abort_rx(sci_uart_instance_ctrl_t * p_ctrl);
+
+static ssp_err_t r_sci_uart_ring_arm (sci_uart_instance_ctrl_t * const p_ctrl);
+
+static uint32_t r_sci_uart_ring_landed (sci_uart_instance_ctrl_t * const p_ctrl);
+
+static uint32_t r_sci_uart_ring_advance (sci_uart_instance_ctrl_t * const p_ctrl);
+
+static void r_sci_uart_ring_callback (sci_uart_instance_ctrl_t * const p_ctrl, uint32_t const events);
+
+static void r_sci_uart_ring_segment_end (sci_uart_instance_ctrl_t * const p_ctrl);
+
+static void r_sci_uart_ring_idle (sci_uart_instance_ctrl_t * const p_ctrl);
 #endif /* if (SCI_UART_CFG_RX_ENABLE) */
 
 #if (SCI_UART_CFG_TX_ENABLE)
@@ -181,6 +230,10 @@ void sci_uart_txi_isr (void);
 void sci_uart_tei_isr (void);
 #endif /* if (SCI_UART_CFG_TX_ENABLE) */
 
+static void r_sci_uart_callback_call (sci_uart_instance_ctrl_t * const p_ctrl, uart_callback_args_t * const p_args);
+
+static void r_sci_uart_callback_work (void * p_context, void * p_args);
+
 
 
 /***********************************************************************************************************************
@@ -209,6 +262,15 @@ static const baud_setting_t async_baud[SCI_UART_NUM_DIVISORS_ASYNC] =
     { 2048U, 0U,  0U,  0U,  3U }
 };
 
+#if (SCI_UART_CFG_BAUD_CACHE_ENTRIES > 0U)
+/** Recent baud rate solutions, shared by all channels.  Entries are keyed by source clock frequency, so a clock change
+ * never returns a stale solution. */
+static sci_uart_baud_cache_t g_sci_uart_baud_cache[SCI_UART_CFG_BAUD_CACHE_ENTRIES];
+
+/** Entry replaced by the next miss. */
+static uint32_t g_sci_uart_baud_cache_next = 0U;
+#endif
+
 /** FIFO depth values, use variant data b2:3 as index. */
 static const uint8_t g_sci_uart_fifo_depth[] =
 {
@@ -246,7 +308,9 @@ const uart_api_t  g_uart_on_sci =
     .infoGet            = R_SCI_UartInfoGet,
     .baudSet            = R_SCI_UartBaudSet,
     .versionGet         = R_SCI_UartVersionGet,
-    .communicationAbort = R_SCI_UartAbort
+    .communicationAbort = R_SCI_UartAbort,
+    .readStream         = R_SCI_UartReadStream,
+    .ringRead           = R_SCI_UartRingRead
 };
 
 /*******************************************************************************************************************//**
@@ -382,11 +446,14 @@ ssp_err_t R_SCI_UartOpen (uart_ctrl_t      * const p_api_ctrl,
     p_ctrl->channel                          = p_cfg->channel;
     p_ctrl->p_context                        = p_cfg->p_context;
     p_ctrl->p_callback                       = p_cfg->p_callback;
+    p_ctrl->deferred_callback                = p_cfg->deferred_callback;
+    p_ctrl->deferred_callback_priority       = p_cfg->deferred_callback_priority;
     p_ctrl->p_tx_src                         = NULL;
     p_ctrl->tx_src_bytes                     = 0U;
     p_ctrl->rx_transfer_in_progress          = 0U;
     p_ctrl->rx_dst_bytes                     = 0U;
     p_ctrl->rx_bytes_count                   = 0U;
+    p_ctrl->p_rx_ring                        = NULL;
 
 #if (SCI_UART_CFG_RX_ENABLE)
     /** If reception is enabled at build time, enable reception. */
@@ -459,6 +526,7 @@ ssp_err_t R_SCI_UartClose (uart_ctrl_t * const p_api_ctrl)
     /** Clear control block parameters. */
     p_ctrl->p_callback   = NULL;
     p_ctrl->p_extpin_ctrl = NULL;
+    p_ctrl->p_rx_ring    = NULL;
 
     /** Remove power to the channel. */
     ssp_feature_t ssp_feature = {{(ssp_ip_t) 0U}};
@@ -799,6 +867,164 @@ ssp_err_t R_SCI_UartAbort (uart_ctrl_t   * const p_api_ctrl, uart_dir_t communic
     return err;
 }  /* End of function R_SCI_UartAbort() */
 
+/*******************************************************************************************************************//**
+ * Starts streaming reception into a ring buffer.  The receive transfer instance lands data in one half of the ring at a
+ * time and is re-armed for the other half from the RXI interrupt, so the CPU is interrupted twice per pass through the
+ * ring instead of once per character.  The callback is called with UART_EVENT_RX_RING_HALF or UART_EVENT_RX_RING_FULL
+ * when a half fills.  On channels with a FIFO and an ERI interrupt, the last datum of a burst is held in the FIFO until
+ * the receive timeout, which moves it to the ring and calls the callback with UART_EVENT_RX_TIMEOUT.  The data is read
+ * with R_SCI_UartRingRead().  Call R_SCI_UartAbort() with UART_DIR_RX to stop streaming.
+ *
+ * @retval  SSP_SUCCESS                  Streaming reception started.
+ * @retval  SSP_ERR_ASSERTION            Pointer to UART control block or ring is NULL, bytes is 0, or half the ring is
+ *                                       larger than the maximum transfer length.
+ * @retval  SSP_ERR_INVALID_ARGUMENT     bytes is not a power of two or is too small for two data, or the ring is not
+ *                                       valid for 9-bit mode.
+ * @retval  SSP_ERR_NOT_OPEN             The control block has not been opened.
+ * @retval  SSP_ERR_IN_USE               A read or streaming reception is already in progress.
+ * @retval  SSP_ERR_UNSUPPORTED          No receive transfer instance is configured, or SCI_UART_CFG_RX_ENABLE is 0.
+ *
+ * @return                       See @ref Common_Error_Codes or functions called by this function for other possible
+ *                               return codes. This function calls:
+ *                                   * transfer_api_t::reset
+ **********************************************************************************************************************/
+ssp_err_t R_SCI_UartReadStream (uart_ctrl_t * const p_api_ctrl,
+                                uint8_t     * const p_ring,
+                                uint32_t      const bytes)
+{
+#if (SCI_UART_CFG_RX_ENABLE)
+    sci_uart_instance_ctrl_t * p_ctrl = (sci_uart_instance_ctrl_t *) p_api_ctrl;
+    ssp_err_t err = SSP_SUCCESS;
+
+#if (SCI_UART_CFG_PARAM_CHECKING_ENABLE)
+    err = r_sci_read_write_param_check(p_ctrl, p_ring, bytes);
+    SCI_UART_ERROR_RETURN(SSP_SUCCESS == err, err);
+    SCI_UART_ERROR_RETURN(0U == (bytes & (bytes - 1U)), SSP_ERR_INVALID_ARGUMENT);
+    SCI_UART_ERROR_RETURN(bytes >= (2U * p_ctrl->data_bytes), SSP_ERR_INVALID_ARGUMENT);
+#endif
+
+    /** Streaming reception requires a transfer instance to land the data. */
+    SCI_UART_ERROR_RETURN(NULL != p_ctrl->p_transfer_rx, SSP_ERR_UNSUPPORTED);
+
+#if (SCI_UART_CFG_PARAM_CHECKING_ENABLE)
+    transfer_properties_t transfer_max = {0U};
+    p_ctrl->p_transfer_rx->p_api->infoGet(p_ctrl->p_transfer_rx->p_ctrl, &transfer_max);
+    SSP_ASSERT(((bytes / 2U) >> (p_ctrl->data_bytes - 1U)) <= transfer_max.transfer_length_max);
+#endif
+
+    SCI_UART_ERROR_RETURN(0U == p_ctrl->rx_transfer_in_progress, SSP_ERR_IN_USE);
+    p_ctrl->rx_transfer_in_progress = 1U;
+
+    p_ctrl->rx_ring_bytes = bytes;
+    p_ctrl->rx_ring_head  = 0U;
+    p_ctrl->rx_ring_end   = bytes / 2U;
+    p_ctrl->rx_ring_tail  = 0U;
+    p_ctrl->rx_ring_seq   = 0U;
+    p_ctrl->p_rx_ring     = p_ring;
+
+    /** If the receive timeout can be signaled on ERI, raise the FIFO trigger so the timeout detects an idle line. */
+    R_SCI0_Type * p_sci_reg = (R_SCI0_Type *) p_ctrl->p_reg;
+    if ((0U != p_ctrl->fifo_depth) && (SSP_INVALID_VECTOR != p_ctrl->eri_irq))
+    {
+        HW_SCI_RxTriggerNumberSet(p_sci_reg, SCI_UART_RING_RX_TRIGGER);
+        HW_SCI_ERIeventSelect(p_sci_reg);
+    }
+
+    /** Arm the transfer for the first half of the ring. */
+    err = r_sci_uart_ring_arm(p_ctrl);
+    if (SSP_SUCCESS != err)
+    {
+        r_sci_uart_abort_rx(p_ctrl);
+    }
+    SCI_UART_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    return SSP_SUCCESS;
+#else
+    SSP_PARAMETER_NOT_USED(p_api_ctrl);
+    SSP_PARAMETER_NOT_USED(p_ring);
+    SSP_PARAMETER_NOT_USED(bytes);
+    return SSP_ERR_UNSUPPORTED;
+#endif /* if (SCI_UART_CFG_RX_ENABLE) */
+}  /* End of function R_SCI_UartReadStream() */
+
+/*******************************************************************************************************************//**
+ * Copies data received by R_SCI_UartReadStream() out of the ring buffer.  The write position is computed from the
+ * transfer instance without disabling the channel or its interrupts, so data landed since the last notification is
+ * included.
+ *
+ * @retval  SSP_SUCCESS                  p_bytes_read data copied to p_dest (possibly 0).
+ * @retval  SSP_ERR_ASSERTION            Pointer to UART control block, p_dest or p_bytes_read is NULL.
+ * @retval  SSP_ERR_NOT_OPEN             The control block has not been opened.
+ * @retval  SSP_ERR_NOT_ENABLED          Streaming reception is not active.
+ * @retval  SSP_ERR_OVERFLOW             Unread data was overwritten.  All unread data is discarded.
+ * @retval  SSP_ERR_UNSUPPORTED          SCI_UART_CFG_RX_ENABLE is set to 0.
+ *
+ * @note Do not call this function from an interrupt with a higher priority than the RXI and ERI interrupts of the
+ *       channel.
+ **********************************************************************************************************************/
+ssp_err_t R_SCI_UartRingRead (uart_ctrl_t * const p_api_ctrl,
+                              uint8_t     * const p_dest,
+                              uint32_t      const bytes,
+                              uint32_t    * const p_bytes_read)
+{
+#if (SCI_UART_CFG_RX_ENABLE)
+    sci_uart_instance_ctrl_t * p_ctrl = (sci_uart_instance_ctrl_t *) p_api_ctrl;
+
+#if (SCI_UART_CFG_PARAM_CHECKING_ENABLE)
+    SSP_ASSERT(p_ctrl);
+    SSP_ASSERT(p_dest);
+    SSP_ASSERT(p_bytes_read);
+    SCI_UART_ERROR_RETURN(SCI_UART_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+#endif
+
+    *p_bytes_read = 0U;
+    uint8_t * p_ring = p_ctrl->p_rx_ring;
+    SCI_UART_ERROR_RETURN(NULL != p_ring, SSP_ERR_NOT_ENABLED);
+
+    /** Compute the write position.  rx_ring_seq is odd while the ISR moves the armed segment, so retry until the
+     * segment and the transfer count are sampled between two ISR updates. */
+    uint32_t seq  = 0U;
+    uint32_t head = 0U;
+    do
+    {
+        seq  = p_ctrl->rx_ring_seq;
+        head = p_ctrl->rx_ring_head + r_sci_uart_ring_landed(p_ctrl);
+    } while ((0U != (seq & 1U)) || (seq != p_ctrl->rx_ring_seq));
+
+    /** If the transfer has lapped the reader, discard all unread data. */
+    uint32_t tail      = p_ctrl->rx_ring_tail;
+    uint32_t available = head - tail;
+    if (available > p_ctrl->rx_ring_bytes)
+    {
+        p_ctrl->rx_ring_tail = head;
+    }
+    SCI_UART_ERROR_RETURN(available <= p_ctrl->rx_ring_bytes, SSP_ERR_OVERFLOW);
+
+    /** Copy whole data only, in at most two pieces around the end of the ring. */
+    uint32_t count = (available < bytes) ? available : bytes;
+    count &= ~((uint32_t) p_ctrl->data_bytes - 1U);
+    uint32_t offset = tail & (p_ctrl->rx_ring_bytes - 1U);
+    uint32_t first  = p_ctrl->rx_ring_bytes - offset;
+    if (first > count)
+    {
+        first = count;
+    }
+    memcpy(p_dest, &p_ring[offset], first);
+    memcpy(&p_dest[first], &p_ring[0], count - first);
+
+    p_ctrl->rx_ring_tail = tail + count;
+    *p_bytes_read = count;
+
+    return SSP_SUCCESS;
+#else
+    SSP_PARAMETER_NOT_USED(p_api_ctrl);
+    SSP_PARAMETER_NOT_USED(p_dest);
+    SSP_PARAMETER_NOT_USED(bytes);
+    SSP_PARAMETER_NOT_USED(p_bytes_read);
+    return SSP_ERR_UNSUPPORTED;
+#endif /* if (SCI_UART_CFG_RX_ENABLE) */
+}  /* End of function R_SCI_UartRingRead() */
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup UARTonSCI)
  **********************************************************************************************************************/
@@ -1251,7 +1477,7 @@ static int32_t r_sci_uart_brr_mddr_calculate(uint32_t                freq_hz,
                                              uint32_t                baudrate,
                                              uint8_t               * p_brr_value,
                                              baud_setting_t const ** pp_baud_setting,
-                                             uint32_t              * p_mddr, 
+                                             uint32_t              * p_mddr,
                                              bool                    select_16_base_clk_cycles)
 {
     /** Find the best BRR (bit rate register) value.
@@ -1259,12 +1485,27 @@ static int32_t r_sci_uart_brr_mddr_calculate(uint32_t                freq_hz,
      *  is tried, and the settings with the lowest bit rate error are stored. The formula to calculate BRR is as
      *  follows and it must be 255 or less:
      *  BRR = (PCLK / (div_coefficient * baud)) - 1
+     *  Settings are visited in the same order as an exhaustive search (divisors ascending, BRR descending) and only a
+     *  strictly lower error replaces the stored settings, so ties resolve the same way.
      */
-    baud_setting_t const * p_baudinfo = &async_baud[0];
-    int32_t  hit_bit_err = SCI_UART_100_PERCENT_X_1000;
-    uint32_t hit_mddr = 0U;
-    uint32_t divisor = 0U;
-    for (uint32_t i = 0U; i < SCI_UART_NUM_DIVISORS_ASYNC; i++)
+    baud_setting_t const * p_baudinfo  = &async_baud[0];
+    int32_t                hit_bit_err = SCI_UART_100_PERCENT_X_1000;
+    uint32_t               hit_mddr    = 0U;
+    bool                   mddr_found  = false;
+
+    /** With modulation, MDDR = (div_coefficient * baud * (BRR + 1)) / (PCLK / 256).  Write the numerator as
+     *  MDDR * (PCLK / 256) + mddr_rem.  The modulated bit rate error of a setting is then at least
+     *  100000 * (mddr_rem - slack) / numerator, where slack covers PCLK not being a multiple of 256.  Settings whose
+     *  bound is not below the best error so far are skipped without the 64-bit division. */
+    uint32_t freq_256 = freq_hz / SCI_UART_MDDR_MAX;
+    uint32_t freq_rem = freq_hz % SCI_UART_MDDR_MAX;
+    uint64_t slack    = 1U;
+    if (0U != freq_rem)
+    {
+        slack += (((uint64_t) SCI_UART_100_PERCENT_X_1000 * freq_rem) * freq_hz) / (freq_hz - freq_rem);
+    }
+
+    for (uint32_t i = 0U; (i < SCI_UART_NUM_DIVISORS_ASYNC) && (0 != hit_bit_err); i++)
     {
         /** if select_16_base_clk_cycles == true:  Skip this calculation for divisors that are not acheivable with 16 base clk cycles per bit.
          *  if select_16_base_clk_cycles == false: Skip this calculation for divisors that are only acheivable without 16 base clk cycles per bit.
@@ -1274,95 +1515,200 @@ static int32_t r_sci_uart_brr_mddr_calculate(uint32_t                freq_hz,
             continue;
         }
 
-        divisor = (uint32_t) p_baudinfo[i].div_coefficient * baudrate;
-        uint32_t temp_brr = freq_hz / divisor;
+        /** brr_count is BRR + 1 for the fastest bit rate that does not exceed the requested baud rate. */
+        uint32_t divisor   = (uint32_t) p_baudinfo[i].div_coefficient * baudrate;
+        uint32_t brr_count = freq_hz / divisor;
+        if ((0U == brr_count) || (brr_count > (SCI_UART_BRR_MAX + 1U)))
+        {
+            continue;
+        }
 
-        if (temp_brr <= (SCI_UART_BRR_MAX + 1U))
+        if (NULL == p_mddr)
         {
-            while (temp_brr > 0U)
+            /** Without modulation, slower settings only add error, so there is one candidate per divisor. */
+            int32_t bit_err = r_sci_uart_bit_err_calculate(freq_hz, divisor * brr_count, 0U);
+            if (bit_err < hit_bit_err)
             {
-                temp_brr -= 1U;
-
-                /** Calculate the bit rate error. The formula is as follows:
-                 *  bit rate error[%] = {(PCLK / (baud * div_coefficient * (BRR + 1)) - 1} x 100
-                 *  calculates bit rate error[%] to three decimal places
-                 */
-                int32_t err_divisor = (int32_t) (divisor * (temp_brr + 1U));
-
-                /* Promoting to 64 bits for calculation, but the final value can never be more than 32 bits, as
-                 * described below, so this cast is safe.
-                 *    1. (temp_brr + 1) can be off by an upper limit of 1 due to rounding from the calculation:
-                 *       freq_hz / divisor, or:
-                 *       freq_hz / divisor <= (temp_brr + 1) < (freq_hz / divisor) + 1
-                 *    2. Solving for err_divisor:
-                 *       freq_hz <= err_divisor < freq_hz + divisor
-                 *    3. Solving for bit_err:
-                 *       0 >= bit_err >= (freq_hz * 100000 / (freq_hz + divisor)) - 100000
-                 *    4. freq_hz >= divisor (or temp_brr would be -1 and we would never enter this while loop), so:
-                 *       0 >= bit_err >= 100000 / freq_hz - 100000
-                 *    5. Larger frequencies yield larger bit errors (absolute value).  As the frequency grows,
-                 *       the bit_err approaches -100000, so:
-                 *       0 >= bit_err >= -100000
-                 *    6. bit_err is between -100000 and 0.  This entire range fits in an int32_t type, so the cast
-                 *       to (int32_t) is safe.
-                 */
-                int32_t bit_err   = (int32_t) (((((int64_t) freq_hz) * SCI_UART_100_PERCENT_X_1000) /
-                                    err_divisor) - SCI_UART_100_PERCENT_X_1000);
-
-                uint32_t mddr = 0U;
-                if (NULL != p_mddr)
-                {
-                    /** Calculate the MDDR (M) value if bit rate modulation is enabled,
-                     * The formula to calculate MBBR (from the M and N relationship given in the hardware manual) is as follows
-                     * and it must be between 128 and 256.
-                     * MDDR = ((div_coefficient * baud * 256) * (BRR + 1)) / PCLK */
-                    mddr = (uint32_t) err_divisor / (freq_hz / SCI_UART_MDDR_MAX);
-
-                    /* The maximum value that could result from the calculation above is 256, which is a valid MDDR
-                     * value, so only the lower bound is checked. */
-                    if (mddr < SCI_UART_MDDR_MIN)
-                    {
-                        break;
-                    }
-
-                    /** Adjust bit rate error for bit rate modulation. The following formula is used:
-                     *  bit rate error [%] = ((bit rate error [%, no modulation] + 100) * MDDR / 256) - 100
-                     */
-                    bit_err = (((bit_err + SCI_UART_100_PERCENT_X_1000) * (int32_t) mddr) /
-                              SCI_UART_MDDR_DIVISOR) - SCI_UART_100_PERCENT_X_1000;
-                }
+                *pp_baud_setting = &p_baudinfo[i];
+                *p_brr_value     = (uint8_t) (brr_count - 1U);
+                hit_bit_err      = bit_err;
+            }
 
-                /** Take the absolute value of the bit rate error. */
-                if (bit_err < 0)
-                {
-                    bit_err = -bit_err;
-                }
+            continue;
+        }
 
-                /** If the absolute value of the bit rate error is less than the previous lowest absolute value of
-                 *  bit rate error, then store these settings as the best value.
-                 */
+        /** With modulation, every BRR down to the one that makes MDDR drop below its minimum is a candidate. */
+        if (0U == freq_256)
+        {
+            continue;
+        }
+        uint32_t count_min = ((SCI_UART_MDDR_MIN * freq_256) + divisor - 1U) / divisor;
+        if (0U == count_min)
+        {
+            count_min = 1U;
+        }
+        if (brr_count < count_min)
+        {
+            continue;
+        }
+        mddr_found = true;
+
+        /** Step MDDR and its remainder down with BRR instead of dividing for every candidate. */
+        uint32_t err_divisor = divisor * brr_count;
+        uint32_t mddr        = err_divisor / freq_256;
+        uint32_t mddr_rem    = err_divisor % freq_256;
+        uint32_t step        = divisor / freq_256;
+        uint32_t step_rem    = divisor % freq_256;
+        for (uint32_t count = brr_count; count >= count_min; count--)
+        {
+            uint64_t bound = (uint64_t) SCI_UART_100_PERCENT_X_1000 * mddr_rem;
+            if (bound < (((uint64_t) (uint32_t) hit_bit_err * err_divisor) + slack))
+            {
+                int32_t bit_err = r_sci_uart_bit_err_calculate(freq_hz, err_divisor, mddr);
                 if (bit_err < hit_bit_err)
                 {
                     *pp_baud_setting = &p_baudinfo[i];
-                    *p_brr_value     = (uint8_t) temp_brr;
+                    *p_brr_value     = (uint8_t) (count - 1U);
                     hit_bit_err      = bit_err;
                     hit_mddr         = mddr;
-                }
-                if (NULL == p_mddr)
-                {
-                    break;
-                }
-                else
-                {
-                    *p_mddr = hit_mddr;
+                    if (0 == hit_bit_err)
+                    {
+                        break;
+                    }
                 }
             }
+
+            err_divisor -= divisor;
+            mddr        -= step;
+            if (mddr_rem < step_rem)
+            {
+                mddr_rem += freq_256;
+                mddr--;
+            }
+            mddr_rem -= step_rem;
         }
     }
 
+    if (mddr_found)
+    {
+        *p_mddr = hit_mddr;
+    }
+
     return hit_bit_err;
 }
 
+/*******************************************************************************************************************//**
+ * Calculates the bit rate error of one setting.
+ *
+ * @param[in]  freq_hz       The source clock frequency for the SCI internal clock
+ * @param[in]  err_divisor   div_coefficient * baud * (BRR + 1), must not exceed freq_hz
+ * @param[in]  mddr          MDDR register value, 0 if bit rate modulation is not used
+ *
+ * @return  absolute bit error (percent * 1000, or percent to 3 decimal places)
+ **********************************************************************************************************************/
+static int32_t r_sci_uart_bit_err_calculate(uint32_t freq_hz, uint32_t err_divisor, uint32_t mddr)
+{
+    /** Calculate the bit rate error. The formula is as follows:
+     *  bit rate error[%] = {(PCLK / (baud * div_coefficient * (BRR + 1)) - 1} x 100
+     *  calculates bit rate error[%] to three decimal places.  err_divisor does not exceed freq_hz, so the result is
+     *  between 0 and 100000 * (freq_hz - 1) / freq_hz and fits in an int32_t.
+     */
+    int32_t bit_err = (int32_t) (((((int64_t) freq_hz) * SCI_UART_100_PERCENT_X_1000) / (int32_t) err_divisor) -
+                                 SCI_UART_100_PERCENT_X_1000);
+
+    if (0U != mddr)
+    {
+        /** Adjust bit rate error for bit rate modulation. The following formula is used:
+         *  bit rate error [%] = ((bit rate error [%, no modulation] + 100) * MDDR / 256) - 100
+         */
+        bit_err = (((bit_err + SCI_UART_100_PERCENT_X_1000) * (int32_t) mddr) / SCI_UART_MDDR_DIVISOR) -
+                  SCI_UART_100_PERCENT_X_1000;
+    }
+
+    /** Take the absolute value of the bit rate error. */
+    if (bit_err < 0)
+    {
+        bit_err = -bit_err;
+    }
+
+    return bit_err;
+}
+
+/*******************************************************************************************************************//**
+ * Returns the result of r_sci_uart_brr_mddr_calculate() from the baud rate cache, or calculates and caches it.
+ * Parameters and return value are the same as r_sci_uart_brr_mddr_calculate().
+ **********************************************************************************************************************/
+static int32_t r_sci_uart_brr_mddr_get(uint32_t                freq_hz,
+                                       uint32_t                baudrate,
+                                       uint8_t               * p_brr_value,
+                                       baud_setting_t const ** pp_baud_setting,
+                                       uint32_t              * p_mddr,
+                                       bool                    select_16_base_clk_cycles)
+{
+#if (SCI_UART_CFG_BAUD_CACHE_ENTRIES > 0U)
+    uint8_t flags = SCI_UART_BAUD_CACHE_VALID;
+    if (NULL != p_mddr)
+    {
+        flags |= SCI_UART_BAUD_CACHE_MODULATION;
+    }
+    if (select_16_base_clk_cycles)
+    {
+        flags |= SCI_UART_BAUD_CACHE_16_BASE_CLK;
+    }
+
+    /** Look for a previous result for this clock frequency, baud rate and mode. */
+    sci_uart_baud_cache_t entry = {0U};
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    for (uint32_t i = 0U; i < SCI_UART_CFG_BAUD_CACHE_ENTRIES; i++)
+    {
+        if ((g_sci_uart_baud_cache[i].flags == flags) && (g_sci_uart_baud_cache[i].freq_hz == freq_hz) &&
+            (g_sci_uart_baud_cache[i].baudrate == baudrate))
+        {
+            entry = g_sci_uart_baud_cache[i];
+            break;
+        }
+    }
+    SSP_CRITICAL_SECTION_EXIT;
+
+    if (0U != entry.flags)
+    {
+        *p_brr_value     = entry.brr;
+        *pp_baud_setting = &async_baud[entry.setting];
+        if (NULL != p_mddr)
+        {
+            *p_mddr = entry.mddr;
+        }
+
+        return entry.bit_err;
+    }
+#endif
+
+    int32_t bit_err = r_sci_uart_brr_mddr_calculate(freq_hz, baudrate, p_brr_value, pp_baud_setting, p_mddr,
+                                                    select_16_base_clk_cycles);
+
+#if (SCI_UART_CFG_BAUD_CACHE_ENTRIES > 0U)
+    /** Only cache results that found a setting, so every output is known. */
+    if (bit_err < SCI_UART_100_PERCENT_X_1000)
+    {
+        entry.freq_hz  = freq_hz;
+        entry.baudrate = baudrate;
+        entry.bit_err  = bit_err;
+        entry.mddr     = (NULL != p_mddr) ? (uint16_t) *p_mddr : 0U;
+        entry.brr      = *p_brr_value;
+        entry.setting  = (uint8_t) (*pp_baud_setting - &async_baud[0]);
+        entry.flags    = flags;
+
+        SSP_CRITICAL_SECTION_ENTER;
+        g_sci_uart_baud_cache[g_sci_uart_baud_cache_next] = entry;
+        g_sci_uart_baud_cache_next = (g_sci_uart_baud_cache_next + 1U) % SCI_UART_CFG_BAUD_CACHE_ENTRIES;
+        SSP_CRITICAL_SECTION_EXIT;
+    }
+#endif
+
+    return bit_err;
+}
+
 /*******************************************************************************************************************//**
  * Calculates baud rate register settings. Evaluates and determines the best possible settings set to the baud rate
  * related registers.
@@ -1406,12 +1752,12 @@ static ssp_err_t r_sci_uart_baud_calculate(sci_clk_src_t           clk_src,
         SCI_UART_ERROR_RETURN(SSP_SUCCESS == err, SSP_ERR_INVALID_ARGUMENT);
 
         /** Try to get accurate baudrate using 16 base clk cycles per bit */
-        int32_t  hit_bit_err = r_sci_uart_brr_mddr_calculate(freq_hz, baudrate, p_brr_value, pp_baud_setting, p_mddr, true);
+        int32_t  hit_bit_err = r_sci_uart_brr_mddr_get(freq_hz, baudrate, p_brr_value, pp_baud_setting, p_mddr, true);
 
         /** If the clock is not accurate enough, try with different base clk cycles per bit */
         if (hit_bit_err > ((int32_t) baud_rate_error_x_1000))
         {
-            hit_bit_err = r_sci_uart_brr_mddr_calculate(freq_hz, baudrate, p_brr_value, pp_baud_setting, p_mddr, false);
+            hit_bit_err = r_sci_uart_brr_mddr_get(freq_hz, baudrate, p_brr_value, pp_baud_setting, p_mddr, false);
         }
 
         /** Return an error if the percent error is larger than the maximum percent error allowed for this instance */
@@ -1675,7 +2021,7 @@ void r_sci_uart_rxi_read_no_transfer_eventset(sci_uart_instance_ctrl_t * const p
     {
         args.data = data;
         args.event = UART_EVENT_RX_CHAR;
-        p_ctrl->p_callback(&args);
+        r_sci_uart_callback_call(p_ctrl, &args);
     }
     /* If read API is called then invoke callback with UART_EVENT_RX_COMPLETE event after receiving the expected bytes.*/
     else if(p_ctrl->rx_bytes_count < p_ctrl->rx_dst_bytes)
@@ -1703,7 +2049,7 @@ void r_sci_uart_rxi_read_no_transfer_eventset(sci_uart_instance_ctrl_t * const p
             args.event = UART_EVENT_RX_COMPLETE;
             p_ctrl->rx_bytes_count = 0U;
             p_ctrl->rx_dst_bytes = 0U;
-            p_ctrl->p_callback(&args);
+            r_sci_uart_callback_call(p_ctrl, &args);
         }
     }
 }
@@ -1774,6 +2120,16 @@ static ssp_err_t r_sci_uart_abort_rx(sci_uart_instance_ctrl_t * p_ctrl)
         p_ctrl->rx_dst_bytes = 0U;
 
     }
+    if (NULL != p_ctrl->p_rx_ring)
+    {
+        /** Stop streaming and restore the FIFO settings used by read(). */
+        p_ctrl->p_rx_ring = NULL;
+        if (0U != p_ctrl->fifo_depth)
+        {
+            HW_SCI_RxTriggerNumberSet(p_ctrl->p_reg, 0U);
+            HW_SCI_RXIeventSelect(p_ctrl->p_reg);
+        }
+    }
     /** If the channel has FIFO and data number in receive FIFO is not zero then reset the FIFO */
     if((0U != p_ctrl->fifo_depth) && (HW_SCI_FIFO_ReadCount(p_ctrl->p_reg) != 0))
     {
@@ -1781,6 +2137,158 @@ static ssp_err_t r_sci_uart_abort_rx(sci_uart_instance_ctrl_t * p_ctrl)
     }
     return err;
 }
+
+/*******************************************************************************************************************//**
+ * Arms the receive transfer for the segment of the ring between rx_ring_head and rx_ring_end.
+ *
+ * @param[in] p_ctrl                 Pointer to UART instance control
+ *
+ * @return                       See @ref Common_Error_Codes or functions called by this function for other possible
+ *                               return codes. This function calls:
+ *                                   * transfer_api_t::reset
+ **********************************************************************************************************************/
+static ssp_err_t r_sci_uart_ring_arm (sci_uart_instance_ctrl_t * const p_ctrl)
+{
+    uint32_t offset = p_ctrl->rx_ring_head & (p_ctrl->rx_ring_bytes - 1U);
+    uint32_t size   = (p_ctrl->rx_ring_end - p_ctrl->rx_ring_head) >> (p_ctrl->data_bytes - 1U);
+
+    return p_ctrl->p_transfer_rx->p_api->reset(p_ctrl->p_transfer_rx->p_ctrl, NULL, &p_ctrl->p_rx_ring[offset],
+                                               (uint16_t) size);
+}
+
+/*******************************************************************************************************************//**
+ * Calculates the number of bytes the receive transfer has landed in the armed segment of the ring.
+ *
+ * @param[in] p_ctrl                 Pointer to UART instance control
+ *
+ * @return    Number of bytes landed after rx_ring_head.
+ **********************************************************************************************************************/
+static uint32_t r_sci_uart_ring_landed (sci_uart_instance_ctrl_t * const p_ctrl)
+{
+    transfer_properties_t properties = {0U};
+    p_ctrl->p_transfer_rx->p_api->infoGet(p_ctrl->p_transfer_rx->p_ctrl, &properties);
+    uint32_t remaining = (uint32_t) properties.transfer_length_remaining << (p_ctrl->data_bytes - 1U);
+
+    return (p_ctrl->rx_ring_end - p_ctrl->rx_ring_head) - remaining;
+}
+
+/*******************************************************************************************************************//**
+ * Moves the armed segment to the next half of the ring after the current one is filled.  rx_ring_seq must be odd.
+ *
+ * @param[in] p_ctrl                 Pointer to UART instance control
+ *
+ * @return    UART_EVENT_RX_RING_FULL if the filled segment ends the ring, UART_EVENT_RX_RING_HALF otherwise.
+ **********************************************************************************************************************/
+static uint32_t r_sci_uart_ring_advance (sci_uart_instance_ctrl_t * const p_ctrl)
+{
+    p_ctrl->rx_ring_head = p_ctrl->rx_ring_end;
+    p_ctrl->rx_ring_end  = p_ctrl->rx_ring_end + (p_ctrl->rx_ring_bytes / 2U);
+
+    if (0U == (p_ctrl->rx_ring_head & (p_ctrl->rx_ring_bytes - 1U)))
+    {
+        return (uint32_t) UART_EVENT_RX_RING_FULL;
+    }
+
+    return (uint32_t) UART_EVENT_RX_RING_HALF;
+}
+
+/*******************************************************************************************************************//**
+ * Calls the user callback once for each streaming event set in events, with the number of unread bytes.
+ *
+ * @param[in] p_ctrl                 Pointer to UART instance control
+ * @param[in] events                 Bitwise OR of UART_EVENT_RX_RING_HALF, UART_EVENT_RX_RING_FULL and
+ *                                   UART_EVENT_RX_TIMEOUT
+ **********************************************************************************************************************/
+static void r_sci_uart_ring_callback (sci_uart_instance_ctrl_t * const p_ctrl, uint32_t const events)
+{
+    static const uart_event_t ring_events[] =
+    {
+        UART_EVENT_RX_RING_HALF, UART_EVENT_RX_RING_FULL, UART_EVENT_RX_TIMEOUT
+    };
+
+    if (NULL == p_ctrl->p_callback)
+    {
+        return;
+    }
+
+    uart_callback_args_t args;
+    args.channel   = p_ctrl->channel;
+    args.p_context = p_ctrl->p_context;
+    for (uint32_t i = 0U; i < (sizeof(ring_events) / sizeof(ring_events[0])); i++)
+    {
+        if (0U != (events & (uint32_t) ring_events[i]))
+        {
+            args.event = ring_events[i];
+            args.data  = p_ctrl->rx_ring_head - p_ctrl->rx_ring_tail;
+            r_sci_uart_callback_call(p_ctrl, &args);
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Handles the end of the receive transfer in streaming mode: the armed segment is full, so the transfer is re-armed
+ * for the next half of the ring before the user is notified.
+ *
+ * @param[in] p_ctrl                 Pointer to UART instance control
+ **********************************************************************************************************************/
+static void r_sci_uart_ring_segment_end (sci_uart_instance_ctrl_t * const p_ctrl)
+{
+    p_ctrl->rx_ring_seq++;
+    uint32_t events = r_sci_uart_ring_advance(p_ctrl);
+    r_sci_uart_ring_arm(p_ctrl);
+    p_ctrl->rx_ring_seq++;
+
+    r_sci_uart_ring_callback(p_ctrl, events);
+}
+
+/*******************************************************************************************************************//**
+ * Handles the receive timeout in streaming mode.  The data held back in the FIFO is moved to the ring and the transfer
+ * is re-armed behind it.
+ *
+ * @param[in] p_ctrl                 Pointer to UART instance control
+ **********************************************************************************************************************/
+static void r_sci_uart_ring_idle (sci_uart_instance_ctrl_t * const p_ctrl)
+{
+    R_SCI0_Type * p_sci_reg = (R_SCI0_Type *) p_ctrl->p_reg;
+    uint32_t      mask      = p_ctrl->rx_ring_bytes - 1U;
+    uint32_t      events    = (uint32_t) UART_EVENT_RX_TIMEOUT;
+
+    p_ctrl->rx_ring_seq++;
+
+    /** Stop the transfer and account for the data it landed. */
+    p_ctrl->p_transfer_rx->p_api->disable(p_ctrl->p_transfer_rx->p_ctrl);
+    p_ctrl->rx_ring_head += r_sci_uart_ring_landed(p_ctrl);
+
+    /** Copy the FIFO contents to the ring. */
+    while (HW_SCI_FIFO_ReadCount(p_sci_reg) > 0U)
+    {
+        if (p_ctrl->rx_ring_head == p_ctrl->rx_ring_end)
+        {
+            events |= r_sci_uart_ring_advance(p_ctrl);
+        }
+
+        uint16_t data   = HW_SCI_ReadFIFO(p_sci_reg);
+        uint32_t offset = p_ctrl->rx_ring_head & mask;
+        p_ctrl->p_rx_ring[offset] = (uint8_t) (data & 0xFFU);
+        if (SCI_UART_DATA_SIZE_2_BYTES == p_ctrl->data_bytes)
+        {
+            p_ctrl->p_rx_ring[offset + 1U] = (uint8_t) (data >> 8);
+        }
+        p_ctrl->rx_ring_head += p_ctrl->data_bytes;
+    }
+    if (p_ctrl->rx_ring_head == p_ctrl->rx_ring_end)
+    {
+        events |= r_sci_uart_ring_advance(p_ctrl);
+    }
+
+    /** Re-arm the transfer for the rest of the segment. */
+    r_sci_uart_ring_arm(p_ctrl);
+    p_ctrl->rx_ring_seq++;
+
+    HW_SCI_DRClear(p_sci_reg);
+
+    r_sci_uart_ring_callback(p_ctrl, events);
+}
 #endif
 
 #if (SCI_UART_CFG_TX_ENABLE)
@@ -1836,7 +2344,7 @@ void sci_uart_txi_isr (void)
                 args.data      = 0U;
                 args.event     = UART_EVENT_TX_DATA_EMPTY;
                 args.p_context = p_ctrl->p_context;
-                p_ctrl->p_callback(&args);
+                r_sci_uart_callback_call(p_ctrl, &args);
             }
         }
     }
@@ -1885,7 +2393,12 @@ void sci_uart_rxi_isr (void)
         }
 #endif
 
-        if (1U == p_ctrl->rx_transfer_in_progress)
+        if (NULL != p_ctrl->p_rx_ring)
+        {
+            /** In streaming mode, the transfer has filled half of the ring. */
+            r_sci_uart_ring_segment_end(p_ctrl);
+        }
+        else if (1U == p_ctrl->rx_transfer_in_progress)
         {
             /** If a transfer has completed, call callback with event UART_EVENT_RX_COMPLETE. */
             p_ctrl->rx_transfer_in_progress = 0U;
@@ -1898,7 +2411,7 @@ void sci_uart_rxi_isr (void)
                 args.data           = 0U;
                 args.p_context      = p_ctrl->p_context;
                 args.event = UART_EVENT_RX_COMPLETE;
-                p_ctrl->p_callback(&args);
+                r_sci_uart_callback_call(p_ctrl, &args);
             }
         }
         else
@@ -1950,7 +2463,7 @@ void sci_uart_tei_isr (void)
             args.data      = 0U;
             args.event     = UART_EVENT_TX_COMPLETE;
             args.p_context = p_ctrl->p_context;
-            p_ctrl->p_callback(&args);
+            r_sci_uart_callback_call(p_ctrl, &args);
         }
     }
 
@@ -1985,41 +2498,51 @@ void sci_uart_eri_isr (void)
         R_SCI0_Type * p_sci_reg = (R_SCI0_Type *) p_ctrl->p_reg;
         uint32_t data = 0U;
         volatile uart_callback_args_t args = {0U};
+        bool error = HW_SCI_OverRunErrorCheck(p_sci_reg) || HW_SCI_FramingErrorCheck(p_sci_reg) ||
+                     HW_SCI_ParityErrorCheck(p_sci_reg);
 
-        /** Read data. */
-        r_sci_uart_read_data(p_ctrl, &data);
-
-        /** Determine cause of error. */
-        if (HW_SCI_OverRunErrorCheck(p_sci_reg))
+        if ((!error) && (NULL != p_ctrl->p_rx_ring) && (0U != p_ctrl->fifo_depth) && HW_SCI_DRBitGet(p_sci_reg))
         {
-            args.event = UART_EVENT_ERR_OVERFLOW;
+            /** In streaming mode, the receive timeout is signaled on ERI. */
+            r_sci_uart_ring_idle(p_ctrl);
         }
-        else if (HW_SCI_FramingErrorCheck(p_sci_reg))
+        else
         {
-            if (HW_SCI_BreakDetectionCheck(p_sci_reg))
+            /** Read data. */
+            r_sci_uart_read_data(p_ctrl, &data);
+
+            /** Determine cause of error. */
+            if (HW_SCI_OverRunErrorCheck(p_sci_reg))
             {
-                args.event = UART_EVENT_BREAK_DETECT;
+                args.event = UART_EVENT_ERR_OVERFLOW;
+            }
+            else if (HW_SCI_FramingErrorCheck(p_sci_reg))
+            {
+                if (HW_SCI_BreakDetectionCheck(p_sci_reg))
+                {
+                    args.event = UART_EVENT_BREAK_DETECT;
+                }
+                else
+                {
+                    args.event = UART_EVENT_ERR_FRAMING;
+                }
             }
             else
             {
-                args.event = UART_EVENT_ERR_FRAMING;
+                args.event = UART_EVENT_ERR_PARITY;
             }
-        }
-        else
-        {
-            args.event = UART_EVENT_ERR_PARITY;
-        }
 
-        /** Clear error condition. */
-        HW_SCI_ErrorConditionClear (p_sci_reg);
+            /** Clear error condition. */
+            HW_SCI_ErrorConditionClear (p_sci_reg);
 
-        /** Call callback if available. */
-        if (NULL != p_ctrl->p_callback)
-        {
-            args.channel   = channel;
-            args.data      = data;
-            args.p_context = p_ctrl->p_context;
-            p_ctrl->p_callback((uart_callback_args_t *) &args);
+            /** Call callback if available. */
+            if (NULL != p_ctrl->p_callback)
+            {
+                args.channel   = channel;
+                args.data      = data;
+                args.p_context = p_ctrl->p_context;
+                r_sci_uart_callback_call(p_ctrl, (uart_callback_args_t *) &args);
+            }
         }
     }
 
@@ -2030,3 +2553,32 @@ void sci_uart_eri_isr (void)
     SF_CONTEXT_RESTORE;
 }  /* End of function sci_uart_eri_isr () */
 #endif /* if (SCI_UART_CFG_RX_ENABLE) */
+
+/*******************************************************************************************************************//**
+ * Calls the user callback, or posts it to the BSP deferred work scheduler if deferred callbacks are configured. If no
+ * work slot is free, the deferred callback is dropped and counted by the scheduler.
+ *
+ * @param[in] p_ctrl                 Pointer to UART instance control
+ * @param[in] p_args                 Callback arguments, copied if the callback is deferred
+ **********************************************************************************************************************/
+static void r_sci_uart_callback_call (sci_uart_instance_ctrl_t * const p_ctrl, uart_callback_args_t * const p_args)
+{
+    (void) R_BSP_WorkPostOrCall(p_ctrl->deferred_callback, r_sci_uart_callback_work, p_ctrl, p_args,
+                                sizeof(uart_callback_args_t), p_ctrl->deferred_callback_priority);
+}
+
+/*******************************************************************************************************************//**
+ * Runs the user callback. The channel may have been closed after a deferred callback was posted.
+ *
+ * @param[in] p_context              Pointer to UART instance control
+ * @param[in] p_args                 Copy of the callback arguments
+ **********************************************************************************************************************/
+static void r_sci_uart_callback_work (void * p_context, void * p_args)
+{
+    sci_uart_instance_ctrl_t * p_ctrl = (sci_uart_instance_ctrl_t *) p_context;
+
+    if (NULL != p_ctrl->p_callback)
+    {
+        p_ctrl->p_callback((uart_callback_args_t *) p_args);
+    }
+}
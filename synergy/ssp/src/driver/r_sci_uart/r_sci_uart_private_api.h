@@ -34,6 +34,9 @@ ssp_err_t R_SCI_UartInfoGet    (uart_ctrl_t * const p_ctrl, uart_info_t * const
 ssp_err_t R_SCI_UartClose      (uart_ctrl_t * const p_ctrl);
 ssp_err_t R_SCI_UartVersionGet (ssp_version_t * p_version);
 ssp_err_t R_SCI_UartAbort      (uart_ctrl_t * const p_ctrl, uart_dir_t communication_to_abort);
+ssp_err_t R_SCI_UartReadStream (uart_ctrl_t * const p_ctrl, uint8_t * const p_ring, uint32_t const bytes);
+ssp_err_t R_SCI_UartRingRead   (uart_ctrl_t * const p_ctrl, uint8_t * const p_dest, uint32_t const bytes,
+                                uint32_t * const p_bytes_read);
 
 /* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
 SSP_FOOTER
@@ -60,6 +60,9 @@
 /* Delay up to 10 ms before timing out waiting for access end flag after receiving data during initialization. */
 #define SDMMC_ACCESS_TIMEOUT_US      (10000U)
 
+/* Interval for checking the busy status of an eMMC device, which does not raise an interrupt, while sleeping. */
+#define SDMMC_BUSY_POLL_US           (10U)
+
 /* 400 kHz maximum clock required for initialization. */
 #define SDMMC_INIT_MAX_CLOCK_RATE_HZ             (400000U)
 #define SDMMC_BITS_PER_COMMAD                    (48U)
@@ -92,6 +95,17 @@
 /* Startup delay in milliseconds. */
 #define SDMMC_STARTUP_DELAY_MS          (37U)
 
+/* Events that must occur before a read or write command is complete, see sdmmc_instance_ctrl_t::transfer_pending. */
+#define SDMMC_TRANSFER_PENDING_ACCESS_END    (1U << 0)
+#define SDMMC_TRANSFER_PENDING_TRANSFER_END  (1U << 1)
+
+/* Maximum number of sectors in one read or write command, limited by the block count of the transfer driver. */
+#define SDMMC_MAX_BLOCKS_PER_COMMAND         (0xFFFFU)
+
+/* Control command of later SSP releases.  It is not part of ssp_command_t in this SSP, so it is kept local to the
+ * driver. */
+#define SDMMC_COMMAND_GET_SECTOR_RELEASE     (7U)
+
 /** Macro for error logger. */
 #ifndef SDMMC_ERROR_RETURN
 /*LDRA_INSPECTED 77 S This macro does not work when surrounded by parentheses. */
@@ -107,6 +121,8 @@
  **********************************************************************************************************************/
 #if SDMMC_CFG_PARAM_CHECKING_ENABLE
 static ssp_err_t r_sdmmc_open_param_check(sdmmc_instance_ctrl_t * p_ctrl, sdmmc_cfg_t const * const p_cfg);
+
+static ssp_err_t r_sdmmc_segment_param_check(sdmmc_segment_t const * const p_segments, uint32_t segment_count);
 #endif
 
 static ssp_err_t r_sdmmc_erase_error_check (sdmmc_instance_ctrl_t * const p_ctrl, uint32_t const start_sector, uint32_t const sector_count);
@@ -123,6 +139,8 @@ static void      r_sdmmc_access_irq_process (sdmmc_instance_ctrl_t * p_ctrl, sdm
 
 static bool      r_sdmmc_command_send (sdmmc_instance_ctrl_t * p_ctrl, uint16_t command, uint32_t argument);
 
+static void      r_sdmmc_command_start (sdmmc_instance_ctrl_t * p_ctrl, uint16_t command, uint32_t argument);
+
 static bool      r_sdmmc_max_clock_rate_set (sdmmc_instance_ctrl_t * p_ctrl, uint32_t max_rate);
 
 static bool      r_sdmmc_clock_div_set (sdmmc_instance_ctrl_t * p_ctrl, uint8_t divisor);
@@ -165,6 +183,25 @@ static ssp_err_t r_sdmmc_read_write_common(sdmmc_instance_ctrl_t * const p_ctrl,
                                     uint16_t   command,
                                     uint32_t   argument);
 
+static void      r_sdmmc_data_size_set(sdmmc_instance_ctrl_t * const p_ctrl, uint32_t block_count, uint16_t block_size);
+
+static bool      r_sdmmc_response_check(sdmmc_instance_ctrl_t * const p_ctrl, uint32_t block_count);
+
+static ssp_err_t r_sdmmc_vector_start(sdmmc_instance_ctrl_t * const p_ctrl,
+                                      sdmmc_segment_t const * const p_segments,
+                                      uint32_t                      segment_count,
+                                      sdmmc_transfer_dir_t          dir);
+
+static uint32_t  r_sdmmc_segment_next(sdmmc_instance_ctrl_t * const p_ctrl, uint32_t * p_sector, uint8_t ** pp_data);
+
+static uint16_t  r_sdmmc_data_command_get(sdmmc_transfer_dir_t dir, uint32_t block_count);
+
+static uint32_t  r_sdmmc_data_argument_get(sdmmc_instance_ctrl_t * const p_ctrl, uint32_t sector);
+
+static sdmmc_event_t r_sdmmc_transfer_pending_clear(sdmmc_instance_ctrl_t * const p_ctrl, uint32_t pending);
+
+static sdmmc_event_t r_sdmmc_transfer_next(sdmmc_instance_ctrl_t * const p_ctrl);
+
 static void      r_sdmmc_software_copy(void const * p_src, uint32_t bytes, void * p_dest);
 
 static void      r_sdmmc_transfer_callback(transfer_callback_args_t * p_args);
@@ -179,6 +216,19 @@ static ssp_err_t r_sdmmc_transfer_write (sdmmc_instance_ctrl_t * const p_ctrl,
                                    uint32_t             bytes,
                                    const uint8_t      * p_data);
 
+static void *    r_sdmmc_transfer_prepare (sdmmc_instance_ctrl_t * const p_ctrl,
+                                   sdmmc_transfer_dir_t dir,
+                                   uint32_t             block_count,
+                                   uint32_t             bytes,
+                                   uint8_t const      * p_data,
+                                   uint16_t           * p_num_blocks);
+
+static ssp_err_t r_sdmmc_transfer_rearm (sdmmc_instance_ctrl_t * const p_ctrl,
+                                   sdmmc_transfer_dir_t dir,
+                                   uint32_t             block_count,
+                                   uint32_t             bytes,
+                                   uint8_t const      * p_data);
+
 static ssp_err_t r_sdmmc_cmd52 (sdmmc_instance_ctrl_t * const        p_ctrl,
                             uint8_t  * const            p_data,
                             uint32_t const              function,
@@ -192,6 +242,19 @@ static void      r_sdmmc_card_inserted_get (sdmmc_instance_ctrl_t * const p_ctrl
 
 static ssp_err_t r_sdmmc_control_error_check(sdmmc_instance_ctrl_t * const p_ctrl, ssp_command_t const command, void * p_data);
 
+static bool      r_sdmmc_wait (sdmmc_instance_ctrl_t * const p_ctrl, bsp_timer_condition_t p_condition,
+                               uint64_t timeout_us, uint32_t poll_us);
+
+static bool      r_sdmmc_response_end_or_error (void * p_context);
+
+static bool      r_sdmmc_bre_or_error (void * p_context);
+
+static bool      r_sdmmc_access_end_get (void * p_context);
+
+static bool      r_sdmmc_clock_enabled_get (void * p_context);
+
+static bool      r_sdmmc_card_ready_get (void * p_context);
+
 void        sdhimmc_accs_isr (void);
 
 void        sdhimmc_card_isr (void);
@@ -250,7 +313,9 @@ const sdmmc_api_t g_sdmmc_on_sdmmc =
     .IoIntEnable = R_SDMMC_IoIntEnable,
     .versionGet  = R_SDMMC_VersionGet,
     .infoGet     = R_SDMMC_InfoGet,
-    .erase       = R_SDMMC_Erase
+    .erase       = R_SDMMC_Erase,
+    .readV       = R_SDMMC_ReadV,
+    .writeV      = R_SDMMC_WriteV
 };
 
 /*******************************************************************************************************************//**
@@ -475,36 +540,18 @@ ssp_err_t R_SDMMC_Read (sdmmc_ctrl_t * const p_api_ctrl, uint8_t * const p_dest,
 #if SDMMC_CFG_PARAM_CHECKING_ENABLE
     /* Check pointers for NULL values */
     SSP_ASSERT(NULL != p_dest);
+    SSP_ASSERT(0U != sector_count);
 #endif
 
     /* Perform a error check on valid parameter and card status */
     ret_val = r_sdmmc_common_error_check(p_ctrl, false);
     SDMMC_ERROR_RETURN(SSP_SUCCESS == ret_val, ret_val);
 
-    /** Configure the transfer interface for reading. */
-    ret_val = r_sdmmc_transfer_read(p_ctrl, sector_count, p_ctrl->status.sector_size, p_dest);
-    SDMMC_ERROR_RETURN(SSP_SUCCESS == ret_val, SSP_ERR_READ_FAILED);
-
-    uint16_t command = 0U;
-    uint32_t argument = start_sector;
-    if (!p_ctrl->status.hc)
-    {
-        /* Standard capacity SD cards and some eMMC devices use byte addressing. */
-        argument *= p_ctrl->status.sector_size;
-    }
-
-    if (sector_count > 1U)
-    {
-        command = SDMMC_CMD_READ_MULTIPLE_BLOCK;
-    }
-    else
-    {
-        command = SDMMC_CMD_READ_SINGLE_BLOCK;
-    }
-
-    /* Casting to uint16_t safe because block size verified in R_SDMMC_Open */
-    /** Read data from SD or eMMC device. */
-    ret_val = r_sdmmc_read_write_common(p_ctrl, sector_count, (uint16_t) p_ctrl->status.sector_size, command, argument);
+    /** Read data from SD or eMMC device as a list of one segment. */
+    p_ctrl->segment.sector   = start_sector;
+    p_ctrl->segment.p_buffer = p_dest;
+    p_ctrl->segment.count    = sector_count;
+    ret_val = r_sdmmc_vector_start(p_ctrl, &p_ctrl->segment, 1U, SDMMC_TRANSFER_DIR_READ);
     SDMMC_ERROR_RETURN(SSP_SUCCESS == ret_val, SSP_ERR_READ_FAILED);
 
     return ret_val;
@@ -537,37 +584,18 @@ ssp_err_t R_SDMMC_Write (sdmmc_ctrl_t * const p_api_ctrl, uint8_t const * const
 #if SDMMC_CFG_PARAM_CHECKING_ENABLE
     /* Check pointers for NULL values */
     SSP_ASSERT(NULL != p_source);
+    SSP_ASSERT(0U != sector_count);
 #endif
 
     /* Perform a error check on valid parameter and card status */
     ret_val = r_sdmmc_common_error_check(p_ctrl, true);
     SDMMC_ERROR_RETURN(SSP_SUCCESS == ret_val, ret_val);
 
-    /** Configure the transfer interface for writing. */
-    ret_val = r_sdmmc_transfer_write(p_ctrl, sector_count, p_ctrl->status.sector_size, p_source);
-    SDMMC_ERROR_RETURN(SSP_SUCCESS == ret_val, SSP_ERR_WRITE_FAILED);
-
-    /** Call SDMMC protocol write function */
-    uint16_t command = 0U;
-    uint32_t argument = start_sector;
-    if (!p_ctrl->status.hc)
-    {
-        /* Standard capacity SD cards and some eMMC devices use byte addressing. */
-        argument *= p_ctrl->status.sector_size;
-    }
-
-    if (sector_count > 1U)
-    {
-        command = SDMMC_CMD_WRITE_MULTIPLE_BLOCK;
-    }
-    else
-    {
-        command = SDMMC_CMD_WRITE_SINGLE_BLOCK;
-    }
-
-    /* Casting to uint16_t safe because block size verified in R_SDMMC_Open */
-    /** Write data to SD or eMMC device. */
-    ret_val = r_sdmmc_read_write_common(p_ctrl, sector_count, (uint16_t) p_ctrl->status.sector_size, command, argument);
+    /** Write data to SD or eMMC device as a list of one segment.  The source buffer is only read. */
+    p_ctrl->segment.sector   = start_sector;
+    p_ctrl->segment.p_buffer = (uint8_t *) p_source;
+    p_ctrl->segment.count    = sector_count;
+    ret_val = r_sdmmc_vector_start(p_ctrl, &p_ctrl->segment, 1U, SDMMC_TRANSFER_DIR_WRITE);
     SDMMC_ERROR_RETURN(SSP_SUCCESS == ret_val, SSP_ERR_WRITE_FAILED);
 
     return ret_val;
@@ -594,7 +622,7 @@ ssp_err_t R_SDMMC_Control (sdmmc_ctrl_t * const p_api_ctrl, ssp_command_t const
     SDMMC_ERROR_RETURN(SSP_SUCCESS == ret_val, ret_val);
 
     /** Get the command status and return to called function. */
-    switch (command)
+    switch ((uint32_t) command)
     {
         /* Get the media sector count. */
         case SSP_COMMAND_GET_SECTOR_COUNT:
@@ -617,7 +645,7 @@ ssp_err_t R_SDMMC_Control (sdmmc_ctrl_t * const p_api_ctrl, ssp_command_t const
             break;
 
         /* Get flash sector release information. */
-        case SSP_COMMAND_GET_SECTOR_RELEASE:
+        case SDMMC_COMMAND_GET_SECTOR_RELEASE:
             *(uint8_t *)p_data = 0U;
             break;
 
@@ -1030,23 +1058,17 @@ ssp_err_t R_SDMMC_Erase (sdmmc_ctrl_t * const p_api_ctrl, uint32_t const start_s
         uint64_t timeout = (SDMMC_ERASE_TIMEOUT_PER_SECTOR_US * ((uint64_t) sector_count)) + 3000000U;
 
         /* The event status is updated in the access interrupt.  Use a local copy of the event status to make sure
-         * it isn't updated during the loop. */
+         * it isn't updated while it is checked. */
+        bool completed = r_sdmmc_wait(p_ctrl, r_sdmmc_response_end_or_error, timeout, 0U);
         volatile sdhi_event_t event;
         event.word = p_ctrl->sdhi_event.word;
-        while (timeout > 0U)
-        {
-            /* Return an error if a hardware error occurred. */
-            SDMMC_ERROR_RETURN(!event.bit.event_error, SSP_ERR_ERASE_FAILED);
-            if (event.bit.response_end)
-            {
-                /* If the response end bit is set, the erase is complete. */
-                return SSP_SUCCESS;
-            }
-            R_BSP_SoftwareDelay(1U, BSP_DELAY_UNITS_MICROSECONDS);
-            timeout--;
 
-            /* Check for updates to the event status. */
-            event.word = p_ctrl->sdhi_event.word;
+        /* Return an error if a hardware error occurred. */
+        SDMMC_ERROR_RETURN(!event.bit.event_error, SSP_ERR_ERASE_FAILED);
+        if (completed && event.bit.response_end)
+        {
+            /* If the response end bit is set, the erase is complete. */
+            return SSP_SUCCESS;
         }
 
         ret_val = SSP_ERR_ERASE_FAILED;
@@ -1055,6 +1077,93 @@ ssp_err_t R_SDMMC_Erase (sdmmc_ctrl_t * const p_api_ctrl, uint32_t const start_s
     return ret_val;
 }
 
+/*******************************************************************************************************************//**
+ * Reads a list of segments from an SD or eMMC device as one operation.  Implements sdmmc_api_t::readV().
+ *
+ * This function blocks until the command for the first segment is sent and the response is received.  The commands
+ * for the following segments are issued back to back from the access interrupt, reusing the open transfer driver.
+ * Segments that continue the previous segment both on the device and in memory are merged into one command.  A single
+ * callback with the event SDMMC_EVENT_TRANSFER_COMPLETE is called when the data of every segment is available, or
+ * with SDMMC_EVENT_TRANSFER_ERROR if a command fails.
+ *
+ * Buffers that are not 4-byte aligned are staged through the control block, SDMMC_CFG_UNALIGNED_BLOCKS sectors per
+ * transfer interrupt.  Aligned buffers are accessed directly by the DMAC or DTC.
+ *
+ * @retval  SSP_SUCCESS                  First command accepted, the rest of the list is read in the background.
+ * @retval  SSP_ERR_ASSERTION            NULL pointer, empty list, or a segment with no sectors.
+ * @retval  SSP_ERR_NOT_OPEN             Driver has not been initialized.
+ * @retval  SSP_ERR_CARD_NOT_READY       Card was unplugged.
+ * @retval  SSP_ERR_TRANSFER_BUSY        Driver is busy with a previous operation.
+ * @retval  SSP_ERR_READ_FAILED          Read operation failed.
+ *
+ * @note The segment list and the buffers must remain valid until the callback is called.
+ * @note This function is reentrant for different channels.  It is not reentrant for the same channel.
+ **********************************************************************************************************************/
+ssp_err_t R_SDMMC_ReadV (sdmmc_ctrl_t          * const p_api_ctrl,
+                         sdmmc_segment_t const * const p_segments,
+                         uint32_t                const segment_count)
+{
+    sdmmc_instance_ctrl_t * p_ctrl = (sdmmc_instance_ctrl_t *) p_api_ctrl;
+
+    ssp_err_t ret_val = SSP_SUCCESS;
+
+#if SDMMC_CFG_PARAM_CHECKING_ENABLE
+    ret_val = r_sdmmc_segment_param_check(p_segments, segment_count);
+    SDMMC_ERROR_RETURN(SSP_SUCCESS == ret_val, ret_val);
+#endif
+
+    /* Perform a error check on valid parameter and card status */
+    ret_val = r_sdmmc_common_error_check(p_ctrl, false);
+    SDMMC_ERROR_RETURN(SSP_SUCCESS == ret_val, ret_val);
+
+    /** Read the segments from SD or eMMC device. */
+    ret_val = r_sdmmc_vector_start(p_ctrl, p_segments, segment_count, SDMMC_TRANSFER_DIR_READ);
+    SDMMC_ERROR_RETURN(SSP_SUCCESS == ret_val, SSP_ERR_READ_FAILED);
+
+    return ret_val;
+}
+
+/*******************************************************************************************************************//**
+ * Writes a list of segments to an SD or eMMC device as one operation.  Implements sdmmc_api_t::writeV().
+ *
+ * Segments are chained and merged as described for R_SDMMC_ReadV().  A single callback with the event
+ * SDMMC_EVENT_TRANSFER_COMPLETE is called when every segment has been written.
+ *
+ * @retval  SSP_SUCCESS                  First command accepted, the rest of the list is written in the background.
+ * @retval  SSP_ERR_ASSERTION            NULL pointer, empty list, or a segment with no sectors.
+ * @retval  SSP_ERR_NOT_OPEN             Driver has not been initialized.
+ * @retval  SSP_ERR_CARD_NOT_READY       Card was unplugged.
+ * @retval  SSP_ERR_TRANSFER_BUSY        Driver is busy with a previous operation.
+ * @retval  SSP_ERR_WRITE_PROTECTED      SD card is Write Protected.
+ * @retval  SSP_ERR_WRITE_FAILED         Write operation failed.
+ *
+ * @note The segment list and the buffers must remain valid until the callback is called.
+ * @note This function is reentrant for different channels.  It is not reentrant for the same channel.
+ **********************************************************************************************************************/
+ssp_err_t R_SDMMC_WriteV (sdmmc_ctrl_t          * const p_api_ctrl,
+                          sdmmc_segment_t const * const p_segments,
+                          uint32_t                const segment_count)
+{
+    sdmmc_instance_ctrl_t * p_ctrl = (sdmmc_instance_ctrl_t *) p_api_ctrl;
+
+    ssp_err_t ret_val = SSP_SUCCESS;
+
+#if SDMMC_CFG_PARAM_CHECKING_ENABLE
+    ret_val = r_sdmmc_segment_param_check(p_segments, segment_count);
+    SDMMC_ERROR_RETURN(SSP_SUCCESS == ret_val, ret_val);
+#endif
+
+    /* Perform a error check on valid parameter and card status */
+    ret_val = r_sdmmc_common_error_check(p_ctrl, true);
+    SDMMC_ERROR_RETURN(SSP_SUCCESS == ret_val, ret_val);
+
+    /** Write the segments to SD or eMMC device. */
+    ret_val = r_sdmmc_vector_start(p_ctrl, p_segments, segment_count, SDMMC_TRANSFER_DIR_WRITE);
+    SDMMC_ERROR_RETURN(SSP_SUCCESS == ret_val, SSP_ERR_WRITE_FAILED);
+
+    return ret_val;
+}
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup SDMMC)
  **********************************************************************************************************************/
@@ -1098,6 +1207,29 @@ static ssp_err_t r_sdmmc_open_param_check(sdmmc_instance_ctrl_t * p_ctrl, sdmmc_
 
     return SSP_SUCCESS;
 }
+
+/*******************************************************************************************************************//**
+ * Parameter checking for readV and writeV.
+ *
+ * @param[in]     p_segments     Segment list.
+ * @param[in]     segment_count  Number of segments in the list.
+ *
+ * @retval SSP_SUCCESS          The segment list is valid.
+ * @retval SSP_ERR_ASSERTION    A required pointer is NULL, the list is empty, or a segment has no sectors.
+ **********************************************************************************************************************/
+static ssp_err_t r_sdmmc_segment_param_check(sdmmc_segment_t const * const p_segments, uint32_t segment_count)
+{
+    SSP_ASSERT(NULL != p_segments);
+    SSP_ASSERT(0U != segment_count);
+
+    for (uint32_t i = 0U; i < segment_count; i++)
+    {
+        SSP_ASSERT(NULL != p_segments[i].p_buffer);
+        SSP_ASSERT(0U != p_segments[i].count);
+    }
+
+    return SSP_SUCCESS;
+}
 #endif
 
 /*******************************************************************************************************************//**
@@ -1250,6 +1382,16 @@ static void r_sdmmc_access_irq_process (sdmmc_instance_ctrl_t * p_ctrl, sdmmc_ca
     {
         /* Enable the access interrupt. */
         HW_SDMMC_AccessEndEnable(p_ctrl->p_reg);
+
+        /* Nobody waits for the response of a command issued from this interrupt, so check it here. */
+        if (p_ctrl->transfer_response_check)
+        {
+            p_ctrl->transfer_response_check = false;
+            if (!r_sdmmc_response_check(p_ctrl, p_ctrl->transfer_blocks_total))
+            {
+                p_ctrl->sdhi_event.bit.event_error = 1U;
+            }
+        }
     }
 
     /* Clear interrupt flags */
@@ -1272,12 +1414,10 @@ static void r_sdmmc_access_irq_process (sdmmc_instance_ctrl_t * p_ctrl, sdmmc_ca
             /* Check for access end */
             if (p_ctrl->sdhi_event.bit.access_end)
             {
-                /* Read transfer end and callback performed in transfer interrupt. */
-                if (SDMMC_TRANSFER_DIR_READ != p_ctrl->transfer_dir)
-                {
-                    r_sdmmc_transfer_end(p_ctrl);
-                    p_args->event = SDMMC_EVENT_TRANSFER_COMPLETE;
-                }
+                /* Reads also wait for the transfer interrupt, in which the transfer driver has moved the last block
+                 * out of the SD buffer and any staged copy is done.  The next segment is started, or the transfer
+                 * ends, once both have occurred. */
+                p_args->event = r_sdmmc_transfer_pending_clear(p_ctrl, SDMMC_TRANSFER_PENDING_ACCESS_END);
             }
         }
     }
@@ -1294,6 +1434,35 @@ static void r_sdmmc_access_irq_process (sdmmc_instance_ctrl_t * p_ctrl, sdmmc_ca
  * @retval false            Command send failed.
  **********************************************************************************************************************/
 static bool r_sdmmc_command_send (sdmmc_instance_ctrl_t * p_ctrl, uint16_t command, uint32_t argument)
+{
+    /** Start the command. */
+    r_sdmmc_command_start(p_ctrl, command, argument);
+
+    /** Wait for end of response, error or timeout */
+    if (!r_sdmmc_wait(p_ctrl, r_sdmmc_response_end_or_error, SDMMC_RESPONSE_TIMEOUT_US, 0U))
+    {
+        /* Timeout. */
+        return false;
+    }
+
+    /* The event status is updated in the access interrupt.  Use a local copy of the event status to make sure
+     * it isn't updated while it is checked. */
+    volatile sdhi_event_t event;
+    event.word = p_ctrl->sdhi_event.word;
+
+    /* Return an error if a hardware error occurred.  Otherwise the response end bit is set and the command response
+     * was received with no error. */
+    return !event.bit.event_error;
+}
+
+/*******************************************************************************************************************//**
+ * Start a command without waiting for the response.  The response end is reported by the access interrupt.
+ *
+ * @param[in]     p_ctrl    Pointer to SDMMC instance control block.
+ * @param[in]     command   Command to send.
+ * @param[in]     argument  Argument to send with the command.
+ **********************************************************************************************************************/
+static void r_sdmmc_command_start (sdmmc_instance_ctrl_t * p_ctrl, uint16_t command, uint32_t argument)
 {
     /** Clear Status */
     HW_SDMMC_StatusClear(p_ctrl->p_reg);
@@ -1309,35 +1478,6 @@ static bool r_sdmmc_command_send (sdmmc_instance_ctrl_t * p_ctrl, uint16_t comma
     /** Write argument, then command to the SDHI peripheral. */
     HW_SDMMC_SetArguments(p_ctrl->p_reg, argument);
     HW_SDMMC_CommandSend(p_ctrl->p_reg, command);
-
-    /** Wait for end of response, error or timeout */
-    uint32_t timeout = SDMMC_RESPONSE_TIMEOUT_US;
-
-    /* The event status is updated in the access interrupt.  Use a local copy of the event status to make sure
-     * it isn't updated during the loop. */
-    volatile sdhi_event_t event;
-    event.word = p_ctrl->sdhi_event.word;
-    while (timeout > 0U)
-    {
-        /* Return an error if a hardware error occurred. */
-        if (event.bit.event_error)
-        {
-            return false;
-        }
-        else if (event.bit.response_end)
-        {
-            /* If the response end bit is set, the command response was received with no error. */
-            return true;
-        }
-        R_BSP_SoftwareDelay(1U, BSP_DELAY_UNITS_MICROSECONDS);
-        timeout--;
-
-        /* Check for updates to the event status. */
-        event.word = p_ctrl->sdhi_event.word;
-    }
-
-    /* Timeout. */
-    return false;
 }
 
 /*******************************************************************************************************************//**
@@ -1691,6 +1831,37 @@ static ssp_err_t r_sdmmc_read_write_common(sdmmc_instance_ctrl_t * const p_ctrl,
 
     p_ctrl->transfer_in_progress = true;
 
+    /** Set the block count and block size. */
+    r_sdmmc_data_size_set(p_ctrl, block_count, block_size);
+
+    /** Send command. */
+    if (r_sdmmc_command_send(p_ctrl, command, argument))
+    {
+        /** Check the R1 response. */
+        if (r_sdmmc_response_check(p_ctrl, block_count))
+        {
+            ret_val = SSP_SUCCESS;
+        }
+    }
+    if (SSP_SUCCESS != ret_val)
+    {
+        /* If there was an error, stop the transfer. */
+        HW_SDMMC_DataStop(p_ctrl->p_reg, 1U);
+        r_sdmmc_transfer_end(p_ctrl);
+    }
+
+    return ret_val;
+}
+
+/*******************************************************************************************************************//**
+ * Set the block count and block size of the next read or write command.
+ *
+ * @param[in]     p_ctrl          Pointer to an open SD/MMC instance control block.
+ * @param[in]     block_count     Number of blocks/sectors to write/read.
+ * @param[in]     block_size      Sector/Block size.
+ **********************************************************************************************************************/
+static void r_sdmmc_data_size_set (sdmmc_instance_ctrl_t * const p_ctrl, uint32_t block_count, uint16_t block_size)
+{
     /** Set the block count. */
     if (block_count > 1U)
     {
@@ -1704,38 +1875,243 @@ static ssp_err_t r_sdmmc_read_write_common(sdmmc_instance_ctrl_t * const p_ctrl,
 
     /** Set block size */
     HW_SDMMC_BlockSizeSet(p_ctrl->p_reg, block_size);
+}
 
-    /** Send command. */
-    if (r_sdmmc_command_send(p_ctrl, command, argument))
+/*******************************************************************************************************************//**
+ * Check the R1 response of a read or write command.
+ *
+ * @param[in]     p_ctrl          Pointer to an open SD/MMC instance control block.
+ * @param[in]     block_count     Number of blocks/sectors of the command.
+ *
+ * @retval true   No error bits are set in the response.
+ * @retval false  The device reported an error.
+ **********************************************************************************************************************/
+static bool r_sdmmc_response_check (sdmmc_instance_ctrl_t * const p_ctrl, uint32_t block_count)
+{
+    sdmmc_priv_card_status_t response = {0U};
+    if (block_count > 1U)
     {
-        /** Check the R1 response. */
-        sdmmc_priv_card_status_t response = {0U};
-        if (block_count > 1U)
-        {
-            /* Get the R1 response for multiple block read and write from SD_RSP54 since the response in SD_RSP10 may
-             * have been overwritten by the response to CMD12. */
-            HW_SDMMC_Response54Get(p_ctrl->p_reg, &response);
-        }
-        else
+        /* Get the R1 response for multiple block read and write from SD_RSP54 since the response in SD_RSP10 may
+         * have been overwritten by the response to CMD12. */
+        HW_SDMMC_Response54Get(p_ctrl->p_reg, &response);
+    }
+    else
+    {
+        HW_SDMMC_ResponseGet(p_ctrl->p_reg, &response);
+    }
+
+    /* Verify no error bits are set in the response. */
+    return (0U == (SDMMC_R1_ERROR_BITS & response.status));
+}
+
+/*******************************************************************************************************************//**
+ * Start a scatter-gather read or write.  The first command is sent here and its response is checked.  The following
+ * commands are issued by r_sdmmc_transfer_next() when the previous command is complete.
+ *
+ * @param[in]     p_ctrl          Pointer to an open SD/MMC instance control block.
+ * @param[in]     p_segments      Segment list.  Must remain valid until the transfer is complete.
+ * @param[in]     segment_count   Number of segments in the list.
+ * @param[in]     dir             Read or write.
+ *
+ * @retval SSP_SUCCESS            First command accepted by the device.
+ * @retval SSP_ERR_INTERNAL       First command failed.
+ * @return                        See @ref Common_Error_Codes or functions called by this function for other possible
+ *                                return codes. This function calls:
+ *                                    * transfer_api_t::open
+ **********************************************************************************************************************/
+static ssp_err_t r_sdmmc_vector_start (sdmmc_instance_ctrl_t * const p_ctrl,
+                                       sdmmc_segment_t const * const p_segments,
+                                       uint32_t                      segment_count,
+                                       sdmmc_transfer_dir_t          dir)
+{
+    ssp_err_t ret_val;
+    uint32_t  sector = 0U;
+    uint8_t * p_data = NULL;
+
+    p_ctrl->p_segments     = p_segments;
+    p_ctrl->segment_count  = segment_count;
+    p_ctrl->segment_offset = 0U;
+    uint32_t block_count   = r_sdmmc_segment_next(p_ctrl, &sector, &p_data);
+
+    /** Configure the transfer interface for the first command. */
+    if (SDMMC_TRANSFER_DIR_READ == dir)
+    {
+        ret_val = r_sdmmc_transfer_read(p_ctrl, block_count, p_ctrl->status.sector_size, p_data);
+    }
+    else
+    {
+        ret_val = r_sdmmc_transfer_write(p_ctrl, block_count, p_ctrl->status.sector_size, p_data);
+    }
+
+    if (SSP_SUCCESS != ret_val)
+    {
+        p_ctrl->segment_count = 0U;
+        return ret_val;
+    }
+
+    /* Casting to uint16_t safe because block size verified in R_SDMMC_Open */
+    /** Send the first command. */
+    return r_sdmmc_read_write_common(p_ctrl, block_count, (uint16_t) p_ctrl->status.sector_size,
+                                     r_sdmmc_data_command_get(dir, block_count),
+                                     r_sdmmc_data_argument_get(p_ctrl, sector));
+}
+
+/*******************************************************************************************************************//**
+ * Take the sectors of the next command from the segment list.  Following segments are merged into the command while
+ * they continue it both on the device and in memory.
+ *
+ * @param[in,out] p_ctrl    Pointer to SDMMC instance control block.  The segment list position is advanced.
+ * @param[out]    p_sector  First sector of the command.
+ * @param[out]    pp_data   Buffer of the command.
+ *
+ * @return Number of sectors in the command.
+ **********************************************************************************************************************/
+static uint32_t r_sdmmc_segment_next (sdmmc_instance_ctrl_t * const p_ctrl, uint32_t * p_sector, uint8_t ** pp_data)
+{
+    uint32_t sector_size = p_ctrl->status.sector_size;
+    uint32_t block_count = 0U;
+
+    *p_sector = p_ctrl->p_segments->sector + p_ctrl->segment_offset;
+    *pp_data  = p_ctrl->p_segments->p_buffer + (p_ctrl->segment_offset * sector_size);
+
+    while (p_ctrl->segment_count > 0U)
+    {
+        uint32_t available = p_ctrl->p_segments->count - p_ctrl->segment_offset;
+        uint32_t room      = SDMMC_MAX_BLOCKS_PER_COMMAND - block_count;
+        if (available > room)
         {
-            HW_SDMMC_ResponseGet(p_ctrl->p_reg, &response);
+            /* The rest of the segment goes in the next command. */
+            p_ctrl->segment_offset += room;
+            block_count            += room;
+            break;
         }
 
-        /* Verify no error bits are set in the response. */
-        uint32_t error = (SDMMC_R1_ERROR_BITS & response.status);
-        if (0U == error)
+        block_count += available;
+        p_ctrl->p_segments++;
+        p_ctrl->segment_count--;
+        p_ctrl->segment_offset = 0U;
+
+        if ((0U == p_ctrl->segment_count) ||
+            (p_ctrl->p_segments->sector != (*p_sector + block_count)) ||
+            (p_ctrl->p_segments->p_buffer != (*pp_data + (block_count * sector_size))))
         {
-            ret_val = SSP_SUCCESS;
+            break;
         }
     }
-    if (SSP_SUCCESS != ret_val)
+
+    return block_count;
+}
+
+/*******************************************************************************************************************//**
+ * Get the read or write command for a number of sectors.
+ *
+ * @param[in]     dir             Read or write.
+ * @param[in]     block_count     Number of sectors.
+ *
+ * @return Single block command for one sector, multiple block command otherwise.
+ **********************************************************************************************************************/
+static uint16_t r_sdmmc_data_command_get (sdmmc_transfer_dir_t dir, uint32_t block_count)
+{
+    if (SDMMC_TRANSFER_DIR_READ == dir)
+    {
+        return (block_count > 1U) ? SDMMC_CMD_READ_MULTIPLE_BLOCK : SDMMC_CMD_READ_SINGLE_BLOCK;
+    }
+
+    return (block_count > 1U) ? SDMMC_CMD_WRITE_MULTIPLE_BLOCK : SDMMC_CMD_WRITE_SINGLE_BLOCK;
+}
+
+/*******************************************************************************************************************//**
+ * Get the read or write command argument for a sector.
+ *
+ * @param[in]     p_ctrl          Pointer to an open SD/MMC instance control block.
+ * @param[in]     sector          Sector to access.
+ *
+ * @return Sector number for high capacity devices, byte address otherwise.
+ **********************************************************************************************************************/
+static uint32_t r_sdmmc_data_argument_get (sdmmc_instance_ctrl_t * const p_ctrl, uint32_t sector)
+{
+    uint32_t argument = sector;
+    if (!p_ctrl->status.hc)
+    {
+        /* Standard capacity SD cards and some eMMC devices use byte addressing. */
+        argument *= p_ctrl->status.sector_size;
+    }
+
+    return argument;
+}
+
+/*******************************************************************************************************************//**
+ * Record that an event required to complete the current command has occurred.  Called from the access interrupt and
+ * the transfer interrupt, which may preempt each other.
+ *
+ * @param[in]     p_ctrl    Pointer to SDMMC instance control block.
+ * @param[in]     pending   SDMMC_TRANSFER_PENDING_ACCESS_END or SDMMC_TRANSFER_PENDING_TRANSFER_END.
+ *
+ * @return Event to report to the application, SDMMC_EVENT_NONE while the transfer continues.
+ **********************************************************************************************************************/
+static sdmmc_event_t r_sdmmc_transfer_pending_clear (sdmmc_instance_ctrl_t * const p_ctrl, uint32_t pending)
+{
+    bool complete;
+
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    complete = (0U != (p_ctrl->transfer_pending & pending));
+    p_ctrl->transfer_pending &= ~pending;
+    complete = complete && (0U == p_ctrl->transfer_pending);
+    SSP_CRITICAL_SECTION_EXIT;
+
+    if (!complete)
+    {
+        return SDMMC_EVENT_NONE;
+    }
+
+    return r_sdmmc_transfer_next(p_ctrl);
+}
+
+/*******************************************************************************************************************//**
+ * Called when a command is complete.  Issues the command for the next segment, or ends the transfer after the last
+ * segment.  The transfer driver is reset rather than reopened.
+ *
+ * @param[in]     p_ctrl    Pointer to SDMMC instance control block.
+ *
+ * @return Event to report to the application, SDMMC_EVENT_NONE if another command was issued.
+ **********************************************************************************************************************/
+static sdmmc_event_t r_sdmmc_transfer_next (sdmmc_instance_ctrl_t * const p_ctrl)
+{
+    if (0U == p_ctrl->segment_count)
     {
-        /* If there was an error, stop the transfer. */
-        HW_SDMMC_DataStop(p_ctrl->p_reg, 1U);
         r_sdmmc_transfer_end(p_ctrl);
+
+        return SDMMC_EVENT_TRANSFER_COMPLETE;
     }
 
-    return ret_val;
+    sdmmc_transfer_dir_t dir    = p_ctrl->transfer_dir;
+    uint32_t             sector = 0U;
+    uint8_t            * p_data = NULL;
+    uint32_t             block_count = r_sdmmc_segment_next(p_ctrl, &sector, &p_data);
+
+    /** Wait until the SDHI accepts a new command, then restart the transfer driver for the next command. */
+    ssp_err_t err = SSP_ERR_TRANSFER_BUSY;
+    if (r_sdmmc_clock_div_enable_get(p_ctrl))
+    {
+        err = r_sdmmc_transfer_rearm(p_ctrl, dir, block_count, p_ctrl->status.sector_size, p_data);
+    }
+
+    if (SSP_SUCCESS != err)
+    {
+        r_sdmmc_transfer_end(p_ctrl);
+
+        return SDMMC_EVENT_TRANSFER_ERROR;
+    }
+
+    /* Casting to uint16_t safe because block size verified in R_SDMMC_Open */
+    /** Issue the command.  Its response is checked in the access interrupt. */
+    p_ctrl->transfer_response_check = true;
+    r_sdmmc_data_size_set(p_ctrl, block_count, (uint16_t) p_ctrl->status.sector_size);
+    r_sdmmc_command_start(p_ctrl, r_sdmmc_data_command_get(dir, block_count),
+                          r_sdmmc_data_argument_get(p_ctrl, sector));
+
+    return SDMMC_EVENT_NONE;
 }
 
 /*******************************************************************************************************************//**
@@ -1975,30 +2351,14 @@ static void r_sdmmc_write_protect_get (sdmmc_instance_ctrl_t * const p_ctrl)
  **********************************************************************************************************************/
 static bool r_sdmmc_emmc_wait_for_device (sdmmc_instance_ctrl_t * const p_ctrl)
 {
-    /* For eMMC, The device may signal busy after CMD6.  Wait for busy to clear. */
-    uint32_t timeout = SDMMC_BUSY_TIMEOUT_US;
-    while (!HW_SDMMC_ClockDivEnableGet(p_ctrl->p_reg))
-    {
-        if (0U == timeout)
-        {
-            return false;
-        }
-        R_BSP_SoftwareDelay(1U, BSP_DELAY_UNITS_MICROSECONDS);
-        timeout--;
-    }
-
-    timeout = SDMMC_BUSY_TIMEOUT_US;
-    while (HW_SDMMC_CardBusyGet(p_ctrl->p_reg))
+    /* For eMMC, The device may signal busy after CMD6.  Wait for busy to clear.  The busy status does not raise an
+     * interrupt, so it is polled. */
+    if (!r_sdmmc_wait(p_ctrl, r_sdmmc_clock_enabled_get, SDMMC_BUSY_TIMEOUT_US, SDMMC_BUSY_POLL_US))
     {
-        if (0U == timeout)
-        {
-            return false;
-        }
-        R_BSP_SoftwareDelay(1U, BSP_DELAY_UNITS_MICROSECONDS);
-        timeout--;
+        return false;
     }
 
-    return true;
+    return r_sdmmc_wait(p_ctrl, r_sdmmc_card_ready_get, SDMMC_BUSY_TIMEOUT_US, SDMMC_BUSY_POLL_US);
 }
 
 /*******************************************************************************************************************//**
@@ -2120,18 +2480,7 @@ static bool r_sdmmc_sdio_clock_optimize (sdmmc_instance_ctrl_t * const p_ctrl)
  **********************************************************************************************************************/
 static bool r_sdmmc_wait_for_access_end (sdmmc_instance_ctrl_t * const p_ctrl)
 {
-    uint32_t timeout = SDMMC_ACCESS_TIMEOUT_US;
-    while (0U == p_ctrl->sdhi_event.bit.access_end)
-    {
-        if (0U == timeout)
-        {
-            return false;
-        }
-        R_BSP_SoftwareDelay(1U, BSP_DELAY_UNITS_MICROSECONDS);
-        timeout--;
-    }
-
-    return true;
+    return r_sdmmc_wait(p_ctrl, r_sdmmc_access_end_get, SDMMC_ACCESS_TIMEOUT_US, 0U);
 }
 
 /*******************************************************************************************************************//**
@@ -2322,33 +2671,19 @@ static bool r_sdmmc_read_and_block (sdmmc_instance_ctrl_t * const p_ctrl, uint16
     }
 
     /** Wait for the read buffer to fill up. */
-    uint32_t timeout = SDMMC_DATA_TIMEOUT_US;
+    if (!r_sdmmc_wait(p_ctrl, r_sdmmc_bre_or_error, SDMMC_DATA_TIMEOUT_US, 0U))
+    {
+        /* Timeout. */
+        return false;
+    }
 
     /* The event status is updated in the access interrupt.  Use a local copy of the event status to make sure
-     * it isn't updated during the loop. */
+     * it isn't updated while it is checked. */
     volatile sdhi_event_t event;
     event.word = p_ctrl->sdhi_event.word;
-    while (timeout > 0U)
-    {
-        if (event.bit.event_error)
-        {
-            /* Error occurred. */
-            return false;
-        }
-        if (event.bit.bre)
-        {
-            /* Read buffer is full. */
-            return true;
-        }
-        R_BSP_SoftwareDelay(1U, BSP_DELAY_UNITS_MICROSECONDS);
-        timeout--;
-
-        /* Check for updates to the event status. */
-        event.word = p_ctrl->sdhi_event.word;
-    }
 
-    /* Timeout. */
-    return false;
+    /* The read buffer is full unless an error occurred. */
+    return !event.bit.event_error;
 }
 
 /*******************************************************************************************************************//**
@@ -2466,7 +2801,10 @@ static void r_sdmmc_software_copy(void const * p_src, uint32_t bytes, void * p_d
 }
 
 /*******************************************************************************************************************//**
- * Performs workaround in the transfer interrupt for unaligned reads and writes.
+ * Moves staged data between the aligned buffer and the application buffer in the transfer interrupt for unaligned
+ * reads and writes.  The transfer driver ends after each batch of up to transfer_batch_blocks blocks and is reset
+ * here for the next batch.  For every read, the end of the last batch is recorded as an event required to complete
+ * the command.
  *
  * @param[in]     p_args         Transfer callback arguments.
  **********************************************************************************************************************/
@@ -2475,40 +2813,71 @@ static void r_sdmmc_transfer_callback(transfer_callback_args_t * p_args)
     /** Get the SD/MMC control block from the callback context. */
     sdmmc_instance_ctrl_t * p_ctrl = (sdmmc_instance_ctrl_t *) p_args->p_context;
 
-    if (p_ctrl->transfer_blocks_total != p_ctrl->transfer_block_current)
+    transfer_instance_t const * p_transfer = p_ctrl->p_lower_lvl_transfer;
+    sdmmc_callback_args_t       args;
+    ssp_err_t                   err    = SSP_SUCCESS;
+    uint32_t                    blocks = p_ctrl->transfer_blocks_total - p_ctrl->transfer_block_current;
+    args.event = SDMMC_EVENT_NONE;
+
+    /* The end interrupt of the previous command may be taken after the transfer is reset for the next command.  It
+     * does not belong to the armed batch, which is complete only when no blocks remain. */
+    transfer_properties_t properties = {0U};
+    p_transfer->p_api->infoGet(p_transfer->p_ctrl, &properties);
+    if (0U != properties.transfer_length_remaining)
     {
-        if (SDMMC_TRANSFER_DIR_READ == p_ctrl->transfer_dir)
+        return;
+    }
+
+    if (SDMMC_TRANSFER_DIR_READ == p_ctrl->transfer_dir)
+    {
+        /** If the transfer is a read operation into an unaligned buffer, copy the batch read from the aligned buffer
+         * in the control block to the application data buffer.  Reads into the application buffer have no blocks
+         * left to copy. */
+        if (0U != p_ctrl->transfer_batch_blocks)
         {
-            /** If the transfer is a read operation into an unaligned buffer, copy the block read from the aligned
-             * buffer in the control block to the application data buffer. */
-            r_sdmmc_software_copy((void *) &p_ctrl->aligned_buff[0], p_ctrl->transfer_block_size, p_ctrl->p_transfer_data);
+            blocks = (blocks > p_ctrl->transfer_batch_blocks) ? p_ctrl->transfer_batch_blocks : blocks;
+            r_sdmmc_software_copy((void *) &p_ctrl->aligned_buff[0], blocks * p_ctrl->transfer_block_size,
+                                  p_ctrl->p_transfer_data);
+            p_ctrl->transfer_block_current += blocks;
+            p_ctrl->p_transfer_data        += blocks * p_ctrl->transfer_block_size;
+
+            blocks = p_ctrl->transfer_blocks_total - p_ctrl->transfer_block_current;
         }
-        if (SDMMC_TRANSFER_DIR_WRITE == p_ctrl->transfer_dir)
+        if (blocks > 0U)
         {
-            /** If the transfer is a write operation from an unaligned buffer, copy the next block to write from the
-             * application data buffer to the aligned buffer in the control block. */
-            r_sdmmc_software_copy(p_ctrl->p_transfer_data, p_ctrl->transfer_block_size, (void *) &p_ctrl->aligned_buff[0]);
+            /** Read the next batch into the aligned buffer. */
+            blocks = (blocks > p_ctrl->transfer_batch_blocks) ? p_ctrl->transfer_batch_blocks : blocks;
+            err = p_transfer->p_api->reset(p_transfer->p_ctrl, NULL, &p_ctrl->aligned_buff[0], (uint16_t) blocks);
+        }
+        else
+        {
+            /** The last block is in the application buffer.  The command is complete if access end has occurred. */
+            args.event = r_sdmmc_transfer_pending_clear(p_ctrl, SDMMC_TRANSFER_PENDING_TRANSFER_END);
         }
-        p_ctrl->transfer_block_current++;
-        p_ctrl->p_transfer_data += p_ctrl->transfer_block_size;
     }
-    if (p_ctrl->transfer_blocks_total == p_ctrl->transfer_block_current)
+    if ((SDMMC_TRANSFER_DIR_WRITE == p_ctrl->transfer_dir) && (blocks > 0U))
     {
-        if (SDMMC_TRANSFER_DIR_READ == p_ctrl->transfer_dir)
-        {
-            /** After the entire read transfer to an unaligned buffer is complete, read transfer end and callback are
-             * performed in transfer interrupt to ensure the last block is in the application buffer before the
-             * callback is called. */
-            r_sdmmc_transfer_end(p_ctrl);
+        /** If the transfer is a write operation from an unaligned buffer, copy the next batch to write from the
+         * application data buffer to the aligned buffer in the control block. */
+        blocks = (blocks > p_ctrl->transfer_batch_blocks) ? p_ctrl->transfer_batch_blocks : blocks;
+        r_sdmmc_software_copy(p_ctrl->p_transfer_data, blocks * p_ctrl->transfer_block_size,
+                              (void *) &p_ctrl->aligned_buff[0]);
+        p_ctrl->transfer_block_current += blocks;
+        p_ctrl->p_transfer_data        += blocks * p_ctrl->transfer_block_size;
+        err = p_transfer->p_api->reset(p_transfer->p_ctrl, &p_ctrl->aligned_buff[0], NULL, (uint16_t) blocks);
+    }
 
-            if (NULL != p_ctrl->p_callback)
-            {
-                sdmmc_callback_args_t args;
-                args.p_context = p_ctrl->p_context;
-                args.event = SDMMC_EVENT_TRANSFER_COMPLETE;
-                p_ctrl->p_callback(&args);
-            }
-        }
+    if (SSP_SUCCESS != err)
+    {
+        HW_SDMMC_DataStop(p_ctrl->p_reg, 1U);
+        r_sdmmc_transfer_end(p_ctrl);
+        args.event = SDMMC_EVENT_TRANSFER_ERROR;
+    }
+
+    if ((SDMMC_EVENT_NONE != args.event) && (NULL != p_ctrl->p_callback))
+    {
+        args.p_context = p_ctrl->p_context;
+        p_ctrl->p_callback(&args);
     }
 }
 
@@ -2529,6 +2898,7 @@ static ssp_err_t r_sdmmc_transfer_read (sdmmc_instance_ctrl_t * const p_ctrl, ui
 {
     ssp_err_t      ssp_ret_val;
     transfer_cfg_t cfg;
+    uint16_t       num_blocks = 0U;
 
     /* Check pointer for NULL, transfer function is optional. */
     cfg.p_info                 = p_ctrl->p_lower_lvl_transfer->p_cfg->p_info;
@@ -2542,8 +2912,9 @@ static ssp_err_t r_sdmmc_transfer_read (sdmmc_instance_ctrl_t * const p_ctrl, ui
     HW_SDMMC_DMAModeEnable(p_ctrl->p_reg, true);
 
     cfg.p_info->p_src          = HW_SDMMC_DataBufferAddressGet(p_ctrl->p_reg);
-    cfg.p_info->p_dest         = (void *) p_data;
-    cfg.p_info->num_blocks     = (uint16_t) block_count;
+    cfg.p_info->p_dest         = r_sdmmc_transfer_prepare(p_ctrl, SDMMC_TRANSFER_DIR_READ, block_count, bytes, p_data,
+                                                          &num_blocks);
+    cfg.p_info->num_blocks     = num_blocks;
     cfg.p_info->src_addr_mode  = TRANSFER_ADDR_MODE_FIXED;
     cfg.p_info->dest_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED;
     cfg.p_info->size           = TRANSFER_SIZE_4_BYTE;
@@ -2556,22 +2927,6 @@ static ssp_err_t r_sdmmc_transfer_read (sdmmc_instance_ctrl_t * const p_ctrl, ui
     cfg.p_info->chain_mode     = TRANSFER_CHAIN_MODE_DISABLED;
     cfg.activation_source      = HW_SDMMC_DmaEventGet((uint8_t) p_ctrl->hw.channel);
 
-    /* If the pointer is not 4-byte aligned or the number of bytes is not a multiple of 4, use a temporary buffer.
-     * Data will be transferred from the temporary buffer into the user buffer in an interrupt after each block transfer. */
-    if ((0U != ((uint32_t) p_data & 0x3U)) || (0U != (bytes & 3U)))
-    {
-        cfg.p_info->irq           = TRANSFER_IRQ_EACH;
-        cfg.p_info->repeat_area   = TRANSFER_REPEAT_AREA_DESTINATION;
-
-        cfg.p_info->p_dest         = &p_ctrl->aligned_buff[0];
-
-        p_ctrl->transfer_block_current = 0U;
-        p_ctrl->transfer_blocks_total = block_count;
-        p_ctrl->p_transfer_data = (uint8_t *) &p_data[0];
-        p_ctrl->transfer_dir = SDMMC_TRANSFER_DIR_READ;
-        p_ctrl->transfer_block_size = bytes;
-    }
-
     /** Configure the transfer driver to read from the SD buffer. */
     ssp_ret_val = p_ctrl->p_lower_lvl_transfer->p_api->open(p_ctrl->p_lower_lvl_transfer->p_ctrl, &cfg);
 
@@ -2598,6 +2953,7 @@ static ssp_err_t r_sdmmc_transfer_write (sdmmc_instance_ctrl_t * const p_ctrl,
 {
     ssp_err_t      ssp_ret_val;
     transfer_cfg_t cfg;
+    uint16_t       num_blocks = 0U;
 
     cfg.p_callback             = r_sdmmc_transfer_callback;
     cfg.p_context              = p_ctrl;
@@ -2608,8 +2964,9 @@ static ssp_err_t r_sdmmc_transfer_write (sdmmc_instance_ctrl_t * const p_ctrl,
 
     transfer_info_t * p_info = cfg.p_info;
 
-    p_info->p_src          = p_data;
-    p_info->num_blocks     = (uint16_t) block_count;
+    p_info->p_src          = r_sdmmc_transfer_prepare(p_ctrl, SDMMC_TRANSFER_DIR_WRITE, block_count, bytes, p_data,
+                                                      &num_blocks);
+    p_info->num_blocks     = num_blocks;
     p_info->src_addr_mode  = TRANSFER_ADDR_MODE_INCREMENTED;
     p_info->dest_addr_mode = TRANSFER_ADDR_MODE_FIXED;
     p_info->mode           = TRANSFER_MODE_BLOCK;
@@ -2626,30 +2983,112 @@ static ssp_err_t r_sdmmc_transfer_write (sdmmc_instance_ctrl_t * const p_ctrl,
     R_BSP_IrqStatusClear(p_ctrl->transfer_irq);
     HW_SDMMC_DMAModeEnable(p_ctrl->p_reg, true);
 
-    if ((0U != ((uint32_t) p_data & 0x3U)) || (0U != (bytes & 3U)))
+    cfg.activation_source      = HW_SDMMC_DmaEventGet((uint8_t) p_ctrl->hw.channel);
+
+    /** Configure the transfer driver to write to the SD buffer. */
+    ssp_ret_val = p_ctrl->p_lower_lvl_transfer->p_api->open(p_ctrl->p_lower_lvl_transfer->p_ctrl, &cfg);
+
+    return ssp_ret_val;
+}
+
+/*******************************************************************************************************************//**
+ * Record the data phase of the next command in the control block.  If the pointer is not 4-byte aligned or the number
+ * of bytes is not a multiple of 4, the transfer driver moves the data through the aligned buffer in the control block
+ * in batches, and the batches are copied in the transfer interrupt.  For writes the first batch is copied here.
+ *
+ * @param[in]     p_ctrl         Pointer to SDMMC instance control block.
+ * @param[in]     dir            Read or write.
+ * @param[in]     block_count    Number of blocks to transfer.
+ * @param[in]     bytes          Bytes per block.
+ * @param[in]     p_data         Application data buffer.
+ * @param[out]    p_num_blocks   Number of blocks the transfer driver moves before its end interrupt.
+ *
+ * @return Memory address for the transfer driver, either p_data or the aligned buffer.
+ **********************************************************************************************************************/
+static void * r_sdmmc_transfer_prepare (sdmmc_instance_ctrl_t * const p_ctrl,
+                                        sdmmc_transfer_dir_t dir,
+                                        uint32_t             block_count,
+                                        uint32_t             bytes,
+                                        uint8_t const      * p_data,
+                                        uint16_t           * p_num_blocks)
+{
+    p_ctrl->transfer_dir          = dir;
+    p_ctrl->transfer_blocks_total = block_count;
+    p_ctrl->transfer_block_size   = bytes;
+    p_ctrl->transfer_pending      = SDMMC_TRANSFER_PENDING_ACCESS_END;
+
+    /* Access end can be reported while the transfer driver is still emptying the SD buffer, so every read also waits
+     * for the transfer interrupt. */
+    if (SDMMC_TRANSFER_DIR_READ == dir)
     {
-        p_info->irq           = TRANSFER_IRQ_EACH;
-        p_info->repeat_area   = TRANSFER_REPEAT_AREA_SOURCE;
+        p_ctrl->transfer_pending |= SDMMC_TRANSFER_PENDING_TRANSFER_END;
+    }
 
-        /* If the pointer is not 4-byte aligned or the number of bytes is not a multiple of 4, use a temporary buffer.
-         * Transfer the first block to the temporary buffer before enabling the transfer.  Subsequent blocks will be
-         * transferred from the user buffer to the temporary buffer in an interrupt after each block transfer. */
-        r_sdmmc_software_copy(p_data, bytes, (void *) &p_ctrl->aligned_buff[0]);
-        p_info->p_src         = &p_ctrl->aligned_buff[0];
+    if ((0U == ((uint32_t) p_data & 0x3U)) && (0U == (bytes & 3U)))
+    {
+        p_ctrl->transfer_batch_blocks  = 0U;
+        p_ctrl->transfer_block_current = block_count;
+        p_ctrl->p_transfer_data        = NULL;
+        *p_num_blocks                  = (uint16_t) block_count;
 
-        p_ctrl->transfer_block_current = 1U;
-        p_ctrl->transfer_blocks_total = block_count;
-        p_ctrl->p_transfer_data = (uint8_t *) &p_data[bytes];
-        p_ctrl->transfer_dir = SDMMC_TRANSFER_DIR_WRITE;
-        p_ctrl->transfer_block_size = bytes;
+        return (void *) p_data;
     }
 
-    cfg.activation_source      = HW_SDMMC_DmaEventGet((uint8_t) p_ctrl->hw.channel);
+    /* The transfer driver rounds each block up to whole words, so blocks are packed in the aligned buffer only when
+     * the block size is a multiple of 4. */
+    uint32_t batch = 1U;
+    if (0U == (bytes & 3U))
+    {
+        batch = sizeof(p_ctrl->aligned_buff) / bytes;
+    }
+    batch = (batch > block_count) ? block_count : batch;
 
-    /** Configure the transfer driver to write to the SD buffer. */
-    ssp_ret_val = p_ctrl->p_lower_lvl_transfer->p_api->open(p_ctrl->p_lower_lvl_transfer->p_ctrl, &cfg);
+    p_ctrl->transfer_batch_blocks  = batch;
+    p_ctrl->transfer_block_current = 0U;
+    p_ctrl->p_transfer_data        = (uint8_t *) p_data;
+    *p_num_blocks                  = (uint16_t) batch;
 
-    return ssp_ret_val;
+    if (SDMMC_TRANSFER_DIR_WRITE == dir)
+    {
+        r_sdmmc_software_copy(p_data, batch * bytes, (void *) &p_ctrl->aligned_buff[0]);
+        p_ctrl->transfer_block_current = batch;
+        p_ctrl->p_transfer_data       += batch * bytes;
+    }
+
+    return (void *) &p_ctrl->aligned_buff[0];
+}
+
+/*******************************************************************************************************************//**
+ * Reset the open transfer driver for the next command of a scatter-gather transfer.
+ *
+ * @param[in]     p_ctrl         Pointer to SDMMC instance control block.
+ * @param[in]     dir            Read or write.
+ * @param[in]     block_count    Number of blocks to transfer.
+ * @param[in]     bytes          Bytes per block.
+ * @param[in]     p_data         Application data buffer.
+ *
+ * @retval         SSP_SUCCESS      Transfer successfully reset.
+ * @return                          See @ref Common_Error_Codes or functions called by this function for other possible
+ *                                  return codes. This function calls:
+ *                                      * transfer_api_t::reset
+ **********************************************************************************************************************/
+static ssp_err_t r_sdmmc_transfer_rearm (sdmmc_instance_ctrl_t * const p_ctrl,
+                                         sdmmc_transfer_dir_t dir,
+                                         uint32_t             block_count,
+                                         uint32_t             bytes,
+                                         uint8_t const      * p_data)
+{
+    transfer_instance_t const * p_transfer = p_ctrl->p_lower_lvl_transfer;
+    uint16_t                    num_blocks = 0U;
+    void                      * p_buffer   = r_sdmmc_transfer_prepare(p_ctrl, dir, block_count, bytes, p_data,
+                                                                      &num_blocks);
+
+    if (SDMMC_TRANSFER_DIR_READ == dir)
+    {
+        return p_transfer->p_api->reset(p_transfer->p_ctrl, NULL, p_buffer, num_blocks);
+    }
+
+    return p_transfer->p_api->reset(p_transfer->p_ctrl, p_buffer, NULL, num_blocks);
 }
 
 /*******************************************************************************************************************//**
@@ -2664,6 +3103,12 @@ static void r_sdmmc_transfer_end (sdmmc_instance_ctrl_t * const p_ctrl)
     p_ctrl->p_transfer_data = NULL;
     p_ctrl->transfer_dir = SDMMC_TRANSFER_DIR_NONE;
     p_ctrl->transfer_block_size = 0U;
+    p_ctrl->transfer_batch_blocks = 0U;
+    p_ctrl->transfer_pending = 0U;
+    p_ctrl->transfer_response_check = false;
+    p_ctrl->p_segments = NULL;
+    p_ctrl->segment_count = 0U;
+    p_ctrl->segment_offset = 0U;
 
     p_ctrl->p_lower_lvl_transfer->p_api->close(p_ctrl->p_lower_lvl_transfer->p_ctrl);
     HW_SDMMC_DMAModeEnable(p_ctrl->p_reg, false);
@@ -2713,6 +3158,129 @@ static ssp_err_t r_sdmmc_control_error_check(sdmmc_instance_ctrl_t * const p_ctr
     return SSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Wait for a condition or a timeout.  Once the BSP timer service is open, the CPU sleeps between checks of the
+ * condition, otherwise the condition is checked every microsecond.
+ *
+ * @param[in]     p_ctrl       Pointer to SDMMC instance control block, passed to p_condition.
+ * @param[in]     p_condition  Condition to wait for.
+ * @param[in]     timeout_us   Timeout in microseconds.
+ * @param[in]     poll_us      Interval for checking a condition that does not change in an interrupt, 0 for
+ *                             conditions updated by the access interrupt.
+ *
+ * @retval  true          Condition met.
+ * @retval  false         Timeout.
+ **********************************************************************************************************************/
+static bool r_sdmmc_wait (sdmmc_instance_ctrl_t * const p_ctrl, bsp_timer_condition_t p_condition,
+                          uint64_t timeout_us, uint32_t poll_us)
+{
+    uint64_t now         = 0U;
+    uint64_t counts      = 0U;
+    uint64_t poll_counts = 0U;
+    if ((SSP_SUCCESS == R_BSP_TimestampGet(&now)) &&
+        (SSP_SUCCESS == R_BSP_TimerCountsGet(timeout_us, BSP_DELAY_UNITS_MICROSECONDS, &counts)) &&
+        (SSP_SUCCESS == R_BSP_TimerCountsGet(poll_us, BSP_DELAY_UNITS_MICROSECONDS, &poll_counts)))
+    {
+        ssp_err_t err = R_BSP_TimerWaitUntil(now + counts, p_condition, p_ctrl, poll_counts);
+        if (SSP_ERR_NOT_OPEN != err)
+        {
+            return (SSP_SUCCESS == err);
+        }
+    }
+
+    uint64_t timeout = timeout_us;
+    while (!p_condition(p_ctrl))
+    {
+        if (0U == timeout)
+        {
+            return false;
+        }
+        R_BSP_SoftwareDelay(1U, BSP_DELAY_UNITS_MICROSECONDS);
+        timeout--;
+    }
+
+    return true;
+}
+
+/*******************************************************************************************************************//**
+ * Wait condition: command response received or error.
+ *
+ * @param[in]     p_context    Pointer to SDMMC instance control block.
+ *
+ * @retval  true          Response end or error event set by the access interrupt.
+ * @retval  false         Still waiting.
+ **********************************************************************************************************************/
+static bool r_sdmmc_response_end_or_error (void * p_context)
+{
+    sdmmc_instance_ctrl_t * p_ctrl = (sdmmc_instance_ctrl_t *) p_context;
+    sdhi_event_t event;
+    event.word = p_ctrl->sdhi_event.word;
+
+    return (event.bit.event_error || event.bit.response_end);
+}
+
+/*******************************************************************************************************************//**
+ * Wait condition: read buffer full or error.
+ *
+ * @param[in]     p_context    Pointer to SDMMC instance control block.
+ *
+ * @retval  true          Read buffer full or error event set by the access interrupt.
+ * @retval  false         Still waiting.
+ **********************************************************************************************************************/
+static bool r_sdmmc_bre_or_error (void * p_context)
+{
+    sdmmc_instance_ctrl_t * p_ctrl = (sdmmc_instance_ctrl_t *) p_context;
+    sdhi_event_t event;
+    event.word = p_ctrl->sdhi_event.word;
+
+    return (event.bit.event_error || event.bit.bre);
+}
+
+/*******************************************************************************************************************//**
+ * Wait condition: access end.
+ *
+ * @param[in]     p_context    Pointer to SDMMC instance control block.
+ *
+ * @retval  true          Access end event set by the access interrupt.
+ * @retval  false         Still waiting.
+ **********************************************************************************************************************/
+static bool r_sdmmc_access_end_get (void * p_context)
+{
+    sdmmc_instance_ctrl_t * p_ctrl = (sdmmc_instance_ctrl_t *) p_context;
+
+    return (0U != p_ctrl->sdhi_event.bit.access_end);
+}
+
+/*******************************************************************************************************************//**
+ * Wait condition: SD clock divider enabled, which the SDHI does not allow while the eMMC device is busy.
+ *
+ * @param[in]     p_context    Pointer to SDMMC instance control block.
+ *
+ * @retval  true          SD clock divider can be written.
+ * @retval  false         Still waiting.
+ **********************************************************************************************************************/
+static bool r_sdmmc_clock_enabled_get (void * p_context)
+{
+    sdmmc_instance_ctrl_t * p_ctrl = (sdmmc_instance_ctrl_t *) p_context;
+
+    return (0U != HW_SDMMC_ClockDivEnableGet(p_ctrl->p_reg));
+}
+
+/*******************************************************************************************************************//**
+ * Wait condition: device not busy.
+ *
+ * @param[in]     p_context    Pointer to SDMMC instance control block.
+ *
+ * @retval  true          Device released the busy signal.
+ * @retval  false         Still waiting.
+ **********************************************************************************************************************/
+static bool r_sdmmc_card_ready_get (void * p_context)
+{
+    sdmmc_instance_ctrl_t * p_ctrl = (sdmmc_instance_ctrl_t *) p_context;
+
+    return !HW_SDMMC_CardBusyGet(p_ctrl->p_reg);
+}
+
 
 /*******************************************************************************************************************//**
  * Access ISR.
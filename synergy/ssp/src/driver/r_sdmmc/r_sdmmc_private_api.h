@@ -78,6 +78,14 @@ ssp_err_t R_SDMMC_Erase (sdmmc_ctrl_t * const p_api_ctrl,
                          uint32_t       const start_sector,
                          uint32_t       const sector_count);
 
+ssp_err_t R_SDMMC_ReadV (sdmmc_ctrl_t          * const p_api_ctrl,
+                         sdmmc_segment_t const * const p_segments,
+                         uint32_t                const segment_count);
+
+ssp_err_t R_SDMMC_WriteV (sdmmc_ctrl_t          * const p_api_ctrl,
+                          sdmmc_segment_t const * const p_segments,
+                          uint32_t                const segment_count);
+
 /* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
 SSP_FOOTER
 
@@ -67,6 +67,15 @@ void ssi_int_isr(void);
 /* ISR subroutines */
 static inline void ssi_idle_int_process  (ssi_instance_ctrl_t * p_ctrl);
 static inline void ssi_tx_end_int_process(ssi_instance_ctrl_t * p_ctrl);
+static void ssi_callback_call(ssi_instance_ctrl_t * p_ctrl, i2s_callback_args_t * p_args);
+static void ssi_callback_work(void * p_context, void * p_args);
+static void ssi_period_callback_call(ssi_instance_ctrl_t * p_ctrl, i2s_event_t event, uint32_t period);
+
+/* Streaming subroutines */
+static void ssi_stream_tx_process(ssi_instance_ctrl_t * p_ctrl);
+static void ssi_stream_rx_process(ssi_instance_ctrl_t * p_ctrl);
+static void ssi_stream_tx_period_end(ssi_instance_ctrl_t * p_ctrl);
+static void ssi_stream_rx_period_end(ssi_instance_ctrl_t * p_ctrl);
 
 /* FIFO subroutines */
 static uint32_t ssi_fifo_write(ssi_instance_ctrl_t * p_ctrl);
@@ -192,7 +201,9 @@ const i2s_api_t g_i2s_on_ssi =
     .mute            = R_SSI_Mute,
     .infoGet         = R_SSI_InfoGet,
     .close           = R_SSI_Close,
-    .versionGet      = R_SSI_VersionGet
+    .versionGet      = R_SSI_VersionGet,
+    .streamStart     = R_SSI_StreamStart,
+    .streamAck       = R_SSI_StreamAck
 };
 
 /******************************************************************************
@@ -313,7 +324,14 @@ ssp_err_t R_SSI_Open (i2s_ctrl_t      * const p_api_ctrl,
     p_ctrl->channel    = p_cfg->channel;
     p_ctrl->p_callback = p_cfg->p_callback;
     p_ctrl->p_context  = p_cfg->p_context;
+    p_ctrl->deferred_callback          = p_cfg->deferred_callback;
+    p_ctrl->deferred_callback_priority = p_cfg->deferred_callback_priority;
     p_ctrl->p_timer    = p_cfg->p_timer;
+    p_ctrl->p_tx_ring  = NULL;
+    p_ctrl->p_rx_ring  = NULL;
+    p_ctrl->tx_underrun_count = 0U;
+    p_ctrl->rx_overrun_count  = 0U;
+    p_ctrl->tx_underrun_muted = false;
 
     /** Mark driver as open by initializing it to "SSI" in its ASCII equivalent. */
     p_ctrl->open       = OPEN;
@@ -561,7 +579,9 @@ ssp_err_t R_SSI_Mute(i2s_ctrl_t * const p_api_ctrl,
     SSP_ASSERT(NULL != p_ctrl);
     SSI_ERROR_RETURN(OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
 #endif
-    /** Enables the mute if MUTE_ON is set. Otherwise, disables the mute. */
+    /** Enables the mute if MUTE_ON is set. Otherwise, disables the mute.  The application setting overrides a mute
+     * applied by the driver on a streaming underrun. */
+    p_ctrl->tx_underrun_muted = false;
     if (I2S_MUTE_ON == mute_enable)
     {
         HW_SSI_MuteOn(p_ctrl->p_reg);
@@ -609,9 +629,154 @@ ssp_err_t R_SSI_InfoGet (i2s_ctrl_t * const p_api_ctrl,
     /** Get the sampling frequency information. */
     p_info->sampling_freq_hz = p_ctrl->sampling_freq_hz;
 
+    /** Get the streaming error counters. */
+    p_info->tx_underrun_count = p_ctrl->tx_underrun_count;
+    p_info->rx_overrun_count  = p_ctrl->rx_overrun_count;
+
     return SSP_SUCCESS;
 } /* End of function R_SSI_InfoGet */
 
+/*******************************************************************************************************************//**
+ * @brief  Starts continuous streaming through rings of periods. Implements i2s_api_t::streamStart.
+ *
+ * The first period of each ring is loaded into the transfer, or into the control block for the ISR if the transfer
+ * interface is not used.  When a period completes, the transmit or receive ISR only points the transfer or the ISR
+ * at the next period and reports the completed one, so the FIFO covers the switch and no gap is heard.  A transmit
+ * period that was not returned with R_SSI_StreamAck() is played muted and counted as an underrun.  A receive period
+ * that was not returned is overwritten and counted as an overrun.  The counters restart at zero.
+ *
+ * @retval SSP_SUCCESS           Streaming started.
+ * @retval SSP_ERR_ASSERTION     The pointer to p_ctrl or p_stream_cfg was null, both rings were null, period_bytes was
+ *                               0 or not a multiple of 8, or period_count was less than 2.
+ * @retval SSP_ERR_NOT_OPEN      The channel is not opened.
+ * @retval SSP_ERR_IN_USE        The SSI is running in another direction.
+ * @retval SSP_ERR_UNDERFLOW     The transmit FIFO underflowed before it was loaded.
+ * @return                       See @ref Common_Error_Codes or functions called by this function for other possible
+ *                               return codes. This function calls:
+ *                                   * transfer_api_t::reset
+ *                                   * timer_api_t::start
+ **********************************************************************************************************************/
+ssp_err_t R_SSI_StreamStart (i2s_ctrl_t             * const p_api_ctrl,
+                             i2s_stream_cfg_t const * const p_stream_cfg)
+{
+    ssi_instance_ctrl_t * p_ctrl = (ssi_instance_ctrl_t *) p_api_ctrl;
+
+#if SSI_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+    SSP_ASSERT(NULL != p_stream_cfg);
+    SSI_ERROR_RETURN(OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+    SSP_ASSERT((NULL != p_stream_cfg->p_tx_ring) || (NULL != p_stream_cfg->p_rx_ring));
+    SSP_ASSERT(p_stream_cfg->period_bytes > 0U);
+    SSP_ASSERT(0U == (p_stream_cfg->period_bytes % (SSI_FIFO_SMALLEST_WRITE_WORDS * SSI_UTIL_BYTES_PER_WORD)));
+    SSP_ASSERT(p_stream_cfg->period_count >= 2U);
+#endif
+
+    i2s_dir_t dir = I2S_DIR_TX_RX;
+    if (NULL == p_stream_cfg->p_rx_ring)
+    {
+        dir = I2S_DIR_TX;
+    }
+    if (NULL == p_stream_cfg->p_tx_ring)
+    {
+        dir = I2S_DIR_RX;
+    }
+
+    /** Every transmit period is filled by the application before streaming starts, and every receive period is free. */
+    p_ctrl->period_bytes      = p_stream_cfg->period_bytes;
+    p_ctrl->period_count      = p_stream_cfg->period_count;
+    p_ctrl->tx_period         = 0U;
+    p_ctrl->rx_period         = 0U;
+    p_ctrl->tx_period_done    = 0U;
+    p_ctrl->tx_period_ready   = p_stream_cfg->period_count;
+    p_ctrl->rx_period_done    = 0U;
+    p_ctrl->rx_period_free    = p_stream_cfg->period_count;
+    p_ctrl->tx_underrun_count = 0U;
+    p_ctrl->rx_overrun_count  = 0U;
+    p_ctrl->tx_underrun_muted = false;
+
+    /** Load the first period of each ring. */
+    ssp_err_t err;
+    if (NULL != p_stream_cfg->p_rx_ring)
+    {
+        err = ssi_rx_unload_fifo(p_ctrl, p_stream_cfg->p_rx_ring, p_stream_cfg->period_bytes);
+        SSI_ERROR_RETURN(SSP_SUCCESS == err, err);
+    }
+    if (NULL != p_stream_cfg->p_tx_ring)
+    {
+        err = ssi_tx_load_fifo(p_ctrl, p_stream_cfg->p_tx_ring, p_stream_cfg->period_bytes);
+        SSI_ERROR_RETURN(SSP_SUCCESS == err, err);
+    }
+
+    /** Set the rings before enabling the SSI so the ISRs take the streaming path from the first interrupt. */
+    p_ctrl->p_tx_ring = p_stream_cfg->p_tx_ring;
+    p_ctrl->p_rx_ring = p_stream_cfg->p_rx_ring;
+
+    err = ssi_start(p_ctrl, dir);
+    if (SSP_SUCCESS != err)
+    {
+        p_ctrl->p_tx_ring = NULL;
+        p_ctrl->p_rx_ring = NULL;
+    }
+    SSI_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    if (NULL != p_stream_cfg->p_tx_ring)
+    {
+        err = ssi_tx_start(p_ctrl);
+        SSI_ERROR_RETURN(SSP_SUCCESS == err, err);
+    }
+
+    return SSP_SUCCESS;
+} /* End of function R_SSI_StreamStart */
+
+/*******************************************************************************************************************//**
+ * @brief  Returns streaming periods to the driver. Implements i2s_api_t::streamAck.
+ *
+ * Periods are returned in ring order.  The simplest use is to refill or read the period reported in each
+ * I2S_EVENT_TX_PERIOD_DONE or I2S_EVENT_RX_PERIOD_DONE callback and return it with periods set to 1.
+ *
+ * @retval SSP_SUCCESS               Periods returned.
+ * @retval SSP_ERR_ASSERTION         The pointer to p_ctrl was null.
+ * @retval SSP_ERR_NOT_OPEN          The channel is not opened.
+ * @retval SSP_ERR_NOT_ENABLED       The requested direction is not streaming.
+ * @retval SSP_ERR_INVALID_ARGUMENT  More periods were returned than have completed.
+ **********************************************************************************************************************/
+ssp_err_t R_SSI_StreamAck (i2s_ctrl_t * const p_api_ctrl,
+                           i2s_dir_t    const dir,
+                           uint32_t     const periods)
+{
+    ssi_instance_ctrl_t * p_ctrl = (ssi_instance_ctrl_t *) p_api_ctrl;
+
+#if SSI_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+    SSI_ERROR_RETURN(OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+#endif
+
+    bool tx = (I2S_DIR_TX == dir) || (I2S_DIR_TX_RX == dir);
+    bool rx = (I2S_DIR_RX == dir) || (I2S_DIR_TX_RX == dir);
+    SSI_ERROR_RETURN((!tx) || (NULL != p_ctrl->p_tx_ring), SSP_ERR_NOT_ENABLED);
+    SSI_ERROR_RETURN((!rx) || (NULL != p_ctrl->p_rx_ring), SSP_ERR_NOT_ENABLED);
+
+    /** Only the ISRs advance the done counters and only this function advances the returned counters, so no
+     * critical section is needed.  At most period_count periods can be outstanding in each ring.  After an underrun
+     * or overrun the returned counter is behind the done counter, so the difference is signed. */
+    if (tx)
+    {
+        uint32_t ready = p_ctrl->tx_period_ready + periods;
+        SSI_ERROR_RETURN((int32_t) (ready - p_ctrl->tx_period_done) <= (int32_t) p_ctrl->period_count,
+                         SSP_ERR_INVALID_ARGUMENT);
+        p_ctrl->tx_period_ready = ready;
+    }
+    if (rx)
+    {
+        uint32_t free_periods = p_ctrl->rx_period_free + periods;
+        SSI_ERROR_RETURN((int32_t) (free_periods - p_ctrl->rx_period_done) <= (int32_t) p_ctrl->period_count,
+                         SSP_ERR_INVALID_ARGUMENT);
+        p_ctrl->rx_period_free = free_periods;
+    }
+
+    return SSP_SUCCESS;
+} /* End of function R_SSI_StreamAck */
+
 /*******************************************************************************************************************//**
  * @brief      Sets driver version based on compile time macros.
  *
@@ -875,6 +1040,14 @@ static void ssi_stop_tx (ssi_instance_ctrl_t * const p_ctrl)
     /** If transfer is used, disable transfer when stop is requested. */
     p_ctrl->tx_in_use = false;
     HW_SSI_TxInterruptDisable(p_ctrl->p_reg, p_ctrl->txi_irq);
+
+    /** End streaming and remove a mute applied on an underrun. */
+    p_ctrl->p_tx_ring = NULL;
+    if (p_ctrl->tx_underrun_muted)
+    {
+        HW_SSI_MuteOff(p_ctrl->p_reg);
+        p_ctrl->tx_underrun_muted = false;
+    }
     if (HW_SSI_IsIdle(p_ctrl->p_reg))
     {
         ssi_process_complete(p_ctrl);
@@ -897,6 +1070,7 @@ static void ssi_stop_rx (ssi_instance_ctrl_t * const p_ctrl)
     /** If transfer is used, disable transfer when stop is requested. */
     HW_SSI_RxInterruptDisable(p_ctrl->p_reg, p_ctrl->rxi_irq);
     p_ctrl->rx_in_use = false;
+    p_ctrl->p_rx_ring = NULL;
     p_ctrl->p_rx_dest = NULL;
     p_ctrl->rx_dest_bytes = 0U;
     ssi_process_complete(p_ctrl);
@@ -1245,7 +1419,8 @@ static inline void ssi_idle_int_process(ssi_instance_ctrl_t * p_ctrl)
         i2s_callback_args_t args;
         args.event = I2S_EVENT_IDLE;
         args.p_context = p_ctrl->p_context;
-        p_ctrl->p_callback(&args);
+        args.period = 0U;
+        ssi_callback_call(p_ctrl, &args);
     }
 }
 
@@ -1319,7 +1494,12 @@ void ssi_txi_isr(void)
     /* Clear the IR flag in the ICU */
     R_BSP_IrqStatusClear (R_SSP_CurrentIrqGet());
 
-    if (NULL != p_ctrl)
+    if ((NULL != p_ctrl) && (NULL != p_ctrl->p_tx_ring))
+    {
+        /** If streaming, move on to the next period when the current one is used up. */
+        ssi_stream_tx_process(p_ctrl);
+    }
+    else if (NULL != p_ctrl)
     {
         i2s_callback_args_t args;
         if (NULL == p_ctrl->p_transfer_tx)
@@ -1340,7 +1520,8 @@ void ssi_txi_isr(void)
             {
                 args.event = I2S_EVENT_TX_EMPTY;
                 args.p_context = p_ctrl->p_context;
-                p_ctrl->p_callback(&args);
+                args.period = 0U;
+                ssi_callback_call(p_ctrl, &args);
             }
         }
     }
@@ -1364,7 +1545,12 @@ void ssi_rxi_isr(void)
     /* Clear the IR flag in the ICU */
     R_BSP_IrqStatusClear (R_SSP_CurrentIrqGet());
 
-    if (NULL != p_ctrl)
+    if ((NULL != p_ctrl) && (NULL != p_ctrl->p_rx_ring))
+    {
+        /** If streaming, move on to the next period when the current one is full. */
+        ssi_stream_rx_process(p_ctrl);
+    }
+    else if (NULL != p_ctrl)
     {
         i2s_callback_args_t args;
         if (NULL == p_ctrl->p_transfer_rx)
@@ -1385,7 +1571,8 @@ void ssi_rxi_isr(void)
             {
                 args.event = I2S_EVENT_RX_FULL;
                 args.p_context = p_ctrl->p_context;
-                p_ctrl->p_callback(&args);
+                args.period = 0U;
+                ssi_callback_call(p_ctrl, &args);
             }
         }
     }
@@ -1425,10 +1612,19 @@ void ssi_int_isr(void)
         	/** SSI and SSIE must go idle after a transmit underflow or receive overflow error. */
             if (1U == ssi_irq_events_info.SSISR_b.TUIRQ)
             {
+                /** A FIFO underflow while streaming means a period switch came too late. */
+                if (NULL != p_ctrl->p_tx_ring)
+                {
+                    p_ctrl->tx_underrun_count++;
+                }
                 ssi_tx_end_int_process(p_ctrl);
             }
             if (1U == ssi_irq_events_info.SSISR_b.ROIRQ)
             {
+                if (NULL != p_ctrl->p_rx_ring)
+                {
+                    p_ctrl->rx_overrun_count++;
+                }
             	/** After receive error, disable reception, disable error interrupts, and enable
             	 * the idle interrupt. */
                 ssi_stop_rx(p_ctrl);
@@ -1443,3 +1639,187 @@ void ssi_int_isr(void)
     SF_CONTEXT_RESTORE
 }
 
+/*******************************************************************************************************************//**
+ * Calls the user callback, or posts it to the BSP deferred work scheduler if deferred callbacks are configured.  If no
+ * work slot is free, the deferred callback is dropped and counted by the scheduler.
+ *
+ * @param[in] p_ctrl  Control block of instance generating interrupt.
+ * @param[in] p_args  Callback arguments, copied if the callback is deferred.
+ **********************************************************************************************************************/
+static void ssi_callback_call(ssi_instance_ctrl_t * p_ctrl, i2s_callback_args_t * p_args)
+{
+    (void) R_BSP_WorkPostOrCall(p_ctrl->deferred_callback, ssi_callback_work, p_ctrl, p_args,
+                                sizeof(i2s_callback_args_t), p_ctrl->deferred_callback_priority);
+}
+
+/*******************************************************************************************************************//**
+ * Runs the user callback, unless the channel was closed after the callback was posted.
+ *
+ * @param[in] p_context  Control block of instance that posted the callback.
+ * @param[in] p_args     Copy of the callback arguments.
+ **********************************************************************************************************************/
+static void ssi_callback_work(void * p_context, void * p_args)
+{
+    ssi_instance_ctrl_t * p_ctrl = (ssi_instance_ctrl_t *) p_context;
+
+    if ((OPEN == p_ctrl->open) && (NULL != p_ctrl->p_callback))
+    {
+        p_ctrl->p_callback((i2s_callback_args_t *) p_args);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Reports a completed streaming period to the user callback.
+ *
+ * @param[in] p_ctrl  Control block of instance generating interrupt.
+ * @param[in] event   I2S_EVENT_TX_PERIOD_DONE or I2S_EVENT_RX_PERIOD_DONE.
+ * @param[in] period  Ring index of the completed period.
+ **********************************************************************************************************************/
+static void ssi_period_callback_call(ssi_instance_ctrl_t * p_ctrl, i2s_event_t event, uint32_t period)
+{
+    if (NULL != p_ctrl->p_callback)
+    {
+        i2s_callback_args_t args;
+        args.event = event;
+        args.p_context = p_ctrl->p_context;
+        args.period = period;
+        ssi_callback_call(p_ctrl, &args);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Streaming transmit interrupt.  With a transfer, the interrupt marks the end of the period.  Without one, the FIFO is
+ * filled from the current period and the period ends when its last word is written.
+ *
+ * @param[in] p_ctrl  Control block of instance generating interrupt.
+ **********************************************************************************************************************/
+static void ssi_stream_tx_process(ssi_instance_ctrl_t * p_ctrl)
+{
+    if (NULL != p_ctrl->p_transfer_tx)
+    {
+        if ((uint16_t) 0U == p_ctrl->p_transfer_tx->p_cfg->p_info->length)
+        {
+            ssi_stream_tx_period_end(p_ctrl);
+        }
+        return;
+    }
+
+    /** If the FIFO is still below the trigger level after the period switch, the flag sets again and the next
+     * interrupt continues from the new period. */
+    uint32_t stages_written = ssi_fifo_write(p_ctrl);
+    if (NULL == p_ctrl->p_tx_src)
+    {
+        ssi_stream_tx_period_end(p_ctrl);
+    }
+    if (stages_written > 0U)
+    {
+        HW_SSI_TxFifoEmptyFlagClear(p_ctrl->p_reg);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Streaming receive interrupt.  With a transfer, the interrupt marks the end of the period.  Without one, the FIFO is
+ * emptied into the current period and the period ends when it is full.
+ *
+ * @param[in] p_ctrl  Control block of instance generating interrupt.
+ **********************************************************************************************************************/
+static void ssi_stream_rx_process(ssi_instance_ctrl_t * p_ctrl)
+{
+    if (NULL != p_ctrl->p_transfer_rx)
+    {
+        if ((uint16_t) 0U == p_ctrl->p_transfer_rx->p_cfg->p_info->length)
+        {
+            ssi_stream_rx_period_end(p_ctrl);
+        }
+        return;
+    }
+
+    ssi_fifo_read(p_ctrl);
+    if (NULL == p_ctrl->p_rx_dest)
+    {
+        ssi_stream_rx_period_end(p_ctrl);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Switches transmit to the next period in the ring and reports the completed one.  If the application has not
+ * returned the next period yet, it is played muted so the stream keeps its timing, and an underrun is counted.
+ *
+ * @param[in] p_ctrl  Control block of instance generating interrupt.
+ **********************************************************************************************************************/
+static void ssi_stream_tx_period_end(ssi_instance_ctrl_t * p_ctrl)
+{
+    uint32_t finished = p_ctrl->tx_period;
+    uint32_t next = finished + 1U;
+    if (next >= p_ctrl->period_count)
+    {
+        next = 0U;
+    }
+    p_ctrl->tx_period = (uint16_t) next;
+
+    uint32_t done = p_ctrl->tx_period_done + 1U;
+    p_ctrl->tx_period_done = done;
+
+    /** The next period is ready if the application returned it since it was last played. */
+    if ((int32_t) (p_ctrl->tx_period_ready - done) > 0)
+    {
+        if (p_ctrl->tx_underrun_muted)
+        {
+            HW_SSI_MuteOff(p_ctrl->p_reg);
+            p_ctrl->tx_underrun_muted = false;
+        }
+    }
+    else
+    {
+        p_ctrl->tx_underrun_count++;
+        if (!p_ctrl->tx_underrun_muted)
+        {
+            HW_SSI_MuteOn(p_ctrl->p_reg);
+            p_ctrl->tx_underrun_muted = true;
+        }
+    }
+
+    /** Point the transfer or the ISR at the next period.  The data still in the FIFO covers the switch.  A prepared
+     * batch cannot replace this: chained DTC descriptors all run on one activation rather than one per period, and a
+     * DMAC batch only interrupts after its last descriptor, so neither reports each period or checks it was returned. */
+    ssi_tx_load_fifo(p_ctrl, &p_ctrl->p_tx_ring[next * p_ctrl->period_bytes], p_ctrl->period_bytes);
+    if (NULL != p_ctrl->p_transfer_tx)
+    {
+        /** Clear the empty flag so the request is raised again for the re-armed transfer if it is still valid. */
+        HW_SSI_TxFifoEmptyFlagClear(p_ctrl->p_reg);
+    }
+
+    ssi_period_callback_call(p_ctrl, I2S_EVENT_TX_PERIOD_DONE, finished);
+}
+
+/*******************************************************************************************************************//**
+ * Switches receive to the next period in the ring and reports the completed one.  If the application has not
+ * returned the next period yet, it is overwritten so no samples are dropped from the FIFO, and an overrun is counted.
+ *
+ * @param[in] p_ctrl  Control block of instance generating interrupt.
+ **********************************************************************************************************************/
+static void ssi_stream_rx_period_end(ssi_instance_ctrl_t * p_ctrl)
+{
+    uint32_t finished = p_ctrl->rx_period;
+    uint32_t next = finished + 1U;
+    if (next >= p_ctrl->period_count)
+    {
+        next = 0U;
+    }
+    p_ctrl->rx_period = (uint16_t) next;
+
+    uint32_t done = p_ctrl->rx_period_done + 1U;
+    p_ctrl->rx_period_done = done;
+
+    /** The next period is free if the application returned it since it was last filled. */
+    if ((int32_t) (p_ctrl->rx_period_free - done) <= 0)
+    {
+        p_ctrl->rx_overrun_count++;
+    }
+
+    /** Point the transfer or the ISR at the next period. */
+    ssi_rx_unload_fifo(p_ctrl, &p_ctrl->p_rx_ring[next * p_ctrl->period_bytes], p_ctrl->period_bytes);
+
+    ssi_period_callback_call(p_ctrl, I2S_EVENT_RX_PERIOD_DONE, finished);
+}
+
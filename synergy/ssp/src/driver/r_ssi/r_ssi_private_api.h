@@ -46,6 +46,11 @@ ssp_err_t R_SSI_Mute      (i2s_ctrl_t      * const p_api_ctrl,
                            i2s_mute_t        const mute_enable);
 ssp_err_t R_SSI_Close     (i2s_ctrl_t      * const p_ctrl);
 ssp_err_t R_SSI_VersionGet(ssp_version_t   * const p_version);
+ssp_err_t R_SSI_StreamStart(i2s_ctrl_t             * const p_ctrl,
+                            i2s_stream_cfg_t const * const p_stream_cfg);
+ssp_err_t R_SSI_StreamAck (i2s_ctrl_t      * const p_ctrl,
+                           i2s_dir_t         const dir,
+                           uint32_t          const periods);
 
 /* Common macro for SSP header files. There is also a corresponding SSP_HEADER macro at the top of this file. */
 SSP_FOOTER
@@ -0,0 +1,748 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : sf_adc_periodic.c
+ * Description  : Hardware timed ADC acquisition framework. A timer starts the scans through the ELC, the DTC copies
+ *                each scan into a ring of blocks and completed blocks are averaged or FIR decimated per channel.
+ **********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "sf_adc_periodic.h"
+#include "sf_adc_periodic_private_api.h"
+#include "r_elc.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/** "ADCP" in ASCII, used to determine if the framework is open. */
+#define SF_ADC_PERIODIC_OPEN                 (0x41444350ULL)
+
+/** Scan mask bits of channels 0 to 27.  The sensor bits above them have no data register in the scanned range. */
+#define SF_ADC_PERIODIC_PRV_CHANNEL_MASK     ((1UL << SF_ADC_PERIODIC_CHANNELS_MAX) - 1UL)
+
+/** Macro for error logger. */
+#ifndef SF_ADC_PERIODIC_ERROR_RETURN
+/*LDRA_INSPECTED 77 S This macro does not work when surrounded by parentheses. */
+#define SF_ADC_PERIODIC_ERROR_RETURN(a, err) SSP_ERROR_RETURN((a), (err), &g_module_name[0], &g_sf_adc_periodic_version)
+#endif
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+#if SF_ADC_PERIODIC_CFG_PARAM_CHECKING_ENABLE
+static ssp_err_t sf_adc_periodic_open_param_check (sf_adc_periodic_instance_ctrl_t * const p_ctrl,
+                                                   sf_adc_periodic_cfg_t const * const p_cfg);
+#endif
+static ssp_err_t sf_adc_periodic_filter_init (sf_adc_periodic_instance_ctrl_t * const p_ctrl,
+                                              sf_adc_periodic_cfg_t const * const p_cfg);
+static ssp_err_t sf_adc_periodic_lower_lvl_open (sf_adc_periodic_instance_ctrl_t * const p_ctrl,
+                                                 sf_adc_periodic_cfg_t const * const p_cfg);
+static void      sf_adc_periodic_adc_callback (adc_callback_args_t * p_args);
+static void      sf_adc_periodic_work (void * p_context, void * p_args);
+static void      sf_adc_periodic_block_process (sf_adc_periodic_instance_ctrl_t * const p_ctrl,
+                                                uint16_t const * p_raw);
+static q15_t     sf_adc_periodic_q15 (int32_t value);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+#if defined(__GNUC__)
+/* This structure is affected by warnings from the GCC compiler bug https:/gcc.gnu.org/bugzilla/show_bug.cgi?id=60784
+ * This pragma suppresses the warnings in this structure only, and will be removed when the SSP compiler is updated to
+ * v5.3.*/
+/*LDRA_INSPECTED 69 S */
+#pragma GCC diagnostic ignored "-Wmissing-field-initializers"
+#endif
+/** Version data structure used by error logger macro. */
+static const ssp_version_t g_sf_adc_periodic_version =
+{
+    .api_version_minor  = SF_ADC_PERIODIC_API_VERSION_MINOR,
+    .api_version_major  = SF_ADC_PERIODIC_API_VERSION_MAJOR,
+    .code_version_major = SF_ADC_PERIODIC_CODE_VERSION_MAJOR,
+    .code_version_minor = SF_ADC_PERIODIC_CODE_VERSION_MINOR
+};
+#if defined(__GNUC__)
+/* Restore warning settings for 'missing-field-initializers' to as specified on command line. */
+/*LDRA_INSPECTED 69 S */
+#pragma GCC diagnostic pop
+#endif
+
+/** Name of module used by error logger macro */
+#if BSP_CFG_ERROR_LOG != 0
+static const char g_module_name[] = "sf_adc_periodic";
+#endif
+
+/** Filled in Interface API structure for this Instance. */
+/*LDRA_INSPECTED 27 D This structure must be accessible in user code. It cannot be static. */
+const sf_adc_periodic_api_t g_sf_adc_periodic_on_sf_adc_periodic =
+{
+    .open       = SF_ADC_PERIODIC_Open,
+    .start      = SF_ADC_PERIODIC_Start,
+    .stop       = SF_ADC_PERIODIC_Stop,
+    .close      = SF_ADC_PERIODIC_Close,
+    .versionGet = SF_ADC_PERIODIC_VersionGet
+};
+
+/** @addtogroup SF_ADC_PERIODIC
+ * @{
+ */
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @brief  Open the ADC, timer and DTC and link the timer to the ADC scan trigger.
+ *
+ *  Implements sf_adc_periodic_api_t::open
+ *
+ *  The ADC is opened from a copy of its configuration with the framework's callback. The transfer information of
+ *  the DTC instance is overwritten: each scan end copies the data registers of the lowest to the highest scanned
+ *  channel into the ring, and the CPU is interrupted when frames_per_block scans are copied.
+ *
+ * @retval  SSP_SUCCESS                 The framework is open and ready to start.
+ * @retval  SSP_ERR_ASSERTION           A pointer argument or a lower level instance is NULL, or a size is 0.
+ * @retval  SSP_ERR_IN_USE              The framework is already open.
+ * @retval  SSP_ERR_INVALID_MODE        The ADC is not configured for single scans triggered by the ELC.
+ * @retval  SSP_ERR_INVALID_ARGUMENT    No channel or a sensor is scanned, frames_per_block is not a multiple of
+ *                                      decimation, or the FIR decimator rejected the filter settings.
+ * @retval  SSP_ERR_INVALID_SIZE        The ring is smaller than block_count blocks.
+ * @return                              See @ref Common_Error_Codes or functions called by this function for other
+ *                                      possible return codes. This function calls:
+ *                                      * adc_api_t::open
+ *                                      * adc_api_t::scanCfg
+ *                                      * adc_api_t::infoGet
+ *                                      * timer_api_t::open
+ *                                      * timer_api_t::infoGet
+ *                                      * elc_api_t::linkSet
+ *                                      * transfer_api_t::open
+ **********************************************************************************************************************/
+ssp_err_t SF_ADC_PERIODIC_Open (sf_adc_periodic_ctrl_t * const p_api_ctrl, sf_adc_periodic_cfg_t const * const p_cfg)
+{
+    sf_adc_periodic_instance_ctrl_t * p_ctrl = (sf_adc_periodic_instance_ctrl_t *) p_api_ctrl;
+    ssp_err_t err = SSP_SUCCESS;
+
+#if SF_ADC_PERIODIC_CFG_PARAM_CHECKING_ENABLE
+    err = sf_adc_periodic_open_param_check(p_ctrl, p_cfg);
+    SF_ADC_PERIODIC_ERROR_RETURN(SSP_SUCCESS == err, err);
+#endif
+
+    /** Each scanned channel has a fixed offset in a scan copied by the DTC, counted from the lowest channel. */
+    uint32_t scan_mask = p_cfg->p_lower_lvl_adc->p_channel_cfg->scan_mask;
+    SF_ADC_PERIODIC_ERROR_RETURN(0U != scan_mask, SSP_ERR_INVALID_ARGUMENT);
+    SF_ADC_PERIODIC_ERROR_RETURN(0U == (scan_mask & ~SF_ADC_PERIODIC_PRV_CHANNEL_MASK), SSP_ERR_INVALID_ARGUMENT);
+
+    uint32_t lowest = 0U;
+    while (0U == (scan_mask & (1UL << lowest)))
+    {
+        lowest++;
+    }
+
+    p_ctrl->channels   = 0U;
+    p_ctrl->raw_stride = 0U;
+    for (uint32_t channel = lowest; channel < SF_ADC_PERIODIC_CHANNELS_MAX; channel++)
+    {
+        if (scan_mask & (1UL << channel))
+        {
+            p_ctrl->slot[p_ctrl->channels] = (uint8_t) (channel - lowest);
+            p_ctrl->channels++;
+            p_ctrl->raw_stride = (channel - lowest) + 1U;
+        }
+    }
+
+    p_ctrl->block_samples = p_ctrl->raw_stride * p_cfg->frames_per_block;
+    SF_ADC_PERIODIC_ERROR_RETURN((p_ctrl->block_samples * p_cfg->block_count) <= p_cfg->ring_samples,
+                                 SSP_ERR_INVALID_SIZE);
+
+    p_ctrl->p_ring                     = p_cfg->p_ring;
+    p_ctrl->frames_per_block           = p_cfg->frames_per_block;
+    p_ctrl->block_count                = p_cfg->block_count;
+    p_ctrl->filter                     = p_cfg->filter;
+    p_ctrl->decimation                 = p_cfg->decimation;
+    p_ctrl->q15_shift                  = p_cfg->q15_shift;
+    p_ctrl->p_scratch                  = p_cfg->p_scratch;
+    p_ctrl->p_output                   = p_cfg->p_output;
+    p_ctrl->p_callback                 = p_cfg->p_callback;
+    p_ctrl->p_context                  = p_cfg->p_context;
+    p_ctrl->deferred_callback          = p_cfg->deferred_callback;
+    p_ctrl->deferred_callback_priority = p_cfg->deferred_callback_priority;
+    p_ctrl->block_done                 = 0U;
+    p_ctrl->block_processed            = 0U;
+    p_ctrl->write_block                = 0U;
+    p_ctrl->work_pending               = false;
+    p_ctrl->running                    = false;
+
+    /** Set up the decimators before any driver is opened, so there is nothing to close if they fail. */
+    err = sf_adc_periodic_filter_init(p_ctrl, p_cfg);
+    SF_ADC_PERIODIC_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    err = sf_adc_periodic_lower_lvl_open(p_ctrl, p_cfg);
+    SF_ADC_PERIODIC_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    p_ctrl->open = SF_ADC_PERIODIC_OPEN;
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Start sampling into the first block of the ring.
+ *
+ *  Implements sf_adc_periodic_api_t::start
+ *
+ *  Block numbers and the decimator history restart from 0. The ADC waits for the timer, which is started last so
+ *  the first scan is taken one timer period after this call.
+ *
+ * @retval  SSP_SUCCESS                 Sampling is started.
+ * @retval  SSP_ERR_ASSERTION           p_api_ctrl is NULL.
+ * @retval  SSP_ERR_NOT_OPEN            The framework is not open.
+ * @retval  SSP_ERR_IN_USE              Sampling is already started.
+ * @return                              See @ref Common_Error_Codes or functions called by this function for other
+ *                                      possible return codes. This function calls:
+ *                                      * transfer_api_t::reset
+ *                                      * adc_api_t::scanStart
+ *                                      * timer_api_t::start
+ **********************************************************************************************************************/
+ssp_err_t SF_ADC_PERIODIC_Start (sf_adc_periodic_ctrl_t * const p_api_ctrl)
+{
+    sf_adc_periodic_instance_ctrl_t * p_ctrl = (sf_adc_periodic_instance_ctrl_t *) p_api_ctrl;
+
+#if SF_ADC_PERIODIC_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+#endif
+    SF_ADC_PERIODIC_ERROR_RETURN(SF_ADC_PERIODIC_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+    SF_ADC_PERIODIC_ERROR_RETURN(!p_ctrl->running, SSP_ERR_IN_USE);
+
+    /** Blocks left from an earlier run are dropped by the work function once the counters match. */
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    p_ctrl->write_block     = 0U;
+    p_ctrl->block_done      = 0U;
+    p_ctrl->block_processed = 0U;
+    SSP_CRITICAL_SECTION_EXIT;
+
+    if (SF_ADC_PERIODIC_FILTER_FIR == p_ctrl->filter)
+    {
+        uint32_t state_samples = (((uint32_t) p_ctrl->fir[0].numTaps + p_ctrl->frames_per_block) - 1U);
+        for (uint32_t channel = 0U; channel < p_ctrl->channels; channel++)
+        {
+            for (uint32_t i = 0U; i < state_samples; i++)
+            {
+                p_ctrl->fir[channel].pState[i] = 0;
+            }
+        }
+    }
+
+    transfer_instance_t const * p_transfer = p_ctrl->p_transfer;
+    ssp_err_t err = p_transfer->p_api->reset(p_transfer->p_ctrl, p_ctrl->p_result, p_ctrl->p_ring,
+                                             p_ctrl->frames_per_block);
+    SF_ADC_PERIODIC_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    err = p_ctrl->p_adc->p_api->scanStart(p_ctrl->p_adc->p_ctrl);
+    SF_ADC_PERIODIC_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    p_ctrl->running = true;
+    err = p_ctrl->p_timer->p_api->start(p_ctrl->p_timer->p_ctrl);
+    if (SSP_SUCCESS != err)
+    {
+        p_ctrl->running = false;
+        p_ctrl->p_adc->p_api->scanStop(p_ctrl->p_adc->p_ctrl);
+        p_transfer->p_api->disable(p_transfer->p_ctrl);
+    }
+    SF_ADC_PERIODIC_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Stop sampling.
+ *
+ *  Implements sf_adc_periodic_api_t::stop
+ *
+ *  The block being filled is discarded. Completed blocks that were not processed yet are still passed to the
+ *  callback.
+ *
+ * @retval  SSP_SUCCESS                 Sampling is stopped.
+ * @retval  SSP_ERR_ASSERTION           p_api_ctrl is NULL.
+ * @retval  SSP_ERR_NOT_OPEN            The framework is not open.
+ * @return                              See @ref Common_Error_Codes or functions called by this function for other
+ *                                      possible return codes. This function calls:
+ *                                      * timer_api_t::stop
+ *                                      * adc_api_t::scanStop
+ *                                      * transfer_api_t::disable
+ **********************************************************************************************************************/
+ssp_err_t SF_ADC_PERIODIC_Stop (sf_adc_periodic_ctrl_t * const p_api_ctrl)
+{
+    sf_adc_periodic_instance_ctrl_t * p_ctrl = (sf_adc_periodic_instance_ctrl_t *) p_api_ctrl;
+
+#if SF_ADC_PERIODIC_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+#endif
+    SF_ADC_PERIODIC_ERROR_RETURN(SF_ADC_PERIODIC_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+
+    /** Stop the trigger first so no scan is started after the DTC is disabled. */
+    p_ctrl->running = false;
+    ssp_err_t err = p_ctrl->p_timer->p_api->stop(p_ctrl->p_timer->p_ctrl);
+    SF_ADC_PERIODIC_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    err = p_ctrl->p_adc->p_api->scanStop(p_ctrl->p_adc->p_ctrl);
+    SF_ADC_PERIODIC_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    err = p_ctrl->p_transfer->p_api->disable(p_ctrl->p_transfer->p_ctrl);
+    SF_ADC_PERIODIC_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Stop sampling, close the lower level drivers and break the ELC link.
+ *
+ *  Implements sf_adc_periodic_api_t::close
+ *
+ *  Completed blocks that were not processed yet are discarded without callbacks.
+ *
+ * @retval  SSP_SUCCESS                 The framework is closed.
+ * @retval  SSP_ERR_ASSERTION           p_api_ctrl is NULL.
+ * @retval  SSP_ERR_NOT_OPEN            The framework is not open.
+ * @return                              See @ref Common_Error_Codes or functions called by this function for other
+ *                                      possible return codes. This function calls:
+ *                                      * timer_api_t::close
+ *                                      * adc_api_t::close
+ *                                      * transfer_api_t::close
+ *                                      * elc_api_t::linkBreak
+ **********************************************************************************************************************/
+ssp_err_t SF_ADC_PERIODIC_Close (sf_adc_periodic_ctrl_t * const p_api_ctrl)
+{
+    sf_adc_periodic_instance_ctrl_t * p_ctrl = (sf_adc_periodic_instance_ctrl_t *) p_api_ctrl;
+
+#if SF_ADC_PERIODIC_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+#endif
+    SF_ADC_PERIODIC_ERROR_RETURN(SF_ADC_PERIODIC_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+
+    p_ctrl->open    = 0U;
+    p_ctrl->running = false;
+
+    /** Close everything even if one of the drivers reports an error, and return the first error. */
+    ssp_err_t err = p_ctrl->p_timer->p_api->close(p_ctrl->p_timer->p_ctrl);
+    ssp_err_t close_err = p_ctrl->p_adc->p_api->close(p_ctrl->p_adc->p_ctrl);
+    err = (SSP_SUCCESS == err) ? close_err : err;
+    close_err = p_ctrl->p_transfer->p_api->close(p_ctrl->p_transfer->p_ctrl);
+    err = (SSP_SUCCESS == err) ? close_err : err;
+    close_err = g_elc_on_elc.linkBreak(p_ctrl->elc_peripheral);
+    err = (SSP_SUCCESS == err) ? close_err : err;
+
+    /** Processing that is already posted returns without a callback once the counters match. */
+    p_ctrl->block_processed = p_ctrl->block_done;
+
+    SF_ADC_PERIODIC_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Get the version of the framework.
+ *
+ *  Implements sf_adc_periodic_api_t::versionGet
+ *
+ * @retval  SSP_SUCCESS                 Version is stored in p_version.
+ * @retval  SSP_ERR_ASSERTION           p_version is NULL.
+ **********************************************************************************************************************/
+ssp_err_t SF_ADC_PERIODIC_VersionGet (ssp_version_t * const p_version)
+{
+#if SF_ADC_PERIODIC_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_version);
+#endif
+
+    p_version->version_id = g_sf_adc_periodic_version.version_id;
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup SF_ADC_PERIODIC)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+#if SF_ADC_PERIODIC_CFG_PARAM_CHECKING_ENABLE
+/*******************************************************************************************************************//**
+ * @brief  Parameter check for SF_ADC_PERIODIC_Open.
+ * @param[in]  p_ctrl    Control block.
+ * @param[in]  p_cfg     Configuration.
+ **********************************************************************************************************************/
+static ssp_err_t sf_adc_periodic_open_param_check (sf_adc_periodic_instance_ctrl_t * const p_ctrl,
+                                                   sf_adc_periodic_cfg_t const * const p_cfg)
+{
+    SSP_ASSERT(NULL != p_ctrl);
+    SSP_ASSERT(NULL != p_cfg);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_adc);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_adc->p_cfg);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_adc->p_channel_cfg);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_adc->p_api);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_timer);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_timer->p_cfg);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_timer->p_api);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_transfer);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_transfer->p_cfg);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_transfer->p_cfg->p_info);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_transfer->p_api);
+    SSP_ASSERT(NULL != p_cfg->p_ring);
+    SSP_ASSERT(NULL != p_cfg->p_callback);
+    SSP_ASSERT(0U != p_cfg->frames_per_block);
+    SF_ADC_PERIODIC_ERROR_RETURN(SF_ADC_PERIODIC_OPEN != p_ctrl->open, SSP_ERR_IN_USE);
+    SF_ADC_PERIODIC_ERROR_RETURN(2U <= p_cfg->block_count, SSP_ERR_INVALID_SIZE);
+    SF_ADC_PERIODIC_ERROR_RETURN(ADC_MODE_SINGLE_SCAN == p_cfg->p_lower_lvl_adc->p_cfg->mode, SSP_ERR_INVALID_MODE);
+    SF_ADC_PERIODIC_ERROR_RETURN(ADC_TRIGGER_SYNC_ELC == p_cfg->p_lower_lvl_adc->p_cfg->trigger, SSP_ERR_INVALID_MODE);
+
+    if (SF_ADC_PERIODIC_FILTER_NONE != p_cfg->filter)
+    {
+        SSP_ASSERT(NULL != p_cfg->p_output);
+        SSP_ASSERT(0U != p_cfg->decimation);
+        SF_ADC_PERIODIC_ERROR_RETURN(0U == (p_cfg->frames_per_block % p_cfg->decimation), SSP_ERR_INVALID_ARGUMENT);
+    }
+
+    if (SF_ADC_PERIODIC_FILTER_FIR == p_cfg->filter)
+    {
+        SSP_ASSERT(NULL != p_cfg->p_fir_coeffs);
+        SSP_ASSERT(NULL != p_cfg->p_fir_state);
+        SSP_ASSERT(NULL != p_cfg->p_scratch);
+        SSP_ASSERT(0U != p_cfg->fir_taps);
+    }
+
+    return SSP_SUCCESS;
+}
+#endif
+
+/*******************************************************************************************************************//**
+ * @brief  Set up one FIR decimator per scanned channel, each with its own part of the state buffer.
+ * @param[in]  p_ctrl    Control block, with the channel count set.
+ * @param[in]  p_cfg     Configuration.
+ * @retval  SSP_SUCCESS                 The decimators are set up, or the filter is not ::SF_ADC_PERIODIC_FILTER_FIR.
+ * @retval  SSP_ERR_INVALID_ARGUMENT    arm_fir_decimate_init_q15 rejected the settings.
+ **********************************************************************************************************************/
+static ssp_err_t sf_adc_periodic_filter_init (sf_adc_periodic_instance_ctrl_t * const p_ctrl,
+                                              sf_adc_periodic_cfg_t const * const p_cfg)
+{
+    if (SF_ADC_PERIODIC_FILTER_FIR != p_cfg->filter)
+    {
+        return SSP_SUCCESS;
+    }
+
+    uint32_t state_samples = (((uint32_t) p_cfg->fir_taps + p_cfg->frames_per_block) - 1U);
+    for (uint32_t channel = 0U; channel < p_ctrl->channels; channel++)
+    {
+        arm_status status = arm_fir_decimate_init_q15(&p_ctrl->fir[channel], p_cfg->fir_taps, p_cfg->decimation,
+                                                      p_cfg->p_fir_coeffs, &p_cfg->p_fir_state[channel * state_samples],
+                                                      p_cfg->frames_per_block);
+        if (ARM_MATH_SUCCESS != status)
+        {
+            return SSP_ERR_INVALID_ARGUMENT;
+        }
+    }
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Open the ADC, timer and DTC, and link the timer overflow event to the ADC scan trigger. The drivers that
+ *         are already open are closed again if a later step fails.
+ * @param[in]  p_ctrl    Control block.
+ * @param[in]  p_cfg     Configuration.
+ **********************************************************************************************************************/
+static ssp_err_t sf_adc_periodic_lower_lvl_open (sf_adc_periodic_instance_ctrl_t * const p_ctrl,
+                                                 sf_adc_periodic_cfg_t const * const p_cfg)
+{
+    adc_instance_t const      * p_adc      = p_cfg->p_lower_lvl_adc;
+    timer_instance_t const    * p_timer    = p_cfg->p_lower_lvl_timer;
+    transfer_instance_t const * p_transfer = p_cfg->p_lower_lvl_transfer;
+    adc_info_t                  adc_info;
+    timer_info_t                timer_info;
+
+    p_ctrl->p_adc      = p_adc;
+    p_ctrl->p_timer    = p_timer;
+    p_ctrl->p_transfer = p_transfer;
+
+    /** Open the ADC with the framework's callback, which runs on the scan end of the last scan in each block. */
+    p_ctrl->adc_cfg            = *p_adc->p_cfg;
+    p_ctrl->adc_cfg.p_callback = sf_adc_periodic_adc_callback;
+    p_ctrl->adc_cfg.p_context  = p_ctrl;
+    ssp_err_t err = p_adc->p_api->open(p_adc->p_ctrl, &p_ctrl->adc_cfg);
+    SF_ADC_PERIODIC_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    err = p_adc->p_api->scanCfg(p_adc->p_ctrl, p_adc->p_channel_cfg);
+    if (SSP_SUCCESS == err)
+    {
+        err = p_adc->p_api->infoGet(p_adc->p_ctrl, &adc_info);
+    }
+    if (SSP_SUCCESS != err)
+    {
+        p_adc->p_api->close(p_adc->p_ctrl);
+    }
+    SF_ADC_PERIODIC_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    p_ctrl->p_result       = (uint16_t const *) adc_info.p_address;
+    p_ctrl->elc_peripheral = adc_info.elc_peripheral;
+
+    /** Each timer overflow starts one scan. */
+    err = p_timer->p_api->open(p_timer->p_ctrl, p_timer->p_cfg);
+    if (SSP_SUCCESS == err)
+    {
+        err = p_timer->p_api->infoGet(p_timer->p_ctrl, &timer_info);
+        if (SSP_SUCCESS == err)
+        {
+            err = g_elc_on_elc.linkSet(adc_info.elc_peripheral, timer_info.elc_event);
+        }
+        if (SSP_SUCCESS != err)
+        {
+            p_timer->p_api->close(p_timer->p_ctrl);
+        }
+    }
+    if (SSP_SUCCESS != err)
+    {
+        p_adc->p_api->close(p_adc->p_ctrl);
+    }
+    SF_ADC_PERIODIC_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    /** Each scan end copies one scan into the ring. The source area repeats after every scan and the destination
+     *  advances through the block, so the DTC only interrupts the CPU when the block is full. */
+    transfer_info_t * p_info = p_transfer->p_cfg->p_info;
+    p_info->mode           = TRANSFER_MODE_BLOCK;
+    p_info->size           = TRANSFER_SIZE_2_BYTE;
+    p_info->src_addr_mode  = TRANSFER_ADDR_MODE_INCREMENTED;
+    p_info->dest_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED;
+    p_info->repeat_area    = TRANSFER_REPEAT_AREA_SOURCE;
+    p_info->irq            = TRANSFER_IRQ_END;
+    p_info->chain_mode     = TRANSFER_CHAIN_MODE_DISABLED;
+    p_info->p_src          = p_ctrl->p_result;
+    p_info->p_dest         = p_ctrl->p_ring;
+    p_info->length         = (uint16_t) p_ctrl->raw_stride;
+    p_info->num_blocks     = p_ctrl->frames_per_block;
+
+    p_ctrl->transfer_cfg                   = *p_transfer->p_cfg;
+    p_ctrl->transfer_cfg.activation_source = adc_info.elc_event;
+    p_ctrl->transfer_cfg.auto_enable       = false;
+    p_ctrl->transfer_cfg.p_callback        = NULL;
+    err = p_transfer->p_api->open(p_transfer->p_ctrl, &p_ctrl->transfer_cfg);
+    if (SSP_SUCCESS != err)
+    {
+        g_elc_on_elc.linkBreak(adc_info.elc_peripheral);
+        p_timer->p_api->close(p_timer->p_ctrl);
+        p_adc->p_api->close(p_adc->p_ctrl);
+    }
+    SF_ADC_PERIODIC_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  ADC callback. The DTC passes the scan end interrupt to the CPU once it has copied the last scan of a
+ *         block. The DTC is pointed at the next block before the next scan ends, and the completed block is
+ *         processed here or posted to the deferred work scheduler.
+ * @param[in]  p_args    ADC callback arguments, p_context is the framework control block.
+ **********************************************************************************************************************/
+static void sf_adc_periodic_adc_callback (adc_callback_args_t * p_args)
+{
+    sf_adc_periodic_instance_ctrl_t * p_ctrl = (sf_adc_periodic_instance_ctrl_t *) p_args->p_context;
+
+    if ((ADC_EVENT_SCAN_COMPLETE != p_args->event) || (!p_ctrl->running))
+    {
+        return;
+    }
+
+    /** Re-arm the DTC first, the next scan ends one timer period after this one. */
+    p_ctrl->write_block = (uint8_t) ((p_ctrl->write_block + 1U) % p_ctrl->block_count);
+    p_ctrl->p_transfer->p_api->reset(p_ctrl->p_transfer->p_ctrl, NULL,
+                                     &p_ctrl->p_ring[p_ctrl->write_block * p_ctrl->block_samples],
+                                     p_ctrl->frames_per_block);
+    p_ctrl->block_done++;
+
+    /** One work item processes every completed block, so only post when none is pending. */
+    if (p_ctrl->work_pending)
+    {
+        return;
+    }
+
+    /** If no work slot is free, the completed blocks stay pending and are processed by the work posted at the end of
+     *  a later block. */
+    p_ctrl->work_pending = true;
+    ssp_err_t err = R_BSP_WorkPostOrCall(p_ctrl->deferred_callback, sf_adc_periodic_work, p_ctrl, NULL, 0U,
+                                         p_ctrl->deferred_callback_priority);
+    if (SSP_SUCCESS != err)
+    {
+        p_ctrl->work_pending = false;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Process completed blocks in order and pass each to the callback. Blocks that the DTC overwrote before
+ *         they were reached are reported once with ::SF_ADC_PERIODIC_EVENT_OVERRUN and skipped.
+ * @param[in]  p_context Framework control block.
+ * @param[in]  p_args    Not used.
+ **********************************************************************************************************************/
+static void sf_adc_periodic_work (void * p_context, void * p_args)
+{
+    sf_adc_periodic_instance_ctrl_t * p_ctrl = (sf_adc_periodic_instance_ctrl_t *) p_context;
+    sf_adc_periodic_callback_args_t   args;
+    SSP_PARAMETER_NOT_USED(p_args);
+
+    args.p_context  = p_ctrl->p_context;
+    args.raw_stride = p_ctrl->raw_stride;
+    args.channels   = p_ctrl->channels;
+
+    for (;;)
+    {
+        uint32_t done;
+
+        /** Clear work_pending under the same lock as the last check, so a block completed in between posts again. */
+        SSP_CRITICAL_SECTION_DEFINE;
+        SSP_CRITICAL_SECTION_ENTER;
+        done = p_ctrl->block_done;
+        if (done == p_ctrl->block_processed)
+        {
+            p_ctrl->work_pending = false;
+        }
+        SSP_CRITICAL_SECTION_EXIT;
+
+        if (done == p_ctrl->block_processed)
+        {
+            return;
+        }
+
+        /** The DTC is filling the block after the newest one, so block_count - 1 completed blocks are intact. */
+        uint32_t behind = done - p_ctrl->block_processed;
+        if (behind >= p_ctrl->block_count)
+        {
+            uint32_t lost = behind - (p_ctrl->block_count - 1U);
+            args.event       = SF_ADC_PERIODIC_EVENT_OVERRUN;
+            args.block       = p_ctrl->block_processed;
+            args.blocks_lost = lost;
+            args.p_raw       = NULL;
+            args.p_data      = NULL;
+            args.frames      = 0U;
+            p_ctrl->block_processed += lost;
+            p_ctrl->p_callback(&args);
+        }
+
+        uint16_t const * p_raw = &p_ctrl->p_ring[(p_ctrl->block_processed % p_ctrl->block_count) *
+                                                 p_ctrl->block_samples];
+        sf_adc_periodic_block_process(p_ctrl, p_raw);
+
+        args.event       = SF_ADC_PERIODIC_EVENT_BLOCK_DONE;
+        args.block       = p_ctrl->block_processed;
+        args.blocks_lost = 0U;
+        args.p_raw       = p_raw;
+        if (SF_ADC_PERIODIC_FILTER_NONE == p_ctrl->filter)
+        {
+            args.p_data = NULL;
+            args.frames = p_ctrl->frames_per_block;
+        }
+        else
+        {
+            args.p_data = p_ctrl->p_output;
+            args.frames = (uint32_t) p_ctrl->frames_per_block / p_ctrl->decimation;
+        }
+        p_ctrl->block_processed++;
+        p_ctrl->p_callback(&args);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Average or FIR decimate one raw block per channel into the output buffer.
+ * @param[in]  p_ctrl    Control block.
+ * @param[in]  p_raw     Raw block in the ring.
+ **********************************************************************************************************************/
+static void sf_adc_periodic_block_process (sf_adc_periodic_instance_ctrl_t * const p_ctrl, uint16_t const * p_raw)
+{
+    uint32_t frames   = p_ctrl->frames_per_block;
+    uint32_t m        = p_ctrl->decimation;
+    uint32_t channels = p_ctrl->channels;
+    uint32_t stride   = p_ctrl->raw_stride;
+    uint32_t out      = frames / m;
+
+    if (SF_ADC_PERIODIC_FILTER_AVERAGE == p_ctrl->filter)
+    {
+        for (uint32_t o = 0U; o < out; o++)
+        {
+            uint16_t const * p_scan = &p_raw[o * m * stride];
+            for (uint32_t channel = 0U; channel < channels; channel++)
+            {
+                uint32_t sum = 0U;
+                for (uint32_t k = 0U; k < m; k++)
+                {
+                    sum += p_scan[(k * stride) + p_ctrl->slot[channel]];
+                }
+                p_ctrl->p_output[(o * channels) + channel] =
+                    sf_adc_periodic_q15((int32_t) ((sum << p_ctrl->q15_shift) / m));
+            }
+        }
+    }
+    else if (SF_ADC_PERIODIC_FILTER_FIR == p_ctrl->filter)
+    {
+        q15_t * p_in  = p_ctrl->p_scratch;
+        q15_t * p_dec = &p_ctrl->p_scratch[frames];
+        for (uint32_t channel = 0U; channel < channels; channel++)
+        {
+            uint16_t const * p_sample = &p_raw[p_ctrl->slot[channel]];
+            for (uint32_t i = 0U; i < frames; i++)
+            {
+                p_in[i] = sf_adc_periodic_q15((int32_t) ((uint32_t) p_sample[i * stride] << p_ctrl->q15_shift));
+            }
+
+            arm_fir_decimate_q15(&p_ctrl->fir[channel], p_in, p_dec, frames);
+
+            for (uint32_t o = 0U; o < out; o++)
+            {
+                p_ctrl->p_output[(o * channels) + channel] = p_dec[o];
+            }
+        }
+    }
+    else
+    {
+        /* SF_ADC_PERIODIC_FILTER_NONE: the callback reads the raw block. */
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Saturate a shifted result to Q15.
+ * @param[in]  value     Shifted result.
+ * @return     value limited to the Q15 range.
+ **********************************************************************************************************************/
+static q15_t sf_adc_periodic_q15 (int32_t value)
+{
+    if (value > INT16_MAX)
+    {
+        return (q15_t) INT16_MAX;
+    }
+    if (value < INT16_MIN)
+    {
+        return (q15_t) INT16_MIN;
+    }
+    return (q15_t) value;
+}
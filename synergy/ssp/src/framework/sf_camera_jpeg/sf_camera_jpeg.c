@@ -0,0 +1,904 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : sf_camera_jpeg.c
+ * Description  : Camera to JPEG streaming framework, encodes PDC bands while the rest of the frame is captured.
+ **********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "sf_camera_jpeg.h"
+#include "sf_camera_jpeg_private_api.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/** "CJPG" in ASCII, used to determine if the framework is open. */
+#define SF_CAMERA_JPEG_OPEN                  (0x434A5047ULL)
+
+/** The JPEG encoder reads and writes its buffers in 8 byte units. */
+#define SF_CAMERA_JPEG_PRV_ALIGN             (8U)
+
+/** The JPEG encoder takes input in whole rows of 8 line minimum coded units. */
+#define SF_CAMERA_JPEG_PRV_MCU_LINES         (8U)
+
+/** The JPEG encoder only accepts YCbCr 4:2:2 input. */
+#define SF_CAMERA_JPEG_PRV_BYTES_PER_PIXEL   (2U)
+
+/** PDC events that stop the capture. */
+#define SF_CAMERA_JPEG_PRV_PDC_ERRORS        ((uint32_t) PDC_EVENT_ERR_OVERRUN | (uint32_t) PDC_EVENT_ERR_UNDERRUN | \
+                                              (uint32_t) PDC_EVENT_ERR_V_SET | (uint32_t) PDC_EVENT_ERR_H_SET)
+
+/** Macro for error logger. */
+#ifndef SF_CAMERA_JPEG_ERROR_RETURN
+/*LDRA_INSPECTED 77 S This macro does not work when surrounded by parentheses. */
+#define SF_CAMERA_JPEG_ERROR_RETURN(a, err) SSP_ERROR_RETURN((a), (err), &g_module_name[0], &g_sf_camera_jpeg_version)
+#endif
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+#if SF_CAMERA_JPEG_CFG_PARAM_CHECKING_ENABLE
+static ssp_err_t sf_camera_jpeg_open_param_check (sf_camera_jpeg_instance_ctrl_t * const p_ctrl,
+                                                  sf_camera_jpeg_cfg_t const * const p_cfg);
+#endif
+static void      sf_camera_jpeg_pdc_callback (pdc_callback_args_t * p_args);
+static void      sf_camera_jpeg_encode_callback (jpeg_encode_callback_args_t * p_args);
+static void      sf_camera_jpeg_pump (sf_camera_jpeg_instance_ctrl_t * const p_ctrl);
+static void      sf_camera_jpeg_process (sf_camera_jpeg_instance_ctrl_t * const p_ctrl);
+static void      sf_camera_jpeg_encoder_progress (sf_camera_jpeg_instance_ctrl_t * const p_ctrl,
+                                                  jpeg_encode_status_t status);
+static void      sf_camera_jpeg_feed (sf_camera_jpeg_instance_ctrl_t * const p_ctrl);
+static bool      sf_camera_jpeg_frame_begin (sf_camera_jpeg_instance_ctrl_t * const p_ctrl,
+                                             sf_camera_jpeg_band_t const * const p_band);
+static void      sf_camera_jpeg_frame_drop (sf_camera_jpeg_instance_ctrl_t * const p_ctrl);
+static void      sf_camera_jpeg_teardown (sf_camera_jpeg_instance_ctrl_t * const p_ctrl, uint32_t pdc_event);
+static bool      sf_camera_jpeg_output_reserve (sf_camera_jpeg_instance_ctrl_t * const p_ctrl, uint32_t * p_start);
+static void      sf_camera_jpeg_output_publish (sf_camera_jpeg_instance_ctrl_t * const p_ctrl,
+                                                sf_camera_jpeg_event_t event, uint32_t size);
+static void      sf_camera_jpeg_band_pop (sf_camera_jpeg_instance_ctrl_t * const p_ctrl,
+                                          sf_camera_jpeg_band_t * const p_band);
+static void      sf_camera_jpeg_callback_call (sf_camera_jpeg_instance_ctrl_t * const p_ctrl,
+                                               sf_camera_jpeg_event_t event, uint32_t frame, uint32_t pdc_event);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+#if defined(__GNUC__)
+/* This structure is affected by warnings from the GCC compiler bug https:/gcc.gnu.org/bugzilla/show_bug.cgi?id=60784
+ * This pragma suppresses the warnings in this structure only, and will be removed when the SSP compiler is updated to
+ * v5.3.*/
+/*LDRA_INSPECTED 69 S */
+#pragma GCC diagnostic ignored "-Wmissing-field-initializers"
+#endif
+/** Version data structure used by error logger macro. */
+static const ssp_version_t g_sf_camera_jpeg_version =
+{
+    .api_version_minor  = SF_CAMERA_JPEG_API_VERSION_MINOR,
+    .api_version_major  = SF_CAMERA_JPEG_API_VERSION_MAJOR,
+    .code_version_major = SF_CAMERA_JPEG_CODE_VERSION_MAJOR,
+    .code_version_minor = SF_CAMERA_JPEG_CODE_VERSION_MINOR
+};
+#if defined(__GNUC__)
+/* Restore warning settings for 'missing-field-initializers' to as specified on command line. */
+/*LDRA_INSPECTED 69 S */
+#pragma GCC diagnostic pop
+#endif
+
+/** Name of module used by error logger macro */
+#if BSP_CFG_ERROR_LOG != 0
+static const char g_module_name[] = "sf_camera_jpeg";
+#endif
+
+/** Filled in Interface API structure for this Instance. */
+/*LDRA_INSPECTED 27 D This structure must be accessible in user code. It cannot be static. */
+const sf_camera_jpeg_api_t g_sf_camera_jpeg_on_sf_camera_jpeg =
+{
+    .open         = SF_CAMERA_JPEG_Open,
+    .start        = SF_CAMERA_JPEG_Start,
+    .stop         = SF_CAMERA_JPEG_Stop,
+    .frameRelease = SF_CAMERA_JPEG_FrameRelease,
+    .close        = SF_CAMERA_JPEG_Close,
+    .versionGet   = SF_CAMERA_JPEG_VersionGet
+};
+
+/** @addtogroup SF_CAMERA_JPEG
+ * @{
+ */
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @brief  Open the PDC and the JPEG encoder for band-level encoding.
+ *
+ *  Implements sf_camera_jpeg_api_t::open
+ *
+ *  Both lower level modules are opened from copies of their configurations with the framework's callbacks. The PDC
+ *  must capture YCbCr 4:2:2 data with 2 bytes per pixel, and the encoder must be configured for the PDC capture size.
+ *
+ * @retval  SSP_SUCCESS                 The PDC and the encoder are open.
+ * @retval  SSP_ERR_ASSERTION           A pointer argument or a lower level instance is NULL.
+ * @retval  SSP_ERR_IN_USE              The framework is already open.
+ * @retval  SSP_ERR_INVALID_ARGUMENT    The band, buffer or output settings do not fit the PDC and the encoder.
+ * @retval  SSP_ERR_INVALID_ALIGNMENT   A band buffer or the output ring is not 8-byte aligned.
+ * @return                              See @ref Common_Error_Codes or functions called by this function for other
+ *                                      possible return codes. This function calls:
+ *                                      * pdc_api_t::open
+ *                                      * pdc_api_t::close
+ *                                      * jpeg_encode_api_t::open
+ **********************************************************************************************************************/
+ssp_err_t SF_CAMERA_JPEG_Open (sf_camera_jpeg_ctrl_t * const p_api_ctrl, sf_camera_jpeg_cfg_t const * const p_cfg)
+{
+    sf_camera_jpeg_instance_ctrl_t * p_ctrl = (sf_camera_jpeg_instance_ctrl_t *) p_api_ctrl;
+    ssp_err_t err = SSP_SUCCESS;
+
+#if SF_CAMERA_JPEG_CFG_PARAM_CHECKING_ENABLE
+    err = sf_camera_jpeg_open_param_check(p_ctrl, p_cfg);
+    SF_CAMERA_JPEG_ERROR_RETURN(SSP_SUCCESS == err, err);
+#endif
+
+    pdc_instance_t const         * p_pdc  = p_cfg->p_lower_lvl_pdc;
+    jpeg_encode_instance_t const * p_jpeg = p_cfg->p_lower_lvl_jpeg;
+
+    /** Open the PDC with the framework's callback. Buffers are passed when the capture starts. */
+    pdc_cfg_t pdc_cfg  = *p_pdc->p_cfg;
+    pdc_cfg.p_buffer   = NULL;
+    pdc_cfg.p_callback = sf_camera_jpeg_pdc_callback;
+    pdc_cfg.p_context  = p_ctrl;
+    err = p_pdc->p_api->open(p_pdc->p_ctrl, &pdc_cfg);
+    SF_CAMERA_JPEG_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    /** Open the encoder with the framework's callback. The configuration is kept to restart the encoder. */
+    p_ctrl->jpeg_cfg            = *p_jpeg->p_cfg;
+    p_ctrl->jpeg_cfg.p_callback = sf_camera_jpeg_encode_callback;
+    p_ctrl->jpeg_cfg.p_context  = p_ctrl;
+    err = p_jpeg->p_api->open(p_jpeg->p_ctrl, &p_ctrl->jpeg_cfg);
+    if (SSP_SUCCESS != err)
+    {
+        p_pdc->p_api->close(p_pdc->p_ctrl);
+    }
+    SF_CAMERA_JPEG_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    for (uint32_t i = 0U; i < p_cfg->num_band_buffers; i++)
+    {
+        p_ctrl->p_band_buffers[i] = p_cfg->pp_band_buffers[i];
+    }
+    p_ctrl->p_pdc            = p_pdc;
+    p_ctrl->p_jpeg           = p_jpeg;
+    p_ctrl->num_band_buffers = p_cfg->num_band_buffers;
+    p_ctrl->band_lines       = p_cfg->band_lines;
+    p_ctrl->line_bytes       = (uint32_t) p_pdc->p_cfg->x_capture_pixels * SF_CAMERA_JPEG_PRV_BYTES_PER_PIXEL;
+    p_ctrl->band_head        = 0U;
+    p_ctrl->band_count       = 0U;
+    p_ctrl->p_encoding       = NULL;
+    p_ctrl->encoder_status   = JPEG_ENCODE_STATUS_FREE;
+    p_ctrl->pdc_event        = 0U;
+    p_ctrl->running          = false;
+    p_ctrl->in_frame         = false;
+    p_ctrl->pumping          = false;
+    p_ctrl->pump_again       = false;
+    p_ctrl->p_output         = p_cfg->p_output_buffer;
+    p_ctrl->output_size      = p_cfg->output_buffer_size;
+    p_ctrl->output_frame_max = p_cfg->output_frame_max;
+    p_ctrl->frame_head       = 0U;
+    p_ctrl->frame_count      = 0U;
+    p_ctrl->p_callback       = p_cfg->p_callback;
+    p_ctrl->p_context        = p_cfg->p_context;
+    p_ctrl->open             = SF_CAMERA_JPEG_OPEN;
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Start capturing and encoding frames continuously.
+ *
+ *  Implements sf_camera_jpeg_api_t::start
+ *
+ *  The PDC captures each frame in bands of sf_camera_jpeg_cfg_t::band_lines lines. A band is passed to the encoder as
+ *  soon as it is captured and the encoder is ready for it, and its buffer goes back to the PDC when the encoder has
+ *  read it. The callback receives ::SF_CAMERA_JPEG_EVENT_DATA with the encoded data written so far after each band and
+ *  ::SF_CAMERA_JPEG_EVENT_FRAME_COMPLETE with the rest of the frame after the last one.
+ *
+ *  A frame is dropped, and reported with ::SF_CAMERA_JPEG_EVENT_FRAME_DROPPED, when the output ring has no room for
+ *  sf_camera_jpeg_cfg_t::output_frame_max bytes at its first band, when the PDC abandons it because no band buffer was
+ *  free, or when it grows past sf_camera_jpeg_cfg_t::output_frame_max.
+ *
+ * @retval  SSP_SUCCESS                 Capture started.
+ * @retval  SSP_ERR_ASSERTION           p_api_ctrl is NULL.
+ * @retval  SSP_ERR_NOT_OPEN            The framework is not open.
+ * @retval  SSP_ERR_IN_USE              The capture is already running.
+ * @return                              See @ref Common_Error_Codes or functions called by this function for other
+ *                                      possible return codes. This function calls:
+ *                                      * pdc_api_t::captureBandStart
+ *                                      * jpeg_encode_api_t::statusGet
+ *                                      * jpeg_encode_api_t::open
+ **********************************************************************************************************************/
+ssp_err_t SF_CAMERA_JPEG_Start (sf_camera_jpeg_ctrl_t * const p_api_ctrl)
+{
+    sf_camera_jpeg_instance_ctrl_t * p_ctrl = (sf_camera_jpeg_instance_ctrl_t *) p_api_ctrl;
+
+#if SF_CAMERA_JPEG_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+#endif
+    SF_CAMERA_JPEG_ERROR_RETURN(SF_CAMERA_JPEG_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+    SF_CAMERA_JPEG_ERROR_RETURN(!p_ctrl->running, SSP_ERR_IN_USE);
+
+    /** Reopen the encoder if a failed restart left it closed. */
+    volatile jpeg_encode_status_t status = JPEG_ENCODE_STATUS_FREE;
+    ssp_err_t err = p_ctrl->p_jpeg->p_api->statusGet(p_ctrl->p_jpeg->p_ctrl, &status);
+    if ((SSP_SUCCESS == err) && (JPEG_ENCODE_STATUS_FREE == status))
+    {
+        err = p_ctrl->p_jpeg->p_api->open(p_ctrl->p_jpeg->p_ctrl, &p_ctrl->jpeg_cfg);
+    }
+    SF_CAMERA_JPEG_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    p_ctrl->band_head      = 0U;
+    p_ctrl->band_count     = 0U;
+    p_ctrl->p_encoding     = NULL;
+    p_ctrl->encoder_status = JPEG_ENCODE_STATUS_FREE;
+    p_ctrl->pdc_event      = 0U;
+    p_ctrl->in_frame       = false;
+    p_ctrl->running        = true;
+
+    err = p_ctrl->p_pdc->p_api->captureBandStart(p_ctrl->p_pdc->p_ctrl, p_ctrl->p_band_buffers,
+                                                 p_ctrl->num_band_buffers, p_ctrl->band_lines);
+    if (SSP_SUCCESS != err)
+    {
+        p_ctrl->running = false;
+    }
+    SF_CAMERA_JPEG_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Stop capturing.
+ *
+ *  Implements sf_camera_jpeg_api_t::stop
+ *
+ *  A frame being encoded is dropped and reported with ::SF_CAMERA_JPEG_EVENT_FRAME_DROPPED. Completed frames stay in
+ *  the output ring until they are released.
+ *
+ * @retval  SSP_SUCCESS                 Capture stopped.
+ * @retval  SSP_ERR_ASSERTION           p_api_ctrl is NULL.
+ * @retval  SSP_ERR_NOT_OPEN            The framework is not open.
+ * @return                              See @ref Common_Error_Codes or functions called by this function for other
+ *                                      possible return codes. This function calls:
+ *                                      * pdc_api_t::captureStop
+ **********************************************************************************************************************/
+ssp_err_t SF_CAMERA_JPEG_Stop (sf_camera_jpeg_ctrl_t * const p_api_ctrl)
+{
+    sf_camera_jpeg_instance_ctrl_t * p_ctrl = (sf_camera_jpeg_instance_ctrl_t *) p_api_ctrl;
+
+#if SF_CAMERA_JPEG_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+#endif
+    SF_CAMERA_JPEG_ERROR_RETURN(SF_CAMERA_JPEG_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+
+    /** Stop the PDC first so no more bands arrive, then let the pump drop the frame in progress. */
+    ssp_err_t err = p_ctrl->p_pdc->p_api->captureStop(p_ctrl->p_pdc->p_ctrl);
+    p_ctrl->running = false;
+    sf_camera_jpeg_pump(p_ctrl);
+    SF_CAMERA_JPEG_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Return the oldest completed frame's space in the output ring.
+ *
+ *  Implements sf_camera_jpeg_api_t::frameRelease
+ *
+ * @retval  SSP_SUCCESS                 The frame's space may be used for new frames.
+ * @retval  SSP_ERR_ASSERTION           p_api_ctrl is NULL.
+ * @retval  SSP_ERR_NOT_OPEN            The framework is not open.
+ * @retval  SSP_ERR_INVALID_CALL        No completed frame is held in the output ring.
+ *
+ * @note This function may be called from the callback.
+ **********************************************************************************************************************/
+ssp_err_t SF_CAMERA_JPEG_FrameRelease (sf_camera_jpeg_ctrl_t * const p_api_ctrl)
+{
+    sf_camera_jpeg_instance_ctrl_t * p_ctrl = (sf_camera_jpeg_instance_ctrl_t *) p_api_ctrl;
+    ssp_err_t err = SSP_SUCCESS;
+
+#if SF_CAMERA_JPEG_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+#endif
+    SF_CAMERA_JPEG_ERROR_RETURN(SF_CAMERA_JPEG_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+
+    /** The pump reserves output space from interrupts, so update the ring with interrupts masked. */
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    if (0U == p_ctrl->frame_count)
+    {
+        err = SSP_ERR_INVALID_CALL;
+    }
+    else
+    {
+        p_ctrl->frame_head = (p_ctrl->frame_head + 1U) % SF_CAMERA_JPEG_FRAMES_MAX;
+        p_ctrl->frame_count--;
+    }
+    SSP_CRITICAL_SECTION_EXIT;
+
+    SF_CAMERA_JPEG_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Stop capturing and close the PDC and the JPEG encoder.
+ *
+ *  Implements sf_camera_jpeg_api_t::close
+ *
+ * @retval  SSP_SUCCESS                 The framework is closed.
+ * @retval  SSP_ERR_ASSERTION           p_api_ctrl is NULL.
+ * @retval  SSP_ERR_NOT_OPEN            The framework is not open.
+ * @return                              See @ref Common_Error_Codes or functions called by this function for other
+ *                                      possible return codes. This function calls:
+ *                                      * pdc_api_t::captureStop
+ *                                      * pdc_api_t::close
+ *                                      * jpeg_encode_api_t::close
+ **********************************************************************************************************************/
+ssp_err_t SF_CAMERA_JPEG_Close (sf_camera_jpeg_ctrl_t * const p_api_ctrl)
+{
+    sf_camera_jpeg_instance_ctrl_t * p_ctrl = (sf_camera_jpeg_instance_ctrl_t *) p_api_ctrl;
+
+#if SF_CAMERA_JPEG_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+#endif
+    SF_CAMERA_JPEG_ERROR_RETURN(SF_CAMERA_JPEG_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+
+    (void) SF_CAMERA_JPEG_Stop(p_ctrl);
+
+    p_ctrl->open = 0U;
+
+    /** The encoder may already be closed by a failed restart. */
+    (void) p_ctrl->p_jpeg->p_api->close(p_ctrl->p_jpeg->p_ctrl);
+    ssp_err_t err = p_ctrl->p_pdc->p_api->close(p_ctrl->p_pdc->p_ctrl);
+    SF_CAMERA_JPEG_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Get the framework version based on compile time macros.
+ *
+ *  Implements sf_camera_jpeg_api_t::versionGet
+ *
+ * @retval  SSP_SUCCESS                 Version stored in p_version.
+ * @retval  SSP_ERR_ASSERTION           p_version is NULL.
+ **********************************************************************************************************************/
+ssp_err_t SF_CAMERA_JPEG_VersionGet (ssp_version_t * const p_version)
+{
+#if SF_CAMERA_JPEG_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_version);
+#endif
+
+    p_version->version_id = g_sf_camera_jpeg_version.version_id;
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup SF_CAMERA_JPEG)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+#if SF_CAMERA_JPEG_CFG_PARAM_CHECKING_ENABLE
+/*******************************************************************************************************************//**
+ * @brief  Parameter check for SF_CAMERA_JPEG_Open.
+ * @param[in]  p_ctrl   Control block.
+ * @param[in]  p_cfg    Configuration.
+ **********************************************************************************************************************/
+static ssp_err_t sf_camera_jpeg_open_param_check (sf_camera_jpeg_instance_ctrl_t * const p_ctrl,
+                                                  sf_camera_jpeg_cfg_t const * const p_cfg)
+{
+    SSP_ASSERT(NULL != p_ctrl);
+    SSP_ASSERT(NULL != p_cfg);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_pdc);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_pdc->p_cfg);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_pdc->p_api);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_jpeg);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_jpeg->p_cfg);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_jpeg->p_api);
+    SSP_ASSERT(NULL != p_cfg->pp_band_buffers);
+    SSP_ASSERT(NULL != p_cfg->p_output_buffer);
+    SF_CAMERA_JPEG_ERROR_RETURN(SF_CAMERA_JPEG_OPEN != p_ctrl->open, SSP_ERR_IN_USE);
+
+    pdc_cfg_t const         * p_pdc_cfg  = p_cfg->p_lower_lvl_pdc->p_cfg;
+    jpeg_encode_cfg_t const * p_jpeg_cfg = p_cfg->p_lower_lvl_jpeg->p_cfg;
+
+    /** The encoder takes the PDC frame as it is captured. */
+    SF_CAMERA_JPEG_ERROR_RETURN(SF_CAMERA_JPEG_PRV_BYTES_PER_PIXEL == p_pdc_cfg->bytes_per_pixel,
+                                SSP_ERR_INVALID_ARGUMENT);
+    SF_CAMERA_JPEG_ERROR_RETURN(p_pdc_cfg->x_capture_pixels == p_jpeg_cfg->horizontal_resolution,
+                                SSP_ERR_INVALID_ARGUMENT);
+    SF_CAMERA_JPEG_ERROR_RETURN(p_pdc_cfg->y_capture_pixels == p_jpeg_cfg->vertical_resolution,
+                                SSP_ERR_INVALID_ARGUMENT);
+
+    /** Bands are whole rows of minimum coded units. */
+    SF_CAMERA_JPEG_ERROR_RETURN((0U != p_cfg->band_lines) &&
+                                (0U == (p_cfg->band_lines % SF_CAMERA_JPEG_PRV_MCU_LINES)) &&
+                                (p_cfg->band_lines <= p_pdc_cfg->y_capture_pixels), SSP_ERR_INVALID_ARGUMENT);
+    SF_CAMERA_JPEG_ERROR_RETURN((p_cfg->num_band_buffers >= 2U) &&
+                                (p_cfg->num_band_buffers <= SF_CAMERA_JPEG_BANDS_MAX), SSP_ERR_INVALID_ARGUMENT);
+    for (uint32_t i = 0U; i < p_cfg->num_band_buffers; i++)
+    {
+        SSP_ASSERT(NULL != p_cfg->pp_band_buffers[i]);
+        SF_CAMERA_JPEG_ERROR_RETURN(0U == ((uintptr_t) p_cfg->pp_band_buffers[i] % SF_CAMERA_JPEG_PRV_ALIGN),
+                                    SSP_ERR_INVALID_ALIGNMENT);
+    }
+
+    /** A frame must fit in the output ring. */
+    SF_CAMERA_JPEG_ERROR_RETURN(0U == ((uintptr_t) p_cfg->p_output_buffer % SF_CAMERA_JPEG_PRV_ALIGN),
+                                SSP_ERR_INVALID_ALIGNMENT);
+    SF_CAMERA_JPEG_ERROR_RETURN((0U != p_cfg->output_frame_max) &&
+                                (p_cfg->output_frame_max <= p_cfg->output_buffer_size), SSP_ERR_INVALID_ARGUMENT);
+
+    return SSP_SUCCESS;
+}
+#endif
+
+/*******************************************************************************************************************//**
+ * @brief  PDC callback. Queues completed bands for the encoder and stops on capture errors.
+ * @param[in]  p_args   PDC callback arguments.
+ **********************************************************************************************************************/
+static void sf_camera_jpeg_pdc_callback (pdc_callback_args_t * p_args)
+{
+    sf_camera_jpeg_instance_ctrl_t * p_ctrl = (sf_camera_jpeg_instance_ctrl_t *) p_args->p_context;
+
+    if (PDC_EVENT_BAND_COMPLETE == p_args->event)
+    {
+        /* There is a queue entry for every band buffer, so the queue cannot overflow. */
+        SSP_CRITICAL_SECTION_DEFINE;
+        SSP_CRITICAL_SECTION_ENTER;
+        sf_camera_jpeg_band_t * p_band =
+            &p_ctrl->bands[(p_ctrl->band_head + p_ctrl->band_count) % SF_CAMERA_JPEG_BANDS_MAX];
+        p_band->p_buffer  = p_args->p_buffer;
+        p_band->frame     = p_args->frame;
+        p_band->line      = p_args->line;
+        p_band->lines     = p_args->lines;
+        p_band->dropped   = p_args->dropped;
+        p_band->timestamp = p_args->timestamp;
+        p_ctrl->band_count++;
+        SSP_CRITICAL_SECTION_EXIT;
+    }
+    else if (0U != ((uint32_t) p_args->event & SF_CAMERA_JPEG_PRV_PDC_ERRORS))
+    {
+        /* The PDC has already stopped the capture. */
+        p_ctrl->pdc_event |= (uint32_t) p_args->event;
+        p_ctrl->running    = false;
+    }
+    else
+    {
+        return;
+    }
+
+    sf_camera_jpeg_pump(p_ctrl);
+}
+
+/*******************************************************************************************************************//**
+ * @brief  JPEG encoder callback. Records that the encoder has read a band or finished the frame.
+ * @param[in]  p_args   JPEG encoder callback arguments.
+ **********************************************************************************************************************/
+static void sf_camera_jpeg_encode_callback (jpeg_encode_callback_args_t * p_args)
+{
+    sf_camera_jpeg_instance_ctrl_t * p_ctrl = (sf_camera_jpeg_instance_ctrl_t *) p_args->p_context;
+
+    if (0U == ((uint32_t) p_args->status & ((uint32_t) JPEG_ENCODE_STATUS_DONE |
+                                            (uint32_t) JPEG_ENCODE_STATUS_INPUT_PAUSE)))
+    {
+        return;
+    }
+
+    p_ctrl->encoded_size   = p_args->image_size;
+    p_ctrl->encoder_status = p_args->status;
+
+    sf_camera_jpeg_pump(p_ctrl);
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Runs sf_camera_jpeg_process until no new work is reported. The PDC and encoder interrupts, and the stop
+ * call, may each find work; only one of them processes it at a time, and a nested call only asks the running one to
+ * make another pass.
+ * @param[in]  p_ctrl   Control block.
+ **********************************************************************************************************************/
+static void sf_camera_jpeg_pump (sf_camera_jpeg_instance_ctrl_t * const p_ctrl)
+{
+    bool owner;
+
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    owner              = !p_ctrl->pumping;
+    p_ctrl->pumping    = true;
+    p_ctrl->pump_again = true;
+    SSP_CRITICAL_SECTION_EXIT;
+
+    while (owner)
+    {
+        /* Work reported before this point is seen by this pass. */
+        p_ctrl->pump_again = false;
+
+        sf_camera_jpeg_process(p_ctrl);
+
+        SSP_CRITICAL_SECTION_ENTER;
+        if (!p_ctrl->pump_again)
+        {
+            p_ctrl->pumping = false;
+            owner           = false;
+        }
+        SSP_CRITICAL_SECTION_EXIT;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Handles encoder progress and capture errors, then passes waiting bands to the encoder.
+ * @param[in]  p_ctrl   Control block.
+ **********************************************************************************************************************/
+static void sf_camera_jpeg_process (sf_camera_jpeg_instance_ctrl_t * const p_ctrl)
+{
+    jpeg_encode_status_t status;
+    uint32_t             pdc_event;
+
+    /** Take the encoder and PDC events reported since the last pass. */
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    status                 = p_ctrl->encoder_status;
+    p_ctrl->encoder_status = JPEG_ENCODE_STATUS_FREE;
+    pdc_event              = p_ctrl->pdc_event;
+    p_ctrl->pdc_event      = 0U;
+    SSP_CRITICAL_SECTION_EXIT;
+
+    if (!p_ctrl->running)
+    {
+        sf_camera_jpeg_teardown(p_ctrl, pdc_event);
+        return;
+    }
+
+    if (JPEG_ENCODE_STATUS_FREE != status)
+    {
+        sf_camera_jpeg_encoder_progress(p_ctrl, status);
+    }
+
+    sf_camera_jpeg_feed(p_ctrl);
+}
+
+/*******************************************************************************************************************//**
+ * @brief  The encoder has read the band passed to it. Returns the band buffer to the PDC and passes the new encoded
+ * data to the callback.
+ * @param[in]  p_ctrl   Control block.
+ * @param[in]  status   Encoder status reported by the callback.
+ **********************************************************************************************************************/
+static void sf_camera_jpeg_encoder_progress (sf_camera_jpeg_instance_ctrl_t * const p_ctrl,
+                                             jpeg_encode_status_t status)
+{
+    uint8_t * p_band = p_ctrl->p_encoding;
+    uint32_t  size   = p_ctrl->encoded_size;
+
+    p_ctrl->p_encoding = NULL;
+    if (NULL != p_band)
+    {
+        (void) p_ctrl->p_pdc->p_api->bufferRelease(p_ctrl->p_pdc->p_ctrl, p_band);
+    }
+
+    if (!p_ctrl->in_frame)
+    {
+        return;
+    }
+
+    /** The encoder has written past the space reserved for the frame. */
+    if (size > p_ctrl->output_frame_max)
+    {
+        sf_camera_jpeg_frame_drop(p_ctrl);
+        return;
+    }
+
+    if (0U != ((uint32_t) status & (uint32_t) JPEG_ENCODE_STATUS_DONE))
+    {
+        /** Keep the frame in the output ring until it is released. */
+        SSP_CRITICAL_SECTION_DEFINE;
+        SSP_CRITICAL_SECTION_ENTER;
+        sf_camera_jpeg_frame_t * p_frame =
+            &p_ctrl->frames[(p_ctrl->frame_head + p_ctrl->frame_count) % SF_CAMERA_JPEG_FRAMES_MAX];
+        p_frame->start = p_ctrl->frame_start;
+        p_frame->end   = p_ctrl->frame_start + ((size + (SF_CAMERA_JPEG_PRV_ALIGN - 1U)) &
+                                                ~(SF_CAMERA_JPEG_PRV_ALIGN - 1U));
+        p_ctrl->frame_count++;
+        SSP_CRITICAL_SECTION_EXIT;
+
+        p_ctrl->in_frame = false;
+        sf_camera_jpeg_output_publish(p_ctrl, SF_CAMERA_JPEG_EVENT_FRAME_COMPLETE, size);
+    }
+    else
+    {
+        /** The count of encoded bytes may include the start of an 8 byte unit not written yet. */
+        sf_camera_jpeg_output_publish(p_ctrl, SF_CAMERA_JPEG_EVENT_DATA, size & ~(SF_CAMERA_JPEG_PRV_ALIGN - 1U));
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Passes waiting bands to the encoder while it is ready for input. Starts a frame at its first band and drops
+ * the frame being encoded when one of its bands is missing.
+ * @param[in]  p_ctrl   Control block.
+ **********************************************************************************************************************/
+static void sf_camera_jpeg_feed (sf_camera_jpeg_instance_ctrl_t * const p_ctrl)
+{
+    while (p_ctrl->running && (NULL == p_ctrl->p_encoding) && (0U != p_ctrl->band_count))
+    {
+        sf_camera_jpeg_band_t band = p_ctrl->bands[p_ctrl->band_head];
+
+        if (p_ctrl->in_frame && ((band.frame != p_ctrl->frame) || (band.line != p_ctrl->next_line)))
+        {
+            /* The PDC abandoned the frame, the band is looked at again as the start of the next one. */
+            sf_camera_jpeg_frame_drop(p_ctrl);
+            continue;
+        }
+
+        sf_camera_jpeg_band_pop(p_ctrl, &band);
+
+        /** Report the frames the PDC abandoned because the encoder held all band buffers. */
+        for (uint32_t i = band.dropped; i > 0U; i--)
+        {
+            sf_camera_jpeg_callback_call(p_ctrl, SF_CAMERA_JPEG_EVENT_FRAME_DROPPED, band.frame - i, 0U);
+        }
+
+        if ((!p_ctrl->in_frame) && ((0U != band.line) || !sf_camera_jpeg_frame_begin(p_ctrl, &band)))
+        {
+            /* The rest of a dropped frame, or no room for a new one. */
+            (void) p_ctrl->p_pdc->p_api->bufferRelease(p_ctrl->p_pdc->p_ctrl, band.p_buffer);
+            continue;
+        }
+
+        /** Pass the band to the encoder, it resumes from its line count pause or starts the frame. */
+        p_ctrl->p_encoding = band.p_buffer;
+        p_ctrl->next_line += band.lines;
+        ssp_err_t err = p_ctrl->p_jpeg->p_api->inputBufferSet(p_ctrl->p_jpeg->p_ctrl, band.p_buffer,
+                                                              band.lines * p_ctrl->line_bytes);
+        if (SSP_SUCCESS != err)
+        {
+            p_ctrl->p_encoding = NULL;
+            (void) p_ctrl->p_pdc->p_api->bufferRelease(p_ctrl->p_pdc->p_ctrl, band.p_buffer);
+            sf_camera_jpeg_frame_drop(p_ctrl);
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Starts encoding a frame into free space in the output ring.
+ * @param[in]  p_ctrl   Control block.
+ * @param[in]  p_band   First band of the frame.
+ * @retval true   The encoder writes the frame to the output ring.
+ * @retval false  The frame was dropped.
+ **********************************************************************************************************************/
+static bool sf_camera_jpeg_frame_begin (sf_camera_jpeg_instance_ctrl_t * const p_ctrl,
+                                        sf_camera_jpeg_band_t const * const p_band)
+{
+    uint32_t  start = 0U;
+    ssp_err_t err   = SSP_ERR_OVERFLOW;
+
+    if (sf_camera_jpeg_output_reserve(p_ctrl, &start))
+    {
+        err = p_ctrl->p_jpeg->p_api->outputBufferSet(p_ctrl->p_jpeg->p_ctrl, p_ctrl->p_output + start);
+    }
+
+    if (SSP_SUCCESS != err)
+    {
+        sf_camera_jpeg_callback_call(p_ctrl, SF_CAMERA_JPEG_EVENT_FRAME_DROPPED, p_band->frame, 0U);
+        return false;
+    }
+
+    p_ctrl->in_frame    = true;
+    p_ctrl->frame       = p_band->frame;
+    p_ctrl->timestamp   = p_band->timestamp;
+    p_ctrl->next_line   = 0U;
+    p_ctrl->frame_start = start;
+    p_ctrl->published   = 0U;
+
+    return true;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Drops the frame being encoded. The encoder cannot abort a frame, so it is closed and opened again. If it
+ * cannot be opened the capture stops with ::SF_CAMERA_JPEG_EVENT_ERROR.
+ * @param[in]  p_ctrl   Control block.
+ **********************************************************************************************************************/
+static void sf_camera_jpeg_frame_drop (sf_camera_jpeg_instance_ctrl_t * const p_ctrl)
+{
+    jpeg_encode_instance_t const * p_jpeg = p_ctrl->p_jpeg;
+
+    p_ctrl->in_frame = false;
+
+    (void) p_jpeg->p_api->close(p_jpeg->p_ctrl);
+    ssp_err_t err = p_jpeg->p_api->open(p_jpeg->p_ctrl, &p_ctrl->jpeg_cfg);
+
+    /* Progress reported for the dropped frame no longer applies. */
+    p_ctrl->encoder_status = JPEG_ENCODE_STATUS_FREE;
+
+    sf_camera_jpeg_callback_call(p_ctrl, SF_CAMERA_JPEG_EVENT_FRAME_DROPPED, p_ctrl->frame, 0U);
+
+    if (SSP_SUCCESS != err)
+    {
+        (void) p_ctrl->p_pdc->p_api->captureStop(p_ctrl->p_pdc->p_ctrl);
+        p_ctrl->running    = false;
+        p_ctrl->band_count = 0U;
+        sf_camera_jpeg_callback_call(p_ctrl, SF_CAMERA_JPEG_EVENT_ERROR, p_ctrl->frame, 0U);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Cleans up after the capture stopped. The PDC owns no band buffers any more, so waiting bands are discarded.
+ * @param[in]  p_ctrl      Control block.
+ * @param[in]  pdc_event   PDC error events that stopped the capture, 0 if it was stopped by the application.
+ **********************************************************************************************************************/
+static void sf_camera_jpeg_teardown (sf_camera_jpeg_instance_ctrl_t * const p_ctrl, uint32_t pdc_event)
+{
+    if (p_ctrl->in_frame)
+    {
+        sf_camera_jpeg_frame_drop(p_ctrl);
+    }
+
+    p_ctrl->p_encoding = NULL;
+    p_ctrl->band_count = 0U;
+
+    if (0U != pdc_event)
+    {
+        sf_camera_jpeg_callback_call(p_ctrl, SF_CAMERA_JPEG_EVENT_ERROR, p_ctrl->frame, pdc_event);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Finds contiguous space for a frame after the newest completed frame. The ring wraps to its start when the
+ * space at its end is too small.
+ * @param[in]   p_ctrl    Control block.
+ * @param[out]  p_start   Offset of the space in the output ring.
+ * @retval true   output_frame_max bytes are free at p_start.
+ * @retval false  The output ring is full.
+ **********************************************************************************************************************/
+static bool sf_camera_jpeg_output_reserve (sf_camera_jpeg_instance_ctrl_t * const p_ctrl, uint32_t * p_start)
+{
+    bool     reserved = true;
+    uint32_t max      = p_ctrl->output_frame_max;
+
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    if (0U == p_ctrl->frame_count)
+    {
+        *p_start = 0U;
+    }
+    else if (SF_CAMERA_JPEG_FRAMES_MAX == p_ctrl->frame_count)
+    {
+        reserved = false;
+    }
+    else
+    {
+        uint32_t oldest = p_ctrl->frames[p_ctrl->frame_head].start;
+        uint32_t end    =
+            p_ctrl->frames[(p_ctrl->frame_head + p_ctrl->frame_count - 1U) % SF_CAMERA_JPEG_FRAMES_MAX].end;
+
+        if ((end > oldest) && ((p_ctrl->output_size - end) >= max))
+        {
+            /* Frames are held in [oldest, end), space after them. */
+            *p_start = end;
+        }
+        else if ((end > oldest) && (oldest >= max))
+        {
+            /* Frames are held in [oldest, end), space at the start of the ring. */
+            *p_start = 0U;
+        }
+        else if ((end <= oldest) && ((oldest - end) >= max))
+        {
+            /* Frames are held in [oldest, size) and [0, end), space between them. */
+            *p_start = end;
+        }
+        else
+        {
+            reserved = false;
+        }
+    }
+    SSP_CRITICAL_SECTION_EXIT;
+
+    return reserved;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Passes the encoded data of the current frame written since the last call to the callback.
+ * @param[in]  p_ctrl   Control block.
+ * @param[in]  event    ::SF_CAMERA_JPEG_EVENT_DATA or ::SF_CAMERA_JPEG_EVENT_FRAME_COMPLETE.
+ * @param[in]  size     Bytes of the frame written so far.
+ **********************************************************************************************************************/
+static void sf_camera_jpeg_output_publish (sf_camera_jpeg_instance_ctrl_t * const p_ctrl,
+                                           sf_camera_jpeg_event_t event, uint32_t size)
+{
+    sf_camera_jpeg_callback_args_t args;
+
+    if ((NULL == p_ctrl->p_callback) || ((SF_CAMERA_JPEG_EVENT_DATA == event) && (size <= p_ctrl->published)))
+    {
+        p_ctrl->published = size;
+        return;
+    }
+
+    args.event      = event;
+    args.p_frame    = p_ctrl->p_output + p_ctrl->frame_start;
+    args.p_data     = args.p_frame + p_ctrl->published;
+    args.length     = size - p_ctrl->published;
+    args.frame_size = size;
+    args.frame      = p_ctrl->frame;
+    args.timestamp  = p_ctrl->timestamp;
+    args.pdc_event  = (pdc_event_t) 0U;
+    args.p_context  = p_ctrl->p_context;
+
+    p_ctrl->published = size;
+    p_ctrl->p_callback(&args);
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Removes the oldest band from the queue.
+ * @param[in]   p_ctrl   Control block.
+ * @param[out]  p_band   The band removed.
+ **********************************************************************************************************************/
+static void sf_camera_jpeg_band_pop (sf_camera_jpeg_instance_ctrl_t * const p_ctrl,
+                                     sf_camera_jpeg_band_t * const p_band)
+{
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    *p_band            = p_ctrl->bands[p_ctrl->band_head];
+    p_ctrl->band_head  = (p_ctrl->band_head + 1U) % SF_CAMERA_JPEG_BANDS_MAX;
+    p_ctrl->band_count--;
+    SSP_CRITICAL_SECTION_EXIT;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Calls the user callback with an event that carries no encoded data.
+ * @param[in]  p_ctrl      Control block.
+ * @param[in]  event       Event to report.
+ * @param[in]  frame       PDC sequence number of the frame the event refers to.
+ * @param[in]  pdc_event   PDC error events for ::SF_CAMERA_JPEG_EVENT_ERROR.
+ **********************************************************************************************************************/
+static void sf_camera_jpeg_callback_call (sf_camera_jpeg_instance_ctrl_t * const p_ctrl,
+                                          sf_camera_jpeg_event_t event, uint32_t frame, uint32_t pdc_event)
+{
+    sf_camera_jpeg_callback_args_t args;
+
+    if (NULL != p_ctrl->p_callback)
+    {
+        args.event      = event;
+        args.p_data     = NULL;
+        args.length     = 0U;
+        args.p_frame    = NULL;
+        args.frame_size = 0U;
+        args.frame      = frame;
+        args.timestamp  = 0U;
+        args.pdc_event  = (pdc_event_t) pdc_event;
+        args.p_context  = p_ctrl->p_context;
+        p_ctrl->p_callback(&args);
+    }
+}
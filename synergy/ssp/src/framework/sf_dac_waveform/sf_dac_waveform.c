@@ -0,0 +1,632 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : sf_dac_waveform.c
+ * Description  : DAC waveform generator framework. A timer paces DTC writes of a sample table to the DAC, and chained
+ *                descriptors switch to a queued table at the end of each period.
+ **********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "sf_dac_waveform.h"
+#include "sf_dac_waveform_private_api.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/** "DACW" in ASCII, used to determine if the framework is open. */
+#define SF_DAC_WAVEFORM_OPEN                 (0x44414357ULL)
+
+/** Shortest table. With one sample the sample descriptor is always one transfer from the end of the period, which
+ *  leaves no safe time to queue a table. */
+#define SF_DAC_WAVEFORM_PRV_LENGTH_MIN       (2U)
+
+/** Descriptors in the chain: the samples, the queued table address and the queued length. */
+#define SF_DAC_WAVEFORM_PRV_DESC_SAMPLES     (0U)
+#define SF_DAC_WAVEFORM_PRV_DESC_ADDRESS     (1U)
+#define SF_DAC_WAVEFORM_PRV_DESC_LENGTH      (2U)
+
+/** Macro for error logger. */
+#ifndef SF_DAC_WAVEFORM_ERROR_RETURN
+/*LDRA_INSPECTED 77 S This macro does not work when surrounded by parentheses. */
+#define SF_DAC_WAVEFORM_ERROR_RETURN(a, err) SSP_ERROR_RETURN((a), (err), &g_module_name[0], &g_sf_dac_waveform_version)
+#endif
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+#if SF_DAC_WAVEFORM_CFG_PARAM_CHECKING_ENABLE
+static ssp_err_t sf_dac_waveform_open_param_check (sf_dac_waveform_instance_ctrl_t * const p_ctrl,
+                                                   sf_dac_waveform_cfg_t const * const p_cfg);
+static ssp_err_t sf_dac_waveform_table_check (void const * const p_samples, uint16_t length, uint32_t sample_bytes);
+#endif
+static ssp_err_t sf_dac_waveform_lower_lvl_open (sf_dac_waveform_instance_ctrl_t * const p_ctrl,
+                                                 sf_dac_waveform_cfg_t const * const p_cfg,
+                                                 dac_transfer_info_t * const p_dac_info);
+static void      sf_dac_waveform_chain_init (sf_dac_waveform_instance_ctrl_t * const p_ctrl,
+                                             dac_transfer_info_t const * const p_dac_info);
+static void      sf_dac_waveform_active_update (sf_dac_waveform_instance_ctrl_t * const p_ctrl);
+static uint16_t  sf_dac_waveform_cra (uint16_t length);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+#if defined(__GNUC__)
+/* This structure is affected by warnings from the GCC compiler bug https:/gcc.gnu.org/bugzilla/show_bug.cgi?id=60784
+ * This pragma suppresses the warnings in this structure only, and will be removed when the SSP compiler is updated to
+ * v5.3.*/
+/*LDRA_INSPECTED 69 S */
+#pragma GCC diagnostic ignored "-Wmissing-field-initializers"
+#endif
+/** Version data structure used by error logger macro. */
+static const ssp_version_t g_sf_dac_waveform_version =
+{
+    .api_version_minor  = SF_DAC_WAVEFORM_API_VERSION_MINOR,
+    .api_version_major  = SF_DAC_WAVEFORM_API_VERSION_MAJOR,
+    .code_version_major = SF_DAC_WAVEFORM_CODE_VERSION_MAJOR,
+    .code_version_minor = SF_DAC_WAVEFORM_CODE_VERSION_MINOR
+};
+#if defined(__GNUC__)
+/* Restore warning settings for 'missing-field-initializers' to as specified on command line. */
+/*LDRA_INSPECTED 69 S */
+#pragma GCC diagnostic pop
+#endif
+
+/** Name of module used by error logger macro */
+#if BSP_CFG_ERROR_LOG != 0
+static const char g_module_name[] = "sf_dac_waveform";
+#endif
+
+/** Filled in Interface API structure for this Instance. */
+/*LDRA_INSPECTED 27 D This structure must be accessible in user code. It cannot be static. */
+const sf_dac_waveform_api_t g_sf_dac_waveform_on_sf_dac_waveform =
+{
+    .open       = SF_DAC_WAVEFORM_Open,
+    .start      = SF_DAC_WAVEFORM_Start,
+    .stop       = SF_DAC_WAVEFORM_Stop,
+    .tableSet   = SF_DAC_WAVEFORM_TableSet,
+    .statusGet  = SF_DAC_WAVEFORM_StatusGet,
+    .close      = SF_DAC_WAVEFORM_Close,
+    .versionGet = SF_DAC_WAVEFORM_VersionGet
+};
+
+/** @addtogroup SF_DAC_WAVEFORM
+ * @{
+ */
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @brief  Open and start the DAC, open the timer and set up the DTC chain that plays the table.
+ *
+ *  Implements sf_dac_waveform_api_t::open
+ *
+ *  The DTC is activated by the timer counter overflow event. Its transfer information is supplied by the framework,
+ *  the p_info of the transfer instance is not used. The output starts with sf_dac_waveform_api_t::start.
+ *
+ * @retval  SSP_SUCCESS                 The framework is open and ready to start.
+ * @retval  SSP_ERR_ASSERTION           A pointer argument or a lower level instance is NULL.
+ * @retval  SSP_ERR_IN_USE              The framework is already open.
+ * @retval  SSP_ERR_INVALID_SIZE        The table length is out of range.
+ * @retval  SSP_ERR_INVALID_ALIGNMENT   The table is not aligned to the sample size.
+ * @return                              See @ref Common_Error_Codes or functions called by this function for other
+ *                                      possible return codes. This function calls:
+ *                                      * dac_api_t::open
+ *                                      * dac_api_t::transferInfoGet
+ *                                      * dac_api_t::start
+ *                                      * timer_api_t::open
+ *                                      * timer_api_t::infoGet
+ *                                      * transfer_api_t::open
+ **********************************************************************************************************************/
+ssp_err_t SF_DAC_WAVEFORM_Open (sf_dac_waveform_ctrl_t * const p_api_ctrl, sf_dac_waveform_cfg_t const * const p_cfg)
+{
+    sf_dac_waveform_instance_ctrl_t * p_ctrl = (sf_dac_waveform_instance_ctrl_t *) p_api_ctrl;
+    ssp_err_t           err = SSP_SUCCESS;
+    dac_transfer_info_t dac_info;
+
+#if SF_DAC_WAVEFORM_CFG_PARAM_CHECKING_ENABLE
+    err = sf_dac_waveform_open_param_check(p_ctrl, p_cfg);
+    SF_DAC_WAVEFORM_ERROR_RETURN(SSP_SUCCESS == err, err);
+#endif
+
+    p_ctrl->p_next        = p_cfg->p_samples;
+    p_ctrl->next_length   = p_cfg->length;
+    p_ctrl->next_cra      = sf_dac_waveform_cra(p_cfg->length);
+    p_ctrl->p_active      = p_cfg->p_samples;
+    p_ctrl->active_length = p_cfg->length;
+    p_ctrl->running       = false;
+
+    err = sf_dac_waveform_lower_lvl_open(p_ctrl, p_cfg, &dac_info);
+    SF_DAC_WAVEFORM_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    p_ctrl->open = SF_DAC_WAVEFORM_OPEN;
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Start the output from the first sample of the newest table.
+ *
+ *  Implements sf_dac_waveform_api_t::start
+ *
+ *  The first sample is written one timer period after this call. A table queued while the output was stopped
+ *  starts right away.
+ *
+ * @retval  SSP_SUCCESS                 The output is started.
+ * @retval  SSP_ERR_ASSERTION           p_api_ctrl is NULL.
+ * @retval  SSP_ERR_NOT_OPEN            The framework is not open.
+ * @retval  SSP_ERR_IN_USE              The output is already started.
+ * @return                              See @ref Common_Error_Codes or functions called by this function for other
+ *                                      possible return codes. This function calls:
+ *                                      * transfer_api_t::reset
+ *                                      * timer_api_t::start
+ **********************************************************************************************************************/
+ssp_err_t SF_DAC_WAVEFORM_Start (sf_dac_waveform_ctrl_t * const p_api_ctrl)
+{
+    sf_dac_waveform_instance_ctrl_t * p_ctrl = (sf_dac_waveform_instance_ctrl_t *) p_api_ctrl;
+
+#if SF_DAC_WAVEFORM_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+#endif
+    SF_DAC_WAVEFORM_ERROR_RETURN(SF_DAC_WAVEFORM_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+    SF_DAC_WAVEFORM_ERROR_RETURN(!p_ctrl->running, SSP_ERR_IN_USE);
+
+    /** The DTC is disabled while stopped, so the sample descriptor can be rewritten. The reset sets the source and
+     *  enables the DTC with read skip handled by the transfer driver. */
+    p_ctrl->desc[SF_DAC_WAVEFORM_PRV_DESC_SAMPLES].length = p_ctrl->next_cra;
+    p_ctrl->p_active      = p_ctrl->p_next;
+    p_ctrl->active_length = p_ctrl->next_length;
+
+    transfer_instance_t const * p_transfer = p_ctrl->p_transfer;
+    ssp_err_t err = p_transfer->p_api->reset(p_transfer->p_ctrl, p_ctrl->p_next, NULL, p_ctrl->next_length);
+    SF_DAC_WAVEFORM_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    err = p_ctrl->p_timer->p_api->start(p_ctrl->p_timer->p_ctrl);
+    if (SSP_SUCCESS != err)
+    {
+        p_transfer->p_api->disable(p_transfer->p_ctrl);
+    }
+    SF_DAC_WAVEFORM_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    p_ctrl->running = true;
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Stop the output. The DAC holds the last sample written.
+ *
+ *  Implements sf_dac_waveform_api_t::stop
+ *
+ * @retval  SSP_SUCCESS                 The output is stopped.
+ * @retval  SSP_ERR_ASSERTION           p_api_ctrl is NULL.
+ * @retval  SSP_ERR_NOT_OPEN            The framework is not open.
+ * @return                              See @ref Common_Error_Codes or functions called by this function for other
+ *                                      possible return codes. This function calls:
+ *                                      * timer_api_t::stop
+ *                                      * transfer_api_t::disable
+ **********************************************************************************************************************/
+ssp_err_t SF_DAC_WAVEFORM_Stop (sf_dac_waveform_ctrl_t * const p_api_ctrl)
+{
+    sf_dac_waveform_instance_ctrl_t * p_ctrl = (sf_dac_waveform_instance_ctrl_t *) p_api_ctrl;
+
+#if SF_DAC_WAVEFORM_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+#endif
+    SF_DAC_WAVEFORM_ERROR_RETURN(SF_DAC_WAVEFORM_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+
+    ssp_err_t err = p_ctrl->p_timer->p_api->stop(p_ctrl->p_timer->p_ctrl);
+    SF_DAC_WAVEFORM_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    /** Record a swap the chain made before the timer stopped, then disable the DTC. */
+    sf_dac_waveform_active_update(p_ctrl);
+    p_ctrl->running = false;
+
+    err = p_ctrl->p_transfer->p_api->disable(p_ctrl->p_transfer->p_ctrl);
+    SF_DAC_WAVEFORM_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Queue a table to start after the last sample of the current period.
+ *
+ *  Implements sf_dac_waveform_api_t::tableSet
+ *
+ *  The queued address and length are copied into the sample descriptor by the DTC when it returns to the start of
+ *  the table. Both are written while the sample descriptor has at least two transfers left, so the copy never sees
+ *  one without the other. If this is called during the last sample period of a table, it waits for that period to
+ *  end.
+ *
+ * @retval  SSP_SUCCESS                 The table is queued.
+ * @retval  SSP_ERR_ASSERTION           p_api_ctrl or p_samples is NULL.
+ * @retval  SSP_ERR_NOT_OPEN            The framework is not open.
+ * @retval  SSP_ERR_INVALID_SIZE        The table length is out of range.
+ * @retval  SSP_ERR_INVALID_ALIGNMENT   The table is not aligned to the sample size.
+ **********************************************************************************************************************/
+ssp_err_t SF_DAC_WAVEFORM_TableSet (sf_dac_waveform_ctrl_t * const p_api_ctrl, void const * const p_samples,
+                                    uint16_t length)
+{
+    sf_dac_waveform_instance_ctrl_t * p_ctrl = (sf_dac_waveform_instance_ctrl_t *) p_api_ctrl;
+
+#if SF_DAC_WAVEFORM_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+#endif
+    SF_DAC_WAVEFORM_ERROR_RETURN(SF_DAC_WAVEFORM_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+#if SF_DAC_WAVEFORM_CFG_PARAM_CHECKING_ENABLE
+    ssp_err_t err = sf_dac_waveform_table_check(p_samples, length, p_ctrl->sample_bytes);
+    SF_DAC_WAVEFORM_ERROR_RETURN(SSP_SUCCESS == err, err);
+#endif
+
+    uint16_t cra  = sf_dac_waveform_cra(length);
+    bool     done = false;
+
+    SSP_CRITICAL_SECTION_DEFINE;
+    while (!done)
+    {
+        SSP_CRITICAL_SECTION_ENTER;
+
+        /** The low byte of the transfer count is the number of transfers left in the period. */
+        if ((!p_ctrl->running) || (1U != (p_ctrl->desc[SF_DAC_WAVEFORM_PRV_DESC_SAMPLES].length & 0xFFU)))
+        {
+            /** Record a swap that already happened before the queued table is replaced. */
+            sf_dac_waveform_active_update(p_ctrl);
+            p_ctrl->next_cra    = cra;
+            p_ctrl->p_next      = p_samples;
+            p_ctrl->next_length = length;
+            done                = true;
+        }
+
+        SSP_CRITICAL_SECTION_EXIT;
+    }
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Get the table being played and the output position in it.
+ *
+ *  Implements sf_dac_waveform_api_t::statusGet
+ *
+ * @retval  SSP_SUCCESS                 Status stored in p_status.
+ * @retval  SSP_ERR_ASSERTION           p_api_ctrl or p_status is NULL.
+ * @retval  SSP_ERR_NOT_OPEN            The framework is not open.
+ **********************************************************************************************************************/
+ssp_err_t SF_DAC_WAVEFORM_StatusGet (sf_dac_waveform_ctrl_t * const p_api_ctrl,
+                                     sf_dac_waveform_status_t * const p_status)
+{
+    sf_dac_waveform_instance_ctrl_t * p_ctrl = (sf_dac_waveform_instance_ctrl_t *) p_api_ctrl;
+
+#if SF_DAC_WAVEFORM_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+    SSP_ASSERT(NULL != p_status);
+#endif
+    SF_DAC_WAVEFORM_ERROR_RETURN(SF_DAC_WAVEFORM_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+
+    sf_dac_waveform_active_update(p_ctrl);
+
+    /** A count of 0 is 256 transfers. */
+    uint32_t left = p_ctrl->desc[SF_DAC_WAVEFORM_PRV_DESC_SAMPLES].length & 0xFFU;
+    if (0U == left)
+    {
+        left = SF_DAC_WAVEFORM_LENGTH_MAX;
+    }
+
+    p_status->p_samples    = p_ctrl->p_active;
+    p_status->length       = p_ctrl->active_length;
+    p_status->position     = (left <= p_ctrl->active_length) ? (uint16_t) (p_ctrl->active_length - left) : 0U;
+    p_status->swap_pending = (p_ctrl->p_next != p_ctrl->p_active) || (p_ctrl->next_length != p_ctrl->active_length);
+    p_status->running      = p_ctrl->running;
+
+    SSP_CRITICAL_SECTION_EXIT;
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Stop the output and close the timer, transfer and DAC.
+ *
+ *  Implements sf_dac_waveform_api_t::close
+ *
+ * @retval  SSP_SUCCESS                 The framework is closed.
+ * @retval  SSP_ERR_ASSERTION           p_api_ctrl is NULL.
+ * @retval  SSP_ERR_NOT_OPEN            The framework is not open.
+ * @return                              See @ref Common_Error_Codes or functions called by this function for other
+ *                                      possible return codes. This function calls:
+ *                                      * timer_api_t::close
+ *                                      * transfer_api_t::close
+ *                                      * dac_api_t::close
+ **********************************************************************************************************************/
+ssp_err_t SF_DAC_WAVEFORM_Close (sf_dac_waveform_ctrl_t * const p_api_ctrl)
+{
+    sf_dac_waveform_instance_ctrl_t * p_ctrl = (sf_dac_waveform_instance_ctrl_t *) p_api_ctrl;
+
+#if SF_DAC_WAVEFORM_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+#endif
+    SF_DAC_WAVEFORM_ERROR_RETURN(SF_DAC_WAVEFORM_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+
+    p_ctrl->open    = 0U;
+    p_ctrl->running = false;
+
+    /** Close everything even if one of the drivers reports an error, and return the first error. */
+    ssp_err_t err = p_ctrl->p_timer->p_api->close(p_ctrl->p_timer->p_ctrl);
+    ssp_err_t close_err = p_ctrl->p_transfer->p_api->close(p_ctrl->p_transfer->p_ctrl);
+    err = (SSP_SUCCESS == err) ? close_err : err;
+    close_err = p_ctrl->p_dac->p_api->close(p_ctrl->p_dac->p_ctrl);
+    err = (SSP_SUCCESS == err) ? close_err : err;
+
+    SF_DAC_WAVEFORM_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Get the version of the framework.
+ *
+ *  Implements sf_dac_waveform_api_t::versionGet
+ *
+ * @retval  SSP_SUCCESS                 Version is stored in p_version.
+ * @retval  SSP_ERR_ASSERTION           p_version is NULL.
+ **********************************************************************************************************************/
+ssp_err_t SF_DAC_WAVEFORM_VersionGet (ssp_version_t * const p_version)
+{
+#if SF_DAC_WAVEFORM_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_version);
+#endif
+
+    p_version->version_id = g_sf_dac_waveform_version.version_id;
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup SF_DAC_WAVEFORM)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+#if SF_DAC_WAVEFORM_CFG_PARAM_CHECKING_ENABLE
+/*******************************************************************************************************************//**
+ * @brief  Parameter check for SF_DAC_WAVEFORM_Open.
+ * @param[in]  p_ctrl    Control block.
+ * @param[in]  p_cfg     Configuration.
+ **********************************************************************************************************************/
+static ssp_err_t sf_dac_waveform_open_param_check (sf_dac_waveform_instance_ctrl_t * const p_ctrl,
+                                                   sf_dac_waveform_cfg_t const * const p_cfg)
+{
+    SSP_ASSERT(NULL != p_ctrl);
+    SSP_ASSERT(NULL != p_cfg);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_dac);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_dac->p_cfg);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_dac->p_api);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_timer);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_timer->p_cfg);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_timer->p_api);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_transfer);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_transfer->p_cfg);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_transfer->p_api);
+    SF_DAC_WAVEFORM_ERROR_RETURN(SF_DAC_WAVEFORM_OPEN != p_ctrl->open, SSP_ERR_IN_USE);
+
+    /** The sample size is not known before the DAC is open, so only the smallest alignment is checked here. */
+    return sf_dac_waveform_table_check(p_cfg->p_samples, p_cfg->length, 1U);
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Check a table.
+ * @param[in]  p_samples     Table.
+ * @param[in]  length        Samples in the table.
+ * @param[in]  sample_bytes  Size of each sample.
+ **********************************************************************************************************************/
+static ssp_err_t sf_dac_waveform_table_check (void const * const p_samples, uint16_t length, uint32_t sample_bytes)
+{
+    SSP_ASSERT(NULL != p_samples);
+    SF_DAC_WAVEFORM_ERROR_RETURN((SF_DAC_WAVEFORM_PRV_LENGTH_MIN <= length) && (SF_DAC_WAVEFORM_LENGTH_MAX >= length),
+                                 SSP_ERR_INVALID_SIZE);
+    SF_DAC_WAVEFORM_ERROR_RETURN(0U == ((uintptr_t) p_samples % sample_bytes), SSP_ERR_INVALID_ALIGNMENT);
+
+    return SSP_SUCCESS;
+}
+#endif
+
+/*******************************************************************************************************************//**
+ * @brief  Open and start the DAC, open the timer and open the DTC with the framework's chain. The drivers that are
+ *         already open are closed again if a later step fails.
+ * @param[in]  p_ctrl      Control block.
+ * @param[in]  p_cfg       Configuration.
+ * @param[out] p_dac_info  DAC data register information.
+ **********************************************************************************************************************/
+static ssp_err_t sf_dac_waveform_lower_lvl_open (sf_dac_waveform_instance_ctrl_t * const p_ctrl,
+                                                 sf_dac_waveform_cfg_t const * const p_cfg,
+                                                 dac_transfer_info_t * const p_dac_info)
+{
+    dac_instance_t const      * p_dac      = p_cfg->p_lower_lvl_dac;
+    timer_instance_t const    * p_timer    = p_cfg->p_lower_lvl_timer;
+    transfer_instance_t const * p_transfer = p_cfg->p_lower_lvl_transfer;
+    timer_info_t                timer_info;
+
+    p_ctrl->p_dac      = p_dac;
+    p_ctrl->p_timer    = p_timer;
+    p_ctrl->p_transfer = p_transfer;
+
+    /** The DAC output is enabled here, transfers only write the data register. */
+    ssp_err_t err = p_dac->p_api->open(p_dac->p_ctrl, p_dac->p_cfg);
+    SF_DAC_WAVEFORM_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    err = p_dac->p_api->transferInfoGet(p_dac->p_ctrl, p_dac_info);
+    if (SSP_SUCCESS == err)
+    {
+        p_ctrl->sample_bytes = (TRANSFER_SIZE_1_BYTE == p_dac_info->transfer_size) ? 1U : 2U;
+#if SF_DAC_WAVEFORM_CFG_PARAM_CHECKING_ENABLE
+        err = sf_dac_waveform_table_check(p_cfg->p_samples, p_cfg->length, p_ctrl->sample_bytes);
+#endif
+    }
+    if (SSP_SUCCESS == err)
+    {
+        err = p_dac->p_api->start(p_dac->p_ctrl);
+    }
+    if (SSP_SUCCESS != err)
+    {
+        p_dac->p_api->close(p_dac->p_ctrl);
+    }
+    SF_DAC_WAVEFORM_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    /** Each timer overflow writes one sample. */
+    err = p_timer->p_api->open(p_timer->p_ctrl, p_timer->p_cfg);
+    if (SSP_SUCCESS == err)
+    {
+        err = p_timer->p_api->infoGet(p_timer->p_ctrl, &timer_info);
+        if (SSP_SUCCESS != err)
+        {
+            p_timer->p_api->close(p_timer->p_ctrl);
+        }
+    }
+    if (SSP_SUCCESS != err)
+    {
+        p_dac->p_api->close(p_dac->p_ctrl);
+    }
+    SF_DAC_WAVEFORM_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    sf_dac_waveform_chain_init(p_ctrl, p_dac_info);
+
+    p_ctrl->transfer_cfg                   = *p_transfer->p_cfg;
+    p_ctrl->transfer_cfg.p_info            = &p_ctrl->desc[0];
+    p_ctrl->transfer_cfg.activation_source = timer_info.elc_event;
+    p_ctrl->transfer_cfg.auto_enable       = false;
+    p_ctrl->transfer_cfg.p_callback        = NULL;
+    err = p_transfer->p_api->open(p_transfer->p_ctrl, &p_ctrl->transfer_cfg);
+    if (SSP_SUCCESS != err)
+    {
+        p_timer->p_api->close(p_timer->p_ctrl);
+        p_dac->p_api->close(p_dac->p_ctrl);
+    }
+    SF_DAC_WAVEFORM_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Build the descriptor chain.
+ *
+ * The sample descriptor repeats over the table and chains only when its count reloads, at the end of each period.
+ * The next two descriptors each copy one value per activation from the control block into the sample descriptor:
+ * the queued table address into its source and the queued length into its transfer count. When nothing is queued
+ * they copy the values that are already there.
+ *
+ * @param[in]  p_ctrl      Control block with the queued table set.
+ * @param[in]  p_dac_info  DAC data register information.
+ **********************************************************************************************************************/
+static void sf_dac_waveform_chain_init (sf_dac_waveform_instance_ctrl_t * const p_ctrl,
+                                        dac_transfer_info_t const * const p_dac_info)
+{
+    transfer_info_t * p_samples = &p_ctrl->desc[SF_DAC_WAVEFORM_PRV_DESC_SAMPLES];
+    transfer_info_t * p_address = &p_ctrl->desc[SF_DAC_WAVEFORM_PRV_DESC_ADDRESS];
+    transfer_info_t * p_length  = &p_ctrl->desc[SF_DAC_WAVEFORM_PRV_DESC_LENGTH];
+
+    p_samples->mode           = TRANSFER_MODE_REPEAT;
+    p_samples->size           = p_dac_info->transfer_size;
+    p_samples->src_addr_mode  = TRANSFER_ADDR_MODE_INCREMENTED;
+    p_samples->dest_addr_mode = TRANSFER_ADDR_MODE_FIXED;
+    p_samples->repeat_area    = TRANSFER_REPEAT_AREA_SOURCE;
+    p_samples->irq            = TRANSFER_IRQ_END;
+    p_samples->chain_mode     = TRANSFER_CHAIN_MODE_END;
+    p_samples->p_src          = p_ctrl->p_next;
+    p_samples->p_dest         = (void *) p_dac_info->p_address;
+    p_samples->num_blocks     = 0U;
+    p_samples->length         = p_ctrl->next_length;
+
+    p_address->mode           = TRANSFER_MODE_REPEAT;
+    p_address->size           = TRANSFER_SIZE_4_BYTE;
+    p_address->src_addr_mode  = TRANSFER_ADDR_MODE_FIXED;
+    p_address->dest_addr_mode = TRANSFER_ADDR_MODE_FIXED;
+    p_address->repeat_area    = TRANSFER_REPEAT_AREA_SOURCE;
+    p_address->irq            = TRANSFER_IRQ_END;
+    p_address->chain_mode     = TRANSFER_CHAIN_MODE_EACH;
+    p_address->p_src          = (void const *) &p_ctrl->p_next;
+    p_address->p_dest         = (void *) &p_samples->p_src;
+    p_address->num_blocks     = 0U;
+    p_address->length         = 1U;
+
+    p_length->mode            = TRANSFER_MODE_REPEAT;
+    p_length->size            = TRANSFER_SIZE_2_BYTE;
+    p_length->src_addr_mode   = TRANSFER_ADDR_MODE_FIXED;
+    p_length->dest_addr_mode  = TRANSFER_ADDR_MODE_FIXED;
+    p_length->repeat_area     = TRANSFER_REPEAT_AREA_SOURCE;
+    p_length->irq             = TRANSFER_IRQ_END;
+    p_length->chain_mode      = TRANSFER_CHAIN_MODE_DISABLED;
+    p_length->p_src           = (void const *) &p_ctrl->next_cra;
+    p_length->p_dest          = (void *) &p_samples->length;
+    p_length->num_blocks      = 0U;
+    p_length->length          = 1U;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Record the queued table as playing once the chain has copied it into the sample descriptor. The source
+ *         pointer then lies inside the queued table and the reload count matches its length. Called with interrupts
+ *         disabled or from the only context that queues tables.
+ * @param[in]  p_ctrl    Control block.
+ **********************************************************************************************************************/
+static void sf_dac_waveform_active_update (sf_dac_waveform_instance_ctrl_t * const p_ctrl)
+{
+    if ((p_ctrl->p_next == p_ctrl->p_active) && (p_ctrl->next_length == p_ctrl->active_length))
+    {
+        return;
+    }
+
+    /** Read the count before the source, so a chain that runs in between can only delay the result. */
+    transfer_info_t const * p_samples = &p_ctrl->desc[SF_DAC_WAVEFORM_PRV_DESC_SAMPLES];
+    uint32_t  reload = (uint32_t) p_samples->length >> 8;
+    uintptr_t src    = (uintptr_t) p_samples->p_src;
+    uintptr_t start  = (uintptr_t) p_ctrl->p_next;
+    uintptr_t end    = start + ((uintptr_t) p_ctrl->next_length * p_ctrl->sample_bytes);
+
+    if ((reload == ((uint32_t) p_ctrl->next_cra >> 8)) && (src >= start) && (src < end))
+    {
+        p_ctrl->p_active      = p_ctrl->p_next;
+        p_ctrl->active_length = p_ctrl->next_length;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Transfer count of a repeat mode descriptor at the start of a period: the length in both the count and the
+ *         reload count, where 0 stands for 256.
+ * @param[in]  length    Samples in the table.
+ * @return     Value for transfer_info_t::length.
+ **********************************************************************************************************************/
+static uint16_t sf_dac_waveform_cra (uint16_t length)
+{
+    uint32_t count = (uint32_t) length & 0xFFU;
+
+    return (uint16_t) ((count << 8) | count);
+}
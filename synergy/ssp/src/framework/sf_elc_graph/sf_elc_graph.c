@@ -0,0 +1,726 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : sf_elc_graph.c
+ * Description  : ELC event graph framework. Checks a pipeline of ELC connected drivers, then opens, starts and stops
+ *                them as one unit.
+ **********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "sf_elc_graph.h"
+#include "sf_elc_graph_private_api.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/** "ELCG" in ASCII, used to determine if the framework is open. */
+#define SF_ELC_GRAPH_OPEN                 (0x454C4347ULL)
+
+/** Macro for error logger. */
+#ifndef SF_ELC_GRAPH_ERROR_RETURN
+/*LDRA_INSPECTED 77 S This macro does not work when surrounded by parentheses. */
+#define SF_ELC_GRAPH_ERROR_RETURN(a, err) SSP_ERROR_RETURN((a), (err), &g_module_name[0], &g_sf_elc_graph_version)
+#endif
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+#if SF_ELC_GRAPH_CFG_PARAM_CHECKING_ENABLE
+static ssp_err_t sf_elc_graph_open_param_check (sf_elc_graph_instance_ctrl_t * const p_ctrl,
+                                                sf_elc_graph_cfg_t const * const p_cfg);
+#endif
+static ssp_err_t sf_elc_graph_links_check (sf_elc_graph_cfg_t const * const p_cfg);
+static ssp_err_t sf_elc_graph_nodes_check (sf_elc_graph_cfg_t const * const p_cfg);
+static ssp_err_t sf_elc_graph_node_open (sf_elc_graph_node_t const * const p_node);
+static ssp_err_t sf_elc_graph_node_start (sf_elc_graph_node_t const * const p_node);
+static ssp_err_t sf_elc_graph_node_stop (sf_elc_graph_node_t const * const p_node);
+static ssp_err_t sf_elc_graph_node_close (sf_elc_graph_node_t const * const p_node);
+static ssp_err_t sf_elc_graph_stop (sf_elc_graph_instance_ctrl_t * const p_ctrl, uint32_t first, uint32_t count);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+#if defined(__GNUC__)
+/* This structure is affected by warnings from the GCC compiler bug https:/gcc.gnu.org/bugzilla/show_bug.cgi?id=60784
+ * This pragma suppresses the warnings in this structure only, and will be removed when the SSP compiler is updated to
+ * v5.3.*/
+/*LDRA_INSPECTED 69 S */
+#pragma GCC diagnostic ignored "-Wmissing-field-initializers"
+#endif
+/** Version data structure used by error logger macro. */
+static const ssp_version_t g_sf_elc_graph_version =
+{
+    .api_version_minor  = SF_ELC_GRAPH_API_VERSION_MINOR,
+    .api_version_major  = SF_ELC_GRAPH_API_VERSION_MAJOR,
+    .code_version_major = SF_ELC_GRAPH_CODE_VERSION_MAJOR,
+    .code_version_minor = SF_ELC_GRAPH_CODE_VERSION_MINOR
+};
+#if defined(__GNUC__)
+/* Restore warning settings for 'missing-field-initializers' to as specified on command line. */
+/*LDRA_INSPECTED 69 S */
+#pragma GCC diagnostic pop
+#endif
+
+/** Name of module used by error logger macro */
+#if BSP_CFG_ERROR_LOG != 0
+static const char g_module_name[] = "sf_elc_graph";
+#endif
+
+/** ELC configuration without links, used to power on the ELC without changing links owned by other modules. */
+static const elc_cfg_t g_sf_elc_graph_elc_cfg =
+{
+    .autostart  = false,
+    .link_count = 0U,
+    .link_list  = NULL
+};
+
+/** Filled in Interface API structure for this Instance. */
+/*LDRA_INSPECTED 27 D This structure must be accessible in user code. It cannot be static. */
+const sf_elc_graph_api_t g_sf_elc_graph_on_sf_elc_graph =
+{
+    .open       = SF_ELC_GRAPH_Open,
+    .start      = SF_ELC_GRAPH_Start,
+    .stop       = SF_ELC_GRAPH_Stop,
+    .close      = SF_ELC_GRAPH_Close,
+    .versionGet = SF_ELC_GRAPH_VersionGet
+};
+
+/** @addtogroup SF_ELC_GRAPH
+ * @{
+ */
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @brief  Check the graph, power on the ELC and open every node.
+ *
+ *  Implements sf_elc_graph_api_t::open
+ *
+ *  The graph is checked before any driver is opened, so a rejected graph leaves the hardware untouched. If a node
+ *  fails to open, the nodes opened before it are closed.
+ *
+ * @retval  SSP_SUCCESS                 The graph is open and ready to start.
+ * @retval  SSP_ERR_ASSERTION           A pointer argument, a table or an instance in the graph is NULL.
+ * @retval  SSP_ERR_IN_USE              The framework is already open, two links feed the same peripheral or two
+ *                                      transfer nodes have the same activation event.
+ * @retval  SSP_ERR_INVALID_ARGUMENT    A link or transfer node uses an event number that is not defined for the MCU,
+ *                                      a link targets a peripheral that does not exist, a node type is unknown or a
+ *                                      node is configured to start on open or to ignore ELC triggers.
+ * @return                              See @ref Common_Error_Codes or functions called by this function for other
+ *                                      possible return codes. This function calls:
+ *                                      * elc_api_t::init
+ *                                      * timer_api_t::open
+ *                                      * adc_api_t::open
+ *                                      * adc_api_t::scanCfg
+ *                                      * transfer_api_t::open
+ *                                      * dac_api_t::open
+ **********************************************************************************************************************/
+ssp_err_t SF_ELC_GRAPH_Open (sf_elc_graph_ctrl_t * const p_api_ctrl, sf_elc_graph_cfg_t const * const p_cfg)
+{
+    sf_elc_graph_instance_ctrl_t * p_ctrl = (sf_elc_graph_instance_ctrl_t *) p_api_ctrl;
+    ssp_err_t err = SSP_SUCCESS;
+
+#if SF_ELC_GRAPH_CFG_PARAM_CHECKING_ENABLE
+    err = sf_elc_graph_open_param_check(p_ctrl, p_cfg);
+    SF_ELC_GRAPH_ERROR_RETURN(SSP_SUCCESS == err, err);
+#endif
+
+    /** The graph is always checked, because an invalid event number or a shared ELC input or DTC vector would
+     *  silently connect the wrong peripherals. */
+    err = sf_elc_graph_links_check(p_cfg);
+    SF_ELC_GRAPH_ERROR_RETURN(SSP_SUCCESS == err, err);
+    err = sf_elc_graph_nodes_check(p_cfg);
+    SF_ELC_GRAPH_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    err = p_cfg->p_lower_lvl_elc->p_api->init(&g_sf_elc_graph_elc_cfg);
+    SF_ELC_GRAPH_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    uint32_t opened = 0U;
+    while ((SSP_SUCCESS == err) && (opened < p_cfg->node_count))
+    {
+        err = sf_elc_graph_node_open(&p_cfg->p_nodes[opened]);
+        if (SSP_SUCCESS == err)
+        {
+            opened++;
+        }
+    }
+
+    if (SSP_SUCCESS != err)
+    {
+        while (opened > 0U)
+        {
+            opened--;
+            sf_elc_graph_node_close(&p_cfg->p_nodes[opened]);
+        }
+    }
+    SF_ELC_GRAPH_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    p_ctrl->p_nodes    = p_cfg->p_nodes;
+    p_ctrl->node_count = p_cfg->node_count;
+    p_ctrl->p_links    = p_cfg->p_links;
+    p_ctrl->link_count = p_cfg->link_count;
+    p_ctrl->p_elc      = p_cfg->p_lower_lvl_elc;
+    p_ctrl->running    = false;
+    p_ctrl->open       = SF_ELC_GRAPH_OPEN;
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Make the ELC links and start every node, from the last node to the first.
+ *
+ *  Implements sf_elc_graph_api_t::start
+ *
+ *  Interrupts are disabled for the whole sequence, so the pipeline goes from stopped to running without an
+ *  interrupt handler seeing it partly started. If a node fails to start, the nodes already started are stopped and
+ *  the links are broken before returning.
+ *
+ * @retval  SSP_SUCCESS                 The graph is running.
+ * @retval  SSP_ERR_ASSERTION           p_api_ctrl is NULL.
+ * @retval  SSP_ERR_NOT_OPEN            The framework is not open.
+ * @retval  SSP_ERR_IN_USE              The graph is already started.
+ * @return                              See @ref Common_Error_Codes or functions called by this function for other
+ *                                      possible return codes. This function calls:
+ *                                      * elc_api_t::linkSet
+ *                                      * elc_api_t::enable
+ *                                      * timer_api_t::start
+ *                                      * adc_api_t::scanStart
+ *                                      * transfer_api_t::enable
+ *                                      * dac_api_t::start
+ **********************************************************************************************************************/
+ssp_err_t SF_ELC_GRAPH_Start (sf_elc_graph_ctrl_t * const p_api_ctrl)
+{
+    sf_elc_graph_instance_ctrl_t * p_ctrl = (sf_elc_graph_instance_ctrl_t *) p_api_ctrl;
+    ssp_err_t err = SSP_SUCCESS;
+
+#if SF_ELC_GRAPH_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+#endif
+    SF_ELC_GRAPH_ERROR_RETURN(SF_ELC_GRAPH_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+    SF_ELC_GRAPH_ERROR_RETURN(!p_ctrl->running, SSP_ERR_IN_USE);
+
+    elc_api_t const * p_elc_api = p_ctrl->p_elc->p_api;
+
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+
+    for (uint32_t i = 0U; (SSP_SUCCESS == err) && (i < p_ctrl->link_count); i++)
+    {
+        err = p_elc_api->linkSet(p_ctrl->p_links[i].peripheral, p_ctrl->p_links[i].event);
+    }
+    if (SSP_SUCCESS == err)
+    {
+        err = p_elc_api->enable();
+    }
+
+    /** Consumers are started before the nodes that feed them, so the first event finds every stage ready. */
+    uint32_t first = p_ctrl->node_count;
+    while ((SSP_SUCCESS == err) && (first > 0U))
+    {
+        err = sf_elc_graph_node_start(&p_ctrl->p_nodes[first - 1U]);
+        if (SSP_SUCCESS == err)
+        {
+            first--;
+        }
+    }
+
+    if (SSP_SUCCESS == err)
+    {
+        p_ctrl->running = true;
+    }
+    else
+    {
+        sf_elc_graph_stop(p_ctrl, first, p_ctrl->node_count - first);
+    }
+
+    SSP_CRITICAL_SECTION_EXIT;
+
+    SF_ELC_GRAPH_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Stop every node, from the first node to the last, and break the ELC links.
+ *
+ *  Implements sf_elc_graph_api_t::stop
+ *
+ *  Every node is stopped and every link is broken even if one of the drivers reports an error. The ELC itself stays
+ *  enabled, because other modules may use it.
+ *
+ * @retval  SSP_SUCCESS                 The graph is stopped.
+ * @retval  SSP_ERR_ASSERTION           p_api_ctrl is NULL.
+ * @retval  SSP_ERR_NOT_OPEN            The framework is not open.
+ * @return                              See @ref Common_Error_Codes or functions called by this function for other
+ *                                      possible return codes. This function calls:
+ *                                      * timer_api_t::stop
+ *                                      * adc_api_t::scanStop
+ *                                      * transfer_api_t::disable
+ *                                      * dac_api_t::stop
+ *                                      * elc_api_t::linkBreak
+ **********************************************************************************************************************/
+ssp_err_t SF_ELC_GRAPH_Stop (sf_elc_graph_ctrl_t * const p_api_ctrl)
+{
+    sf_elc_graph_instance_ctrl_t * p_ctrl = (sf_elc_graph_instance_ctrl_t *) p_api_ctrl;
+
+#if SF_ELC_GRAPH_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+#endif
+    SF_ELC_GRAPH_ERROR_RETURN(SF_ELC_GRAPH_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+
+    ssp_err_t err = sf_elc_graph_stop(p_ctrl, 0U, p_ctrl->node_count);
+
+    SSP_CRITICAL_SECTION_EXIT;
+
+    SF_ELC_GRAPH_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Stop the graph if it is started and close every node, from the last node to the first.
+ *
+ *  Implements sf_elc_graph_api_t::close
+ *
+ * @retval  SSP_SUCCESS                 The framework is closed.
+ * @retval  SSP_ERR_ASSERTION           p_api_ctrl is NULL.
+ * @retval  SSP_ERR_NOT_OPEN            The framework is not open.
+ * @return                              See @ref Common_Error_Codes or functions called by this function for other
+ *                                      possible return codes. This function calls:
+ *                                      * timer_api_t::close
+ *                                      * adc_api_t::close
+ *                                      * transfer_api_t::close
+ *                                      * dac_api_t::close
+ **********************************************************************************************************************/
+ssp_err_t SF_ELC_GRAPH_Close (sf_elc_graph_ctrl_t * const p_api_ctrl)
+{
+    sf_elc_graph_instance_ctrl_t * p_ctrl = (sf_elc_graph_instance_ctrl_t *) p_api_ctrl;
+    ssp_err_t err = SSP_SUCCESS;
+
+#if SF_ELC_GRAPH_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+#endif
+    SF_ELC_GRAPH_ERROR_RETURN(SF_ELC_GRAPH_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+
+    if (p_ctrl->running)
+    {
+        SSP_CRITICAL_SECTION_DEFINE;
+        SSP_CRITICAL_SECTION_ENTER;
+        err = sf_elc_graph_stop(p_ctrl, 0U, p_ctrl->node_count);
+        SSP_CRITICAL_SECTION_EXIT;
+    }
+
+    p_ctrl->open = 0U;
+
+    /** Close every node even if one of the drivers reports an error, and return the first error. */
+    for (uint32_t i = p_ctrl->node_count; i > 0U; i--)
+    {
+        ssp_err_t close_err = sf_elc_graph_node_close(&p_ctrl->p_nodes[i - 1U]);
+        err = (SSP_SUCCESS == err) ? close_err : err;
+    }
+
+    SF_ELC_GRAPH_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Get the version of the framework.
+ *
+ *  Implements sf_elc_graph_api_t::versionGet
+ *
+ * @retval  SSP_SUCCESS                 Version is stored in p_version.
+ * @retval  SSP_ERR_ASSERTION           p_version is NULL.
+ **********************************************************************************************************************/
+ssp_err_t SF_ELC_GRAPH_VersionGet (ssp_version_t * const p_version)
+{
+#if SF_ELC_GRAPH_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_version);
+#endif
+
+    p_version->version_id = g_sf_elc_graph_version.version_id;
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup SF_ELC_GRAPH)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+#if SF_ELC_GRAPH_CFG_PARAM_CHECKING_ENABLE
+/*******************************************************************************************************************//**
+ * @brief  Parameter check for SF_ELC_GRAPH_Open.
+ * @param[in]  p_ctrl    Control block.
+ * @param[in]  p_cfg     Configuration.
+ **********************************************************************************************************************/
+static ssp_err_t sf_elc_graph_open_param_check (sf_elc_graph_instance_ctrl_t * const p_ctrl,
+                                                sf_elc_graph_cfg_t const * const p_cfg)
+{
+    SSP_ASSERT(NULL != p_ctrl);
+    SSP_ASSERT(NULL != p_cfg);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_elc);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_elc->p_api);
+    SSP_ASSERT((NULL != p_cfg->p_nodes) || (0U == p_cfg->node_count));
+    SSP_ASSERT((NULL != p_cfg->p_links) || (0U == p_cfg->link_count));
+    SF_ELC_GRAPH_ERROR_RETURN(SF_ELC_GRAPH_OPEN != p_ctrl->open, SSP_ERR_IN_USE);
+
+    /** Each node type has its own instance structure, so the pointers are checked for each type. */
+    for (uint32_t i = 0U; i < p_cfg->node_count; i++)
+    {
+        void const * p_instance = p_cfg->p_nodes[i].p_instance;
+        SSP_ASSERT(NULL != p_instance);
+        switch (p_cfg->p_nodes[i].type)
+        {
+            case SF_ELC_GRAPH_NODE_TIMER:
+                SSP_ASSERT(NULL != ((timer_instance_t const *) p_instance)->p_cfg);
+                SSP_ASSERT(NULL != ((timer_instance_t const *) p_instance)->p_api);
+                break;
+
+            case SF_ELC_GRAPH_NODE_ADC:
+                SSP_ASSERT(NULL != ((adc_instance_t const *) p_instance)->p_cfg);
+                SSP_ASSERT(NULL != ((adc_instance_t const *) p_instance)->p_channel_cfg);
+                SSP_ASSERT(NULL != ((adc_instance_t const *) p_instance)->p_api);
+                break;
+
+            case SF_ELC_GRAPH_NODE_TRANSFER:
+                SSP_ASSERT(NULL != ((transfer_instance_t const *) p_instance)->p_cfg);
+                SSP_ASSERT(NULL != ((transfer_instance_t const *) p_instance)->p_api);
+                break;
+
+            case SF_ELC_GRAPH_NODE_DAC:
+                SSP_ASSERT(NULL != ((dac_instance_t const *) p_instance)->p_cfg);
+                SSP_ASSERT(NULL != ((dac_instance_t const *) p_instance)->p_api);
+                break;
+
+            default:
+                /* Unknown types are reported by sf_elc_graph_nodes_check. */
+                break;
+        }
+    }
+
+    return SSP_SUCCESS;
+}
+#endif
+
+/*******************************************************************************************************************//**
+ * @brief  Check the links: defined event numbers, existing peripherals and at most one link for each peripheral.
+ * @param[in]  p_cfg     Configuration.
+ **********************************************************************************************************************/
+static ssp_err_t sf_elc_graph_links_check (sf_elc_graph_cfg_t const * const p_cfg)
+{
+    uint32_t used = 0U;
+
+    for (uint32_t i = 0U; i < p_cfg->link_count; i++)
+    {
+        uint32_t event      = (uint32_t) p_cfg->p_links[i].event;
+        uint32_t peripheral = (uint32_t) p_cfg->p_links[i].peripheral;
+
+        SF_ELC_GRAPH_ERROR_RETURN(BSP_ELC_EVENT_VALID(event), SSP_ERR_INVALID_ARGUMENT);
+        SF_ELC_GRAPH_ERROR_RETURN(BSP_ELC_PERIPHERAL_COUNT > peripheral, SSP_ERR_INVALID_ARGUMENT);
+
+        /** Each peripheral input holds one event, so a second link would replace the first. */
+        SF_ELC_GRAPH_ERROR_RETURN(0U == (used & (1U << peripheral)), SSP_ERR_IN_USE);
+        used |= (1U << peripheral);
+    }
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Check the nodes: known types, no driver that starts on open, ADCs triggered through the ELC and transfer
+ *         activation events that are defined and not shared.
+ * @param[in]  p_cfg     Configuration.
+ **********************************************************************************************************************/
+static ssp_err_t sf_elc_graph_nodes_check (sf_elc_graph_cfg_t const * const p_cfg)
+{
+    for (uint32_t i = 0U; i < p_cfg->node_count; i++)
+    {
+        sf_elc_graph_node_t const * p_node = &p_cfg->p_nodes[i];
+
+        switch (p_node->type)
+        {
+            case SF_ELC_GRAPH_NODE_TIMER:
+            {
+                timer_cfg_t const * p_timer_cfg = ((timer_instance_t const *) p_node->p_instance)->p_cfg;
+                SF_ELC_GRAPH_ERROR_RETURN(!p_timer_cfg->autostart, SSP_ERR_INVALID_ARGUMENT);
+                break;
+            }
+
+            case SF_ELC_GRAPH_NODE_ADC:
+            {
+                adc_cfg_t const * p_adc_cfg = ((adc_instance_t const *) p_node->p_instance)->p_cfg;
+                SF_ELC_GRAPH_ERROR_RETURN(ADC_TRIGGER_SYNC_ELC == p_adc_cfg->trigger, SSP_ERR_INVALID_ARGUMENT);
+                break;
+            }
+
+            case SF_ELC_GRAPH_NODE_TRANSFER:
+            {
+                transfer_cfg_t const * p_transfer_cfg = ((transfer_instance_t const *) p_node->p_instance)->p_cfg;
+                uint32_t event = (uint32_t) p_transfer_cfg->activation_source;
+                SF_ELC_GRAPH_ERROR_RETURN(!p_transfer_cfg->auto_enable, SSP_ERR_INVALID_ARGUMENT);
+                SF_ELC_GRAPH_ERROR_RETURN(BSP_ELC_EVENT_VALID(event), SSP_ERR_INVALID_ARGUMENT);
+
+                /** Each activation event has one DTC vector, so only one transfer node can own it. */
+                for (uint32_t j = 0U; j < i; j++)
+                {
+                    if (SF_ELC_GRAPH_NODE_TRANSFER == p_cfg->p_nodes[j].type)
+                    {
+                        transfer_cfg_t const * p_other =
+                            ((transfer_instance_t const *) p_cfg->p_nodes[j].p_instance)->p_cfg;
+                        SF_ELC_GRAPH_ERROR_RETURN(p_other->activation_source != p_transfer_cfg->activation_source,
+                                                  SSP_ERR_IN_USE);
+                    }
+                }
+                break;
+            }
+
+            case SF_ELC_GRAPH_NODE_DAC:
+                break;
+
+            default:
+                SF_ELC_GRAPH_ERROR_RETURN(false, SSP_ERR_INVALID_ARGUMENT);
+        }
+    }
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Open the driver of a node.
+ * @param[in]  p_node    Node.
+ **********************************************************************************************************************/
+static ssp_err_t sf_elc_graph_node_open (sf_elc_graph_node_t const * const p_node)
+{
+    ssp_err_t err = SSP_SUCCESS;
+
+    switch (p_node->type)
+    {
+        case SF_ELC_GRAPH_NODE_TIMER:
+        {
+            timer_instance_t const * p_timer = (timer_instance_t const *) p_node->p_instance;
+            err = p_timer->p_api->open(p_timer->p_ctrl, p_timer->p_cfg);
+            break;
+        }
+
+        case SF_ELC_GRAPH_NODE_ADC:
+        {
+            adc_instance_t const * p_adc = (adc_instance_t const *) p_node->p_instance;
+            err = p_adc->p_api->open(p_adc->p_ctrl, p_adc->p_cfg);
+            if (SSP_SUCCESS == err)
+            {
+                err = p_adc->p_api->scanCfg(p_adc->p_ctrl, p_adc->p_channel_cfg);
+                if (SSP_SUCCESS != err)
+                {
+                    p_adc->p_api->close(p_adc->p_ctrl);
+                }
+            }
+            break;
+        }
+
+        case SF_ELC_GRAPH_NODE_TRANSFER:
+        {
+            transfer_instance_t const * p_transfer = (transfer_instance_t const *) p_node->p_instance;
+            err = p_transfer->p_api->open(p_transfer->p_ctrl, p_transfer->p_cfg);
+            break;
+        }
+
+        default: /* SF_ELC_GRAPH_NODE_DAC */
+        {
+            dac_instance_t const * p_dac = (dac_instance_t const *) p_node->p_instance;
+            err = p_dac->p_api->open(p_dac->p_ctrl, p_dac->p_cfg);
+            break;
+        }
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Start the driver of a node.
+ * @param[in]  p_node    Node.
+ **********************************************************************************************************************/
+static ssp_err_t sf_elc_graph_node_start (sf_elc_graph_node_t const * const p_node)
+{
+    ssp_err_t err = SSP_SUCCESS;
+
+    switch (p_node->type)
+    {
+        case SF_ELC_GRAPH_NODE_TIMER:
+        {
+            timer_instance_t const * p_timer = (timer_instance_t const *) p_node->p_instance;
+            err = p_timer->p_api->start(p_timer->p_ctrl);
+            break;
+        }
+
+        case SF_ELC_GRAPH_NODE_ADC:
+        {
+            /** With an ELC trigger, starting a scan only arms the trigger. */
+            adc_instance_t const * p_adc = (adc_instance_t const *) p_node->p_instance;
+            err = p_adc->p_api->scanStart(p_adc->p_ctrl);
+            break;
+        }
+
+        case SF_ELC_GRAPH_NODE_TRANSFER:
+        {
+            transfer_instance_t const * p_transfer = (transfer_instance_t const *) p_node->p_instance;
+            err = p_transfer->p_api->enable(p_transfer->p_ctrl);
+            break;
+        }
+
+        default: /* SF_ELC_GRAPH_NODE_DAC */
+        {
+            dac_instance_t const * p_dac = (dac_instance_t const *) p_node->p_instance;
+            err = p_dac->p_api->start(p_dac->p_ctrl);
+            break;
+        }
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Stop the driver of a node.
+ * @param[in]  p_node    Node.
+ **********************************************************************************************************************/
+static ssp_err_t sf_elc_graph_node_stop (sf_elc_graph_node_t const * const p_node)
+{
+    ssp_err_t err = SSP_SUCCESS;
+
+    switch (p_node->type)
+    {
+        case SF_ELC_GRAPH_NODE_TIMER:
+        {
+            timer_instance_t const * p_timer = (timer_instance_t const *) p_node->p_instance;
+            err = p_timer->p_api->stop(p_timer->p_ctrl);
+            break;
+        }
+
+        case SF_ELC_GRAPH_NODE_ADC:
+        {
+            adc_instance_t const * p_adc = (adc_instance_t const *) p_node->p_instance;
+            err = p_adc->p_api->scanStop(p_adc->p_ctrl);
+            break;
+        }
+
+        case SF_ELC_GRAPH_NODE_TRANSFER:
+        {
+            transfer_instance_t const * p_transfer = (transfer_instance_t const *) p_node->p_instance;
+            err = p_transfer->p_api->disable(p_transfer->p_ctrl);
+            break;
+        }
+
+        default: /* SF_ELC_GRAPH_NODE_DAC */
+        {
+            dac_instance_t const * p_dac = (dac_instance_t const *) p_node->p_instance;
+            err = p_dac->p_api->stop(p_dac->p_ctrl);
+            break;
+        }
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Close the driver of a node.
+ * @param[in]  p_node    Node.
+ **********************************************************************************************************************/
+static ssp_err_t sf_elc_graph_node_close (sf_elc_graph_node_t const * const p_node)
+{
+    ssp_err_t err = SSP_SUCCESS;
+
+    switch (p_node->type)
+    {
+        case SF_ELC_GRAPH_NODE_TIMER:
+        {
+            timer_instance_t const * p_timer = (timer_instance_t const *) p_node->p_instance;
+            err = p_timer->p_api->close(p_timer->p_ctrl);
+            break;
+        }
+
+        case SF_ELC_GRAPH_NODE_ADC:
+        {
+            adc_instance_t const * p_adc = (adc_instance_t const *) p_node->p_instance;
+            err = p_adc->p_api->close(p_adc->p_ctrl);
+            break;
+        }
+
+        case SF_ELC_GRAPH_NODE_TRANSFER:
+        {
+            transfer_instance_t const * p_transfer = (transfer_instance_t const *) p_node->p_instance;
+            err = p_transfer->p_api->close(p_transfer->p_ctrl);
+            break;
+        }
+
+        default: /* SF_ELC_GRAPH_NODE_DAC */
+        {
+            dac_instance_t const * p_dac = (dac_instance_t const *) p_node->p_instance;
+            err = p_dac->p_api->close(p_dac->p_ctrl);
+            break;
+        }
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Stop a run of started nodes in pipeline order and break every link. Called with interrupts disabled.
+ * @param[in]  p_ctrl    Control block.
+ * @param[in]  first     Index of the first started node.
+ * @param[in]  count     Number of started nodes from first.
+ * @return     The first error reported by a driver.
+ **********************************************************************************************************************/
+static ssp_err_t sf_elc_graph_stop (sf_elc_graph_instance_ctrl_t * const p_ctrl, uint32_t first, uint32_t count)
+{
+    ssp_err_t err = SSP_SUCCESS;
+
+    /** The source is stopped first, so no event is sent to a stage that is already stopped. */
+    for (uint32_t i = first; i < (first + count); i++)
+    {
+        ssp_err_t stop_err = sf_elc_graph_node_stop(&p_ctrl->p_nodes[i]);
+        err = (SSP_SUCCESS == err) ? stop_err : err;
+    }
+
+    for (uint32_t i = 0U; i < p_ctrl->link_count; i++)
+    {
+        ssp_err_t break_err = p_ctrl->p_elc->p_api->linkBreak(p_ctrl->p_links[i].peripheral);
+        err = (SSP_SUCCESS == err) ? break_err : err;
+    }
+
+    p_ctrl->running = false;
+
+    return err;
+}
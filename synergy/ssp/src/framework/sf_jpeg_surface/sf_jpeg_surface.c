@@ -0,0 +1,726 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : sf_jpeg_surface.c
+ * Description  : JPEG decode to display surface framework, decodes queued images into frame buffer rectangles.
+ **********************************************************************************************************************/
+
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include <string.h>
+#include "sf_jpeg_surface.h"
+#include "sf_jpeg_surface_private_api.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/** "JSRF" in ASCII, used to determine if the framework is open. */
+#define SF_JPEG_SURFACE_OPEN                 (0x4A535246ULL)
+
+/** The JPEG decoder writes its output in 8 byte units. */
+#define SF_JPEG_SURFACE_PRV_ALIGN            (8U)
+
+/** A band is a whole number of 4:2:0 minimum coded unit rows, which also covers the other color spaces. */
+#define SF_JPEG_SURFACE_PRV_MCU_LINES        (16U)
+
+/** Macro for error logger. */
+#ifndef SF_JPEG_SURFACE_ERROR_RETURN
+/*LDRA_INSPECTED 77 S This macro does not work when surrounded by parentheses. */
+#define SF_JPEG_SURFACE_ERROR_RETURN(a, err) SSP_ERROR_RETURN((a), (err), &g_module_name[0], &g_sf_jpeg_surface_version)
+#endif
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+#if SF_JPEG_SURFACE_CFG_PARAM_CHECKING_ENABLE
+static ssp_err_t sf_jpeg_surface_open_param_check (sf_jpeg_surface_instance_ctrl_t * const p_ctrl,
+                                                   sf_jpeg_surface_cfg_t const * const p_cfg);
+static ssp_err_t sf_jpeg_surface_decode_param_check (sf_jpeg_surface_instance_ctrl_t * const p_ctrl,
+                                                     sf_jpeg_surface_image_t const * const p_image);
+#endif
+static void      sf_jpeg_surface_decode_callback (jpeg_decode_callback_args_t * p_args);
+static void      sf_jpeg_surface_next (sf_jpeg_surface_instance_ctrl_t * const p_ctrl);
+static ssp_err_t sf_jpeg_surface_image_start (sf_jpeg_surface_instance_ctrl_t * const p_ctrl,
+                                              sf_jpeg_surface_image_t const * const p_image);
+static ssp_err_t sf_jpeg_surface_image_begin (sf_jpeg_surface_instance_ctrl_t * const p_ctrl);
+static ssp_err_t sf_jpeg_surface_band_done (sf_jpeg_surface_instance_ctrl_t * const p_ctrl);
+static void      sf_jpeg_surface_image_finish (sf_jpeg_surface_instance_ctrl_t * const p_ctrl, ssp_err_t err);
+static void      sf_jpeg_surface_band_convert (sf_jpeg_surface_instance_ctrl_t * const p_ctrl, uint32_t lines);
+static uint32_t  sf_jpeg_surface_bytes_per_pixel (display_in_format_t format);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+#if defined(__GNUC__)
+/* This structure is affected by warnings from the GCC compiler bug https:/gcc.gnu.org/bugzilla/show_bug.cgi?id=60784
+ * This pragma suppresses the warnings in this structure only, and will be removed when the SSP compiler is updated to
+ * v5.3.*/
+/*LDRA_INSPECTED 69 S */
+#pragma GCC diagnostic ignored "-Wmissing-field-initializers"
+#endif
+/** Version data structure used by error logger macro. */
+static const ssp_version_t g_sf_jpeg_surface_version =
+{
+    .api_version_minor  = SF_JPEG_SURFACE_API_VERSION_MINOR,
+    .api_version_major  = SF_JPEG_SURFACE_API_VERSION_MAJOR,
+    .code_version_major = SF_JPEG_SURFACE_CODE_VERSION_MAJOR,
+    .code_version_minor = SF_JPEG_SURFACE_CODE_VERSION_MINOR
+};
+#if defined(__GNUC__)
+/* Restore warning settings for 'missing-field-initializers' to as specified on command line. */
+/*LDRA_INSPECTED 69 S */
+#pragma GCC diagnostic pop
+#endif
+
+/** Name of module used by error logger macro */
+#if BSP_CFG_ERROR_LOG != 0
+static const char g_module_name[] = "sf_jpeg_surface";
+#endif
+
+/** Filled in Interface API structure for this Instance. */
+/*LDRA_INSPECTED 27 D This structure must be accessible in user code. It cannot be static. */
+const sf_jpeg_surface_api_t g_sf_jpeg_surface_on_sf_jpeg_surface =
+{
+    .open       = SF_JPEG_SURFACE_Open,
+    .decode     = SF_JPEG_SURFACE_Decode,
+    .close      = SF_JPEG_SURFACE_Close,
+    .versionGet = SF_JPEG_SURFACE_VersionGet
+};
+
+/** @addtogroup SF_JPEG_SURFACE
+ * @{
+ */
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @brief  Open the JPEG decoder for decoding into frame buffers.
+ *
+ *  Implements sf_jpeg_surface_api_t::open
+ *
+ *  The decoder is opened from a copy of its configuration with the framework's callback, which keeps the hardware
+ *  reserved for the framework. It is reopened with the output pixel format each image needs.
+ *
+ * @retval  SSP_SUCCESS                 The decoder is open.
+ * @retval  SSP_ERR_ASSERTION           A pointer argument or a lower level instance is NULL.
+ * @retval  SSP_ERR_IN_USE              The framework is already open.
+ * @retval  SSP_ERR_INVALID_ALIGNMENT   The band buffer is not 8-byte aligned.
+ * @return                              See @ref Common_Error_Codes or functions called by this function for other
+ *                                      possible return codes. This function calls:
+ *                                      * jpeg_decode_api_t::open
+ **********************************************************************************************************************/
+ssp_err_t SF_JPEG_SURFACE_Open (sf_jpeg_surface_ctrl_t * const p_api_ctrl, sf_jpeg_surface_cfg_t const * const p_cfg)
+{
+    sf_jpeg_surface_instance_ctrl_t * p_ctrl = (sf_jpeg_surface_instance_ctrl_t *) p_api_ctrl;
+    ssp_err_t err = SSP_SUCCESS;
+
+#if SF_JPEG_SURFACE_CFG_PARAM_CHECKING_ENABLE
+    err = sf_jpeg_surface_open_param_check(p_ctrl, p_cfg);
+    SF_JPEG_SURFACE_ERROR_RETURN(SSP_SUCCESS == err, err);
+#endif
+
+    jpeg_decode_instance_t const * p_jpeg = p_cfg->p_lower_lvl_jpeg;
+
+    /** Open the decoder with the framework's callback. The configuration is kept to reopen it for each image. */
+    p_ctrl->jpeg_cfg            = *p_jpeg->p_cfg;
+    p_ctrl->jpeg_cfg.p_callback = sf_jpeg_surface_decode_callback;
+    p_ctrl->jpeg_cfg.p_context  = p_ctrl;
+    err = p_jpeg->p_api->open(p_jpeg->p_ctrl, &p_ctrl->jpeg_cfg);
+    SF_JPEG_SURFACE_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    p_ctrl->p_jpeg           = p_jpeg;
+    p_ctrl->p_display        = p_cfg->p_display;
+    p_ctrl->p_band_buffer    = (uint8_t *) p_cfg->p_band_buffer;
+    p_ctrl->band_buffer_size = p_cfg->band_buffer_size;
+    p_ctrl->image_head       = 0U;
+    p_ctrl->image_count      = 0U;
+    p_ctrl->busy             = false;
+    p_ctrl->p_callback       = p_cfg->p_callback;
+    p_ctrl->p_context        = p_cfg->p_context;
+    p_ctrl->open             = SF_JPEG_SURFACE_OPEN;
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Queue an image for decoding into a frame buffer rectangle.
+ *
+ *  Implements sf_jpeg_surface_api_t::decode
+ *
+ *  If the decoder is idle the image is started right away, otherwise it is started from the interrupt that completes
+ *  the image before it. The callback reports every queued image with ::SF_JPEG_SURFACE_EVENT_IMAGE_DONE or
+ *  ::SF_JPEG_SURFACE_EVENT_IMAGE_ERROR.
+ *
+ *  The decoder writes into the frame buffer directly when the layer is RGB565, ARGB8888 or RGB888 and the rectangle
+ *  starts on an 8 byte boundary. Otherwise the image is decoded into the band buffer 16 lines or more at a time and
+ *  each band is converted into the rectangle from the decoder interrupt.
+ *
+ * @retval  SSP_SUCCESS                 The image is queued.
+ * @retval  SSP_ERR_ASSERTION           p_api_ctrl, p_image or the JPEG data is NULL.
+ * @retval  SSP_ERR_NOT_OPEN            The framework is not open.
+ * @retval  SSP_ERR_INVALID_ALIGNMENT   The JPEG data is not 8-byte aligned.
+ * @retval  SSP_ERR_INVALID_ARGUMENT    The layer has no frame buffer, the rectangle does not fit in the layer, or the
+ *                                      image must be converted and there is no band buffer.
+ * @retval  SSP_ERR_UNSUPPORTED         The layer uses a CLUT format.
+ * @retval  SSP_ERR_QUEUE_FULL          SF_JPEG_SURFACE_QUEUE_MAX images are queued.
+ **********************************************************************************************************************/
+ssp_err_t SF_JPEG_SURFACE_Decode (sf_jpeg_surface_ctrl_t * const p_api_ctrl,
+                                  sf_jpeg_surface_image_t const * const p_image)
+{
+    sf_jpeg_surface_instance_ctrl_t * p_ctrl = (sf_jpeg_surface_instance_ctrl_t *) p_api_ctrl;
+    ssp_err_t err   = SSP_SUCCESS;
+    bool      start = false;
+
+#if SF_JPEG_SURFACE_CFG_PARAM_CHECKING_ENABLE
+    err = sf_jpeg_surface_decode_param_check(p_ctrl, p_image);
+    SF_JPEG_SURFACE_ERROR_RETURN(SSP_SUCCESS == err, err);
+#endif
+    SF_JPEG_SURFACE_ERROR_RETURN(SF_JPEG_SURFACE_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+
+    /** Images are queued from threads and from the callback, and started from the decoder interrupt. */
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    if (SF_JPEG_SURFACE_QUEUE_MAX == p_ctrl->image_count)
+    {
+        err = SSP_ERR_QUEUE_FULL;
+    }
+    else
+    {
+        p_ctrl->images[(p_ctrl->image_head + p_ctrl->image_count) % SF_JPEG_SURFACE_QUEUE_MAX] = *p_image;
+        p_ctrl->image_count++;
+        start        = !p_ctrl->busy;
+        p_ctrl->busy = true;
+    }
+    SSP_CRITICAL_SECTION_EXIT;
+
+    SF_JPEG_SURFACE_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    /** Start the image if the decoder was idle. */
+    if (start)
+    {
+        sf_jpeg_surface_next(p_ctrl);
+    }
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Close the JPEG decoder.
+ *
+ *  Implements sf_jpeg_surface_api_t::close
+ *
+ *  The image being decoded and the queued images are discarded without callbacks.
+ *
+ * @retval  SSP_SUCCESS                 The framework is closed.
+ * @retval  SSP_ERR_ASSERTION           p_api_ctrl is NULL.
+ * @retval  SSP_ERR_NOT_OPEN            The framework is not open.
+ * @return                              See @ref Common_Error_Codes or functions called by this function for other
+ *                                      possible return codes. This function calls:
+ *                                      * jpeg_decode_api_t::close
+ **********************************************************************************************************************/
+ssp_err_t SF_JPEG_SURFACE_Close (sf_jpeg_surface_ctrl_t * const p_api_ctrl)
+{
+    sf_jpeg_surface_instance_ctrl_t * p_ctrl = (sf_jpeg_surface_instance_ctrl_t *) p_api_ctrl;
+
+#if SF_JPEG_SURFACE_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_ctrl);
+#endif
+    SF_JPEG_SURFACE_ERROR_RETURN(SF_JPEG_SURFACE_OPEN == p_ctrl->open, SSP_ERR_NOT_OPEN);
+
+    p_ctrl->open = 0U;
+
+    /** Closing the decoder disables its interrupts, so no image is started after the queue is emptied. */
+    ssp_err_t err = p_ctrl->p_jpeg->p_api->close(p_ctrl->p_jpeg->p_ctrl);
+
+    p_ctrl->image_count = 0U;
+    p_ctrl->busy        = false;
+
+    SF_JPEG_SURFACE_ERROR_RETURN(SSP_SUCCESS == err, err);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Get the framework version based on compile time macros.
+ *
+ *  Implements sf_jpeg_surface_api_t::versionGet
+ *
+ * @retval  SSP_SUCCESS                 Version stored in p_version.
+ * @retval  SSP_ERR_ASSERTION           p_version is NULL.
+ **********************************************************************************************************************/
+ssp_err_t SF_JPEG_SURFACE_VersionGet (ssp_version_t * const p_version)
+{
+#if SF_JPEG_SURFACE_CFG_PARAM_CHECKING_ENABLE
+    SSP_ASSERT(NULL != p_version);
+#endif
+
+    p_version->version_id = g_sf_jpeg_surface_version.version_id;
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup SF_JPEG_SURFACE)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+#if SF_JPEG_SURFACE_CFG_PARAM_CHECKING_ENABLE
+/*******************************************************************************************************************//**
+ * @brief  Parameter check for SF_JPEG_SURFACE_Open.
+ * @param[in]  p_ctrl   Control block.
+ * @param[in]  p_cfg    Configuration.
+ **********************************************************************************************************************/
+static ssp_err_t sf_jpeg_surface_open_param_check (sf_jpeg_surface_instance_ctrl_t * const p_ctrl,
+                                                   sf_jpeg_surface_cfg_t const * const p_cfg)
+{
+    SSP_ASSERT(NULL != p_ctrl);
+    SSP_ASSERT(NULL != p_cfg);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_jpeg);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_jpeg->p_cfg);
+    SSP_ASSERT(NULL != p_cfg->p_lower_lvl_jpeg->p_api);
+    SSP_ASSERT(NULL != p_cfg->p_display);
+    SSP_ASSERT(NULL != p_cfg->p_display->p_cfg);
+    SF_JPEG_SURFACE_ERROR_RETURN(SF_JPEG_SURFACE_OPEN != p_ctrl->open, SSP_ERR_IN_USE);
+    SF_JPEG_SURFACE_ERROR_RETURN(0U == ((uintptr_t) p_cfg->p_band_buffer % SF_JPEG_SURFACE_PRV_ALIGN),
+                                 SSP_ERR_INVALID_ALIGNMENT);
+
+    return SSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Parameter check for SF_JPEG_SURFACE_Decode.
+ * @param[in]  p_ctrl    Control block.
+ * @param[in]  p_image   Image to decode.
+ **********************************************************************************************************************/
+static ssp_err_t sf_jpeg_surface_decode_param_check (sf_jpeg_surface_instance_ctrl_t * const p_ctrl,
+                                                     sf_jpeg_surface_image_t const * const p_image)
+{
+    SSP_ASSERT(NULL != p_ctrl);
+    SSP_ASSERT(NULL != p_image);
+    SSP_ASSERT(NULL != p_image->p_jpeg);
+    SF_JPEG_SURFACE_ERROR_RETURN(0U == ((uintptr_t) p_image->p_jpeg % SF_JPEG_SURFACE_PRV_ALIGN),
+                                 SSP_ERR_INVALID_ALIGNMENT);
+    SF_JPEG_SURFACE_ERROR_RETURN(DISPLAY_FRAME_LAYER_2 >= p_image->layer, SSP_ERR_INVALID_ARGUMENT);
+
+    display_input_cfg_t const * p_input = &p_ctrl->p_display->p_cfg->input[p_image->layer];
+
+    SF_JPEG_SURFACE_ERROR_RETURN(0U != sf_jpeg_surface_bytes_per_pixel(p_input->format), SSP_ERR_UNSUPPORTED);
+    SF_JPEG_SURFACE_ERROR_RETURN((NULL != p_image->p_frame_buffer) || (NULL != p_input->p_base),
+                                 SSP_ERR_INVALID_ARGUMENT);
+    SF_JPEG_SURFACE_ERROR_RETURN(((uint32_t) p_image->x + p_image->width) <= p_input->hsize, SSP_ERR_INVALID_ARGUMENT);
+    SF_JPEG_SURFACE_ERROR_RETURN(((uint32_t) p_image->y + p_image->height) <= p_input->vsize, SSP_ERR_INVALID_ARGUMENT);
+
+    return SSP_SUCCESS;
+}
+#endif
+
+/*******************************************************************************************************************//**
+ * @brief  JPEG decoder callback. Sets up the output when the image size is known, moves on to the next band and
+ * starts the next queued image when the current one completes or fails.
+ * @param[in]  p_args   JPEG decoder callback arguments.
+ **********************************************************************************************************************/
+static void sf_jpeg_surface_decode_callback (jpeg_decode_callback_args_t * p_args)
+{
+    sf_jpeg_surface_instance_ctrl_t * p_ctrl = (sf_jpeg_surface_instance_ctrl_t *) p_args->p_context;
+    uint32_t  status = (uint32_t) p_args->status;
+    ssp_err_t err    = SSP_SUCCESS;
+    bool      done   = true;
+
+    if (0U != (status & (uint32_t) JPEG_DECODE_STATUS_ERROR))
+    {
+        jpeg_decode_status_t decoder_status = JPEG_DECODE_STATUS_FREE;
+        err = p_ctrl->p_jpeg->p_api->statusGet(p_ctrl->p_jpeg->p_ctrl, &decoder_status);
+        if (SSP_SUCCESS == err)
+        {
+            err = SSP_ERR_JPEG_ERR;
+        }
+    }
+    else if (0U != (status & (uint32_t) JPEG_DECODE_STATUS_DONE))
+    {
+        /* The last band may complete without an output pause. */
+        if ((!p_ctrl->direct) && (p_ctrl->line < p_ctrl->height))
+        {
+            sf_jpeg_surface_band_convert(p_ctrl, p_ctrl->height - p_ctrl->line);
+        }
+    }
+    else if (0U != (status & (uint32_t) JPEG_DECODE_STATUS_OUTPUT_PAUSE))
+    {
+        err  = sf_jpeg_surface_band_done(p_ctrl);
+        done = (SSP_SUCCESS != err);
+    }
+    else if (0U != (status & (uint32_t) JPEG_DECODE_STATUS_INPUT_PAUSE))
+    {
+        /* Input count mode is not used, so the decoder ran out of data before the end of the image. */
+        err = SSP_ERR_JPEG_EOI_NOT_DETECTED;
+    }
+    else if (0U != (status & (uint32_t) JPEG_DECODE_STATUS_IMAGE_SIZE_READY))
+    {
+        err  = sf_jpeg_surface_image_begin(p_ctrl);
+        done = (SSP_SUCCESS != err);
+    }
+    else
+    {
+        done = false;
+    }
+
+    if (done)
+    {
+        sf_jpeg_surface_image_finish(p_ctrl, err);
+        sf_jpeg_surface_next(p_ctrl);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Starts the first queued image. Images that cannot be started are reported and skipped. The framework goes
+ * idle when the queue is empty.
+ * @param[in]  p_ctrl   Control block.
+ **********************************************************************************************************************/
+static void sf_jpeg_surface_next (sf_jpeg_surface_instance_ctrl_t * const p_ctrl)
+{
+    sf_jpeg_surface_image_t const * p_image = NULL;
+
+    SSP_CRITICAL_SECTION_DEFINE;
+
+    do
+    {
+        SSP_CRITICAL_SECTION_ENTER;
+        if (0U == p_ctrl->image_count)
+        {
+            p_ctrl->busy = false;
+            p_image      = NULL;
+        }
+        else
+        {
+            p_image = &p_ctrl->images[p_ctrl->image_head];
+        }
+        SSP_CRITICAL_SECTION_EXIT;
+
+        if (NULL != p_image)
+        {
+            ssp_err_t err = sf_jpeg_surface_image_start(p_ctrl, p_image);
+            if (SSP_SUCCESS == err)
+            {
+                p_image = NULL;
+            }
+            else
+            {
+                sf_jpeg_surface_image_finish(p_ctrl, err);
+            }
+        }
+    } while (NULL != p_image);
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Reopens the decoder with the output format the image needs and starts reading the JPEG header.
+ * @param[in]  p_ctrl    Control block.
+ * @param[in]  p_image   Image to start.
+ **********************************************************************************************************************/
+static ssp_err_t sf_jpeg_surface_image_start (sf_jpeg_surface_instance_ctrl_t * const p_ctrl,
+                                              sf_jpeg_surface_image_t const * const p_image)
+{
+    jpeg_decode_instance_t const * p_jpeg  = p_ctrl->p_jpeg;
+    display_input_cfg_t const    * p_input = &p_ctrl->p_display->p_cfg->input[p_image->layer];
+    uint32_t                       bytes_per_pixel = sf_jpeg_surface_bytes_per_pixel(p_input->format);
+    uint8_t                      * p_base  = (uint8_t *) p_image->p_frame_buffer;
+
+    if (NULL == p_base)
+    {
+        p_base = (uint8_t *) p_input->p_base;
+    }
+
+    p_ctrl->format  = p_input->format;
+    p_ctrl->hstride = p_input->hstride;
+    p_ctrl->p_dest  = p_base + ((uint32_t) p_image->y * p_input->hstride) + ((uint32_t) p_image->x * bytes_per_pixel);
+    p_ctrl->width   = 0U;
+    p_ctrl->height  = 0U;
+    p_ctrl->line    = 0U;
+
+    /** The decoder produces RGB565 and ARGB8888. RGB888 layers use 32 bit pixels and ignore the alpha byte. */
+    if (DISPLAY_IN_FORMAT_16BITS_RGB565 == p_ctrl->format)
+    {
+        p_ctrl->jpeg_cfg.pixel_format = JPEG_DECODE_PIXEL_FORMAT_RGB565;
+        p_ctrl->direct                = true;
+    }
+    else
+    {
+        p_ctrl->jpeg_cfg.pixel_format = JPEG_DECODE_PIXEL_FORMAT_ARGB8888;
+        p_ctrl->jpeg_cfg.alpha_value  = UINT8_MAX;
+        p_ctrl->direct                = (DISPLAY_IN_FORMAT_32BITS_ARGB8888 == p_ctrl->format) ||
+                                        (DISPLAY_IN_FORMAT_32BITS_RGB888 == p_ctrl->format);
+    }
+
+    /** The decoder output address and stride must be 8 byte aligned. */
+    if ((0U != ((uintptr_t) p_ctrl->p_dest % SF_JPEG_SURFACE_PRV_ALIGN)) ||
+        (0U != (p_ctrl->hstride % SF_JPEG_SURFACE_PRV_ALIGN)))
+    {
+        p_ctrl->direct = false;
+    }
+
+    if ((!p_ctrl->direct) && (NULL == p_ctrl->p_band_buffer))
+    {
+        return SSP_ERR_INVALID_ARGUMENT;
+    }
+
+    /** A decoder that has completed an image only starts again after it is reopened. */
+    (void) p_jpeg->p_api->close(p_jpeg->p_ctrl);
+    ssp_err_t err = p_jpeg->p_api->open(p_jpeg->p_ctrl, &p_ctrl->jpeg_cfg);
+    if (SSP_SUCCESS == err)
+    {
+        /* A buffer size of 0 lets the decoder read up to the EOI marker without input pauses. */
+        err = p_jpeg->p_api->inputBufferSet(p_jpeg->p_ctrl, (void *) p_image->p_jpeg, 0U);
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  The decoder has read the image size. Checks that the image fits in its rectangle and sets the first
+ * output buffer, which starts decoding.
+ * @param[in]  p_ctrl   Control block.
+ **********************************************************************************************************************/
+static ssp_err_t sf_jpeg_surface_image_begin (sf_jpeg_surface_instance_ctrl_t * const p_ctrl)
+{
+    jpeg_decode_instance_t const  * p_jpeg  = p_ctrl->p_jpeg;
+    sf_jpeg_surface_image_t const * p_image = &p_ctrl->images[p_ctrl->image_head];
+    uint16_t  width  = 0U;
+    uint16_t  height = 0U;
+    ssp_err_t err;
+
+    err = p_jpeg->p_api->imageSizeGet(p_jpeg->p_ctrl, &width, &height);
+    if (SSP_SUCCESS != err)
+    {
+        return err;
+    }
+
+    /* The size is reported to the callback even if the image does not fit. */
+    p_ctrl->width  = width;
+    p_ctrl->height = height;
+
+    if ((width > p_image->width) || (height > p_image->height))
+    {
+        return SSP_ERR_INVALID_SIZE;
+    }
+
+    if (p_ctrl->direct)
+    {
+        /** Decode the whole image into the rectangle, using the frame buffer stride. */
+        err = p_jpeg->p_api->horizontalStrideSet(p_jpeg->p_ctrl,
+                                                 p_ctrl->hstride / sf_jpeg_surface_bytes_per_pixel(p_ctrl->format));
+        if (SSP_SUCCESS == err)
+        {
+            err = p_jpeg->p_api->outputBufferSet(p_jpeg->p_ctrl, p_ctrl->p_dest, (uint32_t) height * p_ctrl->hstride);
+        }
+    }
+    else
+    {
+        /** Decode as many lines as fit in the band buffer at a time. */
+        uint32_t row = (uint32_t) width * ((JPEG_DECODE_PIXEL_FORMAT_RGB565 == p_ctrl->jpeg_cfg.pixel_format) ? 2U : 4U);
+        p_ctrl->band_lines = (p_ctrl->band_buffer_size / row) & ~(SF_JPEG_SURFACE_PRV_MCU_LINES - 1U);
+        if (0U == p_ctrl->band_lines)
+        {
+            return SSP_ERR_JPEG_BUFFERSIZE_NOT_ENOUGH;
+        }
+
+        err = p_jpeg->p_api->horizontalStrideSet(p_jpeg->p_ctrl, width);
+        if (SSP_SUCCESS == err)
+        {
+            err = p_jpeg->p_api->outputBufferSet(p_jpeg->p_ctrl, p_ctrl->p_band_buffer, p_ctrl->band_lines * row);
+        }
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  The decoder paused after filling its output buffer. Converts a band into the rectangle and gives the decoder
+ * the next output buffer.
+ * @param[in]  p_ctrl   Control block.
+ **********************************************************************************************************************/
+static ssp_err_t sf_jpeg_surface_band_done (sf_jpeg_surface_instance_ctrl_t * const p_ctrl)
+{
+    jpeg_decode_instance_t const * p_jpeg = p_ctrl->p_jpeg;
+    uint32_t lines = 0U;
+
+    ssp_err_t err = p_jpeg->p_api->linesDecodedGet(p_jpeg->p_ctrl, &lines);
+    if (SSP_SUCCESS != err)
+    {
+        return err;
+    }
+
+    if (lines > (p_ctrl->height - p_ctrl->line))
+    {
+        lines = p_ctrl->height - p_ctrl->line;
+    }
+
+    if (!p_ctrl->direct)
+    {
+        sf_jpeg_surface_band_convert(p_ctrl, lines);
+    }
+
+    p_ctrl->line += lines;
+
+    /** The decoder completes the image on its own after the last line. */
+    if (p_ctrl->line < p_ctrl->height)
+    {
+        if (p_ctrl->direct)
+        {
+            err = p_jpeg->p_api->outputBufferSet(p_jpeg->p_ctrl, p_ctrl->p_dest + (p_ctrl->line * p_ctrl->hstride),
+                                                 (p_ctrl->height - p_ctrl->line) * p_ctrl->hstride);
+        }
+        else
+        {
+            uint32_t row = (uint32_t) p_ctrl->width *
+                           ((JPEG_DECODE_PIXEL_FORMAT_RGB565 == p_ctrl->jpeg_cfg.pixel_format) ? 2U : 4U);
+            err = p_jpeg->p_api->outputBufferSet(p_jpeg->p_ctrl, p_ctrl->p_band_buffer, p_ctrl->band_lines * row);
+        }
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Reports the image being decoded to the callback and removes it from the queue.
+ * @param[in]  p_ctrl   Control block.
+ * @param[in]  err      SSP_SUCCESS if the image was decoded, otherwise the reason it was not.
+ **********************************************************************************************************************/
+static void sf_jpeg_surface_image_finish (sf_jpeg_surface_instance_ctrl_t * const p_ctrl, ssp_err_t err)
+{
+    if (NULL != p_ctrl->p_callback)
+    {
+        sf_jpeg_surface_callback_args_t args;
+        args.event           = (SSP_SUCCESS == err) ? SF_JPEG_SURFACE_EVENT_IMAGE_DONE :
+                                                      SF_JPEG_SURFACE_EVENT_IMAGE_ERROR;
+        args.error           = err;
+        args.width           = p_ctrl->width;
+        args.height          = p_ctrl->height;
+        args.p_image_context = p_ctrl->images[p_ctrl->image_head].p_context;
+        args.p_context       = p_ctrl->p_context;
+        p_ctrl->p_callback(&args);
+    }
+
+    SSP_CRITICAL_SECTION_DEFINE;
+    SSP_CRITICAL_SECTION_ENTER;
+    p_ctrl->image_head = (p_ctrl->image_head + 1U) % SF_JPEG_SURFACE_QUEUE_MAX;
+    p_ctrl->image_count--;
+    SSP_CRITICAL_SECTION_EXIT;
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Converts decoded lines from the band buffer into the frame buffer rectangle.
+ * @param[in]  p_ctrl   Control block.
+ * @param[in]  lines    Lines at the start of the band buffer.
+ **********************************************************************************************************************/
+static void sf_jpeg_surface_band_convert (sf_jpeg_surface_instance_ctrl_t * const p_ctrl, uint32_t lines)
+{
+    uint8_t * p_dest  = p_ctrl->p_dest + (p_ctrl->line * p_ctrl->hstride);
+    uint32_t  width   = p_ctrl->width;
+
+    for (uint32_t y = 0U; y < lines; y++)
+    {
+        uint16_t * p_dest16 = (uint16_t *) (p_dest + (y * p_ctrl->hstride));
+
+        switch (p_ctrl->format)
+        {
+            case DISPLAY_IN_FORMAT_16BITS_RGB565:
+            {
+                memcpy(p_dest16, p_ctrl->p_band_buffer + (y * width * 2U), width * 2U);
+                break;
+            }
+
+            case DISPLAY_IN_FORMAT_16BITS_ARGB1555:
+            {
+                uint32_t const * p_src = (uint32_t const *) p_ctrl->p_band_buffer + (y * width);
+                for (uint32_t x = 0U; x < width; x++)
+                {
+                    uint32_t argb = p_src[x];
+                    p_dest16[x] = (uint16_t) (((argb >> 16) & 0x8000U) | ((argb >> 9) & 0x7C00U) |
+                                              ((argb >> 6) & 0x03E0U) | ((argb >> 3) & 0x001FU));
+                }
+                break;
+            }
+
+            case DISPLAY_IN_FORMAT_16BITS_ARGB4444:
+            {
+                uint32_t const * p_src = (uint32_t const *) p_ctrl->p_band_buffer + (y * width);
+                for (uint32_t x = 0U; x < width; x++)
+                {
+                    uint32_t argb = p_src[x];
+                    p_dest16[x] = (uint16_t) (((argb >> 16) & 0xF000U) | ((argb >> 12) & 0x0F00U) |
+                                              ((argb >> 8) & 0x00F0U) | ((argb >> 4) & 0x000FU));
+                }
+                break;
+            }
+
+            default:
+            {
+                /* ARGB8888 and RGB888 rectangles that are not 8 byte aligned. */
+                memcpy(p_dest16, p_ctrl->p_band_buffer + (y * width * 4U), width * 4U);
+                break;
+            }
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @brief  Bytes per pixel of a frame buffer format.
+ * @param[in]  format   Layer input format.
+ * @return     Bytes per pixel, 0 for CLUT formats, which the framework does not write.
+ **********************************************************************************************************************/
+static uint32_t sf_jpeg_surface_bytes_per_pixel (display_in_format_t format)
+{
+    uint32_t bytes = 0U;
+
+    switch (format)
+    {
+        case DISPLAY_IN_FORMAT_32BITS_ARGB8888:
+        case DISPLAY_IN_FORMAT_32BITS_RGB888:
+        {
+            bytes = 4U;
+            break;
+        }
+
+        case DISPLAY_IN_FORMAT_16BITS_RGB565:
+        case DISPLAY_IN_FORMAT_16BITS_ARGB1555:
+        case DISPLAY_IN_FORMAT_16BITS_ARGB4444:
+        {
+            bytes = 2U;
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    return bytes;
+}
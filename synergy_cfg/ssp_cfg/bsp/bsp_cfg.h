@@ -18,6 +18,15 @@
 #define BSP_CFG_PARAM_CHECKING_ENABLE (1)
 #define BSP_CFG_ASSERT (0)
 #define BSP_CFG_ERROR_LOG (0)
+#define BSP_CFG_STARTUP_INIT_TABLES_ENABLE (0)
+#define BSP_CFG_STARTUP_DMAC_ENABLE (0)
+#define BSP_CFG_STARTUP_DMAC_CHANNEL (0)
+#define BSP_CFG_STARTUP_TRACE_ENABLE (0)
+#define BSP_CFG_POOL_MALLOC_ENABLE (0)
+#define BSP_CFG_ISR_TRACE_ENABLE (0)
+#define BSP_CFG_WORK_PRIORITIES (4)
+#define BSP_CFG_WORK_SLOTS (16)
+#define BSP_CFG_TIMER_TICK_SHIFT (7)
 
 /*
  ID Code
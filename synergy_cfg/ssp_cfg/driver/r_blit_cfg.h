@@ -0,0 +1,7 @@
+/* generated configuration header file - do not edit */
+#ifndef R_BLIT_CFG_H_
+#define R_BLIT_CFG_H_
+#define BLIT_CFG_PARAM_CHECKING_ENABLE (BSP_CFG_PARAM_CHECKING_ENABLE)
+#define BLIT_CFG_DMA_THRESHOLD_BYTES (4096)
+#define BLIT_CFG_LINE_PIXELS (64)
+#endif /* R_BLIT_CFG_H_ */
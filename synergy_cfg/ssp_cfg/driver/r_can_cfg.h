@@ -0,0 +1,5 @@
+/* generated configuration header file - do not edit */
+#ifndef R_CAN_CFG_H_
+#define R_CAN_CFG_H_
+#define CAN_CFG_PARAM_CHECKING_ENABLE (BSP_CFG_PARAM_CHECKING_ENABLE)
+#endif /* R_CAN_CFG_H_ */
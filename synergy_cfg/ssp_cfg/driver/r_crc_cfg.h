@@ -0,0 +1,8 @@
+/* generated configuration header file - do not edit */
+#ifndef R_CRC_CFG_H_
+#define R_CRC_CFG_H_
+#define CRC_CFG_PARAM_CHECKING_ENABLE (BSP_CFG_PARAM_CHECKING_ENABLE)
+#define CRC_CFG_SW_TABLE_SETS (1)
+#define CRC_CFG_HW_THRESHOLD_BYTES (128)
+#define CRC_CFG_DMA_THRESHOLD_BYTES (2048)
+#endif /* R_CRC_CFG_H_ */
@@ -0,0 +1,7 @@
+/* generated configuration header file - do not edit */
+#ifndef R_DTC_CFG_H_
+#define R_DTC_CFG_H_
+#define DTC_CFG_PARAM_CHECKING_ENABLE (BSP_CFG_PARAM_CHECKING_ENABLE)
+#define DTC_CFG_SOFTWARE_START_ENABLE (0)
+#define SUPPRESS_WARNING_DTC_CFG_VECTOR_TABLE_SECTION_NAME
+#endif /* R_DTC_CFG_H_ */
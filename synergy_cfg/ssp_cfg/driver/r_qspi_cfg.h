@@ -0,0 +1,5 @@
+/* generated configuration header file - do not edit */
+#ifndef R_QSPI_CFG_H_
+#define R_QSPI_CFG_H_
+#define QSPI_CFG_PARAM_CHECKING_ENABLE (BSP_CFG_PARAM_CHECKING_ENABLE)
+#endif /* R_QSPI_CFG_H_ */
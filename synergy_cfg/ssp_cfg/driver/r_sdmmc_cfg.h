@@ -0,0 +1,6 @@
+/* generated configuration header file - do not edit */
+#ifndef R_SDMMC_CFG_H_
+#define R_SDMMC_CFG_H_
+#define SDMMC_CFG_PARAM_CHECKING_ENABLE (BSP_CFG_PARAM_CHECKING_ENABLE)
+#define SDMMC_CFG_UNALIGNED_BLOCKS (4)
+#endif /* R_SDMMC_CFG_H_ */
@@ -0,0 +1,5 @@
+/* generated configuration header file - do not edit */
+#ifndef SF_ELC_GRAPH_CFG_H_
+#define SF_ELC_GRAPH_CFG_H_
+#define SF_ELC_GRAPH_CFG_PARAM_CHECKING_ENABLE (BSP_CFG_PARAM_CHECKING_ENABLE)
+#endif /* SF_ELC_GRAPH_CFG_H_ */
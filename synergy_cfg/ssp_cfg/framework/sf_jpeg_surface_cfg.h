@@ -0,0 +1,5 @@
+/* generated configuration header file - do not edit */
+#ifndef SF_JPEG_SURFACE_CFG_H_
+#define SF_JPEG_SURFACE_CFG_H_
+#define SF_JPEG_SURFACE_CFG_PARAM_CHECKING_ENABLE (BSP_CFG_PARAM_CHECKING_ENABLE)
+#endif /* SF_JPEG_SURFACE_CFG_H_ */
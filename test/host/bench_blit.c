@@ -0,0 +1,241 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : bench_blit.c
+ * Description  : Throughput of the blitter in Mpixel/s on a 480x272 surface for fill, copy with the CPU and the
+ *                DMAC, blend and convert, next to the pixel by pixel reference of blit_reference.c.
+ *
+ *                On the host the DMAC is a register model and the CPU is not a Cortex-M4, so the numbers compare the
+ *                code paths with each other rather than predict the silicon. Build the same program for the target
+ *                to tune BLIT_CFG_DMA_THRESHOLD_BYTES for a board.
+ **********************************************************************************************************************/
+
+#include <stdlib.h>
+
+#include "bsp_api.h"
+#include "r_blit.h"
+#include "r_dmac.h"
+#include "blit_reference.h"
+#include "host_test.h"
+
+#define BENCH_BLIT_WIDTH         (480U)
+#define BENCH_BLIT_HEIGHT        (272U)
+#define BENCH_BLIT_MIN_SECONDS   (0.02)
+
+/** Operations measured. */
+typedef enum e_bench_blit_op
+{
+    BENCH_BLIT_OP_FILL,
+    BENCH_BLIT_OP_COPY,
+    BENCH_BLIT_OP_BLEND,
+    BENCH_BLIT_OP_CONVERT,
+} bench_blit_op_t;
+
+/** One row of the table. */
+typedef struct st_bench_blit_case
+{
+    char const         * p_name;
+    bench_blit_op_t      op;
+    display_in_format_t  dest;
+    display_in_format_t  src;
+    bool                 dma;
+    uint8_t              alpha;
+} bench_blit_case_t;
+
+static uint32_t                g_dest[BENCH_BLIT_WIDTH * BENCH_BLIT_HEIGHT];
+static uint32_t                g_src[BENCH_BLIT_WIDTH * BENCH_BLIT_HEIGHT];
+static uint32_t                g_clut[256];
+static blit_instance_ctrl_t    g_blit_ctrl;
+static transfer_info_t         g_dmac_info;
+static dmac_instance_ctrl_t    g_dmac_ctrl;
+static transfer_on_dmac_cfg_t  g_dmac_ext = { .channel = 2U };
+static transfer_cfg_t          g_dmac_cfg = { .p_info = &g_dmac_info, .irq_ipl = BSP_IRQ_DISABLED,
+                                              .p_extend = &g_dmac_ext };
+static transfer_instance_t     g_dmac     = { .p_ctrl = &g_dmac_ctrl, .p_cfg = &g_dmac_cfg,
+                                              .p_api = &g_transfer_on_dmac };
+
+/** Packed surface of a format over p_memory. */
+static blit_surface_t bench_blit_surface (uint32_t * p_memory, display_in_format_t format)
+{
+    blit_surface_t surface =
+    {
+        .p_base = p_memory,
+        .width  = BENCH_BLIT_WIDTH,
+        .height = BENCH_BLIT_HEIGHT,
+        .stride = BENCH_BLIT_WIDTH * blit_reference_bytes(format),
+        .format = format,
+        .p_clut = g_clut,
+    };
+
+    return surface;
+}
+
+/** One operation on the whole surface with the blitter or with the reference. */
+static void bench_blit_run (bench_blit_case_t const * p_case, blit_surface_t const * p_dest,
+                            blit_surface_t const * p_src, bool reference)
+{
+    switch (p_case->op)
+    {
+        case BENCH_BLIT_OP_FILL:
+            if (reference)
+            {
+                blit_reference_fill(p_dest, NULL, 0x80402010U);
+            }
+            else
+            {
+                (void) g_blit_on_blit.fill(&g_blit_ctrl, p_dest, NULL, 0x80402010U);
+            }
+            break;
+
+        case BENCH_BLIT_OP_COPY:
+            if (reference)
+            {
+                blit_reference_copy(p_dest, 0, 0, p_src, NULL);
+            }
+            else
+            {
+                (void) g_blit_on_blit.copy(&g_blit_ctrl, p_dest, 0, 0, p_src, NULL);
+            }
+            break;
+
+        case BENCH_BLIT_OP_BLEND:
+            if (reference)
+            {
+                blit_reference_blend(p_dest, 0, 0, p_src, NULL, p_case->alpha);
+            }
+            else
+            {
+                (void) g_blit_on_blit.blend(&g_blit_ctrl, p_dest, 0, 0, p_src, NULL, p_case->alpha);
+            }
+            break;
+
+        default: /* BENCH_BLIT_OP_CONVERT */
+            if (reference)
+            {
+                blit_reference_convert(p_dest, 0, 0, p_src, NULL);
+            }
+            else
+            {
+                (void) g_blit_on_blit.convert(&g_blit_ctrl, p_dest, 0, 0, p_src, NULL);
+            }
+            break;
+    }
+}
+
+/** Mpixel/s of an operation with the blitter or with the reference. */
+static double bench_blit_rate (bench_blit_case_t const * p_case, bool reference)
+{
+    blit_cfg_t cfg =
+    {
+        .p_transfer          = p_case->dma ? &g_dmac : NULL,
+        .dma_threshold_bytes = 0U,
+    };
+
+    if (SSP_SUCCESS != g_blit_on_blit.open(&g_blit_ctrl, &cfg))
+    {
+        return 0.0;
+    }
+
+    blit_surface_t dest   = bench_blit_surface(g_dest, p_case->dest);
+    blit_surface_t src    = bench_blit_surface(g_src, p_case->src);
+    uint64_t       pixels = 0U;
+    double         start  = host_test_seconds();
+    double         elapsed;
+    do
+    {
+        bench_blit_run(p_case, &dest, &src, reference);
+        pixels += BENCH_BLIT_WIDTH * BENCH_BLIT_HEIGHT;
+        elapsed = host_test_seconds() - start;
+    } while (elapsed < BENCH_BLIT_MIN_SECONDS);
+
+    g_blit_on_blit.close(&g_blit_ctrl);
+
+    return ((double) pixels / elapsed) / 1e6;
+}
+
+int main (void)
+{
+    static const bench_blit_case_t cases[] =
+    {
+        { "fill",    BENCH_BLIT_OP_FILL,    DISPLAY_IN_FORMAT_32BITS_ARGB8888, DISPLAY_IN_FORMAT_32BITS_ARGB8888,
+          false, 255U },
+        { "fill",    BENCH_BLIT_OP_FILL,    DISPLAY_IN_FORMAT_16BITS_RGB565,   DISPLAY_IN_FORMAT_16BITS_RGB565,
+          false, 255U },
+        { "copy",    BENCH_BLIT_OP_COPY,    DISPLAY_IN_FORMAT_32BITS_ARGB8888, DISPLAY_IN_FORMAT_32BITS_ARGB8888,
+          false, 255U },
+        { "copy",    BENCH_BLIT_OP_COPY,    DISPLAY_IN_FORMAT_32BITS_ARGB8888, DISPLAY_IN_FORMAT_32BITS_ARGB8888,
+          true,  255U },
+        { "copy",    BENCH_BLIT_OP_COPY,    DISPLAY_IN_FORMAT_16BITS_RGB565,   DISPLAY_IN_FORMAT_16BITS_RGB565,
+          false, 255U },
+        { "copy",    BENCH_BLIT_OP_COPY,    DISPLAY_IN_FORMAT_16BITS_RGB565,   DISPLAY_IN_FORMAT_16BITS_RGB565,
+          true,  255U },
+        { "blend",   BENCH_BLIT_OP_BLEND,   DISPLAY_IN_FORMAT_32BITS_ARGB8888, DISPLAY_IN_FORMAT_32BITS_ARGB8888,
+          false, 255U },
+        { "blend",   BENCH_BLIT_OP_BLEND,   DISPLAY_IN_FORMAT_32BITS_ARGB8888, DISPLAY_IN_FORMAT_32BITS_ARGB8888,
+          false, 128U },
+        { "blend",   BENCH_BLIT_OP_BLEND,   DISPLAY_IN_FORMAT_16BITS_RGB565,   DISPLAY_IN_FORMAT_32BITS_ARGB8888,
+          false, 255U },
+        { "blend",   BENCH_BLIT_OP_BLEND,   DISPLAY_IN_FORMAT_16BITS_RGB565,   DISPLAY_IN_FORMAT_16BITS_ARGB4444,
+          false, 255U },
+        { "convert", BENCH_BLIT_OP_CONVERT, DISPLAY_IN_FORMAT_32BITS_ARGB8888, DISPLAY_IN_FORMAT_16BITS_RGB565,
+          false, 255U },
+        { "convert", BENCH_BLIT_OP_CONVERT, DISPLAY_IN_FORMAT_16BITS_RGB565,   DISPLAY_IN_FORMAT_32BITS_ARGB8888,
+          false, 255U },
+        { "convert", BENCH_BLIT_OP_CONVERT, DISPLAY_IN_FORMAT_16BITS_RGB565,   DISPLAY_IN_FORMAT_CLUT8,
+          false, 255U },
+    };
+
+    /** Indexed by display_in_format_t */
+    static char const * const formats[] =
+    {
+        "ARGB8888", "RGB888", "RGB565", "ARGB1555", "ARGB4444", "CLUT8",
+    };
+
+    if (SSP_SUCCESS != R_BSP_SimInit())
+    {
+        return EXIT_FAILURE;
+    }
+
+    for (uint32_t i = 0U; i < (sizeof(g_src) / sizeof(g_src[0])); i++)
+    {
+        g_src[i] = (i * 2654435761U) + 7U;
+    }
+    for (uint32_t i = 0U; i < (sizeof(g_clut) / sizeof(g_clut[0])); i++)
+    {
+        g_clut[i] = i * 0x01030507U;
+    }
+
+    printf("%ux%u pixels, BLIT_CFG_LINE_PIXELS %u, BLIT_CFG_DMA_THRESHOLD_BYTES %u\n\n", (unsigned) BENCH_BLIT_WIDTH,
+           (unsigned) BENCH_BLIT_HEIGHT, (unsigned) BLIT_CFG_LINE_PIXELS, (unsigned) BLIT_CFG_DMA_THRESHOLD_BYTES);
+    printf("%-8s %-9s %-9s %-5s %5s %12s %16s\n", "", "dest", "src", "DMAC", "alpha", "blit Mpx/s",
+           "reference Mpx/s");
+
+    for (uint32_t c = 0U; c < (sizeof(cases) / sizeof(cases[0])); c++)
+    {
+        double blit      = bench_blit_rate(&cases[c], false);
+        double reference = bench_blit_rate(&cases[c], true);
+
+        printf("%-8s %-9s %-9s %-5s %5u %12.2f %16.2f\n", cases[c].p_name, formats[cases[c].dest],
+               (BENCH_BLIT_OP_FILL == cases[c].op) ? "" : formats[cases[c].src], cases[c].dma ? "yes" : "no",
+               (unsigned) cases[c].alpha, blit, reference);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,147 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : bench_crc.c
+ * Description  : Throughput of the CRC engines in MB/s per buffer size: the slice-by-8 software tables, the CRC
+ *                calculator fed from the CPU and the CRC calculator fed by the DMAC. Prints the smallest size from
+ *                which the CRC calculator is faster than the tables, the value CRC_CFG_HW_THRESHOLD_BYTES tunes.
+ *
+ *                On the host the CRC calculator and the DMAC are register models, so the crossover reflects the cost
+ *                of the driver's register accesses rather than of the silicon. Build the same program for the target
+ *                to tune the thresholds for a board.
+ **********************************************************************************************************************/
+
+#include <stdlib.h>
+
+#include "bsp_api.h"
+#include "r_crc.h"
+#include "r_dmac.h"
+#include "host_test.h"
+
+#define BENCH_CRC_MAX_BYTES      (16384U)
+#define BENCH_CRC_MIN_SECONDS    (0.02)
+
+static uint8_t                 g_buffer[BENCH_CRC_MAX_BYTES];
+static crc_instance_ctrl_t     g_crc_ctrl;
+static transfer_info_t         g_dmac_info;
+static dmac_instance_ctrl_t    g_dmac_ctrl;
+static transfer_on_dmac_cfg_t  g_dmac_ext = { .channel = 1U };
+static transfer_cfg_t          g_dmac_cfg = { .p_info = &g_dmac_info, .irq_ipl = BSP_IRQ_DISABLED,
+                                              .p_extend = &g_dmac_ext };
+static transfer_instance_t     g_dmac     = { .p_ctrl = &g_dmac_ctrl, .p_cfg = &g_dmac_cfg,
+                                              .p_api = &g_transfer_on_dmac };
+
+/** MB/s of calculate calls on size bytes with engine 0 (tables), 1 (CRC calculator) or 2 (DMAC feed). */
+static double bench_crc_rate (crc_polynomial_t polynomial, uint32_t engine, uint32_t size)
+{
+    crc_on_crc_cfg_t ext =
+    {
+        .engine              = (0U == engine) ? CRC_ENGINE_SOFTWARE : CRC_ENGINE_HARDWARE,
+        .p_transfer          = (2U == engine) ? &g_dmac : NULL,
+        .dma_threshold_bytes = 1U,
+    };
+    crc_cfg_t cfg =
+    {
+        .polynomial = polynomial,
+        .bit_order  = CRC_BIT_ORDER_LMS_LSB,
+        .p_extend   = &ext,
+    };
+
+    if (SSP_SUCCESS != g_crc_on_crc.open(&g_crc_ctrl, &cfg))
+    {
+        return 0.0;
+    }
+
+    uint32_t value = 0U;
+    uint64_t bytes = 0U;
+    double   start = host_test_seconds();
+    double   elapsed;
+    do
+    {
+        for (uint32_t i = 0U; i < 16U; i++)
+        {
+            g_crc_on_crc.calculate(&g_crc_ctrl, g_buffer, size, value, &value);
+            bytes += size;
+        }
+        elapsed = host_test_seconds() - start;
+    } while (elapsed < BENCH_CRC_MIN_SECONDS);
+
+    g_crc_on_crc.close(&g_crc_ctrl);
+
+    return ((double) bytes / elapsed) / 1e6;
+}
+
+int main (void)
+{
+    static const struct
+    {
+        crc_polynomial_t polynomial;
+        char const     * p_name;
+    } polynomials[] =
+    {
+        { CRC_POLYNOMIAL_CRC_8,  "CRC-8"  },
+        { CRC_POLYNOMIAL_CRC_16, "CRC-16" },
+        { CRC_POLYNOMIAL_CRC_32, "CRC-32" },
+    };
+
+    if (SSP_SUCCESS != R_BSP_SimInit())
+    {
+        return EXIT_FAILURE;
+    }
+
+    for (uint32_t i = 0U; i < sizeof(g_buffer); i++)
+    {
+        g_buffer[i] = (uint8_t) ((i * 131U) + 7U);
+    }
+
+    printf("CRC_CFG_HW_THRESHOLD_BYTES %u, CRC_CFG_DMA_THRESHOLD_BYTES %u\n",
+           (unsigned) CRC_CFG_HW_THRESHOLD_BYTES, (unsigned) CRC_CFG_DMA_THRESHOLD_BYTES);
+
+    for (uint32_t p = 0U; p < (sizeof(polynomials) / sizeof(polynomials[0])); p++)
+    {
+        uint32_t crossover = 0U;
+
+        printf("\n%-8s %8s %12s %12s %12s\n", polynomials[p].p_name, "bytes", "tables MB/s", "CRC MB/s",
+               "DMAC MB/s");
+        for (uint32_t size = 4U; size <= BENCH_CRC_MAX_BYTES; size *= 2U)
+        {
+            double software = bench_crc_rate(polynomials[p].polynomial, 0U, size);
+            double hardware = bench_crc_rate(polynomials[p].polynomial, 1U, size);
+            double dmac     = bench_crc_rate(polynomials[p].polynomial, 2U, size);
+
+            printf("%-8s %8u %12.2f %12.2f %12.2f\n", "", (unsigned) size, software, hardware, dmac);
+            if ((0U == crossover) && (hardware > software))
+            {
+                crossover = size;
+            }
+        }
+
+        if (0U == crossover)
+        {
+            printf("%-8s the tables are faster at every size\n", polynomials[p].p_name);
+        }
+        else
+        {
+            printf("%-8s the CRC calculator is faster from %u bytes\n", polynomials[p].p_name, (unsigned) crossover);
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
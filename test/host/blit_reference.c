@@ -0,0 +1,285 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : blit_reference.c
+ * Description  : Pixel by pixel reference of the blitter operations. Every pixel is clipped, read, computed and
+ *                stored on its own, one channel at a time, so the code shares nothing with the lane arithmetic and
+ *                line chunks of r_blit.c.
+ **********************************************************************************************************************/
+
+#include <string.h>
+
+#include "blit_reference.h"
+
+/** Operation applied to each pixel of a rectangle. */
+typedef enum e_blit_reference_op
+{
+    BLIT_REFERENCE_OP_COPY,
+    BLIT_REFERENCE_OP_BLEND,
+    BLIT_REFERENCE_OP_CONVERT,
+} blit_reference_op_t;
+
+/** Widen a channel of bits bits to 8 bits by repeating its high bits. */
+static uint32_t blit_reference_widen (uint32_t value, uint32_t bits)
+{
+    uint32_t wide = value << (8U - bits);
+    while (bits < 8U)
+    {
+        wide  |= wide >> bits;
+        bits  *= 2U;
+    }
+
+    return wide & 0xFFU;
+}
+
+/** Channel c (0 blue, 1 green, 2 red, 3 alpha) of an ARGB8888 color. */
+static uint32_t blit_reference_channel (uint32_t argb, uint32_t c)
+{
+    return (argb >> (8U * c)) & 0xFFU;
+}
+
+/** round(x / 255), x / 255 is never halfway between two integers. */
+static uint32_t blit_reference_div255 (uint32_t x)
+{
+    return (x + 127U) / 255U;
+}
+
+static uint8_t * blit_reference_pixel (blit_surface_t const * p_surface, int32_t x, int32_t y)
+{
+    return (uint8_t *) p_surface->p_base + ((uint32_t) y * p_surface->stride) +
+           ((uint32_t) x * blit_reference_bytes(p_surface->format));
+}
+
+static bool blit_reference_inside (blit_surface_t const * p_surface, int32_t x, int32_t y)
+{
+    return (x >= 0) && (y >= 0) && (x < (int32_t) p_surface->width) && (y < (int32_t) p_surface->height);
+}
+
+uint32_t blit_reference_bytes (display_in_format_t format)
+{
+    switch (format)
+    {
+        case DISPLAY_IN_FORMAT_32BITS_ARGB8888:
+        case DISPLAY_IN_FORMAT_32BITS_RGB888:
+            return 4U;
+
+        case DISPLAY_IN_FORMAT_CLUT8:
+            return 1U;
+
+        default:
+            return 2U;
+    }
+}
+
+uint32_t blit_reference_get (blit_surface_t const * p_surface, int32_t x, int32_t y)
+{
+    uint8_t const * p_pixel = blit_reference_pixel(p_surface, x, y);
+    uint32_t        word    = 0U;
+    uint16_t        half    = 0U;
+    uint32_t        a       = 0xFFU;
+    uint32_t        r;
+    uint32_t        g;
+    uint32_t        b;
+
+    switch (p_surface->format)
+    {
+        case DISPLAY_IN_FORMAT_32BITS_ARGB8888:
+            memcpy(&word, p_pixel, sizeof(word));
+            return word;
+
+        case DISPLAY_IN_FORMAT_32BITS_RGB888:
+            memcpy(&word, p_pixel, sizeof(word));
+            return word | 0xFF000000U;
+
+        case DISPLAY_IN_FORMAT_CLUT8:
+            return p_surface->p_clut[*p_pixel];
+
+        case DISPLAY_IN_FORMAT_16BITS_RGB565:
+            memcpy(&half, p_pixel, sizeof(half));
+            r = blit_reference_widen((half >> 11) & 0x1FU, 5U);
+            g = blit_reference_widen((half >> 5) & 0x3FU, 6U);
+            b = blit_reference_widen(half & 0x1FU, 5U);
+            break;
+
+        case DISPLAY_IN_FORMAT_16BITS_ARGB1555:
+            memcpy(&half, p_pixel, sizeof(half));
+            a = blit_reference_widen((half >> 15) & 0x1U, 1U);
+            r = blit_reference_widen((half >> 10) & 0x1FU, 5U);
+            g = blit_reference_widen((half >> 5) & 0x1FU, 5U);
+            b = blit_reference_widen(half & 0x1FU, 5U);
+            break;
+
+        default: /* DISPLAY_IN_FORMAT_16BITS_ARGB4444 */
+            memcpy(&half, p_pixel, sizeof(half));
+            a = blit_reference_widen((half >> 12) & 0xFU, 4U);
+            r = blit_reference_widen((half >> 8) & 0xFU, 4U);
+            g = blit_reference_widen((half >> 4) & 0xFU, 4U);
+            b = blit_reference_widen(half & 0xFU, 4U);
+            break;
+    }
+
+    return (a << 24) | (r << 16) | (g << 8) | b;
+}
+
+void blit_reference_put (blit_surface_t const * p_surface, int32_t x, int32_t y, uint32_t color)
+{
+    uint8_t * p_pixel = blit_reference_pixel(p_surface, x, y);
+    uint32_t  a       = blit_reference_channel(color, 3U);
+    uint32_t  r       = blit_reference_channel(color, 2U);
+    uint32_t  g       = blit_reference_channel(color, 1U);
+    uint32_t  b       = blit_reference_channel(color, 0U);
+    uint32_t  word    = color;
+    uint16_t  half;
+
+    switch (p_surface->format)
+    {
+        case DISPLAY_IN_FORMAT_32BITS_ARGB8888:
+            memcpy(p_pixel, &word, sizeof(word));
+            return;
+
+        case DISPLAY_IN_FORMAT_32BITS_RGB888:
+            word |= 0xFF000000U;
+            memcpy(p_pixel, &word, sizeof(word));
+            return;
+
+        case DISPLAY_IN_FORMAT_CLUT8:
+            *p_pixel = (uint8_t) color;
+            return;
+
+        case DISPLAY_IN_FORMAT_16BITS_RGB565:
+            half = (uint16_t) (((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+            break;
+
+        case DISPLAY_IN_FORMAT_16BITS_ARGB1555:
+            half = (uint16_t) (((a >> 7) << 15) | ((r >> 3) << 10) | ((g >> 3) << 5) | (b >> 3));
+            break;
+
+        default: /* DISPLAY_IN_FORMAT_16BITS_ARGB4444 */
+            half = (uint16_t) (((a >> 4) << 12) | ((r >> 4) << 8) | ((g >> 4) << 4) | (b >> 4));
+            break;
+    }
+
+    memcpy(p_pixel, &half, sizeof(half));
+}
+
+/** Source over destination with the source alpha scaled by the global alpha. The source alpha channel counts as 255. */
+static uint32_t blit_reference_over (uint32_t dest, uint32_t src, uint8_t alpha)
+{
+    uint32_t a      = blit_reference_channel(src, 3U);
+    uint32_t result = 0U;
+
+    if (255U != alpha)
+    {
+        a = blit_reference_div255(a * alpha);
+    }
+
+    for (uint32_t c = 0U; c < 4U; c++)
+    {
+        uint32_t s = (3U == c) ? 255U : blit_reference_channel(src, c);
+        uint32_t d = blit_reference_channel(dest, c);
+        result |= blit_reference_div255((s * a) + (d * (255U - a))) << (8U * c);
+    }
+
+    return result;
+}
+
+static void blit_reference_apply (blit_surface_t const * p_dest, int32_t x, int32_t y, blit_surface_t const * p_src,
+                                  blit_rect_t const * p_rect, blit_reference_op_t op, uint8_t alpha)
+{
+    blit_rect_t rect = {0, 0, p_src->width, p_src->height};
+    if (NULL != p_rect)
+    {
+        rect = *p_rect;
+    }
+
+    for (int32_t j = 0; j < (int32_t) rect.height; j++)
+    {
+        for (int32_t i = 0; i < (int32_t) rect.width; i++)
+        {
+            int32_t sx = rect.x + i;
+            int32_t sy = rect.y + j;
+            int32_t dx = x + i;
+            int32_t dy = y + j;
+            if ((!blit_reference_inside(p_src, sx, sy)) || (!blit_reference_inside(p_dest, dx, dy)))
+            {
+                continue;
+            }
+
+            if (BLIT_REFERENCE_OP_COPY == op)
+            {
+                memcpy(blit_reference_pixel(p_dest, dx, dy), blit_reference_pixel(p_src, sx, sy),
+                       blit_reference_bytes(p_src->format));
+            }
+            else if (BLIT_REFERENCE_OP_BLEND == op)
+            {
+                blit_reference_put(p_dest, dx, dy,
+                                   blit_reference_over(blit_reference_get(p_dest, dx, dy),
+                                                       blit_reference_get(p_src, sx, sy), alpha));
+            }
+            else
+            {
+                blit_reference_put(p_dest, dx, dy, blit_reference_get(p_src, sx, sy));
+            }
+        }
+    }
+}
+
+void blit_reference_fill (blit_surface_t const * p_dest, blit_rect_t const * p_rect, uint32_t color)
+{
+    blit_rect_t rect = {0, 0, p_dest->width, p_dest->height};
+    if (NULL != p_rect)
+    {
+        rect = *p_rect;
+    }
+
+    for (int32_t j = 0; j < (int32_t) rect.height; j++)
+    {
+        for (int32_t i = 0; i < (int32_t) rect.width; i++)
+        {
+            if (blit_reference_inside(p_dest, rect.x + i, rect.y + j))
+            {
+                blit_reference_put(p_dest, rect.x + i, rect.y + j, color);
+            }
+        }
+    }
+}
+
+void blit_reference_copy (blit_surface_t const * p_dest, int32_t x, int32_t y, blit_surface_t const * p_src,
+                          blit_rect_t const * p_rect)
+{
+    blit_reference_apply(p_dest, x, y, p_src, p_rect, BLIT_REFERENCE_OP_COPY, 255U);
+}
+
+void blit_reference_blend (blit_surface_t const * p_dest, int32_t x, int32_t y, blit_surface_t const * p_src,
+                           blit_rect_t const * p_rect, uint8_t alpha)
+{
+    if (0U != alpha)
+    {
+        blit_reference_apply(p_dest, x, y, p_src, p_rect, BLIT_REFERENCE_OP_BLEND, alpha);
+    }
+}
+
+void blit_reference_convert (blit_surface_t const * p_dest, int32_t x, int32_t y, blit_surface_t const * p_src,
+                             blit_rect_t const * p_rect)
+{
+    blit_reference_apply(p_dest, x, y, p_src, p_rect,
+                         (p_dest->format == p_src->format) ? BLIT_REFERENCE_OP_COPY : BLIT_REFERENCE_OP_CONVERT,
+                         255U);
+}
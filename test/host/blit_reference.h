@@ -0,0 +1,50 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : blit_reference.h
+ * Description  : Pixel by pixel reference of the blitter operations, written from the blitter interface
+ *                documentation for the host tests and benchmarks.
+ **********************************************************************************************************************/
+
+#ifndef BLIT_REFERENCE_H
+#define BLIT_REFERENCE_H
+
+#include "r_blit_api.h"
+
+/** Bytes per pixel of a format, not CLUT4 or CLUT1. */
+uint32_t blit_reference_bytes(display_in_format_t format);
+
+/** Read pixel x, y of a surface as ARGB8888. */
+uint32_t blit_reference_get(blit_surface_t const * p_surface, int32_t x, int32_t y);
+
+/** Store an ARGB8888 color at pixel x, y of a surface, or the color index for CLUT8. */
+void blit_reference_put(blit_surface_t const * p_surface, int32_t x, int32_t y, uint32_t color);
+
+/** Operations of blit_api_t with the same arguments, on the pixels inside both surfaces. Arguments the driver rejects
+ *  are not checked. */
+void blit_reference_fill(blit_surface_t const * p_dest, blit_rect_t const * p_rect, uint32_t color);
+void blit_reference_copy(blit_surface_t const * p_dest, int32_t x, int32_t y, blit_surface_t const * p_src,
+                         blit_rect_t const * p_rect);
+void blit_reference_blend(blit_surface_t const * p_dest, int32_t x, int32_t y, blit_surface_t const * p_src,
+                          blit_rect_t const * p_rect, uint8_t alpha);
+void blit_reference_convert(blit_surface_t const * p_dest, int32_t x, int32_t y, blit_surface_t const * p_src,
+                            blit_rect_t const * p_rect);
+
+#endif /* BLIT_REFERENCE_H */
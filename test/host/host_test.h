@@ -0,0 +1,74 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : host_test.h
+ * Description  : Check macros shared by the s5d9_sdk_host tests.
+ **********************************************************************************************************************/
+
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+/** Number of failed checks in this test program.  Marked unused for files that include this header for
+ *  host_test_seconds() only. */
+static uint32_t g_host_test_failures __attribute__((unused));
+
+/** Record a failed check without stopping the test. */
+#define HOST_TEST_CHECK(cond)                                                               \
+    do                                                                                      \
+    {                                                                                       \
+        if (!(cond))                                                                        \
+        {                                                                                   \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);                 \
+            g_host_test_failures++;                                                         \
+        }                                                                                   \
+    } while (0)
+
+/** Record a failed check when two integers differ, printing both. */
+#define HOST_TEST_CHECK_EQUAL(expected, actual)                                             \
+    do                                                                                      \
+    {                                                                                       \
+        long long host_test_e = (long long) (expected);                                     \
+        long long host_test_a = (long long) (actual);                                       \
+        if (host_test_e != host_test_a)                                                     \
+        {                                                                                   \
+            printf("%s:%d: %s is %lld, expected %lld\n", __FILE__, __LINE__, #actual,       \
+                   host_test_a, host_test_e);                                               \
+            g_host_test_failures++;                                                         \
+        }                                                                                   \
+    } while (0)
+
+/** Exit code for main: 0 when every check passed. */
+#define HOST_TEST_RESULT()    ((0U == g_host_test_failures) ? 0 : 1)
+
+/** Monotonic time in seconds, for benchmarks. */
+static inline double host_test_seconds (void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (double) now.tv_sec + ((double) now.tv_nsec * 1e-9);
+}
+
+#endif /* HOST_TEST_H */
@@ -0,0 +1,529 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : test_adc_periodic.c
+ * Description  : ADC periodic framework on the ADC, GPT and DTC drivers: the timer overflow linked to the ADC0 scan
+ *                trigger, whole scans copied by a block mode DTC model into a ring that the CPU only sees once per
+ *                block, raw, averaged and FIR decimated blocks in order across block boundaries, and overruns and
+ *                stop/close with deferred callbacks. CMSIS-DSP is not part of the tree, so the FIR decimator used by
+ *                the framework is a plain C version of arm_fir_decimate_q15 defined here.
+ **********************************************************************************************************************/
+
+#include <string.h>
+
+#include "bsp_api.h"
+#include "r_adc.h"
+#include "r_gpt.h"
+#include "r_dtc.h"
+#include "r_elc.h"
+#include "sf_adc_periodic.h"
+#include "host_test.h"
+
+#define TEST_ADC_SCAN_MASK       ((1U << 1) | (1U << 2) | (1U << 4))   ///< Channels 1, 2 and 4, channel 3 is skipped
+#define TEST_ADC_LOWEST          (1U)
+#define TEST_ADC_STRIDE          (4U)       ///< Data registers from channel 1 to channel 4
+#define TEST_ADC_CHANNELS        (3U)
+#define TEST_FRAMES              (8U)
+#define TEST_BLOCKS              (3U)
+#define TEST_DECIMATION          (2U)
+#define TEST_Q15_SHIFT           (3U)
+#define TEST_FIR_TAPS            (5U)
+#define TEST_RECORDS_MAX         (32U)
+#define TEST_OUTPUT_SAMPLES      (SF_ADC_PERIODIC_OUTPUT_SAMPLES(TEST_ADC_CHANNELS, TEST_FRAMES, TEST_DECIMATION))
+
+SSP_VECTOR_DEFINE_CHAN(adc_scan_end_isr, ADC, SCAN_END, 0);
+
+/** One callback, with copies of the blocks it pointed at. */
+typedef struct st_test_record
+{
+    sf_adc_periodic_event_t event;
+    uint32_t                block;
+    uint32_t                blocks_lost;
+    uint32_t                frames;
+    uint32_t                channels;
+    uint32_t                raw_stride;
+    uint16_t const        * p_raw;
+    bool                    has_data;
+    uint16_t                raw[TEST_ADC_STRIDE * TEST_FRAMES];
+    int16_t                 data[TEST_OUTPUT_SAMPLES];
+} test_record_t;
+
+static uint8_t               g_slot[TEST_ADC_CHANNELS] = { 0U, 1U, 3U };
+static int16_t const         g_fir_coeffs[TEST_FIR_TAPS] = { 1000, -2000, 12000, 9000, 3000 };
+static uint16_t              g_ring[TEST_ADC_STRIDE * TEST_FRAMES * TEST_BLOCKS];
+static int16_t               g_fir_state[SF_ADC_PERIODIC_FIR_STATE_SAMPLES(TEST_ADC_CHANNELS, TEST_FIR_TAPS,
+                                                                           TEST_FRAMES)];
+static int16_t               g_scratch[SF_ADC_PERIODIC_SCRATCH_SAMPLES(TEST_FRAMES, TEST_DECIMATION)];
+static int16_t               g_output[TEST_OUTPUT_SAMPLES];
+static test_record_t         g_records[TEST_RECORDS_MAX];
+static uint32_t              g_record_count;
+static uint32_t              g_scans;       ///< Scans since the last start, numbers the results of each scan
+
+static adc_instance_ctrl_t   g_adc_ctrl;
+static adc_cfg_t             g_adc_cfg =
+{
+    .unit           = 0U,
+    .mode           = ADC_MODE_SINGLE_SCAN,
+    .resolution     = ADC_RESOLUTION_12_BIT,
+    .alignment      = ADC_ALIGNMENT_RIGHT,
+    .trigger        = ADC_TRIGGER_SYNC_ELC,
+    .scan_end_ipl   = 2U,
+    .scan_end_b_ipl = BSP_IRQ_DISABLED,
+    .calib_adc_skip = true,
+};
+static adc_channel_cfg_t     g_adc_channel_cfg = { .scan_mask = TEST_ADC_SCAN_MASK };
+static adc_instance_t        g_adc = { .p_ctrl = &g_adc_ctrl, .p_cfg = &g_adc_cfg,
+                                       .p_channel_cfg = &g_adc_channel_cfg, .p_api = &g_adc_on_adc };
+
+static gpt_instance_ctrl_t   g_timer_ctrl;
+static timer_on_gpt_cfg_t    g_timer_ext;
+static timer_cfg_t           g_timer_cfg = { .mode = TIMER_MODE_PERIODIC, .period = 100U,
+                                             .unit = TIMER_UNIT_PERIOD_USEC, .channel = 0U,
+                                             .irq_ipl = BSP_IRQ_DISABLED, .p_extend = &g_timer_ext };
+static timer_instance_t      g_timer = { .p_ctrl = &g_timer_ctrl, .p_cfg = &g_timer_cfg, .p_api = &g_timer_on_gpt };
+
+static transfer_info_t       g_dtc_info;
+static dtc_instance_ctrl_t   g_dtc_ctrl;
+static transfer_cfg_t        g_dtc_cfg = { .p_info = &g_dtc_info, .irq_ipl = BSP_IRQ_DISABLED };
+static transfer_instance_t   g_dtc = { .p_ctrl = &g_dtc_ctrl, .p_cfg = &g_dtc_cfg, .p_api = &g_transfer_on_dtc };
+
+static sf_adc_periodic_instance_ctrl_t g_periodic_ctrl;
+
+/** Q15 FIR decimator with the arithmetic of arm_fir_decimate_q15: each output is the dot product of the coefficients
+ *  with the numTaps inputs ending at every Mth input, accumulated in 64 bits, shifted right by 15 and saturated. The
+ *  last numTaps - 1 inputs are kept in the state for the next block. */
+arm_status arm_fir_decimate_init_q15 (arm_fir_decimate_instance_q15 * S, uint16_t numTaps, uint8_t M,
+                                      const q15_t * pCoeffs, q15_t * pState, uint32_t blockSize)
+{
+    if ((0U == M) || (0U != (blockSize % M)))
+    {
+        return ARM_MATH_LENGTH_ERROR;
+    }
+
+    S->M       = M;
+    S->numTaps = numTaps;
+    S->pCoeffs = pCoeffs;
+    S->pState  = pState;
+    memset(pState, 0, ((numTaps + blockSize) - 1U) * sizeof(q15_t));
+
+    return ARM_MATH_SUCCESS;
+}
+
+void arm_fir_decimate_q15 (const arm_fir_decimate_instance_q15 * S, const q15_t * pSrc, q15_t * pDst,
+                           uint32_t blockSize)
+{
+    q15_t * p_window  = S->pState;
+    q15_t * p_current = &S->pState[S->numTaps - 1U];
+
+    for (uint32_t o = 0U; o < (blockSize / S->M); o++)
+    {
+        for (uint32_t i = 0U; i < S->M; i++)
+        {
+            *p_current++ = *pSrc++;
+        }
+
+        int64_t acc = 0;
+        for (uint32_t k = 0U; k < S->numTaps; k++)
+        {
+            acc += (int32_t) p_window[k] * S->pCoeffs[k];
+        }
+        p_window += S->M;
+
+        acc    >>= 15;
+        acc      = (acc > INT16_MAX) ? INT16_MAX : ((acc < INT16_MIN) ? INT16_MIN : acc);
+        *pDst++  = (q15_t) acc;
+    }
+
+    memmove(S->pState, p_window, (S->numTaps - 1U) * sizeof(q15_t));
+}
+
+/** 12-bit result of the data register at offset reg from the lowest scanned channel in scan number scan. */
+static uint16_t test_adc_result (uint32_t scan, uint32_t reg)
+{
+    return (uint16_t) (((scan * 37U) + (reg * 1000U) + 5U) & 0xFFFU);
+}
+
+/** DTC model for the scan end transfer: one block of CRAL results from the data registers to the ring per scan, the
+ *  source area repeats and the destination advances. The CPU is interrupted when the block count ends, and DTCE is
+ *  cleared then. */
+static bool test_dtc_model (elc_event_t event, void * p_context)
+{
+    SSP_PARAMETER_NOT_USED(p_context);
+
+    if (ELC_EVENT_ADC0_SCAN_END != event)
+    {
+        return true;
+    }
+
+    dtc_reg_t * p_reg = (dtc_reg_t *) &g_dtc_info;
+    HOST_TEST_CHECK(TRANSFER_MODE_BLOCK == g_dtc_info.mode);
+    HOST_TEST_CHECK(TRANSFER_REPEAT_AREA_SOURCE == g_dtc_info.repeat_area);
+    HOST_TEST_CHECK_EQUAL(TEST_ADC_STRIDE, p_reg->CRA_b.CRAL);
+    HOST_TEST_CHECK(0U != p_reg->CRB);
+
+    uint16_t const volatile * p_src  = (uint16_t const volatile *) g_dtc_info.p_src;
+    uint16_t                * p_dest = (uint16_t *) g_dtc_info.p_dest;
+    HOST_TEST_CHECK(p_dest >= g_ring);
+    HOST_TEST_CHECK(&p_dest[p_reg->CRA_b.CRAL] <= &g_ring[sizeof(g_ring) / sizeof(g_ring[0])]);
+    for (uint32_t i = 0U; i < p_reg->CRA_b.CRAL; i++)
+    {
+        p_dest[i] = p_src[i];
+    }
+    g_dtc_info.p_dest = &p_dest[p_reg->CRA_b.CRAL];
+    p_reg->CRB--;
+    if (0U != p_reg->CRB)
+    {
+        return false;
+    }
+
+    for (uint32_t irq = 0U; irq < BSP_VECTOR_TABLE_MAX_ENTRIES; irq++)
+    {
+        if ((R_ICU->IELSRn[irq] & 0x1FFU) == (uint32_t) event)
+        {
+            R_ICU->IELSRn[irq] &= ~(1UL << 24);
+        }
+    }
+
+    return true;
+}
+
+/** One timer period. The overflow starts a scan only while the timer is open and counts, its event is linked to the
+ *  ADC0 trigger and the ADC trigger is enabled. The scan fills the data registers from the lowest to the highest
+ *  scanned channel, including channel 3, and ends with the scan end event. Returns true if a scan ran. */
+static bool test_adc_period (void)
+{
+    timer_info_t info;
+    if ((SSP_SUCCESS != g_timer_on_gpt.infoGet(&g_timer_ctrl, &info)) || (TIMER_STATUS_COUNTING != info.status) ||
+        (ELC_EVENT_GPT0_COUNTER_OVERFLOW != R_ELC->ELSRnRC0[ELC_PERIPHERAL_ADC0].ELSRn) ||
+        (0U == R_S12ADC0->ADCSR_b.TRGE))
+    {
+        return false;
+    }
+
+    for (uint32_t reg = 0U; reg < TEST_ADC_STRIDE; reg++)
+    {
+        *(uint16_t volatile *) &R_S12ADC0->ADDRn[TEST_ADC_LOWEST + reg] = test_adc_result(g_scans, reg);
+    }
+    g_scans++;
+    R_BSP_SimEventRaise(ELC_EVENT_ADC0_SCAN_END);
+    R_BSP_SimIrqDispatch();
+
+    return true;
+}
+
+/** Runs count timer periods that each start a scan. */
+static void test_adc_scans (uint32_t count)
+{
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        HOST_TEST_CHECK(test_adc_period());
+    }
+}
+
+static void test_periodic_callback (sf_adc_periodic_callback_args_t * p_args)
+{
+    HOST_TEST_CHECK(g_record_count < TEST_RECORDS_MAX);
+    if (g_record_count >= TEST_RECORDS_MAX)
+    {
+        return;
+    }
+
+    test_record_t * p_record = &g_records[g_record_count++];
+    memset(p_record, 0, sizeof(*p_record));
+    p_record->event       = p_args->event;
+    p_record->block       = p_args->block;
+    p_record->blocks_lost = p_args->blocks_lost;
+    p_record->frames      = p_args->frames;
+    p_record->channels    = p_args->channels;
+    p_record->raw_stride  = p_args->raw_stride;
+    p_record->p_raw       = p_args->p_raw;
+    HOST_TEST_CHECK(&g_periodic_ctrl == p_args->p_context);
+    if (NULL != p_args->p_raw)
+    {
+        memcpy(p_record->raw, p_args->p_raw, sizeof(p_record->raw));
+    }
+    p_record->has_data = (NULL != p_args->p_data);
+    if (p_record->has_data)
+    {
+        memcpy(p_record->data, p_args->p_data, p_args->frames * p_args->channels * sizeof(int16_t));
+    }
+}
+
+static sf_adc_periodic_cfg_t g_periodic_cfg =
+{
+    .p_lower_lvl_adc      = &g_adc,
+    .p_lower_lvl_timer    = &g_timer,
+    .p_lower_lvl_transfer = &g_dtc,
+    .p_ring               = g_ring,
+    .ring_samples         = sizeof(g_ring) / sizeof(g_ring[0]),
+    .frames_per_block     = TEST_FRAMES,
+    .block_count          = TEST_BLOCKS,
+    .decimation           = TEST_DECIMATION,
+    .q15_shift            = TEST_Q15_SHIFT,
+    .p_fir_coeffs         = g_fir_coeffs,
+    .fir_taps             = TEST_FIR_TAPS,
+    .p_fir_state          = g_fir_state,
+    .p_scratch            = g_scratch,
+    .p_output             = g_output,
+    .p_callback           = test_periodic_callback,
+    .p_context            = &g_periodic_ctrl,
+};
+
+/** Opens the framework with filter and checks the ELC link and the DTC transfer it set up. */
+static void test_periodic_open (sf_adc_periodic_filter_t filter, bool deferred)
+{
+    g_periodic_cfg.filter            = filter;
+    g_periodic_cfg.deferred_callback = deferred;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_adc_periodic_on_sf_adc_periodic.open(&g_periodic_ctrl, &g_periodic_cfg));
+
+    HOST_TEST_CHECK_EQUAL(ELC_EVENT_GPT0_COUNTER_OVERFLOW, R_ELC->ELSRnRC0[ELC_PERIPHERAL_ADC0].ELSRn);
+    HOST_TEST_CHECK(TRANSFER_MODE_BLOCK == g_dtc_info.mode);
+    HOST_TEST_CHECK(TRANSFER_SIZE_2_BYTE == g_dtc_info.size);
+    HOST_TEST_CHECK(&R_S12ADC0->ADDRn[TEST_ADC_LOWEST] == g_dtc_info.p_src);
+    HOST_TEST_CHECK_EQUAL(TEST_FRAMES, g_dtc_info.num_blocks);
+    HOST_TEST_CHECK_EQUAL(ELC_EVENT_ADC0_SCAN_END, g_dtc_ctrl.trigger);
+
+    /** Nothing is scanned before start. */
+    HOST_TEST_CHECK(!test_adc_period());
+    g_record_count = 0U;
+}
+
+static void test_periodic_start (void)
+{
+    g_scans = 0U;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_adc_periodic_on_sf_adc_periodic.start(&g_periodic_ctrl));
+}
+
+static void test_periodic_close (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_adc_periodic_on_sf_adc_periodic.close(&g_periodic_ctrl));
+    HOST_TEST_CHECK_EQUAL(0U, R_ELC->ELSRnRC0[ELC_PERIPHERAL_ADC0].ELSRn);
+    HOST_TEST_CHECK(!test_adc_period());
+}
+
+/** Checks a block done record for block number block of the current run, with raw data from its scans. */
+static void test_check_block (test_record_t const * p_record, uint32_t block)
+{
+    HOST_TEST_CHECK(SF_ADC_PERIODIC_EVENT_BLOCK_DONE == p_record->event);
+    HOST_TEST_CHECK_EQUAL(block, p_record->block);
+    HOST_TEST_CHECK_EQUAL(0U, p_record->blocks_lost);
+    HOST_TEST_CHECK_EQUAL(TEST_ADC_CHANNELS, p_record->channels);
+    HOST_TEST_CHECK_EQUAL(TEST_ADC_STRIDE, p_record->raw_stride);
+    HOST_TEST_CHECK(&g_ring[(block % TEST_BLOCKS) * TEST_ADC_STRIDE * TEST_FRAMES] == p_record->p_raw);
+
+    uint32_t mismatches = 0U;
+    for (uint32_t frame = 0U; frame < TEST_FRAMES; frame++)
+    {
+        for (uint32_t reg = 0U; reg < TEST_ADC_STRIDE; reg++)
+        {
+            uint16_t expected = test_adc_result((block * TEST_FRAMES) + frame, reg);
+            mismatches += (expected != p_record->raw[(frame * TEST_ADC_STRIDE) + reg]) ? 1U : 0U;
+        }
+    }
+    HOST_TEST_CHECK_EQUAL(0U, mismatches);
+}
+
+/** The CPU only sees the end of each block, blocks arrive in order with the results of their scans, and a new run
+ *  starts again at the first block of the ring. */
+static void test_periodic_raw (void)
+{
+    test_periodic_open(SF_ADC_PERIODIC_FILTER_NONE, false);
+    test_periodic_start();
+
+    for (uint32_t scan = 0U; scan < ((5U * TEST_FRAMES) + 3U); scan++)
+    {
+        test_adc_scans(1U);
+        HOST_TEST_CHECK_EQUAL(g_scans / TEST_FRAMES, g_record_count);
+    }
+    HOST_TEST_CHECK_EQUAL(5U, g_record_count);
+    for (uint32_t block = 0U; block < g_record_count; block++)
+    {
+        test_check_block(&g_records[block], block);
+        HOST_TEST_CHECK_EQUAL(TEST_FRAMES, g_records[block].frames);
+        HOST_TEST_CHECK(!g_records[block].has_data);
+    }
+
+    /** Stop drops the partial block, and the timer no longer starts scans. */
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_adc_periodic_on_sf_adc_periodic.stop(&g_periodic_ctrl));
+    HOST_TEST_CHECK(!test_adc_period());
+
+    g_record_count = 0U;
+    test_periodic_start();
+    test_adc_scans(2U * TEST_FRAMES);
+    HOST_TEST_CHECK_EQUAL(2U, g_record_count);
+    test_check_block(&g_records[0], 0U);
+    test_check_block(&g_records[1], 1U);
+
+    test_periodic_close();
+}
+
+/** Averages of each decimation group per channel, shifted to Q15. */
+static void test_periodic_average (void)
+{
+    test_periodic_open(SF_ADC_PERIODIC_FILTER_AVERAGE, false);
+    test_periodic_start();
+    test_adc_scans(4U * TEST_FRAMES);
+    HOST_TEST_CHECK_EQUAL(4U, g_record_count);
+
+    uint32_t mismatches = 0U;
+    for (uint32_t block = 0U; block < g_record_count; block++)
+    {
+        test_record_t const * p_record = &g_records[block];
+        test_check_block(p_record, block);
+        HOST_TEST_CHECK(p_record->has_data);
+        HOST_TEST_CHECK_EQUAL(TEST_FRAMES / TEST_DECIMATION, p_record->frames);
+        for (uint32_t o = 0U; o < p_record->frames; o++)
+        {
+            for (uint32_t channel = 0U; channel < TEST_ADC_CHANNELS; channel++)
+            {
+                uint32_t sum = 0U;
+                for (uint32_t k = 0U; k < TEST_DECIMATION; k++)
+                {
+                    uint32_t scan = (block * TEST_FRAMES) + (o * TEST_DECIMATION) + k;
+                    sum += test_adc_result(scan, g_slot[channel]);
+                }
+                int16_t expected = (int16_t) ((sum << TEST_Q15_SHIFT) / TEST_DECIMATION);
+                mismatches += (expected != p_record->data[(o * TEST_ADC_CHANNELS) + channel]) ? 1U : 0U;
+            }
+        }
+    }
+    HOST_TEST_CHECK_EQUAL(0U, mismatches);
+
+    test_periodic_close();
+}
+
+/** FIR output n of a channel over the whole run, computed directly from the scans, with zeros before the start. */
+static int16_t test_fir_expected (uint32_t channel, uint32_t n)
+{
+    int64_t acc = 0;
+    for (uint32_t k = 0U; k < TEST_FIR_TAPS; k++)
+    {
+        int32_t scan = ((int32_t) (n * TEST_DECIMATION) - (int32_t) (TEST_FIR_TAPS - 1U)) + (int32_t) k;
+        if (scan >= 0)
+        {
+            int32_t x = (int32_t) test_adc_result((uint32_t) scan, g_slot[channel]) << TEST_Q15_SHIFT;
+            acc += (int64_t) x * g_fir_coeffs[k];
+        }
+    }
+    acc >>= 15;
+
+    return (int16_t) ((acc > INT16_MAX) ? INT16_MAX : ((acc < INT16_MIN) ? INT16_MIN : acc));
+}
+
+/** Counts the FIR outputs of the records that differ from the output computed over the whole run. */
+static uint32_t test_fir_mismatches (void)
+{
+    uint32_t mismatches = 0U;
+    for (uint32_t block = 0U; block < g_record_count; block++)
+    {
+        test_record_t const * p_record = &g_records[block];
+        test_check_block(p_record, block);
+        HOST_TEST_CHECK_EQUAL(TEST_FRAMES / TEST_DECIMATION, p_record->frames);
+        for (uint32_t o = 0U; o < p_record->frames; o++)
+        {
+            for (uint32_t channel = 0U; channel < TEST_ADC_CHANNELS; channel++)
+            {
+                int16_t expected = test_fir_expected(channel, (block * p_record->frames) + o);
+                mismatches += (expected != p_record->data[(o * TEST_ADC_CHANNELS) + channel]) ? 1U : 0U;
+            }
+        }
+    }
+
+    return mismatches;
+}
+
+/** Each channel has its own filter history, carried across block boundaries and cleared by start. */
+static void test_periodic_fir (void)
+{
+    test_periodic_open(SF_ADC_PERIODIC_FILTER_FIR, false);
+    test_periodic_start();
+    test_adc_scans(5U * TEST_FRAMES);
+    HOST_TEST_CHECK_EQUAL(5U, g_record_count);
+    HOST_TEST_CHECK_EQUAL(0U, test_fir_mismatches());
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_adc_periodic_on_sf_adc_periodic.stop(&g_periodic_ctrl));
+    g_record_count = 0U;
+    test_periodic_start();
+    test_adc_scans(2U * TEST_FRAMES);
+    HOST_TEST_CHECK_EQUAL(2U, g_record_count);
+    HOST_TEST_CHECK_EQUAL(0U, test_fir_mismatches());
+
+    test_periodic_close();
+}
+
+/** With deferred callbacks, blocks the DTC overwrote before the work ran are reported once and skipped, and the
+ *  intact blocks after them are still delivered. Stop keeps completed blocks, close drops them. */
+static void test_periodic_overrun (void)
+{
+    test_periodic_open(SF_ADC_PERIODIC_FILTER_AVERAGE, true);
+    test_periodic_start();
+
+    test_adc_scans(2U * TEST_FRAMES);
+    HOST_TEST_CHECK_EQUAL(0U, g_record_count);
+    HOST_TEST_CHECK_EQUAL(1U, R_BSP_WorkRunPending());
+    HOST_TEST_CHECK_EQUAL(2U, g_record_count);
+    test_check_block(&g_records[0], 0U);
+    test_check_block(&g_records[1], 1U);
+
+    /** Blocks 2 to 7 complete while the work does not run.  The DTC is filling block 8, so blocks 6 and 7 are intact
+     *  and 2 to 5 are lost. */
+    g_record_count = 0U;
+    test_adc_scans((6U * TEST_FRAMES) + 1U);
+    HOST_TEST_CHECK_EQUAL(0U, g_record_count);
+    HOST_TEST_CHECK_EQUAL(1U, R_BSP_WorkRunPending());
+    HOST_TEST_CHECK_EQUAL(3U, g_record_count);
+    HOST_TEST_CHECK(SF_ADC_PERIODIC_EVENT_OVERRUN == g_records[0].event);
+    HOST_TEST_CHECK_EQUAL(2U, g_records[0].block);
+    HOST_TEST_CHECK_EQUAL(4U, g_records[0].blocks_lost);
+    HOST_TEST_CHECK(NULL == g_records[0].p_raw);
+    HOST_TEST_CHECK(!g_records[0].has_data);
+    test_check_block(&g_records[1], 6U);
+    test_check_block(&g_records[2], 7U);
+
+    /** Completed blocks survive stop. */
+    g_record_count = 0U;
+    test_adc_scans(TEST_FRAMES - 1U);
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_adc_periodic_on_sf_adc_periodic.stop(&g_periodic_ctrl));
+    HOST_TEST_CHECK_EQUAL(1U, R_BSP_WorkRunPending());
+    HOST_TEST_CHECK_EQUAL(1U, g_record_count);
+    test_check_block(&g_records[0], 8U);
+
+    /** Completed blocks are dropped by close, the posted work returns without a callback. */
+    g_record_count = 0U;
+    test_periodic_start();
+    test_adc_scans(TEST_FRAMES);
+    test_periodic_close();
+    HOST_TEST_CHECK_EQUAL(1U, R_BSP_WorkRunPending());
+    HOST_TEST_CHECK_EQUAL(0U, g_record_count);
+}
+
+int main (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimInit());
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimDtcHookSet(test_dtc_model, NULL));
+    __enable_irq();
+
+    test_periodic_raw();
+    test_periodic_average();
+    test_periodic_fir();
+    test_periodic_overrun();
+
+    return HOST_TEST_RESULT();
+}
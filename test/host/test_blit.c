@@ -0,0 +1,300 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : test_blit.c
+ * Description  : Checks fill, copy, blend and convert of the blitter against the pixel by pixel reference of
+ *                blit_reference.c for every format pair, on random surfaces with padded strides, odd offsets and
+ *                rectangles clipped on every edge, with the CPU and with the DMAC. The whole memory behind each
+ *                destination is compared, so writes into the padding or past the surface fail too.
+ **********************************************************************************************************************/
+
+#include <string.h>
+
+#include "bsp_api.h"
+#include "r_blit.h"
+#include "r_dmac.h"
+#include "blit_reference.h"
+#include "host_test.h"
+
+#define TEST_BLIT_MEMORY_WORDS   (1200U)
+#define TEST_BLIT_MAX_WIDTH      (40U)
+#define TEST_BLIT_MAX_HEIGHT     (20U)
+#define TEST_BLIT_CASES          (300U)
+#define TEST_BLIT_FORMATS        (DISPLAY_IN_FORMAT_CLUT8 + 1)
+
+static uint32_t                g_dest[TEST_BLIT_MEMORY_WORDS];
+static uint32_t                g_expect[TEST_BLIT_MEMORY_WORDS];
+static uint32_t                g_src[TEST_BLIT_MEMORY_WORDS];
+static uint32_t                g_clut[256];
+static uint32_t                g_random = 0x2545F491U;
+static uint32_t                g_dma_packed;
+static uint32_t                g_dma_lines;
+
+static blit_instance_ctrl_t    g_blit_ctrl;
+static blit_cfg_t              g_blit_cfg;
+static transfer_info_t         g_dmac_info;
+static dmac_instance_ctrl_t    g_dmac_ctrl;
+static transfer_on_dmac_cfg_t  g_dmac_ext = { .channel = 2U };
+static transfer_cfg_t          g_dmac_cfg = { .p_info = &g_dmac_info, .irq_ipl = BSP_IRQ_DISABLED,
+                                              .p_extend = &g_dmac_ext };
+static transfer_instance_t     g_dmac     = { .p_ctrl = &g_dmac_ctrl, .p_cfg = &g_dmac_cfg,
+                                              .p_api = &g_transfer_on_dmac };
+
+/** xorshift32, so every run checks the same cases. */
+static uint32_t test_blit_random (uint32_t range)
+{
+    g_random ^= g_random << 13;
+    g_random ^= g_random >> 17;
+    g_random ^= g_random << 5;
+
+    return g_random % range;
+}
+
+/** Fill words with random bytes. */
+static void test_blit_scramble (uint32_t * p_memory, uint32_t words)
+{
+    for (uint32_t i = 0U; i < words; i++)
+    {
+        p_memory[i] = test_blit_random(0xFFFFFFFFU);
+    }
+}
+
+/** Random surface of a format in p_memory. Packed surfaces start on a word and have no padding, other surfaces
+ *  have up to three pixels of padding and start one pixel past a word half of the time. */
+static void test_blit_surface (blit_surface_t * p_surface, uint32_t * p_memory, display_in_format_t format,
+                               bool packed)
+{
+    uint32_t bytes  = blit_reference_bytes(format);
+    uint32_t offset = packed ? 0U : (test_blit_random(2U) * bytes);
+
+    p_surface->width  = (uint16_t) (1U + test_blit_random(TEST_BLIT_MAX_WIDTH));
+    p_surface->height = (uint16_t) (1U + test_blit_random(TEST_BLIT_MAX_HEIGHT));
+    p_surface->stride = (p_surface->width + (packed ? 0U : test_blit_random(4U))) * bytes;
+    p_surface->format = format;
+    p_surface->p_base = (uint8_t *) p_memory + offset;
+    p_surface->p_clut = g_clut;
+}
+
+/** The same surface in the expected memory. */
+static blit_surface_t test_blit_expect (blit_surface_t const * p_dest)
+{
+    blit_surface_t expect = *p_dest;
+    expect.p_base = (uint8_t *) g_expect + ((uint8_t *) p_dest->p_base - (uint8_t *) g_dest);
+
+    return expect;
+}
+
+/** Random rectangle reaching up to eight pixels past every edge of a surface. */
+static blit_rect_t test_blit_rect (blit_surface_t const * p_surface)
+{
+    blit_rect_t rect;
+    rect.x      = (int16_t) ((int32_t) test_blit_random(p_surface->width + 16U) - 8);
+    rect.y      = (int16_t) ((int32_t) test_blit_random(p_surface->height + 16U) - 8);
+    rect.width  = (uint16_t) test_blit_random(p_surface->width + 16U);
+    rect.height = (uint16_t) test_blit_random(p_surface->height + 16U);
+
+    return rect;
+}
+
+/** Random position of a source in a destination, up to eight pixels outside it. */
+static int32_t test_blit_position (uint32_t size)
+{
+    return (int32_t) test_blit_random(size + 16U) - 8;
+}
+
+/** Compare the destination memory with the reference, reporting the first case that differs. */
+static void test_blit_compare (char const * p_operation, display_in_format_t dest, display_in_format_t src,
+                               uint32_t test_case)
+{
+    if (0 != memcmp(g_dest, g_expect, sizeof(g_dest)))
+    {
+        for (uint32_t i = 0U; i < TEST_BLIT_MEMORY_WORDS; i++)
+        {
+            if (g_dest[i] != g_expect[i])
+            {
+                printf("%s dest %d src %d case %u: word %u is 0x%08x, expected 0x%08x\n", p_operation, (int) dest,
+                       (int) src, test_case, i, g_dest[i], g_expect[i]);
+                break;
+            }
+        }
+        g_host_test_failures++;
+    }
+}
+
+/** Open the blitter on the CPU, or on the DMAC with a threshold of one word. */
+static void test_blit_open (bool dma)
+{
+    g_blit_cfg.p_transfer          = dma ? &g_dmac : NULL;
+    g_blit_cfg.dma_threshold_bytes = 4U;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_blit_on_blit.open(&g_blit_ctrl, &g_blit_cfg));
+}
+
+/** Fill of every format, over the whole surface and over clipped rectangles. */
+static void test_blit_fill (void)
+{
+    test_blit_open(false);
+    for (int format = 0; format < TEST_BLIT_FORMATS; format++)
+    {
+        for (uint32_t test_case = 0U; test_case < TEST_BLIT_CASES; test_case++)
+        {
+            blit_surface_t dest;
+            test_blit_scramble(g_dest, TEST_BLIT_MEMORY_WORDS);
+            memcpy(g_expect, g_dest, sizeof(g_dest));
+            test_blit_surface(&dest, g_dest, (display_in_format_t) format, false);
+            blit_surface_t expect = test_blit_expect(&dest);
+            blit_rect_t    rect   = test_blit_rect(&dest);
+            blit_rect_t  * p_rect = (0U == test_blit_random(8U)) ? NULL : &rect;
+            uint32_t       color  = test_blit_random(0xFFFFFFFFU);
+
+            HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_blit_on_blit.fill(&g_blit_ctrl, &dest, p_rect, color));
+            blit_reference_fill(&expect, p_rect, color);
+            test_blit_compare("fill", dest.format, dest.format, test_case);
+        }
+    }
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_blit_on_blit.close(&g_blit_ctrl));
+}
+
+/** Copy and convert between every format pair, blend onto every format but CLUT8. Copy and convert with the DMAC
+ *  also use packed surfaces, so whole surfaces go in one transfer. */
+static void test_blit_two_surfaces (bool dma)
+{
+    test_blit_open(dma);
+    for (int dest_format = 0; dest_format < TEST_BLIT_FORMATS; dest_format++)
+    {
+        for (int src_format = 0; src_format < TEST_BLIT_FORMATS; src_format++)
+        {
+            for (uint32_t test_case = 0U; test_case < TEST_BLIT_CASES; test_case++)
+            {
+                bool           packed = dma && (0U == (test_case % 4U));
+                blit_surface_t dest;
+                blit_surface_t src;
+                test_blit_scramble(g_dest, TEST_BLIT_MEMORY_WORDS);
+                test_blit_scramble(g_src, TEST_BLIT_MEMORY_WORDS);
+                test_blit_scramble(g_clut, 256U);
+                memcpy(g_expect, g_dest, sizeof(g_dest));
+                test_blit_surface(&dest, g_dest, (display_in_format_t) dest_format, packed);
+                test_blit_surface(&src, g_src, (display_in_format_t) src_format, packed);
+                if (packed)
+                {
+                    src.width  = dest.width;
+                    src.height = dest.height;
+                    src.stride = dest.stride;
+                }
+                blit_surface_t expect = test_blit_expect(&dest);
+                blit_rect_t    rect   = test_blit_rect(&src);
+                blit_rect_t  * p_rect = (packed || (0U == test_blit_random(8U))) ? NULL : &rect;
+                int32_t        x      = packed ? 0 : test_blit_position(dest.width);
+                int32_t        y      = packed ? 0 : test_blit_position(dest.height);
+                ssp_err_t      err;
+
+                if (dest_format == src_format)
+                {
+                    uint32_t bytes = blit_reference_bytes(dest.format);
+                    if (dma && (4U == bytes) && (0U == ((uintptr_t) dest.p_base % 4U)) &&
+                        (0U == ((uintptr_t) src.p_base % 4U)))
+                    {
+                        if (packed)
+                        {
+                            g_dma_packed++;
+                        }
+                        else
+                        {
+                            g_dma_lines++;
+                        }
+                    }
+
+                    err = g_blit_on_blit.copy(&g_blit_ctrl, &dest, (int16_t) x, (int16_t) y, &src, p_rect);
+                    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, err);
+                    blit_reference_copy(&expect, x, y, &src, p_rect);
+                    test_blit_compare("copy", dest.format, src.format, test_case);
+                }
+                else
+                {
+                    err = g_blit_on_blit.copy(&g_blit_ctrl, &dest, (int16_t) x, (int16_t) y, &src, p_rect);
+                    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_ARGUMENT, err);
+                }
+
+                err = g_blit_on_blit.convert(&g_blit_ctrl, &dest, (int16_t) x, (int16_t) y, &src, p_rect);
+                if ((DISPLAY_IN_FORMAT_CLUT8 == dest.format) && (dest_format != src_format))
+                {
+                    HOST_TEST_CHECK_EQUAL(SSP_ERR_UNSUPPORTED, err);
+                }
+                else
+                {
+                    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, err);
+                    blit_reference_convert(&expect, x, y, &src, p_rect);
+                }
+                test_blit_compare("convert", dest.format, src.format, test_case);
+
+                /** Transparent, opaque and random global alpha */
+                uint8_t alpha = (uint8_t) ((test_case < 3U) ? ((test_case * 255U) / 2U) : test_blit_random(256U));
+                alpha = (1U == test_case) ? 255U : alpha;
+                err   = g_blit_on_blit.blend(&g_blit_ctrl, &dest, (int16_t) x, (int16_t) y, &src, p_rect, alpha);
+                if (DISPLAY_IN_FORMAT_CLUT8 == dest.format)
+                {
+                    HOST_TEST_CHECK_EQUAL(SSP_ERR_UNSUPPORTED, err);
+                }
+                else
+                {
+                    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, err);
+                    blit_reference_blend(&expect, x, y, &src, p_rect, alpha);
+                }
+                test_blit_compare("blend", dest.format, src.format, test_case);
+            }
+        }
+    }
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_blit_on_blit.close(&g_blit_ctrl));
+}
+
+/** CLUT4 and CLUT1 are rejected without touching memory. */
+static void test_blit_unsupported (void)
+{
+    blit_surface_t dest;
+    blit_surface_t src;
+
+    test_blit_open(false);
+    test_blit_scramble(g_dest, TEST_BLIT_MEMORY_WORDS);
+    memcpy(g_expect, g_dest, sizeof(g_dest));
+    test_blit_surface(&dest, g_dest, DISPLAY_IN_FORMAT_32BITS_ARGB8888, false);
+    test_blit_surface(&src, g_src, DISPLAY_IN_FORMAT_32BITS_ARGB8888, false);
+    src.format = DISPLAY_IN_FORMAT_CLUT4;
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_UNSUPPORTED, g_blit_on_blit.blend(&g_blit_ctrl, &dest, 0, 0, &src, NULL, 255U));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_UNSUPPORTED, g_blit_on_blit.convert(&g_blit_ctrl, &dest, 0, 0, &src, NULL));
+    dest.format = DISPLAY_IN_FORMAT_CLUT1;
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_UNSUPPORTED, g_blit_on_blit.fill(&g_blit_ctrl, &dest, NULL, 0U));
+    test_blit_compare("unsupported", dest.format, src.format, 0U);
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_blit_on_blit.close(&g_blit_ctrl));
+}
+
+int main (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimInit());
+
+    test_blit_fill();
+    test_blit_two_surfaces(false);
+    test_blit_two_surfaces(true);
+    test_blit_unsupported();
+
+    /** Both DMAC paths were taken */
+    HOST_TEST_CHECK(g_dma_packed > 0U);
+    HOST_TEST_CHECK(g_dma_lines > 0U);
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,277 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : test_bsp_pool.c
+ * Description  : Size class pool allocator: configuration checks, selection of the smallest fitting class, fallback to
+ *                larger classes, exhaustion of every class, rejection of foreign pointers, and free and reallocation of
+ *                the same blocks.
+ **********************************************************************************************************************/
+
+#include <string.h>
+
+#include "bsp_api.h"
+#include "host_test.h"
+
+#define TEST_REGION_BYTES     (16384U)
+#define TEST_NUM_CLASSES      (3U)
+
+static uint8_t              g_region[TEST_REGION_BYTES] BSP_ALIGN_VARIABLE_V2(8);
+static bsp_pool_t           g_pool;
+
+/* Sizes that are not multiples of the alignment are rounded up. */
+static bsp_pool_class_cfg_t const g_classes[TEST_NUM_CLASSES] =
+{
+    { .block_size = 16U,  .block_count = 8U },
+    { .block_size = 60U,  .block_count = 4U },
+    { .block_size = 256U, .block_count = 2U },
+};
+
+/* The region starts one byte past an aligned address to check that the arenas are aligned. */
+static bsp_pool_cfg_t const g_pool_cfg =
+{
+    .p_region     = &g_region[1],
+    .region_bytes = TEST_REGION_BYTES - 1U,
+    .p_classes    = g_classes,
+    .num_classes  = TEST_NUM_CLASSES,
+};
+
+static bsp_pool_stats_t test_pool_stats (uint32_t class_index)
+{
+    bsp_pool_stats_t stats;
+    memset(&stats, 0xFF, sizeof(stats));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_PoolStatsGet(&g_pool, class_index, &stats));
+
+    return stats;
+}
+
+/** Returns the block size of the class a block was taken from. */
+static uint32_t test_pool_block_size (void const * p_block)
+{
+    uint32_t bytes = 0U;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_PoolBlockSizeGet(&g_pool, p_block, &bytes));
+
+    return bytes;
+}
+
+/** Configurations with classes out of order, empty classes or more blocks than the region holds are rejected. */
+static void test_pool_open (void)
+{
+    bsp_pool_t           pool;
+    bsp_pool_class_cfg_t classes[2] = { { .block_size = 64U, .block_count = 1U },
+                                        { .block_size = 64U, .block_count = 1U } };
+    bsp_pool_cfg_t       cfg        = { .p_region = g_region, .region_bytes = 1024U, .p_classes = classes,
+                                        .num_classes = 2U };
+
+    /** Two classes rounding up to the same size are not in increasing order. */
+    classes[1].block_size = 60U;
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_ARGUMENT, R_BSP_PoolOpen(&pool, &cfg));
+    classes[1].block_size = 128U;
+    classes[1].block_count = 0U;
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_ARGUMENT, R_BSP_PoolOpen(&pool, &cfg));
+    classes[1].block_count = BSP_POOL_BLOCKS_MAX + 1U;
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_ARGUMENT, R_BSP_PoolOpen(&pool, &cfg));
+    cfg.num_classes = 0U;
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_ARGUMENT, R_BSP_PoolOpen(&pool, &cfg));
+    cfg.num_classes = BSP_POOL_CLASSES_MAX + 1U;
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_ARGUMENT, R_BSP_PoolOpen(&pool, &cfg));
+
+    /** 64 + 7 * 128 bytes fit in 1024 bytes, one more block does not. */
+    cfg.num_classes = 2U;
+    classes[1].block_count = 8U;
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_OUT_OF_MEMORY, R_BSP_PoolOpen(&pool, &cfg));
+    classes[1].block_count = 7U;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_PoolOpen(&pool, &cfg));
+
+    /** A pool that was never opened is rejected. */
+    bsp_pool_t closed;
+    void     * p_block = NULL;
+    memset(&closed, 0, sizeof(closed));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_NOT_OPEN, R_BSP_PoolAlloc(&closed, 16U, &p_block));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_NOT_OPEN, R_BSP_PoolFree(&closed, g_region));
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_PoolOpen(&g_pool, &g_pool_cfg));
+    HOST_TEST_CHECK_EQUAL(16U, test_pool_stats(0U).block_size);
+    HOST_TEST_CHECK_EQUAL(64U, test_pool_stats(1U).block_size);
+    HOST_TEST_CHECK_EQUAL(256U, test_pool_stats(2U).block_size);
+    bsp_pool_stats_t stats;
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_ARGUMENT, R_BSP_PoolStatsGet(&g_pool, TEST_NUM_CLASSES, &stats));
+}
+
+/** Each request is served by the smallest class it fits in, and requests no class fits are rejected. */
+static void test_pool_class_selection (void)
+{
+    static const uint32_t sizes[]    = { 1U, 15U, 16U, 17U, 60U, 64U, 65U, 255U, 256U };
+    static const uint32_t expected[] = { 16U, 16U, 16U, 64U, 64U, 64U, 256U, 256U, 256U };
+
+    for (uint32_t i = 0U; i < (sizeof(sizes) / sizeof(sizes[0])); i++)
+    {
+        void * p_block = NULL;
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_PoolAlloc(&g_pool, sizes[i], &p_block));
+        HOST_TEST_CHECK_EQUAL(0U, (uintptr_t) p_block % BSP_POOL_ALIGNMENT);
+        HOST_TEST_CHECK_EQUAL(expected[i], test_pool_block_size(p_block));
+
+        /** The whole block is usable. */
+        memset(p_block, (int) i, expected[i]);
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_PoolFree(&g_pool, p_block));
+    }
+
+    void * p_block = NULL;
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_SIZE, R_BSP_PoolAlloc(&g_pool, 0U, &p_block));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_SIZE, R_BSP_PoolAlloc(&g_pool, 257U, &p_block));
+
+    for (uint32_t c = 0U; c < TEST_NUM_CLASSES; c++)
+    {
+        bsp_pool_stats_t stats = test_pool_stats(c);
+        HOST_TEST_CHECK_EQUAL(0U, stats.blocks_used);
+        HOST_TEST_CHECK_EQUAL(1U, stats.blocks_used_max);
+        HOST_TEST_CHECK_EQUAL(0U, stats.fallbacks);
+        HOST_TEST_CHECK_EQUAL(0U, stats.failures);
+    }
+}
+
+/** Small requests spill into the larger classes when their class is empty, and fail once every class is empty. */
+static void test_pool_exhaustion (void)
+{
+    void   * blocks[8U + 4U + 2U];
+    uint32_t count = 0U;
+
+    /** 8 blocks from the 16 byte class, then 4 fallbacks to the 64 byte class and 2 to the 256 byte class. */
+    for (uint32_t i = 0U; i < (sizeof(blocks) / sizeof(blocks[0])); i++)
+    {
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_PoolAlloc(&g_pool, 8U, &blocks[count]));
+        uint32_t expected = (i < 8U) ? 16U : ((i < 12U) ? 64U : 256U);
+        HOST_TEST_CHECK_EQUAL(expected, test_pool_block_size(blocks[count]));
+        count++;
+    }
+
+    /** No two blocks overlap. */
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        for (uint32_t j = i + 1U; j < count; j++)
+        {
+            uintptr_t a = (uintptr_t) blocks[i];
+            uintptr_t b = (uintptr_t) blocks[j];
+            HOST_TEST_CHECK((a + test_pool_block_size(blocks[i]) <= b) || (b + test_pool_block_size(blocks[j]) <= a));
+        }
+    }
+
+    void * p_block = NULL;
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_OUT_OF_MEMORY, R_BSP_PoolAlloc(&g_pool, 8U, &p_block));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_OUT_OF_MEMORY, R_BSP_PoolAlloc(&g_pool, 100U, &p_block));
+
+    /** The failures are counted by the best fitting class, the fallbacks by the class that served them. */
+    HOST_TEST_CHECK_EQUAL(1U, test_pool_stats(0U).failures);
+    HOST_TEST_CHECK_EQUAL(0U, test_pool_stats(1U).failures);
+    HOST_TEST_CHECK_EQUAL(1U, test_pool_stats(2U).failures);
+    HOST_TEST_CHECK_EQUAL(0U, test_pool_stats(0U).fallbacks);
+    HOST_TEST_CHECK_EQUAL(4U, test_pool_stats(1U).fallbacks);
+    HOST_TEST_CHECK_EQUAL(2U, test_pool_stats(2U).fallbacks);
+    HOST_TEST_CHECK_EQUAL(8U, test_pool_stats(0U).blocks_used);
+    HOST_TEST_CHECK_EQUAL(4U, test_pool_stats(1U).blocks_used);
+    HOST_TEST_CHECK_EQUAL(2U, test_pool_stats(2U).blocks_used);
+
+    /** A freed block of the smallest class is taken before the larger classes again. */
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_PoolFree(&g_pool, blocks[3]));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_PoolAlloc(&g_pool, 8U, &p_block));
+    HOST_TEST_CHECK(blocks[3] == p_block);
+
+    /** A freed large block only serves requests that need it when no smaller class has a block. */
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_PoolFree(&g_pool, blocks[13]));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_PoolAlloc(&g_pool, 40U, &p_block));
+    HOST_TEST_CHECK(blocks[13] == p_block);
+    HOST_TEST_CHECK_EQUAL(3U, test_pool_stats(2U).fallbacks);
+
+    /** Free everything in a different order than it was allocated. */
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_PoolFree(&g_pool, blocks[(i * 5U) % count]));
+    }
+    for (uint32_t c = 0U; c < TEST_NUM_CLASSES; c++)
+    {
+        bsp_pool_stats_t stats = test_pool_stats(c);
+        HOST_TEST_CHECK_EQUAL(0U, stats.blocks_used);
+        HOST_TEST_CHECK_EQUAL(stats.block_count, stats.blocks_used_max);
+    }
+}
+
+/** After all blocks are returned, every block of every class can be allocated again exactly once. */
+static void test_pool_reuse (void)
+{
+    for (uint32_t round = 0U; round < 3U; round++)
+    {
+        for (uint32_t c = 0U; c < TEST_NUM_CLASSES; c++)
+        {
+            bsp_pool_stats_t stats = test_pool_stats(c);
+            void           * blocks[8];
+            HOST_TEST_CHECK(stats.block_count <= (sizeof(blocks) / sizeof(blocks[0])));
+
+            /** Requests of the largest size that fits only this class drain it without fallbacks. */
+            for (uint32_t i = 0U; i < stats.block_count; i++)
+            {
+                HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_PoolAlloc(&g_pool, stats.block_size, &blocks[i]));
+                HOST_TEST_CHECK_EQUAL(stats.block_size, test_pool_block_size(blocks[i]));
+                for (uint32_t j = 0U; j < i; j++)
+                {
+                    HOST_TEST_CHECK(blocks[i] != blocks[j]);
+                }
+                memset(blocks[i], (int) (i + 1U), stats.block_size);
+            }
+            HOST_TEST_CHECK_EQUAL(stats.block_count, test_pool_stats(c).blocks_used);
+
+            /** Writing a block does not disturb its neighbours or the free lists. */
+            for (uint32_t i = 0U; i < stats.block_count; i++)
+            {
+                uint8_t const * p_bytes = blocks[i];
+                HOST_TEST_CHECK_EQUAL(i + 1U, p_bytes[0]);
+                HOST_TEST_CHECK_EQUAL(i + 1U, p_bytes[stats.block_size - 1U]);
+            }
+
+            for (uint32_t i = 0U; i < stats.block_count; i++)
+            {
+                HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_PoolFree(&g_pool, blocks[i]));
+            }
+            HOST_TEST_CHECK_EQUAL(0U, test_pool_stats(c).blocks_used);
+        }
+    }
+
+    /** Pointers that are not the start of a block of the pool are rejected. */
+    void * p_block = NULL;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_PoolAlloc(&g_pool, 64U, &p_block));
+    uint32_t bytes = 0U;
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_POINTER, R_BSP_PoolBlockSizeGet(&g_pool, (uint8_t *) p_block + 8, &bytes));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_POINTER, R_BSP_PoolFree(&g_pool, (uint8_t *) p_block + 8));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_POINTER, R_BSP_PoolFree(&g_pool, &g_region[TEST_REGION_BYTES - 8U]));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_POINTER, R_BSP_PoolFree(&g_pool, &bytes));
+    HOST_TEST_CHECK_EQUAL(1U, test_pool_stats(1U).blocks_used);
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_PoolFree(&g_pool, p_block));
+    HOST_TEST_CHECK_EQUAL(0U, test_pool_stats(1U).blocks_used);
+}
+
+int main (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimInit());
+
+    test_pool_open();
+    test_pool_class_selection();
+    test_pool_exhaustion();
+    test_pool_reuse();
+
+    return HOST_TEST_RESULT();
+}
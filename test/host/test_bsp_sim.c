@@ -0,0 +1,203 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : test_bsp_sim.c
+ * Description  : Smoke test of the host simulation: register models, page traps, SRAM allocation and the ICU/NVIC
+ *                path from a peripheral event to a driver ISR.
+ **********************************************************************************************************************/
+
+#include "bsp_api.h"
+#include "r_sci_uart.h"
+#include "host_test.h"
+
+SSP_VECTOR_DEFINE_CHAN(sci_uart_rxi_isr, SCI, RXI, 0);
+SSP_VECTOR_DEFINE_CHAN(sci_uart_txi_isr, SCI, TXI, 0);
+SSP_VECTOR_DEFINE_CHAN(sci_uart_tei_isr, SCI, TEI, 0);
+SSP_VECTOR_DEFINE_CHAN(sci_uart_eri_isr, SCI, ERI, 0);
+
+/** Register model: the first word counts up on every read, a write to the second word is copied to the third and
+ *  clears itself, as a self-clearing command bit would. */
+typedef struct st_test_model
+{
+    uint32_t resets;
+    uint32_t steps;
+    uint32_t reads;
+    uint32_t writes;
+} test_model_t;
+
+static test_model_t g_model;
+
+static void test_model_hook (bsp_sim_peripheral_t * const p_peripheral, bsp_sim_hook_event_t event)
+{
+    test_model_t      * p_model = (test_model_t *) p_peripheral->p_context;
+    volatile uint32_t * p_reg   = (volatile uint32_t *) p_peripheral->base;
+
+    switch (event)
+    {
+        case BSP_SIM_HOOK_EVENT_RESET:
+            p_model->resets++;
+            p_reg[0] = 100U;
+            break;
+
+        case BSP_SIM_HOOK_EVENT_STEP:
+            p_model->steps++;
+            break;
+
+        case BSP_SIM_HOOK_EVENT_READ:
+            if (p_peripheral->address == p_peripheral->base)
+            {
+                p_model->reads++;
+                p_reg[0] = 100U + p_model->reads;
+            }
+            break;
+
+        default: /* BSP_SIM_HOOK_EVENT_WRITE */
+            if (p_peripheral->address == (p_peripheral->base + 4U))
+            {
+                p_model->writes++;
+                p_reg[2] = p_reg[1];
+                p_reg[1] = 0U;
+            }
+            break;
+    }
+}
+
+static bsp_sim_peripheral_t g_model_peripheral =
+{
+    .p_name    = "TEST",
+    .base      = R_GPTA0_BASE,
+    .size      = 0x100U,
+    .p_hook    = test_model_hook,
+    .p_context = &g_model,
+    .trap      = BSP_SIM_TRAP_ACCESS,
+};
+
+static uint32_t g_rx_count;
+static uint32_t g_rx_last;
+
+static void test_uart_callback (uart_callback_args_t * p_args)
+{
+    if (UART_EVENT_RX_CHAR == p_args->event)
+    {
+        g_rx_count++;
+        g_rx_last = p_args->data;
+    }
+}
+
+static void test_register_model (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimPeripheralRegister(&g_model_peripheral));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_IN_USE, R_BSP_SimPeripheralRegister(&g_model_peripheral));
+    HOST_TEST_CHECK_EQUAL(1U, g_model.resets);
+
+    volatile uint32_t * p_reg = (volatile uint32_t *) R_GPTA0_BASE;
+    HOST_TEST_CHECK_EQUAL(101U, p_reg[0]);
+    HOST_TEST_CHECK_EQUAL(102U, p_reg[0]);
+
+    p_reg[1] = 0x5AU;
+    HOST_TEST_CHECK_EQUAL(1U, g_model.writes);
+    HOST_TEST_CHECK_EQUAL(0U, p_reg[1]);
+    HOST_TEST_CHECK_EQUAL(0x5AU, p_reg[2]);
+
+    uint32_t steps = g_model.steps;
+    R_BSP_SimStep();
+    R_BSP_SimStep();
+    HOST_TEST_CHECK_EQUAL(steps + 2U, g_model.steps);
+
+    /* Addresses outside the simulated ranges are rejected. */
+    static bsp_sim_peripheral_t outside = { .p_name = "OUTSIDE", .base = 0x30000000UL, .size = 4U };
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_ADDRESS, R_BSP_SimPeripheralRegister(&outside));
+}
+
+static void test_sram (void)
+{
+    uint8_t * p_a = R_BSP_SimSramAlloc(3U, 0U);
+    uint8_t * p_b = R_BSP_SimSramAlloc(64U, 32U);
+
+    HOST_TEST_CHECK(NULL != p_a);
+    HOST_TEST_CHECK(NULL != p_b);
+    HOST_TEST_CHECK((uintptr_t) p_a >= BSP_SIM_SRAM_BASE);
+    HOST_TEST_CHECK(0U == ((uintptr_t) p_b % 32U));
+    HOST_TEST_CHECK(p_b >= (p_a + 3));
+    HOST_TEST_CHECK(((uintptr_t) p_b + 64U) <= (BSP_SIM_SRAM_BASE + BSP_SIM_SRAM_SIZE));
+    HOST_TEST_CHECK(NULL == R_BSP_SimSramAlloc(BSP_SIM_SRAM_SIZE, 0U));
+}
+
+static void test_uart_receive (void)
+{
+    static sci_uart_instance_ctrl_t ctrl;
+    static uart_on_sci_cfg_t        ext =
+    {
+        .clk_src                = SCI_CLK_SRC_INT,
+        .rx_fifo_trigger        = SCI_UART_RX_FIFO_TRIGGER_1,
+        .baud_rate_error_x_1000 = 5000,
+    };
+    static uart_cfg_t cfg =
+    {
+        .channel    = 0,
+        .baud_rate  = 115200,
+        .data_bits  = UART_DATA_BITS_8,
+        .parity     = UART_PARITY_OFF,
+        .stop_bits  = UART_STOP_BITS_1,
+        .p_callback = test_uart_callback,
+        .p_extend   = &ext,
+        .rxi_ipl    = 2,
+        .txi_ipl    = 2,
+        .tei_ipl    = 2,
+        .eri_ipl    = 2,
+    };
+
+    bsp_sim_stats_t before;
+    bsp_sim_stats_t after;
+    R_BSP_SimStatsGet(&before);
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_uart_on_sci.open(&ctrl, &cfg));
+
+    uint16_t data[40];
+    for (uint32_t i = 0U; i < 40U; i++)
+    {
+        data[i] = (uint16_t) ('a' + (i % 26U));
+    }
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimSciReceive(0U, data, 40U));
+
+    R_BSP_SimStatsGet(&after);
+    HOST_TEST_CHECK_EQUAL(40U, g_rx_count);
+    HOST_TEST_CHECK_EQUAL('n', g_rx_last);
+    HOST_TEST_CHECK(after.irqs_dispatched > before.irqs_dispatched);
+    HOST_TEST_CHECK(after.accesses_trapped > before.accesses_trapped);
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_uart_on_sci.close(&ctrl));
+
+    /* An event without a vector or DMAC request is counted and reported as not routed. */
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_IRQ_BSP_DISABLED, R_BSP_SimEventRaise(ELC_EVENT_GPT0_COUNTER_OVERFLOW));
+    R_BSP_SimStatsGet(&before);
+    HOST_TEST_CHECK_EQUAL(after.events_unrouted + 1U, before.events_unrouted);
+}
+
+int main (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimInit());
+
+    test_register_model();
+    test_sram();
+    test_uart_receive();
+
+    return HOST_TEST_RESULT();
+}
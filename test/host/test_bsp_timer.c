@@ -0,0 +1,436 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : test_bsp_timer.c
+ * Description  : Timer service software timers on a counter and a 16-bit alarm model: expiry order, no timer early
+ *                and none more than one wheel tick late, timers that cascade through every wheel level and across
+ *                wheel wraps, periodic timers, timers stopped or restarted from callbacks, and the resolution of a
+ *                service without an alarm. The test owns the time: it moves the counter and delivers the counter
+ *                overflow and alarm interrupts at the instants they occur.
+ **********************************************************************************************************************/
+
+#include <string.h>
+
+#include "bsp_api.h"
+#include "r_timer_api.h"
+#include "host_test.h"
+
+#define TEST_COUNTER_PERIOD      (1UL << 20)
+#define TEST_ALARM_MAX           (0xFFFFU)
+#define TEST_TICK                (1ULL << BSP_CFG_TIMER_TICK_SHIFT)
+#define TEST_TIMERS              (200U)
+#define TEST_FIRES_MAX           (4096U)
+
+static uint64_t g_time;                ///< Counts since the counter started
+static uint64_t g_timestamp_offset;    ///< g_time minus the timestamp of the service
+static uint64_t g_next_wrap;           ///< Time of the next counter overflow
+static uint64_t g_alarm_due;           ///< Time the alarm fires, valid while g_alarm_running
+static bool     g_alarm_running;
+static uint32_t g_alarm_period;
+static uint32_t g_alarm_interrupts;
+
+/* Counter: counts up from 0 to TEST_COUNTER_PERIOD - 1 and interrupts on overflow. */
+static ssp_err_t test_timer_open (timer_ctrl_t * const p_ctrl, timer_cfg_t const * const p_cfg)
+{
+    SSP_PARAMETER_NOT_USED(p_ctrl);
+    SSP_PARAMETER_NOT_USED(p_cfg);
+
+    return SSP_SUCCESS;
+}
+
+static ssp_err_t test_timer_nothing (timer_ctrl_t * const p_ctrl)
+{
+    SSP_PARAMETER_NOT_USED(p_ctrl);
+
+    return SSP_SUCCESS;
+}
+
+static ssp_err_t test_counter_get (timer_ctrl_t * const p_ctrl, timer_size_t * const p_value)
+{
+    SSP_PARAMETER_NOT_USED(p_ctrl);
+    *p_value = (timer_size_t) (g_time % TEST_COUNTER_PERIOD);
+
+    return SSP_SUCCESS;
+}
+
+static ssp_err_t test_counter_info (timer_ctrl_t * const p_ctrl, timer_info_t * const p_info)
+{
+    SSP_PARAMETER_NOT_USED(p_ctrl);
+    p_info->clock_frequency = 120000000U;
+    p_info->period_counts   = TEST_COUNTER_PERIOD;
+    p_info->count_direction = TIMER_DIRECTION_UP;
+    p_info->status          = TIMER_STATUS_COUNTING;
+
+    return SSP_SUCCESS;
+}
+
+/* Alarm: one-shot with a 16-bit period register at the counter frequency. */
+static ssp_err_t test_alarm_period_set (timer_ctrl_t * const p_ctrl, timer_size_t const period, timer_unit_t const unit)
+{
+    SSP_PARAMETER_NOT_USED(p_ctrl);
+    HOST_TEST_CHECK_EQUAL(TIMER_UNIT_PERIOD_RAW_COUNTS, unit);
+    if ((0U == period) || (period > TEST_ALARM_MAX))
+    {
+        return SSP_ERR_INVALID_ARGUMENT;
+    }
+    g_alarm_period = period;
+
+    return SSP_SUCCESS;
+}
+
+static ssp_err_t test_alarm_start (timer_ctrl_t * const p_ctrl)
+{
+    SSP_PARAMETER_NOT_USED(p_ctrl);
+    g_alarm_running = true;
+    g_alarm_due     = g_time + g_alarm_period;
+
+    return SSP_SUCCESS;
+}
+
+static ssp_err_t test_alarm_stop (timer_ctrl_t * const p_ctrl)
+{
+    SSP_PARAMETER_NOT_USED(p_ctrl);
+    g_alarm_running = false;
+
+    return SSP_SUCCESS;
+}
+
+static ssp_err_t test_alarm_info (timer_ctrl_t * const p_ctrl, timer_info_t * const p_info)
+{
+    SSP_PARAMETER_NOT_USED(p_ctrl);
+    p_info->clock_frequency = 120000000U;
+    p_info->period_counts   = TEST_ALARM_MAX;
+    p_info->count_direction = TIMER_DIRECTION_DOWN;
+    p_info->status          = TIMER_STATUS_STOPPED;
+
+    return SSP_SUCCESS;
+}
+
+static const timer_api_t g_counter_api =
+{
+    .open       = test_timer_open,
+    .start      = test_timer_nothing,
+    .stop       = test_timer_nothing,
+    .counterGet = test_counter_get,
+    .infoGet    = test_counter_info,
+    .close      = test_timer_nothing,
+};
+
+static const timer_api_t g_alarm_api =
+{
+    .open       = test_timer_open,
+    .start      = test_alarm_start,
+    .stop       = test_alarm_stop,
+    .periodSet  = test_alarm_period_set,
+    .infoGet    = test_alarm_info,
+    .close      = test_alarm_stop,
+};
+
+static uint32_t               g_timer_ctrl;
+static timer_cfg_t            g_counter_cfg = { .mode = TIMER_MODE_PERIODIC, .p_callback = R_BSP_TimerCounterCallback };
+static timer_cfg_t            g_alarm_cfg   = { .mode = TIMER_MODE_ONE_SHOT, .p_callback = R_BSP_TimerAlarmCallback };
+static timer_instance_t const g_counter     = { .p_ctrl = &g_timer_ctrl, .p_cfg = &g_counter_cfg,
+                                                .p_api = &g_counter_api };
+static timer_instance_t const g_alarm       = { .p_ctrl = &g_timer_ctrl, .p_cfg = &g_alarm_cfg,
+                                                .p_api = &g_alarm_api };
+
+/** Record of every expiry. */
+static bsp_timer_t g_timers[TEST_TIMERS];
+static uint64_t    g_due[TEST_TIMERS];           ///< Next expiry each timer must fire at
+static uint32_t    g_fire_count[TEST_TIMERS];
+static uint32_t    g_fire_log[TEST_FIRES_MAX];
+static uint32_t    g_fires;
+static uint64_t    g_late_max;
+static uint32_t    g_early;
+static uint32_t    g_out_of_order;
+static uint64_t    g_last_due;
+
+/** xorshift64, so every run checks the same timers. */
+static uint64_t g_random = 0x9E3779B97F4A7C15ULL;
+static uint64_t test_random (uint64_t range)
+{
+    g_random ^= g_random << 13;
+    g_random ^= g_random >> 7;
+    g_random ^= g_random << 17;
+
+    return g_random % range;
+}
+
+/** Moves the time to end, delivering the counter overflow and alarm interrupts on the way. */
+static void test_run_to (uint64_t end)
+{
+    while (g_time < end)
+    {
+        if (g_alarm_running && (g_alarm_due <= end) && (g_alarm_due < g_next_wrap))
+        {
+            g_time          = g_alarm_due;
+            g_alarm_running = false;
+            g_alarm_interrupts++;
+            R_BSP_TimerAlarmCallback(NULL);
+        }
+        else if (g_next_wrap <= end)
+        {
+            g_time       = g_next_wrap;
+            g_next_wrap += TEST_COUNTER_PERIOD;
+            R_BSP_TimerCounterCallback(NULL);
+        }
+        else
+        {
+            g_time = end;
+        }
+    }
+}
+
+/** Checks each expiry against the time it was due and the expiries before it. */
+static void test_timer_callback (bsp_timer_t * p_timer, void * p_context)
+{
+    uint32_t index = (uint32_t) (uintptr_t) p_context;
+    HOST_TEST_CHECK(&g_timers[index] == p_timer);
+
+    uint64_t now = 0U;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_TimestampGet(&now));
+    HOST_TEST_CHECK_EQUAL(g_time, now + g_timestamp_offset);
+    if (now < g_due[index])
+    {
+        g_early++;
+    }
+    else if ((now - g_due[index]) > g_late_max)
+    {
+        g_late_max = now - g_due[index];
+    }
+    if (g_due[index] < g_last_due)
+    {
+        g_out_of_order++;
+    }
+    g_last_due = g_due[index];
+
+    if (g_fires < TEST_FIRES_MAX)
+    {
+        g_fire_log[g_fires] = index;
+    }
+    g_fires++;
+    g_fire_count[index]++;
+    g_due[index] += p_timer->period;
+}
+
+static void test_timer_results_clear (void)
+{
+    memset(g_fire_count, 0, sizeof(g_fire_count));
+    g_fires        = 0U;
+    g_late_max     = 0U;
+    g_early        = 0U;
+    g_out_of_order = 0U;
+    g_last_due     = 0U;
+}
+
+static void test_timer_start (uint32_t index, uint64_t expiry, uint64_t period)
+{
+    g_due[index] = expiry;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_TimerStart(&g_timers[index], expiry, period, test_timer_callback,
+                                                        (void *) (uintptr_t) index));
+    HOST_TEST_CHECK(g_timers[index].running);
+}
+
+/** Timers due from one tick to beyond the top wheel level, started at random times. Every one fires exactly once, in
+ *  expiry order, never early and at most one tick late. */
+static void test_timer_order (void)
+{
+    test_timer_results_clear();
+
+    uint64_t start = g_time;
+    uint64_t last  = g_time + 1000000U;
+    for (uint32_t i = 0U; i < TEST_TIMERS; i++)
+    {
+        /** Delays spread over every power of two up to 2^33 counts, so timers land on each wheel level and past the
+         *  range of the wheel. */
+        uint32_t bits  = 1U + (i % 33U);
+        uint64_t delay = (1ULL << (bits - 1U)) + test_random(1ULL << (bits - 1U));
+        test_timer_start(i, g_time + delay, 0U);
+        last = (g_due[i] > last) ? g_due[i] : last;
+        test_run_to(g_time + test_random(3000U));
+    }
+
+    /** A few of the timers still running are moved to a shared expiry. */
+    HOST_TEST_CHECK(g_time < (start + 1000000U));
+    for (uint32_t i = 20U; i < 28U; i++)
+    {
+        HOST_TEST_CHECK(g_timers[i].running);
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_TimerStop(&g_timers[i]));
+        test_timer_start(i, start + 1000000U, 0U);
+    }
+
+    test_run_to(last + TEST_TICK);
+    HOST_TEST_CHECK(g_time > (start + (1ULL << 32)));
+    HOST_TEST_CHECK_EQUAL(TEST_TIMERS, g_fires);
+    HOST_TEST_CHECK_EQUAL(0U, g_early);
+    HOST_TEST_CHECK_EQUAL(0U, g_out_of_order);
+    HOST_TEST_CHECK(g_late_max < TEST_TICK);
+    for (uint32_t i = 0U; i < TEST_TIMERS; i++)
+    {
+        HOST_TEST_CHECK_EQUAL(1U, g_fire_count[i]);
+        HOST_TEST_CHECK(!g_timers[i].running);
+    }
+
+    /** With nothing to wait for, the alarm is stopped. */
+    HOST_TEST_CHECK(!g_alarm_running);
+}
+
+/** Timers around the instants where the lower wheel levels wrap: the last tick of a level and the first tick after
+ *  it, from every offset inside a tick. */
+static void test_timer_wheel_wrap (void)
+{
+    static const uint64_t level_ticks[] = { 64U, 64U * 64U, 64U * 64U * 64U };
+
+    for (uint32_t level = 0U; level < (sizeof(level_ticks) / sizeof(level_ticks[0])); level++)
+    {
+        test_timer_results_clear();
+
+        /** The next multiple of the level span, in counts. */
+        uint64_t span = level_ticks[level] * TEST_TICK;
+        uint64_t wrap = ((g_time / span) + 2U) * span;
+        uint32_t count = 0U;
+        for (int32_t offset = -3 * (int32_t) TEST_TICK; offset <= (3 * (int32_t) TEST_TICK); offset += 37)
+        {
+            test_timer_start(count, (uint64_t) ((int64_t) wrap + offset), 0U);
+            count++;
+        }
+
+        test_run_to(wrap + (4U * TEST_TICK));
+        HOST_TEST_CHECK_EQUAL(count, g_fires);
+        HOST_TEST_CHECK_EQUAL(0U, g_early);
+        HOST_TEST_CHECK_EQUAL(0U, g_out_of_order);
+        HOST_TEST_CHECK(g_late_max < TEST_TICK);
+
+        /** Timers fire in the order they were started, since that is expiry order. */
+        for (uint32_t i = 0U; i < count; i++)
+        {
+            HOST_TEST_CHECK_EQUAL(i, g_fire_log[i]);
+        }
+    }
+}
+
+/** Callback that stops another timer and restarts itself. */
+static void test_timer_chain_callback (bsp_timer_t * p_timer, void * p_context)
+{
+    test_timer_callback(p_timer, p_context);
+
+    uint32_t index = (uint32_t) (uintptr_t) p_context;
+    if (1U == g_fire_count[index])
+    {
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_TimerStop(&g_timers[index + 1U]));
+        g_due[index] = g_time + 1000U;
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_TimerStart(p_timer, g_due[index], 0U, test_timer_chain_callback,
+                                                            p_context));
+    }
+}
+
+/** Periodic timers fire once per period without drift, stopped timers never fire, and a callback can stop other timers
+ *  and restart its own. */
+static void test_timer_periodic (void)
+{
+    test_timer_results_clear();
+
+    uint64_t start = g_time;
+    test_timer_start(0U, start + 5000U, 5000U);
+    test_timer_start(1U, start + 777U, 100000U);
+    test_timer_start(2U, start + 3000000U, 3000000U);
+    test_timer_start(3U, start + 50000U, 0U);
+    test_timer_start(4U, start + 100U, 0U);
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_TimerStop(&g_timers[4]));
+    HOST_TEST_CHECK(!g_timers[4].running);
+
+    /** Timer 5 restarts itself once and stops timer 6, which is due after it. */
+    g_due[5] = start + 20000U;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_TimerStart(&g_timers[5], g_due[5], 0U, test_timer_chain_callback,
+                                                        (void *) (uintptr_t) 5U));
+    test_timer_start(6U, start + 20500U, 0U);
+
+    test_run_to(start + 30002500U);
+    HOST_TEST_CHECK_EQUAL(6000U, g_fire_count[0]);
+    HOST_TEST_CHECK_EQUAL(301U, g_fire_count[1]);
+    HOST_TEST_CHECK_EQUAL(10U, g_fire_count[2]);
+    HOST_TEST_CHECK_EQUAL(1U, g_fire_count[3]);
+    HOST_TEST_CHECK_EQUAL(0U, g_fire_count[4]);
+    HOST_TEST_CHECK_EQUAL(2U, g_fire_count[5]);
+    HOST_TEST_CHECK_EQUAL(0U, g_fire_count[6]);
+    HOST_TEST_CHECK_EQUAL(0U, g_early);
+    HOST_TEST_CHECK(g_late_max < TEST_TICK);
+
+    for (uint32_t i = 0U; i < 3U; i++)
+    {
+        HOST_TEST_CHECK(g_timers[i].running);
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_TimerStop(&g_timers[i]));
+    }
+    HOST_TEST_CHECK(!g_timers[3].running);
+
+    /** A timer that is already due fires on the next interrupt. */
+    test_timer_results_clear();
+    test_timer_start(0U, g_time - 10U, 0U);
+    test_run_to(g_time + (2U * TEST_TICK));
+    HOST_TEST_CHECK_EQUAL(1U, g_fire_count[0]);
+}
+
+/** Without an alarm, timers are checked on each counter overflow. */
+static void test_timer_without_alarm (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_TimerServiceClose());
+    bsp_timer_service_cfg_t cfg = { .p_counter = &g_counter, .p_alarm = NULL };
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_TimerServiceOpen(&cfg));
+    test_timer_results_clear();
+
+    /** The timestamp starts again from the counter value. */
+    uint64_t now = 0U;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_TimestampGet(&now));
+    HOST_TEST_CHECK_EQUAL(g_time % TEST_COUNTER_PERIOD, now);
+    g_timestamp_offset = g_time - now;
+    for (uint32_t i = 0U; i < 20U; i++)
+    {
+        test_timer_start(i, now + 1000U + (test_random(8U) * TEST_COUNTER_PERIOD) + test_random(TEST_COUNTER_PERIOD),
+                         0U);
+    }
+    test_run_to(g_time + (10U * TEST_COUNTER_PERIOD));
+
+    HOST_TEST_CHECK_EQUAL(20U, g_fires);
+    HOST_TEST_CHECK_EQUAL(0U, g_early);
+    HOST_TEST_CHECK_EQUAL(0U, g_out_of_order);
+    HOST_TEST_CHECK(g_late_max <= TEST_COUNTER_PERIOD);
+    HOST_TEST_CHECK(!g_alarm_running);
+}
+
+int main (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimInit());
+
+    g_time      = 0U;
+    g_next_wrap = TEST_COUNTER_PERIOD;
+    bsp_timer_service_cfg_t cfg = { .p_counter = &g_counter, .p_alarm = &g_alarm };
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_TimerServiceOpen(&cfg));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_ALREADY_OPEN, R_BSP_TimerServiceOpen(&cfg));
+    test_run_to(12345U);
+
+    test_timer_order();
+    test_timer_wheel_wrap();
+    test_timer_periodic();
+    test_timer_without_alarm();
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_TimerServiceClose());
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,231 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : test_bsp_work.c
+ * Description  : Deferred work scheduler: priority and posting order, work posted by interrupts while work runs, the
+ *                drop policy of R_BSP_WorkPostOrCall() when every slot is in use, and slot reuse after the queues
+ *                drain.
+ **********************************************************************************************************************/
+
+#include <string.h>
+
+#include "bsp_api.h"
+#include "host_test.h"
+
+#define TEST_ORDER_MAX          (256U)
+
+SSP_VECTOR_DEFINE_CHAN(test_post_isr, GPT, COUNTER_OVERFLOW, 0);
+
+static char      g_order[TEST_ORDER_MAX];
+static uint32_t  g_order_count;
+static IRQn_Type g_post_irq;
+static char      g_isr_tag;
+
+static bsp_work_stats_t test_work_stats (void)
+{
+    bsp_work_stats_t stats;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_WorkStatsGet(&stats));
+
+    return stats;
+}
+
+/** Records the character it was posted with. */
+static void test_work_record (void * p_context, void * p_args)
+{
+    SSP_PARAMETER_NOT_USED(p_context);
+    HOST_TEST_CHECK(g_order_count < (TEST_ORDER_MAX - 1U));
+    g_order[g_order_count++] = *(char const *) p_args;
+    g_order[g_order_count]   = '\0';
+}
+
+static void test_work_post (char tag, uint32_t priority)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_WorkPost(test_work_record, NULL, &tag, sizeof(tag), priority));
+}
+
+/** Runs all pending work and checks the order it ran in. */
+static void test_work_run (char const * p_expected)
+{
+    g_order_count = 0U;
+    g_order[0]    = '\0';
+    HOST_TEST_CHECK_EQUAL(strlen(p_expected), R_BSP_WorkRunPending());
+    HOST_TEST_CHECK(0 == strcmp(p_expected, g_order));
+}
+
+/** Interrupt that posts urgent work tagged with g_isr_tag. */
+void test_post_isr (void)
+{
+    SF_CONTEXT_SAVE
+    test_work_post(g_isr_tag, 0U);
+    R_BSP_IrqStatusClear(R_SSP_CurrentIrqGet());
+    SF_CONTEXT_RESTORE
+}
+
+/** Work that records its tag, then raises the posting interrupt. */
+static void test_work_interrupted (void * p_context, void * p_args)
+{
+    test_work_record(p_context, p_args);
+    g_isr_tag = (char) (*(char const *) p_args + ('A' - 'a'));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimIrqPend(g_post_irq));
+
+    /** Work functions cannot run the queues themselves. */
+    HOST_TEST_CHECK_EQUAL(0U, R_BSP_WorkRunPending());
+}
+
+/** Work that posts more work of its own priority. */
+static void test_work_repost (void * p_context, void * p_args)
+{
+    test_work_record(p_context, p_args);
+    test_work_post('z', 2U);
+}
+
+/** Most urgent priority first, posting order within a priority. */
+static void test_work_order (void)
+{
+    test_work_post('a', 3U);
+    test_work_post('b', 1U);
+    test_work_post('c', 3U);
+    test_work_post('d', 0U);
+    test_work_post('e', 1U);
+    test_work_post('f', 2U);
+    test_work_run("dbefac");
+
+    /** Work posted by a work function runs after the work already queued at its priority. */
+    char tag = 'r';
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_WorkPost(test_work_repost, NULL, &tag, sizeof(tag), 2U));
+    test_work_post('s', 2U);
+    test_work_post('t', 3U);
+    test_work_run("rszt");
+
+    /** Urgent work posted by an interrupt runs before the rest of the less urgent work. */
+    for (char c = 'a'; c < 'd'; c++)
+    {
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_WorkPost(test_work_interrupted, NULL, &c, sizeof(c), 3U));
+    }
+    test_work_run("aAbBcC");
+
+    /** The arguments were copied when posted, and oversized arguments and unknown priorities are rejected. */
+    uint8_t args[BSP_WORK_ARGS_MAX_BYTES + 1U];
+    memset(args, 'x', sizeof(args));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_SIZE,
+                          R_BSP_WorkPost(test_work_record, NULL, args, BSP_WORK_ARGS_MAX_BYTES + 1U, 0U));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_ARGUMENT,
+                          R_BSP_WorkPost(test_work_record, NULL, args, 1U, BSP_CFG_WORK_PRIORITIES));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_ASSERTION, R_BSP_WorkPost(NULL, NULL, args, 1U, 0U));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_ASSERTION, R_BSP_WorkPost(test_work_record, NULL, NULL, 1U, 0U));
+    test_work_run("");
+}
+
+/** With every slot in use, posts fail and deferred events are dropped and counted, never called in place.  Events
+ *  after the drop are delivered again once slots are free. */
+static void test_work_drop (void)
+{
+    bsp_work_stats_t before = test_work_stats();
+    char             expected[BSP_CFG_WORK_SLOTS + 1U];
+
+    for (uint32_t i = 0U; i < BSP_CFG_WORK_SLOTS; i++)
+    {
+        char tag = (char) ('A' + i);
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_WorkPostOrCall(true, test_work_record, NULL, &tag, 1U, i % 2U));
+        expected[i] = tag;
+    }
+    expected[BSP_CFG_WORK_SLOTS] = '\0';
+
+    g_order_count = 0U;
+    for (uint32_t i = 0U; i < 5U; i++)
+    {
+        char tag = '!';
+        HOST_TEST_CHECK_EQUAL(SSP_ERR_OUT_OF_MEMORY, R_BSP_WorkPostOrCall(true, test_work_record, NULL, &tag, 1U, 0U));
+    }
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_OUT_OF_MEMORY, R_BSP_WorkPost(test_work_record, NULL, expected, 1U, 0U));
+    HOST_TEST_CHECK_EQUAL(0U, g_order_count);
+
+    bsp_work_stats_t after = test_work_stats();
+    HOST_TEST_CHECK_EQUAL(before.posted + BSP_CFG_WORK_SLOTS, after.posted);
+    HOST_TEST_CHECK_EQUAL(before.failures + 6U, after.failures);
+    HOST_TEST_CHECK_EQUAL(before.dropped + 5U, after.dropped);
+    HOST_TEST_CHECK_EQUAL(BSP_CFG_WORK_SLOTS, after.slots_used_max);
+
+    /** A call that is not deferred runs in place even with the queues full. */
+    char tag = '#';
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_WorkPostOrCall(false, test_work_record, NULL, &tag, 1U, 0U));
+    HOST_TEST_CHECK(0 == strcmp("#", g_order));
+
+    /** Priority 0 first, each priority in posting order. */
+    char ordered[BSP_CFG_WORK_SLOTS + 1U];
+    uint32_t count = 0U;
+    for (uint32_t parity = 0U; parity < 2U; parity++)
+    {
+        for (uint32_t i = parity; i < BSP_CFG_WORK_SLOTS; i += 2U)
+        {
+            ordered[count++] = expected[i];
+        }
+    }
+    ordered[count] = '\0';
+    test_work_run(ordered);
+
+    after = test_work_stats();
+    HOST_TEST_CHECK_EQUAL(after.posted, after.run);
+    HOST_TEST_CHECK_EQUAL(before.dropped + 5U, after.dropped);
+}
+
+/** All slots can be used again after the queues drain, over many rounds. */
+static void test_work_reuse (void)
+{
+    for (uint32_t round = 0U; round < 20U; round++)
+    {
+        uint32_t count = 1U + ((round * 7U) % BSP_CFG_WORK_SLOTS);
+        char     expected[BSP_CFG_WORK_SLOTS + 1U];
+        for (uint32_t i = 0U; i < count; i++)
+        {
+            expected[i] = (char) ('a' + ((round + i) % 26U));
+            test_work_post(expected[i], BSP_CFG_WORK_PRIORITIES - 1U);
+        }
+        expected[count] = '\0';
+        test_work_run(expected);
+    }
+
+    bsp_work_stats_t stats = test_work_stats();
+    HOST_TEST_CHECK_EQUAL(stats.posted, stats.run);
+    HOST_TEST_CHECK_EQUAL(BSP_CFG_WORK_SLOTS, stats.slots_used_max);
+}
+
+int main (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimInit());
+
+    for (uint32_t irq = 0U; irq < BSP_VECTOR_TABLE_MAX_ENTRIES; irq++)
+    {
+        if (test_post_isr == R_BSP_SimVectorGet((IRQn_Type) irq))
+        {
+            g_post_irq = (IRQn_Type) irq;
+        }
+    }
+    HOST_TEST_CHECK(test_post_isr == R_BSP_SimVectorGet(g_post_irq));
+    NVIC_SetPriority(g_post_irq, 4U);
+    NVIC_EnableIRQ(g_post_irq);
+    __enable_irq();
+
+    test_work_order();
+    test_work_drop();
+    test_work_reuse();
+
+    return HOST_TEST_RESULT();
+}
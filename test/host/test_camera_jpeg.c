@@ -0,0 +1,517 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : test_camera_jpeg.c
+ * Description  : Band capture into the JPEG encoder with sf_camera_jpeg on the simulated PDC and a model of the
+ *                encoder: bands are fed while the frame is still being captured, band buffers are used in turn and
+ *                returned to the PDC once encoded, encoded data reaches the callback in order, frames that find the
+ *                output ring full or the encoder busy are dropped, and capture restarts after a stop mid-frame.
+ **********************************************************************************************************************/
+
+#include <string.h>
+
+#include "bsp_api.h"
+#include "r_pdc.h"
+#include "r_dmac.h"
+#include "sf_camera_jpeg.h"
+#include "host_test.h"
+
+#define TEST_WIDTH              (64U)
+#define TEST_HEIGHT             (40U)
+#define TEST_BYTES_PER_PIXEL    (2U)
+#define TEST_BAND_LINES         (16U)
+#define TEST_BANDS              (4U)
+#define TEST_LINE_BYTES         ((TEST_WIDTH * TEST_BYTES_PER_PIXEL) + 8U)
+#define TEST_BAND_BYTES         (TEST_WIDTH * TEST_BAND_LINES * TEST_BYTES_PER_PIXEL)
+#define TEST_HEADER_BYTES       (8U)
+#define TEST_LINE_CODE_BYTES    (4U)
+#define TEST_FRAME_CODE_BYTES   (TEST_HEADER_BYTES + (TEST_HEIGHT * TEST_LINE_CODE_BYTES))
+#define TEST_OUTPUT_BYTES       (512U)
+#define TEST_OUTPUT_FRAME_MAX   (200U)
+#define TEST_INPUTS_MAX         (16U)
+#define TEST_EVENTS_MAX         (16U)
+
+SSP_VECTOR_DEFINE(pdc_frame_end_isr, PDC, FRAME_END);
+SSP_VECTOR_DEFINE(pdc_int_isr, PDC, INT);
+SSP_VECTOR_DEFINE_CHAN(dmac_int_isr, DMAC, INT, 0);
+
+/** Camera image with one line and one pixel outside the capture window on each side. */
+static uint8_t              g_image[TEST_HEIGHT + 2U][TEST_LINE_BYTES];
+static uint8_t              g_bands[TEST_BANDS][TEST_BAND_BYTES] __attribute__((aligned(8)));
+static uint8_t              g_output[TEST_OUTPUT_BYTES] __attribute__((aligned(8)));
+static uint8_t            * g_band_buffers[TEST_BANDS] = { g_bands[0], g_bands[1], g_bands[2], g_bands[3] };
+
+static transfer_info_t      g_dmac_info;
+static dmac_instance_ctrl_t g_dmac_ctrl;
+static transfer_on_dmac_cfg_t g_dmac_ext = { .channel = 0U };
+static transfer_cfg_t       g_dmac_cfg   = { .p_info = &g_dmac_info, .irq_ipl = 2U, .p_extend = &g_dmac_ext,
+                                             .activation_source = ELC_EVENT_PDC_RECEIVE_DATA_READY };
+static transfer_instance_t  g_dmac       = { .p_ctrl = &g_dmac_ctrl, .p_cfg = &g_dmac_cfg,
+                                             .p_api = &g_transfer_on_dmac };
+
+static pdc_instance_ctrl_t  g_pdc_ctrl;
+static pdc_cfg_t            g_pdc_cfg =
+{
+    .x_capture_start_pixel = 1U,
+    .x_capture_pixels      = TEST_WIDTH,
+    .y_capture_start_pixel = 1U,
+    .y_capture_pixels      = TEST_HEIGHT,
+    .bytes_per_pixel       = TEST_BYTES_PER_PIXEL,
+    .frame_end_ipl         = 3U,
+    .irq_ipl               = 3U,
+    .p_lower_lvl_transfer  = &g_dmac,
+};
+static pdc_instance_t const g_pdc = { .p_ctrl = &g_pdc_ctrl, .p_cfg = &g_pdc_cfg, .p_api = &g_pdc_on_pdc };
+
+/** Model of the JPEG encoder. The header is written when a frame starts, each line encodes to its first
+ *  TEST_LINE_CODE_BYTES bytes, and a band is only read when test_encoder_run() is called. */
+typedef struct st_test_encoder
+{
+    bool                      open;
+    jpeg_encode_cfg_t const * p_cfg;
+    jpeg_encode_status_t      status;
+    uint8_t                 * p_output;
+    uint8_t                 * p_input;
+    uint32_t                  lines;             ///< Lines of the band waiting to be encoded
+    uint32_t                  lines_done;        ///< Lines of the frame encoded
+    uint32_t                  size;              ///< Bytes of the frame written
+    uint32_t                  opens;
+} test_encoder_t;
+
+/** Band passed to the encoder. */
+typedef struct st_test_input
+{
+    uint32_t band;                               ///< Index of the band buffer in g_bands
+    uint32_t bytes;
+    bool     capturing;                          ///< Passed while the PDC was still capturing the frame
+} test_input_t;
+
+/** Event passed to the callback. */
+typedef struct st_test_event
+{
+    sf_camera_jpeg_event_t event;
+    uint32_t               frame;
+    uint32_t               offset;               ///< Offset of the frame in g_output
+    uint32_t               frame_size;
+    bool                   content_ok;           ///< FRAME_COMPLETE: the frame encodes the image it was sent with
+} test_event_t;
+
+static test_encoder_t       g_encoder;
+static uint32_t             g_encoder_ctrl;
+static test_input_t         g_inputs[TEST_INPUTS_MAX];
+static uint32_t             g_input_count;
+static bool                 g_capturing;
+static test_event_t         g_events[TEST_EVENTS_MAX];
+static uint32_t             g_event_count;
+static uint32_t             g_received;          ///< Bytes of the current frame passed to the callback
+static bool                 g_release;           ///< The callback returns each frame at once
+static uint32_t             g_seeds[TEST_EVENTS_MAX];    ///< Image seed by frame number
+static uint32_t             g_frame_sent;
+static sf_camera_jpeg_instance_ctrl_t g_camera_ctrl;
+
+static ssp_err_t test_encoder_open (jpeg_encode_ctrl_t * const p_api_ctrl, jpeg_encode_cfg_t const * const p_cfg)
+{
+    SSP_PARAMETER_NOT_USED(p_api_ctrl);
+    if (g_encoder.open)
+    {
+        return SSP_ERR_IN_USE;
+    }
+
+    uint32_t opens = g_encoder.opens;
+    memset(&g_encoder, 0, sizeof(g_encoder));
+    g_encoder.open   = true;
+    g_encoder.p_cfg  = p_cfg;
+    g_encoder.status = JPEG_ENCODE_STATUS_IDLE;
+    g_encoder.opens  = opens + 1U;
+
+    return SSP_SUCCESS;
+}
+
+static ssp_err_t test_encoder_close (jpeg_encode_ctrl_t * const p_api_ctrl)
+{
+    SSP_PARAMETER_NOT_USED(p_api_ctrl);
+    g_encoder.open   = false;
+    g_encoder.status = JPEG_ENCODE_STATUS_FREE;
+    g_encoder.lines  = 0U;
+
+    return SSP_SUCCESS;
+}
+
+static ssp_err_t test_encoder_output_set (jpeg_encode_ctrl_t * const p_api_ctrl, void * p_output_buffer)
+{
+    SSP_PARAMETER_NOT_USED(p_api_ctrl);
+    g_encoder.p_output = p_output_buffer;
+
+    return SSP_SUCCESS;
+}
+
+static ssp_err_t test_encoder_input_set (jpeg_encode_ctrl_t * const p_api_ctrl, void * p_data_buffer,
+                                         uint32_t num_bytes)
+{
+    SSP_PARAMETER_NOT_USED(p_api_ctrl);
+    HOST_TEST_CHECK(g_input_count < TEST_INPUTS_MAX);
+    test_input_t * p_input = &g_inputs[g_input_count++];
+    p_input->band      = (uint32_t) (((uint8_t *) p_data_buffer - g_bands[0]) / TEST_BAND_BYTES);
+    p_input->bytes     = num_bytes;
+    p_input->capturing = g_capturing;
+
+    if (!g_encoder.open)
+    {
+        return SSP_ERR_NOT_OPEN;
+    }
+
+    if (g_encoder.status & (JPEG_ENCODE_STATUS_IDLE | JPEG_ENCODE_STATUS_DONE))
+    {
+        g_encoder.lines_done = 0U;
+        g_encoder.size       = TEST_HEADER_BYTES;
+        memcpy(g_encoder.p_output, "JPEGHDR!", TEST_HEADER_BYTES);
+    }
+    else if (!(g_encoder.status & JPEG_ENCODE_STATUS_INPUT_PAUSE))
+    {
+        return SSP_ERR_IN_USE;
+    }
+
+    g_encoder.status  = JPEG_ENCODE_STATUS_RUNNING;
+    g_encoder.p_input = p_data_buffer;
+    g_encoder.lines   = num_bytes / (TEST_WIDTH * TEST_BYTES_PER_PIXEL);
+
+    return SSP_SUCCESS;
+}
+
+static ssp_err_t test_encoder_status_get (jpeg_encode_ctrl_t * const p_api_ctrl,
+                                          volatile jpeg_encode_status_t * p_status)
+{
+    SSP_PARAMETER_NOT_USED(p_api_ctrl);
+    *p_status = g_encoder.status;
+
+    return SSP_SUCCESS;
+}
+
+static jpeg_encode_api_t const g_encoder_api =
+{
+    .open            = test_encoder_open,
+    .close           = test_encoder_close,
+    .outputBufferSet = test_encoder_output_set,
+    .inputBufferSet  = test_encoder_input_set,
+    .statusGet       = test_encoder_status_get,
+};
+static jpeg_encode_cfg_t const g_encoder_cfg =
+{
+    .horizontal_resolution = TEST_WIDTH,
+    .vertical_resolution   = TEST_HEIGHT,
+};
+static jpeg_encode_instance_t const g_encoder_instance =
+{
+    .p_ctrl = &g_encoder_ctrl, .p_cfg = &g_encoder_cfg, .p_api = &g_encoder_api
+};
+
+/** Encodes the band passed to the model, if any, and raises the encoder interrupt. */
+static void test_encoder_run (void)
+{
+    __disable_irq();
+    if (0U != g_encoder.lines)
+    {
+        for (uint32_t y = 0U; y < g_encoder.lines; y++)
+        {
+            memcpy(g_encoder.p_output + g_encoder.size, g_encoder.p_input + (y * TEST_WIDTH * TEST_BYTES_PER_PIXEL),
+                   TEST_LINE_CODE_BYTES);
+            g_encoder.size += TEST_LINE_CODE_BYTES;
+        }
+
+        /** The band buffer is not read again once encoded. */
+        memset(g_encoder.p_input, 0xEE, g_encoder.lines * TEST_WIDTH * TEST_BYTES_PER_PIXEL);
+        g_encoder.lines_done += g_encoder.lines;
+        g_encoder.lines       = 0U;
+        g_encoder.status      = (g_encoder.lines_done < TEST_HEIGHT) ? JPEG_ENCODE_STATUS_INPUT_PAUSE :
+                                JPEG_ENCODE_STATUS_DONE;
+
+        jpeg_encode_callback_args_t args =
+        {
+            .status = g_encoder.status, .image_size = g_encoder.size, .p_context = g_encoder.p_cfg->p_context
+        };
+        g_encoder.p_cfg->p_callback(&args);
+    }
+    __enable_irq();
+    R_BSP_SimIrqDispatch();
+}
+
+static uint8_t test_camera_pixel (uint32_t seed, uint32_t line, uint32_t byte)
+{
+    return (uint8_t) ((seed * 7U) + (line * 13U) + byte);
+}
+
+/** True if the frame is the header followed by the first bytes of each line of the image sent with seed. */
+static bool test_camera_frame_check (uint8_t const * p_frame, uint32_t seed)
+{
+    if (0 != memcmp(p_frame, "JPEGHDR!", TEST_HEADER_BYTES))
+    {
+        return false;
+    }
+
+    for (uint32_t y = 0U; y < TEST_HEIGHT; y++)
+    {
+        for (uint32_t x = 0U; x < TEST_LINE_CODE_BYTES; x++)
+        {
+            if (p_frame[TEST_HEADER_BYTES + (y * TEST_LINE_CODE_BYTES) + x] !=
+                test_camera_pixel(seed, y + 1U, x + TEST_BYTES_PER_PIXEL))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+static void test_camera_callback (sf_camera_jpeg_callback_args_t * p_args)
+{
+    HOST_TEST_CHECK(g_event_count < TEST_EVENTS_MAX);
+    test_event_t * p_event = &g_events[g_event_count++];
+    p_event->event      = p_args->event;
+    p_event->frame      = p_args->frame;
+    p_event->offset     = UINT32_MAX;
+    p_event->frame_size = p_args->frame_size;
+    p_event->content_ok = false;
+    if ((SF_CAMERA_JPEG_EVENT_DATA != p_args->event) && (SF_CAMERA_JPEG_EVENT_FRAME_COMPLETE != p_args->event))
+    {
+        g_received = 0U;
+        return;
+    }
+
+    /** Data continues where the previous data of the frame ended. */
+    p_event->offset = (uint32_t) (p_args->p_frame - g_output);
+    HOST_TEST_CHECK(p_args->p_data == (p_args->p_frame + g_received));
+    HOST_TEST_CHECK(0U != p_args->length);
+    g_received += p_args->length;
+    HOST_TEST_CHECK_EQUAL(g_received, p_args->frame_size);
+    if (SF_CAMERA_JPEG_EVENT_FRAME_COMPLETE != p_args->event)
+    {
+        HOST_TEST_CHECK_EQUAL(0U, p_args->frame_size % 8U);
+        return;
+    }
+
+    g_received = 0U;
+    HOST_TEST_CHECK(p_args->frame < TEST_EVENTS_MAX);
+    p_event->content_ok = test_camera_frame_check(p_args->p_frame, g_seeds[p_args->frame]);
+    if (g_release)
+    {
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_camera_jpeg_on_sf_camera_jpeg.frameRelease(&g_camera_ctrl));
+    }
+}
+
+static sf_camera_jpeg_cfg_t g_camera_cfg =
+{
+    .p_lower_lvl_pdc    = &g_pdc,
+    .p_lower_lvl_jpeg   = &g_encoder_instance,
+    .pp_band_buffers    = g_band_buffers,
+    .num_band_buffers   = TEST_BANDS,
+    .band_lines         = TEST_BAND_LINES,
+    .p_output_buffer    = g_output,
+    .output_buffer_size = TEST_OUTPUT_BYTES,
+    .output_frame_max   = TEST_OUTPUT_FRAME_MAX,
+    .p_callback         = test_camera_callback,
+};
+
+/** Sends the next frame through the PDC, then lets the encoder run encoder_runs times. */
+static void test_camera_frame_send (uint32_t seed, uint32_t encoder_runs)
+{
+    g_frame_sent++;
+    HOST_TEST_CHECK(g_frame_sent < TEST_EVENTS_MAX);
+    g_seeds[g_frame_sent] = seed;
+    for (uint32_t y = 0U; y < (TEST_HEIGHT + 2U); y++)
+    {
+        for (uint32_t x = 0U; x < TEST_LINE_BYTES; x++)
+        {
+            g_image[y][x] = test_camera_pixel(seed, y, x);
+        }
+    }
+
+    g_capturing = true;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimPdcFrame(&g_image[0][0], TEST_LINE_BYTES, TEST_HEIGHT + 2U));
+    R_BSP_SimIrqDispatch();
+    g_capturing = false;
+
+    for (uint32_t i = 0U; i < encoder_runs; i++)
+    {
+        test_encoder_run();
+    }
+}
+
+static void test_camera_events_reset (void)
+{
+    g_event_count = 0U;
+    g_input_count = 0U;
+}
+
+static void test_camera_event_check (uint32_t index, sf_camera_jpeg_event_t event, uint32_t frame, uint32_t size)
+{
+    HOST_TEST_CHECK(index < g_event_count);
+    HOST_TEST_CHECK_EQUAL(event, g_events[index].event);
+    HOST_TEST_CHECK_EQUAL(frame, g_events[index].frame);
+    if (SF_CAMERA_JPEG_EVENT_FRAME_DROPPED != event)
+    {
+        HOST_TEST_CHECK_EQUAL(size, g_events[index].frame_size);
+    }
+}
+
+/** Each frame is fed to the encoder in bands while it is captured, and band buffers are used in turn. */
+static void test_camera_bands (void)
+{
+    g_release = true;
+    for (uint32_t frame = 1U; frame <= 2U; frame++)
+    {
+        test_camera_events_reset();
+        test_camera_frame_send(frame, 5U);
+
+        /** Two full bands and the last 8 lines, the first passed before the frame was captured. */
+        HOST_TEST_CHECK_EQUAL(3U, g_input_count);
+        HOST_TEST_CHECK(g_inputs[0].capturing);
+        for (uint32_t i = 0U; i < g_input_count; i++)
+        {
+            HOST_TEST_CHECK_EQUAL(((frame - 1U) * 3U + i) % TEST_BANDS, g_inputs[i].band);
+            HOST_TEST_CHECK_EQUAL((i < 2U) ? TEST_BAND_BYTES : (TEST_BAND_BYTES / 2U), g_inputs[i].bytes);
+        }
+
+        /** Data of each band as it is encoded, then the rest of the frame. */
+        HOST_TEST_CHECK_EQUAL(3U, g_event_count);
+        test_camera_event_check(0U, SF_CAMERA_JPEG_EVENT_DATA, frame, TEST_HEADER_BYTES + (16U * 4U));
+        test_camera_event_check(1U, SF_CAMERA_JPEG_EVENT_DATA, frame, TEST_HEADER_BYTES + (32U * 4U));
+        test_camera_event_check(2U, SF_CAMERA_JPEG_EVENT_FRAME_COMPLETE, frame, TEST_FRAME_CODE_BYTES);
+        HOST_TEST_CHECK_EQUAL(0U, g_events[2].offset);
+        HOST_TEST_CHECK(g_events[2].content_ok);
+    }
+
+    /** Nothing is held in the output ring. */
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_CALL, g_sf_camera_jpeg_on_sf_camera_jpeg.frameRelease(&g_camera_ctrl));
+}
+
+/** Completed frames stay in the output ring until released, and a frame that finds no space is dropped. */
+static void test_camera_output_full (void)
+{
+    g_release = false;
+    test_camera_events_reset();
+    for (uint32_t i = 0U; i < 3U; i++)
+    {
+        test_camera_frame_send(10U + i, 5U);
+    }
+
+    HOST_TEST_CHECK_EQUAL(7U, g_event_count);
+    test_camera_event_check(2U, SF_CAMERA_JPEG_EVENT_FRAME_COMPLETE, 3U, TEST_FRAME_CODE_BYTES);
+    HOST_TEST_CHECK_EQUAL(0U, g_events[2].offset);
+    HOST_TEST_CHECK(g_events[2].content_ok);
+    test_camera_event_check(5U, SF_CAMERA_JPEG_EVENT_FRAME_COMPLETE, 4U, TEST_FRAME_CODE_BYTES);
+    HOST_TEST_CHECK_EQUAL(TEST_FRAME_CODE_BYTES, g_events[5].offset);
+    HOST_TEST_CHECK(g_events[5].content_ok);
+    test_camera_event_check(6U, SF_CAMERA_JPEG_EVENT_FRAME_DROPPED, 5U, 0U);
+
+    /** The frame at offset 0 is still intact, and both frames can be released, oldest first. */
+    HOST_TEST_CHECK(test_camera_frame_check(g_output, g_seeds[3]));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_camera_jpeg_on_sf_camera_jpeg.frameRelease(&g_camera_ctrl));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_camera_jpeg_on_sf_camera_jpeg.frameRelease(&g_camera_ctrl));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_CALL, g_sf_camera_jpeg_on_sf_camera_jpeg.frameRelease(&g_camera_ctrl));
+
+    /** Frames are encoded again once space is free. */
+    g_release = true;
+    test_camera_events_reset();
+    test_camera_frame_send(13U, 5U);
+    HOST_TEST_CHECK_EQUAL(3U, g_event_count);
+    test_camera_event_check(2U, SF_CAMERA_JPEG_EVENT_FRAME_COMPLETE, 6U, TEST_FRAME_CODE_BYTES);
+    HOST_TEST_CHECK(g_events[2].content_ok);
+}
+
+/** A frame that arrives while every band buffer is held for the previous frame is dropped by the PDC and reported,
+ *  and the previous frame and the next one are encoded intact. */
+static void test_camera_slow_encoder (void)
+{
+    uint32_t opens = g_encoder.opens;
+
+    test_camera_events_reset();
+    test_camera_frame_send(20U, 0U);
+    test_camera_frame_send(21U, 5U);
+    test_camera_frame_send(22U, 5U);
+
+    uint32_t completed = 0U;
+    uint32_t dropped   = 0U;
+    for (uint32_t i = 0U; i < g_event_count; i++)
+    {
+        if (SF_CAMERA_JPEG_EVENT_FRAME_COMPLETE == g_events[i].event)
+        {
+            HOST_TEST_CHECK(g_events[i].content_ok);
+            HOST_TEST_CHECK((7U == g_events[i].frame) || (9U == g_events[i].frame));
+            completed++;
+        }
+        else if (SF_CAMERA_JPEG_EVENT_FRAME_DROPPED == g_events[i].event)
+        {
+            HOST_TEST_CHECK_EQUAL(8U, g_events[i].frame);
+            dropped++;
+        }
+    }
+
+    HOST_TEST_CHECK_EQUAL(2U, completed);
+    HOST_TEST_CHECK_EQUAL(1U, dropped);
+
+    /** The PDC dropped the frame before any of it reached the encoder, so the encoder was not reset. */
+    HOST_TEST_CHECK_EQUAL(opens, g_encoder.opens);
+}
+
+/** Stopping in the middle of a frame drops it, and capture starts again with frame 1. */
+static void test_camera_stop (void)
+{
+    test_camera_events_reset();
+    test_camera_frame_send(30U, 0U);
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_camera_jpeg_on_sf_camera_jpeg.stop(&g_camera_ctrl));
+    HOST_TEST_CHECK_EQUAL(1U, g_event_count);
+    test_camera_event_check(0U, SF_CAMERA_JPEG_EVENT_FRAME_DROPPED, 10U, 0U);
+
+    /** The PDC is stopped. */
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_NOT_ENABLED, R_BSP_SimPdcFrame(&g_image[0][0], TEST_LINE_BYTES, TEST_HEIGHT + 2U));
+
+    test_camera_events_reset();
+    g_frame_sent = 0U;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_camera_jpeg_on_sf_camera_jpeg.start(&g_camera_ctrl));
+    test_camera_frame_send(31U, 5U);
+    HOST_TEST_CHECK_EQUAL(3U, g_event_count);
+    test_camera_event_check(2U, SF_CAMERA_JPEG_EVENT_FRAME_COMPLETE, 1U, TEST_FRAME_CODE_BYTES);
+    HOST_TEST_CHECK(g_events[2].content_ok);
+}
+
+int main (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimInit());
+    __enable_irq();
+
+    /** Bands must be a multiple of the 8-line JPEG block height. */
+    g_camera_cfg.band_lines = 12U;
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_ARGUMENT, g_sf_camera_jpeg_on_sf_camera_jpeg.open(&g_camera_ctrl,
+                                                                                         &g_camera_cfg));
+    g_camera_cfg.band_lines = TEST_BAND_LINES;
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_camera_jpeg_on_sf_camera_jpeg.open(&g_camera_ctrl, &g_camera_cfg));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_camera_jpeg_on_sf_camera_jpeg.start(&g_camera_ctrl));
+
+    test_camera_bands();
+    test_camera_output_full();
+    test_camera_slow_encoder();
+    test_camera_stop();
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_camera_jpeg_on_sf_camera_jpeg.close(&g_camera_ctrl));
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,631 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : test_can_receive.c
+ * Description  : CAN receive path: the mailbox IDs and group masks compiled from a filter list accept every listed ID
+ *                and, when the receive mailboxes allow it, nothing else; the receive FIFO filled by the receive ISR
+ *                wraps, overflows and is drained by R_CAN_ReadBatch in reception order.
+ *                The driver source is compiled into this test so that its static functions can be called.
+ **********************************************************************************************************************/
+
+#include "../../synergy/ssp/src/driver/r_can/r_can.c"
+#include "host_test.h"
+
+#define TEST_CAN_MAILBOXES      (8U)
+#define TEST_CAN_RX_MAILBOXES   (4U)
+#define TEST_CAN_FIFO_SIZE      (8U)
+#define TEST_CAN_FRAMES_MAX     (256U)
+#define TEST_CAN_NEWDATA        (0x01U)
+#define TEST_CAN_INVALDATA      (0x02U)
+#define TEST_CAN_MSGLOST        (0x04U)
+
+SSP_VECTOR_DEFINE_CHAN(can_mailbox_rx_isr, CAN, MAILBOX_RX, 0);
+
+/** Register block the filter compiler writes to. */
+static R_CAN0_Type    g_filter_regs;
+static can_mailbox_t  g_filter_mailboxes[CAN_MAX_NO_MAILBOXES];
+static uint32_t       g_filter_masks[CAN_FILTER_GROUPS];
+
+/** Receive FIFO test state. */
+static can_instance_ctrl_t g_can_ctrl;
+static can_rx_frame_t      g_can_fifo[TEST_CAN_FIFO_SIZE];
+static can_mailbox_t       g_can_mailboxes[TEST_CAN_MAILBOXES];
+static uint32_t            g_can_masks[TEST_CAN_MAILBOXES / CAN_MAILBOX_GROUP_SIZE];
+static can_id_t            g_can_mailbox_id[TEST_CAN_RX_MAILBOXES];  ///< ID received by each receive mailbox
+static uint32_t            g_can_fifo_ready;
+static uint32_t            g_can_fifo_overflow;
+static uint32_t            g_can_sent;                               ///< Frames put on the bus
+static uint32_t            g_can_read;                               ///< Frames read back
+static uint8_t             g_can_sequence[TEST_CAN_FRAMES_MAX];      ///< Sequence numbers in expected read order
+static uint32_t            g_can_expected;                           ///< Frames expected in g_can_sequence
+
+static void test_can_callback (can_callback_args_t * p_args)
+{
+    HOST_TEST_CHECK_EQUAL(0U, p_args->channel);
+    if (CAN_EVENT_RX_FIFO_READY == p_args->event)
+    {
+        g_can_fifo_ready++;
+    }
+    else
+    {
+        HOST_TEST_CHECK_EQUAL(CAN_EVENT_RX_FIFO_OVERFLOW, p_args->event);
+        g_can_fifo_overflow++;
+    }
+}
+
+static can_bit_timing_cfg_t g_can_timing =
+{
+    .baud_rate_prescaler        = 6U,
+    .time_segment_1             = CAN_TIME_SEGMENT1_TQ10,
+    .time_segment_2             = CAN_TIME_SEGMENT2_TQ4,
+    .synchronization_jump_width = CAN_SYNC_JUMP_WIDTH_TQ1,
+};
+
+/** One ID per receive mailbox, so that a receive interrupt finds up to TEST_CAN_RX_MAILBOXES frames. */
+static can_filter_t const g_can_filter[TEST_CAN_RX_MAILBOXES] =
+{
+    { 0x101U, 0x101U, CAN_FRAME_TYPE_DATA },
+    { 0x202U, 0x202U, CAN_FRAME_TYPE_DATA },
+    { 0x303U, 0x303U, CAN_FRAME_TYPE_DATA },
+    { 0x404U, 0x404U, CAN_FRAME_TYPE_DATA },
+};
+
+static can_extended_cfg_t const g_can_ext =
+{
+    .clock_source   = CAN_CLOCK_SOURCE_PCLKB,
+    .p_mailbox_mask = g_can_masks,
+    .p_rx_fifo      = g_can_fifo,
+    .rx_fifo_size   = TEST_CAN_FIFO_SIZE,
+    .p_filter       = g_can_filter,
+    .filter_count   = TEST_CAN_RX_MAILBOXES,
+};
+
+static can_cfg_t const g_can_cfg =
+{
+    .channel        = 0U,
+    .p_bit_timing   = &g_can_timing,
+    .id_mode        = CAN_ID_MODE_STANDARD,
+    .mailbox_count  = TEST_CAN_MAILBOXES,
+    .p_mailbox      = g_can_mailboxes,
+    .message_mode   = CAN_MESSAGE_MODE_OVERRUN,
+    .p_callback     = test_can_callback,
+    .p_extend       = &g_can_ext,
+    .error_ipl      = BSP_IRQ_DISABLED,
+    .mailbox_rx_ipl = 3U,
+    .mailbox_tx_ipl = BSP_IRQ_DISABLED,
+};
+
+/** Finds the lowest receive mailbox that accepts a frame, as the CAN module does. */
+static bool test_can_accepts (R_CAN0_Type const * p_regs, can_id_mode_t id_mode, uint32_t mailbox_count, can_id_t id,
+                              can_frame_type_t type, uint32_t * p_mailbox)
+{
+    uint32_t id_mask = (CAN_ID_MODE_STANDARD == id_mode) ? CAN_SID_MASK : CAN_XID_MASK;
+
+    for (uint32_t mailbox = 0U; mailbox < mailbox_count; mailbox++)
+    {
+        if ((CAN_MAILBOX_RX != (p_regs->MCTLn_RX[mailbox] & CAN_MAILBOX_RX)) ||
+            ((uint32_t) type != p_regs->MBn[mailbox].MBn_ID_b.RTR))
+        {
+            continue;
+        }
+
+        uint32_t mailbox_id;
+        uint32_t care;
+        if (CAN_ID_MODE_STANDARD == id_mode)
+        {
+            mailbox_id = p_regs->MBn[mailbox].MBn_ID_b.SID;
+            care       = p_regs->MKRn_b[mailbox / CAN_MAILBOX_GROUP_SIZE].SID;
+        }
+        else
+        {
+            mailbox_id = p_regs->MBn[mailbox].MBn_ID & CAN_XID_MASK;
+            care       = p_regs->MKRn[mailbox / CAN_MAILBOX_GROUP_SIZE] & CAN_XID_MASK;
+        }
+
+        /** A mailbox with its mask disabled compares every ID bit. */
+        if (0U != (p_regs->MKIVLR & (1U << mailbox)))
+        {
+            care = id_mask;
+        }
+
+        if (0U == ((mailbox_id ^ id) & care & id_mask))
+        {
+            *p_mailbox = mailbox;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static bool test_can_filter_wanted (can_filter_t const * p_filter, uint32_t filter_count, can_id_t id,
+                                    can_frame_type_t type)
+{
+    for (uint32_t i = 0U; i < filter_count; i++)
+    {
+        if ((id >= p_filter[i].id_first) && (id <= p_filter[i].id_last) && (type == p_filter[i].frame_type))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/** Compiles a filter list into mailboxes 0 to mailbox_count - 1, of which the ones set in rx_mailboxes receive. */
+static ssp_err_t test_can_filter_compile (can_filter_t const * p_filter, uint32_t filter_count, can_id_mode_t id_mode,
+                                          uint32_t mailbox_count, uint32_t rx_mailboxes)
+{
+    can_extended_cfg_t ext =
+    {
+        .p_mailbox_mask = g_filter_masks,
+        .p_filter       = p_filter,
+        .filter_count   = filter_count,
+    };
+    can_cfg_t cfg =
+    {
+        .id_mode       = id_mode,
+        .mailbox_count = mailbox_count,
+        .p_mailbox     = g_filter_mailboxes,
+        .p_extend      = &ext,
+    };
+
+    memset(&g_filter_regs, 0, sizeof(g_filter_regs));
+    for (uint32_t i = 0U; i < CAN_MAX_NO_MAILBOXES; i++)
+    {
+        g_filter_mailboxes[i].mailbox_id   = 0x7FFU;
+        g_filter_mailboxes[i].mailbox_type = (0U != (rx_mailboxes & (1U << i))) ? CAN_MAILBOX_RECEIVE :
+                                                                                    CAN_MAILBOX_TRANSMIT;
+        g_filter_mailboxes[i].frame_type   = CAN_FRAME_TYPE_DATA;
+    }
+    for (uint32_t i = 0U; i < CAN_FILTER_GROUPS; i++)
+    {
+        g_filter_masks[i] = 0U;
+    }
+
+    ssp_err_t err = can_mailbox_configure(&g_filter_regs, &cfg);
+
+    /** Transmit mailboxes are left alone. */
+    for (uint32_t i = 0U; i < mailbox_count; i++)
+    {
+        if (0U == (rx_mailboxes & (1U << i)))
+        {
+            HOST_TEST_CHECK_EQUAL(0U, g_filter_regs.MCTLn_TX[i]);
+        }
+    }
+
+    return err;
+}
+
+/** Compiles standard ID filters and checks every ID of both frame types. Every listed ID must be accepted. Returns
+ *  the number of IDs accepted, and checks it is the number listed if the filters fit the receive mailboxes. */
+static uint32_t test_can_filter_standard (can_filter_t const * p_filter, uint32_t filter_count, uint32_t mailbox_count,
+                                          uint32_t rx_mailboxes, bool exact)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_can_filter_compile(p_filter, filter_count, CAN_ID_MODE_STANDARD,
+                                                               mailbox_count, rx_mailboxes));
+
+    uint32_t wanted   = 0U;
+    uint32_t accepted = 0U;
+    uint32_t missed   = 0U;
+    for (uint32_t type = CAN_FRAME_TYPE_DATA; type <= CAN_FRAME_TYPE_REMOTE; type++)
+    {
+        for (can_id_t id = 0U; id <= CAN_SID_MASK; id++)
+        {
+            uint32_t mailbox = 0U;
+            bool     want    = test_can_filter_wanted(p_filter, filter_count, id, (can_frame_type_t) type);
+            bool     accept  = test_can_accepts(&g_filter_regs, CAN_ID_MODE_STANDARD, mailbox_count, id,
+                                                (can_frame_type_t) type, &mailbox);
+            wanted   += want ? 1U : 0U;
+            accepted += accept ? 1U : 0U;
+            missed   += (want && !accept) ? 1U : 0U;
+            if (accept)
+            {
+                HOST_TEST_CHECK(0U != (rx_mailboxes & (1U << mailbox)));
+            }
+        }
+    }
+
+    HOST_TEST_CHECK_EQUAL(0U, missed);
+    if (exact)
+    {
+        HOST_TEST_CHECK_EQUAL(wanted, accepted);
+    }
+
+    return accepted;
+}
+
+/** Filters that fit the receive mailboxes accept exactly the listed IDs, and listed IDs are always accepted. */
+static void test_can_filter_standard_ids (void)
+{
+    /** Single IDs and aligned and unaligned ranges, one receive mailbox per entry. */
+    static can_filter_t const ids[] =
+    {
+        { 0x100U, 0x100U, CAN_FRAME_TYPE_DATA }, { 0x101U, 0x101U, CAN_FRAME_TYPE_DATA },
+        { 0x200U, 0x20FU, CAN_FRAME_TYPE_DATA }, { 0x7F0U, 0x7FFU, CAN_FRAME_TYPE_DATA },
+        { 0x123U, 0x123U, CAN_FRAME_TYPE_DATA },
+    };
+    test_can_filter_standard(ids, 5U, 8U, 0xFFU, true);
+
+    /** With fewer receive mailboxes than entries, the entries are merged and more IDs are accepted. */
+    uint32_t merged = test_can_filter_standard(ids, 5U, 4U, 0x0FU, false);
+    HOST_TEST_CHECK(merged > 35U);
+    HOST_TEST_CHECK(merged < 0x800U);
+
+    /** A range that splits into 16 aligned blocks, received by 32 mailboxes, or by 16 mailboxes interleaved with
+     *  transmit mailboxes. */
+    static can_filter_t const range[] = { { 0x0A3U, 0x1F7U, CAN_FRAME_TYPE_DATA } };
+    test_can_filter_standard(range, 1U, 32U, 0xFFFFFFFFU, true);
+    test_can_filter_standard(range, 1U, 32U, 0xAAAAAAAAU, true);
+    merged = test_can_filter_standard(range, 1U, 4U, 0x0FU, false);
+    HOST_TEST_CHECK(merged < 0x800U);
+
+    /** More single IDs than mailboxes. */
+    can_filter_t many[40];
+    for (uint32_t i = 0U; i < 40U; i++)
+    {
+        many[i].id_first   = (i * 37U) + 5U;
+        many[i].id_last    = many[i].id_first;
+        many[i].frame_type = CAN_FRAME_TYPE_DATA;
+    }
+    test_can_filter_standard(many, 30U, 32U, 0xFFFFFFFFU, true);
+    merged = test_can_filter_standard(many, 40U, 32U, 0xFFFFFFFFU, false);
+    HOST_TEST_CHECK(merged < 0x800U);
+}
+
+/** A single receive mailbox receives the smallest aligned block that holds every listed ID. */
+static void test_can_filter_single_mailbox (void)
+{
+    static can_filter_t const ids[] =
+    {
+        { 0x120U, 0x12FU, CAN_FRAME_TYPE_DATA }, { 0x134U, 0x134U, CAN_FRAME_TYPE_DATA },
+        { 0x161U, 0x161U, CAN_FRAME_TYPE_DATA },
+    };
+
+    /** The block compares the ID bits every listed ID agrees on. */
+    uint32_t same = CAN_SID_MASK;
+    for (uint32_t i = 0U; i < 3U; i++)
+    {
+        for (can_id_t id = ids[i].id_first; id <= ids[i].id_last; id++)
+        {
+            same &= ~(id ^ ids[0].id_first);
+        }
+    }
+    uint32_t block = 1U;
+    for (uint32_t bit = 0U; bit < CAN_SID_BITS; bit++)
+    {
+        block <<= (0U == (same & (1U << bit))) ? 1U : 0U;
+    }
+
+    HOST_TEST_CHECK_EQUAL(block, test_can_filter_standard(ids, 3U, 4U, 0x01U, false));
+    HOST_TEST_CHECK_EQUAL(block, test_can_filter_standard(ids, 3U, 8U, 0x80U, false));
+}
+
+/** Data and remote frame filters need receive mailboxes of their own. */
+static void test_can_filter_frame_types (void)
+{
+    static can_filter_t const ids[] =
+    {
+        { 0x010U, 0x010U, CAN_FRAME_TYPE_DATA }, { 0x020U, 0x023U, CAN_FRAME_TYPE_REMOTE },
+    };
+    test_can_filter_standard(ids, 2U, 4U, 0x06U, true);
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_CAN_INIT_FAILED,
+                          test_can_filter_compile(ids, 2U, CAN_ID_MODE_STANDARD, 4U, 0x01U));
+}
+
+/** Extended ID filters accept exactly the listed IDs. Checked around each range and at pseudo random IDs. */
+static void test_can_filter_extended_ids (void)
+{
+    static can_filter_t const ids[] =
+    {
+        { 0x00000000U, 0x00000000U, CAN_FRAME_TYPE_DATA }, { 0x0123456BU, 0x01234690U, CAN_FRAME_TYPE_DATA },
+        { 0x18DAF100U, 0x18DAF1FFU, CAN_FRAME_TYPE_DATA }, { 0x1FFFFFF0U, 0x1FFFFFFFU, CAN_FRAME_TYPE_DATA },
+    };
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_can_filter_compile(ids, 4U, CAN_ID_MODE_EXTENDED, 32U, 0xFFFFFFFFU));
+
+    uint32_t errors = 0U;
+    uint32_t mailbox;
+    for (uint32_t i = 0U; i < 4U; i++)
+    {
+        can_id_t first = (ids[i].id_first > 64U) ? (ids[i].id_first - 64U) : 0U;
+        can_id_t last  = (ids[i].id_last < (CAN_XID_MASK - 64U)) ? (ids[i].id_last + 64U) : CAN_XID_MASK;
+        for (can_id_t id = first; id <= last; id++)
+        {
+            bool want   = test_can_filter_wanted(ids, 4U, id, CAN_FRAME_TYPE_DATA);
+            bool accept = test_can_accepts(&g_filter_regs, CAN_ID_MODE_EXTENDED, 32U, id, CAN_FRAME_TYPE_DATA,
+                                           &mailbox);
+            errors += (want != accept) ? 1U : 0U;
+        }
+    }
+
+    uint32_t seed = 0x12345678U;
+    for (uint32_t i = 0U; i < 100000U; i++)
+    {
+        seed = (seed * 1664525U) + 1013904223U;
+        can_id_t id     = seed & CAN_XID_MASK;
+        bool     want   = test_can_filter_wanted(ids, 4U, id, CAN_FRAME_TYPE_DATA);
+        bool     accept = test_can_accepts(&g_filter_regs, CAN_ID_MODE_EXTENDED, 32U, id, CAN_FRAME_TYPE_DATA,
+                                           &mailbox);
+        errors += (want != accept) ? 1U : 0U;
+    }
+    HOST_TEST_CHECK_EQUAL(0U, errors);
+}
+
+/** CAN module model: mode status follows the mode requested in CTLR, the time stamp counter resets at once, and the
+ *  NEWDATA status and the receive mailbox search reflect the receive mailboxes. */
+static void test_can_hook (bsp_sim_peripheral_t * const p_peripheral, bsp_sim_hook_event_t event)
+{
+    SSP_PARAMETER_NOT_USED(p_peripheral);
+    R_CAN0_Type * p_regs = R_CAN0;
+
+    if (BSP_SIM_HOOK_EVENT_RESET == event)
+    {
+        p_regs->CTLR_b.CANM = CAN_MODE_CONTROL_RESET;
+        p_regs->CTLR_b.SLPM = CAN_SLEEP_SLEEP;
+    }
+    else if (BSP_SIM_HOOK_EVENT_WRITE == event)
+    {
+        p_regs->CTLR_b.TSRC = 0U;
+    }
+    else if (BSP_SIM_HOOK_EVENT_READ == event)
+    {
+        uint16_t status = 0U;
+        if (CAN_MODE_CONTROL_HALT == p_regs->CTLR_b.CANM)
+        {
+            status = CAN_CHECK_MODE_HALT;
+        }
+        else if (CAN_MODE_CONTROL_NORMAL != p_regs->CTLR_b.CANM)
+        {
+            status = CAN_CHECK_MODE_RESET;
+        }
+        status |= (uint16_t) (p_regs->CTLR_b.SLPM << 10);
+
+        uint8_t search = 0x80U;
+        for (uint32_t mailbox = CAN_MAX_NO_MAILBOXES; mailbox > 0U; mailbox--)
+        {
+            if ((CAN_MAILBOX_RX | TEST_CAN_NEWDATA) ==
+                (p_regs->MCTLn_RX[mailbox - 1U] & (CAN_MAILBOX_RX | TEST_CAN_NEWDATA)))
+            {
+                search = (uint8_t) (mailbox - 1U);
+            }
+        }
+        if (0U == (search & 0x80U))
+        {
+            status |= 1U;
+        }
+
+        *(volatile uint16_t *) &p_regs->STR = status;
+        *(volatile uint8_t *) &p_regs->MSSR = (CAN_RECEIVE_SEARCH == p_regs->MSMR) ? search : 0x80U;
+    }
+    else
+    {
+        /* BSP_SIM_HOOK_EVENT_STEP: nothing to do. */
+    }
+}
+
+static bsp_sim_peripheral_t g_can_peripheral =
+{
+    .p_name = "CAN0",
+    .base   = R_CAN0_BASE,
+    .size   = sizeof(R_CAN0_Type),
+    .p_hook = test_can_hook,
+    .trap   = BSP_SIM_TRAP_ACCESS,
+};
+
+/** Puts frames on the bus, one for each of the first count receive mailboxes, then raises the receive interrupt. */
+static void test_can_frames_receive (uint32_t count)
+{
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        uint32_t mailbox = 0U;
+        uint8_t  sequence = (uint8_t) g_can_sent++;
+        HOST_TEST_CHECK(test_can_accepts(R_CAN0, CAN_ID_MODE_STANDARD, TEST_CAN_MAILBOXES, g_can_mailbox_id[i],
+                                         CAN_FRAME_TYPE_DATA, &mailbox));
+        HOST_TEST_CHECK_EQUAL(i, mailbox);
+        HOST_TEST_CHECK_EQUAL(0U, R_CAN0->MCTLn_RX[mailbox] & TEST_CAN_NEWDATA);
+
+        R_CAN0->MBn[mailbox].MBn_DL_b.DLC = 1U;
+        R_CAN0->MBn[mailbox].MBn_D[0]     = sequence;
+        R_CAN0->MBn[mailbox].MBn_TS       = (uint16_t) (0x1000U + sequence);
+        R_CAN0->MCTLn_RX[mailbox]        |= TEST_CAN_NEWDATA;
+    }
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimEventRaise(ELC_EVENT_CAN0_MAILBOX_RX));
+    R_BSP_SimIrqDispatch();
+}
+
+/** Marks the frames put on the bus since the last call as expected in the FIFO. */
+static void test_can_frames_expect (uint32_t first)
+{
+    for (uint32_t sequence = first; sequence < g_can_sent; sequence++)
+    {
+        g_can_sequence[g_can_expected++] = (uint8_t) sequence;
+    }
+}
+
+/** Reads up to max_frames frames and checks they are the next expected ones. Returns the number read. */
+static uint32_t test_can_frames_read (uint32_t max_frames)
+{
+    can_rx_frame_t frames[TEST_CAN_FIFO_SIZE + 1U];
+    uint32_t       count     = 0xFFU;
+    uint32_t       available = g_can_expected - g_can_read;
+    uint32_t       expected  = (available < max_frames) ? available : max_frames;
+
+    ssp_err_t err = g_can_on_can.readBatch(&g_can_ctrl, frames, max_frames, &count);
+    HOST_TEST_CHECK_EQUAL((0U != expected) ? SSP_SUCCESS : SSP_ERR_CAN_DATA_UNAVAILABLE, err);
+    HOST_TEST_CHECK_EQUAL(expected, count);
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        uint8_t  sequence = g_can_sequence[g_can_read++];
+        uint32_t mailbox  = frames[i].mailbox;
+        HOST_TEST_CHECK(mailbox < TEST_CAN_RX_MAILBOXES);
+        HOST_TEST_CHECK_EQUAL(g_can_mailbox_id[mailbox % TEST_CAN_RX_MAILBOXES], frames[i].frame.id);
+        HOST_TEST_CHECK_EQUAL(CAN_FRAME_TYPE_DATA, frames[i].frame.type);
+        HOST_TEST_CHECK_EQUAL(1U, frames[i].frame.data_length_code);
+        HOST_TEST_CHECK_EQUAL(sequence, frames[i].frame.data[0]);
+        HOST_TEST_CHECK_EQUAL(0x1000U + sequence, frames[i].timestamp);
+    }
+
+    return count;
+}
+
+/** Frames are read in reception order while the FIFO indexes wrap, with reads split around the end of the ring. */
+static void test_can_fifo_wrap (void)
+{
+    uint32_t ready  = g_can_fifo_ready;
+    uint32_t splits = 0U;
+
+    for (uint32_t round = 0U; round < 60U; round++)
+    {
+        uint32_t pending = g_can_expected - g_can_read;
+        uint32_t count   = 1U + (round % TEST_CAN_RX_MAILBOXES);
+        if (count > (TEST_CAN_FIFO_SIZE - pending))
+        {
+            count = TEST_CAN_FIFO_SIZE - pending;
+        }
+        if (0U != count)
+        {
+            uint32_t first = g_can_sent;
+            test_can_frames_receive(count);
+            test_can_frames_expect(first);
+            HOST_TEST_CHECK_EQUAL(++ready, g_can_fifo_ready);
+        }
+
+        uint32_t tail = g_can_ctrl.rx_fifo_tail;
+        uint32_t read = test_can_frames_read(1U + ((round * 3U) % 5U));
+        if (((tail % TEST_CAN_FIFO_SIZE) + read) > TEST_CAN_FIFO_SIZE)
+        {
+            splits++;
+        }
+    }
+
+    while (0U != test_can_frames_read(TEST_CAN_FIFO_SIZE))
+    {
+        /* Drain the FIFO. */
+    }
+
+    HOST_TEST_CHECK(g_can_ctrl.rx_fifo_head > (4U * TEST_CAN_FIFO_SIZE));
+    HOST_TEST_CHECK(splits > 0U);
+    HOST_TEST_CHECK_EQUAL(0U, g_can_fifo_overflow);
+    HOST_TEST_CHECK_EQUAL(0U, g_can_ctrl.rx_fifo_overflow_count);
+}
+
+/** Frames received while the FIFO is full are discarded and counted, their mailboxes receive again, and the frames
+ *  already in the FIFO are read unchanged. */
+static void test_can_fifo_overflow (void)
+{
+    uint32_t first = g_can_sent;
+    test_can_frames_receive(TEST_CAN_RX_MAILBOXES);
+    test_can_frames_receive(TEST_CAN_RX_MAILBOXES);
+    test_can_frames_expect(first);
+    uint32_t ready = g_can_fifo_ready;
+
+    /** The FIFO is full. */
+    test_can_frames_receive(3U);
+    HOST_TEST_CHECK_EQUAL(ready, g_can_fifo_ready);
+    HOST_TEST_CHECK_EQUAL(1U, g_can_fifo_overflow);
+    HOST_TEST_CHECK_EQUAL(3U, g_can_ctrl.rx_fifo_overflow_count);
+    for (uint32_t mailbox = 0U; mailbox < TEST_CAN_RX_MAILBOXES; mailbox++)
+    {
+        HOST_TEST_CHECK_EQUAL(0U, R_CAN0->MCTLn_RX[mailbox] & TEST_CAN_NEWDATA);
+    }
+
+    HOST_TEST_CHECK_EQUAL(5U, test_can_frames_read(5U));
+
+    /** Frames received after the overflow follow the ones that were kept. */
+    first = g_can_sent;
+    test_can_frames_receive(2U);
+    test_can_frames_expect(first);
+    HOST_TEST_CHECK_EQUAL(ready + 1U, g_can_fifo_ready);
+    HOST_TEST_CHECK_EQUAL(5U, test_can_frames_read(TEST_CAN_FIFO_SIZE));
+    HOST_TEST_CHECK_EQUAL(0U, test_can_frames_read(TEST_CAN_FIFO_SIZE));
+}
+
+/** A mailbox still being written stops the receive ISR. Its frame and the ones after it are read by the interrupt that
+ *  completes the reception. */
+static void test_can_fifo_receiving (void)
+{
+    uint32_t first = g_can_sent;
+    uint32_t ready = g_can_fifo_ready;
+
+    /** Frames for mailboxes 0 and 1, with the reception into mailbox 0 still in progress. */
+    R_CAN0->MCTLn_RX[0] |= TEST_CAN_INVALDATA;
+    test_can_frames_receive(2U);
+    HOST_TEST_CHECK_EQUAL(ready, g_can_fifo_ready);
+    HOST_TEST_CHECK_EQUAL(0U, test_can_frames_read(TEST_CAN_FIFO_SIZE));
+
+    R_CAN0->MCTLn_RX[0] &= (uint8_t) ~TEST_CAN_INVALDATA;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimEventRaise(ELC_EVENT_CAN0_MAILBOX_RX));
+    R_BSP_SimIrqDispatch();
+    test_can_frames_expect(first);
+    HOST_TEST_CHECK_EQUAL(ready + 1U, g_can_fifo_ready);
+    HOST_TEST_CHECK_EQUAL(2U, test_can_frames_read(TEST_CAN_FIFO_SIZE));
+}
+
+static void test_can_fifo (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimPeripheralRegister(&g_can_peripheral));
+
+    for (uint32_t i = 0U; i < TEST_CAN_MAILBOXES; i++)
+    {
+        g_can_mailboxes[i].mailbox_type = (i < TEST_CAN_RX_MAILBOXES) ? CAN_MAILBOX_RECEIVE : CAN_MAILBOX_TRANSMIT;
+    }
+    for (uint32_t i = 0U; i < (TEST_CAN_MAILBOXES / CAN_MAILBOX_GROUP_SIZE); i++)
+    {
+        g_can_masks[i] = CAN_DEFAULT_MASK;
+    }
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_can_on_can.open(&g_can_ctrl, &g_can_cfg));
+
+    /** Each listed ID has a receive mailbox of its own. Order the IDs by mailbox. */
+    for (uint32_t i = 0U; i < TEST_CAN_RX_MAILBOXES; i++)
+    {
+        uint32_t mailbox = TEST_CAN_MAILBOXES;
+        HOST_TEST_CHECK(test_can_accepts(R_CAN0, CAN_ID_MODE_STANDARD, TEST_CAN_MAILBOXES, g_can_filter[i].id_first,
+                                         CAN_FRAME_TYPE_DATA, &mailbox));
+        HOST_TEST_CHECK(mailbox < TEST_CAN_RX_MAILBOXES);
+        g_can_mailbox_id[mailbox % TEST_CAN_RX_MAILBOXES] = g_can_filter[i].id_first;
+    }
+    for (uint32_t i = 0U; i < TEST_CAN_RX_MAILBOXES; i++)
+    {
+        HOST_TEST_CHECK(0U != g_can_mailbox_id[i]);
+    }
+
+    HOST_TEST_CHECK_EQUAL(0U, test_can_frames_read(TEST_CAN_FIFO_SIZE));
+    test_can_fifo_wrap();
+    test_can_fifo_overflow();
+    test_can_fifo_receiving();
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_can_on_can.close(&g_can_ctrl));
+}
+
+int main (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimInit());
+    __enable_irq();
+
+    test_can_filter_standard_ids();
+    test_can_filter_single_mailbox();
+    test_can_filter_frame_types();
+    test_can_filter_extended_ids();
+    test_can_fifo();
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,274 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : test_crc.c
+ * Description  : Checks that the software tables, the CRC calculator fed from the CPU and the CRC calculator fed by
+ *                the DMAC give the same values as a bitwise reference for every polynomial and bit order, at every
+ *                alignment, that CRC-32 and CRC-32C MSB first keep the 32-bit word feed of CRCDIR, and that the
+ *                software table set is shared and rebuilt only when it is free.
+ **********************************************************************************************************************/
+
+#include <string.h>
+
+#include "bsp_api.h"
+#include "r_crc.h"
+#include "r_dmac.h"
+#include "host_test.h"
+
+#define TEST_CRC_BUFFER_BYTES    (5000U)
+
+/** Widths and polynomials, indexed by crc_polynomial_t. */
+static const struct
+{
+    uint32_t width;
+    uint32_t normal;
+    uint32_t reflected;
+} g_test_polynomials[] =
+{
+    [CRC_POLYNOMIAL_CRC_8]     = { 8U,  0x07U,        0xE0U       },
+    [CRC_POLYNOMIAL_CRC_16]    = { 16U, 0x8005U,      0xA001U     },
+    [CRC_POLYNOMIAL_CRC_CCITT] = { 16U, 0x1021U,      0x8408U     },
+    [CRC_POLYNOMIAL_CRC_32]    = { 32U, 0x04C11DB7U,  0xEDB88320U },
+    [CRC_POLYNOMIAL_CRC_32C]   = { 32U, 0x1EDC6F41U,  0x82F63B78U },
+};
+
+static uint8_t                 g_buffer[TEST_CRC_BUFFER_BYTES];
+static crc_instance_ctrl_t     g_crc_ctrl;
+static transfer_info_t         g_dmac_info;
+static dmac_instance_ctrl_t    g_dmac_ctrl;
+static transfer_on_dmac_cfg_t  g_dmac_ext = { .channel = 1U };
+static transfer_cfg_t          g_dmac_cfg = { .p_info = &g_dmac_info, .irq_ipl = BSP_IRQ_DISABLED,
+                                              .p_extend = &g_dmac_ext };
+static transfer_instance_t     g_dmac     = { .p_ctrl = &g_dmac_ctrl, .p_cfg = &g_dmac_cfg,
+                                              .p_api = &g_transfer_on_dmac };
+
+/** Shift n bits of data into the CRC, from bit 0 (LSB first) or from the top bit (MSB first). */
+static uint32_t test_crc_shift (crc_polynomial_t polynomial, crc_bit_order_t bit_order, uint32_t crc, uint32_t data,
+                                uint32_t bits)
+{
+    uint32_t width = g_test_polynomials[polynomial].width;
+    uint32_t mask  = 0xFFFFFFFFU >> (32U - width);
+
+    if (CRC_BIT_ORDER_LMS_LSB == bit_order)
+    {
+        crc ^= data;
+        for (uint32_t bit = 0U; bit < bits; bit++)
+        {
+            crc = (0U != (crc & 1U)) ? ((crc >> 1) ^ g_test_polynomials[polynomial].reflected) : (crc >> 1);
+        }
+        return crc;
+    }
+
+    crc ^= data << (width - bits);
+    for (uint32_t bit = 0U; bit < bits; bit++)
+    {
+        uint32_t top = (crc >> (width - 1U)) & 1U;
+        crc = ((0U != top) ? ((crc << 1) ^ g_test_polynomials[polynomial].normal) : (crc << 1)) & mask;
+    }
+    return crc;
+}
+
+/** Reference: bytes in memory order, except CRC-32 and CRC-32C MSB first, which write each whole word from the start
+ *  of the buffer to CRCDIR as the driver always has and then the remaining bytes. */
+static uint32_t test_crc_reference (crc_polynomial_t polynomial, crc_bit_order_t bit_order, uint8_t const * p_data,
+                                    uint32_t length, uint32_t crc)
+{
+    uint32_t width = g_test_polynomials[polynomial].width;
+    crc &= 0xFFFFFFFFU >> (32U - width);
+
+    uint32_t i = 0U;
+    if ((32U == width) && (CRC_BIT_ORDER_LMS_MSB == bit_order))
+    {
+        for (; (i + 4U) <= length; i += 4U)
+        {
+            uint32_t word;
+            memcpy(&word, &p_data[i], sizeof(word));
+            crc = test_crc_shift(polynomial, bit_order, crc, word, 32U);
+        }
+    }
+    for (; i < length; i++)
+    {
+        crc = test_crc_shift(polynomial, bit_order, crc, p_data[i], 8U);
+    }
+    return crc;
+}
+
+/** Open an instance with the software engine (0), the CRC calculator (1) or the CRC calculator fed by the DMAC (2). */
+static ssp_err_t test_crc_open (crc_polynomial_t polynomial, crc_bit_order_t bit_order, uint32_t engine)
+{
+    static crc_on_crc_cfg_t ext;
+    static crc_cfg_t        cfg;
+
+    ext.engine              = (0U == engine) ? CRC_ENGINE_SOFTWARE : CRC_ENGINE_HARDWARE;
+    ext.p_transfer          = (2U == engine) ? &g_dmac : NULL;
+    ext.dma_threshold_bytes = 16U;
+    cfg.polynomial          = polynomial;
+    cfg.bit_order           = bit_order;
+    cfg.p_extend            = &ext;
+
+    return g_crc_on_crc.open(&g_crc_ctrl, &cfg);
+}
+
+static void test_crc_engines (void)
+{
+    static const uint32_t lengths[] = {1U, 3U, 4U, 7U, 8U, 9U, 15U, 64U, 127U, 128U, 129U, 1000U, 2048U, 4999U};
+
+    for (uint32_t p = CRC_POLYNOMIAL_CRC_8; p <= CRC_POLYNOMIAL_CRC_32C; p++)
+    {
+        for (uint32_t order = CRC_BIT_ORDER_LMS_LSB; order <= CRC_BIT_ORDER_LMS_MSB; order++)
+        {
+            crc_polynomial_t polynomial = (crc_polynomial_t) p;
+            crc_bit_order_t  bit_order  = (crc_bit_order_t) order;
+            bool             words      = (32U == g_test_polynomials[p].width) && (CRC_BIT_ORDER_LMS_MSB == bit_order);
+
+            for (uint32_t engine = 0U; engine < 3U; engine++)
+            {
+                HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_crc_open(polynomial, bit_order, engine));
+
+                for (uint32_t l = 0U; l < (sizeof(lengths) / sizeof(lengths[0])); l++)
+                {
+                    for (uint32_t offset = 0U; (offset < 4U) && ((lengths[l] + offset) <= sizeof(g_buffer)); offset++)
+                    {
+                        uint8_t * p_data   = &g_buffer[offset];
+                        uint32_t  length   = lengths[l];
+                        uint32_t  seed     = 0xA5C3F00FU + l;
+                        uint32_t  expected = test_crc_reference(polynomial, bit_order, p_data, length, seed);
+                        uint32_t  value    = 0U;
+
+                        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_crc_on_crc.calculate(&g_crc_ctrl, p_data, length, seed,
+                                                                                  &value));
+                        HOST_TEST_CHECK_EQUAL(expected, value);
+                        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_crc_on_crc.crcResultGet(&g_crc_ctrl, &value));
+                        HOST_TEST_CHECK_EQUAL(expected, value);
+
+                        /* Block by block, in growing blocks that are a multiple of four bytes for the word feed.
+                         * With the word feed a last block that ends inside a word goes to calculate. */
+                        uint32_t running = seed;
+                        uint32_t step    = words ? 4U : 1U;
+                        uint32_t pos     = 0U;
+                        while (pos < length)
+                        {
+                            uint32_t block = ((length - pos) < step) ? (length - pos) : step;
+                            if (words && (0U != (block % 4U)))
+                            {
+                                HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_SIZE,
+                                                      g_crc_on_crc.update(&g_crc_ctrl, &p_data[pos], block, &running));
+                                block &= ~3U;
+                                if (0U == block)
+                                {
+                                    break;
+                                }
+                            }
+                            HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_crc_on_crc.update(&g_crc_ctrl, &p_data[pos], block,
+                                                                                   &running));
+                            pos  += block;
+                            step *= 3U;
+                        }
+                        if (pos < length)
+                        {
+                            HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_crc_on_crc.calculate(&g_crc_ctrl, &p_data[pos],
+                                                                                      length - pos, running,
+                                                                                      &running));
+                        }
+                        HOST_TEST_CHECK_EQUAL(expected, running);
+                    }
+                }
+
+                HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_crc_on_crc.close(&g_crc_ctrl));
+            }
+        }
+    }
+}
+
+/** The single table set is shared by instances of the same polynomial and bit order, is not rebuilt while it is in
+ *  use, and is rebuilt for another polynomial once it is free. */
+static void test_crc_table_sets (void)
+{
+    static crc_instance_ctrl_t second;
+    static crc_instance_ctrl_t third;
+    static crc_on_crc_cfg_t    software = { .engine = CRC_ENGINE_SOFTWARE };
+    static crc_on_crc_cfg_t    automatic = { .engine = CRC_ENGINE_AUTO };
+    static crc_cfg_t           crc_32  = { .polynomial = CRC_POLYNOMIAL_CRC_32, .bit_order = CRC_BIT_ORDER_LMS_LSB,
+                                           .p_extend = &software };
+    static crc_cfg_t           crc_16  = { .polynomial = CRC_POLYNOMIAL_CRC_16, .bit_order = CRC_BIT_ORDER_LMS_LSB,
+                                           .p_extend = &software };
+    uint8_t                    check[] = "123456789";
+    uint32_t                   value   = 0U;
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_crc_on_crc.open(&g_crc_ctrl, &crc_32));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_crc_on_crc.open(&second, &crc_32));
+    HOST_TEST_CHECK(NULL != g_crc_ctrl.p_table);
+    HOST_TEST_CHECK(g_crc_ctrl.p_table == second.p_table);
+
+    /* The set is in use: software only fails, automatic falls back to the CRC calculator */
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_OUT_OF_MEMORY, g_crc_on_crc.open(&third, &crc_16));
+    crc_16.p_extend = &automatic;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_crc_on_crc.open(&third, &crc_16));
+    HOST_TEST_CHECK(NULL == third.p_table);
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_crc_on_crc.close(&third));
+
+    /* Closing one user keeps the tables for the other */
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_crc_on_crc.close(&g_crc_ctrl));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_crc_on_crc.calculate(&second, check, 9U, 0xFFFFFFFFU, &value));
+    HOST_TEST_CHECK_EQUAL(0xCBF43926U, value ^ 0xFFFFFFFFU);
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_crc_on_crc.close(&second));
+
+    /* Free again, so it is rebuilt for CRC-16 (CRC-16/ARC check value) */
+    crc_16.p_extend = &software;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_crc_on_crc.open(&third, &crc_16));
+    HOST_TEST_CHECK(NULL != third.p_table);
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_crc_on_crc.calculate(&third, check, 9U, 0U, &value));
+    HOST_TEST_CHECK_EQUAL(0xBB3DU, value);
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_crc_on_crc.close(&third));
+}
+
+static void test_crc_check_values (void)
+{
+    uint8_t  check[] = "123456789";
+    uint32_t value   = 0U;
+
+    /* CRC-32: reflected, seed and final XOR 0xFFFFFFFF */
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_crc_open(CRC_POLYNOMIAL_CRC_32, CRC_BIT_ORDER_LMS_LSB, 0U));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_crc_on_crc.calculate(&g_crc_ctrl, check, 9U, 0xFFFFFFFFU, &value));
+    HOST_TEST_CHECK_EQUAL(0xCBF43926U, value ^ 0xFFFFFFFFU);
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_crc_on_crc.close(&g_crc_ctrl));
+
+    /* CRC-16/XMODEM: CCITT polynomial MSB first, seed 0 */
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_crc_open(CRC_POLYNOMIAL_CRC_CCITT, CRC_BIT_ORDER_LMS_MSB, 1U));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_crc_on_crc.calculate(&g_crc_ctrl, check, 9U, 0U, &value));
+    HOST_TEST_CHECK_EQUAL(0x31C3U, value);
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_crc_on_crc.close(&g_crc_ctrl));
+}
+
+int main (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimInit());
+
+    for (uint32_t i = 0U; i < sizeof(g_buffer); i++)
+    {
+        g_buffer[i] = (uint8_t) ((i * 131U) + 7U);
+    }
+
+    test_crc_engines();
+    test_crc_table_sets();
+    test_crc_check_values();
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,338 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : test_dac_waveform.c
+ * Description  : DAC waveform framework on the DAC, GPT and DTC drivers: one sample per timer overflow from a repeat
+ *                mode descriptor, and a queued table that the chain descriptors swap in at the end of the period, so
+ *                the last sample of the old table is followed by the first sample of the new one. The DTC model runs
+ *                the descriptor chain of the overflow event and writes back the registers as the DTC does.
+ **********************************************************************************************************************/
+
+#include <string.h>
+
+#include "bsp_api.h"
+#include "r_dac.h"
+#include "r_gpt.h"
+#include "r_dtc.h"
+#include "sf_dac_waveform.h"
+#include "host_test.h"
+
+#define TEST_LENGTH_A       (5U)
+#define TEST_LENGTH_B       (3U)
+#define TEST_LENGTH_C       (4U)
+
+SSP_VECTOR_DEFINE_CHAN(gpt_counter_overflow_isr, GPT, COUNTER_OVERFLOW, 0);
+
+static uint16_t const        g_table_a[TEST_LENGTH_A] = { 100U, 101U, 102U, 103U, 104U };
+static uint16_t const        g_table_b[TEST_LENGTH_B] = { 200U, 201U, 202U };
+static uint16_t const        g_table_c[TEST_LENGTH_C] = { 300U, 301U, 302U, 303U };
+static uint16_t              g_table_max[SF_DAC_WAVEFORM_LENGTH_MAX];
+
+static dac_instance_ctrl_t   g_dac_ctrl;
+static dac_cfg_t             g_dac_cfg = { .channel = 0U, .data_format = DAC_DATA_FORMAT_FLUSH_RIGHT };
+static dac_instance_t        g_dac = { .p_ctrl = &g_dac_ctrl, .p_cfg = &g_dac_cfg, .p_api = &g_dac_on_dac };
+
+static gpt_instance_ctrl_t   g_timer_ctrl;
+static timer_on_gpt_cfg_t    g_timer_ext;
+static timer_cfg_t           g_timer_cfg = { .mode = TIMER_MODE_PERIODIC, .period = 10U,
+                                             .unit = TIMER_UNIT_PERIOD_USEC, .channel = 0U,
+                                             .irq_ipl = BSP_IRQ_DISABLED, .p_extend = &g_timer_ext };
+static timer_instance_t      g_timer = { .p_ctrl = &g_timer_ctrl, .p_cfg = &g_timer_cfg, .p_api = &g_timer_on_gpt };
+
+static dtc_instance_ctrl_t   g_dtc_ctrl;
+static transfer_cfg_t        g_dtc_cfg = { .irq_ipl = BSP_IRQ_DISABLED };
+static transfer_instance_t   g_dtc = { .p_ctrl = &g_dtc_ctrl, .p_cfg = &g_dtc_cfg, .p_api = &g_transfer_on_dtc };
+
+static sf_dac_waveform_instance_ctrl_t g_waveform_ctrl;
+static sf_dac_waveform_cfg_t g_waveform_cfg =
+{
+    .p_lower_lvl_dac      = &g_dac,
+    .p_lower_lvl_timer    = &g_timer,
+    .p_lower_lvl_transfer = &g_dtc,
+    .p_samples            = g_table_a,
+    .length               = TEST_LENGTH_A,
+};
+
+/** Runs one transfer of a repeat mode descriptor and writes back its registers. The count reloads and an incremented
+ *  repeat area returns to its start when the count ends. Returns true if the count ended. */
+static bool test_dtc_transfer (transfer_info_t * p_info)
+{
+    dtc_reg_t * p_reg  = (dtc_reg_t *) p_info;
+    uint32_t    unit   = 1UL << p_info->size;
+    uint8_t   * p_src  = (uint8_t *) p_info->p_src;
+    uint8_t   * p_dest = (uint8_t *) p_info->p_dest;
+
+    HOST_TEST_CHECK(TRANSFER_MODE_REPEAT == p_info->mode);
+
+    memcpy(p_dest, p_src, unit);
+    p_src  += (TRANSFER_ADDR_MODE_INCREMENTED == p_info->src_addr_mode) ? unit : 0U;
+    p_dest += (TRANSFER_ADDR_MODE_INCREMENTED == p_info->dest_addr_mode) ? unit : 0U;
+
+    bool ended = false;
+    p_reg->CRA_b.CRAL--;
+    if (0U == p_reg->CRA_b.CRAL)
+    {
+        uint32_t length = (0U == p_reg->CRA_b.CRAH) ? 256U : p_reg->CRA_b.CRAH;
+        p_reg->CRA_b.CRAL = p_reg->CRA_b.CRAH;
+        if ((TRANSFER_REPEAT_AREA_SOURCE == p_info->repeat_area) &&
+            (TRANSFER_ADDR_MODE_INCREMENTED == p_info->src_addr_mode))
+        {
+            p_src -= length * unit;
+        }
+        if ((TRANSFER_REPEAT_AREA_DESTINATION == p_info->repeat_area) &&
+            (TRANSFER_ADDR_MODE_INCREMENTED == p_info->dest_addr_mode))
+        {
+            p_dest -= length * unit;
+        }
+        ended = true;
+    }
+
+    p_info->p_src  = p_src;
+    p_info->p_dest = p_dest;
+
+    return ended;
+}
+
+/** DTC model for the timer overflow: runs the descriptor at the vector and the descriptors chained after it, each
+ *  chain continuing only if the chain is enabled and, for chains at the end of the count, the count ended. Repeat
+ *  mode never interrupts the CPU. */
+static bool test_dtc_model (elc_event_t event, void * p_context)
+{
+    SSP_PARAMETER_NOT_USED(p_context);
+
+    if (ELC_EVENT_GPT0_COUNTER_OVERFLOW != event)
+    {
+        return true;
+    }
+
+    uint32_t irq = 0U;
+    while ((irq < BSP_VECTOR_TABLE_MAX_ENTRIES) && ((R_ICU->IELSRn[irq] & 0x1FFU) != (uint32_t) event))
+    {
+        irq++;
+    }
+    HOST_TEST_CHECK(irq < BSP_VECTOR_TABLE_MAX_ENTRIES);
+    if (irq >= BSP_VECTOR_TABLE_MAX_ENTRIES)
+    {
+        return false;
+    }
+
+    transfer_info_t * p_info = ((transfer_info_t **) (uintptr_t) R_DTC->DTCVBR)[irq];
+    while (NULL != p_info)
+    {
+        dtc_reg_t * p_reg = (dtc_reg_t *) p_info;
+        bool        ended = test_dtc_transfer(p_info);
+
+        if ((0U == p_reg->MRB_b.CHNE) || ((0U != p_reg->MRB_b.CHNS) && (!ended)))
+        {
+            p_info = NULL;
+        }
+        else
+        {
+            p_info++;
+        }
+    }
+
+    return false;
+}
+
+/** One timer period. The overflow activates the transfer only while the timer counts. Returns the DAC data. */
+static uint16_t test_dac_period (void)
+{
+    timer_info_t info;
+    if ((SSP_SUCCESS == g_timer_on_gpt.infoGet(&g_timer_ctrl, &info)) && (TIMER_STATUS_COUNTING == info.status))
+    {
+        R_BSP_SimEventRaise(ELC_EVENT_GPT0_COUNTER_OVERFLOW);
+    }
+
+    return R_DAC->DADRn[0];
+}
+
+/** Runs count periods and checks they output the table from sample first, wrapping at the end of the table. */
+static void test_dac_samples (uint16_t const * p_table, uint32_t length, uint32_t first, uint32_t count)
+{
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        HOST_TEST_CHECK_EQUAL(p_table[(first + i) % length], test_dac_period());
+    }
+}
+
+static void test_dac_status (void const * p_samples, uint32_t length, uint32_t position, bool swap_pending,
+                             bool running)
+{
+    sf_dac_waveform_status_t status;
+    memset(&status, 0xA5, sizeof(status));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_dac_waveform_on_sf_dac_waveform.statusGet(&g_waveform_ctrl, &status));
+    HOST_TEST_CHECK(p_samples == status.p_samples);
+    HOST_TEST_CHECK_EQUAL(length, status.length);
+    HOST_TEST_CHECK_EQUAL(position, status.position);
+    HOST_TEST_CHECK_EQUAL(swap_pending, status.swap_pending);
+    HOST_TEST_CHECK_EQUAL(running, status.running);
+}
+
+static void test_dac_open (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_dac_waveform_on_sf_dac_waveform.open(&g_waveform_ctrl, &g_waveform_cfg));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_dac_waveform_on_sf_dac_waveform.start(&g_waveform_ctrl));
+    test_dac_status(g_table_a, TEST_LENGTH_A, 0U, false, true);
+}
+
+static void test_dac_table_set (void const * p_samples, uint16_t length)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_dac_waveform_on_sf_dac_waveform.tableSet(&g_waveform_ctrl, p_samples,
+                                                                                     length));
+}
+
+/** A table queued at each position of the current table, except during its last sample, starts exactly at the
+ *  sample after the last sample of the current table, and the status follows it. */
+static void test_waveform_swap (void)
+{
+    for (uint32_t position = 0U; position < (TEST_LENGTH_A - 1U); position++)
+    {
+        test_dac_open();
+
+        /** One whole table, then position samples of the next repeat. */
+        test_dac_samples(g_table_a, TEST_LENGTH_A, 0U, TEST_LENGTH_A + position);
+        test_dac_status(g_table_a, TEST_LENGTH_A, position, false, true);
+
+        test_dac_table_set(g_table_b, TEST_LENGTH_B);
+        test_dac_status(g_table_a, TEST_LENGTH_A, position, true, true);
+
+        /** The old table plays to its end, then the new table repeats from its first sample. */
+        for (uint32_t i = position; i < (TEST_LENGTH_A - 1U); i++)
+        {
+            HOST_TEST_CHECK_EQUAL(g_table_a[i], test_dac_period());
+            test_dac_status(g_table_a, TEST_LENGTH_A, i + 1U, true, true);
+        }
+        HOST_TEST_CHECK_EQUAL(g_table_a[TEST_LENGTH_A - 1U], test_dac_period());
+        test_dac_status(g_table_b, TEST_LENGTH_B, 0U, false, true);
+        test_dac_samples(g_table_b, TEST_LENGTH_B, 0U, (2U * TEST_LENGTH_B) + 1U);
+        test_dac_status(g_table_b, TEST_LENGTH_B, 1U, false, true);
+
+        /** Back to the first table, which is longer than the one playing. */
+        test_dac_table_set(g_table_a, TEST_LENGTH_A);
+        test_dac_samples(g_table_b, TEST_LENGTH_B, 1U, TEST_LENGTH_B - 1U);
+        test_dac_samples(g_table_a, TEST_LENGTH_A, 0U, TEST_LENGTH_A + 1U);
+        test_dac_status(g_table_a, TEST_LENGTH_A, 1U, false, true);
+
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_dac_waveform_on_sf_dac_waveform.close(&g_waveform_ctrl));
+    }
+}
+
+/** A table queued before the previous one started replaces it, and queueing the table that is playing cancels the
+ *  swap. */
+static void test_waveform_replace (void)
+{
+    test_dac_open();
+    test_dac_samples(g_table_a, TEST_LENGTH_A, 0U, 1U);
+
+    test_dac_table_set(g_table_b, TEST_LENGTH_B);
+    test_dac_samples(g_table_a, TEST_LENGTH_A, 1U, 1U);
+    test_dac_table_set(g_table_c, TEST_LENGTH_C);
+    test_dac_status(g_table_a, TEST_LENGTH_A, 2U, true, true);
+    test_dac_samples(g_table_a, TEST_LENGTH_A, 2U, TEST_LENGTH_A - 2U);
+    test_dac_samples(g_table_c, TEST_LENGTH_C, 0U, TEST_LENGTH_C + 2U);
+    test_dac_status(g_table_c, TEST_LENGTH_C, 2U, false, true);
+
+    test_dac_table_set(g_table_a, TEST_LENGTH_A);
+    test_dac_table_set(g_table_c, TEST_LENGTH_C);
+    test_dac_status(g_table_c, TEST_LENGTH_C, 2U, false, true);
+    test_dac_samples(g_table_c, TEST_LENGTH_C, 2U, (2U * TEST_LENGTH_C) + 1U);
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_dac_waveform_on_sf_dac_waveform.close(&g_waveform_ctrl));
+}
+
+/** The DAC holds the last sample while stopped, and a table queued then starts from its first sample on start. */
+static void test_waveform_restart (void)
+{
+    test_dac_open();
+    test_dac_samples(g_table_a, TEST_LENGTH_A, 0U, 2U);
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_dac_waveform_on_sf_dac_waveform.stop(&g_waveform_ctrl));
+    test_dac_status(g_table_a, TEST_LENGTH_A, 2U, false, false);
+    for (uint32_t i = 0U; i < TEST_LENGTH_A; i++)
+    {
+        HOST_TEST_CHECK_EQUAL(g_table_a[1], test_dac_period());
+    }
+
+    test_dac_table_set(g_table_b, TEST_LENGTH_B);
+    test_dac_status(g_table_a, TEST_LENGTH_A, 2U, true, false);
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_dac_waveform_on_sf_dac_waveform.start(&g_waveform_ctrl));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_IN_USE, g_sf_dac_waveform_on_sf_dac_waveform.start(&g_waveform_ctrl));
+    test_dac_status(g_table_b, TEST_LENGTH_B, 0U, false, true);
+    test_dac_samples(g_table_b, TEST_LENGTH_B, 0U, TEST_LENGTH_B + 1U);
+
+    /** A restart without a queued table also starts from the first sample. */
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_dac_waveform_on_sf_dac_waveform.stop(&g_waveform_ctrl));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_dac_waveform_on_sf_dac_waveform.start(&g_waveform_ctrl));
+    test_dac_samples(g_table_b, TEST_LENGTH_B, 0U, TEST_LENGTH_B + 2U);
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_dac_waveform_on_sf_dac_waveform.close(&g_waveform_ctrl));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_NOT_OPEN, g_sf_dac_waveform_on_sf_dac_waveform.tableSet(&g_waveform_ctrl,
+                                                                                          g_table_a, TEST_LENGTH_A));
+}
+
+/** The longest table has a transfer count of 0, which the DTC counts as 256, in both directions of a swap. */
+static void test_waveform_length_max (void)
+{
+    for (uint32_t i = 0U; i < SF_DAC_WAVEFORM_LENGTH_MAX; i++)
+    {
+        g_table_max[i] = (uint16_t) (0x800U + i);
+    }
+
+    test_dac_open();
+    test_dac_table_set(g_table_max, SF_DAC_WAVEFORM_LENGTH_MAX);
+    test_dac_samples(g_table_a, TEST_LENGTH_A, 0U, TEST_LENGTH_A);
+    test_dac_status(g_table_max, SF_DAC_WAVEFORM_LENGTH_MAX, 0U, false, true);
+    test_dac_samples(g_table_max, SF_DAC_WAVEFORM_LENGTH_MAX, 0U, SF_DAC_WAVEFORM_LENGTH_MAX + 3U);
+    test_dac_status(g_table_max, SF_DAC_WAVEFORM_LENGTH_MAX, 3U, false, true);
+
+    test_dac_table_set(g_table_b, TEST_LENGTH_B);
+    test_dac_samples(g_table_max, SF_DAC_WAVEFORM_LENGTH_MAX, 3U, SF_DAC_WAVEFORM_LENGTH_MAX - 3U);
+    test_dac_samples(g_table_b, TEST_LENGTH_B, 0U, TEST_LENGTH_B + 1U);
+    test_dac_status(g_table_b, TEST_LENGTH_B, 1U, false, true);
+
+    /** Tables outside 2 to SF_DAC_WAVEFORM_LENGTH_MAX samples or not aligned to the sample size are refused. */
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_SIZE, g_sf_dac_waveform_on_sf_dac_waveform.tableSet(&g_waveform_ctrl,
+                                                                                              g_table_a, 1U));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_SIZE,
+                          g_sf_dac_waveform_on_sf_dac_waveform.tableSet(&g_waveform_ctrl, g_table_max,
+                                                                        SF_DAC_WAVEFORM_LENGTH_MAX + 1U));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_ALIGNMENT,
+                          g_sf_dac_waveform_on_sf_dac_waveform.tableSet(&g_waveform_ctrl,
+                                                                        (uint8_t const *) g_table_a + 1U,
+                                                                        TEST_LENGTH_A - 1U));
+    test_dac_samples(g_table_b, TEST_LENGTH_B, 1U, TEST_LENGTH_B);
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_dac_waveform_on_sf_dac_waveform.close(&g_waveform_ctrl));
+}
+
+int main (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimInit());
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimDtcHookSet(test_dtc_model, NULL));
+    __enable_irq();
+
+    test_waveform_swap();
+    test_waveform_replace();
+    test_waveform_restart();
+    test_waveform_length_max();
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,413 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : test_dtc_batch.c
+ * Description  : DTC batches: the chain and reload settings of batchPrepare, the order the descriptors of a batch run
+ *                in on each activation, chains that end with the transfer count, and switching between prepared
+ *                batches with batchSubmit. The DTC model on the simulator hook keeps the last descriptor it read while
+ *                read skip is enabled, so a submit that does not clear read skip runs the old batch.
+ **********************************************************************************************************************/
+
+#include <string.h>
+
+#include "bsp_api.h"
+#include "r_dtc.h"
+#include "host_test.h"
+
+#define TEST_BATCH_DESCRIPTORS    (3U)
+#define TEST_LOG_MAX              (64U)
+#define TEST_DTCCR_RRS            (1U << 4)
+
+SSP_VECTOR_DEFINE(elc_software_event_isr, ELC, SOFTWARE_EVENT_0);
+
+static uint8_t               g_src[256];
+static uint8_t               g_dest[256];
+static transfer_info_t       g_dtc_info = { .size = TRANSFER_SIZE_1_BYTE, .p_src = g_src, .p_dest = g_dest,
+                                            .length = 1U };
+static dtc_instance_ctrl_t   g_dtc_ctrl;
+static transfer_cfg_t        g_dtc_cfg  = { .p_info = &g_dtc_info, .irq_ipl = BSP_IRQ_DISABLED,
+                                            .activation_source = ELC_EVENT_ELC_SOFTWARE_EVENT_0 };
+static transfer_info_t       g_info_a[TEST_BATCH_DESCRIPTORS];
+static transfer_info_t       g_info_b[TEST_BATCH_DESCRIPTORS];
+static transfer_batch_t      g_batch_a = { .p_info = g_info_a, .count = TEST_BATCH_DESCRIPTORS };
+static transfer_batch_t      g_batch_b = { .p_info = g_info_b, .count = TEST_BATCH_DESCRIPTORS };
+static transfer_info_t     * g_log[TEST_LOG_MAX];
+static uint32_t              g_log_count;
+static transfer_info_t     * gp_skip_info;      ///< Descriptor kept by read skip, NULL if the vector must be read
+static uint32_t              g_cpu_interrupts;
+
+/** DTCCR writes: clearing RRS drops the descriptor kept by read skip. */
+static void test_dtc_registers_hook (bsp_sim_peripheral_t * const p_peripheral, bsp_sim_hook_event_t event)
+{
+    if ((BSP_SIM_HOOK_EVENT_WRITE == event) && (p_peripheral->address == (uintptr_t) &R_DTC->DTCCR) &&
+        (0U == (R_DTC->DTCCR & TEST_DTCCR_RRS)))
+    {
+        gp_skip_info = NULL;
+    }
+}
+
+static bsp_sim_peripheral_t g_dtc_registers =
+{
+    .p_name = "DTC",
+    .base   = R_DTC_BASE,
+    .size   = sizeof(R_DTC_Type),
+    .p_hook = test_dtc_registers_hook,
+    .trap   = BSP_SIM_TRAP_WRITE,
+};
+
+/** Runs one transfer of a descriptor and writes back its registers.  Returns true if its transfer count ended. */
+static bool test_dtc_transfer (transfer_info_t * p_info)
+{
+    dtc_reg_t * p_reg  = (dtc_reg_t *) p_info;
+    uint32_t    unit   = 1UL << p_info->size;
+    uint32_t    count  = (TRANSFER_MODE_BLOCK == p_info->mode) ? p_reg->CRA_b.CRAL : 1U;
+    uint8_t   * p_src  = (uint8_t *) p_info->p_src;
+    uint8_t   * p_dest = (uint8_t *) p_info->p_dest;
+
+    count = (0U == count) ? 256U : count;
+    HOST_TEST_CHECK(g_log_count < TEST_LOG_MAX);
+    g_log[g_log_count++] = p_info;
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        memcpy(p_dest, p_src, unit);
+        p_src  += (TRANSFER_ADDR_MODE_INCREMENTED == p_info->src_addr_mode) ? unit : 0U;
+        p_dest += (TRANSFER_ADDR_MODE_INCREMENTED == p_info->dest_addr_mode) ? unit : 0U;
+    }
+
+    /** The repeat area returns to its start after each block or repeat. */
+    bool     ended  = false;
+    uint32_t length = (0U == p_reg->CRA_b.CRAH) ? 256U : p_reg->CRA_b.CRAH;
+    switch (p_info->mode)
+    {
+        case TRANSFER_MODE_NORMAL:
+        {
+            p_reg->CRA--;
+            ended = (0U == p_reg->CRA);
+            break;
+        }
+
+        case TRANSFER_MODE_REPEAT:
+        {
+            p_reg->CRA_b.CRAL--;
+            if (0U == p_reg->CRA_b.CRAL)
+            {
+                p_reg->CRA_b.CRAL = p_reg->CRA_b.CRAH;
+                if (TRANSFER_REPEAT_AREA_SOURCE == p_info->repeat_area)
+                {
+                    p_src -= length * unit;
+                }
+                else
+                {
+                    p_dest -= length * unit;
+                }
+                ended = true;
+            }
+            break;
+        }
+
+        default:
+        {
+            if (TRANSFER_REPEAT_AREA_SOURCE == p_info->repeat_area)
+            {
+                p_src -= length * unit;
+            }
+            else
+            {
+                p_dest -= length * unit;
+            }
+            p_reg->CRB--;
+            ended = (0U == p_reg->CRB);
+            break;
+        }
+    }
+    p_info->p_src  = p_src;
+    p_info->p_dest = p_dest;
+
+    return ended;
+}
+
+/** DTC model: reads the vector unless read skip kept the last descriptor, then runs the chain.  Chains with CHNS set
+ *  continue only when the transfer count ends.  The CPU is interrupted when the last descriptor of the chain ends,
+ *  except in repeat mode, and DTCE is cleared then. */
+static bool test_dtc_model (elc_event_t event, void * p_context)
+{
+    SSP_PARAMETER_NOT_USED(p_context);
+
+    uint32_t irq = 0U;
+    while ((irq < BSP_VECTOR_TABLE_MAX_ENTRIES) && ((R_ICU->IELSRn[irq] & 0x1FFU) != (uint32_t) event))
+    {
+        irq++;
+    }
+    HOST_TEST_CHECK(irq < BSP_VECTOR_TABLE_MAX_ENTRIES);
+
+    transfer_info_t * p_info = gp_skip_info;
+    if ((NULL == p_info) || (0U == (R_DTC->DTCCR & TEST_DTCCR_RRS)))
+    {
+        transfer_info_t ** pp_vectors = (transfer_info_t **) (uintptr_t) R_DTC->DTCVBR;
+        p_info = pp_vectors[irq];
+    }
+    gp_skip_info = p_info;
+
+    bool interrupt = false;
+    while (NULL != p_info)
+    {
+        dtc_reg_t * p_reg = (dtc_reg_t *) p_info;
+        bool        ended = test_dtc_transfer(p_info);
+        if (0U == p_reg->MRB_b.CHNE)
+        {
+            interrupt = (ended && (TRANSFER_MODE_REPEAT != p_info->mode)) || (0U != p_reg->MRB_b.DISEL);
+            p_info    = NULL;
+        }
+        else if ((0U == p_reg->MRB_b.CHNS) || ended)
+        {
+            p_info++;
+        }
+        else
+        {
+            p_info = NULL;
+        }
+    }
+
+    if (interrupt)
+    {
+        R_ICU->IELSRn[irq] &= ~(1UL << 24);
+        g_cpu_interrupts++;
+    }
+
+    return interrupt;
+}
+
+/** Runs one activation and returns the number of descriptors it ran. */
+static uint32_t test_dtc_activate (void)
+{
+    uint32_t count = g_log_count;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimEventRaise(ELC_EVENT_ELC_SOFTWARE_EVENT_0));
+
+    return g_log_count - count;
+}
+
+/** Fills a batch: 4 single bytes, 2 blocks of 8 bytes, and a 2-byte value repeated from 4 source values. */
+static void test_batch_fill (transfer_info_t * p_info, uint8_t * p_src, uint8_t * p_dest)
+{
+    memset(p_info, 0, sizeof(transfer_info_t) * TEST_BATCH_DESCRIPTORS);
+
+    p_info[0].mode           = TRANSFER_MODE_NORMAL;
+    p_info[0].size           = TRANSFER_SIZE_1_BYTE;
+    p_info[0].src_addr_mode  = TRANSFER_ADDR_MODE_INCREMENTED;
+    p_info[0].dest_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED;
+    p_info[0].p_src          = &p_src[0];
+    p_info[0].p_dest         = &p_dest[0];
+    p_info[0].length         = 4U;
+
+    p_info[1].mode           = TRANSFER_MODE_BLOCK;
+    p_info[1].size           = TRANSFER_SIZE_4_BYTE;
+    p_info[1].src_addr_mode  = TRANSFER_ADDR_MODE_INCREMENTED;
+    p_info[1].dest_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED;
+    p_info[1].repeat_area    = TRANSFER_REPEAT_AREA_DESTINATION;
+    p_info[1].p_src          = &p_src[16];
+    p_info[1].p_dest         = &p_dest[16];
+    p_info[1].length         = 2U;
+    p_info[1].num_blocks     = 4U;
+
+    p_info[2].mode           = TRANSFER_MODE_REPEAT;
+    p_info[2].size           = TRANSFER_SIZE_2_BYTE;
+    p_info[2].src_addr_mode  = TRANSFER_ADDR_MODE_INCREMENTED;
+    p_info[2].dest_addr_mode = TRANSFER_ADDR_MODE_FIXED;
+    p_info[2].repeat_area    = TRANSFER_REPEAT_AREA_SOURCE;
+    p_info[2].p_src          = &p_src[64];
+    p_info[2].p_dest         = &p_dest[64];
+    p_info[2].length         = 4U;
+}
+
+/** Every descriptor except the last chains to the next, and repeat and block descriptors get their reload length. */
+static void test_batch_prepare (void)
+{
+    test_batch_fill(g_info_a, g_src, g_dest);
+    g_info_a[2].chain_mode = TRANSFER_CHAIN_MODE_EACH;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_transfer_on_dtc.batchPrepare(&g_dtc_ctrl, &g_batch_a));
+
+    HOST_TEST_CHECK_EQUAL(TRANSFER_CHAIN_MODE_EACH, g_info_a[0].chain_mode);
+    HOST_TEST_CHECK_EQUAL(TRANSFER_CHAIN_MODE_EACH, g_info_a[1].chain_mode);
+    HOST_TEST_CHECK_EQUAL(TRANSFER_CHAIN_MODE_DISABLED, g_info_a[2].chain_mode);
+    HOST_TEST_CHECK_EQUAL(4U, g_info_a[0].length);
+    HOST_TEST_CHECK_EQUAL(2U, ((dtc_reg_t *) &g_info_a[1])->CRA_b.CRAH);
+    HOST_TEST_CHECK_EQUAL(2U, ((dtc_reg_t *) &g_info_a[1])->CRA_b.CRAL);
+    HOST_TEST_CHECK_EQUAL(4U, ((dtc_reg_t *) &g_info_a[2])->CRA_b.CRAH);
+    HOST_TEST_CHECK_EQUAL(4U, ((dtc_reg_t *) &g_info_a[2])->CRA_b.CRAL);
+
+    /** A chain mode chosen by the application is kept. */
+    test_batch_fill(g_info_b, g_src, g_dest);
+    g_info_b[0].chain_mode = TRANSFER_CHAIN_MODE_END;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_transfer_on_dtc.batchPrepare(&g_dtc_ctrl, &g_batch_b));
+    HOST_TEST_CHECK_EQUAL(TRANSFER_CHAIN_MODE_END, g_info_b[0].chain_mode);
+    HOST_TEST_CHECK_EQUAL(TRANSFER_CHAIN_MODE_EACH, g_info_b[1].chain_mode);
+
+    /** Invalid batches are rejected. */
+    transfer_batch_t empty = { .p_info = g_info_b, .count = 0U };
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_ASSERTION, g_transfer_on_dtc.batchPrepare(&g_dtc_ctrl, &empty));
+    transfer_batch_t none = { .p_info = NULL, .count = 1U };
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_ASSERTION, g_transfer_on_dtc.batchPrepare(&g_dtc_ctrl, &none));
+    transfer_info_t  bad   = g_info_a[1];
+    transfer_batch_t large = { .p_info = &bad, .count = 1U };
+    bad.length = DTC_REPEAT_BLOCK_MAX_LENGTH + 1U;
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_ASSERTION, g_transfer_on_dtc.batchPrepare(&g_dtc_ctrl, &large));
+    bad.length = 2U;
+    bad.p_src  = &g_src[17];
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_ASSERTION, g_transfer_on_dtc.batchPrepare(&g_dtc_ctrl, &large));
+}
+
+/** Each activation runs every descriptor of the batch once, in array order. */
+static void test_batch_order (void)
+{
+    for (uint32_t i = 0U; i < sizeof(g_src); i++)
+    {
+        g_src[i] = (uint8_t) (i + 1U);
+    }
+    memset(g_dest, 0, sizeof(g_dest));
+    test_batch_fill(g_info_a, g_src, g_dest);
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_transfer_on_dtc.batchPrepare(&g_dtc_ctrl, &g_batch_a));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_transfer_on_dtc.batchSubmit(&g_dtc_ctrl, &g_batch_a));
+    HOST_TEST_CHECK(0U != (R_ICU->IELSRn[g_dtc_ctrl.irq] & (1UL << 24)));
+    HOST_TEST_CHECK(0U != (R_DTC->DTCCR & TEST_DTCCR_RRS));
+
+    g_log_count = 0U;
+    for (uint32_t activation = 0U; activation < 4U; activation++)
+    {
+        HOST_TEST_CHECK_EQUAL(TEST_BATCH_DESCRIPTORS, test_dtc_activate());
+        for (uint32_t i = 0U; i < TEST_BATCH_DESCRIPTORS; i++)
+        {
+            HOST_TEST_CHECK(&g_info_a[i] == g_log[(activation * TEST_BATCH_DESCRIPTORS) + i]);
+        }
+
+        /** Descriptor 0 moved one byte, descriptor 1 the next block of 8 bytes to the same place, descriptor 2 the
+         *  next of 4 source values. */
+        HOST_TEST_CHECK_EQUAL(activation + 1U, g_dest[activation]);
+        HOST_TEST_CHECK_EQUAL(0U, g_dest[activation + 1U]);
+        HOST_TEST_CHECK_EQUAL(17U + (8U * activation), g_dest[16]);
+        HOST_TEST_CHECK_EQUAL(24U + (8U * activation), g_dest[23]);
+        HOST_TEST_CHECK_EQUAL(0U, g_dest[24]);
+        HOST_TEST_CHECK_EQUAL(65U + (2U * activation), g_dest[64]);
+        HOST_TEST_CHECK_EQUAL(66U + (2U * activation), g_dest[65]);
+    }
+
+    /** The normal mode descriptor ended the chain's data but the batch ends with a repeat descriptor, which does not
+     *  interrupt the CPU. */
+    HOST_TEST_CHECK_EQUAL(0U, g_info_a[0].length);
+    HOST_TEST_CHECK_EQUAL(0U, g_info_a[1].num_blocks);
+    HOST_TEST_CHECK_EQUAL(0U, g_cpu_interrupts);
+
+    /** The repeat source wrapped back to its start. */
+    HOST_TEST_CHECK(&g_src[64] == g_info_a[2].p_src);
+    HOST_TEST_CHECK_EQUAL(TEST_BATCH_DESCRIPTORS, test_dtc_activate());
+    HOST_TEST_CHECK_EQUAL(65U, g_dest[64]);
+}
+
+/** With TRANSFER_CHAIN_MODE_END the next descriptor only runs on the activation that ends the transfer count. */
+static void test_batch_chain_end (void)
+{
+    memset(g_dest, 0, sizeof(g_dest));
+    test_batch_fill(g_info_b, g_src, g_dest);
+    g_info_b[0].chain_mode = TRANSFER_CHAIN_MODE_END;
+    g_info_b[1].num_blocks = 1U;
+    g_info_b[2].mode       = TRANSFER_MODE_NORMAL;
+    g_info_b[2].length     = 1U;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_transfer_on_dtc.batchPrepare(&g_dtc_ctrl, &g_batch_b));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_transfer_on_dtc.batchSubmit(&g_dtc_ctrl, &g_batch_b));
+
+    g_log_count = 0U;
+    HOST_TEST_CHECK_EQUAL(1U, test_dtc_activate());
+    HOST_TEST_CHECK_EQUAL(1U, test_dtc_activate());
+    HOST_TEST_CHECK_EQUAL(1U, test_dtc_activate());
+    HOST_TEST_CHECK_EQUAL(0U, g_dest[16]);
+    HOST_TEST_CHECK_EQUAL(0U, g_cpu_interrupts);
+
+    /** The fourth byte ends descriptor 0, the chain runs to the end and the last descriptor interrupts the CPU. */
+    HOST_TEST_CHECK_EQUAL(3U, test_dtc_activate());
+    HOST_TEST_CHECK(&g_info_b[1] == g_log[4]);
+    HOST_TEST_CHECK(&g_info_b[2] == g_log[5]);
+    HOST_TEST_CHECK_EQUAL(17U, g_dest[16]);
+    HOST_TEST_CHECK_EQUAL(65U, g_dest[64]);
+    HOST_TEST_CHECK_EQUAL(1U, g_cpu_interrupts);
+    HOST_TEST_CHECK(0U == (R_ICU->IELSRn[g_dtc_ctrl.irq] & (1UL << 24)));
+}
+
+/** Prepared batches from a pool are submitted in turn, each time with new addresses, without preparing them again. */
+static void test_batch_pool (void)
+{
+    transfer_info_t  * infos[2]   = { g_info_a, g_info_b };
+    transfer_batch_t * batches[2] = { &g_batch_a, &g_batch_b };
+    static uint8_t     dest[8][128];
+
+    for (uint32_t b = 0U; b < 2U; b++)
+    {
+        test_batch_fill(infos[b], g_src, dest[0]);
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_transfer_on_dtc.batchPrepare(&g_dtc_ctrl, batches[b]));
+    }
+
+    memset(dest, 0, sizeof(dest));
+    for (uint32_t request = 0U; request < 8U; request++)
+    {
+        /** Only the addresses and counts change from one request to the next. */
+        transfer_info_t * p_info = infos[request % 2U];
+        p_info[0].p_src      = &g_src[request];
+        p_info[0].p_dest     = &dest[request][0];
+        p_info[0].length     = 1U;
+        p_info[1].p_src      = &g_src[16U + (request * 8U)];
+        p_info[1].p_dest     = &dest[request][16];
+        p_info[1].num_blocks = 1U;
+        p_info[2].p_src      = &g_src[64U + (request * 2U)];
+        p_info[2].p_dest     = &dest[request][64];
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_transfer_on_dtc.batchSubmit(&g_dtc_ctrl, batches[request % 2U]));
+
+        g_log_count = 0U;
+        HOST_TEST_CHECK_EQUAL(TEST_BATCH_DESCRIPTORS, test_dtc_activate());
+        HOST_TEST_CHECK(&p_info[0] == g_log[0]);
+        HOST_TEST_CHECK(&p_info[2] == g_log[2]);
+        HOST_TEST_CHECK_EQUAL(request + 1U, dest[request][0]);
+        HOST_TEST_CHECK_EQUAL(17U + (request * 8U), dest[request][16]);
+        HOST_TEST_CHECK_EQUAL(65U + (request * 2U), dest[request][64]);
+        for (uint32_t other = 0U; other < 8U; other++)
+        {
+            HOST_TEST_CHECK_EQUAL((other == request) ? (request + 1U) : 0U, dest[other][0]);
+        }
+        memset(dest[request], 0, sizeof(dest[request]));
+    }
+
+    /** A closed channel rejects batches. */
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_transfer_on_dtc.close(&g_dtc_ctrl));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_NOT_OPEN, g_transfer_on_dtc.batchPrepare(&g_dtc_ctrl, &g_batch_a));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_NOT_OPEN, g_transfer_on_dtc.batchSubmit(&g_dtc_ctrl, &g_batch_a));
+}
+
+int main (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimInit());
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimPeripheralRegister(&g_dtc_registers));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimDtcHookSet(test_dtc_model, NULL));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_transfer_on_dtc.open(&g_dtc_ctrl, &g_dtc_cfg));
+
+    test_batch_prepare();
+    test_batch_order();
+    test_batch_chain_end();
+    test_batch_pool();
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,192 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : test_dtc_copy_2d.c
+ * Description  : Checks R_DTC_Copy2D against a reference row copy for crops, column gathers, contiguous rectangles
+ *                and rows longer than one block, at every alignment. A small DTC model on the simulator hook runs
+ *                the chained block descriptors of one activation.
+ **********************************************************************************************************************/
+
+#include <string.h>
+
+#include "bsp_api.h"
+#include "r_dtc.h"
+#include "host_test.h"
+
+#define TEST_DTC_BUFFER_BYTES    (4096U)
+#define TEST_DTC_DESCRIPTORS     (64U)
+#define TEST_DTC_CASES           (2000U)
+
+SSP_VECTOR_DEFINE(elc_software_event_isr, ELC, SOFTWARE_EVENT_0);
+
+static uint8_t                 g_src[TEST_DTC_BUFFER_BYTES];
+static uint8_t                 g_dest[TEST_DTC_BUFFER_BYTES];
+static uint8_t                 g_expect[TEST_DTC_BUFFER_BYTES];
+static uint32_t                g_random = 0x9E3779B9U;
+static uint32_t                g_activations;
+static transfer_info_t         g_dtc_info = { .size = TRANSFER_SIZE_1_BYTE, .p_src = g_src, .p_dest = g_dest,
+                                              .length = 1U };
+static transfer_info_t         g_dtc_descriptors[TEST_DTC_DESCRIPTORS];
+static dtc_instance_ctrl_t     g_dtc_ctrl;
+static transfer_on_dtc_cfg_t   g_dtc_ext  = { .p_copy_2d_info = g_dtc_descriptors,
+                                              .copy_2d_info_count = TEST_DTC_DESCRIPTORS };
+static transfer_cfg_t          g_dtc_cfg  = { .p_info = &g_dtc_info, .irq_ipl = BSP_IRQ_DISABLED,
+                                              .activation_source = ELC_EVENT_ELC_SOFTWARE_EVENT_0,
+                                              .p_extend = &g_dtc_ext };
+
+/** xorshift32, so every run checks the same cases. */
+static uint32_t test_dtc_random (uint32_t range)
+{
+    g_random ^= g_random << 13;
+    g_random ^= g_random >> 17;
+    g_random ^= g_random << 5;
+
+    return g_random % range;
+}
+
+/** DTC model: runs one transfer of every descriptor in the chain of the activated vector. Only the normal and block
+ *  modes with incrementing addresses that copy2D writes are modelled. */
+static bool test_dtc_model (elc_event_t event, void * p_context)
+{
+    SSP_PARAMETER_NOT_USED(p_context);
+
+    transfer_info_t ** pp_vectors = (transfer_info_t **) (uintptr_t) R_DTC->DTCVBR;
+    transfer_info_t  * p_info     = NULL;
+    for (uint32_t irq = 0U; irq < BSP_VECTOR_TABLE_MAX_ENTRIES; irq++)
+    {
+        if ((R_ICU->IELSRn[irq] & 0x1FFU) == (uint32_t) event)
+        {
+            p_info = pp_vectors[irq];
+            break;
+        }
+    }
+
+    g_activations++;
+    HOST_TEST_CHECK(NULL != p_info);
+    while (NULL != p_info)
+    {
+        dtc_reg_t * p_reg = (dtc_reg_t *) p_info;
+        uint32_t    unit  = 1UL << p_info->size;
+        uint32_t    count = 1U;
+        if (TRANSFER_MODE_BLOCK == p_info->mode)
+        {
+            count = (0U == p_reg->CRA_b.CRAL) ? 256U : p_reg->CRA_b.CRAL;
+            p_info->num_blocks--;
+        }
+        HOST_TEST_CHECK_EQUAL(TRANSFER_ADDR_MODE_INCREMENTED, p_info->src_addr_mode);
+        HOST_TEST_CHECK_EQUAL(TRANSFER_ADDR_MODE_INCREMENTED, p_info->dest_addr_mode);
+        HOST_TEST_CHECK_EQUAL(0U, ((uintptr_t) p_info->p_src | (uintptr_t) p_info->p_dest) % unit);
+        memcpy((void *) p_info->p_dest, p_info->p_src, count * unit);
+
+        p_info = (TRANSFER_CHAIN_MODE_DISABLED == p_info->chain_mode) ? NULL : (p_info + 1);
+    }
+
+    return false;
+}
+
+/** Copy a rectangle with one activation and compare both buffers with a row by row reference. */
+static void test_dtc_copy (uint32_t src_offset, uint32_t src_stride, uint32_t dest_offset, uint32_t dest_stride,
+                           uint32_t width, uint16_t height)
+{
+    for (uint32_t i = 0U; i < TEST_DTC_BUFFER_BYTES; i++)
+    {
+        g_src[i]  = (uint8_t) test_dtc_random(256U);
+        g_dest[i] = (uint8_t) test_dtc_random(256U);
+    }
+    memcpy(g_expect, g_dest, sizeof(g_dest));
+    for (uint32_t row = 0U; row < height; row++)
+    {
+        memcpy(&g_expect[dest_offset + (row * dest_stride)], &g_src[src_offset + (row * src_stride)], width);
+    }
+
+    uint32_t  activations = g_activations;
+    ssp_err_t err         = g_transfer_on_dtc.copy2D(&g_dtc_ctrl, &g_src[src_offset], src_stride,
+                                                     &g_dest[dest_offset], dest_stride, width, height);
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, err);
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimEventRaise(ELC_EVENT_ELC_SOFTWARE_EVENT_0));
+    HOST_TEST_CHECK_EQUAL(activations + 1U, g_activations);
+    if (0 != memcmp(g_dest, g_expect, sizeof(g_dest)))
+    {
+        printf("copy2D %u+%u -> %u+%u, %u x %u differs\n", src_offset, src_stride, dest_offset, dest_stride, width,
+               height);
+        g_host_test_failures++;
+    }
+}
+
+/** Fixed shapes: a crop, a column gather, contiguous rows, rows of several blocks. */
+static void test_dtc_copy_2d_shapes (void)
+{
+    test_dtc_copy(6U * 64U + 4U, 64U, 0U, 20U, 20U, 10U);
+    test_dtc_copy(8U, 64U, 0U, 4U, 4U, 12U);
+    test_dtc_copy(0U, 64U, 0U, 64U, 64U, 48U);
+    test_dtc_copy(0U, 1536U, 0U, 1536U, 1536U, 2U);
+    test_dtc_copy(1U, 1200U, 3U, 1300U, 1100U, 3U);
+}
+
+/** Random rectangles at every alignment that fit in the descriptors. */
+static void test_dtc_copy_2d_random (void)
+{
+    for (uint32_t test_case = 0U; test_case < TEST_DTC_CASES; test_case++)
+    {
+        uint16_t height      = (uint16_t) (1U + test_dtc_random(16U));
+        uint32_t width       = 1U + test_dtc_random(128U);
+        uint32_t src_stride  = width + ((0U == test_dtc_random(4U)) ? 0U : test_dtc_random(64U));
+        uint32_t dest_stride = width + ((0U == test_dtc_random(4U)) ? 0U : test_dtc_random(64U));
+        uint32_t src_offset  = test_dtc_random(8U);
+        uint32_t dest_offset = test_dtc_random(8U);
+
+        test_dtc_copy(src_offset, src_stride, dest_offset, dest_stride, width, height);
+    }
+}
+
+/** Copies needing more descriptors than configured, and instances without descriptors, are rejected. */
+static void test_dtc_copy_2d_errors (void)
+{
+    dtc_instance_ctrl_t ctrl;
+    transfer_cfg_t      cfg = g_dtc_cfg;
+    transfer_info_t     info = g_dtc_info;
+
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_SIZE,
+                          g_transfer_on_dtc.copy2D(&g_dtc_ctrl, g_src, 64U, g_dest, 32U, 1U,
+                                                   (uint16_t) (TEST_DTC_DESCRIPTORS + 1U)));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_SIZE,
+                          g_transfer_on_dtc.copy2D(&g_dtc_ctrl, g_src, 0U, g_dest, 0U,
+                                                   (TEST_DTC_DESCRIPTORS * 1024U) + 4U, 1U));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_transfer_on_dtc.close(&g_dtc_ctrl));
+
+    cfg.p_info   = &info;
+    cfg.p_extend = NULL;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_transfer_on_dtc.open(&ctrl, &cfg));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_UNSUPPORTED, g_transfer_on_dtc.copy2D(&ctrl, g_src, 64U, g_dest, 64U, 64U, 2U));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_transfer_on_dtc.close(&ctrl));
+}
+
+int main (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimInit());
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimDtcHookSet(test_dtc_model, NULL));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_transfer_on_dtc.open(&g_dtc_ctrl, &g_dtc_cfg));
+
+    test_dtc_copy_2d_shapes();
+    test_dtc_copy_2d_random();
+    test_dtc_copy_2d_errors();
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,349 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : test_elc_graph.c
+ * Description  : ELC event graph framework on the GPT, ADC, DTC, DAC and ELC drivers: a timer overflow linked to the
+ *                ADC0 trigger, and a DTC transfer on the scan end that copies the result to the DAC. Checks the ELC
+ *                link register and the state of every node after open, start, stop and close, that the consumers are
+ *                ready before the timer starts, the rollback of a failed start and of a failed open, and the graphs
+ *                refused by open.
+ **********************************************************************************************************************/
+
+#include <string.h>
+
+#include "bsp_api.h"
+#include "r_adc.h"
+#include "r_gpt.h"
+#include "r_dtc.h"
+#include "r_dac.h"
+#include "r_elc.h"
+#include "sf_elc_graph.h"
+#include "host_test.h"
+
+#define TEST_ADC_CHANNEL     (1U)
+#define TEST_IELSR_DTCE      (1UL << 24)
+
+SSP_VECTOR_DEFINE_CHAN(gpt_counter_overflow_isr, GPT, COUNTER_OVERFLOW, 0);
+SSP_VECTOR_DEFINE_CHAN(adc_scan_end_isr, ADC, SCAN_END, 0);
+
+static ssp_err_t test_timer_start (timer_ctrl_t * const p_ctrl);
+
+static uint32_t              g_timer_starts;    ///< Calls to the timer start of the graph
+static ssp_err_t             g_timer_start_err; ///< Error returned by the timer start instead of starting
+
+static timer_api_t           g_timer_api;       ///< GPT driver with the start checked by test_timer_start
+static gpt_instance_ctrl_t   g_timer_ctrl;
+static timer_on_gpt_cfg_t    g_timer_ext;
+static timer_cfg_t           g_timer_cfg = { .mode = TIMER_MODE_PERIODIC, .period = 100U,
+                                             .unit = TIMER_UNIT_PERIOD_USEC, .channel = 0U,
+                                             .irq_ipl = BSP_IRQ_DISABLED, .p_extend = &g_timer_ext };
+static timer_instance_t      g_timer = { .p_ctrl = &g_timer_ctrl, .p_cfg = &g_timer_cfg, .p_api = &g_timer_api };
+
+static adc_instance_ctrl_t   g_adc_ctrl;
+static adc_cfg_t             g_adc_cfg =
+{
+    .unit           = 0U,
+    .mode           = ADC_MODE_SINGLE_SCAN,
+    .resolution     = ADC_RESOLUTION_12_BIT,
+    .alignment      = ADC_ALIGNMENT_RIGHT,
+    .trigger        = ADC_TRIGGER_SYNC_ELC,
+    .scan_end_ipl   = BSP_IRQ_DISABLED,
+    .scan_end_b_ipl = BSP_IRQ_DISABLED,
+    .calib_adc_skip = true,
+};
+static adc_channel_cfg_t     g_adc_channel_cfg = { .scan_mask = (1U << TEST_ADC_CHANNEL) };
+static adc_instance_t        g_adc = { .p_ctrl = &g_adc_ctrl, .p_cfg = &g_adc_cfg,
+                                       .p_channel_cfg = &g_adc_channel_cfg, .p_api = &g_adc_on_adc };
+
+/** One result from the ADC data register to the DAC data register on each scan end. */
+static transfer_info_t       g_dtc_info =
+{
+    .mode           = TRANSFER_MODE_REPEAT,
+    .size           = TRANSFER_SIZE_2_BYTE,
+    .src_addr_mode  = TRANSFER_ADDR_MODE_FIXED,
+    .dest_addr_mode = TRANSFER_ADDR_MODE_FIXED,
+    .repeat_area    = TRANSFER_REPEAT_AREA_SOURCE,
+    .irq            = TRANSFER_IRQ_END,
+    .length         = 1U,
+};
+static dtc_instance_ctrl_t   g_dtc_ctrl;
+static transfer_cfg_t        g_dtc_cfg = { .p_info = &g_dtc_info, .activation_source = ELC_EVENT_ADC0_SCAN_END,
+                                           .irq_ipl = BSP_IRQ_DISABLED };
+static transfer_instance_t   g_dtc = { .p_ctrl = &g_dtc_ctrl, .p_cfg = &g_dtc_cfg, .p_api = &g_transfer_on_dtc };
+
+static dac_instance_ctrl_t   g_dac_ctrl;
+static dac_cfg_t             g_dac_cfg = { .channel = 0U, .data_format = DAC_DATA_FORMAT_FLUSH_RIGHT };
+static dac_instance_t        g_dac = { .p_ctrl = &g_dac_ctrl, .p_cfg = &g_dac_cfg, .p_api = &g_dac_on_dac };
+
+static elc_instance_t        g_elc = { .p_api = &g_elc_on_elc };
+
+static sf_elc_graph_node_t const g_nodes[] =
+{
+    SF_ELC_GRAPH_TIMER(&g_timer),
+    SF_ELC_GRAPH_ADC(&g_adc),
+    SF_ELC_GRAPH_TRANSFER(&g_dtc),
+    SF_ELC_GRAPH_DAC(&g_dac),
+};
+static elc_link_t const      g_links[] =
+{
+    SF_ELC_GRAPH_LINK(ELC_EVENT_GPT0_COUNTER_OVERFLOW, ELC_PERIPHERAL_ADC0),
+};
+static sf_elc_graph_cfg_t const g_graph_cfg =
+{
+    .p_nodes         = g_nodes,
+    .node_count      = SF_ELC_GRAPH_COUNT(g_nodes),
+    .p_links         = g_links,
+    .link_count      = SF_ELC_GRAPH_COUNT(g_links),
+    .p_lower_lvl_elc = &g_elc,
+};
+static sf_elc_graph_instance_ctrl_t g_graph_ctrl;
+
+/** Returns the IELSR of the interrupt that event is assigned to. */
+static uint32_t test_ielsr (elc_event_t event)
+{
+    for (uint32_t irq = 0U; irq < BSP_VECTOR_TABLE_MAX_ENTRIES; irq++)
+    {
+        if ((R_ICU->IELSRn[irq] & 0x1FFU) == (uint32_t) event)
+        {
+            return R_ICU->IELSRn[irq];
+        }
+    }
+    HOST_TEST_CHECK(false);
+
+    return 0U;
+}
+
+/** DTC model for the scan end: one repeat mode transfer of the descriptor at the vector, which never interrupts the
+ *  CPU. */
+static bool test_dtc_model (elc_event_t event, void * p_context)
+{
+    SSP_PARAMETER_NOT_USED(p_context);
+
+    if (ELC_EVENT_ADC0_SCAN_END != event)
+    {
+        return true;
+    }
+
+    HOST_TEST_CHECK(TRANSFER_MODE_REPEAT == g_dtc_info.mode);
+    memcpy(g_dtc_info.p_dest, g_dtc_info.p_src, sizeof(uint16_t));
+
+    return false;
+}
+
+/** The timer is started last, so every consumer is ready and the link is made when it starts. */
+static ssp_err_t test_timer_start (timer_ctrl_t * const p_ctrl)
+{
+    g_timer_starts++;
+    HOST_TEST_CHECK_EQUAL(ELC_EVENT_GPT0_COUNTER_OVERFLOW, R_ELC->ELSRnRC0[ELC_PERIPHERAL_ADC0].ELSRn);
+    HOST_TEST_CHECK_EQUAL(1U, R_ELC->ELCR_b.ELCON);
+    HOST_TEST_CHECK_EQUAL(1U, R_S12ADC0->ADCSR_b.TRGE);
+    HOST_TEST_CHECK(0U != (test_ielsr(ELC_EVENT_ADC0_SCAN_END) & TEST_IELSR_DTCE));
+    HOST_TEST_CHECK_EQUAL(1U, R_DAC->DACR_b.DAOE0);
+
+    if (SSP_SUCCESS != g_timer_start_err)
+    {
+        return g_timer_start_err;
+    }
+
+    return g_timer_on_gpt.start(p_ctrl);
+}
+
+/** Checks the link and every node, started or stopped. The timer must be open. */
+static void test_graph_state (bool running)
+{
+    timer_info_t info;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_timer_on_gpt.infoGet(&g_timer_ctrl, &info));
+    HOST_TEST_CHECK_EQUAL(running, TIMER_STATUS_COUNTING == info.status);
+    HOST_TEST_CHECK_EQUAL(running ? ELC_EVENT_GPT0_COUNTER_OVERFLOW : 0U,
+                          R_ELC->ELSRnRC0[ELC_PERIPHERAL_ADC0].ELSRn);
+    HOST_TEST_CHECK_EQUAL(running, 0U != R_S12ADC0->ADCSR_b.TRGE);
+    HOST_TEST_CHECK_EQUAL(running, 0U != (test_ielsr(ELC_EVENT_ADC0_SCAN_END) & TEST_IELSR_DTCE));
+    HOST_TEST_CHECK_EQUAL(running, 0U != R_DAC->DACR_b.DAOE0);
+}
+
+/** One timer period. The overflow starts a scan only while the timer counts, its event is linked to the ADC0 trigger
+ *  and the ADC trigger is enabled, and the scan end runs the DTC if it is enabled. Returns the DAC data. */
+static uint16_t test_graph_period (uint16_t result)
+{
+    timer_info_t info;
+    if ((SSP_SUCCESS == g_timer_on_gpt.infoGet(&g_timer_ctrl, &info)) && (TIMER_STATUS_COUNTING == info.status) &&
+        (ELC_EVENT_GPT0_COUNTER_OVERFLOW == R_ELC->ELSRnRC0[ELC_PERIPHERAL_ADC0].ELSRn) &&
+        (0U != R_S12ADC0->ADCSR_b.TRGE))
+    {
+        *(uint16_t volatile *) &R_S12ADC0->ADDRn[TEST_ADC_CHANNEL] = result;
+        R_BSP_SimEventRaise(ELC_EVENT_ADC0_SCAN_END);
+    }
+
+    return R_DAC->DADRn[0];
+}
+
+/** Returns true if every driver of the graph is closed, by opening and closing each of them. */
+static bool test_graph_closed (void)
+{
+    bool closed = (SSP_SUCCESS == g_timer_on_gpt.open(&g_timer_ctrl, &g_timer_cfg));
+    closed = closed && (SSP_SUCCESS == g_timer_on_gpt.close(&g_timer_ctrl));
+    closed = closed && (SSP_SUCCESS == g_adc_on_adc.open(&g_adc_ctrl, &g_adc_cfg));
+    closed = closed && (SSP_SUCCESS == g_adc_on_adc.close(&g_adc_ctrl));
+    closed = closed && (SSP_SUCCESS == g_dac_on_dac.open(&g_dac_ctrl, &g_dac_cfg));
+    closed = closed && (SSP_SUCCESS == g_dac_on_dac.close(&g_dac_ctrl));
+
+    return closed;
+}
+
+/** Opens a graph. R_DTC_Open copies the repeat count into the reload count in the upper byte of the length, so the
+ *  length is set again before each open. */
+static ssp_err_t test_graph_open (sf_elc_graph_cfg_t const * const p_cfg)
+{
+    g_dtc_info.length = 1U;
+
+    return g_sf_elc_graph_on_sf_elc_graph.open(&g_graph_ctrl, p_cfg);
+}
+
+/** The link is made and every node runs between start and stop, and a sample flows from the timer to the DAC in
+ *  each period. */
+static void test_graph_run (void)
+{
+    g_timer_starts = 0U;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_graph_open(&g_graph_cfg));
+    test_graph_state(false);
+    HOST_TEST_CHECK_EQUAL(0U, test_graph_period(0x111U));
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_elc_graph_on_sf_elc_graph.start(&g_graph_ctrl));
+    HOST_TEST_CHECK_EQUAL(1U, g_timer_starts);
+    test_graph_state(true);
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_IN_USE, g_sf_elc_graph_on_sf_elc_graph.start(&g_graph_ctrl));
+    HOST_TEST_CHECK_EQUAL(0x123U, test_graph_period(0x123U));
+    HOST_TEST_CHECK_EQUAL(0x456U, test_graph_period(0x456U));
+
+    /** The ELC itself stays enabled after stop. */
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_elc_graph_on_sf_elc_graph.stop(&g_graph_ctrl));
+    test_graph_state(false);
+    HOST_TEST_CHECK_EQUAL(1U, R_ELC->ELCR_b.ELCON);
+    HOST_TEST_CHECK_EQUAL(0x456U, test_graph_period(0x789U));
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_elc_graph_on_sf_elc_graph.start(&g_graph_ctrl));
+    HOST_TEST_CHECK_EQUAL(2U, g_timer_starts);
+    test_graph_state(true);
+    HOST_TEST_CHECK_EQUAL(0x789U, test_graph_period(0x789U));
+
+    /** Close stops a running graph before closing the nodes. */
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_elc_graph_on_sf_elc_graph.close(&g_graph_ctrl));
+    HOST_TEST_CHECK_EQUAL(0U, R_ELC->ELSRnRC0[ELC_PERIPHERAL_ADC0].ELSRn);
+    HOST_TEST_CHECK_EQUAL(0U, R_S12ADC0->ADCSR_b.TRGE);
+    HOST_TEST_CHECK_EQUAL(0U, test_ielsr(ELC_EVENT_ADC0_SCAN_END) & TEST_IELSR_DTCE);
+    HOST_TEST_CHECK(test_graph_closed());
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_NOT_OPEN, g_sf_elc_graph_on_sf_elc_graph.start(&g_graph_ctrl));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_NOT_OPEN, g_sf_elc_graph_on_sf_elc_graph.close(&g_graph_ctrl));
+}
+
+/** A start that fails at the timer stops the nodes it already started and breaks the link. */
+static void test_graph_start_failure (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_graph_open(&g_graph_cfg));
+
+    g_timer_start_err = SSP_ERR_INVALID_ARGUMENT;
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_ARGUMENT, g_sf_elc_graph_on_sf_elc_graph.start(&g_graph_ctrl));
+    g_timer_start_err = SSP_SUCCESS;
+    test_graph_state(false);
+    uint16_t held = R_DAC->DADRn[0];
+    HOST_TEST_CHECK_EQUAL(held, test_graph_period(0x321U));
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_elc_graph_on_sf_elc_graph.start(&g_graph_ctrl));
+    test_graph_state(true);
+    HOST_TEST_CHECK_EQUAL(0x321U, test_graph_period(0x321U));
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_elc_graph_on_sf_elc_graph.stop(&g_graph_ctrl));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_elc_graph_on_sf_elc_graph.close(&g_graph_ctrl));
+    HOST_TEST_CHECK(test_graph_closed());
+}
+
+/** Graphs that would connect the wrong peripherals or start a node early are refused before any node is opened, and
+ *  a node that fails to open closes the nodes opened before it. */
+static void test_graph_check (void)
+{
+    sf_elc_graph_cfg_t cfg;
+
+    /** Two links to the same peripheral input. */
+    elc_link_t const shared_input[] =
+    {
+        SF_ELC_GRAPH_LINK(ELC_EVENT_GPT0_COUNTER_OVERFLOW, ELC_PERIPHERAL_ADC0),
+        SF_ELC_GRAPH_LINK(ELC_EVENT_GPT1_COUNTER_OVERFLOW, ELC_PERIPHERAL_ADC0),
+    };
+    cfg            = g_graph_cfg;
+    cfg.p_links    = shared_input;
+    cfg.link_count = SF_ELC_GRAPH_COUNT(shared_input);
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_IN_USE, test_graph_open(&cfg));
+
+    /** An event number that is reserved on this MCU. */
+    elc_link_t const undefined_event[] = { SF_ELC_GRAPH_LINK((elc_event_t) 20U, ELC_PERIPHERAL_ADC0) };
+    cfg            = g_graph_cfg;
+    cfg.p_links    = undefined_event;
+    cfg.link_count = SF_ELC_GRAPH_COUNT(undefined_event);
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_ARGUMENT, test_graph_open(&cfg));
+
+    /** Two transfers on the same DTC vector. */
+    sf_elc_graph_node_t const shared_vector[] = { SF_ELC_GRAPH_TRANSFER(&g_dtc), SF_ELC_GRAPH_TRANSFER(&g_dtc) };
+    cfg            = g_graph_cfg;
+    cfg.p_nodes    = shared_vector;
+    cfg.node_count = SF_ELC_GRAPH_COUNT(shared_vector);
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_IN_USE, test_graph_open(&cfg));
+
+    /** Nodes that start on open, or an ADC that is not triggered through the ELC. */
+    g_timer_cfg.autostart = true;
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_ARGUMENT, test_graph_open(&g_graph_cfg));
+    g_timer_cfg.autostart = false;
+    g_dtc_cfg.auto_enable = true;
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_ARGUMENT, test_graph_open(&g_graph_cfg));
+    g_dtc_cfg.auto_enable = false;
+    g_adc_cfg.trigger     = ADC_TRIGGER_SOFTWARE;
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_ARGUMENT, test_graph_open(&g_graph_cfg));
+    g_adc_cfg.trigger     = ADC_TRIGGER_SYNC_ELC;
+    HOST_TEST_CHECK(test_graph_closed());
+
+    /** The same timer twice: the second open fails and the ADC and the first timer are closed again. */
+    sf_elc_graph_node_t const reopened[] =
+    {
+        SF_ELC_GRAPH_TIMER(&g_timer), SF_ELC_GRAPH_ADC(&g_adc), SF_ELC_GRAPH_TIMER(&g_timer),
+    };
+    cfg            = g_graph_cfg;
+    cfg.p_nodes    = reopened;
+    cfg.node_count = SF_ELC_GRAPH_COUNT(reopened);
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_IN_USE, test_graph_open(&cfg));
+    HOST_TEST_CHECK(test_graph_closed());
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_NOT_OPEN, g_sf_elc_graph_on_sf_elc_graph.start(&g_graph_ctrl));
+}
+
+int main (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimInit());
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimDtcHookSet(test_dtc_model, NULL));
+    __enable_irq();
+
+    g_timer_api       = g_timer_on_gpt;
+    g_timer_api.start = test_timer_start;
+    g_dtc_info.p_src  = (void const *) &R_S12ADC0->ADDRn[TEST_ADC_CHANNEL];
+    g_dtc_info.p_dest = (void *) &R_DAC->DADRn[0];
+
+    test_graph_run();
+    test_graph_start_failure();
+    test_graph_check();
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,404 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : test_ether_ring.c
+ * Description  : Drives the ETHER driver against the EDMAC model: receive ring wrap at every burst size, receive
+ *                refill when the buffer pool runs out, transmit reclaim with the link running, stalled and looped back,
+ *                and the buffer reference counts through all of them.
+ **********************************************************************************************************************/
+
+#include <string.h>
+
+#include "bsp_api.h"
+#include "r_ether.h"
+#include "host_test.h"
+
+SSP_VECTOR_DEFINE_CHAN(edmac_eint_isr, EDMAC, EINT, 0);
+
+#define TEST_ETHER_RX_DESCRIPTORS    (4U)
+#define TEST_ETHER_TX_DESCRIPTORS    (3U)
+#define TEST_ETHER_BUFFERS           (10U)
+#define TEST_ETHER_SPARE_BUFFERS     (TEST_ETHER_BUFFERS - TEST_ETHER_RX_DESCRIPTORS)
+#define TEST_ETHER_FRAME_MAX         (1514U)
+#define TEST_ETHER_WIRE_MAX          (64U)
+
+static ether_descriptor_t    g_rx_descriptors[TEST_ETHER_RX_DESCRIPTORS] __attribute__((aligned(16)));
+static ether_descriptor_t    g_tx_descriptors[TEST_ETHER_TX_DESCRIPTORS] __attribute__((aligned(16)));
+static uint8_t               g_buffer_memory[ETHER_BUFFER_MEMORY_SIZE(TEST_ETHER_BUFFERS)] __attribute__((aligned(32)));
+static uint8_t               g_mac[6] = {0x00U, 0x11U, 0x22U, 0x33U, 0x44U, 0x55U};
+static uint8_t               g_frame[TEST_ETHER_FRAME_MAX];
+static ether_instance_ctrl_t g_ctrl;
+
+/** Sequence numbers of the frames that reached the wire, in order. */
+static uint32_t g_wire_sequence[TEST_ETHER_WIRE_MAX];
+static uint32_t g_wire_frames;
+static uint32_t g_wire_errors;
+
+/** Callbacks by ether_event_t. */
+static uint32_t g_callbacks[3];
+
+/** Frame length used for a sequence number, from the minimum to the maximum frame size. */
+static uint32_t test_ether_length (uint32_t sequence)
+{
+    return 60U + ((sequence * 337U) % (TEST_ETHER_FRAME_MAX - 59U));
+}
+
+/** Build a frame to the station address carrying a sequence number and a payload derived from it. */
+static uint32_t test_ether_frame (uint32_t sequence, uint8_t * p_frame)
+{
+    uint32_t length = test_ether_length(sequence);
+
+    memcpy(&p_frame[0], g_mac, 6U);
+    memcpy(&p_frame[6], g_mac, 6U);
+    memcpy(&p_frame[12], &sequence, sizeof(sequence));
+    for (uint32_t i = 16U; i < length; i++)
+    {
+        p_frame[i] = (uint8_t) ((i * 7U) + sequence);
+    }
+
+    return length;
+}
+
+/** Check that a frame is the one built for its sequence number and return that number. */
+static uint32_t test_ether_frame_check (uint8_t const * p_frame, uint32_t length)
+{
+    uint32_t sequence = 0U;
+    memcpy(&sequence, &p_frame[12], sizeof(sequence));
+    test_ether_frame(sequence, g_frame);
+
+    if ((length != test_ether_length(sequence)) || (0 != memcmp(p_frame, g_frame, length)))
+    {
+        return UINT32_MAX;
+    }
+
+    return sequence;
+}
+
+static void test_ether_wire (uint32_t channel, uint8_t const * p_frame, uint32_t length, void * p_context)
+{
+    SSP_PARAMETER_NOT_USED(channel);
+    SSP_PARAMETER_NOT_USED(p_context);
+
+    uint32_t sequence = test_ether_frame_check(p_frame, length);
+    if ((UINT32_MAX == sequence) || (g_wire_frames >= TEST_ETHER_WIRE_MAX))
+    {
+        g_wire_errors++;
+        return;
+    }
+
+    g_wire_sequence[g_wire_frames++] = sequence;
+}
+
+static void test_ether_callback (ether_callback_args_t * p_args)
+{
+    g_callbacks[p_args->event]++;
+}
+
+static ssp_err_t test_ether_open (ether_rx_mode_t rx_mode)
+{
+    static ether_cfg_t cfg;
+
+    cfg.channel            = 0U;
+    cfg.p_mac_address      = g_mac;
+    cfg.link_speed         = ETHER_LINK_SPEED_100M;
+    cfg.link_duplex        = ETHER_LINK_DUPLEX_FULL;
+    cfg.p_rx_descriptors   = g_rx_descriptors;
+    cfg.num_rx_descriptors = TEST_ETHER_RX_DESCRIPTORS;
+    cfg.p_tx_descriptors   = g_tx_descriptors;
+    cfg.num_tx_descriptors = TEST_ETHER_TX_DESCRIPTORS;
+    cfg.p_buffer_memory    = g_buffer_memory;
+    cfg.num_buffers        = TEST_ETHER_BUFFERS;
+    cfg.rx_mode            = rx_mode;
+    cfg.irq_ipl            = 3U;
+    cfg.p_callback         = test_ether_callback;
+
+    memset(g_callbacks, 0, sizeof(g_callbacks));
+    g_wire_frames = 0U;
+
+    return g_ether_on_ether.open(&g_ctrl, &cfg);
+}
+
+static ether_stats_t test_ether_stats (void)
+{
+    ether_stats_t stats;
+    memset(&stats, 0, sizeof(stats));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_ether_on_ether.statsGet(&g_ctrl, &stats));
+
+    return stats;
+}
+
+/** Inject a frame from the link. */
+static ssp_err_t test_ether_inject (uint32_t sequence)
+{
+    uint32_t length = test_ether_frame(sequence, g_frame);
+
+    return R_BSP_SimEtherReceive(0U, g_frame, length);
+}
+
+/** Read one frame, check its contents and sequence number and release it. */
+static void test_ether_read_expect (uint32_t sequence)
+{
+    ether_buffer_t * p_buffer = NULL;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_ether_on_ether.read(&g_ctrl, &p_buffer));
+    if (NULL != p_buffer)
+    {
+        HOST_TEST_CHECK_EQUAL(1U, p_buffer->ref_count);
+        HOST_TEST_CHECK_EQUAL(sequence, test_ether_frame_check(p_buffer->p_data, p_buffer->length));
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_ether_on_ether.bufferRelease(&g_ctrl, p_buffer));
+    }
+}
+
+/** Allocate a buffer, fill it with a frame, queue it and drop the caller's reference. */
+static ssp_err_t test_ether_write (uint32_t sequence)
+{
+    ether_buffer_t * p_buffer = NULL;
+    ssp_err_t        err      = g_ether_on_ether.bufferAlloc(&g_ctrl, &p_buffer);
+    if (SSP_SUCCESS != err)
+    {
+        return err;
+    }
+
+    p_buffer->length = (uint16_t) test_ether_frame(sequence, p_buffer->p_data);
+    err = g_ether_on_ether.write(&g_ctrl, p_buffer);
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_ether_on_ether.bufferRelease(&g_ctrl, p_buffer));
+
+    return err;
+}
+
+/** Reclaim completed transmit descriptors through read, which finds the receive ring empty. */
+static void test_ether_reclaim (void)
+{
+    ether_buffer_t * p_buffer = NULL;
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INSUFFICIENT_DATA, g_ether_on_ether.read(&g_ctrl, &p_buffer));
+}
+
+/** Bursts of every size up to the ring size, so the ring wraps at every descriptor. Each burst is drained, which
+ *  refills every descriptor, before the next one arrives. */
+static void test_ether_rx_wrap (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_ether_open(ETHER_RX_MODE_POLLING));
+
+    uint32_t sequence = 0U;
+    for (uint32_t burst = 1U; burst <= TEST_ETHER_RX_DESCRIPTORS; burst++)
+    {
+        for (uint32_t round = 0U; round < (2U * TEST_ETHER_RX_DESCRIPTORS) + 1U; round++)
+        {
+            for (uint32_t i = 0U; i < burst; i++)
+            {
+                HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_ether_inject(sequence + i));
+            }
+            for (uint32_t i = 0U; i < burst; i++)
+            {
+                test_ether_read_expect(sequence + i);
+            }
+            sequence += burst;
+
+            test_ether_reclaim();
+            HOST_TEST_CHECK_EQUAL(sequence % TEST_ETHER_RX_DESCRIPTORS, g_ctrl.rx_head);
+            HOST_TEST_CHECK_EQUAL(TEST_ETHER_RX_DESCRIPTORS, test_ether_stats().buffers_used);
+        }
+    }
+
+    ether_stats_t stats = test_ether_stats();
+    HOST_TEST_CHECK_EQUAL(sequence, stats.rx_frames);
+    HOST_TEST_CHECK_EQUAL(0U, stats.rx_errors);
+    HOST_TEST_CHECK_EQUAL(0U, stats.rx_missed);
+    HOST_TEST_CHECK_EQUAL(0U, stats.rx_no_buffer);
+    HOST_TEST_CHECK_EQUAL(TEST_ETHER_RX_DESCRIPTORS + 1U, stats.buffers_used_max);
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_ether_on_ether.close(&g_ctrl));
+}
+
+/** With every spare buffer held by the application, a frame stays in its descriptor until a buffer is released.
+ *  A full ring stops reception; reading a frame gives its descriptor back and restarts it. */
+static void test_ether_rx_refill (void)
+{
+    ether_buffer_t * held[TEST_ETHER_SPARE_BUFFERS];
+    ether_buffer_t * p_buffer = NULL;
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_ether_open(ETHER_RX_MODE_POLLING));
+
+    for (uint32_t i = 0U; i < TEST_ETHER_SPARE_BUFFERS; i++)
+    {
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_ether_on_ether.bufferAlloc(&g_ctrl, &held[i]));
+    }
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_OUT_OF_MEMORY, g_ether_on_ether.bufferAlloc(&g_ctrl, &p_buffer));
+
+    /* Fill the ring, then one more frame has no descriptor. */
+    for (uint32_t i = 0U; i < TEST_ETHER_RX_DESCRIPTORS; i++)
+    {
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_ether_inject(100U + i));
+    }
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_OVERFLOW, test_ether_inject(999U));
+
+    /* No buffer to refill the descriptor: the frame stays where it is, however often it is read. */
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_OUT_OF_MEMORY, g_ether_on_ether.read(&g_ctrl, &p_buffer));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_OUT_OF_MEMORY, g_ether_on_ether.read(&g_ctrl, &p_buffer));
+    HOST_TEST_CHECK_EQUAL(0U, g_ctrl.rx_head);
+
+    /* Each released buffer refills one descriptor, in ring order. */
+    for (uint32_t i = 0U; i < TEST_ETHER_RX_DESCRIPTORS; i++)
+    {
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_ether_on_ether.bufferRelease(&g_ctrl, held[i]));
+        test_ether_read_expect(100U + i);
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_ether_on_ether.bufferAlloc(&g_ctrl, &held[i]));
+    }
+
+    /* Reception restarted and the next frame lands in the first descriptor again. */
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_ether_inject(200U));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_OUT_OF_MEMORY, g_ether_on_ether.read(&g_ctrl, &p_buffer));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_ether_on_ether.bufferRelease(&g_ctrl, held[0]));
+    test_ether_read_expect(200U);
+
+    for (uint32_t i = 1U; i < TEST_ETHER_SPARE_BUFFERS; i++)
+    {
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_ether_on_ether.bufferRelease(&g_ctrl, held[i]));
+    }
+
+    ether_stats_t stats = test_ether_stats();
+    HOST_TEST_CHECK_EQUAL(TEST_ETHER_RX_DESCRIPTORS + 1U, stats.rx_frames);
+    HOST_TEST_CHECK_EQUAL(3U, stats.rx_no_buffer);
+    HOST_TEST_CHECK_EQUAL(1U, stats.rx_missed);
+    HOST_TEST_CHECK_EQUAL(TEST_ETHER_RX_DESCRIPTORS, stats.buffers_used);
+    HOST_TEST_CHECK_EQUAL(TEST_ETHER_BUFFERS, stats.buffers_used_max);
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_ether_on_ether.close(&g_ctrl));
+}
+
+/** Transmit descriptors are reclaimed by the next write while the link runs, fill up while it is stalled, and go out
+ *  in order across the wrap of the ring once it runs again. A buffer queued twice is freed after its second frame. */
+static void test_ether_tx_reclaim (void)
+{
+    R_ETHERC0_Type * p_etherc = NULL;
+    R_EDMAC0_Type  * p_edmac  = NULL;
+    uint32_t         sequence = 0U;
+
+    R_BSP_SimEtherWireSet(0U, test_ether_wire, NULL);
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_ether_open(ETHER_RX_MODE_POLLING));
+    p_etherc = (R_ETHERC0_Type *) g_ctrl.p_etherc_reg;
+    p_edmac  = (R_EDMAC0_Type *) g_ctrl.p_edmac_reg;
+
+    /* Link running: each frame is sent when it is queued and its descriptor is reclaimed by the next write. */
+    for (; sequence < (3U * TEST_ETHER_TX_DESCRIPTORS) + 1U; sequence++)
+    {
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_ether_write(sequence));
+        HOST_TEST_CHECK_EQUAL(1U, g_ctrl.tx_count);
+        HOST_TEST_CHECK_EQUAL(sequence, test_ether_stats().tx_frames);
+    }
+    test_ether_reclaim();
+    HOST_TEST_CHECK_EQUAL(0U, g_ctrl.tx_count);
+    HOST_TEST_CHECK_EQUAL(sequence, test_ether_stats().tx_frames);
+    HOST_TEST_CHECK_EQUAL(TEST_ETHER_RX_DESCRIPTORS, test_ether_stats().buffers_used);
+
+    /* Link stalled: the ring fills, the buffers stay referenced by their descriptors and the next write is refused. */
+    p_etherc->ECMR_b.TE = 0U;
+    uint32_t stalled = sequence;
+    for (uint32_t i = 0U; i < TEST_ETHER_TX_DESCRIPTORS; i++)
+    {
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_ether_write(sequence++));
+    }
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INSUFFICIENT_SPACE, test_ether_write(sequence));
+    HOST_TEST_CHECK_EQUAL(stalled, g_wire_frames);
+    HOST_TEST_CHECK_EQUAL(1U, test_ether_stats().tx_ring_full);
+    HOST_TEST_CHECK_EQUAL(TEST_ETHER_RX_DESCRIPTORS + TEST_ETHER_TX_DESCRIPTORS, test_ether_stats().buffers_used);
+
+    /* Link running again: the whole ring goes out in order and is reclaimed at once. */
+    p_etherc->ECMR_b.TE = 1U;
+    p_edmac->EDTRR      = 1U;
+    test_ether_reclaim();
+    HOST_TEST_CHECK_EQUAL(0U, g_ctrl.tx_count);
+    HOST_TEST_CHECK_EQUAL(TEST_ETHER_RX_DESCRIPTORS, test_ether_stats().buffers_used);
+
+    /* One buffer queued twice holds a reference per descriptor. */
+    ether_buffer_t * p_buffer = NULL;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_ether_on_ether.bufferAlloc(&g_ctrl, &p_buffer));
+    p_buffer->length = (uint16_t) test_ether_frame(sequence, p_buffer->p_data);
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_ether_on_ether.write(&g_ctrl, p_buffer));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_ether_on_ether.write(&g_ctrl, p_buffer));
+    HOST_TEST_CHECK_EQUAL(2U, p_buffer->ref_count);
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_ether_on_ether.bufferRelease(&g_ctrl, p_buffer));
+    test_ether_reclaim();
+    HOST_TEST_CHECK_EQUAL(TEST_ETHER_RX_DESCRIPTORS, test_ether_stats().buffers_used);
+
+    /* Every frame reached the wire once and in order, the last one twice. */
+    HOST_TEST_CHECK_EQUAL(0U, g_wire_errors);
+    HOST_TEST_CHECK_EQUAL(sequence + 2U, g_wire_frames);
+    for (uint32_t i = 0U; i < sequence; i++)
+    {
+        HOST_TEST_CHECK_EQUAL(i, g_wire_sequence[i]);
+    }
+    HOST_TEST_CHECK_EQUAL(sequence, g_wire_sequence[sequence]);
+    HOST_TEST_CHECK_EQUAL(sequence, g_wire_sequence[sequence + 1U]);
+    HOST_TEST_CHECK_EQUAL(sequence + 2U, test_ether_stats().tx_frames);
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_ether_on_ether.close(&g_ctrl));
+    R_BSP_SimEtherWireSet(0U, NULL, NULL);
+}
+
+/** Interrupt mode with the MAC in loopback: each frame written comes back through the receive ring. The interrupt
+ *  reclaims the transmit descriptor and a burst is reported with one receive callback. */
+static void test_ether_loopback (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_ether_open(ETHER_RX_MODE_INTERRUPT));
+    ((R_ETHERC0_Type *) g_ctrl.p_etherc_reg)->ECMR_b.ILB = 1U;
+
+    uint32_t sequence = 0U;
+    for (uint32_t round = 0U; round < (2U * TEST_ETHER_RX_DESCRIPTORS) + 1U; round++)
+    {
+        uint32_t burst = (round % TEST_ETHER_TX_DESCRIPTORS) + 1U;
+        for (uint32_t i = 0U; i < burst; i++)
+        {
+            HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_ether_write(sequence + i));
+            R_BSP_SimIrqDispatch();
+            HOST_TEST_CHECK_EQUAL(0U, g_ctrl.tx_count);
+        }
+
+        HOST_TEST_CHECK_EQUAL(round + 1U, g_callbacks[ETHER_EVENT_RX_COMPLETE]);
+        for (uint32_t i = 0U; i < burst; i++)
+        {
+            test_ether_read_expect(sequence + i);
+        }
+        test_ether_reclaim();
+        sequence += burst;
+    }
+
+    ether_stats_t stats = test_ether_stats();
+    HOST_TEST_CHECK_EQUAL(sequence, g_callbacks[ETHER_EVENT_TX_COMPLETE]);
+    HOST_TEST_CHECK_EQUAL(0U, g_callbacks[ETHER_EVENT_ERROR]);
+    HOST_TEST_CHECK_EQUAL(sequence, stats.tx_frames);
+    HOST_TEST_CHECK_EQUAL(sequence, stats.rx_frames);
+    HOST_TEST_CHECK_EQUAL((2U * TEST_ETHER_RX_DESCRIPTORS) + 1U, stats.rx_interrupts);
+    HOST_TEST_CHECK_EQUAL(TEST_ETHER_RX_DESCRIPTORS, stats.buffers_used);
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_ether_on_ether.close(&g_ctrl));
+}
+
+int main (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimInit());
+    __enable_irq();
+
+    test_ether_rx_wrap();
+    test_ether_rx_refill();
+    test_ether_tx_reclaim();
+    test_ether_loopback();
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,350 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : test_glcd_flip.c
+ * Description  : GLCD page flip queue on the simulated GLCDC: presented frame buffers are scanned out in the order
+ *                they were presented, frame buffers that are queued, latched or scanned out are rejected, and a frame
+ *                buffer is only released to the renderer after the vsync that stopped its scan out.
+ **********************************************************************************************************************/
+
+#include <string.h>
+
+#include "bsp_api.h"
+#include "r_glcd.h"
+#include "host_test.h"
+
+#define TEST_WIDTH              (32U)
+#define TEST_HEIGHT             (16U)
+#define TEST_STRIDE             (TEST_WIDTH * 2U)
+#define TEST_BUFFERS            (GLCD_FLIP_BUFFERS_MAX)
+#define TEST_RELEASED_MAX       (16U)
+
+SSP_VECTOR_DEFINE(glcdc_line_detect_isr, GLCDC, LINE_DETECT);
+
+/** Frame buffer 0 is scanned out after open, the others are registered for flipping. */
+static uint8_t               g_fb[TEST_BUFFERS + 1U][TEST_STRIDE * TEST_HEIGHT] __attribute__((aligned(64)));
+static void                * g_flip_buffers[TEST_BUFFERS] = { g_fb[1], g_fb[2], g_fb[3] };
+
+static uint32_t              g_scanned;                      ///< Base address the simulated GLCDC scans out
+static void                * g_released[TEST_RELEASED_MAX];
+static uint32_t              g_released_count;
+static uint32_t              g_released_while_scanned;
+static uint32_t              g_line_detects;
+
+static void test_glcd_callback (display_callback_args_t * p_args);
+
+static glcd_instance_ctrl_t  g_glcd_ctrl;
+static glcd_cfg_t const      g_glcd_ext =
+{
+    .tcon_hsync      = GLCD_TCON_PIN_1,
+    .tcon_vsync      = GLCD_TCON_PIN_0,
+    .tcon_de         = GLCD_TCON_PIN_2,
+    .clksrc          = GLCD_CLK_SRC_INTERNAL,
+    .clock_div_ratio = GLCD_PANEL_CLK_DIVISOR_8,
+};
+static display_cfg_t         g_glcd_cfg =
+{
+    .input[DISPLAY_FRAME_LAYER_1] =
+    {
+        .p_base  = (uint32_t *) g_fb[0],
+        .hsize   = TEST_WIDTH,
+        .vsize   = TEST_HEIGHT,
+        .hstride = TEST_STRIDE,
+        .format  = DISPLAY_IN_FORMAT_16BITS_RGB565,
+    },
+    .output =
+    {
+        .htiming = { .total_cyc = 48U, .display_cyc = TEST_WIDTH, .back_porch = 6U, .sync_width = 4U,
+                     .sync_polarity = DISPLAY_SIGNAL_POLARITY_LOACTIVE },
+        .vtiming = { .total_cyc = 24U, .display_cyc = TEST_HEIGHT, .back_porch = 3U, .sync_width = 1U,
+                     .sync_polarity = DISPLAY_SIGNAL_POLARITY_LOACTIVE },
+        .format               = DISPLAY_OUT_FORMAT_16BITS_RGB565,
+        .endian               = DISPLAY_ENDIAN_LITTLE,
+        .color_order          = DISPLAY_COLOR_ORDER_RGB,
+        .data_enable_polarity = DISPLAY_SIGNAL_POLARITY_HIACTIVE,
+        .sync_edge            = DISPLAY_SIGNAL_SYNC_EDGE_RISING,
+    },
+    .line_detect_ipl = 3U,
+    .underflow_1_ipl = BSP_IRQ_DISABLED,
+    .underflow_2_ipl = BSP_IRQ_DISABLED,
+    .p_callback      = test_glcd_callback,
+    .p_extend        = &g_glcd_ext,
+};
+
+static void test_glcd_callback (display_callback_args_t * p_args)
+{
+    if (DISPLAY_EVENT_LINE_DETECTION == p_args->event)
+    {
+        g_line_detects++;
+        return;
+    }
+
+    HOST_TEST_CHECK_EQUAL(DISPLAY_EVENT_BUFFER_RELEASED, p_args->event);
+    HOST_TEST_CHECK_EQUAL(DISPLAY_FRAME_LAYER_1, p_args->frame);
+    HOST_TEST_CHECK(g_released_count < TEST_RELEASED_MAX);
+    g_released[g_released_count++] = p_args->p_buffer;
+
+    /** The hardware must not be scanning the released frame buffer out. */
+    if ((uint32_t) p_args->p_buffer == g_scanned)
+    {
+        g_released_while_scanned++;
+    }
+}
+
+/** The vsync: the GLCDC reflects the requested register updates and scans out from the new base address. */
+static void test_glcd_vsync (void)
+{
+    R_GLCDC_Type * p_reg = g_glcd_ctrl.p_reg;
+
+    if (1U == p_reg->LAYER[DISPLAY_FRAME_LAYER_1].CONTROL_b.UPDATE)
+    {
+        g_scanned = p_reg->LAYER[DISPLAY_FRAME_LAYER_1].FRAME2_b.BASE;
+        p_reg->LAYER[DISPLAY_FRAME_LAYER_1].CONTROL_b.UPDATE = 0U;
+    }
+    p_reg->LAYER[DISPLAY_FRAME_LAYER_2].CONTROL_b.UPDATE = 0U;
+    p_reg->OUTPUT.CONTROL_b.UPDATE                       = 0U;
+    p_reg->BACKGROUND.CONTROL_b.UPDATE                   = 0U;
+}
+
+/** The line detect interrupt at the end of the active area. */
+static void test_glcd_line_detect (void)
+{
+    uint32_t line_detects = g_line_detects;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimEventRaise(ELC_EVENT_GLCDC_LINE_DETECT));
+    R_BSP_SimIrqDispatch();
+    HOST_TEST_CHECK_EQUAL(line_detects + 1U, g_line_detects);
+}
+
+/** One frame: the line detect interrupt, then the vsync. */
+static void test_glcd_frame (void)
+{
+    test_glcd_line_detect();
+    test_glcd_vsync();
+}
+
+static display_flip_stats_t test_glcd_stats (void)
+{
+    display_flip_stats_t stats;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_display_on_glcd.flipStatsGet(&g_glcd_ctrl, DISPLAY_FRAME_LAYER_1, &stats));
+
+    return stats;
+}
+
+static ssp_err_t test_glcd_present (uint32_t fb)
+{
+    return g_display_on_glcd.present(&g_glcd_ctrl, DISPLAY_FRAME_LAYER_1, g_fb[fb]);
+}
+
+/** Buffers presented together are scanned out one per frame in presentation order, and each is released one frame
+ *  after the next one is scanned out. Frame buffers that are in use cannot be presented again. */
+static void test_glcd_order (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_glcd_present(2U));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_glcd_present(1U));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_glcd_present(3U));
+    HOST_TEST_CHECK_EQUAL(3U, test_glcd_stats().queued);
+
+    /** Queued and scanned out frame buffers are rejected, and so are frame buffers that are not registered. */
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_IN_USE, test_glcd_present(1U));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_ARGUMENT, test_glcd_present(0U));
+
+    /** Nothing is scanned out from the queue before the first vsync. */
+    HOST_TEST_CHECK_EQUAL((uint32_t) g_fb[0], g_scanned);
+    test_glcd_line_detect();
+    HOST_TEST_CHECK_EQUAL((uint32_t) g_fb[0], g_scanned);
+    HOST_TEST_CHECK_EQUAL(2U, test_glcd_stats().queued);
+
+    /** Latched but not yet scanned out. */
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_IN_USE, test_glcd_present(2U));
+
+    static uint32_t const scanned[]  = { 2U, 1U, 3U, 3U };
+    static uint32_t const released[] = { 0U, 2U, 1U };
+    for (uint32_t frame = 0U; frame < 4U; frame++)
+    {
+        test_glcd_vsync();
+        HOST_TEST_CHECK_EQUAL((uint32_t) g_fb[scanned[frame]], g_scanned);
+        test_glcd_line_detect();
+
+        HOST_TEST_CHECK_EQUAL((frame < 3U) ? (frame + 1U) : 3U, g_released_count);
+        if (frame < 3U)
+        {
+            HOST_TEST_CHECK(g_fb[released[frame]] == g_released[frame]);
+        }
+    }
+    test_glcd_vsync();
+
+    /** The scanned out frame buffer stays in use, the released ones can be presented again. */
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_IN_USE, test_glcd_present(3U));
+    HOST_TEST_CHECK_EQUAL(0U, g_released_while_scanned);
+
+    display_flip_stats_t stats = test_glcd_stats();
+    HOST_TEST_CHECK_EQUAL(5U, stats.vsyncs);
+    HOST_TEST_CHECK_EQUAL(3U, stats.flips);
+    HOST_TEST_CHECK_EQUAL(0U, stats.missed_vsyncs);
+    HOST_TEST_CHECK_EQUAL(0U, stats.queued);
+}
+
+/** While the hardware has not reflected the latched frame buffer, the previous one stays scanned out and is not
+ *  released, and nothing else is latched. The repeated frame is counted as a missed vsync by the next flip. */
+static void test_glcd_late_update (void)
+{
+    g_released_count = 0U;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_glcd_present(1U));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_glcd_present(2U));
+    test_glcd_frame();
+    HOST_TEST_CHECK_EQUAL((uint32_t) g_fb[1], g_scanned);
+    display_flip_stats_t before = test_glcd_stats();
+
+    /** Frame buffer 3 is released and presented again right away. */
+    test_glcd_line_detect();
+    HOST_TEST_CHECK_EQUAL(1U, g_released_count);
+    HOST_TEST_CHECK(g_fb[3] == g_released[0]);
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_glcd_present(3U));
+
+    /** The update requested for frame buffer 2 is not reflected at the next vsync. */
+    test_glcd_line_detect();
+    HOST_TEST_CHECK_EQUAL(1U, g_released_count);
+    HOST_TEST_CHECK_EQUAL(1U, test_glcd_stats().queued);
+    HOST_TEST_CHECK_EQUAL((uint32_t) g_fb[2], g_glcd_ctrl.p_reg->LAYER[DISPLAY_FRAME_LAYER_1].FRAME2_b.BASE);
+
+    test_glcd_vsync();
+    HOST_TEST_CHECK_EQUAL((uint32_t) g_fb[2], g_scanned);
+    test_glcd_line_detect();
+    HOST_TEST_CHECK_EQUAL(2U, g_released_count);
+    HOST_TEST_CHECK(g_fb[1] == g_released[1]);
+    test_glcd_vsync();
+    HOST_TEST_CHECK_EQUAL((uint32_t) g_fb[3], g_scanned);
+    HOST_TEST_CHECK_EQUAL(0U, g_released_while_scanned);
+
+    display_flip_stats_t stats = test_glcd_stats();
+    HOST_TEST_CHECK_EQUAL(before.flips + 2U, stats.flips);
+    HOST_TEST_CHECK_EQUAL(before.vsyncs + 3U, stats.vsyncs);
+    HOST_TEST_CHECK_EQUAL(before.missed_vsyncs + 1U, stats.missed_vsyncs);
+    HOST_TEST_CHECK_EQUAL(0U, stats.queued);
+}
+
+/** A renderer that presents every frame buffer it gets back. Over many frames each presented frame buffer is
+ *  scanned out exactly once, in presentation order, and released only after it stopped being scanned out. */
+static void test_glcd_renderer (void)
+{
+    uint32_t presented[64];
+    uint32_t presented_count = 0U;
+    uint32_t shown_count     = 0U;
+    uint32_t last_scanned    = g_scanned;
+
+    /** Frame buffer 3 is scanned out, frame buffer 2 is released at the next vsync and frame buffer 1 belongs to the
+     *  renderer. */
+    g_released_count = 0U;
+    uint32_t free_fbs[TEST_BUFFERS] = { 1U };
+    uint32_t free_count             = 1U;
+
+    for (uint32_t frame = 0U; frame < 40U; frame++)
+    {
+        /** The renderer presents at most one frame buffer per frame, and skips every fifth frame. */
+        if ((0U != free_count) && (0U != (frame % 5U)) && (presented_count < 64U))
+        {
+            uint32_t fb = free_fbs[0];
+            memmove(&free_fbs[0], &free_fbs[1], (free_count - 1U) * sizeof(free_fbs[0]));
+            free_count--;
+            HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_glcd_present(fb));
+            presented[presented_count++] = fb;
+        }
+
+        g_released_count = 0U;
+        test_glcd_frame();
+        for (uint32_t i = 0U; i < g_released_count; i++)
+        {
+            HOST_TEST_CHECK(free_count < TEST_BUFFERS);
+            free_fbs[free_count++] = (uint32_t) (((uint8_t *) g_released[i] - g_fb[0]) / sizeof(g_fb[0]));
+        }
+
+        if (g_scanned != last_scanned)
+        {
+            HOST_TEST_CHECK(shown_count < presented_count);
+            HOST_TEST_CHECK_EQUAL((uint32_t) g_fb[presented[shown_count]], g_scanned);
+            shown_count++;
+            last_scanned = g_scanned;
+        }
+    }
+
+    HOST_TEST_CHECK(presented_count > 20U);
+    HOST_TEST_CHECK(shown_count + 1U >= presented_count);
+    HOST_TEST_CHECK_EQUAL(0U, g_released_while_scanned);
+}
+
+/** Frame buffers cannot be registered again and the layer cannot be changed while a flip is pending. */
+static void test_glcd_busy (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_display_on_glcd.flipStatsGet(&g_glcd_ctrl, DISPLAY_FRAME_LAYER_1,
+                                                                       &(display_flip_stats_t) {0}));
+    test_glcd_frame();
+    test_glcd_frame();
+    uint32_t fb = ((uint32_t) g_fb[1] == g_scanned) ? 2U : 1U;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_glcd_present(fb));
+
+    display_runtime_cfg_t runtime = { .input = g_glcd_cfg.input[DISPLAY_FRAME_LAYER_1] };
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_IN_USE,
+                          g_display_on_glcd.buffersSet(&g_glcd_ctrl, DISPLAY_FRAME_LAYER_1, g_flip_buffers, 2U));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_IN_USE, g_display_on_glcd.layerChange(&g_glcd_ctrl, &runtime,
+                                                                       DISPLAY_FRAME_LAYER_1));
+    test_glcd_line_detect();
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_IN_USE,
+                          g_display_on_glcd.buffersSet(&g_glcd_ctrl, DISPLAY_FRAME_LAYER_1, g_flip_buffers, 2U));
+    test_glcd_vsync();
+    HOST_TEST_CHECK_EQUAL((uint32_t) g_fb[fb], g_scanned);
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_IN_USE,
+                          g_display_on_glcd.buffersSet(&g_glcd_ctrl, DISPLAY_FRAME_LAYER_1, g_flip_buffers, 2U));
+    test_glcd_line_detect();
+
+    /** Once the flip completed the frame buffers can be registered again, which resets the statistics. */
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS,
+                          g_display_on_glcd.buffersSet(&g_glcd_ctrl, DISPLAY_FRAME_LAYER_1, g_flip_buffers, 2U));
+    HOST_TEST_CHECK_EQUAL(0U, test_glcd_stats().flips);
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_ARGUMENT, test_glcd_present(3U));
+}
+
+int main (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimInit());
+    __enable_irq();
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_display_on_glcd.open(&g_glcd_ctrl, &g_glcd_cfg));
+    g_scanned = (uint32_t) g_fb[0];
+
+    /** Frame buffers must be 64-byte aligned, and at most GLCD_FLIP_BUFFERS_MAX can be registered. */
+    void * misaligned = g_fb[1] + 32;
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_ALIGNMENT,
+                          g_display_on_glcd.buffersSet(&g_glcd_ctrl, DISPLAY_FRAME_LAYER_1, &misaligned, 1U));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_ARGUMENT, g_display_on_glcd.buffersSet(&g_glcd_ctrl, DISPLAY_FRAME_LAYER_1,
+                                                                                g_flip_buffers, TEST_BUFFERS + 1U));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_display_on_glcd.buffersSet(&g_glcd_ctrl, DISPLAY_FRAME_LAYER_1,
+                                                                    g_flip_buffers, TEST_BUFFERS));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_display_on_glcd.start(&g_glcd_ctrl));
+
+    test_glcd_order();
+    test_glcd_late_update();
+    test_glcd_renderer();
+    test_glcd_busy();
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_display_on_glcd.stop(&g_glcd_ctrl));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_display_on_glcd.close(&g_glcd_ctrl));
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,363 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : test_ioport_fast.c
+ * Description  : GPIO fast path and pin table configuration on a model of the port, PFS and PWPR registers: each fast
+ *                accessor is one store to PCNTR3 that moves only its own pins, reads and writes agree with the driver
+ *                API on every pin of every port, the accessors compile as C++, and R_IOPORT_PinsCfg() writes a whole
+ *                table inside one PFS write access window without glitching PSEL.
+ **********************************************************************************************************************/
+
+#include <string.h>
+
+#include "bsp_api.h"
+#include "r_ioport.h"
+#include "host_test.h"
+
+#define TEST_PORTS              (12U)
+#define TEST_PORT_STRIDE        (0x20U)
+#define TEST_PCNTR1             (0x00U)
+#define TEST_PCNTR2             (0x04U)
+#define TEST_PCNTR3             (0x08U)
+#define TEST_PFS_PINS           (TEST_PORTS * 16U)
+#define TEST_PFS_PODR           (1UL << 0)
+#define TEST_PFS_PIDR           (1UL << 1)
+#define TEST_PFS_PDR            (1UL << 2)
+#define TEST_PFS_PMR            (1UL << 16)
+#define TEST_PFS_PSEL_MASK      (0x1FUL << 24)
+#define TEST_PWPR_ADDRESS       ((uintptr_t) &R_PMISC->PWPR)
+#define TEST_PWPR_PFSWE         (0x40U)
+#define TEST_PWPR_B0WI          (0x80U)
+
+/* Implemented in test_ioport_fast_cxx.cpp. */
+void test_ioport_fast_cxx(void);
+
+static uint32_t g_podr[TEST_PORTS];          ///< Output data of each port
+static uint32_t g_input[TEST_PORTS];         ///< Levels driven on the pins from outside
+static uint32_t g_port_writes;               ///< Writes to the PCNTR registers
+static uint32_t g_pcntr3_writes;
+static uint32_t g_pcntr3_last;               ///< Last value written to a PCNTR3 register
+static uint32_t g_pfs[TEST_PFS_PINS];        ///< PFS values as last written
+static uint32_t g_pfs_writes;
+static uint32_t g_pfs_locked_writes;         ///< PFS writes while PWPR.PFSWE was clear
+static uint32_t g_pfs_glitches;              ///< PFS writes that changed PSEL with PMR set
+static uint32_t g_pwpr_writes;
+
+static uint32_t volatile * test_pcntr (uint32_t port, uint32_t offset)
+{
+    return (uint32_t volatile *) (R_IOPORT0_BASE + (port * TEST_PORT_STRIDE) + offset);
+}
+
+/** PIDR follows PODR on output pins and the outside levels on input pins. The PODR, PIDR and PDR bits of each PFS
+ *  register show the same pin state as the port registers. */
+static void test_port_update (uint32_t port)
+{
+    uint32_t pdr  = *test_pcntr(port, TEST_PCNTR1) & 0xFFFFU;
+    uint32_t pidr = (g_podr[port] & pdr) | (g_input[port] & ~pdr);
+    *test_pcntr(port, TEST_PCNTR1) = (g_podr[port] << 16) | pdr;
+    *test_pcntr(port, TEST_PCNTR2) = pidr;
+
+    uint32_t volatile * p_pfs = &((uint32_t volatile *) R_PFS_BASE)[port * 16U];
+    for (uint32_t pin = 0U; pin < 16U; pin++)
+    {
+        uint32_t pfs = p_pfs[pin] & ~(TEST_PFS_PODR | TEST_PFS_PIDR | TEST_PFS_PDR);
+        pfs |= ((g_podr[port] >> pin) & 1U) ? TEST_PFS_PODR : 0U;
+        pfs |= ((pidr >> pin) & 1U) ? TEST_PFS_PIDR : 0U;
+        pfs |= ((pdr >> pin) & 1U) ? TEST_PFS_PDR : 0U;
+        p_pfs[pin] = pfs;
+    }
+}
+
+/**
+ * Port, PFS and PWPR registers. PCNTR3 writes set (POSR) and clear (PORR) output data and read back as zero, writes to
+ * PCNTR2 by the test stand for the levels driven on the pins from outside, and PFS writes are checked against PWPR.
+ */
+static void test_ioport_hook (bsp_sim_peripheral_t * const p_peripheral, bsp_sim_hook_event_t event)
+{
+    if (BSP_SIM_HOOK_EVENT_RESET == event)
+    {
+        memset(g_podr, 0, sizeof(g_podr));
+        memset(g_input, 0, sizeof(g_input));
+        memset(g_pfs, 0, sizeof(g_pfs));
+        R_PMISC->PWPR = TEST_PWPR_B0WI;
+        return;
+    }
+    if (BSP_SIM_HOOK_EVENT_WRITE != event)
+    {
+        return;
+    }
+
+    uintptr_t address = p_peripheral->address;
+    if (address < (R_IOPORT0_BASE + (TEST_PORTS * TEST_PORT_STRIDE)))
+    {
+        uint32_t port   = (uint32_t) (address - R_IOPORT0_BASE) / TEST_PORT_STRIDE;
+        uint32_t offset = (uint32_t) (address - R_IOPORT0_BASE) % TEST_PORT_STRIDE;
+        g_port_writes++;
+        if ((offset & ~3U) == TEST_PCNTR3)
+        {
+            uint32_t value = *test_pcntr(port, TEST_PCNTR3);
+            g_podr[port]  = (g_podr[port] | (value & 0xFFFFU)) & ~(value >> 16);
+            g_pcntr3_last = value;
+            g_pcntr3_writes++;
+            *test_pcntr(port, TEST_PCNTR3) = 0U;
+        }
+        else if ((offset & ~3U) == TEST_PCNTR2)
+        {
+            g_input[port] = *test_pcntr(port, TEST_PCNTR2) & 0xFFFFU;
+        }
+        else
+        {
+            g_podr[port] = *test_pcntr(port, TEST_PCNTR1) >> 16;
+        }
+        test_port_update(port);
+    }
+    else if ((address >= R_PFS_BASE) && (address < (R_PFS_BASE + (TEST_PFS_PINS * 4U))))
+    {
+        uint32_t index = (uint32_t) (address - R_PFS_BASE) / 4U;
+        uint32_t value = ((uint32_t volatile *) R_PFS_BASE)[index];
+        if (TEST_PWPR_PFSWE != R_PMISC->PWPR)
+        {
+            g_pfs_locked_writes++;
+        }
+        if ((value & TEST_PFS_PMR) && ((value & TEST_PFS_PSEL_MASK) != (g_pfs[index] & TEST_PFS_PSEL_MASK)))
+        {
+            g_pfs_glitches++;
+        }
+        g_pfs[index] = value;
+        g_pfs_writes++;
+
+        /** PFS.PODR and PFS.PDR are the port bits of the pin. */
+        uint32_t port = index / 16U;
+        uint32_t mask = 1UL << (index % 16U);
+        uint32_t pdr  = *test_pcntr(port, TEST_PCNTR1) & 0xFFFFU;
+        g_podr[port]  = (value & TEST_PFS_PODR) ? (g_podr[port] | mask) : (g_podr[port] & ~mask);
+        pdr           = (value & TEST_PFS_PDR) ? (pdr | mask) : (pdr & ~mask);
+        *test_pcntr(port, TEST_PCNTR1) = pdr;
+        test_port_update(port);
+    }
+    else if (address == TEST_PWPR_ADDRESS)
+    {
+        g_pwpr_writes++;
+    }
+    else
+    {
+        /* Nothing else of this block is used by the driver. */
+    }
+}
+
+static bsp_sim_peripheral_t g_ioport_model =
+{
+    .p_name = "IOPORT",
+    .base   = R_IOPORT0_BASE,
+    .size   = (uint32_t) (R_PMISC_BASE + 0x10U - R_IOPORT0_BASE),
+    .p_hook = test_ioport_hook,
+    .trap   = BSP_SIM_TRAP_WRITE,
+};
+
+static uint32_t test_pfs_index (ioport_port_pin_t pin)
+{
+    return (IOPORT_PORT_INDEX(pin) * 16U) + ((uint32_t) pin & 0x0FU);
+}
+
+/** Sets the direction of every pin of a port, 1 for output. */
+static void test_port_direction (uint32_t port, uint32_t output_pins)
+{
+    *test_pcntr(port, TEST_PCNTR1) = (g_podr[port] << 16) | output_pins;
+}
+
+/** Drives the outside levels of the input pins of a port. */
+static void test_port_input (uint32_t port, uint32_t levels)
+{
+    *test_pcntr(port, TEST_PCNTR2) = levels;
+}
+
+/** Each output accessor is one PCNTR3 store of the expected value that changes only its own pins. */
+static void test_ioport_fast_write (void)
+{
+    test_port_direction(6U, 0xFFFFU);
+    g_podr[6] = 0x1001U;
+    test_port_direction(6U, 0xFFFFU);
+    uint32_t writes        = g_port_writes;
+    uint32_t pcntr3_writes = g_pcntr3_writes;
+
+    R_IOPORT_FastPinSet(IOPORT_PORT_06_PIN_05);
+    HOST_TEST_CHECK_EQUAL(0x00000020U, g_pcntr3_last);
+    HOST_TEST_CHECK_EQUAL(0x1021U, g_podr[6]);
+
+    R_IOPORT_FastPinClear(IOPORT_PORT_06_PIN_00);
+    HOST_TEST_CHECK_EQUAL(0x00010000U, g_pcntr3_last);
+    HOST_TEST_CHECK_EQUAL(0x1020U, g_podr[6]);
+
+    R_IOPORT_FastPinWrite(IOPORT_PORT_06_PIN_15, IOPORT_LEVEL_HIGH);
+    HOST_TEST_CHECK_EQUAL(0x00008000U, g_pcntr3_last);
+    HOST_TEST_CHECK_EQUAL(0x9020U, g_podr[6]);
+
+    R_IOPORT_FastPinWrite(IOPORT_PORT_06_PIN_12, IOPORT_LEVEL_LOW);
+    HOST_TEST_CHECK_EQUAL(0x10000000U, g_pcntr3_last);
+    HOST_TEST_CHECK_EQUAL(0x8020U, g_podr[6]);
+
+    /** Toggle reads PODR and writes only the pin it inverts. */
+    R_IOPORT_FastPinToggle(IOPORT_PORT_06_PIN_05);
+    HOST_TEST_CHECK_EQUAL(0x00200000U, g_pcntr3_last);
+    HOST_TEST_CHECK_EQUAL(0x8000U, g_podr[6]);
+    R_IOPORT_FastPinToggle(IOPORT_PORT_06_PIN_05);
+    HOST_TEST_CHECK_EQUAL(0x00000020U, g_pcntr3_last);
+    HOST_TEST_CHECK_EQUAL(0x8020U, g_podr[6]);
+
+    R_IOPORT_FastPortSetClear(IOPORT_PORT_06, 0x0003U, 0x8020U);
+    HOST_TEST_CHECK_EQUAL(0x80200003U, g_pcntr3_last);
+    HOST_TEST_CHECK_EQUAL(0x0003U, g_podr[6]);
+
+    HOST_TEST_CHECK_EQUAL(writes + 7U, g_port_writes);
+    HOST_TEST_CHECK_EQUAL(pcntr3_writes + 7U, g_pcntr3_writes);
+
+    /** Other ports are never touched. */
+    for (uint32_t port = 0U; port < TEST_PORTS; port++)
+    {
+        HOST_TEST_CHECK((6U == port) || (0U == g_podr[port]));
+    }
+}
+
+/** The fast accessors agree with the driver API on every pin of every port, for both levels and both directions. */
+static void test_ioport_fast_api (void)
+{
+    uint32_t checked = 0U;
+
+    for (uint32_t port = 0U; port < TEST_PORTS; port++)
+    {
+        ioport_port_t port_id = (ioport_port_t) (port << 8);
+        test_port_direction(port, 0x00FFU);
+        test_port_input(port, 0xA5A5U);
+
+        for (uint32_t pin = 0U; pin < 16U; pin++)
+        {
+            ioport_port_pin_t port_pin = (ioport_port_pin_t) ((port << 8) | pin);
+            ioport_level_t    level    = IOPORT_LEVEL_LOW;
+            if (SSP_SUCCESS != g_ioport_on_ioport.pinRead(port_pin, &level))
+            {
+                /** The pin is not on this package. */
+                continue;
+            }
+            HOST_TEST_CHECK_EQUAL(level, R_IOPORT_FastPinRead(port_pin));
+
+            /** Input pins read the outside level, output pins what was written. */
+            for (uint32_t i = 0U; i < 2U; i++)
+            {
+                ioport_level_t write = (0U == i) ? IOPORT_LEVEL_HIGH : IOPORT_LEVEL_LOW;
+                R_IOPORT_FastPinWrite(port_pin, write);
+                ioport_level_t expected = write;
+                if (pin >= 8U)
+                {
+                    expected = (0xA5A5U & IOPORT_PIN_MASK(port_pin)) ? IOPORT_LEVEL_HIGH : IOPORT_LEVEL_LOW;
+                }
+                HOST_TEST_CHECK_EQUAL(expected, R_IOPORT_FastPinRead(port_pin));
+                HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_ioport_on_ioport.pinRead(port_pin, &level));
+                HOST_TEST_CHECK_EQUAL(expected, level);
+
+                HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_ioport_on_ioport.pinWrite(port_pin, write));
+                HOST_TEST_CHECK_EQUAL(expected, R_IOPORT_FastPinRead(port_pin));
+            }
+            checked++;
+        }
+
+        ioport_size_t value = 0U;
+        if (SSP_SUCCESS == g_ioport_on_ioport.portRead(port_id, &value))
+        {
+            HOST_TEST_CHECK_EQUAL(value, R_IOPORT_FastPortRead(port_id));
+        }
+    }
+
+    HOST_TEST_CHECK_EQUAL(TEST_PORTS * 16U, checked);
+}
+
+/** The accessors compile as C++ and act the same there. */
+static void test_ioport_fast_cplusplus (void)
+{
+    test_port_direction(6U, 0xFFFFU);
+    R_IOPORT_FastPortSetClear(IOPORT_PORT_06, 0x0000U, 0xFFFFU);
+    uint32_t writes = g_pcntr3_writes;
+
+    test_ioport_fast_cxx();
+    HOST_TEST_CHECK_EQUAL(writes + 4U, g_pcntr3_writes);
+    HOST_TEST_CHECK_EQUAL(0x0020U, g_podr[6]);
+}
+
+/** The whole table is written inside one PFS write access window, with PSEL changed only while PMR is clear. */
+static void test_ioport_pins_cfg (void)
+{
+    static const ioport_pin_cfg_t pins[] =
+    {
+        { .pin = IOPORT_PORT_00_PIN_00, .pin_cfg = IOPORT_CFG_ANALOG_ENABLE },
+        { .pin = IOPORT_PORT_03_PIN_05, .pin_cfg = IOPORT_CFG_PERIPHERAL_PIN | IOPORT_PERIPHERAL_SCI0_2_4_6_8 },
+        { .pin = IOPORT_PORT_03_PIN_06, .pin_cfg = IOPORT_CFG_PERIPHERAL_PIN | IOPORT_PERIPHERAL_SCI0_2_4_6_8 },
+        { .pin = IOPORT_PORT_06_PIN_05, .pin_cfg = IOPORT_CFG_PORT_DIRECTION_OUTPUT | IOPORT_CFG_PORT_OUTPUT_HIGH },
+        { .pin = IOPORT_PORT_06_PIN_15, .pin_cfg = IOPORT_CFG_PORT_DIRECTION_OUTPUT | IOPORT_CFG_DRIVE_MID },
+        { .pin = IOPORT_PORT_01_PIN_02, .pin_cfg = IOPORT_CFG_PERIPHERAL_PIN | IOPORT_PERIPHERAL_GPT1 },
+        { .pin = IOPORT_PORT_01_PIN_03, .pin_cfg = IOPORT_CFG_PULLUP_ENABLE },
+    };
+    ioport_cfg_t const cfg = { .number_of_pins = sizeof(pins) / sizeof(pins[0]), .p_pin_cfg_data = pins };
+
+    /** P305 is a peripheral pin with another function, so its PSEL must change with PMR clear. */
+    ((uint32_t volatile *) R_PFS_BASE)[test_pfs_index(IOPORT_PORT_03_PIN_05)] =
+        IOPORT_CFG_PERIPHERAL_PIN | IOPORT_PERIPHERAL_SCI1_3_5_7_9;
+    g_pfs_writes        = 0U;
+    g_pfs_locked_writes = 0U;
+    g_pfs_glitches      = 0U;
+    g_pwpr_writes       = 0U;
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_ioport_on_ioport.pinsCfg(&cfg));
+    for (uint32_t i = 0U; i < cfg.number_of_pins; i++)
+    {
+        HOST_TEST_CHECK_EQUAL(pins[i].pin_cfg, g_pfs[test_pfs_index(pins[i].pin)]);
+    }
+    HOST_TEST_CHECK(g_pfs_writes >= cfg.number_of_pins);
+    HOST_TEST_CHECK_EQUAL(0U, g_pfs_locked_writes);
+    HOST_TEST_CHECK_EQUAL(0U, g_pfs_glitches);
+
+    /** PWPR is opened and closed once, and left locked. */
+    HOST_TEST_CHECK_EQUAL(4U, g_pwpr_writes);
+    HOST_TEST_CHECK_EQUAL(TEST_PWPR_B0WI, R_PMISC->PWPR);
+
+    /** A single pin costs the same window. */
+    g_pwpr_writes = 0U;
+    uint32_t pin_cfg = IOPORT_CFG_PORT_DIRECTION_OUTPUT;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_ioport_on_ioport.pinCfg(IOPORT_PORT_06_PIN_05, pin_cfg));
+    HOST_TEST_CHECK_EQUAL(pin_cfg, g_pfs[test_pfs_index(IOPORT_PORT_06_PIN_05)]);
+    HOST_TEST_CHECK_EQUAL(4U, g_pwpr_writes);
+    HOST_TEST_CHECK_EQUAL(0U, g_pfs_locked_writes);
+    HOST_TEST_CHECK_EQUAL(TEST_PWPR_B0WI, R_PMISC->PWPR);
+}
+
+int main (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimInit());
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimPeripheralRegister(&g_ioport_model));
+
+    ioport_pin_cfg_t const pin  = { .pin = IOPORT_PORT_06_PIN_00, .pin_cfg = IOPORT_CFG_PORT_DIRECTION_OUTPUT };
+    ioport_cfg_t const     init = { .number_of_pins = 1U, .p_pin_cfg_data = &pin };
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_ioport_on_ioport.init(&init));
+
+    test_ioport_fast_write();
+    test_ioport_fast_api();
+    test_ioport_fast_cplusplus();
+    test_ioport_pins_cfg();
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,40 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : test_ioport_fast_cxx.cpp
+ * Description  : The GPIO fast path compiled as C++. Pin masks and port indexes are constant expressions.
+ **********************************************************************************************************************/
+
+#include "bsp_api.h"
+#include "r_ioport.h"
+
+static_assert(IOPORT_PIN_MASK(IOPORT_PORT_06_PIN_05) == 0x20U, "pin mask is a constant expression");
+static_assert(IOPORT_PORT_INDEX(IOPORT_PORT_06_PIN_05) == 6U, "port index is a constant expression");
+
+extern "C" void test_ioport_fast_cxx (void)
+{
+    constexpr ioport_port_pin_t pin = IOPORT_PORT_06_PIN_05;
+
+    R_IOPORT_FastPinSet(pin);
+    R_IOPORT_FastPinWrite(pin, IOPORT_LEVEL_LOW);
+    R_IOPORT_FastPinToggle(pin);
+    R_IOPORT_FastPinWrite(IOPORT_PORT_06_PIN_06, (IOPORT_LEVEL_HIGH == R_IOPORT_FastPinRead(pin)) ?
+                          IOPORT_LEVEL_LOW : IOPORT_LEVEL_HIGH);
+}
@@ -0,0 +1,257 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : test_isr_trace.c
+ * Description  : Per interrupt ISR timing: counts, minimum, maximum, total and histogram of each IRQ, exclusive times
+ *                of preempted ISRs, and the text report. The trace source is compiled into this test with tracing
+ *                enabled and its clock replaced by one the ISRs advance, so every time is known exactly.
+ **********************************************************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "bsp_api.h"
+
+/* Trace the ISRs of this test whatever the configuration of the library is. */
+#undef BSP_CFG_ISR_TRACE_ENABLE
+#define BSP_CFG_ISR_TRACE_ENABLE    (1)
+#undef BSP_ISR_TRACE_ENTER
+#define BSP_ISR_TRACE_ENTER         bsp_isr_trace_enter();
+#undef BSP_ISR_TRACE_EXIT
+#define BSP_ISR_TRACE_EXIT          bsp_isr_trace_exit();
+
+static int test_clock_gettime(clockid_t clock, struct timespec * p_time);
+#define clock_gettime               test_clock_gettime
+
+#include "../../synergy/ssp/src/bsp/mcu/all/bsp_isr_trace.c"
+#include "host_test.h"
+
+#define TEST_LOW_PRIORITY           (12U)
+#define TEST_HIGH_PRIORITY          (4U)
+#define TEST_REPORT_MAX             (1024U)
+
+SSP_VECTOR_DEFINE_CHAN(test_low_isr, GPT, COUNTER_OVERFLOW, 0);
+SSP_VECTOR_DEFINE_CHAN(test_high_isr, GPT, COUNTER_OVERFLOW, 1);
+
+static uint64_t  g_now_ns;
+static uint32_t  g_low_before;         ///< Time the low priority ISR runs before it is preempted
+static uint32_t  g_low_after;          ///< Time the low priority ISR runs after the high priority ISR returns
+static uint32_t  g_high_time;          ///< Time the high priority ISR runs
+static bool      g_preempt;            ///< The low priority ISR pends the high priority ISR
+static IRQn_Type g_low_irq;
+static IRQn_Type g_high_irq;
+static char      g_report[TEST_REPORT_MAX];
+static uint32_t  g_report_length;
+static uint32_t  g_report_lines;
+
+static int test_clock_gettime (clockid_t clock, struct timespec * p_time)
+{
+    HOST_TEST_CHECK_EQUAL(CLOCK_MONOTONIC, clock);
+    p_time->tv_sec  = (time_t) (g_now_ns / 1000000000ULL);
+    p_time->tv_nsec = (long) (g_now_ns % 1000000000ULL);
+
+    return 0;
+}
+
+void test_low_isr (void)
+{
+    SF_CONTEXT_SAVE
+    g_now_ns += g_low_before;
+    if (g_preempt)
+    {
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimIrqPend(g_high_irq));
+    }
+    g_now_ns += g_low_after;
+    SF_CONTEXT_RESTORE
+}
+
+void test_high_isr (void)
+{
+    SF_CONTEXT_SAVE
+    HOST_TEST_CHECK_EQUAL(g_high_irq, R_SSP_CurrentIrqGet());
+    g_now_ns += g_high_time;
+    SF_CONTEXT_RESTORE
+}
+
+static void test_report_write (char const * p_text, uint32_t length, void * p_context)
+{
+    HOST_TEST_CHECK(g_report == p_context);
+    HOST_TEST_CHECK((g_report_length + length) < TEST_REPORT_MAX);
+    memcpy(&g_report[g_report_length], p_text, length);
+    g_report_length += length;
+    g_report[g_report_length] = '\0';
+    g_report_lines++;
+}
+
+static IRQn_Type test_irq_find (ssp_vector_t isr)
+{
+    for (uint32_t irq = 0U; irq < BSP_VECTOR_TABLE_MAX_ENTRIES; irq++)
+    {
+        if (isr == R_BSP_SimVectorGet((IRQn_Type) irq))
+        {
+            return (IRQn_Type) irq;
+        }
+    }
+    HOST_TEST_CHECK(false);
+
+    return (IRQn_Type) 0;
+}
+
+static bsp_isr_trace_stats_t test_stats (IRQn_Type irq)
+{
+    bsp_isr_trace_stats_t stats;
+    memset(&stats, 0xFF, sizeof(stats));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_IsrTraceGet(irq, &stats));
+
+    return stats;
+}
+
+/** Runs the low priority ISR once. */
+static void test_low_run (uint32_t before, uint32_t after, bool preempt, uint32_t high)
+{
+    g_low_before = before;
+    g_low_after  = after;
+    g_preempt    = preempt;
+    g_high_time  = high;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimIrqPend(g_low_irq));
+}
+
+/** Count, minimum, maximum, total and histogram bin of a single interrupt. */
+static void test_trace_single (void)
+{
+    static const uint32_t times[] = { 100U, 15U, 16U, 1000U, 40U, 1U << 20 };
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_IsrTraceReset());
+
+    uint64_t total = 0U;
+    for (uint32_t i = 0U; i < (sizeof(times) / sizeof(times[0])); i++)
+    {
+        test_low_run(times[i], 0U, false, 0U);
+        total += times[i];
+    }
+
+    bsp_isr_trace_stats_t stats = test_stats(g_low_irq);
+    HOST_TEST_CHECK_EQUAL(6U, stats.count);
+    HOST_TEST_CHECK_EQUAL(15U, stats.min);
+    HOST_TEST_CHECK_EQUAL(1U << 20, stats.max);
+    HOST_TEST_CHECK_EQUAL(total, stats.total);
+
+    /** Bin 0 holds times below 16, each further bin twice the range, the last bin everything above. */
+    static const uint32_t histogram[BSP_ISR_TRACE_HISTOGRAM_BINS] = { 1U, 1U, 1U, 1U, 0U, 0U, 1U, 0U, 0U, 0U, 0U, 1U };
+    for (uint32_t bin = 0U; bin < BSP_ISR_TRACE_HISTOGRAM_BINS; bin++)
+    {
+        HOST_TEST_CHECK_EQUAL(histogram[bin], stats.histogram[bin]);
+    }
+
+    /** Interrupts that did not run have no statistics. */
+    HOST_TEST_CHECK_EQUAL(0U, test_stats(g_high_irq).count);
+}
+
+/** A preempted ISR is charged only its own time, the preempting ISR is counted separately. */
+static void test_trace_nested (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_IsrTraceReset());
+
+    for (uint32_t i = 1U; i <= 10U; i++)
+    {
+        test_low_run(100U * i, 20U, true, 5000U + i);
+    }
+
+    bsp_isr_trace_stats_t low = test_stats(g_low_irq);
+    HOST_TEST_CHECK_EQUAL(10U, low.count);
+    HOST_TEST_CHECK_EQUAL(120U, low.min);
+    HOST_TEST_CHECK_EQUAL(1020U, low.max);
+    HOST_TEST_CHECK_EQUAL((100U * 55U) + (20U * 10U), low.total);
+
+    bsp_isr_trace_stats_t high = test_stats(g_high_irq);
+    HOST_TEST_CHECK_EQUAL(10U, high.count);
+    HOST_TEST_CHECK_EQUAL(5001U, high.min);
+    HOST_TEST_CHECK_EQUAL(5010U, high.max);
+    HOST_TEST_CHECK_EQUAL((5000U * 10U) + 55U, high.total);
+    HOST_TEST_CHECK_EQUAL(10U, high.histogram[9]);
+
+    /** An interrupt of the same priority does not preempt, so both are charged their own time only. */
+    NVIC_SetPriority(g_high_irq, TEST_LOW_PRIORITY);
+    test_low_run(300U, 30U, true, 700U);
+    HOST_TEST_CHECK_EQUAL(1020U, test_stats(g_low_irq).max);
+    HOST_TEST_CHECK_EQUAL(330U + (100U * 55U) + (20U * 10U), test_stats(g_low_irq).total);
+    HOST_TEST_CHECK_EQUAL(700U, test_stats(g_high_irq).min);
+    NVIC_SetPriority(g_high_irq, TEST_HIGH_PRIORITY);
+
+    /** Nothing is left on the nesting stack. */
+    HOST_TEST_CHECK_EQUAL(0U, g_bsp_isr_trace_depth);
+}
+
+/** The report has a header line and one line per interrupt that ran. */
+static void test_trace_report (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_IsrTraceReset());
+    test_low_run(40U, 0U, true, 100U);
+    test_low_run(60U, 0U, false, 0U);
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_IsrTraceReport(test_report_write, g_report));
+    HOST_TEST_CHECK_EQUAL(3U, g_report_lines);
+
+    char low[128];
+    char high[128];
+    (void) snprintf(low, sizeof(low), "irq=%d ip=%d unit=0 ch=0 sig=%d count=2 min=40 max=60 mean=50 "
+                    "hist=0,0,2,0,0,0,0,0,0,0,0,0\r\n", (int) g_low_irq, (int) SSP_IP_GPT,
+                    (int) SSP_SIGNAL_GPT_COUNTER_OVERFLOW);
+    (void) snprintf(high, sizeof(high), "irq=%d ip=%d unit=0 ch=1 sig=%d count=1 min=100 max=100 mean=100 "
+                    "hist=0,0,0,1,0,0,0,0,0,0,0,0\r\n", (int) g_high_irq, (int) SSP_IP_GPT,
+                    (int) SSP_SIGNAL_GPT_COUNTER_OVERFLOW);
+
+    /** The interrupts are reported in IRQ order. */
+    char expected[TEST_REPORT_MAX];
+    int  length = snprintf(expected, sizeof(expected), "isr_trace time=ns shift=4 bins=12\r\n%s%s",
+                           (g_low_irq < g_high_irq) ? low : high, (g_low_irq < g_high_irq) ? high : low);
+    HOST_TEST_CHECK_EQUAL((uint32_t) length, g_report_length);
+    HOST_TEST_CHECK(0 == strcmp(expected, g_report));
+
+    /** Reset clears every interrupt. */
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_IsrTraceReset());
+    HOST_TEST_CHECK_EQUAL(0U, test_stats(g_low_irq).count);
+    HOST_TEST_CHECK_EQUAL(0U, test_stats(g_high_irq).count);
+
+    bsp_isr_trace_stats_t stats;
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_ARGUMENT, R_BSP_IsrTraceGet((IRQn_Type) -1, &stats));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_ARGUMENT,
+                          R_BSP_IsrTraceGet((IRQn_Type) BSP_VECTOR_TABLE_MAX_ENTRIES, &stats));
+}
+
+int main (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimInit());
+
+    g_low_irq  = test_irq_find(test_low_isr);
+    g_high_irq = test_irq_find(test_high_isr);
+    NVIC_SetPriority(g_low_irq, TEST_LOW_PRIORITY);
+    NVIC_SetPriority(g_high_irq, TEST_HIGH_PRIORITY);
+    NVIC_EnableIRQ(g_low_irq);
+    NVIC_EnableIRQ(g_high_irq);
+    __enable_irq();
+
+    test_trace_single();
+    test_trace_nested();
+    test_trace_report();
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,556 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : test_jpeg_surface.c
+ * Description  : Checks the images sf_jpeg_surface writes into frame buffers against blit_reference_convert() of the
+ *                decoded image, for every layer format, on frame buffers with padded strides and rectangles that
+ *                start on and off an 8 byte boundary, so both the direct and the band path are used. A model of the
+ *                JPEG decoder stands in for the hardware. The whole memory behind each frame buffer is compared, so
+ *                writes outside the rectangle fail too. Images that fail are reported and skipped.
+ **********************************************************************************************************************/
+
+#include <string.h>
+
+#include "bsp_api.h"
+#include "sf_jpeg_surface.h"
+#include "blit_reference.h"
+#include "host_test.h"
+
+#define TEST_SURFACE_MEMORY_WORDS   (2600U)
+#define TEST_SURFACE_MAX_SIZE       (48U)
+#define TEST_SURFACE_BAND_BYTES     (TEST_SURFACE_MAX_SIZE * 4U * 16U)
+#define TEST_SURFACE_MCU_LINES      (16U)
+#define TEST_SURFACE_BLOCK          (8U)
+#define TEST_SURFACE_CASES          (200U)
+#define TEST_SURFACE_EVENTS_MAX     (8U)
+#define TEST_SURFACE_ERROR_HEIGHT   (0xFFFFU)
+
+/** Stand-in for the JPEG data: the size of the image and the seed of its pixels. Images are whole 8 x 8 blocks, as
+ *  the decoder requires. */
+typedef struct st_test_jpeg
+{
+    uint16_t width;
+    uint16_t height;                     ///< TEST_SURFACE_ERROR_HEIGHT makes the decoder report an error
+    uint32_t seed;
+} test_jpeg_t;
+
+/** Model of the JPEG decoder. It reports the image size after the header, then fills each output buffer with whole
+ *  MCU rows until the image is complete. */
+typedef struct st_test_decoder
+{
+    bool                     open;
+    jpeg_decode_cfg_t        cfg;
+    test_jpeg_t const      * p_jpeg;
+    bool                     header_read;
+    uint8_t                * p_output;
+    uint32_t                 output_size;
+    uint32_t                 stride;             ///< Pixels
+    uint32_t                 line;
+    uint32_t                 lines_decoded;
+} test_decoder_t;
+
+/** Image reported to the callback. */
+typedef struct st_test_surface_event
+{
+    sf_jpeg_surface_event_t event;
+    ssp_err_t               error;
+    uint16_t                width;
+    uint16_t                height;
+    void const            * p_image_context;
+} test_surface_event_t;
+
+static uint32_t                        g_frame[TEST_SURFACE_MEMORY_WORDS] __attribute__((aligned(8)));
+static uint32_t                        g_expect[TEST_SURFACE_MEMORY_WORDS];
+static uint32_t                        g_decoded[TEST_SURFACE_MAX_SIZE * TEST_SURFACE_MAX_SIZE];
+static uint64_t                        g_band[TEST_SURFACE_BAND_BYTES / sizeof(uint64_t)];
+static test_jpeg_t                     g_jpegs[SF_JPEG_SURFACE_QUEUE_MAX] __attribute__((aligned(8)));
+static uint32_t                        g_random = 0x2545F491U;
+
+static test_decoder_t                  g_decoder;
+static uint32_t                        g_decoder_ctrl;
+static uint32_t                        g_band_images;
+static uint32_t                        g_direct_images;
+static test_surface_event_t            g_events[TEST_SURFACE_EVENTS_MAX];
+static uint32_t                        g_event_count;
+
+static display_cfg_t                   g_display_cfg;
+static display_instance_t const        g_display = { .p_cfg = &g_display_cfg };
+static sf_jpeg_surface_instance_ctrl_t g_surface_ctrl;
+
+/** xorshift32, so every run checks the same cases. */
+static uint32_t test_surface_random (uint32_t range)
+{
+    g_random ^= g_random << 13;
+    g_random ^= g_random >> 17;
+    g_random ^= g_random << 5;
+
+    return g_random % range;
+}
+
+/** Fill words with random bytes. */
+static void test_surface_scramble (uint32_t * p_memory, uint32_t words)
+{
+    for (uint32_t i = 0U; i < words; i++)
+    {
+        p_memory[i] = test_surface_random(0xFFFFFFFFU);
+    }
+}
+
+/** Pixel x, y of an image in the format the decoder is set to. */
+static uint32_t test_decoder_pixel (uint32_t seed, uint32_t x, uint32_t y)
+{
+    uint32_t value = ((seed + x) * 0x9E3779B1U) ^ ((y + 1U) * 0x85EBCA77U);
+    value ^= value >> 15;
+
+    if (JPEG_DECODE_PIXEL_FORMAT_RGB565 == g_decoder.cfg.pixel_format)
+    {
+        return value & 0xFFFFU;
+    }
+
+    return ((uint32_t) g_decoder.cfg.alpha_value << 24) | (value & 0x00FFFFFFU);
+}
+
+static uint32_t test_decoder_bytes (void)
+{
+    return (JPEG_DECODE_PIXEL_FORMAT_RGB565 == g_decoder.cfg.pixel_format) ? 2U : 4U;
+}
+
+static ssp_err_t test_decoder_open (jpeg_decode_ctrl_t * const p_api_ctrl, jpeg_decode_cfg_t const * const p_cfg)
+{
+    SSP_PARAMETER_NOT_USED(p_api_ctrl);
+    if (g_decoder.open)
+    {
+        return SSP_ERR_IN_USE;
+    }
+
+    memset(&g_decoder, 0, sizeof(g_decoder));
+    g_decoder.open = true;
+    g_decoder.cfg  = *p_cfg;
+
+    return SSP_SUCCESS;
+}
+
+static ssp_err_t test_decoder_close (jpeg_decode_ctrl_t * const p_api_ctrl)
+{
+    SSP_PARAMETER_NOT_USED(p_api_ctrl);
+    g_decoder.open = false;
+
+    return SSP_SUCCESS;
+}
+
+static ssp_err_t test_decoder_input_set (jpeg_decode_ctrl_t * const p_api_ctrl, void * p_buffer, uint32_t buffer_size)
+{
+    SSP_PARAMETER_NOT_USED(p_api_ctrl);
+    HOST_TEST_CHECK(g_decoder.open);
+    HOST_TEST_CHECK_EQUAL(0U, buffer_size);
+    g_decoder.p_jpeg      = (test_jpeg_t const *) p_buffer;
+    g_decoder.header_read = false;
+    g_decoder.p_output    = NULL;
+    g_decoder.line        = 0U;
+
+    return SSP_SUCCESS;
+}
+
+static ssp_err_t test_decoder_output_set (jpeg_decode_ctrl_t * const p_api_ctrl, void * p_buffer,
+                                          uint32_t buffer_size)
+{
+    SSP_PARAMETER_NOT_USED(p_api_ctrl);
+    HOST_TEST_CHECK(g_decoder.header_read);
+    HOST_TEST_CHECK_EQUAL(0U, (uintptr_t) p_buffer % 8U);
+    g_decoder.p_output    = p_buffer;
+    g_decoder.output_size = buffer_size;
+    if (0U == g_decoder.line)
+    {
+        if ((uint8_t *) p_buffer == (uint8_t *) g_band)
+        {
+            g_band_images++;
+        }
+        else
+        {
+            g_direct_images++;
+        }
+    }
+
+    return SSP_SUCCESS;
+}
+
+static ssp_err_t test_decoder_stride_set (jpeg_decode_ctrl_t * const p_api_ctrl, uint32_t horizontal_stride)
+{
+    SSP_PARAMETER_NOT_USED(p_api_ctrl);
+    HOST_TEST_CHECK_EQUAL(0U, (horizontal_stride * test_decoder_bytes()) % 8U);
+    g_decoder.stride = horizontal_stride;
+
+    return SSP_SUCCESS;
+}
+
+static ssp_err_t test_decoder_lines_get (jpeg_decode_ctrl_t * const p_api_ctrl, uint32_t * const p_lines)
+{
+    SSP_PARAMETER_NOT_USED(p_api_ctrl);
+    *p_lines = g_decoder.lines_decoded;
+
+    return SSP_SUCCESS;
+}
+
+static ssp_err_t test_decoder_size_get (jpeg_decode_ctrl_t * const p_api_ctrl, uint16_t * p_horizontal_size,
+                                        uint16_t * p_vertical_size)
+{
+    SSP_PARAMETER_NOT_USED(p_api_ctrl);
+    *p_horizontal_size = g_decoder.p_jpeg->width;
+    *p_vertical_size   = g_decoder.p_jpeg->height;
+
+    return SSP_SUCCESS;
+}
+
+static ssp_err_t test_decoder_status_get (jpeg_decode_ctrl_t * const p_api_ctrl, jpeg_decode_status_t * p_status)
+{
+    SSP_PARAMETER_NOT_USED(p_api_ctrl);
+    *p_status = JPEG_DECODE_STATUS_ERROR;
+
+    return SSP_SUCCESS;
+}
+
+static jpeg_decode_api_t const g_decoder_api =
+{
+    .open                = test_decoder_open,
+    .close               = test_decoder_close,
+    .inputBufferSet      = test_decoder_input_set,
+    .outputBufferSet     = test_decoder_output_set,
+    .horizontalStrideSet = test_decoder_stride_set,
+    .linesDecodedGet     = test_decoder_lines_get,
+    .imageSizeGet        = test_decoder_size_get,
+    .statusGet           = test_decoder_status_get,
+};
+static jpeg_decode_cfg_t const g_decoder_cfg = { .pixel_format = JPEG_DECODE_PIXEL_FORMAT_ARGB8888 };
+static jpeg_decode_instance_t const g_decoder_instance =
+{
+    .p_ctrl = &g_decoder_ctrl, .p_cfg = &g_decoder_cfg, .p_api = &g_decoder_api
+};
+
+static void test_decoder_callback (jpeg_decode_status_t status)
+{
+    jpeg_decode_callback_args_t args = { .status = status, .p_context = g_decoder.cfg.p_context };
+    g_decoder.cfg.p_callback(&args);
+}
+
+/** Runs the decoder until the framework stops giving it work. */
+static void test_decoder_run (void)
+{
+    while (g_decoder.open && (NULL != g_decoder.p_jpeg))
+    {
+        test_jpeg_t const * p_jpeg = g_decoder.p_jpeg;
+
+        if (TEST_SURFACE_ERROR_HEIGHT == p_jpeg->height)
+        {
+            g_decoder.p_jpeg = NULL;
+            test_decoder_callback(JPEG_DECODE_STATUS_ERROR);
+        }
+        else if (!g_decoder.header_read)
+        {
+            g_decoder.header_read = true;
+            test_decoder_callback(JPEG_DECODE_STATUS_IMAGE_SIZE_READY);
+        }
+        else if (NULL == g_decoder.p_output)
+        {
+            /* The framework did not give the decoder an output buffer. */
+            break;
+        }
+        else
+        {
+            uint32_t line_bytes = g_decoder.stride * test_decoder_bytes();
+            uint32_t lines      = g_decoder.output_size / line_bytes;
+            HOST_TEST_CHECK(g_decoder.stride >= p_jpeg->width);
+            if (lines >= (p_jpeg->height - g_decoder.line))
+            {
+                lines = p_jpeg->height - g_decoder.line;
+            }
+            else
+            {
+                lines &= ~(TEST_SURFACE_MCU_LINES - 1U);
+                HOST_TEST_CHECK(0U != lines);
+            }
+
+            for (uint32_t y = 0U; y < lines; y++)
+            {
+                for (uint32_t x = 0U; x < p_jpeg->width; x++)
+                {
+                    uint32_t  pixel   = test_decoder_pixel(p_jpeg->seed, x, g_decoder.line + y);
+                    uint8_t * p_pixel = g_decoder.p_output + (y * line_bytes) + (x * test_decoder_bytes());
+                    memcpy(p_pixel, &pixel, test_decoder_bytes());
+                }
+            }
+
+            g_decoder.line         += lines;
+            g_decoder.lines_decoded = lines;
+            g_decoder.p_output      = NULL;
+            if (g_decoder.line < p_jpeg->height)
+            {
+                test_decoder_callback(JPEG_DECODE_STATUS_OUTPUT_PAUSE);
+            }
+            else
+            {
+                g_decoder.p_jpeg = NULL;
+                test_decoder_callback(JPEG_DECODE_STATUS_DONE);
+            }
+        }
+    }
+}
+
+static void test_surface_callback (sf_jpeg_surface_callback_args_t * p_args)
+{
+    HOST_TEST_CHECK(g_event_count < TEST_SURFACE_EVENTS_MAX);
+    test_surface_event_t * p_event = &g_events[g_event_count++];
+    p_event->event           = p_args->event;
+    p_event->error           = p_args->error;
+    p_event->width           = p_args->width;
+    p_event->height          = p_args->height;
+    p_event->p_image_context = p_args->p_image_context;
+}
+
+static sf_jpeg_surface_cfg_t const g_surface_cfg =
+{
+    .p_lower_lvl_jpeg = &g_decoder_instance,
+    .p_display        = &g_display,
+    .p_band_buffer    = g_band,
+    .band_buffer_size = sizeof(g_band),
+    .p_callback       = test_surface_callback,
+};
+
+/** Random frame buffer of a format on layer 1. Half of the time the stride is padded to a multiple of 8 bytes and
+ *  the frame buffer starts on a word, otherwise the stride has up to three pixels of padding and the frame buffer
+ *  starts one pixel past a word half of the time. */
+static void test_surface_layer (display_in_format_t format)
+{
+    display_input_cfg_t * p_input = &g_display_cfg.input[DISPLAY_FRAME_LAYER_1];
+    uint32_t              bytes   = blit_reference_bytes(format);
+    bool                  aligned = (0U == test_surface_random(2U));
+
+    p_input->format  = format;
+    p_input->hsize   = (uint16_t) (TEST_SURFACE_BLOCK + test_surface_random(TEST_SURFACE_MAX_SIZE - 7U));
+    p_input->vsize   = (uint16_t) (TEST_SURFACE_BLOCK + test_surface_random(TEST_SURFACE_MAX_SIZE - 7U));
+    p_input->hstride = (p_input->hsize + test_surface_random(4U)) * bytes;
+    if (aligned)
+    {
+        p_input->hstride = (p_input->hstride + 7U) & ~7U;
+    }
+
+    p_input->p_base = (uint32_t *) ((uint8_t *) g_frame + (aligned ? 0U : (test_surface_random(2U) * bytes)));
+}
+
+/** The layer 1 frame buffer in memory. */
+static blit_surface_t test_surface_of (uint32_t * p_memory)
+{
+    display_input_cfg_t const * p_input = &g_display_cfg.input[DISPLAY_FRAME_LAYER_1];
+    blit_surface_t              surface =
+    {
+        .p_base = (uint8_t *) p_memory + ((uint8_t *) p_input->p_base - (uint8_t *) g_frame),
+        .width  = p_input->hsize,
+        .height = p_input->vsize,
+        .stride = p_input->hstride,
+        .format = p_input->format,
+    };
+
+    return surface;
+}
+
+/** Compare the frame buffer memory with the reference, reporting the first case that differs. */
+static void test_surface_compare (display_in_format_t format, uint32_t test_case)
+{
+    if (0 != memcmp(g_frame, g_expect, sizeof(g_frame)))
+    {
+        for (uint32_t i = 0U; i < TEST_SURFACE_MEMORY_WORDS; i++)
+        {
+            if (g_frame[i] != g_expect[i])
+            {
+                printf("format %d case %u: word %u is 0x%08x, expected 0x%08x\n", (int) format, test_case, i,
+                       g_frame[i], g_expect[i]);
+                break;
+            }
+        }
+        g_host_test_failures++;
+    }
+}
+
+/** Decodes random images into random rectangles of every format and compares with converting the decoded image. */
+static void test_surface_convert (void)
+{
+    static display_in_format_t const formats[] =
+    {
+        DISPLAY_IN_FORMAT_32BITS_ARGB8888, DISPLAY_IN_FORMAT_32BITS_RGB888, DISPLAY_IN_FORMAT_16BITS_RGB565,
+        DISPLAY_IN_FORMAT_16BITS_ARGB1555, DISPLAY_IN_FORMAT_16BITS_ARGB4444,
+    };
+
+    for (uint32_t f = 0U; f < (sizeof(formats) / sizeof(formats[0])); f++)
+    {
+        for (uint32_t test_case = 0U; test_case < TEST_SURFACE_CASES; test_case++)
+        {
+            test_surface_layer(formats[f]);
+            test_surface_scramble(g_frame, TEST_SURFACE_MEMORY_WORDS);
+            memcpy(g_expect, g_frame, sizeof(g_frame));
+
+            display_input_cfg_t const * p_input = &g_display_cfg.input[DISPLAY_FRAME_LAYER_1];
+            sf_jpeg_surface_image_t     image   =
+            {
+                .p_jpeg = (uint8_t const *) &g_jpegs[0],
+                .layer  = DISPLAY_FRAME_LAYER_1,
+                .x      = (uint16_t) test_surface_random(p_input->hsize - 7U),
+                .y      = (uint16_t) test_surface_random(p_input->vsize - 7U),
+            };
+            image.width       = (uint16_t) (TEST_SURFACE_BLOCK + test_surface_random(p_input->hsize - image.x - 7U));
+            image.height      = (uint16_t) (TEST_SURFACE_BLOCK + test_surface_random(p_input->vsize - image.y - 7U));
+            g_jpegs[0].width  = (uint16_t) (TEST_SURFACE_BLOCK *
+                                            (1U + test_surface_random(image.width / TEST_SURFACE_BLOCK)));
+            g_jpegs[0].height = (uint16_t) (TEST_SURFACE_BLOCK *
+                                            (1U + test_surface_random(image.height / TEST_SURFACE_BLOCK)));
+            g_jpegs[0].seed   = test_surface_random(0xFFFFFFFFU);
+
+            g_event_count = 0U;
+            HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_jpeg_surface_on_sf_jpeg_surface.decode(&g_surface_ctrl, &image));
+            test_decoder_run();
+            HOST_TEST_CHECK_EQUAL(1U, g_event_count);
+            HOST_TEST_CHECK_EQUAL(SF_JPEG_SURFACE_EVENT_IMAGE_DONE, g_events[0].event);
+            HOST_TEST_CHECK_EQUAL(g_jpegs[0].width, g_events[0].width);
+            HOST_TEST_CHECK_EQUAL(g_jpegs[0].height, g_events[0].height);
+
+            /** The decoder was set to the format the framework needed, the reference converts from it. */
+            blit_surface_t decoded =
+            {
+                .p_base = g_decoded,
+                .width  = g_jpegs[0].width,
+                .height = g_jpegs[0].height,
+                .stride = g_jpegs[0].width * test_decoder_bytes(),
+                .format = (2U == test_decoder_bytes()) ? DISPLAY_IN_FORMAT_16BITS_RGB565 :
+                          DISPLAY_IN_FORMAT_32BITS_ARGB8888,
+            };
+            for (uint32_t y = 0U; y < decoded.height; y++)
+            {
+                for (uint32_t x = 0U; x < decoded.width; x++)
+                {
+                    uint32_t pixel = test_decoder_pixel(g_jpegs[0].seed, x, y);
+                    memcpy((uint8_t *) g_decoded + (y * decoded.stride) + (x * test_decoder_bytes()), &pixel,
+                           test_decoder_bytes());
+                }
+            }
+
+            blit_surface_t expect = test_surface_of(g_expect);
+            blit_reference_convert(&expect, image.x, image.y, &decoded, NULL);
+            test_surface_compare(formats[f], test_case);
+        }
+    }
+
+    /** Both the direct and the band path were used. */
+    HOST_TEST_CHECK(g_direct_images > 0U);
+    HOST_TEST_CHECK(g_band_images > 0U);
+}
+
+/** Images that fail are reported with the reason and leave the frame buffer alone, and the images queued after them
+ *  are still decoded. */
+static void test_surface_errors (void)
+{
+    display_input_cfg_t * p_input = &g_display_cfg.input[DISPLAY_FRAME_LAYER_1];
+    p_input->format  = DISPLAY_IN_FORMAT_16BITS_ARGB4444;
+    p_input->hsize   = 40U;
+    p_input->vsize   = 40U;
+    p_input->hstride = 40U * 2U;
+    p_input->p_base  = g_frame;
+
+    sf_jpeg_surface_image_t images[SF_JPEG_SURFACE_QUEUE_MAX];
+    test_jpeg_t const       jpegs[SF_JPEG_SURFACE_QUEUE_MAX] =
+    {
+        { .width = 8U,  .height = TEST_SURFACE_ERROR_HEIGHT, .seed = 1U },      ///< Decoder error
+        { .width = 24U, .height = 16U, .seed = 2U },                           ///< Decoded
+        { .width = 24U, .height = 8U,  .seed = 3U },                           ///< Wider than its rectangle
+        { .width = 16U, .height = 16U, .seed = 4U },                           ///< Decoded
+    };
+    for (uint32_t i = 0U; i < SF_JPEG_SURFACE_QUEUE_MAX; i++)
+    {
+        g_jpegs[i] = jpegs[i];
+        images[i]  = (sf_jpeg_surface_image_t)
+        {
+            .p_jpeg = (uint8_t const *) &g_jpegs[i], .layer = DISPLAY_FRAME_LAYER_1, .x = (uint16_t) (i * 2U + 1U),
+            .y = (uint16_t) (i * 4U), .width = 24U, .height = 20U, .p_context = &images[i],
+        };
+    }
+    images[2].width = 16U;
+
+    /** The first image starts at once, the rest wait in the queue, which then is full. */
+    test_surface_scramble(g_frame, TEST_SURFACE_MEMORY_WORDS);
+    memcpy(g_expect, g_frame, sizeof(g_frame));
+    g_event_count = 0U;
+    for (uint32_t i = 0U; i < SF_JPEG_SURFACE_QUEUE_MAX; i++)
+    {
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_jpeg_surface_on_sf_jpeg_surface.decode(&g_surface_ctrl, &images[i]));
+    }
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_QUEUE_FULL, g_sf_jpeg_surface_on_sf_jpeg_surface.decode(&g_surface_ctrl,
+                                                                                         &images[0]));
+    test_decoder_run();
+
+    HOST_TEST_CHECK_EQUAL(SF_JPEG_SURFACE_QUEUE_MAX, g_event_count);
+    for (uint32_t i = 0U; i < g_event_count; i++)
+    {
+        HOST_TEST_CHECK(&images[i] == g_events[i].p_image_context);
+    }
+    HOST_TEST_CHECK_EQUAL(SF_JPEG_SURFACE_EVENT_IMAGE_ERROR, g_events[0].event);
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_JPEG_ERR, g_events[0].error);
+    HOST_TEST_CHECK_EQUAL(SF_JPEG_SURFACE_EVENT_IMAGE_DONE, g_events[1].event);
+    HOST_TEST_CHECK_EQUAL(SF_JPEG_SURFACE_EVENT_IMAGE_ERROR, g_events[2].event);
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_SIZE, g_events[2].error);
+    HOST_TEST_CHECK_EQUAL(24U, g_events[2].width);
+    HOST_TEST_CHECK_EQUAL(SF_JPEG_SURFACE_EVENT_IMAGE_DONE, g_events[3].event);
+
+    /** Only the decoded images were written. */
+    for (uint32_t i = 1U; i < SF_JPEG_SURFACE_QUEUE_MAX; i += 2U)
+    {
+        blit_surface_t decoded =
+        {
+            .p_base = g_decoded, .width = jpegs[i].width, .height = jpegs[i].height,
+            .stride = jpegs[i].width * 4U, .format = DISPLAY_IN_FORMAT_32BITS_ARGB8888,
+        };
+        for (uint32_t y = 0U; y < decoded.height; y++)
+        {
+            for (uint32_t x = 0U; x < decoded.width; x++)
+            {
+                g_decoded[(y * decoded.width) + x] = test_decoder_pixel(jpegs[i].seed, x, y);
+            }
+        }
+
+        blit_surface_t expect = test_surface_of(g_expect);
+        blit_reference_convert(&expect, images[i].x, images[i].y, &decoded, NULL);
+    }
+    test_surface_compare(p_input->format, 0U);
+
+    /** The framework is idle and takes images again. */
+    HOST_TEST_CHECK(!g_surface_ctrl.busy);
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_jpeg_surface_on_sf_jpeg_surface.decode(&g_surface_ctrl, &images[3]));
+    test_decoder_run();
+    HOST_TEST_CHECK_EQUAL(SF_JPEG_SURFACE_QUEUE_MAX + 1U, g_event_count);
+}
+
+int main (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimInit());
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_jpeg_surface_on_sf_jpeg_surface.open(&g_surface_ctrl, &g_surface_cfg));
+
+    test_surface_convert();
+    test_surface_errors();
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sf_jpeg_surface_on_sf_jpeg_surface.close(&g_surface_ctrl));
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,327 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : test_pdc_stream.c
+ * Description  : Continuous PDC capture through the DMAC into 2 to 8 frame buffers on the simulated PDC: buffers are
+ *                used in turn, frames that arrive while the application holds every other buffer are dropped and
+ *                counted without touching the held buffers, and released buffers are captured into again.
+ **********************************************************************************************************************/
+
+#include <string.h>
+
+#include "bsp_api.h"
+#include "r_pdc.h"
+#include "r_dmac.h"
+#include "host_test.h"
+
+#define TEST_WIDTH              (64U)
+#define TEST_HEIGHT             (8U)
+#define TEST_BYTES_PER_PIXEL    (2U)
+#define TEST_LINE_BYTES         ((TEST_WIDTH * TEST_BYTES_PER_PIXEL) + 8U)
+#define TEST_FRAME_BYTES        (TEST_WIDTH * TEST_HEIGHT * TEST_BYTES_PER_PIXEL)
+#define TEST_EVENTS_MAX         (64U)
+
+SSP_VECTOR_DEFINE(pdc_frame_end_isr, PDC, FRAME_END);
+SSP_VECTOR_DEFINE(pdc_int_isr, PDC, INT);
+SSP_VECTOR_DEFINE_CHAN(dmac_int_isr, DMAC, INT, 0);
+
+/** Camera image with one line and one pixel outside the capture window on each side. */
+static uint8_t              g_image[TEST_HEIGHT + 2U][TEST_LINE_BYTES];
+static uint8_t              g_frames[PDC_STREAM_BUFFERS_MAX][TEST_FRAME_BYTES] __attribute__((aligned(4)));
+
+static transfer_info_t      g_dmac_info;
+static dmac_instance_ctrl_t g_dmac_ctrl;
+static transfer_on_dmac_cfg_t g_dmac_ext = { .channel = 0U };
+static transfer_cfg_t       g_dmac_cfg   = { .p_info = &g_dmac_info, .irq_ipl = 2U, .p_extend = &g_dmac_ext,
+                                             .activation_source = ELC_EVENT_PDC_RECEIVE_DATA_READY };
+static transfer_instance_t  g_dmac       = { .p_ctrl = &g_dmac_ctrl, .p_cfg = &g_dmac_cfg,
+                                             .p_api = &g_transfer_on_dmac };
+
+/** Frame delivered to the callback. */
+typedef struct st_test_pdc_event
+{
+    pdc_event_t event;
+    uint32_t    frame;
+    uint32_t    dropped;
+    uint32_t    buffer;              ///< Index of the buffer in g_frames
+    bool        content_ok;          ///< The buffer holds the image of its frame
+} test_pdc_event_t;
+
+static pdc_instance_ctrl_t  g_pdc_ctrl;
+static test_pdc_event_t     g_events[TEST_EVENTS_MAX];
+static uint32_t             g_event_count;
+static uint32_t             g_seed;              ///< Seed of the image being sent
+static bool                 g_release;           ///< The callback returns each frame at once
+static uint8_t            * g_held[PDC_STREAM_BUFFERS_MAX];
+static uint32_t             g_held_count;
+
+static void test_pdc_callback (pdc_callback_args_t * p_args);
+
+static pdc_cfg_t            g_pdc_cfg =
+{
+    .x_capture_start_pixel = 1U,
+    .x_capture_pixels      = TEST_WIDTH,
+    .y_capture_start_pixel = 1U,
+    .y_capture_pixels      = TEST_HEIGHT,
+    .bytes_per_pixel       = TEST_BYTES_PER_PIXEL,
+    .frame_end_ipl         = 3U,
+    .irq_ipl               = 3U,
+    .p_lower_lvl_transfer  = &g_dmac,
+    .p_callback            = test_pdc_callback,
+};
+
+static uint8_t test_pdc_pixel (uint32_t seed, uint32_t line, uint32_t byte)
+{
+    return (uint8_t) ((seed * 7U) + (line * 13U) + byte);
+}
+
+/** True if the buffer holds the capture window of the image sent with seed. */
+static bool test_pdc_frame_check (uint8_t const * p_buffer, uint32_t seed)
+{
+    for (uint32_t y = 0U; y < TEST_HEIGHT; y++)
+    {
+        for (uint32_t x = 0U; x < (TEST_WIDTH * TEST_BYTES_PER_PIXEL); x++)
+        {
+            if (p_buffer[(y * TEST_WIDTH * TEST_BYTES_PER_PIXEL) + x] !=
+                test_pdc_pixel(seed, y + 1U, x + TEST_BYTES_PER_PIXEL))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+static void test_pdc_callback (pdc_callback_args_t * p_args)
+{
+    HOST_TEST_CHECK(g_event_count < TEST_EVENTS_MAX);
+    test_pdc_event_t * p_event = &g_events[g_event_count++];
+    p_event->event      = p_args->event;
+    p_event->frame      = p_args->frame;
+    p_event->dropped    = p_args->dropped;
+    p_event->buffer     = UINT32_MAX;
+    p_event->content_ok = false;
+    if (PDC_EVENT_TRANSFER_COMPLETE != p_args->event)
+    {
+        return;
+    }
+
+    p_event->buffer     = (uint32_t) ((p_args->p_buffer - g_frames[0]) / TEST_FRAME_BYTES);
+    p_event->content_ok = test_pdc_frame_check(p_args->p_buffer, g_seed);
+    if (g_release)
+    {
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_pdc_on_pdc.bufferRelease(&g_pdc_ctrl, p_args->p_buffer));
+    }
+    else
+    {
+        g_held[g_held_count++] = p_args->p_buffer;
+    }
+}
+
+/** Sends one camera frame built from seed and runs the interrupts it raises. Returns the result of the PDC model. */
+static ssp_err_t test_pdc_frame_send_result (uint32_t seed)
+{
+    for (uint32_t y = 0U; y < (TEST_HEIGHT + 2U); y++)
+    {
+        for (uint32_t x = 0U; x < TEST_LINE_BYTES; x++)
+        {
+            g_image[y][x] = test_pdc_pixel(seed, y, x);
+        }
+    }
+    g_seed = seed;
+    ssp_err_t err = R_BSP_SimPdcFrame(&g_image[0][0], TEST_LINE_BYTES, TEST_HEIGHT + 2U);
+    R_BSP_SimIrqDispatch();
+
+    return err;
+}
+
+static void test_pdc_frame_send (uint32_t seed)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_pdc_frame_send_result(seed));
+}
+
+/** Starts a continuous capture into the first count buffers of g_frames. */
+static void test_pdc_stream_start (uint32_t count)
+{
+    uint8_t * buffers[PDC_STREAM_BUFFERS_MAX];
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        buffers[i] = g_frames[i];
+    }
+    memset(g_frames, 0, sizeof(g_frames));
+    g_event_count = 0U;
+    g_held_count  = 0U;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_pdc_on_pdc.captureStreamStart(&g_pdc_ctrl, buffers, count));
+}
+
+/** Checks the only event since the last check: frame delivered in buffer with dropped frames before it. */
+static void test_pdc_delivered (uint32_t frame, uint32_t buffer, uint32_t dropped)
+{
+    HOST_TEST_CHECK_EQUAL(1U, g_event_count);
+    HOST_TEST_CHECK_EQUAL(PDC_EVENT_TRANSFER_COMPLETE, g_events[0].event);
+    HOST_TEST_CHECK_EQUAL(frame, g_events[0].frame);
+    HOST_TEST_CHECK_EQUAL(buffer, g_events[0].buffer);
+    HOST_TEST_CHECK_EQUAL(dropped, g_events[0].dropped);
+    HOST_TEST_CHECK(g_events[0].content_ok);
+    g_event_count = 0U;
+}
+
+/** With every frame released from the callback, each buffer count from 2 to 8 is used in turn. */
+static void test_pdc_rotation (void)
+{
+    g_release = true;
+    for (uint32_t count = 2U; count <= PDC_STREAM_BUFFERS_MAX; count++)
+    {
+        test_pdc_stream_start(count);
+        for (uint32_t frame = 1U; frame <= (3U * count); frame++)
+        {
+            test_pdc_frame_send(frame + (count * 100U));
+            test_pdc_delivered(frame, (frame - 1U) % count, 0U);
+        }
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_pdc_on_pdc.captureStop(&g_pdc_ctrl));
+
+        /** Buffers past the count are never written. */
+        for (uint32_t i = count; i < PDC_STREAM_BUFFERS_MAX; i++)
+        {
+            for (uint32_t byte = 0U; byte < TEST_FRAME_BYTES; byte++)
+            {
+                HOST_TEST_CHECK_EQUAL(0U, g_frames[i][byte]);
+            }
+        }
+    }
+
+    /** One buffer, or more than the driver tracks, is rejected. */
+    uint8_t * buffers[PDC_STREAM_BUFFERS_MAX + 1U];
+    for (uint32_t i = 0U; i <= PDC_STREAM_BUFFERS_MAX; i++)
+    {
+        buffers[i] = g_frames[i % PDC_STREAM_BUFFERS_MAX];
+    }
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_ARGUMENT, g_pdc_on_pdc.captureStreamStart(&g_pdc_ctrl, buffers, 1U));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_ARGUMENT,
+                          g_pdc_on_pdc.captureStreamStart(&g_pdc_ctrl, buffers, PDC_STREAM_BUFFERS_MAX + 1U));
+}
+
+/** While the application holds every buffer but the one being captured into, frames are dropped into that buffer and
+ *  counted in the next delivered frame. Held buffers keep their frames. */
+static void test_pdc_drop (void)
+{
+    g_release = false;
+    test_pdc_stream_start(3U);
+
+    test_pdc_frame_send(1U);
+    test_pdc_delivered(1U, 0U, 0U);
+    test_pdc_frame_send(2U);
+    test_pdc_delivered(2U, 1U, 0U);
+
+    /** Frames 3 to 7 have no buffer to go to. */
+    for (uint32_t frame = 3U; frame <= 7U; frame++)
+    {
+        test_pdc_frame_send(frame);
+        HOST_TEST_CHECK_EQUAL(0U, g_event_count);
+    }
+    HOST_TEST_CHECK(test_pdc_frame_check(g_frames[0], 1U));
+    HOST_TEST_CHECK(test_pdc_frame_check(g_frames[1], 2U));
+    HOST_TEST_CHECK(test_pdc_frame_check(g_frames[2], 7U));
+
+    /** The buffer being captured into, a free buffer and foreign pointers cannot be released. */
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_ARGUMENT, g_pdc_on_pdc.bufferRelease(&g_pdc_ctrl, g_frames[2]));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_ARGUMENT, g_pdc_on_pdc.bufferRelease(&g_pdc_ctrl, g_frames[0] + 1));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_ARGUMENT, g_pdc_on_pdc.bufferRelease(&g_pdc_ctrl, g_frames[3]));
+
+    /** Releasing buffer 0 lets frame 8 out of buffer 2, reporting the five frames dropped before it. */
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_pdc_on_pdc.bufferRelease(&g_pdc_ctrl, g_frames[0]));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_ARGUMENT, g_pdc_on_pdc.bufferRelease(&g_pdc_ctrl, g_frames[0]));
+    test_pdc_frame_send(8U);
+    test_pdc_delivered(8U, 2U, 5U);
+    HOST_TEST_CHECK(test_pdc_frame_check(g_frames[1], 2U));
+
+    /** Frame 9 goes to buffer 0, which is the only one left to the driver. */
+    test_pdc_frame_send(9U);
+    HOST_TEST_CHECK_EQUAL(0U, g_event_count);
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_pdc_on_pdc.bufferRelease(&g_pdc_ctrl, g_frames[1]));
+    test_pdc_frame_send(10U);
+    test_pdc_delivered(10U, 0U, 1U);
+    HOST_TEST_CHECK(test_pdc_frame_check(g_frames[2], 8U));
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_pdc_on_pdc.captureStop(&g_pdc_ctrl));
+}
+
+/** Released buffers are captured into again, the first free one after the current buffer first, and a stopped
+ *  capture returns every buffer so a new one can start over the same buffers. */
+static void test_pdc_reuse (void)
+{
+    g_release = false;
+    test_pdc_stream_start(4U);
+    for (uint32_t frame = 1U; frame <= 3U; frame++)
+    {
+        test_pdc_frame_send(frame);
+        test_pdc_delivered(frame, frame - 1U, 0U);
+    }
+
+    /** Buffer 3 is being captured into. Release 1 then 0: the driver takes buffer 0 first, as it follows buffer 3, so
+     *  frame 4 goes out of buffer 3 and frame 5 out of buffer 0. Frame 6 is dropped into buffer 1, the only buffer
+     *  left to the driver. */
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_pdc_on_pdc.bufferRelease(&g_pdc_ctrl, g_frames[1]));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_pdc_on_pdc.bufferRelease(&g_pdc_ctrl, g_frames[0]));
+    test_pdc_frame_send(4U);
+    test_pdc_delivered(4U, 3U, 0U);
+    test_pdc_frame_send(5U);
+    test_pdc_delivered(5U, 0U, 0U);
+    test_pdc_frame_send(6U);
+    HOST_TEST_CHECK_EQUAL(0U, g_event_count);
+    HOST_TEST_CHECK(test_pdc_frame_check(g_frames[2], 3U));
+    HOST_TEST_CHECK(test_pdc_frame_check(g_frames[3], 4U));
+
+    /** A capture in progress cannot be started again. */
+    uint8_t * buffers[2] = { g_frames[0], g_frames[1] };
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_IN_USE, g_pdc_on_pdc.captureStreamStart(&g_pdc_ctrl, buffers, 2U));
+
+    /** After a stop every buffer is the application's, and a new capture starts from frame 1 in buffer 0. */
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_pdc_on_pdc.captureStop(&g_pdc_ctrl));
+    g_release = true;
+    test_pdc_stream_start(2U);
+    for (uint32_t frame = 1U; frame <= 4U; frame++)
+    {
+        test_pdc_frame_send(frame + 50U);
+        test_pdc_delivered(frame, (frame - 1U) % 2U, 0U);
+    }
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_pdc_on_pdc.captureStop(&g_pdc_ctrl));
+
+    /** Frames sent while stopped are not captured. */
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_NOT_ENABLED, test_pdc_frame_send_result(60U));
+    HOST_TEST_CHECK_EQUAL(0U, g_event_count);
+}
+
+int main (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimInit());
+    __enable_irq();
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_pdc_on_pdc.open(&g_pdc_ctrl, &g_pdc_cfg));
+
+    test_pdc_rotation();
+    test_pdc_drop();
+    test_pdc_reuse();
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_pdc_on_pdc.close(&g_pdc_ctrl));
+
+    return HOST_TEST_RESULT();
+}
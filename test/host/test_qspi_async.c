@@ -0,0 +1,555 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : test_qspi_async.c
+ * Description  : Asynchronous reads and page programming of R_QSPI against a model of a serial flash in direct
+ *                communication mode, with DMAC channel 1.  Checks reads at every alignment and across transfer
+ *                chunks, that programs are split at page boundaries and each page is sent only when the flash is idle,
+ *                both with the R_QSPI_StatusGet poll and with a poll timer, and that other operations are refused
+ *                while a program is in progress.
+ **********************************************************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "bsp_api.h"
+#include "r_qspi.h"
+#include "r_dmac.h"
+#include "host_test.h"
+
+#define TEST_FLASH            ((uint8_t *) BSP_PRV_QSPI_DEVICE_PHYSICAL_ADDRESS)
+#define TEST_FLASH_BYTES      (8UL << 20)
+#define TEST_PAGE_BYTES       (256U)
+#define TEST_MAX_PAGES        (32U)
+#define TEST_BUFFER_BYTES     (300000U)
+#define TEST_POLL_LIMIT       (100000U)
+
+#define TEST_CMD_WRITE_ENABLE   (0x06U)
+#define TEST_CMD_WRITE_DISABLE  (0x04U)
+#define TEST_CMD_PAGE_PROGRAM   (0x02U)
+#define TEST_CMD_QUAD_PROGRAM   (0x32U)
+#define TEST_CMD_READ_STATUS    (0x05U)
+#define TEST_CMD_READ_ID        (0x9FU)
+
+/** Page program seen by the flash. */
+typedef struct st_test_page
+{
+    uint32_t address;
+    uint32_t bytes;
+} test_page_t;
+
+/** Flash model.  Bytes of a bus cycle are collected and executed when the cycle is closed. */
+typedef struct st_test_flash
+{
+    uint8_t     cycle[TEST_PAGE_BYTES + 64U];
+    bool        quad[TEST_PAGE_BYTES + 64U];
+    uint32_t    cycle_bytes;
+    bool        write_enabled;
+    uint32_t    busy_polls;                     ///< Status reads left until the page write ends
+    uint8_t     response[4];
+    uint32_t    response_index;
+    test_page_t pages[TEST_MAX_PAGES];
+    uint32_t    page_count;
+    uint32_t    status_polls;
+    uint32_t    protocol_errors;                ///< Programs while busy or write disabled, bytes outside a cycle
+} test_flash_t;
+
+SSP_VECTOR_DEFINE_CHAN(dmac_int_isr, DMAC, INT, 1);
+
+static test_flash_t           g_flash;
+static uint8_t                g_reference[TEST_FLASH_BYTES];
+static uint8_t                g_buffer[TEST_BUFFER_BYTES + 8U];
+static volatile uint32_t      g_read_events;
+static volatile uint32_t      g_program_events;
+static volatile uint32_t      g_other_events;
+
+static transfer_info_t        g_dmac_info;
+static dmac_instance_ctrl_t   g_dmac_ctrl;
+static transfer_on_dmac_cfg_t g_dmac_ext = { .channel = 1U };
+static transfer_cfg_t         g_dmac_cfg = { .p_info = &g_dmac_info, .irq_ipl = 3, .p_extend = &g_dmac_ext };
+static transfer_instance_t    g_dmac     = { .p_ctrl = &g_dmac_ctrl, .p_cfg = &g_dmac_cfg,
+                                             .p_api = &g_transfer_on_dmac };
+
+/** Poll timer stub: the test calls the callback in place of the timer interrupt. */
+static void                (* gp_timer_callback)(timer_callback_args_t * p_args);
+static void const           * gp_timer_context;
+static bool                   g_timer_open;
+static bool                   g_timer_running;
+static uint32_t               g_timer_ctrl;
+
+static ssp_err_t test_timer_open (timer_ctrl_t * const p_ctrl, timer_cfg_t const * const p_cfg)
+{
+    SSP_PARAMETER_NOT_USED(p_ctrl);
+    gp_timer_callback = p_cfg->p_callback;
+    gp_timer_context  = p_cfg->p_context;
+    g_timer_running   = p_cfg->autostart;
+    g_timer_open      = true;
+
+    return SSP_SUCCESS;
+}
+
+static ssp_err_t test_timer_start (timer_ctrl_t * const p_ctrl)
+{
+    SSP_PARAMETER_NOT_USED(p_ctrl);
+    g_timer_running = true;
+
+    return SSP_SUCCESS;
+}
+
+static ssp_err_t test_timer_stop (timer_ctrl_t * const p_ctrl)
+{
+    SSP_PARAMETER_NOT_USED(p_ctrl);
+    g_timer_running = false;
+
+    return SSP_SUCCESS;
+}
+
+static ssp_err_t test_timer_close (timer_ctrl_t * const p_ctrl)
+{
+    SSP_PARAMETER_NOT_USED(p_ctrl);
+    g_timer_open    = false;
+    g_timer_running = false;
+
+    return SSP_SUCCESS;
+}
+
+static timer_api_t            g_timer_api = { .open = test_timer_open, .start = test_timer_start,
+                                              .stop = test_timer_stop, .close = test_timer_close };
+static timer_cfg_t            g_timer_cfg = { .mode = TIMER_MODE_PERIODIC, .autostart = true };
+static timer_instance_t       g_timer     = { .p_ctrl = &g_timer_ctrl, .p_cfg = &g_timer_cfg, .p_api = &g_timer_api };
+
+static void test_qspi_callback (qspi_callback_args_t * p_args);
+
+static qspi_on_qspi_cfg_t     g_qspi_ext  = { .p_lower_lvl_transfer = &g_dmac };
+static qspi_cfg_t             g_qspi_cfg  = { .p_extend = &g_qspi_ext, .addr_mode = QSPI_3BYTE_ADDR_MODE,
+                                              .p_callback = test_qspi_callback };
+static qspi_instance_ctrl_t   g_qspi_ctrl;
+
+static void test_qspi_callback (qspi_callback_args_t * p_args)
+{
+    if (QSPI_EVENT_READ_COMPLETE == p_args->event)
+    {
+        g_read_events++;
+    }
+    else if (QSPI_EVENT_PROGRAM_COMPLETE == p_args->event)
+    {
+        g_program_events++;
+    }
+    else
+    {
+        g_other_events++;
+    }
+}
+
+/** Returns the byte sent at index on one line, or on four lines over the next four SFMCOM writes. */
+static uint8_t test_flash_byte (uint32_t * p_index)
+{
+    uint32_t index = *p_index;
+    if (!g_flash.quad[index])
+    {
+        *p_index = index + 1U;
+
+        return g_flash.cycle[index];
+    }
+
+    /* A byte on four lines takes four SFMCOM writes of one nibble per line.  The model follows IO0, bit 0 of each
+     * nibble, which carries the byte one bit per nibble. */
+    uint32_t value = 0U;
+    for (uint32_t i = 0U; i < 4U; i++)
+    {
+        value = (value << 8) | g_flash.cycle[index + i];
+    }
+    uint8_t byte = 0U;
+    for (uint32_t bit = 0U; bit < 8U; bit++)
+    {
+        byte = (uint8_t) (byte | (((value >> (bit * 4U)) & 1U) << bit));
+    }
+    *p_index = index + 4U;
+
+    return byte;
+}
+
+/** Executes the bus cycle that was just closed. */
+static void test_flash_cycle_end (void)
+{
+    if (0U == g_flash.cycle_bytes)
+    {
+        return;
+    }
+
+    uint32_t index   = 0U;
+    uint8_t  command = test_flash_byte(&index);
+    switch (command)
+    {
+        case TEST_CMD_WRITE_ENABLE:
+            g_flash.write_enabled = true;
+            break;
+
+        case TEST_CMD_WRITE_DISABLE:
+            g_flash.write_enabled = false;
+            break;
+
+        case TEST_CMD_PAGE_PROGRAM:
+        case TEST_CMD_QUAD_PROGRAM:
+        {
+            uint32_t address = 0U;
+            for (uint32_t i = 0U; i < 3U; i++)
+            {
+                address = (address << 8) | test_flash_byte(&index);
+            }
+            if ((!g_flash.write_enabled) || (0U != g_flash.busy_polls))
+            {
+                g_flash.protocol_errors++;
+                break;
+            }
+
+            /** Data past the end of the page wraps to its start, as on the device. */
+            uint32_t page   = address & ~(TEST_PAGE_BYTES - 1U);
+            uint32_t offset = address & (TEST_PAGE_BYTES - 1U);
+            uint32_t bytes  = g_flash.cycle_bytes - index;
+            for (; index < g_flash.cycle_bytes; index++)
+            {
+                TEST_FLASH[page + offset] &= g_flash.cycle[index];
+                offset                     = (offset + 1U) & (TEST_PAGE_BYTES - 1U);
+            }
+            if (g_flash.page_count < TEST_MAX_PAGES)
+            {
+                g_flash.pages[g_flash.page_count] = (test_page_t) { address, bytes };
+            }
+            g_flash.page_count++;
+            g_flash.busy_polls    = 2U + ((uint32_t) rand() % 3U);
+            g_flash.write_enabled = false;
+            break;
+        }
+
+        default:
+            break;
+    }
+
+    g_flash.cycle_bytes = 0U;
+}
+
+static void test_flash_hook (bsp_sim_peripheral_t * const p_peripheral, bsp_sim_hook_event_t event)
+{
+    uintptr_t address = p_peripheral->address;
+
+    switch (event)
+    {
+        case BSP_SIM_HOOK_EVENT_RESET:
+            memset(&g_flash, 0, sizeof(g_flash));
+            break;
+
+        case BSP_SIM_HOOK_EVENT_READ:
+            if (address == (uintptr_t) &R_QSPI->SFMCOM)
+            {
+                R_QSPI->SFMCOM = g_flash.response[(g_flash.response_index < 3U) ? g_flash.response_index : 3U];
+                g_flash.response_index++;
+            }
+            break;
+
+        case BSP_SIM_HOOK_EVENT_WRITE:
+            if (address == (uintptr_t) &R_QSPI->SFMCMD)
+            {
+                /** Setting DCOM again closes the bus cycle, clearing it leaves direct communication mode. */
+                if (0U != R_QSPI->SFMCMD_b.DCOM)
+                {
+                    test_flash_cycle_end();
+                }
+                g_flash.cycle_bytes = 0U;
+            }
+            else if (address == (uintptr_t) &R_QSPI->SFMCOM)
+            {
+                if (0U == R_QSPI->SFMCMD_b.DCOM)
+                {
+                    g_flash.protocol_errors++;
+                    break;
+                }
+
+                uint8_t byte = (uint8_t) R_QSPI->SFMCOM;
+                if (0U == g_flash.cycle_bytes)
+                {
+                    g_flash.response_index = 0U;
+                    memset(g_flash.response, 0, sizeof(g_flash.response));
+                    if (TEST_CMD_READ_ID == byte)
+                    {
+                        g_flash.response[0] = 0xEFU;
+                        g_flash.response[1] = 0x40U;
+                        g_flash.response[2] = 0x17U;
+                    }
+                    else if (TEST_CMD_READ_STATUS == byte)
+                    {
+                        g_flash.status_polls++;
+                        g_flash.response[0] = (uint8_t) (((0U != g_flash.busy_polls) ? 1U : 0U) |
+                                                         (g_flash.write_enabled ? 2U : 0U));
+                        if (0U != g_flash.busy_polls)
+                        {
+                            g_flash.busy_polls--;
+                        }
+                    }
+                    else
+                    {
+                        /* No response. */
+                    }
+                }
+                if (g_flash.cycle_bytes < sizeof(g_flash.cycle))
+                {
+                    g_flash.cycle[g_flash.cycle_bytes] = byte;
+                    g_flash.quad[g_flash.cycle_bytes]  = (2U == R_QSPI->SFMSPC_b.SFMSPI);
+                    g_flash.cycle_bytes++;
+                }
+            }
+            else if (address == (uintptr_t) &R_QSPI->SFMSDC)
+            {
+                /* XIP mode status (bit 6) follows XIP mode permission at once. */
+                R_QSPI->SFMSDC = (R_QSPI->SFMSDC & ~(1UL << 6)) | ((uint32_t) R_QSPI->SFMSDC_b.SFMXEN << 6);
+            }
+            else
+            {
+                /* Other registers have no side effects in the model. */
+            }
+            break;
+
+        default: /* BSP_SIM_HOOK_EVENT_STEP */
+            break;
+    }
+}
+
+static bsp_sim_peripheral_t g_flash_peripheral =
+{
+    .p_name = "QSPI",
+    .base   = R_QSPI_BASE,
+    .size   = 0x1000U,
+    .p_hook = test_flash_hook,
+    .trap   = BSP_SIM_TRAP_ACCESS,
+};
+
+/** Reads at every device and memory alignment, short of one transfer unit up to several transfer chunks. */
+static void test_qspi_read_async (void)
+{
+    static const uint32_t lengths[] = { 1U, 2U, 3U, 4U, 5U, 7U, 255U, 256U, 4099U, (65535U * 2U) + 3U,
+                                        (65535U * 4U) + 5U };
+
+    for (uint32_t i = 0U; i < (sizeof(lengths) / sizeof(lengths[0])); i++)
+    {
+        for (uint32_t device_offset = 0U; device_offset < 4U; device_offset++)
+        {
+            for (uint32_t memory_offset = 0U; memory_offset < 4U; memory_offset++)
+            {
+                uint32_t bytes  = lengths[i];
+                uint32_t device = (((uint32_t) rand() % (TEST_FLASH_BYTES - bytes - 8U)) & ~3U) + device_offset;
+                uint8_t  * p_dest = &g_buffer[memory_offset];
+
+                memset(g_buffer, 0xEE, sizeof(g_buffer));
+                g_read_events = 0U;
+                HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_qspi_on_qspi.readAsync(&g_qspi_ctrl, TEST_FLASH + device, p_dest,
+                                                                            bytes));
+
+                /** The transfer end interrupts run the whole read before the simulated DMAC returns. */
+                HOST_TEST_CHECK_EQUAL(1U, g_read_events);
+                HOST_TEST_CHECK_EQUAL(0U, g_qspi_ctrl.async_state);
+                HOST_TEST_CHECK(0 == memcmp(p_dest, &g_reference[device], bytes));
+                HOST_TEST_CHECK_EQUAL(0xEEU, p_dest[bytes]);
+                if (memory_offset > 0U)
+                {
+                    HOST_TEST_CHECK_EQUAL(0xEEU, p_dest[-1]);
+                }
+            }
+        }
+    }
+    HOST_TEST_CHECK_EQUAL(0U, g_other_events);
+
+    /** A read of no bytes completes at once. */
+    g_read_events = 0U;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_qspi_on_qspi.readAsync(&g_qspi_ctrl, TEST_FLASH, g_buffer, 0U));
+    HOST_TEST_CHECK_EQUAL(1U, g_read_events);
+    HOST_TEST_CHECK_EQUAL(0U, g_qspi_ctrl.async_state);
+}
+
+/** Erases a range in the flash and the reference, fills the buffer with random data and starts programming it. */
+static ssp_err_t test_qspi_program_start (uint32_t address, uint32_t bytes)
+{
+    memset(&TEST_FLASH[address], 0xFF, bytes);
+    memset(&g_reference[address], 0xFF, bytes);
+    for (uint32_t i = 0U; i < bytes; i++)
+    {
+        g_buffer[i] = (uint8_t) rand();
+    }
+    g_flash.page_count = 0U;
+    g_program_events   = 0U;
+
+    ssp_err_t err = g_qspi_on_qspi.programAsync(&g_qspi_ctrl, TEST_FLASH + address, g_buffer, bytes);
+    memcpy(&g_reference[address], g_buffer, bytes);
+
+    return err;
+}
+
+/** Checks the pages of a complete program: each ends at a page boundary or at the end of the data. */
+static void test_qspi_program_check (uint32_t address, uint32_t bytes)
+{
+    uint32_t expected_pages = ((address + bytes - 1U) / TEST_PAGE_BYTES) - (address / TEST_PAGE_BYTES) + 1U;
+
+    HOST_TEST_CHECK_EQUAL(1U, g_program_events);
+    HOST_TEST_CHECK_EQUAL(0U, g_qspi_ctrl.async_state);
+    HOST_TEST_CHECK_EQUAL(expected_pages, g_flash.page_count);
+    HOST_TEST_CHECK_EQUAL(0U, g_flash.protocol_errors);
+
+    uint32_t next = address;
+    for (uint32_t i = 0U; (i < g_flash.page_count) && (i < TEST_MAX_PAGES); i++)
+    {
+        uint32_t end = (next & ~(TEST_PAGE_BYTES - 1U)) + TEST_PAGE_BYTES;
+        end = (end > (address + bytes)) ? (address + bytes) : end;
+        HOST_TEST_CHECK_EQUAL(next, g_flash.pages[i].address);
+        HOST_TEST_CHECK_EQUAL(end - next, g_flash.pages[i].bytes);
+        next = end;
+    }
+
+    HOST_TEST_CHECK(0 == memcmp(&TEST_FLASH[address], &g_reference[address], bytes));
+    HOST_TEST_CHECK_EQUAL(g_reference[address + bytes], TEST_FLASH[address + bytes]);
+}
+
+/** Programs split at page boundaries.  Without a poll timer, R_QSPI_StatusGet polls the flash and sends each page. */
+static void test_qspi_program_status_poll (void)
+{
+    static const uint32_t cases[][2] =
+    {
+        { 0x1000U, 1U },                           /* One byte */
+        { 0x1000U, TEST_PAGE_BYTES },              /* One whole page */
+        { 0x10FFU, 2U },                           /* Two bytes either side of a boundary */
+        { 0x2080U, TEST_PAGE_BYTES },              /* Half pages at both ends */
+        { 0x3001U, (5U * TEST_PAGE_BYTES) - 1U },  /* Ends on a boundary */
+        { 0x40FFU, (3U * TEST_PAGE_BYTES) + 2U },  /* One byte in the first page, one byte in the last */
+    };
+
+    for (uint32_t i = 0U; i < (sizeof(cases) / sizeof(cases[0])) + 30U; i++)
+    {
+        uint32_t address = 0U;
+        uint32_t bytes   = 0U;
+        if (i < (sizeof(cases) / sizeof(cases[0])))
+        {
+            address = cases[i][0];
+            bytes   = cases[i][1];
+        }
+        else
+        {
+            bytes   = 1U + ((uint32_t) rand() % (TEST_MAX_PAGES * TEST_PAGE_BYTES / 2U));
+            address = (uint32_t) rand() % (TEST_FLASH_BYTES - bytes - 8U);
+        }
+
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_qspi_program_start(address, bytes));
+
+        bool     busy  = true;
+        uint32_t polls = 0U;
+        while (busy && (polls < TEST_POLL_LIMIT))
+        {
+            HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_qspi_on_qspi.statusGet(&g_qspi_ctrl, &busy));
+            polls++;
+        }
+        HOST_TEST_CHECK(!busy);
+        test_qspi_program_check(address, bytes);
+    }
+}
+
+/** Other operations are refused until the program completes. */
+static void test_qspi_program_in_use (void)
+{
+    uint8_t data[4] = { 0U };
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_qspi_program_start(0x5000U, 600U));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_IN_USE, g_qspi_on_qspi.read(&g_qspi_ctrl, TEST_FLASH, data, sizeof(data)));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_IN_USE, g_qspi_on_qspi.pageProgram(&g_qspi_ctrl, TEST_FLASH, data, sizeof(data)));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_IN_USE, g_qspi_on_qspi.readAsync(&g_qspi_ctrl, TEST_FLASH, data, sizeof(data)));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_IN_USE, g_qspi_on_qspi.programAsync(&g_qspi_ctrl, TEST_FLASH, data, sizeof(data)));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_IN_USE, g_qspi_on_qspi.sectorErase(&g_qspi_ctrl, TEST_FLASH));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_IN_USE, g_qspi_on_qspi.erase(&g_qspi_ctrl, TEST_FLASH, 4096U));
+
+    bool busy = true;
+    while (busy)
+    {
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_qspi_on_qspi.statusGet(&g_qspi_ctrl, &busy));
+    }
+    test_qspi_program_check(0x5000U, 600U);
+
+    /** Closing in the middle of a program ends the bus cycle and leaves direct communication mode. */
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_qspi_program_start(0x6000U, 700U));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_qspi_on_qspi.close(&g_qspi_ctrl));
+    HOST_TEST_CHECK_EQUAL(0U, g_qspi_ctrl.async_state);
+    HOST_TEST_CHECK_EQUAL(0U, R_QSPI->SFMCMD_b.DCOM);
+    memcpy(&g_reference[0x6000U], &TEST_FLASH[0x6000U], 700U);
+}
+
+/** With a poll timer the pages are sent from the timer callback, and R_QSPI_StatusGet does not access the flash. */
+static void test_qspi_program_timer (void)
+{
+    g_qspi_ext.p_lower_lvl_timer = &g_timer;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_qspi_on_qspi.open(&g_qspi_ctrl, &g_qspi_cfg));
+    HOST_TEST_CHECK(g_timer_open);
+    HOST_TEST_CHECK(!g_timer_running);
+
+    uint32_t address = 0x40077U;
+    uint32_t bytes   = 5000U;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, test_qspi_program_start(address, bytes));
+    HOST_TEST_CHECK(g_timer_running);
+
+    bool     busy  = false;
+    uint32_t polls = g_flash.status_polls;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_qspi_on_qspi.statusGet(&g_qspi_ctrl, &busy));
+    HOST_TEST_CHECK(busy);
+    HOST_TEST_CHECK_EQUAL(polls, g_flash.status_polls);
+
+    for (uint32_t ticks = 0U; (0U == g_program_events) && (ticks < TEST_POLL_LIMIT); ticks++)
+    {
+        timer_callback_args_t args = { .p_context = gp_timer_context };
+        if (g_timer_running)
+        {
+            gp_timer_callback(&args);
+        }
+    }
+    test_qspi_program_check(address, bytes);
+    HOST_TEST_CHECK(!g_timer_running);
+    HOST_TEST_CHECK(0 == memcmp(TEST_FLASH, g_reference, TEST_FLASH_BYTES));
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_qspi_on_qspi.close(&g_qspi_ctrl));
+    HOST_TEST_CHECK(!g_timer_open);
+}
+
+int main (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimInit());
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimPeripheralRegister(&g_flash_peripheral));
+    bsp_qspi_init();
+
+    srand(2U);
+    for (uint32_t i = 0U; i < TEST_FLASH_BYTES; i++)
+    {
+        TEST_FLASH[i]  = (uint8_t) ((i * 13U) + (i >> 8));
+        g_reference[i] = TEST_FLASH[i];
+    }
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_qspi_on_qspi.open(&g_qspi_ctrl, &g_qspi_cfg));
+    HOST_TEST_CHECK_EQUAL(TEST_PAGE_BYTES, g_qspi_ctrl.page_size);
+    HOST_TEST_CHECK_EQUAL(TEST_FLASH_BYTES, g_qspi_ctrl.total_size_bytes);
+
+    test_qspi_read_async();
+    test_qspi_program_status_poll();
+    test_qspi_program_in_use();
+    test_qspi_program_timer();
+
+    return HOST_TEST_RESULT();
+}
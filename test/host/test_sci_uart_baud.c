@@ -0,0 +1,213 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : test_sci_uart_baud.c
+ * Description  : Exhaustive comparison of the pruned baud rate search in r_sci_uart.c with the search it replaced.
+ *                The driver source is compiled into this test so that its static functions can be called.
+ **********************************************************************************************************************/
+
+#include "../../synergy/ssp/src/driver/r_sci_uart/r_sci_uart.c"
+#include "host_test.h"
+
+/** Marks an output the search did not write. */
+#define TEST_BAUD_UNSET    (0xDEADBEEFU)
+
+/** Result of one search. */
+typedef struct st_test_baud_result
+{
+    int32_t                bit_err;
+    uint32_t               brr;
+    baud_setting_t const * p_setting;
+    uint32_t               mddr;
+} test_baud_result_t;
+
+/***********************************************************************************************************************
+ * The search from the original driver: every divisor and, with modulation, every BRR down to the one that makes MDDR
+ * drop below its minimum.
+ **********************************************************************************************************************/
+static int32_t test_baud_reference (uint32_t                freq_hz,
+                                    uint32_t                baudrate,
+                                    uint8_t               * p_brr_value,
+                                    baud_setting_t const ** pp_baud_setting,
+                                    uint32_t              * p_mddr,
+                                    bool                    select_16_base_clk_cycles)
+{
+    baud_setting_t const * p_baudinfo = &async_baud[0];
+    int32_t  hit_bit_err = SCI_UART_100_PERCENT_X_1000;
+    uint32_t hit_mddr = 0U;
+    uint32_t divisor = 0U;
+    for (uint32_t i = 0U; i < SCI_UART_NUM_DIVISORS_ASYNC; i++)
+    {
+        if ((!select_16_base_clk_cycles) ^ (p_baudinfo[i].abcs | p_baudinfo[i].abcse))
+        {
+            continue;
+        }
+
+        divisor = (uint32_t) p_baudinfo[i].div_coefficient * baudrate;
+        uint32_t temp_brr = freq_hz / divisor;
+
+        if (temp_brr <= (SCI_UART_BRR_MAX + 1U))
+        {
+            while (temp_brr > 0U)
+            {
+                temp_brr -= 1U;
+
+                int32_t err_divisor = (int32_t) (divisor * (temp_brr + 1U));
+                int32_t bit_err     = (int32_t) (((((int64_t) freq_hz) * SCI_UART_100_PERCENT_X_1000) /
+                                                  err_divisor) - SCI_UART_100_PERCENT_X_1000);
+
+                uint32_t mddr = 0U;
+                if (NULL != p_mddr)
+                {
+                    mddr = (uint32_t) err_divisor / (freq_hz / SCI_UART_MDDR_MAX);
+                    if (mddr < SCI_UART_MDDR_MIN)
+                    {
+                        break;
+                    }
+                    bit_err = (((bit_err + SCI_UART_100_PERCENT_X_1000) * (int32_t) mddr) /
+                               SCI_UART_MDDR_DIVISOR) - SCI_UART_100_PERCENT_X_1000;
+                }
+
+                if (bit_err < 0)
+                {
+                    bit_err = -bit_err;
+                }
+
+                if (bit_err < hit_bit_err)
+                {
+                    *pp_baud_setting = &p_baudinfo[i];
+                    *p_brr_value     = (uint8_t) temp_brr;
+                    hit_bit_err      = bit_err;
+                    hit_mddr         = mddr;
+                }
+                if (NULL == p_mddr)
+                {
+                    break;
+                }
+                else
+                {
+                    *p_mddr = hit_mddr;
+                }
+            }
+        }
+    }
+
+    return hit_bit_err;
+}
+
+/** Run a search with every output preset to TEST_BAUD_UNSET. */
+static test_baud_result_t test_baud_run (bool reference, uint32_t freq_hz, uint32_t baudrate, bool modulation,
+                                         bool select_16_base_clk_cycles)
+{
+    test_baud_result_t     result    = {0};
+    uint8_t                brr       = 0xA5U;
+    baud_setting_t const * p_setting = NULL;
+    uint32_t               mddr      = TEST_BAUD_UNSET;
+    uint32_t             * p_mddr    = modulation ? &mddr : NULL;
+
+    if (reference)
+    {
+        result.bit_err = test_baud_reference(freq_hz, baudrate, &brr, &p_setting, p_mddr, select_16_base_clk_cycles);
+    }
+    else
+    {
+        result.bit_err = r_sci_uart_brr_mddr_calculate(freq_hz, baudrate, &brr, &p_setting, p_mddr,
+                                                       select_16_base_clk_cycles);
+    }
+
+    /* The other outputs are only meaningful when a setting was found. */
+    if (result.bit_err < SCI_UART_100_PERCENT_X_1000)
+    {
+        result.brr       = brr;
+        result.p_setting = p_setting;
+        result.mddr      = mddr;
+    }
+
+    return result;
+}
+
+static uint32_t g_test_baud_cases;
+static uint32_t g_test_baud_mismatches;
+
+/** Compare both searches for one clock and baud rate, with and without modulation and 16 base clock cycles. */
+static void test_baud_check (uint32_t freq_hz, uint32_t baud)
+{
+    for (uint32_t mode = 0U; mode < 4U; mode++)
+    {
+        bool               modulation = (0U != (mode & 1U));
+        bool               base_16    = (0U != (mode & 2U));
+        test_baud_result_t expected   = test_baud_run(true, freq_hz, baud, modulation, base_16);
+        test_baud_result_t actual     = test_baud_run(false, freq_hz, baud, modulation, base_16);
+
+        g_test_baud_cases++;
+        if ((expected.bit_err != actual.bit_err) || (expected.brr != actual.brr) ||
+            (expected.p_setting != actual.p_setting) || (expected.mddr != actual.mddr))
+        {
+            if (g_test_baud_mismatches < 10U)
+            {
+                printf("%u Hz %u bps modulation %d base 16 %d: error %d/%d BRR %u/%u setting %d/%d MDDR %u/%u\n",
+                       (unsigned) freq_hz, (unsigned) baud, modulation, base_16, (int) expected.bit_err,
+                       (int) actual.bit_err, (unsigned) expected.brr, (unsigned) actual.brr,
+                       (NULL == expected.p_setting) ? -1 : (int) (expected.p_setting - async_baud),
+                       (NULL == actual.p_setting) ? -1 : (int) (actual.p_setting - async_baud),
+                       (unsigned) expected.mddr, (unsigned) actual.mddr);
+            }
+            g_test_baud_mismatches++;
+        }
+    }
+}
+
+int main (void)
+{
+    /* PCLKA settings of the S5D9 and frequencies that are not a multiple of 256 Hz. */
+    static const uint32_t frequencies[] =
+    {
+        120000000U, 100000000U, 96000000U, 80000000U, 64000000U, 60000000U, 50000000U, 48000000U, 40000000U,
+        32000000U, 30000000U, 25000000U, 24000000U, 20000000U, 16000000U, 15000000U, 12000000U, 8000000U,
+        7500000U, 4000000U, 3750000U, 2000000U, 1000000U, 32768U, 119999999U, 73728001U, 33333333U, 18432000U,
+        14745600U, 11059201U, 7372800U, 999983U,
+    };
+    /* Standard baud rates above the range swept one by one. */
+    static const uint32_t bauds[] =
+    {
+        28800U, 38400U, 56000U, 57600U, 76800U, 115200U, 128000U, 230400U, 250000U, 256000U, 460800U, 500000U,
+        921600U, 1000000U, 1500000U, 2000000U, 3000000U, 3750000U, 5000000U, 7500000U, 10000000U,
+    };
+
+    for (uint32_t f = 0U; f < (sizeof(frequencies) / sizeof(frequencies[0])); f++)
+    {
+        /* Every baud rate from 50 bps to 60000 bps, then steps of 1/64 up to 12 Mbps. */
+        for (uint32_t baud = 50U; baud < 12000000U; baud += (baud < 60000U) ? 1U : (baud / 64U))
+        {
+            test_baud_check(frequencies[f], baud);
+        }
+
+        for (uint32_t b = 0U; b < (sizeof(bauds) / sizeof(bauds[0])); b++)
+        {
+            test_baud_check(frequencies[f], bauds[b]);
+        }
+    }
+
+    printf("%u cases, %u mismatches\n", (unsigned) g_test_baud_cases, (unsigned) g_test_baud_mismatches);
+    HOST_TEST_CHECK(g_test_baud_cases > 0U);
+    HOST_TEST_CHECK_EQUAL(0U, g_test_baud_mismatches);
+
+    return HOST_TEST_RESULT();
+}
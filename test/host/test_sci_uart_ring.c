@@ -0,0 +1,241 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : test_sci_uart_ring.c
+ * Description  : Streams SCI0 reception into a ring through a DTC model: bursts of every length across many ring
+ *                wraps, the half/full/timeout events, an overrun that laps the reader, and abort.
+ **********************************************************************************************************************/
+
+#include <string.h>
+
+#include "bsp_api.h"
+#include "r_sci_uart.h"
+#include "r_dtc.h"
+#include "host_test.h"
+
+#define TEST_RING_BYTES    (64U)
+
+SSP_VECTOR_DEFINE_CHAN(sci_uart_rxi_isr, SCI, RXI, 0);
+SSP_VECTOR_DEFINE_CHAN(sci_uart_txi_isr, SCI, TXI, 0);
+SSP_VECTOR_DEFINE_CHAN(sci_uart_tei_isr, SCI, TEI, 0);
+SSP_VECTOR_DEFINE_CHAN(sci_uart_eri_isr, SCI, ERI, 0);
+
+static uint8_t                   g_ring[TEST_RING_BYTES];
+static transfer_info_t           g_rx_info;
+static dtc_instance_ctrl_t       g_rx_dtc_ctrl;
+static transfer_cfg_t            g_rx_dtc_cfg = { .p_info = &g_rx_info, .activation_source = ELC_EVENT_SCI0_RXI,
+                                                  .irq_ipl = BSP_IRQ_DISABLED };
+static transfer_instance_t       g_rx_dtc     = { .p_ctrl = &g_rx_dtc_ctrl, .p_cfg = &g_rx_dtc_cfg,
+                                                  .p_api = &g_transfer_on_dtc };
+static sci_uart_instance_ctrl_t  g_uart_ctrl;
+static uart_on_sci_cfg_t         g_uart_ext   = { .clk_src = SCI_CLK_SRC_INT,
+                                                  .rx_fifo_trigger = SCI_UART_RX_FIFO_TRIGGER_1,
+                                                  .baud_rate_error_x_1000 = 5000 };
+static uint32_t                  g_half_events;
+static uint32_t                  g_full_events;
+static uint32_t                  g_timeout_events;
+static uint32_t                  g_other_events;
+static uint32_t                  g_last_unread;
+
+static void test_uart_callback (uart_callback_args_t * p_args);
+
+static uart_cfg_t                g_uart_cfg   =
+{
+    .channel       = 0,
+    .baud_rate     = 921600,
+    .data_bits     = UART_DATA_BITS_8,
+    .parity        = UART_PARITY_OFF,
+    .stop_bits     = UART_STOP_BITS_1,
+    .p_callback    = test_uart_callback,
+    .p_extend      = &g_uart_ext,
+    .rxi_ipl       = 2,
+    .txi_ipl       = 2,
+    .tei_ipl       = 2,
+    .eri_ipl       = 2,
+    .p_transfer_rx = &g_rx_dtc,
+};
+
+/** DTC model for the receive transfer: one byte per RXI from RDR to the ring.  At the end of a normal mode transfer
+ *  the DTC clears DTCE and interrupts the CPU. */
+static bool test_dtc_model (elc_event_t event, void * p_context)
+{
+    SSP_PARAMETER_NOT_USED(p_context);
+
+    if (ELC_EVENT_SCI0_RXI != event)
+    {
+        return true;
+    }
+
+    HOST_TEST_CHECK(0U != g_rx_info.length);
+    *(uint8_t *) g_rx_info.p_dest = *(volatile uint8_t const *) g_rx_info.p_src;
+    g_rx_info.p_dest = (uint8_t *) g_rx_info.p_dest + 1;
+    g_rx_info.length--;
+    if (0U != g_rx_info.length)
+    {
+        return false;
+    }
+
+    for (uint32_t irq = 0U; irq < BSP_VECTOR_TABLE_MAX_ENTRIES; irq++)
+    {
+        if ((R_ICU->IELSRn[irq] & 0x1FFU) == (uint32_t) event)
+        {
+            R_ICU->IELSRn[irq] &= ~(1UL << 24);
+        }
+    }
+
+    return true;
+}
+
+static void test_uart_callback (uart_callback_args_t * p_args)
+{
+    g_last_unread = p_args->data;
+    switch (p_args->event)
+    {
+        case UART_EVENT_RX_RING_HALF:
+            g_half_events++;
+            break;
+
+        case UART_EVENT_RX_RING_FULL:
+            g_full_events++;
+            break;
+
+        case UART_EVENT_RX_TIMEOUT:
+            g_timeout_events++;
+            break;
+
+        default:
+            g_other_events++;
+            break;
+    }
+}
+
+/** Sends count bytes continuing the sequence from first. */
+static void test_uart_send (uint32_t first, uint32_t count)
+{
+    uint16_t data[TEST_RING_BYTES * 2U];
+    HOST_TEST_CHECK(count <= (sizeof(data) / sizeof(data[0])));
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        data[i] = (uint16_t) ((first + i) & 0xFFU);
+    }
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimSciReceive(0U, data, count));
+}
+
+/** Bursts of 1 to 2 rings less one byte, each read back after its receive timeout. */
+static void test_uart_ring_wrap (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_uart_on_sci.readStream(&g_uart_ctrl, g_ring, TEST_RING_BYTES));
+
+    uint32_t total = 0U;
+    for (uint32_t length = 1U; length < TEST_RING_BYTES; length++)
+    {
+        test_uart_send(total, length);
+        total += length;
+
+        /** Every burst ends with the line idle, which lands the held back data and reports the unread count. */
+        HOST_TEST_CHECK_EQUAL(length, g_timeout_events);
+        HOST_TEST_CHECK_EQUAL(length, g_last_unread);
+
+        uint8_t  out[TEST_RING_BYTES];
+        uint32_t count = 0U;
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_uart_on_sci.ringRead(&g_uart_ctrl, out, sizeof(out), &count));
+        HOST_TEST_CHECK_EQUAL(length, count);
+        for (uint32_t i = 0U; i < count; i++)
+        {
+            HOST_TEST_CHECK_EQUAL((total - length + i) & 0xFFU, out[i]);
+        }
+    }
+
+    /** One event for each half of the ring passed, the full event at every wrap. */
+    HOST_TEST_CHECK_EQUAL(total / TEST_RING_BYTES, g_full_events);
+    HOST_TEST_CHECK_EQUAL((total / (TEST_RING_BYTES / 2U)) - g_full_events, g_half_events);
+    HOST_TEST_CHECK_EQUAL(0U, g_other_events);
+
+    /** Reading an empty ring copies nothing. */
+    uint8_t  out[4];
+    uint32_t count = 1U;
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_uart_on_sci.ringRead(&g_uart_ctrl, out, sizeof(out), &count));
+    HOST_TEST_CHECK_EQUAL(0U, count);
+}
+
+/** A reader that is lapped gets SSP_ERR_OVERFLOW once and then continues with the data received after it. */
+static void test_uart_ring_overrun (void)
+{
+    uint8_t  out[TEST_RING_BYTES];
+    uint32_t count = 0U;
+
+    /** Partial reads leave the rest in the ring. */
+    test_uart_send(0U, 20U);
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_uart_on_sci.ringRead(&g_uart_ctrl, out, 8U, &count));
+    HOST_TEST_CHECK_EQUAL(8U, count);
+    HOST_TEST_CHECK_EQUAL(0U, out[0]);
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_uart_on_sci.ringRead(&g_uart_ctrl, out, sizeof(out), &count));
+    HOST_TEST_CHECK_EQUAL(12U, count);
+    HOST_TEST_CHECK_EQUAL(8U, out[0]);
+
+    /** Exactly one ring unread is still readable. */
+    test_uart_send(100U, TEST_RING_BYTES);
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_uart_on_sci.ringRead(&g_uart_ctrl, out, sizeof(out), &count));
+    HOST_TEST_CHECK_EQUAL(TEST_RING_BYTES, count);
+    HOST_TEST_CHECK_EQUAL(100U, out[0]);
+    HOST_TEST_CHECK_EQUAL(100U + TEST_RING_BYTES - 1U, out[TEST_RING_BYTES - 1U]);
+
+    /** One byte more laps the reader. */
+    test_uart_send(0U, 40U);
+    test_uart_send(40U, TEST_RING_BYTES - 39U);
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_OVERFLOW, g_uart_on_sci.ringRead(&g_uart_ctrl, out, sizeof(out), &count));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_uart_on_sci.ringRead(&g_uart_ctrl, out, sizeof(out), &count));
+    HOST_TEST_CHECK_EQUAL(0U, count);
+
+    test_uart_send(200U, 10U);
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_uart_on_sci.ringRead(&g_uart_ctrl, out, sizeof(out), &count));
+    HOST_TEST_CHECK_EQUAL(10U, count);
+    HOST_TEST_CHECK_EQUAL(200U, out[0]);
+    HOST_TEST_CHECK_EQUAL(209U, out[9]);
+}
+
+/** Aborting reception stops streaming. */
+static void test_uart_ring_abort (void)
+{
+    uint8_t  out[4];
+    uint32_t count = 0U;
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_uart_on_sci.communicationAbort(&g_uart_ctrl, UART_DIR_RX));
+    HOST_TEST_CHECK(NULL == g_uart_ctrl.p_rx_ring);
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_NOT_ENABLED, g_uart_on_sci.ringRead(&g_uart_ctrl, out, sizeof(out), &count));
+
+    /** A ring that is not a power of two is rejected. */
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_INVALID_ARGUMENT, g_uart_on_sci.readStream(&g_uart_ctrl, g_ring, 48U));
+}
+
+int main (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimInit());
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimDtcHookSet(test_dtc_model, NULL));
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_uart_on_sci.open(&g_uart_ctrl, &g_uart_cfg));
+
+    test_uart_ring_wrap();
+    test_uart_ring_overrun();
+    test_uart_ring_abort();
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_uart_on_sci.close(&g_uart_ctrl));
+
+    return HOST_TEST_RESULT();
+}
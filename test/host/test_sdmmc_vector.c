@@ -0,0 +1,700 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : test_sdmmc_vector.c
+ * Description  : Vectored reads and writes of R_SDMMC against a model of an SD card on SDHI0 with DMAC channel 1.
+ *                Checks where segment lists are split into commands, that buffers which are not word aligned are
+ *                staged through the control block in batches of SDMMC_CFG_UNALIGNED_BLOCKS sectors, and the data of
+ *                random segment lists against a reference image of the card.
+ **********************************************************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "bsp_api.h"
+#include "r_sdmmc.h"
+#include "r_dmac.h"
+#include "host_test.h"
+
+#define TEST_SECTOR_BYTES     (512U)
+#define TEST_SECTOR_WORDS     (TEST_SECTOR_BYTES / 4U)
+#define TEST_CARD_SECTORS     (2048U)
+#define TEST_BUFFER_SECTORS   (48U)
+#define TEST_MAX_COMMANDS     (16U)
+#define TEST_MAX_BLOCKS       (64U)
+#define TEST_RANDOM_LISTS     (300U)
+#define TEST_WAIT_STEPS       (200000U)
+#define TEST_R1_READY         (0x900U)
+
+#define TEST_CMD_READ_SINGLE  (17U)
+#define TEST_CMD_READ_MULTI   (18U)
+#define TEST_CMD_WRITE_SINGLE (24U)
+#define TEST_CMD_WRITE_MULTI  (25U)
+
+/* The response registers are read only to the driver. */
+#define TEST_RSP(reg)         (*(volatile uint32_t *) &R_SDHI0->reg)
+
+#define TEST_INFO1_RESPONSE_END (1UL << 0)
+#define TEST_INFO1_ACCESS_END   (1UL << 2)
+#define TEST_INFO2_NO_RESPONSE  (1UL << 6)
+#define TEST_INFO2_BUF_READ     (1UL << 8)
+#define TEST_INFO2_BUF_WRITE    (1UL << 9)
+
+/** Data command seen by the card. */
+typedef struct st_test_command
+{
+    uint32_t index;
+    uint32_t sector;
+    uint32_t count;
+} test_command_t;
+
+/** Card model.  One DMA request moves one sector through SD_BUF0. */
+typedef struct st_test_card
+{
+    uint32_t       info1;
+    uint32_t       info2;
+    bool           irq;
+    bool           reading;
+    bool           writing;
+    bool           ready;
+    bool           requested;
+    uint32_t       sector;
+    uint32_t       left;
+    uint32_t       word;
+    uint32_t       block[TEST_SECTOR_WORDS];
+    test_command_t commands[TEST_MAX_COMMANDS];
+    uint32_t       command_count;
+    uintptr_t      blocks[TEST_MAX_BLOCKS];     ///< Memory address of each sector moved by the DMAC
+    uint32_t       block_count;
+} test_card_t;
+
+SSP_VECTOR_DEFINE_CHAN(sdhimmc_accs_isr, SDHIMMC, ACCS, 0);
+SSP_VECTOR_DEFINE_CHAN(dmac_int_isr, DMAC, INT, 1);
+
+static test_card_t             g_card;
+static uint8_t                 g_card_data[TEST_CARD_SECTORS * TEST_SECTOR_BYTES];
+static uint8_t                 g_reference[TEST_CARD_SECTORS * TEST_SECTOR_BYTES];
+static uint8_t                 g_buffer[(TEST_BUFFER_SECTORS * TEST_SECTOR_BYTES) + 32U];
+static volatile uint32_t       g_complete_events;
+static volatile uint32_t       g_error_events;
+
+static transfer_info_t         g_dmac_info;
+static dmac_instance_ctrl_t    g_dmac_ctrl;
+static transfer_on_dmac_cfg_t  g_dmac_ext  = { .channel = 1U };
+static transfer_cfg_t          g_dmac_cfg  = { .p_info = &g_dmac_info, .irq_ipl = 3, .p_extend = &g_dmac_ext };
+static transfer_instance_t     g_dmac      = { .p_ctrl = &g_dmac_ctrl, .p_cfg = &g_dmac_cfg,
+                                               .p_api = &g_transfer_on_dmac };
+static sdmmc_instance_ctrl_t   g_sd_ctrl;
+
+static void test_sdmmc_callback (sdmmc_callback_args_t * p_args);
+
+static sdmmc_cfg_t             g_sd_cfg    =
+{
+    .hw                   =
+    {
+        .channel    = 0U,
+        .media_type = SDMMC_MEDIA_TYPE_CARD,
+        .bus_width  = SDMMC_BUS_WIDTH_4_BITS,
+    },
+    .p_lower_lvl_transfer = &g_dmac,
+    .p_callback           = test_sdmmc_callback,
+    .access_ipl           = 2,
+    .sdio_ipl             = BSP_IRQ_DISABLED,
+    .card_ipl             = BSP_IRQ_DISABLED,
+    .dma_req_ipl          = BSP_IRQ_DISABLED,
+};
+
+static void test_sdmmc_callback (sdmmc_callback_args_t * p_args)
+{
+    if (SDMMC_EVENT_TRANSFER_COMPLETE == p_args->event)
+    {
+        g_complete_events++;
+    }
+    else if (SDMMC_EVENT_TRANSFER_ERROR == p_args->event)
+    {
+        g_error_events++;
+    }
+    else
+    {
+        /* Card events are not used. */
+    }
+}
+
+/** Publishes the status flags and raises the access interrupt on a rising level. */
+static void test_card_update (void)
+{
+    R_SDHI0->SD_INFO1 = g_card.info1;
+    R_SDHI0->SD_INFO2 = g_card.info2 | (1UL << 13) | (1UL << 7);
+
+    uint32_t info1 = g_card.info1 & ~R_SDHI0->SD_INFO1_MASK & (TEST_INFO1_RESPONSE_END | TEST_INFO1_ACCESS_END);
+    uint32_t info2 = g_card.info2 & ~R_SDHI0->SD_INFO2_MASK & 0x837FU;
+    bool     level = (0U != (info1 | info2));
+    if (level && (!g_card.irq))
+    {
+        (void) R_BSP_SimEventRaise(ELC_EVENT_SDHIMMC0_ACCS);
+    }
+    g_card.irq = level;
+}
+
+/** Makes the next sector of a data command available in SD_BUF0. */
+static void test_card_block_start (void)
+{
+    if (g_card.reading)
+    {
+        memcpy(g_card.block, &g_card_data[g_card.sector * TEST_SECTOR_BYTES], TEST_SECTOR_BYTES);
+        g_card.info2 |= TEST_INFO2_BUF_READ;
+    }
+    else
+    {
+        g_card.info2 |= TEST_INFO2_BUF_WRITE;
+    }
+    g_card.word      = 0U;
+    g_card.ready     = true;
+    g_card.requested = false;
+}
+
+/** Ends the sector in SD_BUF0.  Access end follows the last sector of the command. */
+static void test_card_block_end (void)
+{
+    if (g_card.writing)
+    {
+        memcpy(&g_card_data[g_card.sector * TEST_SECTOR_BYTES], g_card.block, TEST_SECTOR_BYTES);
+    }
+    g_card.ready  = false;
+    g_card.info2 &= ~(TEST_INFO2_BUF_READ | TEST_INFO2_BUF_WRITE);
+    g_card.sector++;
+    g_card.left--;
+    if (0U == g_card.left)
+    {
+        g_card.reading = false;
+        g_card.writing = false;
+        g_card.info1  |= TEST_INFO1_ACCESS_END;
+    }
+    else
+    {
+        test_card_block_start();
+    }
+
+    test_card_update();
+}
+
+/** Fills in the CSD of a high capacity card of TEST_CARD_SECTORS sectors. */
+static void test_card_csd (uint32_t * p_csd)
+{
+    memset(p_csd, 0, 16U);
+    p_csd[118U / 32U] |= 1UL << (118U % 32U);                      /* CSD_STRUCTURE 1 */
+    p_csd[40U / 32U]  |= ((TEST_CARD_SECTORS / 1024U) - 1U) << (40U % 32U); /* C_SIZE */
+    p_csd[72U / 32U]  |= 9UL << (72U % 32U);                       /* READ_BL_LEN */
+    p_csd[76U / 32U]  |= 0x1B5UL << (76U % 32U);                   /* CCC */
+}
+
+/** Executes the command written to SD_CMD. */
+static void test_card_command (uint32_t command)
+{
+    uint32_t index = command & 0x3FU;
+    bool     acmd  = (1U == ((command >> 6) & 3U));
+    uint32_t arg   = (R_SDHI0->SD_ARG & 0xFFFFU) | (R_SDHI0->SD_ARG1 << 16);
+
+    if (acmd && (41U == index))
+    {
+        TEST_RSP(SD_RSP10) = 0xC0FF8000U;                            /* Ready, high capacity */
+    }
+    else if (acmd)
+    {
+        TEST_RSP(SD_RSP10) = TEST_R1_READY;
+    }
+    else
+    {
+        switch (index)
+        {
+            case 0U:
+                break;
+
+            case 8U:
+                TEST_RSP(SD_RSP10) = arg;
+                break;
+
+            case 55U:
+                TEST_RSP(SD_RSP10) = TEST_R1_READY | 0x20U;
+                break;
+
+            case 2U:
+                TEST_RSP(SD_RSP10) = 1U;
+                TEST_RSP(SD_RSP32) = 2U;
+                TEST_RSP(SD_RSP54) = 3U;
+                TEST_RSP(SD_RSP76) = 4U;
+                break;
+
+            case 3U:
+                TEST_RSP(SD_RSP10) = 0x1234UL << 16;
+                break;
+
+            case 9U:
+            {
+                uint32_t csd[4];
+                test_card_csd(csd);
+                TEST_RSP(SD_RSP10) = csd[0];
+                TEST_RSP(SD_RSP32) = csd[1];
+                TEST_RSP(SD_RSP54) = csd[2];
+                TEST_RSP(SD_RSP76) = csd[3];
+                break;
+            }
+
+            case 7U:
+            case 16U:
+                TEST_RSP(SD_RSP10) = TEST_R1_READY;
+                break;
+
+            case TEST_CMD_READ_SINGLE:
+            case TEST_CMD_READ_MULTI:
+            case TEST_CMD_WRITE_SINGLE:
+            case TEST_CMD_WRITE_MULTI:
+            {
+                bool multi   = (TEST_CMD_READ_MULTI == index) || (TEST_CMD_WRITE_MULTI == index);
+                g_card.left = 1U;
+                if (multi)
+                {
+                    /* Only multiple block commands with a sector count are used. */
+                    HOST_TEST_CHECK(0U != (R_SDHI0->SD_STOP & 0x100U));
+                    g_card.left = R_SDHI0->SD_SECCNT;
+                }
+                HOST_TEST_CHECK((arg + g_card.left) <= TEST_CARD_SECTORS);
+                if (g_card.command_count < TEST_MAX_COMMANDS)
+                {
+                    g_card.commands[g_card.command_count] = (test_command_t) { index, arg, g_card.left };
+                }
+                g_card.command_count++;
+
+                g_card.sector     = arg;
+                g_card.reading    = (index < TEST_CMD_WRITE_SINGLE);
+                g_card.writing    = !g_card.reading;
+                TEST_RSP(SD_RSP10) = TEST_R1_READY;
+                TEST_RSP(SD_RSP54) = TEST_R1_READY;
+                test_card_block_start();
+                break;
+            }
+
+            default:
+                /* SDIO and MMC commands get no response. */
+                g_card.info2 |= TEST_INFO2_NO_RESPONSE;
+                test_card_update();
+                return;
+        }
+    }
+
+    g_card.info1 |= TEST_INFO1_RESPONSE_END;
+    test_card_update();
+}
+
+/** Records the memory address of a sector when the DMAC moves its first word.  The DMAC registers are accessible
+ *  because the access comes from the DMAC model. */
+static void test_card_block_log (uintptr_t address)
+{
+    if (0U != g_card.word)
+    {
+        return;
+    }
+
+    if (g_card.block_count < TEST_MAX_BLOCKS)
+    {
+        g_card.blocks[g_card.block_count] = address;
+    }
+    g_card.block_count++;
+}
+
+static void test_card_hook (bsp_sim_peripheral_t * const p_peripheral, bsp_sim_hook_event_t event)
+{
+    uintptr_t address = p_peripheral->address;
+
+    switch (event)
+    {
+        case BSP_SIM_HOOK_EVENT_RESET:
+            memset(&g_card, 0, sizeof(g_card));
+            R_SDHI0->SD_INFO1_MASK = 0x31DU;
+            R_SDHI0->SD_INFO2_MASK = 0x8B7FU;
+            test_card_update();
+            break;
+
+        case BSP_SIM_HOOK_EVENT_STEP:
+            /** The last word of a sector read by the DMAC frees SD_BUF0 for the next sector. */
+            if (g_card.reading && g_card.ready && (TEST_SECTOR_WORDS == g_card.word))
+            {
+                test_card_block_end();
+            }
+
+            /** A sector in SD_BUF0 requests the DMAC while DMA mode is enabled. */
+            if ((g_card.reading || g_card.writing) && g_card.ready && (!g_card.requested) &&
+                (0U != (R_SDHI0->SD_DMAEN & 2U)))
+            {
+                g_card.requested = true;
+                (void) R_BSP_SimEventRaise(ELC_EVENT_SDHIMMC0_DMA_REQ);
+            }
+
+            if (g_card.irq)
+            {
+                (void) R_BSP_SimEventRaise(ELC_EVENT_SDHIMMC0_ACCS);
+            }
+            break;
+
+        case BSP_SIM_HOOK_EVENT_READ:
+            if ((address == (uintptr_t) &R_SDHI0->SD_BUF0) && g_card.reading && g_card.ready &&
+                (g_card.word < TEST_SECTOR_WORDS))
+            {
+                test_card_block_log(R_DMAC1->DMDAR);
+                R_SDHI0->SD_BUF0 = g_card.block[g_card.word++];
+            }
+            break;
+
+        default: /* BSP_SIM_HOOK_EVENT_WRITE */
+            if (address == (uintptr_t) &R_SDHI0->SD_CMD)
+            {
+                test_card_command(R_SDHI0->SD_CMD);
+            }
+            else if (address == (uintptr_t) &R_SDHI0->SD_INFO1)
+            {
+                g_card.info1 &= R_SDHI0->SD_INFO1;
+                test_card_update();
+            }
+            else if (address == (uintptr_t) &R_SDHI0->SD_INFO2)
+            {
+                g_card.info2 &= R_SDHI0->SD_INFO2;
+                test_card_update();
+            }
+            else if ((address == (uintptr_t) &R_SDHI0->SD_INFO1_MASK) ||
+                     (address == (uintptr_t) &R_SDHI0->SD_INFO2_MASK))
+            {
+                test_card_update();
+            }
+            else if ((address == (uintptr_t) &R_SDHI0->SD_BUF0) && g_card.writing && g_card.ready)
+            {
+                test_card_block_log(R_DMAC1->DMSAR);
+                g_card.block[g_card.word++] = R_SDHI0->SD_BUF0;
+                if (TEST_SECTOR_WORDS == g_card.word)
+                {
+                    test_card_block_end();
+                }
+            }
+            else
+            {
+                test_card_update();
+            }
+            break;
+    }
+}
+
+static bsp_sim_peripheral_t g_card_peripheral =
+{
+    .p_name = "SDHI0",
+    .base   = R_SDHI0_BASE,
+    .size   = 0x100U,
+    .p_hook = test_card_hook,
+    .trap   = BSP_SIM_TRAP_ACCESS,
+};
+
+/** Runs the simulation until the transfer completes.  Returns true for exactly one completion and no error. */
+static bool test_wait (void)
+{
+    for (uint32_t i = 0U; (i < TEST_WAIT_STEPS) && (0U == g_complete_events) && (0U == g_error_events); i++)
+    {
+        R_BSP_SimStep();
+    }
+
+    bool complete = (1U == g_complete_events) && (0U == g_error_events);
+    g_complete_events = 0U;
+    g_error_events    = 0U;
+
+    return complete;
+}
+
+/** Clears the command and block logs of the card model. */
+static void test_log_clear (void)
+{
+    g_card.command_count = 0U;
+    g_card.block_count   = 0U;
+}
+
+/** Checks one command of the log and the addresses of its sectors.  A buffer that is not word aligned is moved through
+ *  the aligned buffer of the control block, which holds SDMMC_CFG_UNALIGNED_BLOCKS sectors. */
+static void test_command_check (uint32_t command, uint32_t * p_block, bool write, uint32_t sector, uint32_t count,
+                                uint8_t const * p_data)
+{
+    uint32_t index = write ? TEST_CMD_WRITE_MULTI : TEST_CMD_READ_MULTI;
+    if (1U == count)
+    {
+        index = write ? TEST_CMD_WRITE_SINGLE : TEST_CMD_READ_SINGLE;
+    }
+
+    HOST_TEST_CHECK(command < g_card.command_count);
+    HOST_TEST_CHECK_EQUAL(index, g_card.commands[command].index);
+    HOST_TEST_CHECK_EQUAL(sector, g_card.commands[command].sector);
+    HOST_TEST_CHECK_EQUAL(count, g_card.commands[command].count);
+
+    uintptr_t staging = (uintptr_t) &g_sd_ctrl.aligned_buff[0];
+    bool      staged  = (0U != ((uintptr_t) p_data & 3U));
+    for (uint32_t i = 0U; (i < count) && (*p_block < TEST_MAX_BLOCKS); i++)
+    {
+        uintptr_t expected = (uintptr_t) p_data + (i * TEST_SECTOR_BYTES);
+        if (staged)
+        {
+            expected = staging + ((i % SDMMC_CFG_UNALIGNED_BLOCKS) * TEST_SECTOR_BYTES);
+        }
+        HOST_TEST_CHECK_EQUAL(expected, g_card.blocks[*p_block]);
+        (*p_block)++;
+    }
+}
+
+/** Transfers a segment list and checks the data against the reference image. */
+static void test_vector_run (sdmmc_segment_t const * p_segments, uint32_t segment_count, bool write)
+{
+    if (write)
+    {
+        for (uint32_t i = 0U; i < sizeof(g_buffer); i++)
+        {
+            g_buffer[i] = (uint8_t) rand();
+        }
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sdmmc_on_sdmmc.writeV(&g_sd_ctrl, p_segments, segment_count));
+    }
+    else
+    {
+        memset(g_buffer, 0xEE, sizeof(g_buffer));
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sdmmc_on_sdmmc.readV(&g_sd_ctrl, p_segments, segment_count));
+    }
+    HOST_TEST_CHECK(test_wait());
+
+    for (uint32_t i = 0U; i < segment_count; i++)
+    {
+        uint8_t * p_card = &g_reference[p_segments[i].sector * TEST_SECTOR_BYTES];
+        if (write)
+        {
+            memcpy(p_card, p_segments[i].p_buffer, p_segments[i].count * TEST_SECTOR_BYTES);
+        }
+        else
+        {
+            HOST_TEST_CHECK(0 == memcmp(p_segments[i].p_buffer, p_card, p_segments[i].count * TEST_SECTOR_BYTES));
+        }
+    }
+    HOST_TEST_CHECK(0 == memcmp(g_card_data, g_reference, sizeof(g_reference)));
+}
+
+/** Single reads and writes at every buffer alignment, across batches of the aligned buffer. */
+static void test_sdmmc_alignment (void)
+{
+    for (uint32_t offset = 0U; offset < 4U; offset++)
+    {
+        for (uint32_t count = 1U; count <= ((2U * SDMMC_CFG_UNALIGNED_BLOCKS) + 1U); count++)
+        {
+            uint32_t sector = 100U + (offset * 16U) + count;
+
+            for (uint32_t write = 0U; write < 2U; write++)
+            {
+                test_log_clear();
+                if (write)
+                {
+                    memset(g_buffer, (int) (offset + count), sizeof(g_buffer));
+                    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sdmmc_on_sdmmc.write(&g_sd_ctrl, &g_buffer[offset], sector,
+                                                                             count));
+                    memcpy(&g_reference[sector * TEST_SECTOR_BYTES], &g_buffer[offset], count * TEST_SECTOR_BYTES);
+                }
+                else
+                {
+                    memset(g_buffer, 0xEE, sizeof(g_buffer));
+                    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sdmmc_on_sdmmc.read(&g_sd_ctrl, &g_buffer[offset], sector,
+                                                                            count));
+                }
+                HOST_TEST_CHECK(test_wait());
+                HOST_TEST_CHECK(0 == memcmp(&g_buffer[offset], &g_reference[sector * TEST_SECTOR_BYTES],
+                                            count * TEST_SECTOR_BYTES));
+
+                /** Bytes next to the buffer are not touched. */
+                if (!write)
+                {
+                    HOST_TEST_CHECK_EQUAL(0xEEU, g_buffer[offset + (count * TEST_SECTOR_BYTES)]);
+                    if (offset > 0U)
+                    {
+                        HOST_TEST_CHECK_EQUAL(0xEEU, g_buffer[offset - 1U]);
+                    }
+                }
+
+                uint32_t block = 0U;
+                HOST_TEST_CHECK_EQUAL(1U, g_card.command_count);
+                HOST_TEST_CHECK_EQUAL(count, g_card.block_count);
+                test_command_check(0U, &block, (0U != write), sector, count, &g_buffer[offset]);
+            }
+        }
+    }
+}
+
+/** Segment lists with known split points. */
+static void test_sdmmc_split_points (void)
+{
+    uint8_t * p_aligned = &g_buffer[0];
+    uint8_t * p_odd     = &g_buffer[1];
+
+    for (uint32_t write = 0U; write < 2U; write++)
+    {
+        bool     wr    = (0U != write);
+        uint32_t block = 0U;
+
+        /** Segments that continue each other on the card and in memory are merged into one command. */
+        sdmmc_segment_t merged[3] =
+        {
+            { 200U, p_aligned,                            2U },
+            { 202U, p_aligned + (2U * TEST_SECTOR_BYTES), 3U },
+            { 205U, p_aligned + (5U * TEST_SECTOR_BYTES), 1U },
+        };
+        test_log_clear();
+        test_vector_run(merged, 3U, wr);
+        HOST_TEST_CHECK_EQUAL(1U, g_card.command_count);
+        test_command_check(0U, &block, wr, 200U, 6U, p_aligned);
+
+        /** The same merge applies to a buffer that is not word aligned, which is staged across the merged segments. */
+        sdmmc_segment_t merged_odd[2] =
+        {
+            { 300U, p_odd,                            3U },
+            { 303U, p_odd + (3U * TEST_SECTOR_BYTES), 3U },
+        };
+        block = 0U;
+        test_log_clear();
+        test_vector_run(merged_odd, 2U, wr);
+        HOST_TEST_CHECK_EQUAL(1U, g_card.command_count);
+        test_command_check(0U, &block, wr, 300U, 6U, p_odd);
+
+        /** A gap on the card or in memory ends the command.  Each command is staged or not on its own. */
+        sdmmc_segment_t split[4] =
+        {
+            { 400U, p_aligned,                             2U },
+            { 402U, p_aligned + (3U * TEST_SECTOR_BYTES),  1U },          /* Gap in memory */
+            { 410U, p_aligned + (4U * TEST_SECTOR_BYTES),  1U },          /* Gap on the card */
+            { 411U, p_odd + (5U * TEST_SECTOR_BYTES),      5U },          /* Memory continues 1 byte late */
+        };
+        block = 0U;
+        test_log_clear();
+        test_vector_run(split, 4U, wr);
+        HOST_TEST_CHECK_EQUAL(4U, g_card.command_count);
+        HOST_TEST_CHECK_EQUAL(9U, g_card.block_count);
+        for (uint32_t i = 0U; i < 4U; i++)
+        {
+            test_command_check(i, &block, wr, split[i].sector, split[i].count, split[i].p_buffer);
+        }
+
+        /** Going back on the card is never merged, even when memory continues. */
+        sdmmc_segment_t backwards[2] =
+        {
+            { 501U, p_aligned,                     1U },
+            { 500U, p_aligned + TEST_SECTOR_BYTES, 1U },
+        };
+        block = 0U;
+        test_log_clear();
+        test_vector_run(backwards, 2U, wr);
+        HOST_TEST_CHECK_EQUAL(2U, g_card.command_count);
+        test_command_check(0U, &block, wr, 501U, 1U, backwards[0].p_buffer);
+        test_command_check(1U, &block, wr, 500U, 1U, backwards[1].p_buffer);
+    }
+}
+
+/** Random segment lists.  The commands expected are derived from the list with the merge rule. */
+static void test_sdmmc_random (void)
+{
+    srand(1U);
+    for (uint32_t run = 0U; run < TEST_RANDOM_LISTS; run++)
+    {
+        sdmmc_segment_t segments[8];
+        uint32_t        segment_count = 1U + ((uint32_t) rand() % 8U);
+        uint32_t        position      = 0U;
+        uint32_t        sector        = (uint32_t) rand() % (TEST_CARD_SECTORS - 200U);
+
+        for (uint32_t i = 0U; i < segment_count; i++)
+        {
+            uint32_t count = 1U + ((uint32_t) rand() % 6U);
+            if ((0U == i) || (0U != ((uint32_t) rand() % 3U)))
+            {
+                sector   += (uint32_t) rand() % 5U;
+                position += (uint32_t) rand() % 4U;
+            }
+            if ((position + (count * TEST_SECTOR_BYTES)) > sizeof(g_buffer))
+            {
+                segment_count = i;
+                break;
+            }
+            segments[i] = (sdmmc_segment_t) { sector, &g_buffer[position], count };
+            position   += count * TEST_SECTOR_BYTES;
+            sector     += count;
+        }
+
+        bool write = (0U != ((uint32_t) rand() & 1U));
+        test_log_clear();
+        test_vector_run(segments, segment_count, write);
+
+        uint32_t command = 0U;
+        uint32_t block   = 0U;
+        for (uint32_t first = 0U; first < segment_count; command++)
+        {
+            uint32_t count = segments[first].count;
+            uint32_t next  = first + 1U;
+            while ((next < segment_count) && (segments[next].sector == (segments[first].sector + count)) &&
+                   (segments[next].p_buffer == (segments[first].p_buffer + (count * TEST_SECTOR_BYTES))))
+            {
+                count += segments[next].count;
+                next++;
+            }
+            test_command_check(command, &block, write, segments[first].sector, count, segments[first].p_buffer);
+            first = next;
+        }
+        HOST_TEST_CHECK_EQUAL(command, g_card.command_count);
+        HOST_TEST_CHECK_EQUAL(block, g_card.block_count);
+    }
+}
+
+/** Lists the driver rejects. */
+static void test_sdmmc_invalid (void)
+{
+    sdmmc_segment_t empty = { 10U, g_buffer, 0U };
+    sdmmc_segment_t none  = { 10U, NULL, 1U };
+
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_ASSERTION, g_sdmmc_on_sdmmc.readV(&g_sd_ctrl, &empty, 1U));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_ASSERTION, g_sdmmc_on_sdmmc.writeV(&g_sd_ctrl, &none, 1U));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_ASSERTION, g_sdmmc_on_sdmmc.readV(&g_sd_ctrl, &empty, 0U));
+    HOST_TEST_CHECK_EQUAL(SSP_ERR_ASSERTION, g_sdmmc_on_sdmmc.readV(&g_sd_ctrl, NULL, 1U));
+}
+
+int main (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimInit());
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimPeripheralRegister(&g_card_peripheral));
+
+    for (uint32_t i = 0U; i < sizeof(g_card_data); i++)
+    {
+        g_card_data[i] = (uint8_t) ((i * 7U) + (i >> 9));
+    }
+    memcpy(g_reference, g_card_data, sizeof(g_reference));
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sdmmc_on_sdmmc.open(&g_sd_ctrl, &g_sd_cfg));
+    HOST_TEST_CHECK_EQUAL(TEST_CARD_SECTORS, g_sd_ctrl.status.sector_count);
+    HOST_TEST_CHECK_EQUAL(TEST_SECTOR_BYTES, g_sd_ctrl.status.sector_size);
+
+    test_sdmmc_alignment();
+    test_sdmmc_split_points();
+    test_sdmmc_random();
+    test_sdmmc_invalid();
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, g_sdmmc_on_sdmmc.close(&g_sd_ctrl));
+
+    return HOST_TEST_RESULT();
+}
@@ -0,0 +1,396 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : test_ssi_stream.c
+ * Description  : Full duplex period ring streaming of R_SSI against a model of the SSI FIFOs and the DTC, one step
+ *                per FIFO word (10.4 us for 32-bit stereo at 48 kHz). Checks that the stream is gap free when the
+ *                period interrupts are serviced within the FIFO depth, measures that margin, and checks that a late
+ *                application is muted and counted without losing the stream timing.
+ *                The driver source is compiled into this test so that its interrupt handling can be called.
+ **********************************************************************************************************************/
+
+#include "../../synergy/ssp/src/driver/r_ssi/r_ssi.c"
+#include "host_test.h"
+
+#include <string.h>
+
+#define TEST_SSI_FIFO_STAGES     (8U)
+#define TEST_SSI_PERIOD_WORDS    (64U)
+#define TEST_SSI_PERIODS         (4U)
+#define TEST_SSI_EVENTS          (64U)
+#define TEST_SSI_NO_ISR          (UINT32_MAX)
+
+/** Word FIFO of the model. */
+typedef struct st_test_ssi_fifo
+{
+    uint32_t words[TEST_SSI_FIFO_STAGES + 1U];
+    uint32_t head;
+    uint32_t count;
+} test_ssi_fifo_t;
+
+/** Timing of one run, in FIFO words. */
+typedef struct st_test_ssi_timing
+{
+    uint32_t isr_latency;          ///< From the end of a period transfer to its interrupt
+    uint32_t app_delay;            ///< From a period event to the application returning the period
+    uint32_t late_from;            ///< First step of a stretch where the application is late, or 0
+    uint32_t late_delay;           ///< Application delay during that stretch
+    uint32_t steps;
+} test_ssi_timing_t;
+
+/** Results of one run. */
+typedef struct st_test_ssi_result
+{
+    uint32_t fifo_underflows;      ///< Words the SSI shifted out of an empty transmit FIFO
+    uint32_t fifo_overflows;       ///< Words the SSI shifted into a full receive FIFO
+    uint32_t muted_words;          ///< Words shifted out while muted
+    uint32_t wire_order_errors;    ///< Transmitted words out of sequence
+    uint32_t rx_order_errors;      ///< Received words out of sequence
+    uint32_t tx_periods;
+    uint32_t rx_periods;
+    i2s_info_t info;
+} test_ssi_result_t;
+
+/** Period event waiting for the application. */
+typedef struct st_test_ssi_event
+{
+    i2s_event_t event;
+    uint32_t    period;
+    uint32_t    step;
+} test_ssi_event_t;
+
+static uint32_t               g_tx_ring[TEST_SSI_PERIODS * TEST_SSI_PERIOD_WORDS];
+static uint32_t               g_rx_ring[TEST_SSI_PERIODS * TEST_SSI_PERIOD_WORDS];
+static R_SSI0_Type            g_ssi_reg;
+static ssi_instance_ctrl_t    g_ssi_ctrl;
+static test_ssi_fifo_t        g_tx_fifo;
+static test_ssi_fifo_t        g_rx_fifo;
+static test_ssi_event_t       g_events[TEST_SSI_EVENTS];
+static uint32_t               g_event_head;
+static uint32_t               g_event_count;
+static uint32_t               g_step;
+static uint32_t               g_tx_sequence;       ///< Last word written by the application
+static uint32_t               g_wire_sequence;     ///< Last unmuted word on the wire
+static uint32_t               g_rx_sequence;       ///< Last word read by the application
+static test_ssi_result_t      g_result;
+
+/** DTC descriptors of the model: reset points them at a period, each FIFO request moves one word. */
+static transfer_info_t        g_tx_info;
+static transfer_info_t        g_rx_info;
+static transfer_cfg_t         g_tx_cfg = { .p_info = &g_tx_info };
+static transfer_cfg_t         g_rx_cfg = { .p_info = &g_rx_info };
+
+static ssp_err_t test_ssi_transfer_reset (transfer_ctrl_t * const p_ctrl, void const * volatile p_src,
+                                          void * volatile p_dest, uint16_t const num_transfers)
+{
+    transfer_info_t * p_info = (transfer_info_t *) p_ctrl;
+    if (NULL != p_src)
+    {
+        p_info->p_src = p_src;
+    }
+    if (NULL != p_dest)
+    {
+        p_info->p_dest = p_dest;
+    }
+    p_info->length = num_transfers;
+
+    return SSP_SUCCESS;
+}
+
+static const transfer_api_t   g_test_transfer = { .reset = test_ssi_transfer_reset };
+static transfer_instance_t    g_tx_transfer   = { .p_ctrl = &g_tx_info, .p_cfg = &g_tx_cfg,
+                                                  .p_api = &g_test_transfer };
+static transfer_instance_t    g_rx_transfer   = { .p_ctrl = &g_rx_info, .p_cfg = &g_rx_cfg,
+                                                  .p_api = &g_test_transfer };
+
+static void test_ssi_fifo_push (test_ssi_fifo_t * p_fifo, uint32_t word)
+{
+    p_fifo->words[(p_fifo->head + p_fifo->count) % (TEST_SSI_FIFO_STAGES + 1U)] = word;
+    p_fifo->count++;
+}
+
+static uint32_t test_ssi_fifo_pop (test_ssi_fifo_t * p_fifo)
+{
+    uint32_t word = p_fifo->words[p_fifo->head];
+    p_fifo->head = (p_fifo->head + 1U) % (TEST_SSI_FIFO_STAGES + 1U);
+    p_fifo->count--;
+
+    return word;
+}
+
+/** Queues period events for the application, which handles them after its delay. */
+static void test_ssi_callback (i2s_callback_args_t * p_args)
+{
+    HOST_TEST_CHECK(g_event_count < TEST_SSI_EVENTS);
+    test_ssi_event_t * p_event = &g_events[(g_event_head + g_event_count) % TEST_SSI_EVENTS];
+    p_event->event  = p_args->event;
+    p_event->period = p_args->period;
+    p_event->step   = g_step;
+    g_event_count++;
+}
+
+/** Application: refills transmit periods with the next words of a sequence and checks that received periods carry
+ *  the sequence looped back from the wire. */
+static void test_ssi_application (uint32_t delay)
+{
+    while ((0U != g_event_count) && ((g_step - g_events[g_event_head].step) >= delay))
+    {
+        test_ssi_event_t * p_event = &g_events[g_event_head];
+        uint32_t         * p_words;
+        i2s_dir_t          dir;
+
+        if (I2S_EVENT_TX_PERIOD_DONE == p_event->event)
+        {
+            p_words = &g_tx_ring[p_event->period * TEST_SSI_PERIOD_WORDS];
+            for (uint32_t i = 0U; i < TEST_SSI_PERIOD_WORDS; i++)
+            {
+                p_words[i] = ++g_tx_sequence;
+            }
+            g_result.tx_periods++;
+            dir = I2S_DIR_TX;
+        }
+        else
+        {
+            p_words = &g_rx_ring[p_event->period * TEST_SSI_PERIOD_WORDS];
+            for (uint32_t i = 0U; i < TEST_SSI_PERIOD_WORDS; i++)
+            {
+                /* Muted words are 0, unmuted words continue the sequence */
+                if (0U != p_words[i])
+                {
+                    g_result.rx_order_errors += (p_words[i] <= g_rx_sequence) ? 1U : 0U;
+                    g_rx_sequence = p_words[i];
+                }
+            }
+            g_result.rx_periods++;
+            dir = I2S_DIR_RX;
+        }
+
+        HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_SSI_StreamAck(&g_ssi_ctrl, dir, 1U));
+        g_event_head = (g_event_head + 1U) % TEST_SSI_EVENTS;
+        g_event_count--;
+    }
+}
+
+/** Runs the stream for a number of FIFO words with the given timing. */
+static void test_ssi_run (test_ssi_timing_t const * p_timing)
+{
+    uint32_t tx_isr = TEST_SSI_NO_ISR;
+    uint32_t rx_isr = TEST_SSI_NO_ISR;
+
+    memset(&g_ssi_reg, 0, sizeof(g_ssi_reg));
+    memset(&g_ssi_ctrl, 0, sizeof(g_ssi_ctrl));
+    memset(&g_tx_fifo, 0, sizeof(g_tx_fifo));
+    memset(&g_rx_fifo, 0, sizeof(g_rx_fifo));
+    memset(&g_result, 0, sizeof(g_result));
+    g_event_head    = 0U;
+    g_event_count   = 0U;
+    g_tx_sequence   = 0U;
+    g_wire_sequence = 0U;
+    g_rx_sequence   = 0U;
+
+    /** An open, idle channel served by two transfers.  IIRQ (SSISR bit 25) is read only in the bit fields. */
+    g_ssi_reg.SSISR               = (1UL << 25);
+    g_ssi_ctrl.p_reg              = &g_ssi_reg;
+    g_ssi_ctrl.p_transfer_tx      = &g_tx_transfer;
+    g_ssi_ctrl.p_transfer_rx      = &g_rx_transfer;
+    g_ssi_ctrl.fifo_access_bytes  = (uint8_t) sizeof(uint32_t);
+    g_ssi_ctrl.txi_irq            = SSP_INVALID_VECTOR;
+    g_ssi_ctrl.rxi_irq            = SSP_INVALID_VECTOR;
+    g_ssi_ctrl.int_irq            = SSP_INVALID_VECTOR;
+    g_ssi_ctrl.p_callback         = test_ssi_callback;
+    g_ssi_ctrl.open               = OPEN;
+
+    for (uint32_t i = 0U; i < (TEST_SSI_PERIODS * TEST_SSI_PERIOD_WORDS); i++)
+    {
+        g_tx_ring[i] = ++g_tx_sequence;
+        g_rx_ring[i] = 0U;
+    }
+
+    i2s_stream_cfg_t stream =
+    {
+        .p_tx_ring    = (uint8_t *) g_tx_ring,
+        .p_rx_ring    = (uint8_t *) g_rx_ring,
+        .period_bytes = TEST_SSI_PERIOD_WORDS * sizeof(uint32_t),
+        .period_count = TEST_SSI_PERIODS,
+    };
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_SSI_StreamStart(&g_ssi_ctrl, &stream));
+
+    for (g_step = 0U; g_step < p_timing->steps; g_step++)
+    {
+        /** Period interrupts, once their latency has passed */
+        if (g_step == tx_isr)
+        {
+            tx_isr = TEST_SSI_NO_ISR;
+            ssi_stream_tx_process(&g_ssi_ctrl);
+        }
+        if (g_step == rx_isr)
+        {
+            rx_isr = TEST_SSI_NO_ISR;
+            ssi_stream_rx_process(&g_ssi_ctrl);
+        }
+
+        /** The DTC keeps the transmit FIFO full while the transfer has words left */
+        while ((TEST_SSI_FIFO_STAGES > g_tx_fifo.count) && (0U != g_tx_info.length))
+        {
+            test_ssi_fifo_push(&g_tx_fifo, *(uint32_t const *) g_tx_info.p_src);
+            g_tx_info.p_src = (uint32_t const *) g_tx_info.p_src + 1;
+            g_tx_info.length--;
+            if (0U == g_tx_info.length)
+            {
+                tx_isr = g_step + 1U + p_timing->isr_latency;
+            }
+        }
+
+        /** The SSI shifts one word out and loops it back in */
+        uint32_t word = 0U;
+        if (0U == g_tx_fifo.count)
+        {
+            g_result.fifo_underflows++;
+        }
+        else
+        {
+            word = test_ssi_fifo_pop(&g_tx_fifo);
+        }
+        if (1U == g_ssi_reg.SSICR_b.MUEN)
+        {
+            word = 0U;
+            g_result.muted_words++;
+        }
+        if (0U != word)
+        {
+            g_result.wire_order_errors += (word <= g_wire_sequence) ? 1U : 0U;
+            g_wire_sequence = word;
+        }
+        if (TEST_SSI_FIFO_STAGES == g_rx_fifo.count)
+        {
+            g_result.fifo_overflows++;
+        }
+        else
+        {
+            test_ssi_fifo_push(&g_rx_fifo, word);
+        }
+
+        /** The DTC empties the receive FIFO while the transfer has words left */
+        while ((0U != g_rx_fifo.count) && (0U != g_rx_info.length))
+        {
+            *(uint32_t *) g_rx_info.p_dest = test_ssi_fifo_pop(&g_rx_fifo);
+            g_rx_info.p_dest = (uint32_t *) g_rx_info.p_dest + 1;
+            g_rx_info.length--;
+            if (0U == g_rx_info.length)
+            {
+                rx_isr = g_step + 1U + p_timing->isr_latency;
+            }
+        }
+
+        bool late = (0U != p_timing->late_from) && (g_step >= p_timing->late_from) &&
+                    (g_step < (p_timing->late_from + p_timing->late_delay));
+        test_ssi_application(late ? p_timing->late_delay : p_timing->app_delay);
+    }
+
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_SSI_InfoGet(&g_ssi_ctrl, &g_result.info));
+}
+
+/** With the interrupts inside the FIFO margin and an application one period late, every word arrives in order. */
+static void test_ssi_stream_gap_free (void)
+{
+    test_ssi_timing_t timing =
+    {
+        .isr_latency = TEST_SSI_FIFO_STAGES - 1U,
+        .app_delay   = TEST_SSI_PERIOD_WORDS,
+        .steps       = 1000U * TEST_SSI_PERIOD_WORDS,
+    };
+    test_ssi_run(&timing);
+
+    HOST_TEST_CHECK_EQUAL(0U, g_result.fifo_underflows);
+    HOST_TEST_CHECK_EQUAL(0U, g_result.fifo_overflows);
+    HOST_TEST_CHECK_EQUAL(0U, g_result.muted_words);
+    HOST_TEST_CHECK_EQUAL(0U, g_result.wire_order_errors);
+    HOST_TEST_CHECK_EQUAL(0U, g_result.rx_order_errors);
+    HOST_TEST_CHECK_EQUAL(0U, g_result.info.tx_underrun_count);
+    HOST_TEST_CHECK_EQUAL(0U, g_result.info.rx_overrun_count);
+    HOST_TEST_CHECK(g_result.tx_periods >= 998U);
+    HOST_TEST_CHECK(g_result.rx_periods >= 998U);
+
+    /** Every word shifted out was received */
+    HOST_TEST_CHECK_EQUAL(timing.steps, g_wire_sequence);
+    HOST_TEST_CHECK(g_rx_sequence > (timing.steps - (3U * TEST_SSI_PERIOD_WORDS)));
+}
+
+/** The largest period interrupt latency without a FIFO underflow or overflow is the FIFO depth less one word. */
+static void test_ssi_stream_fifo_margin (void)
+{
+    uint32_t margin = 0U;
+
+    for (uint32_t latency = 0U; latency <= (2U * TEST_SSI_FIFO_STAGES); latency++)
+    {
+        test_ssi_timing_t timing =
+        {
+            .isr_latency = latency,
+            .app_delay   = TEST_SSI_PERIOD_WORDS,
+            .steps       = 50U * TEST_SSI_PERIOD_WORDS,
+        };
+        test_ssi_run(&timing);
+        if ((0U != g_result.fifo_underflows) || (0U != g_result.fifo_overflows))
+        {
+            break;
+        }
+        margin = latency;
+    }
+
+    printf("period interrupt margin: %u words\n", (unsigned) margin);
+    HOST_TEST_CHECK_EQUAL(TEST_SSI_FIFO_STAGES - 1U, margin);
+}
+
+/** An application that misses the ring is muted and counted, and the stream keeps its timing and recovers.  Overrun
+ *  receive periods are overwritten before the application reads them, so only the wire is checked for order. */
+static void test_ssi_stream_late_application (void)
+{
+    test_ssi_timing_t timing =
+    {
+        .isr_latency = 1U,
+        .app_delay   = TEST_SSI_PERIOD_WORDS,
+        .late_from   = 100U * TEST_SSI_PERIOD_WORDS,
+        .late_delay  = (TEST_SSI_PERIODS + 2U) * TEST_SSI_PERIOD_WORDS,
+        .steps       = 200U * TEST_SSI_PERIOD_WORDS,
+    };
+    test_ssi_run(&timing);
+
+    HOST_TEST_CHECK_EQUAL(0U, g_result.fifo_underflows);
+    HOST_TEST_CHECK_EQUAL(0U, g_result.fifo_overflows);
+    HOST_TEST_CHECK_EQUAL(0U, g_result.wire_order_errors);
+    HOST_TEST_CHECK(0U != g_result.info.tx_underrun_count);
+    HOST_TEST_CHECK(0U != g_result.info.rx_overrun_count);
+    HOST_TEST_CHECK(g_result.muted_words >= (g_result.info.tx_underrun_count * TEST_SSI_PERIOD_WORDS));
+
+    /** Unmuted again, and the last periods went out in order */
+    HOST_TEST_CHECK_EQUAL(0U, g_ssi_reg.SSICR_b.MUEN);
+    HOST_TEST_CHECK(g_wire_sequence > g_rx_sequence);
+}
+
+int main (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimInit());
+
+    test_ssi_stream_gap_free();
+    test_ssi_stream_fifo_margin();
+    test_ssi_stream_late_application();
+
+    return HOST_TEST_RESULT();
+}
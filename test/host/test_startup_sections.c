@@ -0,0 +1,192 @@
+/***********************************************************************************************************************
+ * Copyright [2015-2024] Renesas Electronics Corporation and/or its licensors. All Rights Reserved.
+ * 
+ * This file is part of Renesas SynergyTM Software Package (SSP)
+ *
+ * The contents of this file (the "contents") are proprietary and confidential to Renesas Electronics Corporation
+ * and/or its licensors ("Renesas") and subject to statutory and contractual protections.
+ *
+ * This file is subject to a Renesas SSP license agreement. Unless otherwise agreed in an SSP license agreement with
+ * Renesas: 1) you may not use, copy, modify, distribute, display, or perform the contents; 2) you may not use any name
+ * or mark of Renesas for advertising or publicity purposes or in connection with your use of the contents; 3) RENESAS
+ * MAKES NO WARRANTY OR REPRESENTATIONS ABOUT THE SUITABILITY OF THE CONTENTS FOR ANY PURPOSE; THE CONTENTS ARE PROVIDED
+ * "AS IS" WITHOUT ANY EXPRESS OR IMPLIED WARRANTY, INCLUDING THE IMPLIED WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+ * PARTICULAR PURPOSE, AND NON-INFRINGEMENT; AND 4) RENESAS SHALL NOT BE LIABLE FOR ANY DIRECT, INDIRECT, SPECIAL, OR
+ * CONSEQUENTIAL DAMAGES, INCLUDING DAMAGES RESULTING FROM LOSS OF USE, DATA, OR PROJECTS, WHETHER IN AN ACTION OF
+ * CONTRACT OR TORT, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THE CONTENTS. Third-party contents
+ * included in this file may be subject to different terms.
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * File Name    : test_startup_sections.c
+ * Description  : Section clear and copy helpers of SystemInit. Checks sections of every size and alignment, word
+ *                counts that are not a multiple of the four word bursts, copies between differently aligned addresses,
+ *                and the DMAC path for long sections, including sections longer than one DMAC transfer.
+ *                The startup source is compiled into this test with the helpers and the startup DMAC enabled. The host
+ *                build runs the C word loops in place of the ARM load and store multiple assembly.
+ **********************************************************************************************************************/
+
+#include "bsp_api.h"
+
+#undef BSP_CFG_STARTUP_DMAC_ENABLE
+#define BSP_CFG_STARTUP_DMAC_ENABLE     (1)
+#undef BSP_CFG_STARTUP_DMAC_CHANNEL
+#define BSP_CFG_STARTUP_DMAC_CHANNEL    (3)
+#define BSP_HOST_SIM_SECTION_INIT
+
+#include "../../synergy/ssp/src/bsp/cmsis/Device/RENESAS/S5D9/Source/system_S5D9.c"
+#include "host_test.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_SECTION_MAX_BYTES   ((BSP_PRV_STARTUP_DMAC_MAX_WORDS * 4U) + 64U)
+#define TEST_SMALL_WORDS         (BSP_PRV_STARTUP_DMAC_MIN_WORDS + 16U)
+#define TEST_GUARD_BYTES         (8U)
+#define TEST_FILL                (0xA5U)
+
+/* Offset 0 in both buffers is word aligned. */
+static uint8_t g_source[TEST_SECTION_MAX_BYTES + (2U * TEST_GUARD_BYTES)] BSP_ALIGN_VARIABLE_V2(4);
+static uint8_t g_dest[TEST_SECTION_MAX_BYTES + (2U * TEST_GUARD_BYTES)] BSP_ALIGN_VARIABLE_V2(4);
+
+/** Number of CPU accesses to trapped register blocks, which include the DMAC. */
+static uint64_t test_trapped_accesses (void)
+{
+    bsp_sim_stats_t stats;
+    R_BSP_SimStatsGet(&stats);
+
+    return stats.accesses_trapped;
+}
+
+/** Checks that only the section was written, and that it holds the expected data. */
+static void test_section_check (uint32_t offset, uint32_t bytes, uint8_t const * p_expected)
+{
+    for (uint32_t i = 0U; i < offset; i++)
+    {
+        HOST_TEST_CHECK_EQUAL(TEST_FILL, g_dest[i]);
+    }
+    HOST_TEST_CHECK(0 == memcmp(&g_dest[offset], p_expected, bytes));
+    for (uint32_t i = offset + bytes; i < (offset + bytes + TEST_GUARD_BYTES); i++)
+    {
+        HOST_TEST_CHECK_EQUAL(TEST_FILL, g_dest[i]);
+    }
+}
+
+/** Runs one clear or copy and checks it.  Returns true if the DMAC was used. */
+static bool test_section_run (bool copy, uint32_t source_offset, uint32_t dest_offset, uint32_t bytes)
+{
+    memset(g_dest, TEST_FILL, dest_offset + bytes + TEST_GUARD_BYTES);
+
+    uint64_t accesses = test_trapped_accesses();
+    if (copy)
+    {
+        bsp_section_copy(&g_source[source_offset], &g_dest[dest_offset], bytes);
+    }
+    else
+    {
+        bsp_section_zero(&g_dest[dest_offset], bytes);
+    }
+    bool dmac = (test_trapped_accesses() != accesses);
+
+    if (copy)
+    {
+        test_section_check(dest_offset, bytes, &g_source[source_offset]);
+    }
+    else
+    {
+        static const uint8_t zero[TEST_SMALL_WORDS * 4U] = { 0U };
+        HOST_TEST_CHECK(bytes <= sizeof(zero));
+        test_section_check(dest_offset, bytes, zero);
+    }
+
+    return dmac;
+}
+
+/** Every size up to past the DMAC threshold at every alignment, copied by the CPU below the threshold. */
+static void test_sections_small (void)
+{
+    uint32_t threshold = BSP_PRV_STARTUP_DMAC_MIN_WORDS * 4U;
+
+    for (uint32_t bytes = 0U; bytes < (threshold + 8U); bytes++)
+    {
+        for (uint32_t dest_offset = 0U; dest_offset < 4U; dest_offset++)
+        {
+            /** Whole words after the leading bytes decide between the CPU and the DMAC. */
+            uint32_t head  = (4U - dest_offset) & 3U;
+            uint32_t words = (bytes > head) ? ((bytes - head) / 4U) : 0U;
+            bool     dmac  = (words >= BSP_PRV_STARTUP_DMAC_MIN_WORDS);
+
+            HOST_TEST_CHECK_EQUAL(dmac, test_section_run(false, 0U, dest_offset, bytes));
+
+            for (uint32_t source_offset = 0U; source_offset < 4U; source_offset++)
+            {
+                /** Sections with different alignments are copied byte by byte. */
+                bool same_alignment = (source_offset == dest_offset);
+                HOST_TEST_CHECK_EQUAL(dmac && same_alignment, test_section_run(true, source_offset, dest_offset, bytes));
+            }
+        }
+    }
+}
+
+/** Sections longer than one DMAC transfer are split into several. */
+static void test_sections_large (void)
+{
+    static const uint32_t sizes[] = { (BSP_PRV_STARTUP_DMAC_MAX_WORDS * 4U) - 1U, BSP_PRV_STARTUP_DMAC_MAX_WORDS * 4U,
+                                      (BSP_PRV_STARTUP_DMAC_MAX_WORDS * 4U) + 4U,
+                                      (BSP_PRV_STARTUP_DMAC_MAX_WORDS * 4U) + 63U };
+
+    for (uint32_t i = 0U; i < (sizeof(sizes) / sizeof(sizes[0])); i++)
+    {
+        uint32_t offset = i & 3U;
+        uint32_t bytes  = sizes[i];
+        HOST_TEST_CHECK(test_section_run(true, offset, offset, bytes));
+
+        memset(g_dest, TEST_FILL, offset + bytes + TEST_GUARD_BYTES);
+        bsp_section_zero(&g_dest[offset], bytes);
+        for (uint32_t j = 0U; j < bytes; j++)
+        {
+            if (0U != g_dest[offset + j])
+            {
+                HOST_TEST_CHECK_EQUAL(0U, g_dest[offset + j]);
+                break;
+            }
+        }
+        HOST_TEST_CHECK_EQUAL(TEST_FILL, g_dest[offset + bytes]);
+    }
+
+    /** The DMAC channel is returned to its reset state for the DMAC driver. */
+    R_DMAC0_Type * p_dmac = (R_DMAC0_Type *) (R_DMAC0_BASE +
+                                              (BSP_PRV_STARTUP_DMAC_CHANNEL_SIZE * BSP_CFG_STARTUP_DMAC_CHANNEL));
+    HOST_TEST_CHECK_EQUAL(0U, p_dmac->DMCNT);
+    HOST_TEST_CHECK_EQUAL(0U, p_dmac->DMTMD);
+    HOST_TEST_CHECK_EQUAL(0U, p_dmac->DMAMD);
+    HOST_TEST_CHECK_EQUAL(0U, p_dmac->DMCRA);
+    HOST_TEST_CHECK_EQUAL(0U, R_DMA->DMAST);
+}
+
+/** Sections laid out like the linker zero and copy tables, whose sizes are whole words. */
+static void test_sections_tables (void)
+{
+    for (uint32_t words = 0U; words < TEST_SMALL_WORDS; words++)
+    {
+        HOST_TEST_CHECK_EQUAL(words >= BSP_PRV_STARTUP_DMAC_MIN_WORDS, test_section_run(false, 0U, 0U, words * 4U));
+        HOST_TEST_CHECK_EQUAL(words >= BSP_PRV_STARTUP_DMAC_MIN_WORDS, test_section_run(true, 0U, 0U, words * 4U));
+    }
+}
+
+int main (void)
+{
+    HOST_TEST_CHECK_EQUAL(SSP_SUCCESS, R_BSP_SimInit());
+
+    srand(5U);
+    for (uint32_t i = 0U; i < sizeof(g_source); i++)
+    {
+        g_source[i] = (uint8_t) rand();
+    }
+
+    test_sections_small();
+    test_sections_large();
+    test_sections_tables();
+
+    return HOST_TEST_RESULT();
+}